@@ -443,6 +443,14 @@ void VM_Version::initialize() {
     OptoScheduling = true;
   }
 
+  // Neoverse N1: also schedule for register pressure before register
+  // allocation
+  if (_cpu == CPU_ARM && (_model == 0xd0c || _model2 == 0xd0c)) {
+    if (FLAG_IS_DEFAULT(OptoRegScheduling)) {
+      FLAG_SET_DEFAULT(OptoRegScheduling, true);
+    }
+  }
+
   if (FLAG_IS_DEFAULT(AlignVector)) {
     AlignVector = AvoidUnalignedAccesses;
   }
@@ -502,6 +502,7 @@ void TemplateTable::iload_internal(RewriteControl rc) {
 
   // Rewrite iload,iload  pair into fast_iload2
   //         iload,caload pair into fast_icaload
+  //         iload,iaload pair into fast_iiaload
   if (RewriteFrequentPairs && rc == may_rewrite) {
     Label Lrewrite, Ldone;
     Register Rnext_byte  = R3_ARG1,
@@ -526,6 +527,10 @@ void TemplateTable::iload_internal(RewriteControl rc) {
     __ li(Rrewrite_to, (unsigned int)(unsigned char)Bytecodes::_fast_icaload);
     __ beq(CCR0, Lrewrite);
 
+    __ cmpwi(CCR0, Rnext_byte, (unsigned int)(unsigned char)Bytecodes::_iaload);
+    __ li(Rrewrite_to, (unsigned int)(unsigned char)Bytecodes::_fast_iiaload);
+    __ beq(CCR0, Lrewrite);
+
     __ li(Rrewrite_to, (unsigned int)(unsigned char)Bytecodes::_fast_iload);
 
     __ bind(Lrewrite);
@@ -727,6 +732,20 @@ void TemplateTable::fast_icaload() {
   __ lhz(R17_tos, arrayOopDesc::base_offset_in_bytes(T_CHAR), Rload_addr);
 }
 
+// Iload followed by iaload frequent pair.
+void TemplateTable::fast_iiaload() {
+  transition(vtos, itos);
+
+  const Register Rload_addr = R3_ARG1,
+                 Rarray     = R4_ARG2,
+                 Rtemp      = R11_scratch1;
+
+  locals_index(R17_tos);
+  __ load_local_int(R17_tos, Rtemp, R17_tos);
+  __ index_check(Rarray, R17_tos /* index */, LogBytesPerInt, Rtemp, Rload_addr);
+  __ lwa(R17_tos, arrayOopDesc::base_offset_in_bytes(T_INT), Rload_addr);
+}
+
 void TemplateTable::saload() {
   transition(itos, itos);
 
@@ -666,6 +666,11 @@ void TemplateTable::iload_internal(RewriteControl rc) {
     __ compareU32_and_branch(Z_R1_scratch, Bytecodes::_caload,
                              Assembler::bcondEqual, rewrite);
 
+    // If _iaload, rewrite to fast_iiaload.
+    __ load_const_optimized(bc, Bytecodes::_fast_iiaload);
+    __ compareU32_and_branch(Z_R1_scratch, Bytecodes::_iaload,
+                             Assembler::bcondEqual, rewrite);
+
     // Rewrite so iload doesn't check again.
     __ load_const_optimized(bc, Bytecodes::_fast_iload);
 
@@ -898,6 +903,23 @@ void TemplateTable::fast_icaload() {
             Address(Z_tmp_2, Z_ARG3, arrayOopDesc::base_offset_in_bytes(T_CHAR)));
 }
 
+// Iload followed by iaload frequent pair.
+void TemplateTable::fast_iiaload() {
+  transition(vtos, itos);
+
+  // Load index out of locals.
+  locals_index(Z_R1_scratch);
+  __ mem2reg_opt(Z_ARG3, iaddress(_masm, Z_R1_scratch), false);
+  // Z_ARG3  : index
+  // Z_tmp_1 : array
+  __ pop_ptr(Z_tmp_1);
+  index_check(Z_tmp_1, Z_ARG3, LogBytesPerInt);
+  // Load the value.
+  __ mem2reg_opt(Z_tos,
+                 Address(Z_tmp_1, Z_ARG3, arrayOopDesc::base_offset_in_bytes(T_INT)),
+                 false);
+}
+
 void TemplateTable::saload() {
   transition(itos, itos);
 
@@ -54,6 +54,14 @@ int C1_MacroAssembler::lock_object(Register hdr, Register obj, Register disp_hdr
 
   null_check_offset = offset();
 
+  if (UseLightweightLocking) {
+    // The runtime maintains the lock stack. Loading the header
+    // performs the implicit null check.
+    movptr(hdr, Address(obj, hdr_offset));
+    jmp(slow_case);
+    return null_check_offset;
+  }
+
   if (DiagnoseSyncOnValueBasedClasses != 0) {
     load_klass(hdr, obj, rklass_decode_tmp);
     movl(hdr, Address(hdr, Klass::access_flags_offset()));
@@ -116,6 +124,12 @@ void C1_MacroAssembler::unlock_object(Register hdr, Register obj, Register disp_
   assert(hdr != obj && hdr != disp_hdr && obj != disp_hdr, "registers must be different");
   Label done;
 
+  if (UseLightweightLocking) {
+    // The runtime maintains the lock stack.
+    jmp(slow_case);
+    return;
+  }
+
   if (UseBiasedLocking) {
     // load object
     movptr(obj, Address(disp_hdr, BasicObjectLock::obj_offset_in_bytes()));
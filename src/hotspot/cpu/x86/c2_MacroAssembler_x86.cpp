@@ -486,6 +486,12 @@ void C2_MacroAssembler::fast_lock(Register objReg, Register boxReg, Register tmp
 
   Label IsInflated, DONE_LABEL;
 
+  if (UseLightweightLocking) {
+    // The runtime maintains the lock stack: take the slow path (ZF == 0).
+    testptr(objReg, objReg);
+    jmp(DONE_LABEL);
+  }
+
   if (DiagnoseSyncOnValueBasedClasses != 0) {
     load_klass(tmpReg, objReg, cx1Reg);
     movl(tmpReg, Address(tmpReg, Klass::access_flags_offset()));
@@ -659,6 +665,12 @@ void C2_MacroAssembler::fast_unlock(Register objReg, Register boxReg, Register t
 
   Label DONE_LABEL, Stacked, CheckSucc;
 
+  if (UseLightweightLocking) {
+    // The runtime maintains the lock stack: take the slow path (ZF == 0).
+    testptr(objReg, objReg);
+    jmp(DONE_LABEL);
+  }
+
   // Critically, the biased locking test must have precedence over
   // and appear before the (box->dhw == 0) recursive stack-lock test.
   if (UseBiasedLocking && !UseOptoBiasInlining) {
@@ -2846,7 +2858,8 @@ void C2_MacroAssembler::string_indexof(Register str1, Register str2,
 } // string_indexof
 
 void C2_MacroAssembler::string_indexof_char(Register str1, Register cnt1, Register ch, Register result,
-                                            XMMRegister vec1, XMMRegister vec2, XMMRegister vec3, Register tmp) {
+                                            XMMRegister vec1, XMMRegister vec2, XMMRegister vec3, Register tmp,
+                                            KRegister mask) {
   ShortBranchVerifier sbv(this);
   assert(UseSSE42Intrinsics, "SSE4.2 intrinsics are required");
 
@@ -2856,8 +2869,32 @@ void C2_MacroAssembler::string_indexof_char(Register str1, Register cnt1, Regist
         SCAN_TO_8_CHAR, SCAN_TO_8_CHAR_LOOP, SCAN_TO_16_CHAR_LOOP,
         RET_NOT_FOUND, SCAN_TO_8_CHAR_INIT,
         FOUND_SEQ_CHAR, DONE_LABEL;
+  Label SCAN_TO_32_CHAR_LOOP, SCAN_TAIL, FOUND_CHAR_64;
 
   movptr(result, str1);
+#ifdef _LP64
+  bool use_evex = (mask != knoreg) && (AVX3Threshold == 0) && (UseAVX > 2) &&
+                  VM_Version::supports_avx512bw();
+  if (use_evex) {
+    // Compare 32 chars at a time, then continue with the AVX2 and SSE
+    // loops below for the remaining (at most 31) chars.
+    cmpl(cnt1, 4*stride);
+    jcc(Assembler::less, SCAN_TAIL);
+    evpbroadcastw(vec1, ch, Assembler::AVX_512bit);
+    movl(tmp, cnt1);
+    andl(tmp, 0xFFFFFFE0);  //vector count (in chars)
+    andl(cnt1,0x0000001F);  //tail count (in chars)
+
+    bind(SCAN_TO_32_CHAR_LOOP);
+    evpcmpeqw(mask, vec1, Address(result, 0), Assembler::AVX_512bit);
+    kortestdl(mask, mask);
+    jcc(Assembler::notZero, FOUND_CHAR_64);
+    addptr(result, 64);
+    subl(tmp, 4*stride);
+    jcc(Assembler::notZero, SCAN_TO_32_CHAR_LOOP);
+    bind(SCAN_TAIL);
+  }
+#endif
   if (UseAVX >= 2) {
     cmpl(cnt1, stride);
     jcc(Assembler::less, SCAN_TO_CHAR);
@@ -2920,7 +2957,17 @@ void C2_MacroAssembler::string_indexof_char(Register str1, Register cnt1, Regist
 
   bind(RET_NOT_FOUND);
   movl(result, -1);
-  jmpb(DONE_LABEL);
+  jmp(DONE_LABEL);
+
+#ifdef _LP64
+  if (use_evex) {
+    bind(FOUND_CHAR_64);
+    kmovdl(tmp, mask);
+    bsfl(ch, tmp);
+    lea(result, Address(result, ch, Address::times_2));
+    jmp(FOUND_SEQ_CHAR);
+  }
+#endif
 
   bind(FOUND_CHAR);
   if (UseAVX >= 2) {
@@ -2939,7 +2986,8 @@ void C2_MacroAssembler::string_indexof_char(Register str1, Register cnt1, Regist
 } // string_indexof_char
 
 void C2_MacroAssembler::stringL_indexof_char(Register str1, Register cnt1, Register ch, Register result,
-                                            XMMRegister vec1, XMMRegister vec2, XMMRegister vec3, Register tmp) {
+                                            XMMRegister vec1, XMMRegister vec2, XMMRegister vec3, Register tmp,
+                                            KRegister mask) {
   ShortBranchVerifier sbv(this);
   assert(UseSSE42Intrinsics, "SSE4.2 intrinsics are required");
 
@@ -2949,8 +2997,32 @@ void C2_MacroAssembler::stringL_indexof_char(Register str1, Register cnt1, Regis
         SCAN_TO_16_CHAR, SCAN_TO_16_CHAR_LOOP, SCAN_TO_32_CHAR_LOOP,
         RET_NOT_FOUND, SCAN_TO_16_CHAR_INIT,
         FOUND_SEQ_CHAR, DONE_LABEL;
+  Label SCAN_TO_64_CHAR_LOOP, SCAN_TAIL, FOUND_CHAR_64;
 
   movptr(result, str1);
+#ifdef _LP64
+  bool use_evex = (mask != knoreg) && (AVX3Threshold == 0) && (UseAVX > 2) &&
+                  VM_Version::supports_avx512bw();
+  if (use_evex) {
+    // Compare 64 bytes at a time, then continue with the AVX2 and SSE
+    // loops below for the remaining (at most 63) bytes.
+    cmpl(cnt1, stride*4);
+    jcc(Assembler::less, SCAN_TAIL);
+    evpbroadcastb(vec1, ch, Assembler::AVX_512bit);
+    movl(tmp, cnt1);
+    andl(tmp, 0xFFFFFFC0);  //vector count (in chars)
+    andl(cnt1,0x0000003F);  //tail count (in chars)
+
+    bind(SCAN_TO_64_CHAR_LOOP);
+    evpcmpeqb(mask, vec1, Address(result, 0), Assembler::AVX_512bit);
+    kortestql(mask, mask);
+    jcc(Assembler::notZero, FOUND_CHAR_64);
+    addptr(result, 64);
+    subl(tmp, stride*4);
+    jcc(Assembler::notZero, SCAN_TO_64_CHAR_LOOP);
+    bind(SCAN_TAIL);
+  }
+#endif
   if (UseAVX >= 2) {
     cmpl(cnt1, stride);
     jcc(Assembler::less, SCAN_TO_CHAR_INIT);
@@ -3014,7 +3086,17 @@ void C2_MacroAssembler::stringL_indexof_char(Register str1, Register cnt1, Regis
 
   bind(RET_NOT_FOUND);
   movl(result, -1);
-  jmpb(DONE_LABEL);
+  jmp(DONE_LABEL);
+
+#ifdef _LP64
+  if (use_evex) {
+    bind(FOUND_CHAR_64);
+    kmovql(tmp, mask);
+    bsfq(ch, tmp);
+    addptr(result, ch);
+    jmp(FOUND_SEQ_CHAR);
+  }
+#endif
 
   bind(FOUND_CHAR);
   if (UseAVX >= 2) {
@@ -230,10 +230,12 @@ public:
                              Register tmp, int masklen, int vec_enc);
 #endif
   void string_indexof_char(Register str1, Register cnt1, Register ch, Register result,
-                           XMMRegister vec1, XMMRegister vec2, XMMRegister vec3, Register tmp);
+                           XMMRegister vec1, XMMRegister vec2, XMMRegister vec3, Register tmp,
+                           KRegister mask);
 
   void stringL_indexof_char(Register str1, Register cnt1, Register ch, Register result,
-                           XMMRegister vec1, XMMRegister vec2, XMMRegister vec3, Register tmp);
+                           XMMRegister vec1, XMMRegister vec2, XMMRegister vec3, Register tmp,
+                           KRegister mask);
 
   // IndexOf strings.
   // Small strings are loaded through stack if they cross page boundary.
@@ -4066,12 +4066,29 @@ void MacroAssembler::check_klass_subtype_slow_path(Register sub_klass,
   LP64_ONLY( incrementl(Address(rcx, 0)) );
 #endif //PRODUCT
 
-  // We will consult the secondary-super array.
-  movptr(rdi, secondary_supers_addr);
-  // Load the array length.  (Positive movl does right thing on LP64.)
-  movl(rcx, Address(rdi, Array<Klass*>::length_offset_in_bytes()));
-  // Skip to start of data.
-  addptr(rdi, Array<Klass*>::base_offset_in_bytes());
+  if (UseSecondarySupersTable && sub_klass != rdi) {
+    // Test the bit of the super's hash slot in the sub's bitmap. If it is
+    // clear, scan zero words below, which leaves Z = 0 (not found).
+    Label L_scan;
+    movzbl(rcx, Address(rax, in_bytes(Klass::hash_slot_offset())));
+    movptr(rdi, Address(sub_klass, in_bytes(Klass::secondary_supers_bitmap_offset())));
+    shrptr(rdi);
+    testl(rdi, 1);
+    // The following moves and lea do not change the flags.
+    movptr(rdi, secondary_supers_addr);
+    movl(rcx, Address(rdi, Array<Klass*>::length_offset_in_bytes()));
+    lea(rdi, Address(rdi, Array<Klass*>::base_offset_in_bytes()));
+    jccb(Assembler::notZero, L_scan);
+    movl(rcx, 0);
+    bind(L_scan);
+  } else {
+    // We will consult the secondary-super array.
+    movptr(rdi, secondary_supers_addr);
+    // Load the array length.  (Positive movl does right thing on LP64.)
+    movl(rcx, Address(rdi, Array<Klass*>::length_offset_in_bytes()));
+    // Skip to start of data.
+    addptr(rdi, Array<Klass*>::base_offset_in_bytes());
+  }
 
   // Scan RCX words at [RDI] for an occurrence of RAX.
   // Set NZ/Z based on last compare.
@@ -5946,6 +5946,184 @@ address generate_avx_ghash_processBlocks() {
     return start;
   }
 
+  // Loads the element at src into dst, widened to an int the way
+  // Java widens an element of type eltype.
+  void load_hash_code_element(BasicType eltype, Register dst, Address src) {
+    switch (eltype) {
+      case T_BOOLEAN: __ movzbl(dst, src); break;
+      case T_BYTE:    __ movsbl(dst, src); break;
+      case T_CHAR:    __ movzwl(dst, src); break;
+      case T_SHORT:   __ movswl(dst, src); break;
+      case T_INT:     __ movl(dst, src);   break;
+      default:        ShouldNotReachHere();
+    }
+  }
+
+  // Loads 8 consecutive elements at src into the int lanes of dst.
+  void load_hash_code_vector(BasicType eltype, XMMRegister dst, Address src) {
+    switch (eltype) {
+      case T_BOOLEAN:
+        __ movq(dst, src);
+        __ vpmovzxbd(dst, dst, Assembler::AVX_256bit);
+        break;
+      case T_BYTE:
+        __ movq(dst, src);
+        __ vpmovsxbd(dst, dst, Assembler::AVX_256bit);
+        break;
+      case T_CHAR:
+        __ movdqu(dst, src);
+        __ vpmovzxwd(dst, dst, Assembler::AVX_256bit);
+        break;
+      case T_SHORT:
+        __ movdqu(dst, src);
+        __ vpmovsxwd(dst, dst, Assembler::AVX_256bit);
+        break;
+      case T_INT:
+        __ vmovdqu(dst, src);
+        break;
+      default:
+        ShouldNotReachHere();
+    }
+  }
+
+  // Hashes the elements of one element type. Blocks of 32 elements are
+  // accumulated in four 8-lane vectors, each multiplied by 31^32 per block,
+  // while result is multiplied by 31^32 alongside. The lanes are then
+  // weighted by the powers table and summed, and the remaining elements
+  // are hashed one at a time.
+  void vectorized_hash_code(BasicType eltype, Register ary, Register length, Register result,
+                            Register index, Register limit, Register tmp,
+                            address powers, jint power32) {
+    const XMMRegister vmul = xmm4;
+    const XMMRegister vtmp = xmm5;
+    const XMMRegister acc[4] = { xmm0, xmm1, xmm2, xmm3 };
+    const int elsize = type2aelembytes(eltype);
+    const Address::ScaleFactor scale = Address::times(elsize);
+
+    Label L_scalar, L_scalar_loop, L_vector_loop, L_done;
+
+    __ xorl(index, index);
+    __ cmpl(length, 32);
+    __ jcc(Assembler::less, L_scalar);
+
+    __ movl(limit, length);
+    __ andl(limit, ~31);
+    __ lea(tmp, InternalAddress(powers));
+    __ vpbroadcastd(vmul, Address(tmp, 32 * sizeof(jint)), Assembler::AVX_256bit);
+    for (int k = 0; k < 4; k++) {
+      __ vpxor(acc[k], acc[k], acc[k], Assembler::AVX_256bit);
+    }
+
+    __ align(OptoLoopAlignment);
+    __ bind(L_vector_loop);
+    __ imull(result, result, power32);
+    for (int k = 0; k < 4; k++) {
+      __ vpmulld(acc[k], acc[k], vmul, Assembler::AVX_256bit);
+      load_hash_code_vector(eltype, vtmp, Address(ary, index, scale, k * 8 * elsize));
+      __ vpaddd(acc[k], acc[k], vtmp, Assembler::AVX_256bit);
+    }
+    __ addl(index, 32);
+    __ cmpl(index, limit);
+    __ jcc(Assembler::less, L_vector_loop);
+
+    for (int k = 0; k < 4; k++) {
+      __ vpmulld(acc[k], acc[k], Address(tmp, k * 8 * sizeof(jint)), Assembler::AVX_256bit);
+    }
+    __ vpaddd(acc[0], acc[0], acc[1], Assembler::AVX_256bit);
+    __ vpaddd(acc[2], acc[2], acc[3], Assembler::AVX_256bit);
+    __ vpaddd(acc[0], acc[0], acc[2], Assembler::AVX_256bit);
+    __ vextracti128_high(vtmp, acc[0]);
+    __ vpaddd(acc[0], acc[0], vtmp, Assembler::AVX_128bit);
+    __ vpshufd(vtmp, acc[0], 0x4E, Assembler::AVX_128bit);
+    __ vpaddd(acc[0], acc[0], vtmp, Assembler::AVX_128bit);
+    __ vpshufd(vtmp, acc[0], 0xB1, Assembler::AVX_128bit);
+    __ vpaddd(acc[0], acc[0], vtmp, Assembler::AVX_128bit);
+    __ movdl(tmp, acc[0]);
+    __ addl(result, tmp);
+
+    __ bind(L_scalar);
+    __ cmpl(index, length);
+    __ jcc(Assembler::greaterEqual, L_done);
+    __ bind(L_scalar_loop);
+    __ imull(result, result, 31);
+    load_hash_code_element(eltype, tmp, Address(ary, index, scale));
+    __ addl(result, tmp);
+    __ incrementl(index);
+    __ cmpl(index, length);
+    __ jcc(Assembler::less, L_scalar_loop);
+    __ bind(L_done);
+  }
+
+  /**
+   *  Arguments:
+   *
+   *  Input:
+   *    c_rarg0   - ary      address of the first element
+   *    c_rarg1   - length   number of elements
+   *    c_rarg2   - initial  initial hash value
+   *    c_rarg3   - eltype   BasicType of the elements, T_BOOLEAN for unsigned bytes
+   *
+   *  Output:
+   *        rax   - int initial * 31^length + sum of ary[i] * 31^(length - 1 - i)
+   */
+  address generate_vectorizedHashCode() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "vectorizedHashCode");
+
+    // 31^31 down to 31^0, weighting the lanes of the accumulators,
+    // followed by the per block multiplier 31^32.
+    address powers = __ pc();
+    juint table[33];
+    juint power = 1;
+    for (int i = 31; i >= 0; i--) {
+      table[i] = power;
+      power *= 31;
+    }
+    table[32] = power;
+    for (int i = 0; i < 33; i++) {
+      __ emit_int32((jint)table[i]);
+    }
+
+    __ align(CodeEntryAlignment);
+    address start = __ pc();
+
+    BLOCK_COMMENT("Entry:");
+    __ enter();
+
+    const Register ary    = c_rarg0;
+    const Register length = c_rarg1;
+    const Register eltype = c_rarg3;
+    const Register result = rax;
+    const Register index  = r10;
+    const Register limit  = r11;
+    const Register tmp    = c_rarg2; // free once the initial value is in result
+
+    __ movl(result, c_rarg2);
+
+    const BasicType types[] = { T_BOOLEAN, T_BYTE, T_CHAR, T_SHORT, T_INT };
+    const int ntypes = sizeof(types) / sizeof(types[0]);
+    Label L_type[ntypes], L_exit;
+    for (int i = 0; i < ntypes - 1; i++) {
+      __ cmpl(eltype, types[i]);
+      __ jcc(Assembler::equal, L_type[i]);
+    }
+    // Anything else is T_INT
+    for (int i = ntypes - 1; i >= 0; i--) {
+      __ bind(L_type[i]);
+      vectorized_hash_code(types[i], ary, length, result, index, limit, tmp, powers, (jint)table[32]);
+      if (i > 0) {
+        __ jmp(L_exit);
+      }
+    }
+
+    __ bind(L_exit);
+    __ vzeroupper();
+    __ leave();
+    __ ret(0);
+
+    return start;
+  }
+
 /**
    *  Arguments:
    *
@@ -7062,6 +7240,10 @@ address generate_avx_ghash_processBlocks() {
     if (UseVectorizedMismatchIntrinsic) {
       StubRoutines::_vectorizedMismatch = generate_vectorizedMismatch();
     }
+
+    if (UseVectorizedHashCodeIntrinsic) {
+      StubRoutines::_vectorizedHashCode = generate_vectorizedHashCode();
+    }
   }
 
  public:
@@ -646,6 +646,11 @@ void TemplateTable::iload_internal(RewriteControl rc) {
     __ movl(bc, Bytecodes::_fast_icaload);
     __ jccb(Assembler::equal, rewrite);
 
+    // if _iaload, rewrite to fast_iiaload
+    __ cmpl(rbx, Bytecodes::_iaload);
+    __ movl(bc, Bytecodes::_fast_iiaload);
+    __ jccb(Assembler::equal, rewrite);
+
     // rewrite so iload doesn't check again.
     __ movl(bc, Bytecodes::_fast_iload);
 
@@ -864,6 +869,22 @@ void TemplateTable::fast_icaload() {
                     noreg, noreg);
 }
 
+// iload followed by iaload frequent pair
+void TemplateTable::fast_iiaload() {
+  transition(vtos, itos);
+  // load index out of locals
+  locals_index(rbx);
+  __ movl(rax, iaddress(rbx));
+
+  // rax: index
+  // rdx: array
+  index_check(rdx, rax); // kills rbx
+  __ access_load_at(T_INT, IN_HEAP | IS_ARRAY, rax,
+                    Address(rdx, rax, Address::times_4,
+                            arrayOopDesc::base_offset_in_bytes(T_INT)),
+                    noreg, noreg);
+}
+
 
 void TemplateTable::saload() {
   transition(itos, itos);
@@ -3716,6 +3737,22 @@ void TemplateTable::fast_invokevfinal(int byte_no) {
 }
 
 
+// The index returned by get_cache_and_index_at_bcp counts words of
+// ConstantPoolCacheEntry, which is four times larger than a Method*.
+static const Address::ScaleFactor call_site_methods_scale = LP64_ONLY(Address::times_2) NOT_LP64(Address::times_1);
+
+// Returns the address of the call site method of the current invokeinterface,
+// or jumps to no_methods if the constant pool cache has none. Destroys the
+// bcp register, which is used for index.
+Address TemplateTable::call_site_method_address(Register methods, Register index, Label& no_methods) {
+  assert(index == rbcp, "index is loaded from bcp");
+  __ get_cache_and_index_at_bcp(methods, index, 1);
+  __ movptr(methods, Address(methods, ConstantPoolCache::call_site_methods_offset_in_bytes()));
+  __ testptr(methods, methods);
+  __ jcc(Assembler::zero, no_methods);
+  return Address(methods, index, call_site_methods_scale, Array<Method*>::base_offset_in_bytes());
+}
+
 void TemplateTable::invokeinterface(int byte_no) {
   transition(vtos, vtos);
   assert(byte_no == f1_byte, "use this argument");
@@ -3777,6 +3814,26 @@ void TemplateTable::invokeinterface(int byte_no) {
   __ null_check(rcx, oopDesc::klass_offset_in_bytes());
   __ load_klass(rdx, rcx, tmp_load_klass);
 
+  if (UseInterpreterInterfaceCallCache) {
+    // Reuse the method found by the last call from this call site if the
+    // receiver has the same class and the class declares the method.
+    Label not_cached;
+    __ movptr(rlocals, call_site_method_address(rlocals, rbcp, not_cached));
+    __ testptr(rlocals, rlocals);
+    __ jcc(Assembler::zero, not_cached);
+    __ load_method_holder(rbcp, rlocals);
+    __ cmpptr(rbcp, rdx);
+    __ jcc(Assembler::notEqual, not_cached);
+    __ mov(rbx, rlocals);
+    __ restore_bcp();
+    __ profile_virtual_call(rdx, rbcp, rlocals);
+    __ profile_arguments_type(rdx, rbx, rbcp, true);
+    __ jump_from_interpreted(rbx, rdx);
+    __ bind(not_cached);
+    __ restore_bcp();
+    __ restore_locals();
+  }
+
   Label no_such_method;
 
   // Preserve method for throw_AbstractMethodErrorVerbose.
@@ -3817,6 +3874,17 @@ void TemplateTable::invokeinterface(int byte_no) {
   __ testptr(rbx, rbx);
   __ jcc(Assembler::zero, no_such_method);
 
+  if (UseInterpreterInterfaceCallCache) {
+    Label no_cache;
+    __ load_method_holder(rbcp, rbx);
+    __ cmpptr(rbcp, rdx);
+    __ jcc(Assembler::notEqual, no_cache);
+    __ restore_bcp();
+    __ movptr(call_site_method_address(rlocals, rbcp, no_cache), rbx);
+    __ bind(no_cache);
+    __ restore_bcp();
+  }
+
   __ profile_arguments_type(rdx, rbx, rbcp, true);
 
   // do the call
@@ -33,6 +33,8 @@
                              );
   static void invokevirtual_helper(Register index, Register recv,
                                    Register flags);
+  static Address call_site_method_address(Register methods, Register index,
+                                          Label& no_methods);
   static void volatile_barrier(Assembler::Membar_mask_bits order_constraint);
 
   // Helpers
@@ -25,6 +25,7 @@
 #include <string.h>
 #include <math.h>
 #include <errno.h>
+#include <sys/inotify.h>
 #include "cgroupSubsystem_linux.hpp"
 #include "cgroupV1Subsystem_linux.hpp"
 #include "cgroupV2Subsystem_linux.hpp"
@@ -514,3 +515,35 @@ jlong CgroupSubsystem::memory_limit_in_bytes() {
   memory_limit->set_value(mem_limit, OSCONTAINER_CACHE_TIMEOUT);
   return mem_limit;
 }
+
+void CgroupSubsystem::refresh_limits(jlong* memory_limit, int* active_processor_count) {
+  // A reader racing with the refresh may store a stale value with the
+  // usual timeout after us, in which case it is re-read once that expires.
+  CachedMetric* memory_cache = memory_controller()->metrics_cache();
+  memory_cache->invalidate();
+  *memory_limit = memory_limit_in_bytes();
+  memory_cache->set_value_until_invalidated(*memory_limit);
+
+  CachedMetric* cpu_cache = cpu_controller()->metrics_cache();
+  cpu_cache->invalidate();
+  *active_processor_count = this->active_processor_count();
+  cpu_cache->set_value_until_invalidated(*active_processor_count);
+}
+
+bool CgroupSubsystem::watch_file(int fd, CgroupController* c, const char* filename) {
+  if (c == NULL || c->subsystem_path() == NULL) {
+    return false;
+  }
+  char file[MAXPATHLEN+1];
+  int len = os::snprintf(file, sizeof(file), "%s%s", c->subsystem_path(), filename);
+  if (len < 0 || len >= (int)sizeof(file)) {
+    log_debug(os, container)("File path too long %s, %s", c->subsystem_path(), filename);
+    return false;
+  }
+  if (inotify_add_watch(fd, file, IN_MODIFY) < 0) {
+    log_debug(os, container)("Failed to watch %s: %s", file, os::strerror(errno));
+    return false;
+  }
+  log_trace(os, container)("Watching %s", file);
+  return true;
+}
@@ -217,6 +217,12 @@ class CachedMetric : public CHeapObj<mtInternal>{
       // metric config
       _next_check_counter = os::elapsed_counter() + timeout;
     }
+    // Used when the metric config is watched, see UseContainerLimitWatcher.
+    void set_value_until_invalidated(jlong value) {
+      _metric = value;
+      _next_check_counter = max_jlong;
+    }
+    void invalidate() { _next_check_counter = min_jlong; }
 };
 
 class CachingCgroupController : public CHeapObj<mtInternal> {
@@ -252,6 +258,16 @@ class CgroupSubsystem: public CHeapObj<mtInternal> {
     virtual const char * container_type() = 0;
     virtual CachingCgroupController* memory_controller() = 0;
     virtual CachingCgroupController* cpu_controller() = 0;
+
+    // Adds inotify watches to fd for the files that memory_limit_in_bytes()
+    // and active_processor_count() are based on. Returns false if one of
+    // them could not be watched.
+    virtual bool watch_limit_files(int fd) = 0;
+    // Re-reads and caches both limits until the next refresh.
+    void refresh_limits(jlong* memory_limit, int* active_processor_count);
+
+  protected:
+    static bool watch_file(int fd, CgroupController* c, const char* filename);
 };
 
 // Utility class for storing info retrieved from /proc/cgroups,
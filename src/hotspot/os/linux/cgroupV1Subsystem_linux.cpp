@@ -241,3 +241,13 @@ int CgroupV1Subsystem::cpu_shares() {
 
   return shares;
 }
+
+bool CgroupV1Subsystem::watch_limit_files(int fd) {
+  // Limits inherited through memory.stat's hierarchical_memory_limit
+  // are not watched, see CgroupV1MemoryController::uses_mem_hierarchy().
+  return watch_file(fd, _memory->controller(), "/memory.limit_in_bytes") &&
+         watch_file(fd, _cpu->controller(), "/cpu.cfs_quota_us") &&
+         watch_file(fd, _cpu->controller(), "/cpu.cfs_period_us") &&
+         watch_file(fd, _cpu->controller(), "/cpu.shares") &&
+         watch_file(fd, _cpuset, "/cpuset.cpus");
+}
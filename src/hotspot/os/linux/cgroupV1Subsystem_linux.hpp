@@ -92,6 +92,7 @@ class CgroupV1Subsystem: public CgroupSubsystem {
     }
     CachingCgroupController * memory_controller() { return _memory; }
     CachingCgroupController * cpu_controller() { return _cpu; }
+    bool watch_limit_files(int fd);
 
   private:
     julong _unlimited_memory;
@@ -244,3 +244,10 @@ char* CgroupV2Controller::construct_path(char* mount_path, char *cgroup_path) {
   return os::strdup(buf);
 }
 
+bool CgroupV2Subsystem::watch_limit_files(int fd) {
+  // cpuset.cpus only exists if the cpuset controller is enabled.
+  watch_file(fd, _unified, "/cpuset.cpus");
+  return watch_file(fd, _unified, "/memory.max") &&
+         watch_file(fd, _unified, "/cpu.max") &&
+         watch_file(fd, _unified, "/cpu.weight");
+}
@@ -84,6 +84,7 @@ class CgroupV2Subsystem: public CgroupSubsystem {
     }
     CachingCgroupController * memory_controller() { return _memory; }
     CachingCgroupController * cpu_controller() { return _cpu; }
+    bool watch_limit_files(int fd);
 };
 
 #endif // CGROUP_V2_SUBSYSTEM_LINUX_HPP
@@ -44,12 +44,22 @@
   product(bool, UseLinuxPosixThreadCPUClocks, true,                     \
           "enable fast Linux Posix clocks where available")             \
                                                                         \
+  product(bool, UseTSCForJavaTimeNanos, false, EXPERIMENTAL,            \
+          "Compute System.nanoTime() from the TSC, calibrated against"  \
+          " CLOCK_MONOTONIC, if the CPU has an invariant TSC and the"   \
+          " kernel considers it a reliable clock source (x86_64 only)") \
+                                                                        \
   product(bool, UseHugeTLBFS, false,                                    \
           "Use MAP_HUGETLB for large pages")                            \
                                                                         \
   product(bool, UseTransparentHugePages, false,                         \
           "Use MADV_HUGEPAGE for large pages")                          \
                                                                         \
+  product(bool, PopulateTransparentHugePages, false, EXPERIMENTAL,      \
+          "Populate memory committed for large pages and collapse it"   \
+          " into transparent huge pages, using MADV_POPULATE_WRITE"     \
+          " and MADV_COLLAPSE, instead of waiting for khugepaged")      \
+                                                                        \
   product(bool, LoadExecStackDllInVMThread, true,                       \
           "Load DLLs with executable-stack attribute in the VM Thread") \
                                                                         \
@@ -64,10 +74,25 @@
           " of quotas (if set), when true. Otherwise, use the CPU"      \
           " shares value, provided it is less than quota.")             \
                                                                         \
+  product(bool, UseContainerLimitWatcher, false, EXPERIMENTAL,          \
+          "Watch the container memory and CPU limit files with inotify" \
+          " instead of re-reading them after a short timeout")          \
+                                                                        \
   product(bool, AdjustStackSizeForTLS, false,                           \
           "Increase the thread stack size to include space for glibc "  \
           "static thread-local storage (TLS) if true")                  \
                                                                         \
+  product(uint, NativeThreadPoolSize, 0, EXPERIMENTAL,                  \
+          "Maximum number of native threads of terminated Java "        \
+          "threads that are kept parked for reuse by new Java threads " \
+          "with the same stack size. 0 disables the reuse")             \
+          range(0, 4096)                                                \
+                                                                        \
+  product(uintx, NativeThreadPoolIdleTime, 10000, EXPERIMENTAL,         \
+          "Time (in ms) a native thread stays parked for reuse before " \
+          "it exits, see NativeThreadPoolSize")                         \
+          range(1, max_jint)                                            \
+                                                                        \
   product(bool, DumpPrivateMappingsInCore, true, DIAGNOSTIC,            \
           "If true, sets bit 2 of /proc/PID/coredump_filter, thus "     \
           "resulting in file-backed private mappings of the process to "\
@@ -82,7 +107,11 @@
           "Use CPU_ALLOC code path in os::active_processor_count ")     \
                                                                         \
   product(bool, DumpPerfMapAtExit, false, DIAGNOSTIC,                   \
-          "Write map file for Linux perf tool at exit")
+          "Write map file for Linux perf tool at exit")                 \
+                                                                        \
+  product(bool, UpdatePerfMap, false, DIAGNOSTIC,                       \
+          "Append each code blob to the map file for Linux perf tool"   \
+          " when it is created")
 
 // end of RUNTIME_OS_FLAGS
 
@@ -25,8 +25,11 @@
 #include <string.h>
 #include <math.h>
 #include <errno.h>
+#include <sys/inotify.h>
+#include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
+#include "runtime/task.hpp"
 #include "logging/log.hpp"
 #include "osContainer_linux.hpp"
 #include "cgroupSubsystem_linux.hpp"
@@ -70,6 +73,91 @@ void OSContainer::init() {
 
 }
 
+static const int max_limit_change_callbacks = 8;
+static OSContainer::LimitChangeCallback _limit_change_callbacks[max_limit_change_callbacks];
+static volatile int _limit_change_callback_count = 0;
+
+bool OSContainer::add_limit_change_callback(LimitChangeCallback callback) {
+  int index = Atomic::fetch_and_add(&_limit_change_callback_count, 1);
+  if (index >= max_limit_change_callbacks) {
+    Atomic::dec(&_limit_change_callback_count);
+    return false;
+  }
+  Atomic::release_store(&_limit_change_callbacks[index], callback);
+  return true;
+}
+
+// Drains the inotify events for the watched limit files, and only
+// re-reads the limits if there were any. Between changes, the cached
+// limits are used without any file access.
+class ContainerLimitWatcherTask : public PeriodicTask {
+ private:
+  int _fd;
+  jlong _memory_limit;
+  int _active_processor_count;
+
+ public:
+  ContainerLimitWatcherTask(int fd) : PeriodicTask(OSCONTAINER_WATCH_INTERVAL), _fd(fd) {
+    cgroup_subsystem->refresh_limits(&_memory_limit, &_active_processor_count);
+  }
+
+  virtual void task() {
+    char buf[sizeof(struct inotify_event) + NAME_MAX + 1]
+      __attribute__ ((aligned(__alignof__(struct inotify_event))));
+    bool changed = false;
+    while (::read(_fd, buf, sizeof(buf)) > 0) {
+      changed = true;
+    }
+    if (!changed) {
+      return;
+    }
+
+    jlong memory_limit;
+    int active_processor_count;
+    cgroup_subsystem->refresh_limits(&memory_limit, &active_processor_count);
+    if (memory_limit == _memory_limit && active_processor_count == _active_processor_count) {
+      return;
+    }
+    log_info(os, container)("Container limits changed: memory limit " JLONG_FORMAT " -> " JLONG_FORMAT
+                            ", active processor count %d -> %d", _memory_limit, memory_limit,
+                            _active_processor_count, active_processor_count);
+    _memory_limit = memory_limit;
+    _active_processor_count = active_processor_count;
+
+    int count = MIN2(Atomic::load(&_limit_change_callback_count), max_limit_change_callbacks);
+    for (int i = 0; i < count; i++) {
+      OSContainer::LimitChangeCallback callback = Atomic::load_acquire(&_limit_change_callbacks[i]);
+      if (callback != NULL) {
+        callback(memory_limit, active_processor_count);
+      }
+    }
+  }
+};
+
+/* start_limit_watcher
+ *
+ * Start watching the memory and CPU limit files if requested, after
+ * which memory_limit_in_bytes() and active_processor_count() are
+ * answered from the cache until the files change.
+ */
+void OSContainer::start_limit_watcher() {
+  if (!UseContainerLimitWatcher || !is_containerized()) {
+    return;
+  }
+  int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd < 0) {
+    log_info(os, container)("Container limit watcher not started: %s", os::strerror(errno));
+    return;
+  }
+  if (!cgroup_subsystem->watch_limit_files(fd)) {
+    log_info(os, container)("Container limit watcher not started: limit files cannot be watched");
+    ::close(fd);
+    return;
+  }
+  (new ContainerLimitWatcherTask(fd))->enroll();
+  log_debug(os, container)("Container limit watcher started");
+}
+
 const char * OSContainer::container_type() {
   assert(cgroup_subsystem != NULL, "cgroup subsystem not available");
   return cgroup_subsystem->container_type();
@@ -34,6 +34,10 @@
 // 20ms timeout between re-reads of memory limit and _active_processor_count.
 #define OSCONTAINER_CACHE_TIMEOUT (NANOSECS_PER_SEC/50)
 
+// 100ms interval between checks for changes of the watched limit files,
+// see UseContainerLimitWatcher.
+#define OSCONTAINER_WATCH_INTERVAL 100
+
 class OSContainer: AllStatic {
 
  private:
@@ -46,6 +50,12 @@ class OSContainer: AllStatic {
   static inline bool is_containerized();
   static const char * container_type();
 
+  // Called on the WatcherThread with the new limits after a change of the
+  // watched limit files, see UseContainerLimitWatcher.
+  typedef void (*LimitChangeCallback)(jlong memory_limit, int active_processor_count);
+  static bool add_limit_change_callback(LimitChangeCallback callback);
+  static void start_limit_watcher();
+
   static jlong memory_limit_in_bytes();
   static jlong memory_and_swap_limit_in_bytes();
   static jlong memory_soft_limit_in_bytes();
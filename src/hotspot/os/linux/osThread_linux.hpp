@@ -45,8 +45,15 @@
 
   sigset_t _caller_sigmask; // Caller's signal mask
 
+  // The stack size under which the pthread can be reused for another
+  // thread after this one has terminated, or 0. See NativeThreadPoolSize.
+  size_t _pool_stack_size;
+
  public:
 
+  size_t pool_stack_size() const            { return _pool_stack_size; }
+  void set_pool_stack_size(size_t size)     { _pool_stack_size = size; }
+
   // Methods to save/restore caller's signal mask
   sigset_t  caller_sigmask() const       { return _caller_sigmask; }
   void    set_caller_sigmask(sigset_t sigmask)  { _caller_sigmask = sigmask; }
@@ -74,6 +74,9 @@
 #include "utilities/macros.hpp"
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/vmError.hpp"
+#if defined(AMD64) && !defined(ZERO)
+#include OS_CPU_HEADER_INLINE(os)
+#endif
 
 // put OS-includes here
 # include <sys/types.h>
@@ -657,8 +660,103 @@ bool os::Linux::manually_expand_stack(JavaThread * t, address addr) {
 //////////////////////////////////////////////////////////////////////////////
 // create new thread
 
-// Thread start routine for all newly created threads
-static void *thread_native_entry(Thread *thread) {
+// Pool of the native threads of terminated Java threads, see
+// NativeThreadPoolSize. Instead of exiting, such a native thread parks
+// in thread_native_entry() until os::create_thread() hands it a new
+// thread with the same stack size, or until NativeThreadPoolIdleTime
+// has passed. This saves the pthread_create() and the set up of the
+// stack and the thread-local storage by glibc.
+class NativeThreadPool : AllStatic {
+  // An entry lives on the stack of its parked native thread.
+  struct Entry {
+    pthread_t _tid;
+    size_t _stack_size;
+    Thread* _thread;   // handed over by take()
+    Entry* _next;
+  };
+
+  static os::PlatformMonitor* _lock;
+  static Entry* _idle;
+  static uint _idle_count;
+
+ public:
+  static void initialize() {
+    _lock = new os::PlatformMonitor();
+  }
+
+  static bool is_enabled() {
+    return _lock != NULL;
+  }
+
+  // Hands thread over to a parked native thread with the given stack size.
+  static bool take(Thread* thread, size_t stack_size, pthread_t* tid);
+
+  // Parks the current native thread. Returns the thread to run next, or
+  // NULL if the native thread should exit.
+  static Thread* park(size_t stack_size);
+};
+
+os::PlatformMonitor* NativeThreadPool::_lock = NULL;
+NativeThreadPool::Entry* NativeThreadPool::_idle = NULL;
+uint NativeThreadPool::_idle_count = 0;
+
+bool NativeThreadPool::take(Thread* thread, size_t stack_size, pthread_t* tid) {
+  assert(is_enabled(), "must be");
+  _lock->lock();
+  for (Entry** p = &_idle; *p != NULL; p = &(*p)->_next) {
+    Entry* e = *p;
+    if (e->_stack_size == stack_size) {
+      *p = e->_next;
+      _idle_count--;
+      e->_thread = thread;
+      *tid = e->_tid;
+      _lock->notify_all();
+      _lock->unlock();
+      return true;
+    }
+  }
+  _lock->unlock();
+  return false;
+}
+
+Thread* NativeThreadPool::park(size_t stack_size) {
+  Entry e;
+  e._tid = pthread_self();
+  e._stack_size = stack_size;
+  e._thread = NULL;
+
+  _lock->lock();
+  if (_idle_count >= NativeThreadPoolSize) {
+    _lock->unlock();
+    return NULL;
+  }
+  e._next = _idle;
+  _idle = &e;
+  _idle_count++;
+
+  os::set_native_thread_name("Pooled Thread");
+  const jlong deadline = os::javaTimeNanos() + (jlong)NativeThreadPoolIdleTime * NANOSECS_PER_MILLISEC;
+  while (e._thread == NULL) {
+    jlong remaining = (deadline - os::javaTimeNanos()) / NANOSECS_PER_MILLISEC;
+    if (remaining <= 0) {
+      // Timed out, so unlink the entry, which has not been taken.
+      for (Entry** p = &_idle; ; p = &(*p)->_next) {
+        if (*p == &e) {
+          *p = e._next;
+          break;
+        }
+      }
+      _idle_count--;
+      break;
+    }
+    _lock->wait(remaining);
+  }
+  Thread* thread = e._thread;
+  _lock->unlock();
+  return thread;
+}
+
+static void thread_native_run(Thread *thread) {
 
   thread->record_stack_base_and_size();
 
@@ -725,7 +823,15 @@ static void *thread_native_entry(Thread *thread) {
 
   log_info(os, thread)("Thread finished (tid: " UINTX_FORMAT ", pthread id: " UINTX_FORMAT ").",
     os::current_thread_id(), (uintx) pthread_self());
+}
 
+// Thread start routine for all newly created threads
+static void *thread_native_entry(Thread *thread) {
+  const size_t pool_stack_size = thread->osthread()->pool_stack_size();
+  while (thread != NULL) {
+    thread_native_run(thread);
+    thread = (pool_stack_size != 0) ? NativeThreadPool::park(pool_stack_size) : NULL;
+  }
   return 0;
 }
 
@@ -862,14 +968,26 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
 
   ThreadState state;
 
+  if (NativeThreadPool::is_enabled() && thr_type == java_thread) {
+    osthread->set_pool_stack_size(stack_size);
+  }
+
   {
     pthread_t tid;
-    int ret = pthread_create(&tid, &attr, (void* (*)(void*)) thread_native_entry, thread);
+    int ret;
+    const bool reused = osthread->pool_stack_size() != 0 &&
+                        NativeThreadPool::take(thread, stack_size, &tid);
+    if (reused) {
+      ret = 0;
+    } else {
+      ret = pthread_create(&tid, &attr, (void* (*)(void*)) thread_native_entry, thread);
+    }
 
     char buf[64];
     if (ret == 0) {
-      log_info(os, thread)("Thread started (pthread id: " UINTX_FORMAT ", attributes: %s). ",
-        (uintx) tid, os::Posix::describe_pthread_attr(buf, sizeof(buf), &attr));
+      log_info(os, thread)("Thread started (pthread id: " UINTX_FORMAT ", attributes: %s%s). ",
+        (uintx) tid, os::Posix::describe_pthread_attr(buf, sizeof(buf), &attr),
+        reused ? ", reused" : "");
     } else {
       log_warning(os, thread)("Failed to start thread - pthread_create failed (%s) for attributes: %s.",
         os::errno_name(ret), os::Posix::describe_pthread_attr(buf, sizeof(buf), &attr));
@@ -1327,6 +1445,127 @@ void os::Linux::fast_thread_clock_init() {
   }
 }
 
+#if defined(AMD64) && !defined(ZERO)
+
+static volatile bool tsc_java_nanos_enabled = false;
+static jlong tsc_base_counter = 0;
+static jlong tsc_base_nanos = 0;
+static double tsc_nanos_per_tick = 0.0;
+
+static jlong monotonic_nanos() {
+  struct timespec tp;
+  int status = clock_gettime(CLOCK_MONOTONIC, &tp);
+  assert(status == 0, "clock_gettime error: %s", os::strerror(errno));
+  return jlong(tp.tv_sec) * NANOSECS_PER_SEC + jlong(tp.tv_nsec);
+}
+
+// Read the TSC between two reads of CLOCK_MONOTONIC, and keep the
+// tightest of a few attempts.
+static void sample_tsc(jlong* counter, jlong* nanos) {
+  jlong best = max_jlong;
+  for (int i = 0; i < 5; i++) {
+    jlong before = monotonic_nanos();
+    jlong tsc = os::rdtsc();
+    jlong after = monotonic_nanos();
+    if (after - before < best) {
+      best = after - before;
+      *counter = tsc;
+      *nanos = before + (after - before) / 2;
+    }
+  }
+}
+
+// Returns true if the first line starting with prefix in the given file
+// contains word.
+static bool file_line_has_word(const char* path, const char* prefix, const char* word) {
+  FILE* fp = fopen(path, "r");
+  if (fp == NULL) {
+    return false;
+  }
+  bool result = false;
+  char line[4096];
+  size_t len = strlen(word);
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    if (strncmp(line, prefix, strlen(prefix)) != 0) {
+      continue;
+    }
+    for (char* p = strstr(line, word); p != NULL; p = strstr(p + 1, word)) {
+      if ((p == line || isspace(p[-1]) || p[-1] == ':') &&
+          (p[len] == '\0' || isspace(p[len]))) {
+        result = true;
+        break;
+      }
+    }
+    break;
+  }
+  fclose(fp);
+  return result;
+}
+
+void os::Linux::tsc_java_nanos_init() {
+  if (!UseTSCForJavaTimeNanos) {
+    return;
+  }
+  // The TSC must tick at a constant rate, also in deep C-states, and the
+  // kernel must not have found it unsynchronized or unstable. The kernel
+  // drops the TSC from its clock sources when its watchdog finds it
+  // unreliable.
+  if (!file_line_has_word("/proc/cpuinfo", "flags", "constant_tsc") ||
+      !file_line_has_word("/proc/cpuinfo", "flags", "nonstop_tsc") ||
+      !file_line_has_word("/sys/devices/system/clocksource/clocksource0/available_clocksource", "", "tsc")) {
+    log_info(os)("UseTSCForJavaTimeNanos disabled, the TSC is not a reliable clock source");
+    FLAG_SET_DEFAULT(UseTSCForJavaTimeNanos, false);
+    return;
+  }
+
+  jlong counter0, nanos0, counter1, nanos1;
+  sample_tsc(&counter0, &nanos0);
+  os::naked_short_sleep(10);
+  sample_tsc(&counter1, &nanos1);
+  if (counter1 <= counter0 || nanos1 <= nanos0) {
+    log_info(os)("UseTSCForJavaTimeNanos disabled, the TSC calibration failed");
+    FLAG_SET_DEFAULT(UseTSCForJavaTimeNanos, false);
+    return;
+  }
+
+  // Continue from CLOCK_MONOTONIC at the end of the calibration, so that
+  // values returned before and after the switch stay ordered.
+  tsc_nanos_per_tick = (double)(nanos1 - nanos0) / (double)(counter1 - counter0);
+  sample_tsc(&tsc_base_counter, &tsc_base_nanos);
+  Atomic::release_store(&tsc_java_nanos_enabled, true);
+
+  log_info(os)("Using the TSC for javaTimeNanos, %.6f ns per tick", tsc_nanos_per_tick);
+}
+
+bool os::Linux::use_tsc_java_nanos() {
+  return tsc_java_nanos_enabled;
+}
+
+jlong os::Linux::tsc_java_nanos() {
+  jlong ticks = os::rdtsc() - tsc_base_counter;
+  return tsc_base_nanos + (jlong)((double)ticks * tsc_nanos_per_tick);
+}
+
+#else
+
+void os::Linux::tsc_java_nanos_init() {
+  if (UseTSCForJavaTimeNanos) {
+    log_info(os)("UseTSCForJavaTimeNanos is not supported on this platform");
+    FLAG_SET_DEFAULT(UseTSCForJavaTimeNanos, false);
+  }
+}
+
+bool os::Linux::use_tsc_java_nanos() {
+  return false;
+}
+
+jlong os::Linux::tsc_java_nanos() {
+  ShouldNotReachHere();
+  return 0;
+}
+
+#endif // AMD64 && !ZERO
+
 // Return the real, user, and system times in seconds from an
 // arbitrary fixed point in the past.
 bool os::getTimesSecs(double* process_real_time,
@@ -2765,11 +3004,55 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   #define MADV_HUGEPAGE 14
 #endif
 
+// Define MADV_POPULATE_WRITE and MADV_COLLAPSE here so we can build
+// HotSpot on systems that predate Linux 5.14 and 6.1 respectively.
+#ifndef MADV_POPULATE_WRITE
+  #define MADV_POPULATE_WRITE 23
+#endif
+#ifndef MADV_COLLAPSE
+  #define MADV_COLLAPSE 25
+#endif
+
+static volatile bool populate_transparent_huge_pages_supported = true;
+
+// Back the whole large pages in the range with transparent huge pages now,
+// instead of leaving them to the page faults and khugepaged. The range must
+// have been madvised with MADV_HUGEPAGE, so populating it allocates huge
+// pages where the kernel has them available, and MADV_COLLAPSE collapses
+// whatever was still backed by small pages.
+void os::Linux::populate_transparent_huge_pages(char* addr, size_t size) {
+  if (!populate_transparent_huge_pages_supported) {
+    return;
+  }
+  char* start = align_up(addr, os::large_page_size());
+  char* end = align_down(addr + size, os::large_page_size());
+  if (start >= end) {
+    return;
+  }
+  if (::madvise(start, end - start, MADV_POPULATE_WRITE) != 0) {
+    if (errno == EINVAL) {
+      log_info(pagesize)("MADV_POPULATE_WRITE not supported, not populating transparent huge pages");
+      populate_transparent_huge_pages_supported = false;
+    }
+    return;
+  }
+  if (::madvise(start, end - start, MADV_COLLAPSE) != 0) {
+    // Best effort: EINVAL on kernels without MADV_COLLAPSE, or EAGAIN
+    // and ENOMEM if no huge pages could be allocated.
+    log_debug(pagesize)("Range [" PTR_FORMAT ", " PTR_FORMAT ") not collapsed into transparent huge pages: %s",
+                        p2i(start), p2i(end), os::strerror(errno));
+  }
+}
+
 int os::Linux::commit_memory_impl(char* addr, size_t size,
                                   size_t alignment_hint, bool exec) {
   int err = os::Linux::commit_memory_impl(addr, size, exec);
   if (err == 0) {
     realign_memory(addr, size, alignment_hint);
+    if (UseTransparentHugePages && PopulateTransparentHugePages &&
+        alignment_hint > (size_t)vm_page_size()) {
+      populate_transparent_huge_pages(addr, size);
+    }
   }
   return err;
 }
@@ -4507,6 +4790,8 @@ jint os::init_2(void) {
 
   Linux::fast_thread_clock_init();
 
+  Linux::tsc_java_nanos_init();
+
   if (PosixSignals::init() == JNI_ERR) {
     return JNI_ERR;
   }
@@ -4520,6 +4805,10 @@ jint os::init_2(void) {
     return JNI_ERR;
   }
 
+  if (NativeThreadPoolSize > 0) {
+    NativeThreadPool::initialize();
+  }
+
 #if defined(IA32) && !defined(ZERO)
   // Need to ensure we've determined the process's initial stack to
   // perform the workaround
@@ -66,6 +66,7 @@ class Linux {
   static void initialize_system_info();
 
   static int commit_memory_impl(char* addr, size_t bytes, bool exec);
+  static void populate_transparent_huge_pages(char* addr, size_t bytes);
   static int commit_memory_impl(char* addr, size_t bytes,
                                 size_t alignment_hint, bool exec);
 
@@ -170,6 +171,11 @@ class Linux {
 
   static jlong fast_thread_cpu_time(clockid_t clockid);
 
+  // javaTimeNanos() based on the TSC, see UseTSCForJavaTimeNanos
+  static void tsc_java_nanos_init();
+  static bool use_tsc_java_nanos();
+  static jlong tsc_java_nanos();
+
   // Determine if the vmid is the parent pid for a child in a PID namespace.
   // Return the namespace pid if so, otherwise -1.
   static int get_namespace_pid(int vmid);
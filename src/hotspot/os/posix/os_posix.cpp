@@ -1407,6 +1407,11 @@ void os::javaTimeSystemUTC(jlong &seconds, jlong &nanos) {
 #if !defined(__APPLE__) && !defined(AIX)
 
 jlong os::javaTimeNanos() {
+#ifdef LINUX
+  if (os::Linux::use_tsc_java_nanos()) {
+    return os::Linux::tsc_java_nanos();
+  }
+#endif
   struct timespec tp;
   int status = clock_gettime(CLOCK_MONOTONIC, &tp);
   assert(status == 0, "clock_gettime error: %s", os::strerror(errno));
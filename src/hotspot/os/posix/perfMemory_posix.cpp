@@ -1224,6 +1224,19 @@ void PerfMemory::create_memory_region(size_t size) {
     // do not share the memory for the performance data.
     _start = create_standard_memory(size);
   }
+  else if (PerfDataCopyToSharedMem) {
+    // keep the counters in standard memory, so that updates to them never
+    // wait for the kernel to write back the pages of the shared file. The
+    // StatSampler copies them to the shared file periodically.
+    _shared_copy = create_shared_memory(size);
+    if (_shared_copy == NULL) {
+      if (PrintMiscellaneous && Verbose) {
+        warning("Reverting to non-shared PerfMemory region.\n");
+      }
+      PerfDisableSharedMem = true;
+    }
+    _start = create_standard_memory(size);
+  }
   else {
     _start = create_shared_memory(size);
     if (_start == NULL) {
@@ -1264,6 +1277,11 @@ void PerfMemory::delete_memory_region() {
   if (PerfDisableSharedMem) {
     delete_standard_memory(start(), capacity());
   }
+  else if (_shared_copy != NULL) {
+    copy_to_shared();
+    delete_standard_memory(start(), capacity());
+    delete_shared_memory(_shared_copy, capacity());
+  }
   else {
     delete_shared_memory(start(), capacity());
   }
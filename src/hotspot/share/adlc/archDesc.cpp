@@ -167,6 +167,7 @@ ArchDesc::ArchDesc()
       _disable_warnings  = 0;
       _dfa_debug         = 0;
       _dfa_small         = 0;
+      _dfa_compact_chains = 0;
       _adl_debug         = 0;
       _adlocation_debug  = 0;
       _internalOpCounter = 0;
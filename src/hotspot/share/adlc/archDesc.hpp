@@ -135,6 +135,10 @@ private:
   void expand_opclass(FILE *fp, const char *indent, const Expr *cost,
                       const char *result_type, ProductionState &status);
   Expr *calc_cost(FILE *fp, const char *spaces, MatchList &mList, ProductionState &status);
+  bool has_chain_closure(const char *operand);
+  void gen_chain_closure(FILE *fp, const char *indent, const char *root, const char *operand,
+                         const Expr *icost, const char *irule, Dict &operands_chained_from);
+  void gen_chain_closures(FILE *fp);
   void prune_matchlist(Dict &minimize, MatchList &mlist);
 
   // Helper function that outputs code to generate an instruction in MachNodeGenerator
@@ -151,6 +155,7 @@ public:
   int   _disable_warnings;              // Do not output warning messages
   int   _dfa_debug;                     // Debug Flag for generated DFA
   int   _dfa_small;                     // Debug Flag for generated DFA
+  int   _dfa_compact_chains;            // Generate chain rules once per operand
   int   _adl_debug;                     // Debug Flag for ADLC
   int   _adlocation_debug;              // Debug Flag to use ad file locations
   bool  _cisc_spill_debug;              // Debug Flag to see cisc-spill-instructions
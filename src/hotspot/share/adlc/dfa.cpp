@@ -272,7 +272,10 @@ void ArchDesc::gen_match(FILE *fp, MatchList &mList, ProductionState &status, Di
 
   // If this rule produces an operand which has associated chain rules,
   // update the operands with the chain rule + this rule cost & this rule.
-  chain_rule(fp, spaces6, mList._resultStr, cost, rule, operands_chained_from, status);
+  // With compact chains they are applied once, at the end of the state body.
+  if (!_dfa_compact_chains || !has_chain_closure(mList._resultStr)) {
+    chain_rule(fp, spaces6, mList._resultStr, cost, rule, operands_chained_from, status);
+  }
 
   // Close the child-and-predicate-test braces
   fprintf(fp, "    }\n");
@@ -347,6 +350,108 @@ void ArchDesc::chain_rule(FILE *fp, const char *indent, const char *operand,
   }
 }
 
+//---------------------------chain_closure_production--------------------------
+// Production in an out-of-line chain closure.  The closure is shared by all
+// matches producing its operand, so nothing is known about the state vector
+// and the validity and cost of the result are always checked.
+static void chain_closure_production(FILE *fp, const char *indent, const char *result,
+                                     const Expr *cost, const char *rule_expr) {
+  const char *arrayIdx = ArchDesc::getMachOperEnum(result);
+  fprintf(fp, "%sif (STATE__NOT_YET_VALID(%s) || _cost[%s] > %s) {\n", indent, arrayIdx, arrayIdx, cost->as_string());
+  fprintf(fp, "%s  DFA_PRODUCTION(%s, %s, %s)\n", indent, arrayIdx, rule_expr, cost->as_string());
+  fprintf(fp, "%s}\n", indent);
+  delete[] arrayIdx;
+}
+
+//---------------------------has_chain_closure---------------------------------
+// Chains from ideal operands stay inline; only user defined operands get a
+// State::_chain_XXX routine.
+bool ArchDesc::has_chain_closure(const char *operand) {
+  const Form *form = _globalNames[operand];
+  OperandForm *op = form ? form->is_operand() : NULL;
+  return op != NULL && !op->ideal_only() && _chainRules[operand] != NULL;
+}
+
+//---------------------------gen_chain_closure---------------------------------
+// Out-of-line equivalent of chain_rule() for the chains starting at 'root'.
+// A NULL 'irule' stands for the rule that produced 'root', read back from the
+// state vector.  As in chain_rule(), operand chains reduce through that rule
+// unless 'root' was produced by its own operand rule.
+void ArchDesc::gen_chain_closure(FILE *fp, const char *indent, const char *root, const char *operand,
+                                 const Expr *icost, const char *irule, Dict &operands_chained_from) {
+  // Check if we have already generated chains from this starting point
+  if (operands_chained_from[operand] != NULL) {
+    return;
+  }
+  operands_chained_from.Insert(operand, operand);
+
+  ChainList *lst = (ChainList *)_chainRules[operand];
+  if (lst == NULL) {
+    return;
+  }
+  char rule_expr[256];
+  const char *result, *cost, *rule;
+  for (lst->reset(); (lst->iter(result, cost, rule)) == true; ) {
+    // Do not generate operands that are already available
+    if (operands_chained_from[result] != NULL) {
+      continue;
+    }
+    Expr *total_cost = icost->clone();  // icost + cost
+    total_cost->add(cost, *this);
+
+    Form *form = (Form *)_globalNames[rule];
+    if (!form->is_instruction()) {
+      if (irule != NULL) {
+        snprintf(rule_expr, sizeof(rule_expr), "%s_rule", irule);
+      } else {
+        const char *root_enum = ArchDesc::getMachOperEnum(root);
+        snprintf(rule_expr, sizeof(rule_expr), "(rule(%s) == %s_rule ? %s_rule : rule(%s))",
+                 root_enum, root, rule, root_enum);
+        delete[] root_enum;
+      }
+      chain_closure_production(fp, indent, result, total_cost, rule_expr);
+      gen_chain_closure(fp, indent, root, result, total_cost, irule, operands_chained_from);
+    } else {
+      snprintf(rule_expr, sizeof(rule_expr), "%s_rule", rule);
+      chain_closure_production(fp, indent, result, total_cost, rule_expr);
+      gen_chain_closure(fp, indent, root, result, total_cost, rule, operands_chained_from);
+    }
+
+    // If this is a member of an operand class, update class cost & rule
+    const Form *result_form = _globalNames[result];
+    OperandForm *op = result_form ? result_form->is_operand() : NULL;
+    if (op && op->_classes.count() > 0) {
+      snprintf(rule_expr, sizeof(rule_expr), "%s_rule", result);
+      op->_classes.reset();
+      const char *oclass;
+      while ((oclass = op->_classes.iter()) != NULL) {
+        chain_closure_production(fp, indent, oclass, total_cost, rule_expr);
+      }
+    }
+  }
+}
+
+//---------------------------gen_chain_closures--------------------------------
+// With compact chains each operand's chain rules are generated once, as a
+// State::_chain_XXX(c) routine applied to the best cost 'c' of operand XXX,
+// instead of being expanded after every match producing XXX.  When costs tie,
+// the rule picked may differ from the inline expansion; both are valid.
+void ArchDesc::gen_chain_closures(FILE *fp) {
+  for (DictI i(&_chainRules); i.test(); ++i) {
+    const char *operand = (const char *)i._key;
+    if (!has_chain_closure(operand)) continue;
+    const char *operand_enum = ArchDesc::getMachOperEnum(operand);
+    fprintf(fp, "void  State::_chain_%s(unsigned int c) {\n", operand_enum);
+    Dict operands_chained_from(cmpstr, hashstr, Form::arena);
+    Expr *cost = new Expr("0");
+    cost->set_external_name("c");
+    gen_chain_closure(fp, "  ", operand, operand, cost, NULL, operands_chained_from);
+    fprintf(fp, "}\n");
+    delete[] operand_enum;
+  }
+  fprintf(fp, "\n");
+}
+
 //---------------------------prune_matchlist-----------------------------------
 // Check for duplicate entries in a matchlist, and prune out the higher cost
 // entry.
@@ -405,6 +510,9 @@ void ArchDesc::buildDFA(FILE* fp) {
 );
   fprintf(fp, "\n");
   fprintf(fp, "\n");
+  if (_dfa_compact_chains) {
+    gen_chain_closures(fp);
+  }
   if (_dfa_small) {
     // Now build the individual routines just like the switch entries in large version
     // Iterate over the table of MatchLists, start at first valid opcode of 1
@@ -607,6 +715,20 @@ void ArchDesc::gen_dfa_state_body(FILE* fp, Dict &minimize, ProductionState &sta
   const Expr *zeroCost = new Expr("0");
   chain_rule(fp, "   ", (char *)NodeClassNames[i], zeroCost, "Invalid",
              operands_chained_from, status);
+
+  if (_dfa_compact_chains) {
+    // Apply the chain rules of each operand produced above to its best cost
+    operands_chained_from.Clear();
+    for (mList = _mlistab[i]; mList != NULL; mList = mList->get_next()) {
+      const char *result = mList->_resultStr;
+      if (!has_chain_closure(result) || operands_chained_from[result] != NULL) continue;
+      operands_chained_from.Insert(result, result);
+      const char *result_enum = ArchDesc::getMachOperEnum(result);
+      fprintf(fp, "    if (!STATE__NOT_YET_VALID(%s)) _chain_%s(_cost[%s]);\n",
+              result_enum, result_enum, result_enum);
+      delete[] result_enum;
+    }
+  }
 }
 
 
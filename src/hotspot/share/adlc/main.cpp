@@ -83,6 +83,9 @@ int main(int argc, char *argv[])
         case 'T':               // Option to make DFA as many subroutine calls.
           AD._dfa_small += 1;   // Set Mode Flag
           break;
+        case 'C':               // Option to share chain rule closures in the DFA.
+          AD._dfa_compact_chains += 1; // Set Mode Flag
+          break;
         case 'c': {             // Set C++ Output file name
           AD._CPP_file._name = s;
           const char *base = strip_ext(strdup(s));
@@ -345,12 +348,13 @@ int main(int argc, char *argv[])
 static void usage(ArchDesc& AD)
 {
   printf("Architecture Description Language Compiler\n\n");
-  printf("Usage: adlc [-doqwTs] [-#]* [-D<FLAG>[=<DEF>]] [-U<FLAG>] [-c<CPP_FILE_NAME>] [-h<HPP_FILE_NAME>] [-a<DFA_FILE_NAME>] [-v<GLOBALS_FILE_NAME>] <ADL_FILE_NAME>\n");
+  printf("Usage: adlc [-doqwTCs] [-#]* [-D<FLAG>[=<DEF>]] [-U<FLAG>] [-c<CPP_FILE_NAME>] [-h<HPP_FILE_NAME>] [-a<DFA_FILE_NAME>] [-v<GLOBALS_FILE_NAME>] <ADL_FILE_NAME>\n");
   printf(" d  produce DFA debugging info\n");
   printf(" o  no output produced, syntax and semantic checking only\n");
   printf(" q  quiet mode, supresses all non-essential messages\n");
   printf(" w  suppress warning messages\n");
   printf(" T  make DFA as many subroutine calls\n");
+  printf(" C  make DFA chain rules one subroutine per operand\n");
   printf(" s  output which instructions are cisc-spillable\n");
   printf(" D  define preprocessor symbol\n");
   printf(" U  undefine preprocessor symbol\n");
@@ -2072,6 +2072,15 @@ void ArchDesc::defineStateClass(FILE *fp) {
       fprintf(fp, "  void  _sub_Op_%s(const Node *n);\n", NodeClassNames[i]);
     }
   }
+  if (_dfa_compact_chains) {
+    for (DictI i(&_chainRules); i.test(); ++i) {
+      const char *operand = (const char *)i._key;
+      if (!has_chain_closure(operand)) continue;
+      const char *operand_enum = ArchDesc::getMachOperEnum(operand);
+      fprintf(fp, "  void  _chain_%s(unsigned int c);\n", operand_enum);
+      delete[] operand_enum;
+    }
+  }
   fprintf(fp,"};\n");
   fprintf(fp,"\n");
   fprintf(fp,"\n");
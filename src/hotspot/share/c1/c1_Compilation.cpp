@@ -159,6 +159,13 @@ void Compilation::build_hir() {
     return;
   }
 
+  // The global optimizations below scale with the number of blocks times
+  // the number of values. Skip them for huge methods.
+  _is_huge_method = C1HugeMethodBlockLimit > 0 && number_of_blocks() > C1HugeMethodBlockLimit;
+  if (_is_huge_method && log != NULL) {
+    log->elem("c1_huge_method blocks='%d'", number_of_blocks());
+  }
+
 #ifndef PRODUCT
   if (PrintCFGToFile) {
     CFGPrinter::print_cfg(_hir, "After Generation of HIR", true, false);
@@ -195,7 +202,7 @@ void Compilation::build_hir() {
   // the control flow must not be changed from here on
   _hir->compute_code();
 
-  if (UseGlobalValueNumbering) {
+  if (UseGlobalValueNumbering && !is_huge_method()) {
     // No resource mark here! LoopInvariantCodeMotion can allocate ValueStack objects.
     PhaseTraceTime timeit(_t_gvn);
     int instructions = Instruction::number_of_instructions();
@@ -212,7 +219,7 @@ void Compilation::build_hir() {
   }
 #endif
 
-  if (RangeCheckElimination) {
+  if (RangeCheckElimination && !is_huge_method()) {
     if (_hir->osr_entry() == NULL) {
       PhaseTraceTime timeit(_t_rangeCheckElimination);
       RangeCheckElimination::eliminate(_hir);
@@ -225,7 +232,7 @@ void Compilation::build_hir() {
   }
 #endif
 
-  if (UseC1Optimizations) {
+  if (UseC1Optimizations && !is_huge_method()) {
     // loop invariant code motion reorders instructions and range
     // check elimination adds new instructions so do null check
     // elimination after.
@@ -553,6 +560,7 @@ Compilation::Compilation(AbstractCompiler* compiler, ciEnv* env, ciMethod* metho
 , _frame_map(NULL)
 , _masm(NULL)
 , _has_exception_handlers(false)
+, _is_huge_method(false)
 , _has_fpu_code(true)   // pessimistic assumption
 , _has_unsafe_access(false)
 , _would_profile(false)
@@ -77,6 +77,7 @@ class Compilation: public StackObj {
   FrameMap*          _frame_map;
   C1_MacroAssembler* _masm;
   bool               _has_exception_handlers;
+  bool               _is_huge_method;
   bool               _has_fpu_code;
   bool               _has_unsafe_access;
   bool               _would_profile;
@@ -135,6 +136,8 @@ class Compilation: public StackObj {
   CompileLog* log() const                        { return _log; }
   AbstractCompiler* compiler() const             { return _compiler; }
   bool has_exception_handlers() const            { return _has_exception_handlers; }
+  // Compile in fast mode, see C1HugeMethodBlockLimit
+  bool is_huge_method() const                    { return _is_huge_method; }
   bool has_fpu_code() const                      { return _has_fpu_code; }
   bool has_unsafe_access() const                 { return _has_unsafe_access; }
   int max_vector_size() const                    { return 0; }
@@ -920,7 +920,33 @@ LIR_Opr LIRGenerator::force_to_spill(LIR_Opr value, BasicType t) {
   return tmp;
 }
 
-void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
+// With Tier3ProfileSampleFreqLog > 0, a thread local pseudo random
+// number decides whether a profile counter is updated. Counters that
+// are updated are incremented by 2^Tier3ProfileSampleFreqLog so
+// profile values keep their scale. Returns the label to branch to
+// when the update is skipped or NULL if profiles are not sampled.
+LabelObj* LIRGenerator::profile_sample_test() {
+  if (Tier3ProfileSampleFreqLog == 0) {
+    return NULL;
+  }
+  LabelObj* L_skip = new LabelObj();
+  LIR_Address* seed_addr = new LIR_Address(getThreadPointer(), in_bytes(JavaThread::profile_sample_seed_offset()), T_INT);
+  LIR_Opr seed = new_register(T_INT);
+  LIR_Opr multiplier = new_register(T_INT);
+  __ move(seed_addr, seed);
+  __ move(LIR_OprFact::intConst(1664525), multiplier);
+  __ mul(seed, multiplier, seed);
+  __ add(seed, LIR_OprFact::intConst(1013904223), seed);
+  __ move(seed, seed_addr);
+  // Use the high bits which are the most random ones
+  LIR_Opr bits = new_register(T_INT);
+  __ unsigned_shift_right(seed, BitsPerInt - (int)Tier3ProfileSampleFreqLog, bits);
+  __ cmp(lir_cond_notEqual, bits, LIR_OprFact::intConst(0));
+  __ branch(lir_cond_notEqual, L_skip->label());
+  return L_skip;
+}
+
+void LIRGenerator::profile_branch(If* if_instr, If::Condition cond, LIR_Opr left, LIR_Opr right) {
   if (if_instr->should_profile()) {
     ciMethod* method = if_instr->profiled_method();
     assert(method != NULL, "method should be set if branch is profiled");
@@ -946,14 +972,24 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
              LIR_OprFact::intptrConst(not_taken_count_offset),
              data_offset_reg, as_BasicType(if_instr->x()->type()));
 
+    // The sampling test kills the condition codes so it needs the
+    // compare inputs to set them again.
+    LabelObj* L_skip = left->is_valid() ? profile_sample_test() : NULL;
+    int step = DataLayout::counter_increment << (L_skip != NULL ? Tier3ProfileSampleFreqLog : 0);
+
     // MDO cells are intptr_t, so the data_reg width is arch-dependent.
     LIR_Opr data_reg = new_pointer_register();
     LIR_Address* data_addr = new LIR_Address(md_reg, data_offset_reg, data_reg->type());
     __ move(data_addr, data_reg);
     // Use leal instead of add to avoid destroying condition codes on x86
-    LIR_Address* fake_incr_value = new LIR_Address(data_reg, DataLayout::counter_increment, T_INT);
+    LIR_Address* fake_incr_value = new LIR_Address(data_reg, step, T_INT);
     __ leal(LIR_OprFact::address(fake_incr_value), data_reg);
     __ move(data_reg, data_addr);
+
+    if (L_skip != NULL) {
+      __ branch_destination(L_skip->label());
+      __ cmp(lir_cond(cond), left, right);
+    }
   }
 }
 
@@ -2578,11 +2614,16 @@ void LIRGenerator::do_Goto(Goto* x) {
       assert(data->is_JumpData(), "need JumpData for branches");
       offset = md->byte_offset_of_slot(data, JumpData::taken_offset());
     }
+    LabelObj* L_skip = profile_sample_test();
+    int step = DataLayout::counter_increment << (L_skip != NULL ? Tier3ProfileSampleFreqLog : 0);
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
 
     increment_counter(new LIR_Address(md_reg, offset,
-                                      NOT_LP64(T_INT) LP64_ONLY(T_LONG)), DataLayout::counter_increment);
+                                      NOT_LP64(T_INT) LP64_ONLY(T_LONG)), step);
+    if (L_skip != NULL) {
+      __ branch_destination(L_skip->label());
+    }
   }
 
   // emit phi-instruction move after safepoint since this simplifies
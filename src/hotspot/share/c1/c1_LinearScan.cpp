@@ -3128,7 +3128,9 @@ void LinearScan::do_linear_scan() {
 
   { TIME_LINEAR_SCAN(timer_optimize_lir);
 
-    EdgeMoveOptimizer::optimize(ir()->code());
+    if (!compilation()->is_huge_method()) {
+      EdgeMoveOptimizer::optimize(ir()->code());
+    }
     ControlFlowOptimizer::optimize(ir()->code());
     // check that cfg is still correct after optimizations
     ir()->verify();
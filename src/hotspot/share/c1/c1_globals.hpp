@@ -123,6 +123,13 @@
   develop(bool, PrintValueNumbering, false,                                 \
           "Print Value Numbering")                                          \
                                                                             \
+  product(intx, C1HugeMethodBlockLimit, 0, EXPERIMENTAL,                    \
+          "Number of blocks above which C1 compiles a method in a fast "    \
+          "mode that skips the optional global optimizations, so that "     \
+          "huge generated methods leave the interpreter sooner. 0 "         \
+          "disables the fast mode")                                         \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, ValueMapInitialSize, 11,                                    \
           "Initial size of a value map")                                    \
           range(1, NOT_LP64(1*K) LP64_ONLY(32*K))                           \
@@ -32,16 +32,20 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/vmClasses.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "interpreter/abstractInterpreter.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allStatic.hpp"
 #include "memory/memRegion.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "oops/oopHandle.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/thread.hpp"
@@ -110,9 +114,10 @@ class RelocateEmbeddedPointers : public BitMapClosure {
   ArchiveBuilder* _builder;
   address _dumped_obj;
   BitMap::idx_t _start_idx;
+  bool _par;
 public:
-  RelocateEmbeddedPointers(ArchiveBuilder* builder, address dumped_obj, BitMap::idx_t start_idx) :
-    _builder(builder), _dumped_obj(dumped_obj), _start_idx(start_idx) {}
+  RelocateEmbeddedPointers(ArchiveBuilder* builder, address dumped_obj, BitMap::idx_t start_idx, bool par) :
+    _builder(builder), _dumped_obj(dumped_obj), _start_idx(start_idx), _par(par) {}
 
   bool do_bit(BitMap::idx_t bit_offset) {
     uintx FLAG_MASK = 0x03; // See comments around MetaspaceClosure::FLAG_MASK
@@ -128,18 +133,23 @@ public:
     log_trace(cds)("Ref: [" PTR_FORMAT "] -> " PTR_FORMAT " => " PTR_FORMAT,
                    p2i(ptr_loc), p2i(old_p), p2i(new_p));
 
-    ArchivePtrMarker::set_and_mark_pointer(ptr_loc, (address)(new_p_and_bits));
+    if (_par) {
+      *ptr_loc = (address)new_p_and_bits;
+      ArchivePtrMarker::par_mark_pointer(ptr_loc);
+    } else {
+      ArchivePtrMarker::set_and_mark_pointer(ptr_loc, (address)(new_p_and_bits));
+    }
     return true; // keep iterating the bitmap
   }
 };
 
-void ArchiveBuilder::SourceObjList::relocate(int i, ArchiveBuilder* builder) {
+void ArchiveBuilder::SourceObjList::relocate(int i, ArchiveBuilder* builder, bool par) {
   SourceObjInfo* src_info = objs()->at(i);
   assert(src_info->should_copy(), "must be");
   BitMap::idx_t start = BitMap::idx_t(src_info->ptrmap_start()); // inclusive
   BitMap::idx_t end = BitMap::idx_t(src_info->ptrmap_end());     // exclusive
 
-  RelocateEmbeddedPointers relocator(builder, src_info->dumped_addr(), start);
+  RelocateEmbeddedPointers relocator(builder, src_info->dumped_addr(), start, par);
   _ptrmap.iterate(&relocator, start, end);
 }
 
@@ -671,6 +681,56 @@ void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* s
   }
 }
 
+// Relocates the objects of the rw list followed by the ro list in parallel.
+// Every object is only written by the worker that claimed it, and the
+// layout of the archive was fixed when the objects were copied.
+class RelocateEmbeddedPointersTask : public AbstractGangTask {
+  static const int chunk_size = 256;
+
+  ArchiveBuilder* _builder;
+  ArchiveBuilder::SourceObjList* _rw_src_objs;
+  ArchiveBuilder::SourceObjList* _ro_src_objs;
+  const int _num_rw;
+  const int _num_total;
+  volatile int _claimed;
+
+public:
+  RelocateEmbeddedPointersTask(ArchiveBuilder* builder,
+                               ArchiveBuilder::SourceObjList* rw_src_objs,
+                               ArchiveBuilder::SourceObjList* ro_src_objs) :
+    AbstractGangTask("CDS Relocate Embedded Pointers"),
+    _builder(builder),
+    _rw_src_objs(rw_src_objs),
+    _ro_src_objs(ro_src_objs),
+    _num_rw(rw_src_objs->objs()->length()),
+    _num_total(_num_rw + ro_src_objs->objs()->length()),
+    _claimed(0) {}
+
+  virtual void work(uint worker_id) {
+    while (true) {
+      int begin = Atomic::fetch_and_add(&_claimed, chunk_size);
+      if (begin >= _num_total) {
+        return;
+      }
+      int end = MIN2(begin + chunk_size, _num_total);
+      for (int i = begin; i < end; i++) {
+        if (i < _num_rw) {
+          _rw_src_objs->relocate(i, _builder, true);
+        } else {
+          _ro_src_objs->relocate(i - _num_rw, _builder, true);
+        }
+      }
+    }
+  }
+};
+
+void ArchiveBuilder::par_relocate_embedded_pointers(WorkGang* workers, uint num_workers) {
+  // All objects have been copied, no marked location is above the ro region
+  ArchivePtrMarker::expand_ptrmap((address)_ro_region.top());
+  RelocateEmbeddedPointersTask task(this, &_rw_src_objs, &_ro_src_objs);
+  workers->run_task(&task, num_workers);
+}
+
 void ArchiveBuilder::update_special_refs() {
   for (int i = 0; i < _special_refs->length(); i++) {
     SpecialRefInfo s = _special_refs->at(i);
@@ -712,8 +772,13 @@ void ArchiveBuilder::relocate_roots() {
 
 void ArchiveBuilder::relocate_metaspaceobj_embedded_pointers() {
   log_info(cds)("Relocating embedded pointers in core regions ... ");
-  relocate_embedded_pointers(&_rw_src_objs);
-  relocate_embedded_pointers(&_ro_src_objs);
+  WorkGang* workers = ArchiveRelocationThreads > 1 ? Universe::heap()->safepoint_workers() : NULL;
+  if (workers != NULL) {
+    par_relocate_embedded_pointers(workers, MIN2(ArchiveRelocationThreads, workers->total_workers()));
+  } else {
+    relocate_embedded_pointers(&_rw_src_objs);
+    relocate_embedded_pointers(&_ro_src_objs);
+  }
   update_special_refs();
 }
 
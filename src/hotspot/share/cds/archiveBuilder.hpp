@@ -42,6 +42,7 @@ class FileMapInfo;
 class Klass;
 class MemRegion;
 class Symbol;
+class WorkGang;
 
 // Metaspace::allocate() requires that all blocks must be aligned with KlassAlignmentInBytes.
 // We enforce the same alignment rule in blocks allocated from the shared space.
@@ -62,6 +63,7 @@ const int SharedSpaceObjectAlignment = KlassAlignmentInBytes;
 // [5] Relocate all the pointers in rw/ro, so that the archive can be mapped to
 //     the "requested" location without runtime relocation. See relocate_to_requested()
 class ArchiveBuilder : public StackObj {
+  friend class RelocateEmbeddedPointersTask;
 protected:
   DumpRegion* _current_dump_space;
   address _buffer_bottom;                      // for writing the contents of rw/ro regions
@@ -171,7 +173,7 @@ private:
 
     void append(MetaspaceClosure::Ref* enclosing_ref, SourceObjInfo* src_info);
     void remember_embedded_pointer(SourceObjInfo* pointing_obj, MetaspaceClosure::Ref* ref);
-    void relocate(int i, ArchiveBuilder* builder);
+    void relocate(int i, ArchiveBuilder* builder, bool par = false);
 
     // convenience accessor
     SourceObjInfo* at(int i) const { return objs()->at(i); }
@@ -249,6 +251,7 @@ private:
 
   void update_special_refs();
   void relocate_embedded_pointers(SourceObjList* src_objs);
+  void par_relocate_embedded_pointers(WorkGang* workers, uint num_workers);
 
   bool is_excluded(Klass* k);
   void clean_up_src_obj_table();
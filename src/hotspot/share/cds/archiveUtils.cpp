@@ -87,6 +87,32 @@ void ArchivePtrMarker::mark_pointer(address* ptr_loc) {
   }
 }
 
+void ArchivePtrMarker::expand_ptrmap(address top) {
+  assert(_ptrmap != NULL, "not initialized");
+  assert(!_compacted, "cannot mark anymore");
+  size_t size = (address*)align_up(top, sizeof(address)) - ptr_base();
+  if (_ptrmap->size() < size) {
+    _ptrmap->resize(size);
+  }
+}
+
+void ArchivePtrMarker::par_mark_pointer(address* ptr_loc) {
+  assert(_ptrmap != NULL, "not initialized");
+  assert(!_compacted, "cannot mark anymore");
+
+  if (ptr_base() <= ptr_loc && ptr_loc < ptr_end()) {
+    address value = *ptr_loc;
+    assert(value != (address)ptr_base(), "don't point to the bottom of the archive");
+
+    if (value != NULL) {
+      assert(uintx(ptr_loc) % sizeof(intptr_t) == 0, "pointers must be stored in aligned addresses");
+      size_t idx = ptr_loc - ptr_base();
+      assert(idx < _ptrmap->size(), "must have been expanded");
+      _ptrmap->par_set_bit(idx);
+    }
+  }
+}
+
 void ArchivePtrMarker::clear_pointer(address* ptr_loc) {
   assert(_ptrmap != NULL, "not initialized");
   assert(!_compacted, "cannot clear anymore");
@@ -307,13 +333,11 @@ void ReadClosure::do_tag(int tag) {
 
 void ReadClosure::do_oop(oop *p) {
   narrowOop o = CompressedOops::narrow_oop_cast(nextPtr());
-  if (CompressedOops::is_null(o) || !HeapShared::open_archive_heap_region_mapped()) {
+  if (CompressedOops::is_null(o) || !HeapShared::is_fully_available()) {
     *p = NULL;
   } else {
-    assert(HeapShared::is_heap_object_archiving_allowed(),
+    assert(HeapShared::can_use(),
            "Archived heap object is not allowed");
-    assert(HeapShared::open_archive_heap_region_mapped(),
-           "Open archive heap region is not mapped");
     *p = HeapShared::decode_from_archive(o);
   }
 }
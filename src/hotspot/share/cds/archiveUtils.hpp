@@ -54,6 +54,11 @@ public:
   static void initialize(CHeapBitMap* ptrmap, VirtualSpace* vs);
   static void mark_pointer(address* ptr_loc);
   static void clear_pointer(address* ptr_loc);
+
+  // Parallel marking. The bitmap must have been expanded to cover all
+  // marked locations below top before, it is not resized concurrently.
+  static void expand_ptrmap(address top);
+  static void par_mark_pointer(address* ptr_loc);
   static void compact(address relocatable_base, address relocatable_end);
   static void compact(size_t max_non_null_offset);
 
@@ -119,6 +124,10 @@ class SharedDataRelocator: public BitMapClosure {
   }
 
   bool do_bit(size_t offset);
+
+  // Patches all pointers marked in ptrmap, like ptrmap.iterate(this), but
+  // calls do_bit() directly rather than through the closure interface.
+  inline void relocate(const BitMapView& ptrmap);
 };
 
 class DumpRegion {
@@ -47,4 +47,13 @@ inline bool SharedDataRelocator::do_bit(size_t offset) {
   return true; // keep iterating
 }
 
+inline void SharedDataRelocator::relocate(const BitMapView& ptrmap) {
+  const BitMap::idx_t size = ptrmap.size();
+  for (BitMap::idx_t i = ptrmap.get_next_one_offset(0, size);
+       i < size;
+       i = ptrmap.get_next_one_offset(i + 1, size)) {
+    SharedDataRelocator::do_bit(i);
+  }
+}
+
 #endif // SHARE_CDS_ARCHIVEUTILS_INLINE_HPP
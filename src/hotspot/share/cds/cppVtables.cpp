@@ -31,6 +31,7 @@
 #include "oops/instanceClassLoaderKlass.hpp"
 #include "oops/instanceMirrorKlass.hpp"
 #include "oops/instanceRefKlass.hpp"
+#include "oops/methodCounters.hpp"
 #include "oops/methodData.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "oops/typeArrayKlass.hpp"
@@ -58,6 +59,7 @@
   f(InstanceMirrorKlass) \
   f(InstanceRefKlass) \
   f(Method) \
+  f(MethodCounters) \
   f(ObjArrayKlass) \
   f(TypeArrayKlass)
 
@@ -250,7 +252,6 @@ intptr_t* CppVtables::get_archived_vtable(MetaspaceObj::Type msotype, address ob
   case MetaspaceObj::ConstMethodType:
   case MetaspaceObj::ConstantPoolCacheType:
   case MetaspaceObj::AnnotationsType:
-  case MetaspaceObj::MethodCountersType:
   case MetaspaceObj::RecordComponentType:
     // These have no vtables.
     break;
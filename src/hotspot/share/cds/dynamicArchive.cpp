@@ -41,10 +41,13 @@
 #include "memory/resourceArea.hpp"
 #include "oops/klass.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/task.hpp"
 #include "runtime/vmThread.hpp"
 #include "runtime/vmOperations.hpp"
+#include "services/classLoadingService.hpp"
 #include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
 
@@ -385,6 +388,96 @@ void DynamicArchive::dump() {
   VMThread::execute(&op);
 }
 
+bool DynamicArchive::_has_idle_dump_request = false;
+
+#if INCLUDE_MANAGEMENT
+// Samples the number of loaded classes and requests the dump of the
+// ArchiveClassesWhenIdle archive once it has not changed for
+// ArchiveClassesIdleDelay ms.
+class DynamicArchiveIdleTask : public PeriodicTask {
+  jlong _last_count;
+  uintx _idle_time;
+public:
+  static const size_t sample_interval = 100;
+
+  DynamicArchiveIdleTask() : PeriodicTask(sample_interval), _last_count(-1), _idle_time(0) {}
+
+  virtual void task() {
+    jlong count = ClassLoadingService::loaded_class_count();
+    if (count != _last_count) {
+      _last_count = count;
+      _idle_time = 0;
+      return;
+    }
+    _idle_time += sample_interval;
+    if (_idle_time >= ArchiveClassesIdleDelay) {
+      log_info(cds, dynamic)("No class loaded for " UINTX_FORMAT " ms (" JLONG_FORMAT " classes loaded)",
+                             _idle_time, count);
+      disenroll();
+      DynamicArchive::request_idle_dump();
+    }
+  }
+};
+#endif // INCLUDE_MANAGEMENT
+
+void DynamicArchive::start_idle_dump_task() {
+  if (ArchiveClassesWhenIdle == NULL || !RecordDynamicDumpInfo || !UseSharedSpaces) {
+    return;
+  }
+#if INCLUDE_MANAGEMENT
+  PeriodicTask* task = new DynamicArchiveIdleTask();
+  task->enroll();
+#else
+  log_warning(cds, dynamic)("ArchiveClassesWhenIdle is not supported without management support");
+#endif
+}
+
+void DynamicArchive::request_idle_dump() {
+  MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+  _has_idle_dump_request = true;
+  Service_lock->notify_all();
+}
+
+bool DynamicArchive::has_idle_dump_request_and_reset() {
+  assert_lock_strong(Service_lock);
+  bool result = _has_idle_dump_request;
+  _has_idle_dump_request = false;
+  return result;
+}
+
+void DynamicArchive::dump_when_idle(JavaThread* current) {
+  if (has_been_dumped_once()) {
+    // Already dumped with jcmd VM.cds dynamic_dump.
+    return;
+  }
+  JavaThread* THREAD = current;
+  HandleMark hm(THREAD);
+  ResourceMark rm(THREAD);
+  MetaspaceShared::link_and_cleanup_shared_classes(THREAD);
+  if (!HAS_PENDING_EXCEPTION) {
+    dump(ArchiveClassesWhenIdle, THREAD);
+  }
+  if (HAS_PENDING_EXCEPTION) {
+    log_warning(cds, dynamic)("ArchiveClassesWhenIdle has failed");
+    log_warning(cds, dynamic)("%s: %s", PENDING_EXCEPTION->klass()->external_name(),
+                              java_lang_String::as_utf8_string(java_lang_Throwable::message(PENDING_EXCEPTION)));
+    CLEAR_PENDING_EXCEPTION;
+  } else {
+    log_info(cds, dynamic)("Dynamic archive written to %s", ArchiveClassesWhenIdle);
+  }
+}
+
+void DynamicArchive::remove_stale_idle_archive(const char* path) {
+  if (ArchiveClassesWhenIdle == NULL || path == NULL || !os::same_files(path, ArchiveClassesWhenIdle)) {
+    return;
+  }
+  if (remove(path) == 0) {
+    log_info(cds, dynamic)("Removed unusable archive %s, it will be created again", path);
+  } else {
+    log_warning(cds, dynamic)("Unable to remove unusable archive %s", path);
+  }
+}
+
 bool DynamicArchive::validate(FileMapInfo* dynamic_info) {
   assert(!dynamic_info->is_static(), "must be");
   // Check if the recorded base archive matches with the current one
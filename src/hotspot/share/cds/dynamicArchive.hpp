@@ -59,6 +59,7 @@ public:
 
 class DynamicArchive : AllStatic {
   static bool _has_been_dumped_once;
+  static bool _has_idle_dump_request;
 public:
   static void prepare_for_dynamic_dumping_at_exit();
   static void dump(const char* archive_name, TRAPS);
@@ -67,6 +68,17 @@ public:
   static void set_has_been_dumped_once() { _has_been_dumped_once = true; }
   static bool is_mapped() { return FileMapInfo::dynamic_info() != NULL; }
   static bool validate(FileMapInfo* dynamic_info);
+
+  // Support for -XX:ArchiveClassesWhenIdle. A periodic task watches the number
+  // of loaded classes and, once it has been stable for ArchiveClassesIdleDelay
+  // ms, asks the ServiceThread to dump the archive.
+  static void start_idle_dump_task();
+  static void request_idle_dump();
+  static bool has_idle_dump_request_and_reset();
+  static void dump_when_idle(JavaThread* current);
+  // Removes an archive created by ArchiveClassesWhenIdle that could not be
+  // used, so that the next run creates a new one.
+  static void remove_stale_idle_archive(const char* path);
 };
 #endif // INCLUDE_CDS
 #endif // SHARE_CDS_DYNAMICARCHIVE_HPP
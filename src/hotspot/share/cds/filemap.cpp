@@ -61,6 +61,7 @@
 #include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/classpathStream.hpp"
+#include "utilities/copy.hpp"
 #include "utilities/defaultStream.hpp"
 #include "utilities/ostream.hpp"
 #if INCLUDE_G1GC
@@ -1703,7 +1704,7 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
 
     SharedDataRelocator patcher((address*)patch_base, (address*)patch_end, valid_old_base, valid_old_end,
                                 valid_new_base, valid_new_end, addr_delta);
-    ptrmap.iterate(&patcher);
+    patcher.relocate(ptrmap);
 
     // The MetaspaceShared::bm region will be unmapped in MetaspaceShared::initialize_shared_spaces().
 
@@ -1787,9 +1788,10 @@ MemRegion FileMapInfo::get_heap_regions_range_with_current_oop_encoding_mode() {
 // regions may be added. GC may mark and update references in the mapped
 // open archive objects.
 void FileMapInfo::map_heap_regions_impl() {
-  if (!HeapShared::is_heap_object_archiving_allowed()) {
-    log_info(cds)("CDS heap data is being ignored. UseG1GC, "
-                  "UseCompressedOops and UseCompressedClassPointers are required.");
+  if (!HeapShared::is_heap_object_archiving_allowed() && !HeapShared::can_load()) {
+    log_info(cds)("CDS heap data is being ignored. UseCompressedOops and "
+                  "UseCompressedClassPointers are required, and the GC must "
+                  "support mapping or loading of archived heap objects.");
     return;
   }
 
@@ -1830,6 +1832,13 @@ void FileMapInfo::map_heap_regions_impl() {
     return;
   }
 
+  if (!HeapShared::is_heap_object_archiving_allowed()) {
+    if (load_heap_regions()) {
+      log_info(cds)("CDS heap data was loaded into the heap");
+    }
+    return;
+  }
+
   if (narrow_oop_mode() != CompressedOops::mode() ||
       narrow_oop_base() != CompressedOops::base() ||
       narrow_oop_shift() != CompressedOops::shift()) {
@@ -1917,8 +1926,103 @@ void FileMapInfo::map_heap_regions() {
 
   if (!HeapShared::open_archive_heap_region_mapped()) {
     assert(open_archive_heap_ranges == NULL && num_open_archive_heap_ranges == 0, "sanity");
-    MetaspaceShared::disable_full_module_graph();
+    if (!HeapShared::is_loaded()) {
+      MetaspaceShared::disable_full_module_graph();
+    }
+  }
+}
+
+// Collectors other than G1 cannot map the archived heap regions at the
+// addresses they had at dump time. Instead, all regions are copied into one
+// block allocated in the runtime heap, and their embedded pointers are
+// relocated with the oopmaps. From then on, the loaded objects are ordinary
+// heap objects. They are kept alive by HeapShared::roots() and the string
+// table once the java.lang.Object and String classes have been resolved;
+// no GC can happen before that.
+bool FileMapInfo::load_heap_regions() {
+  const int first = MetaspaceShared::first_closed_archive_heap_region;
+  const int last = MetaspaceShared::last_open_archive_heap_region;
+
+  char* bitmap_base = map_bitmap_region();
+  if (bitmap_base == NULL) {
+    return false;
+  }
+
+  // The dump time address of each region, as decoded with the archived
+  // narrow oop encoding.
+  HeapShared::init_narrow_oop_decoding(narrow_oop_base(), narrow_oop_shift());
+  address dumptime_bottom[last + 1];
+  size_t total_bytes = 0;
+  for (int i = first; i <= last; i++) {
+    FileMapRegion* si = space_at(i);
+    dumptime_bottom[i] = si->used() > 0 ? start_address_as_decoded_from_archive(si) : NULL;
+    total_bytes += si->used();
+  }
+  if (total_bytes == 0) {
+    return false;
+  }
+
+  // Read and verify all regions before the heap space is allocated, so that
+  // a failure cannot leave an unparsable block in the heap.
+  char* buffer = NEW_C_HEAP_ARRAY(char, total_bytes, mtClassShared);
+  char* p = buffer;
+  for (int i = first; i <= last; i++) {
+    FileMapRegion* si = space_at(i);
+    size_t size = si->used();
+    if (size == 0) {
+      continue;
+    }
+    if (lseek(_fd, (long)si->file_offset(), SEEK_SET) != (int)si->file_offset() ||
+        read_bytes(p, size) != size ||
+        (VerifySharedSpaces && !region_crc_check(p, size, si->crc()))) {
+      log_info(cds)("UseSharedSpaces: Unable to read heap region #%d", i);
+      FREE_C_HEAP_ARRAY(char, buffer);
+      return false;
+    }
+    p += size;
   }
+
+  size_t word_size = total_bytes / HeapWordSize;
+  HeapWord* start = Universe::heap()->allocate_loaded_archive_space(word_size);
+  if (start == NULL) {
+    log_info(cds)("UseSharedSpaces: Unable to allocate " SIZE_FORMAT " bytes in java heap "
+                  "for the archived heap objects", total_bytes);
+    FREE_C_HEAP_ARRAY(char, buffer);
+    return false;
+  }
+  Copy::disjoint_words((HeapWord*)buffer, start, word_size);
+  FREE_C_HEAP_ARRAY(char, buffer);
+
+  address load_address = (address)start;
+  for (int i = first; i <= last; i++) {
+    size_t size = space_at(i)->used();
+    if (size > 0) {
+      log_info(cds)("Loaded heap data: region[%d] at " INTPTR_FORMAT " (dumped at " INTPTR_FORMAT
+                    "), size = " SIZE_FORMAT_W(8) " bytes",
+                    i, p2i(load_address), p2i(dumptime_bottom[i]), size);
+      HeapShared::add_loaded_region(dumptime_bottom[i], size, load_address);
+      load_address += size;
+    }
+  }
+
+  // Now decode_from_archive() returns the loaded addresses.
+  load_address = (address)start;
+  for (int i = first; i <= last; i++) {
+    FileMapRegion* si = space_at(i);
+    size_t size = si->used();
+    if (size > 0) {
+      HeapShared::patch_archived_heap_embedded_pointers(
+        MemRegion((HeapWord*)load_address, size / HeapWordSize),
+        (address)bitmap_base + si->oopmap_offset(),
+        si->oopmap_size_in_bits());
+      load_address += size;
+    }
+  }
+
+  Universe::heap()->complete_loaded_archive_space(MemRegion(start, word_size));
+  HeapShared::set_loaded();
+  HeapShared::set_roots(header()->heap_obj_roots());
+  return true;
 }
 
 bool FileMapInfo::map_heap_data(MemRegion **heap_mem, int first,
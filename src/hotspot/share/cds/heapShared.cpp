@@ -69,9 +69,14 @@
 
 bool HeapShared::_closed_archive_heap_region_mapped = false;
 bool HeapShared::_open_archive_heap_region_mapped = false;
+bool HeapShared::_loaded = false;
 bool HeapShared::_archive_heap_region_fixed = false;
 address   HeapShared::_narrow_oop_base;
 int       HeapShared::_narrow_oop_shift;
+int       HeapShared::_num_loaded_regions = 0;
+uintptr_t HeapShared::_dumptime_bottom[HeapShared::max_loaded_regions];
+uintptr_t HeapShared::_dumptime_top[HeapShared::max_loaded_regions];
+intx      HeapShared::_runtime_offset[HeapShared::max_loaded_regions];
 DumpedInternedStrings *HeapShared::_dumped_interned_strings = NULL;
 
 //
@@ -126,7 +131,7 @@ void HeapShared::fixup_mapped_heap_regions() {
   FileMapInfo *mapinfo = FileMapInfo::current_info();
   mapinfo->fixup_mapped_heap_regions();
   set_archive_heap_region_fixed();
-  if (is_mapped()) {
+  if (is_fully_available()) {
     _roots = OopHandle(Universe::vm_global(), decode_from_archive(_roots_narrow));
     if (!MetaspaceShared::use_full_module_graph()) {
       // Need to remove all the archived java.lang.Module objects from HeapShared::roots().
@@ -215,7 +220,7 @@ objArrayOop HeapShared::roots() {
 
 void HeapShared::set_roots(narrowOop roots) {
   assert(UseSharedSpaces, "runtime only");
-  assert(open_archive_heap_region_mapped(), "must be");
+  assert(is_fully_available(), "must be");
   _roots_narrow = roots;
 }
 
@@ -240,7 +245,7 @@ oop HeapShared::get_root(int index, bool clear) {
 void HeapShared::clear_root(int index) {
   assert(index >= 0, "sanity");
   assert(UseSharedSpaces, "must be");
-  if (open_archive_heap_region_mapped()) {
+  if (is_fully_available()) {
     if (log_is_enabled(Debug, cds, heap)) {
       oop old = roots()->obj_at(index);
       log_debug(cds, heap)("Clearing root %d: was " PTR_FORMAT, index, p2i(old));
@@ -440,6 +445,23 @@ void HeapShared::init_narrow_oop_decoding(address base, int shift) {
   _narrow_oop_shift = shift;
 }
 
+bool HeapShared::can_load() {
+  return UseCompressedOops && UseCompressedClassPointers &&
+         Universe::heap()->can_load_archived_objects();
+}
+
+// Records that the region at dumptime_bottom was loaded at runtime_bottom, so that
+// decode_from_archive() returns the new locations of the objects in it.
+void HeapShared::add_loaded_region(address dumptime_bottom, size_t byte_size,
+                                   address runtime_bottom) {
+  assert(UseSharedSpaces && !is_mapped(), "loading is only used if mapping is not possible");
+  assert(_num_loaded_regions < max_loaded_regions, "too many regions");
+  int i = _num_loaded_regions++;
+  _dumptime_bottom[i] = (uintptr_t)dumptime_bottom;
+  _dumptime_top[i] = (uintptr_t)dumptime_bottom + byte_size;
+  _runtime_offset[i] = runtime_bottom - dumptime_bottom;
+}
+
 //
 // Subgraph archiving support
 //
@@ -145,6 +145,7 @@ class HeapShared: AllStatic {
 #if INCLUDE_CDS_JAVA_HEAP
   static bool _closed_archive_heap_region_mapped;
   static bool _open_archive_heap_region_mapped;
+  static bool _loaded;
   static bool _archive_heap_region_fixed;
   static DumpedInternedStrings *_dumped_interned_strings;
 
@@ -230,6 +231,15 @@ private:
   static address _narrow_oop_base;
   static int     _narrow_oop_shift;
 
+  // The dump time address ranges of the regions that were loaded by
+  // FileMapInfo::load_heap_regions(), and the distances by which they moved.
+  static const int max_loaded_regions = MetaspaceShared::max_closed_archive_heap_region +
+                                        MetaspaceShared::max_open_archive_heap_region;
+  static int       _num_loaded_regions;
+  static uintptr_t _dumptime_bottom[max_loaded_regions];
+  static uintptr_t _dumptime_top[max_loaded_regions];
+  static intx      _runtime_offset[max_loaded_regions];
+
   typedef ResourceHashtable<oop, bool,
       HeapShared::oop_hash,
       HeapShared::oop_equals,
@@ -382,6 +392,36 @@ private:
     return closed_archive_heap_region_mapped() && open_archive_heap_region_mapped();
   }
 
+  // Collectors that cannot map the archived heap regions (everything but G1)
+  // may instead copy them into the heap at startup, see
+  // FileMapInfo::load_heap_regions(). The loaded objects are ordinary heap
+  // objects, so is_archived_object() is false for them.
+  static bool can_load() NOT_CDS_JAVA_HEAP_RETURN_(false);
+  static bool can_use() {
+    return is_heap_object_archiving_allowed() || (!DumpSharedSpaces && can_load());
+  }
+  static void set_loaded() {
+    CDS_JAVA_HEAP_ONLY(_loaded = true;)
+    NOT_CDS_JAVA_HEAP_RETURN;
+  }
+  static bool is_loaded() {
+    CDS_JAVA_HEAP_ONLY(return _loaded;)
+    NOT_CDS_JAVA_HEAP_RETURN_(false);
+  }
+  static void add_loaded_region(address dumptime_bottom, size_t byte_size,
+                                address runtime_bottom) NOT_CDS_JAVA_HEAP_RETURN;
+
+  // Whether the archived objects can be used, whether they were mapped or loaded.
+  static bool is_fully_available() {
+    return is_loaded() || is_mapped();
+  }
+  static bool are_archived_strings_available() {
+    return is_loaded() || closed_archive_heap_region_mapped();
+  }
+  static bool are_archived_mirrors_available() {
+    return is_fully_available();
+  }
+
   static void fixup_mapped_heap_regions() NOT_CDS_JAVA_HEAP_RETURN;
 
   inline static bool is_archived_object(oop p) NOT_CDS_JAVA_HEAP_RETURN_(false);
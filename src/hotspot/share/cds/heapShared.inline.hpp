@@ -39,7 +39,14 @@ bool HeapShared::is_archived_object(oop p) {
 
 inline oop HeapShared::decode_from_archive(narrowOop v) {
   assert(!CompressedOops::is_null(v), "narrow oop value can never be zero");
-  oop result = cast_to_oop((uintptr_t)_narrow_oop_base + ((uintptr_t)v << _narrow_oop_shift));
+  uintptr_t p = (uintptr_t)_narrow_oop_base + ((uintptr_t)v << _narrow_oop_shift);
+  for (int i = 0; i < _num_loaded_regions; i++) {
+    if (p >= _dumptime_bottom[i] && p < _dumptime_top[i]) {
+      p += _runtime_offset[i];
+      break;
+    }
+  }
+  oop result = cast_to_oop(p);
   assert(is_object_aligned(result), "address not aligned: " INTPTR_FORMAT, p2i((void*) result));
   return result;
 }
@@ -28,6 +28,7 @@
 #include "cds/classListParser.hpp"
 #include "cds/cppVtables.hpp"
 #include "cds/dumpAllocStats.hpp"
+#include "cds/dynamicArchive.hpp"
 #include "cds/filemap.hpp"
 #include "cds/heapShared.hpp"
 #include "cds/lambdaFormInvokers.hpp"
@@ -940,6 +941,7 @@ FileMapInfo* MetaspaceShared::open_dynamic_archive() {
   FileMapInfo* mapinfo = new FileMapInfo(false);
   if (!mapinfo->initialize()) {
     delete(mapinfo);
+    DynamicArchive::remove_stale_idle_archive(Arguments::GetSharedDynamicArchivePath());
     return NULL;
   }
   return mapinfo;
@@ -1062,6 +1064,7 @@ MapArchiveResult MetaspaceShared::map_archives(FileMapInfo* static_mapinfo, File
         // (bad file, etc) -- just keep the base archive.
         log_warning(cds, dynamic)("Unable to use shared archive. The top archive failed to load: %s",
                                   dynamic_mapinfo->full_path());
+        DynamicArchive::remove_stale_idle_archive(dynamic_mapinfo->full_path());
         result = MAP_ARCHIVE_SUCCESS;
         // TODO, we can give the unused space for the dynamic archive to class_space_rs, but there's no
         // easy API to do that right now.
@@ -1468,7 +1471,7 @@ bool MetaspaceShared::use_full_module_graph() {
   }
 #endif
   bool result = _use_optimized_module_handling && _use_full_module_graph &&
-    (UseSharedSpaces || DumpSharedSpaces) && HeapShared::is_heap_object_archiving_allowed();
+    (UseSharedSpaces || DumpSharedSpaces) && HeapShared::can_use();
   if (result && UseSharedSpaces) {
     // Classes used by the archived full module graph are loaded in JVMTI early phase.
     assert(!(JvmtiExport::should_post_class_file_load_hook() && JvmtiExport::has_early_class_hook_env()),
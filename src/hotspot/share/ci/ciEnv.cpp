@@ -930,6 +930,9 @@ void ciEnv::validate_compile_task_dependencies(ciMethod* target) {
     if (result == Dependencies::call_site_target_value) {
       _inc_decompile_count_on_failure = false;
       record_failure("call site target change");
+    } else if (result == Dependencies::being_initialized) {
+      _inc_decompile_count_on_failure = false;
+      record_failure("class initialized");
     } else if (Dependencies::is_klass_type(result)) {
       record_failure("concurrent class loading");
     } else {
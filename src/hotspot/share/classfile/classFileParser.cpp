@@ -166,7 +166,6 @@ void ClassFileParser::parse_constant_pool_entries(const ClassFileStream* const s
   const char* names[SymbolTable::symbol_alloc_batch_size];
   int lengths[SymbolTable::symbol_alloc_batch_size];
   int indices[SymbolTable::symbol_alloc_batch_size];
-  unsigned int hashValues[SymbolTable::symbol_alloc_batch_size];
   int names_count = 0;
 
   // parsing  Index 0 is unused
@@ -322,27 +321,18 @@ void ClassFileParser::parse_constant_pool_entries(const ClassFileStream* const s
           verify_legal_utf8(utf8_buffer, utf8_length, CHECK);
         }
 
-        unsigned int hash;
-        Symbol* const result = SymbolTable::lookup_only((const char*)utf8_buffer,
-                                                        utf8_length,
-                                                        hash);
-        if (result == NULL) {
-          names[names_count] = (const char*)utf8_buffer;
-          lengths[names_count] = utf8_length;
-          indices[names_count] = index;
-          hashValues[names_count++] = hash;
-          if (names_count == SymbolTable::symbol_alloc_batch_size) {
-            SymbolTable::new_symbols(_loader_data,
-                                     constantPoolHandle(THREAD, cp),
-                                     names_count,
-                                     names,
-                                     lengths,
-                                     indices,
-                                     hashValues);
-            names_count = 0;
-          }
-        } else {
-          cp->symbol_at_put(index, result);
+        // Symbols are looked up, and added if new, in batches.
+        names[names_count] = (const char*)utf8_buffer;
+        lengths[names_count] = utf8_length;
+        indices[names_count++] = index;
+        if (names_count == SymbolTable::symbol_alloc_batch_size) {
+          SymbolTable::lookup_or_new_symbols(_loader_data,
+                                             constantPoolHandle(THREAD, cp),
+                                             names_count,
+                                             names,
+                                             lengths,
+                                             indices);
+          names_count = 0;
         }
         break;
       }
@@ -369,13 +359,12 @@ void ClassFileParser::parse_constant_pool_entries(const ClassFileStream* const s
 
   // Allocate the remaining symbols
   if (names_count > 0) {
-    SymbolTable::new_symbols(_loader_data,
-                             constantPoolHandle(THREAD, cp),
-                             names_count,
-                             names,
-                             lengths,
-                             indices,
-                             hashValues);
+    SymbolTable::lookup_or_new_symbols(_loader_data,
+                                       constantPoolHandle(THREAD, cp),
+                                       names_count,
+                                       names,
+                                       lengths,
+                                       indices);
   }
 
   // Copy _current pointer of local copy back to stream.
@@ -88,6 +88,7 @@ static canonicalize_fn_t CanonicalizeEntry  = NULL;
 
 typedef void * * (*ZipOpen_t)(const char *name, char **pmsg);
 typedef void     (*ZipClose_t)(jzfile *zip);
+typedef void     (*ZipPrefetch_t)(jzfile *zip);
 typedef jzentry* (*FindEntry_t)(jzfile *zip, const char *name, jint *sizeP, jint *nameLen);
 typedef jboolean (*ReadEntry_t)(jzfile *zip, jzentry *entry, unsigned char *buf, char *namebuf);
 typedef jzentry* (*GetNextEntry_t)(jzfile *zip, jint n);
@@ -95,6 +96,7 @@ typedef jint     (*Crc32_t)(jint crc, const jbyte *buf, jint len);
 
 static ZipOpen_t         ZipOpen            = NULL;
 static ZipClose_t        ZipClose           = NULL;
+static ZipPrefetch_t     ZipPrefetch        = NULL;
 static FindEntry_t       FindEntry          = NULL;
 static ReadEntry_t       ReadEntry          = NULL;
 static GetNextEntry_t    GetNextEntry       = NULL;
@@ -107,6 +109,8 @@ static JImageOpen_t                    JImageOpen             = NULL;
 static JImageClose_t                   JImageClose            = NULL;
 static JImageFindResource_t            JImageFindResource     = NULL;
 static JImageGetResource_t             JImageGetResource      = NULL;
+static JImageGetResourceAddress_t      JImageGetResourceAddress = NULL;
+static JImagePackageToModule_t         JImagePackageToModule  = NULL;
 
 // JimageFile pointer, or null if exploded JDK build.
 static JImageFile*                     JImage_file            = NULL;
@@ -414,11 +418,16 @@ ClassFileStream* ClassPathImageEntry::open_stream_for_loader(JavaThread* current
     if (UsePerfData) {
       ClassLoader::perf_sys_classfile_bytes_read()->inc(size);
     }
-    char* data = NEW_RESOURCE_ARRAY(char, size);
-    (*JImageGetResource)(jimage_non_null(), location, data, size);
+    // Uncompressed resources are parsed directly from the mapped image.
+    const char* data = (*JImageGetResourceAddress)(jimage_non_null(), location);
+    if (data == NULL) {
+      char* buffer = NEW_RESOURCE_ARRAY(char, size);
+      (*JImageGetResource)(jimage_non_null(), location, buffer, size);
+      data = buffer;
+    }
     // Resource allocated
     assert(this == (ClassPathImageEntry*)ClassLoader::get_jrt_entry(), "must be");
-    return new ClassFileStream((u1*)data,
+    return new ClassFileStream((const u1*)data,
                                (int)size,
                                _name,
                                ClassFileStream::verify,
@@ -435,6 +444,35 @@ JImageLocationRef ClassLoader::jimage_find_resource(JImageFile* jf,
   return ((*JImageFindResource)(jf, module_name, get_jimage_version_string(), file_name, &size));
 }
 
+u1* ClassLoader::read_from_modules_image(const char* file_name, jlong* size) {
+  if (JImage_file == NULL) {
+    return NULL;
+  }
+  JImageLocationRef location = jimage_find_resource(JImage_file, "", file_name, *size);
+  if (location == 0) {
+    const char* last_slash = strrchr(file_name, '/');
+    if (last_slash == NULL) {
+      return NULL;
+    }
+    size_t pkg_len = last_slash - file_name;
+    char* pkg_name = NEW_C_HEAP_ARRAY(char, pkg_len + 1, mtClass);
+    strncpy(pkg_name, file_name, pkg_len);
+    pkg_name[pkg_len] = '\0';
+    const char* module_name = (*JImagePackageToModule)(JImage_file, pkg_name);
+    FREE_C_HEAP_ARRAY(char, pkg_name);
+    if (module_name == NULL) {
+      return NULL;
+    }
+    location = jimage_find_resource(JImage_file, module_name, file_name, *size);
+    if (location == 0) {
+      return NULL;
+    }
+  }
+  u1* data = NEW_C_HEAP_ARRAY(u1, *size, mtClass);
+  (*JImageGetResource)(JImage_file, location, (char*)data, *size);
+  return data;
+}
+
 bool ClassPathImageEntry::is_modules_image() const {
   assert(this == _singleton, "VM supports a single jimage");
   assert(this == (ClassPathImageEntry*)ClassLoader::get_jrt_entry(), "must be used for jrt entry");
@@ -715,7 +753,11 @@ jzfile* ClassLoader::open_zip_file(const char* canonical_path, char** error_msg,
   ThreadToNativeFromVM ttn(thread);
   HandleMark hm(thread);
   load_zip_library_if_needed();
-  return (*ZipOpen)(canonical_path, error_msg);
+  jzfile* zip = (*ZipOpen)(canonical_path, error_msg);
+  if (PrefetchClassPathZipFiles && zip != NULL) {
+    (*ZipPrefetch)(zip);
+  }
+  return zip;
 }
 
 ClassPathEntry* ClassLoader::create_class_path_entry(JavaThread* current,
@@ -943,6 +985,7 @@ void ClassLoader::load_zip_library() {
 
   ZipOpen = CAST_TO_FN_PTR(ZipOpen_t, dll_lookup(handle, "ZIP_Open", path));
   ZipClose = CAST_TO_FN_PTR(ZipClose_t, dll_lookup(handle, "ZIP_Close", path));
+  ZipPrefetch = CAST_TO_FN_PTR(ZipPrefetch_t, dll_lookup(handle, "ZIP_Prefetch", path));
   FindEntry = CAST_TO_FN_PTR(FindEntry_t, dll_lookup(handle, "ZIP_FindEntry", path));
   ReadEntry = CAST_TO_FN_PTR(ReadEntry_t, dll_lookup(handle, "ZIP_ReadEntry", path));
   GetNextEntry = CAST_TO_FN_PTR(GetNextEntry_t, dll_lookup(handle, "ZIP_GetNextEntry", path));
@@ -965,6 +1008,8 @@ void ClassLoader::load_jimage_library() {
   JImageClose = CAST_TO_FN_PTR(JImageClose_t, dll_lookup(handle, "JIMAGE_Close", path));
   JImageFindResource = CAST_TO_FN_PTR(JImageFindResource_t, dll_lookup(handle, "JIMAGE_FindResource", path));
   JImageGetResource = CAST_TO_FN_PTR(JImageGetResource_t, dll_lookup(handle, "JIMAGE_GetResource", path));
+  JImageGetResourceAddress = CAST_TO_FN_PTR(JImageGetResourceAddress_t, dll_lookup(handle, "JIMAGE_GetResourceAddress", path));
+  JImagePackageToModule = CAST_TO_FN_PTR(JImagePackageToModule_t, dll_lookup(handle, "JIMAGE_PackageToModule", path));
 }
 
 int ClassLoader::crc32(int crc, const char* buf, int len) {
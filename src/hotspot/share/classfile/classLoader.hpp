@@ -373,6 +373,13 @@ class ClassLoader: AllStatic {
   static JImageLocationRef jimage_find_resource(JImageFile* jf, const char* module_name,
                                                 const char* file_name, jlong &size);
 
+  // Reads the named resource, e.g. "java/lang/Object.class", from the modules
+  // image into an mtClass C heap buffer that the caller must free. The module
+  // is found from the package of the resource, so unlike open_stream() this
+  // does not depend on the module system and can be used by any thread.
+  // Returns NULL if there is no modules image or no such resource.
+  static u1* read_from_modules_image(const char* file_name, jlong* size);
+
   static void  trace_class_path(const char* msg, const char* name = NULL);
 
   // VM monitoring and management support
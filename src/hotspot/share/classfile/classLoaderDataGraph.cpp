@@ -33,11 +33,13 @@
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/classLoaderMetaspace.hpp"
 #include "memory/metaspace.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/mutex.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/vmOperations.hpp"
@@ -199,6 +201,7 @@ ClassLoaderData* ClassLoaderDataGraph::_unloading = NULL;
 bool ClassLoaderDataGraph::_should_clean_deallocate_lists = false;
 bool ClassLoaderDataGraph::_safepoint_cleanup_needed = false;
 bool ClassLoaderDataGraph::_metaspace_oom = false;
+bool ClassLoaderDataGraph::_metaspace_trim_needed = false;
 
 // Add a new class loader data node to the list.  Assign the newly created
 // ClassLoaderData into the java/lang/ClassLoader object as a hidden field
@@ -352,6 +355,20 @@ void ClassLoaderDataGraph::loaded_cld_do(CLDClosure* cl) {
   }
 }
 
+// Uncommit the unused committed space of the arenas of class loaders that did not
+// allocate metaspace since the last class unloading. Long lived loaders which keep
+// only a few classes then give back the committed memory of their current chunk.
+void ClassLoaderDataGraph::trim_metaspaces() {
+  MutexLocker ml(ClassLoaderDataGraph_lock);
+  ClassLoaderDataGraphIterator iter;
+  while (ClassLoaderData* cld = iter.get_next()) {
+    ClassLoaderMetaspace* ms = cld->metaspace_or_null();
+    if (ms != NULL) {
+      ms->trim_if_quiescent();
+    }
+  }
+}
+
 // These functions assume that the caller has locked the ClassLoaderDataGraph_lock
 // if they are not calling the function from a safepoint.
 void ClassLoaderDataGraph::classes_do(KlassClosure* klass_closure) {
@@ -570,9 +587,19 @@ void ClassLoaderDataGraph::purge(bool at_safepoint) {
     delete purge_me;
     classes_unloaded = true;
   }
+  purge_complete(classes_unloaded, at_safepoint);
+}
+
+void ClassLoaderDataGraph::purge_complete(bool classes_unloaded, bool at_safepoint) {
   if (classes_unloaded) {
     Metaspace::purge();
     set_metaspace_oom(false);
+    if (MetaspaceTrimQuiescentArenas) {
+      // Let the service thread uncommit the unused space of the surviving arenas.
+      MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+      _metaspace_trim_needed = true;
+      Service_lock->notify_all();
+    }
   }
   DependencyContext::purge_dependency_contexts();
 
@@ -592,6 +619,42 @@ void ClassLoaderDataGraph::purge(bool at_safepoint) {
   }
 }
 
+ClassLoaderDataGraphParallelPurger::ClassLoaderDataGraphParallelPurger() :
+    _purge_list(NULL),
+    _length(0),
+    _claimed(0) {
+  // Copy the unloading list into an array, since the list can not be
+  // walked while other threads delete its elements.
+  for (ClassLoaderData* cld = ClassLoaderDataGraph::_unloading; cld != NULL; cld = cld->next()) {
+    _length++;
+  }
+  if (_length > 0) {
+    _purge_list = NEW_C_HEAP_ARRAY(ClassLoaderData*, _length, mtClass);
+    size_t i = 0;
+    for (ClassLoaderData* cld = ClassLoaderDataGraph::_unloading; cld != NULL; cld = cld->next()) {
+      _purge_list[i++] = cld;
+    }
+  }
+  ClassLoaderDataGraph::_unloading = NULL;
+}
+
+ClassLoaderDataGraphParallelPurger::~ClassLoaderDataGraphParallelPurger() {
+  assert(_claimed >= _length, "not all purged");
+  FREE_C_HEAP_ARRAY(ClassLoaderData*, _purge_list);
+}
+
+void ClassLoaderDataGraphParallelPurger::work() {
+  for (size_t i = Atomic::fetch_and_add(&_claimed, 1u);
+       i < _length;
+       i = Atomic::fetch_and_add(&_claimed, 1u)) {
+    delete _purge_list[i];
+  }
+}
+
+void ClassLoaderDataGraphParallelPurger::complete(bool at_safepoint) {
+  ClassLoaderDataGraph::purge_complete(_length > 0, at_safepoint);
+}
+
 int ClassLoaderDataGraph::resize_dictionaries() {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint!");
   int resized = 0;
@@ -38,6 +38,7 @@ class ClassLoaderDataGraph : public AllStatic {
   friend class ClassLoaderDataGraphKlassIteratorAtomic;
   friend class ClassLoaderDataGraphKlassIteratorStatic;
   friend class ClassLoaderDataGraphIterator;
+  friend class ClassLoaderDataGraphParallelPurger;
   friend class VMStructs;
  private:
   // All CLDs (except the null CLD) can be reached by walking _head->_next->...
@@ -52,12 +53,17 @@ class ClassLoaderDataGraph : public AllStatic {
   // OOM has been seen in metaspace allocation. Used to prevent some
   // allocations until class unloading
   static bool _metaspace_oom;
+  // Set after class unloading with MetaspaceTrimQuiescentArenas.
+  static bool _metaspace_trim_needed;
 
   static volatile size_t  _num_instance_classes;
   static volatile size_t  _num_array_classes;
 
   static ClassLoaderData* add_to_graph(Handle class_loader, bool has_class_mirror_holder);
 
+  // Cleanup after the unloaded ClassLoaderData have been deleted.
+  static void purge_complete(bool classes_unloaded, bool at_safepoint);
+
  public:
   static ClassLoaderData* find_or_create(Handle class_loader);
   static ClassLoaderData* add(Handle class_loader, bool has_class_mirror_holder);
@@ -93,6 +99,9 @@ class ClassLoaderDataGraph : public AllStatic {
   static void clean_deallocate_lists(bool purge_previous_versions);
   // Called from ServiceThread
   static void safepoint_and_clean_metaspaces();
+  static inline bool should_trim_metaspaces_and_reset();
+  // Called from ServiceThread
+  static void trim_metaspaces();
   // Called from VMOperation
   static void walk_metadata_and_clean_metaspaces();
 
@@ -162,4 +171,21 @@ class ClassLoaderDataGraphKlassIteratorAtomic : public StackObj {
   static Klass* next_klass_in_cldg(Klass* klass);
 };
 
+// Deletes the unloaded ClassLoaderData in parallel, as an alternative to
+// ClassLoaderDataGraph::purge(). The unloading list is detached when the
+// purger is created; any number of worker threads then call work() to
+// claim and delete ClassLoaderData, after which complete() does the
+// remaining serial part of the purge.
+class ClassLoaderDataGraphParallelPurger : public StackObj {
+  ClassLoaderData** _purge_list;
+  size_t            _length;
+  volatile size_t   _claimed;
+ public:
+  ClassLoaderDataGraphParallelPurger();
+  ~ClassLoaderDataGraphParallelPurger();
+
+  void work();
+  void complete(bool at_safepoint);
+};
+
 #endif // SHARE_CLASSFILE_CLASSLOADERDATAGRAPH_HPP
@@ -30,6 +30,7 @@
 #include "classfile/javaClasses.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
 
 inline ClassLoaderData *ClassLoaderDataGraph::find_or_create(Handle loader) {
   guarantee(loader() != NULL && oopDesc::is_oop(loader()), "Loader must be oop");
@@ -80,4 +81,11 @@ bool ClassLoaderDataGraph::should_clean_metaspaces_and_reset() {
   return do_cleaning;
 }
 
+bool ClassLoaderDataGraph::should_trim_metaspaces_and_reset() {
+  assert_lock_strong(Service_lock);
+  bool do_trim = _metaspace_trim_needed;
+  _metaspace_trim_needed = false;
+  return do_trim;
+}
+
 #endif // SHARE_CLASSFILE_CLASSLOADERDATAGRAPH_INLINE_HPP
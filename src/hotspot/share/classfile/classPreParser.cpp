@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jvm.h"
+#include "classfile/classLoader.hpp"
+#include "classfile/classPreParser.hpp"
+#include "classfile/symbolTable.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "runtime/timerTrace.hpp"
+#include "utilities/bytes.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/utf8.hpp"
+#if INCLUDE_CDS
+#include "classfile/systemDictionaryShared.hpp"
+#endif
+
+static const u4 CLASSFILE_MAGIC = 0xCAFEBABE;
+// magic, minor_version, major_version, constant_pool_count
+static const size_t CLASSFILE_HEADER_SIZE = 10;
+
+int ClassPreParser::pre_parse(const u1* bytes, size_t size) {
+  if (size < CLASSFILE_HEADER_SIZE || Bytes::get_Java_u4((address)bytes) != CLASSFILE_MAGIC) {
+    return -1;
+  }
+  const u2 major_version = Bytes::get_Java_u2((address)bytes + 6);
+  const u2 cp_size = Bytes::get_Java_u2((address)bytes + 8);
+  const bool version_leq_47 = major_version <= 47;
+
+  const u1* current = bytes + CLASSFILE_HEADER_SIZE;
+  const u1* const end = bytes + size;
+  int symbols = 0;
+  for (int index = 1; index < cp_size; index++) {
+    if (current >= end) {
+      return -1;
+    }
+    size_t entry_size;
+    switch (*current++) {
+      case JVM_CONSTANT_Utf8: {
+        if (end - current < 2) {
+          return -1;
+        }
+        const u2 utf8_length = Bytes::get_Java_u2((address)current);
+        current += 2;
+        if (end - current < utf8_length ||
+            !UTF8::is_legal_utf8(current, utf8_length, version_leq_47)) {
+          return -1;
+        }
+        // The reference is kept, see the class comment.
+        SymbolTable::new_symbol((const char*)current, utf8_length);
+        symbols++;
+        entry_size = utf8_length;
+        break;
+      }
+      case JVM_CONSTANT_Class:
+      case JVM_CONSTANT_String:
+      case JVM_CONSTANT_MethodType:
+      case JVM_CONSTANT_Module:
+      case JVM_CONSTANT_Package:
+        entry_size = 2;
+        break;
+      case JVM_CONSTANT_MethodHandle:
+        entry_size = 3;
+        break;
+      case JVM_CONSTANT_Integer:
+      case JVM_CONSTANT_Float:
+      case JVM_CONSTANT_Fieldref:
+      case JVM_CONSTANT_Methodref:
+      case JVM_CONSTANT_InterfaceMethodref:
+      case JVM_CONSTANT_NameAndType:
+      case JVM_CONSTANT_Dynamic:
+      case JVM_CONSTANT_InvokeDynamic:
+        entry_size = 4;
+        break;
+      case JVM_CONSTANT_Long:
+      case JVM_CONSTANT_Double:
+        // Takes two constant pool slots.
+        index++;
+        entry_size = 8;
+        break;
+      default:
+        return -1;
+    }
+    if ((size_t)(end - current) < entry_size) {
+      return -1;
+    }
+    current += entry_size;
+  }
+  return symbols;
+}
+
+class ClassPreParseTask : public AbstractGangTask {
+  const GrowableArrayCHeap<char*, mtClass>* const _class_names;
+  volatile int _next;
+  volatile int _parsed;
+  volatile int _shared;
+  volatile int _not_found;
+  volatile int _malformed;
+  volatile int _symbols;
+
+  void pre_parse_one(const char* class_name) {
+#if INCLUDE_CDS
+    if (UseSharedSpaces) {
+      TempNewSymbol name = SymbolTable::new_symbol(class_name);
+      if (SystemDictionaryShared::find_builtin_class(name) != NULL) {
+        Atomic::inc(&_shared);
+        return;
+      }
+    }
+#endif
+    stringStream file_name;
+    file_name.print("%s.class", class_name);
+    jlong size;
+    u1* bytes = ClassLoader::read_from_modules_image(file_name.base(), &size);
+    if (bytes == NULL) {
+      Atomic::inc(&_not_found);
+      return;
+    }
+    int symbols = ClassPreParser::pre_parse(bytes, (size_t)size);
+    FREE_C_HEAP_ARRAY(u1, bytes);
+    if (symbols < 0) {
+      log_debug(class, load)("Pre-parse of %s failed", class_name);
+      Atomic::inc(&_malformed);
+    } else {
+      Atomic::inc(&_parsed);
+      Atomic::add(&_symbols, symbols);
+    }
+  }
+
+ public:
+  ClassPreParseTask(const GrowableArrayCHeap<char*, mtClass>* class_names) :
+    AbstractGangTask("Class Pre-Parse"),
+    _class_names(class_names), _next(0), _parsed(0), _shared(0),
+    _not_found(0), _malformed(0), _symbols(0) {}
+
+  void work(uint worker_id) {
+    ResourceMark rm;
+    for (int i = Atomic::fetch_and_add(&_next, 1);
+         i < _class_names->length();
+         i = Atomic::fetch_and_add(&_next, 1)) {
+      pre_parse_one(_class_names->at(i));
+    }
+  }
+
+  void log_result() const {
+    log_info(class, load)("Pre-parsed %d classes (%d symbols) from %s: "
+                          "%d in the CDS archive, %d not in the modules image, %d malformed",
+                          _parsed, _symbols, PreParseClassList, _shared, _not_found, _malformed);
+  }
+};
+
+void ClassPreParser::pre_parse_class_list() {
+  if (PreParseClassList == NULL) {
+    return;
+  }
+  FILE* file = os::fopen(PreParseClassList, "r");
+  if (file == NULL) {
+    log_warning(class, load)("Unable to open class list %s for pre-parsing", PreParseClassList);
+    return;
+  }
+  // Every line either starts with a class name followed by optional
+  // attributes, or is a comment or a directive.
+  GrowableArrayCHeap<char*, mtClass> class_names(1024);
+  char line[JVM_MAXPATHLEN];
+  while (fgets(line, sizeof(line), file) != NULL) {
+    if (line[0] == '#' || line[0] == '@') {
+      continue;
+    }
+    size_t len = strcspn(line, " \t\r\n");
+    if (len == 0) {
+      continue;
+    }
+    char* class_name = NEW_C_HEAP_ARRAY(char, len + 1, mtClass);
+    strncpy(class_name, line, len);
+    class_name[len] = '\0';
+    class_names.append(class_name);
+  }
+  fclose(file);
+
+  {
+    TraceTime timer("Pre-parse class list", TRACETIME_LOG(Info, class, load));
+    ClassPreParseTask task(&class_names);
+    WorkGang* gang = Universe::heap()->safepoint_workers();
+    if (gang != NULL) {
+      uint num_workers = PreParseClassListThreads == 0 ? gang->total_workers() : PreParseClassListThreads;
+      WithUpdatedActiveWorkers update_active_workers(gang, num_workers);
+      gang->run_task(&task);
+    } else {
+      task.work(0);
+    }
+    task.log_result();
+  }
+
+  for (int i = 0; i < class_names.length(); i++) {
+    FREE_C_HEAP_ARRAY(char, class_names.at(i));
+  }
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_CLASSFILE_CLASSPREPARSER_HPP
+#define SHARE_CLASSFILE_CLASSPREPARSER_HPP
+
+#include "memory/allocation.hpp"
+
+// The ClassPreParser reads the classfiles of the classes in a class list
+// (see PreParseClassList) from the modules image on a gang of worker threads
+// before Java code starts running. For every classfile it does the
+// loader-independent part of parsing: it checks the constant pool format and
+// the UTF8 entries, and creates the Symbols of the constant pool. When the
+// class is later loaded by the boot loader, the ClassFileParser finds these
+// symbols in the SymbolTable instead of creating them one by one on the
+// loading thread.
+//
+// The pre-parsed Symbols are referenced for the lifetime of the VM, like
+// those of the classes the class list is expected to name. Classes that are
+// in the CDS archive are skipped, since they are not parsed when loaded.
+// Bytecode verification needs the classes to be linked and is not done here.
+class ClassPreParser : AllStatic {
+ public:
+  // Pre-parses the classes of PreParseClassList, if set.
+  static void pre_parse_class_list();
+
+  // Pre-parses one classfile, returns the number of constant pool Symbols
+  // or -1 if the classfile is malformed.
+  static int pre_parse(const u1* bytes, size_t size);
+};
+
+#endif // SHARE_CLASSFILE_CLASSPREPARSER_HPP
@@ -612,16 +612,36 @@ class EmptyVtableSlot : public ResourceObj {
   }
 };
 
-static bool already_in_vtable_slots(GrowableArray<EmptyVtableSlot*>* slots, Method* m) {
-  bool found = false;
-  for (int j = 0; j < slots->length(); ++j) {
-    if (slots->at(j)->name() == m->name() &&
-        slots->at(j)->signature() == m->signature() ) {
-      found = true;
-      break;
-    }
+class NameAndSig {
+ public:
+  Symbol* _name;
+  Symbol* _signature;
+
+  NameAndSig() : _name(NULL), _signature(NULL) {}
+  NameAndSig(Symbol* name, Symbol* signature) : _name(name), _signature(signature) {}
+
+  static unsigned hash(const NameAndSig& key) {
+    return key._name->identity_hash() ^ (31 * key._signature->identity_hash());
   }
-  return found;
+
+  static bool equals(const NameAndSig& a, const NameAndSig& b) {
+    return a._name == b._name && a._signature == b._signature;
+  }
+};
+
+// The name and signature pairs that have been considered for an empty vtable
+// slot.  Classes implementing many interfaces can have thousands of candidate
+// methods, so avoid searching the list of slots for each of them.
+typedef ResourceHashtable<NameAndSig, bool,
+                          NameAndSig::hash, NameAndSig::equals> ConsideredSlots;
+
+// Returns true if a method with the name and signature of m has already been
+// considered, and otherwise records it as considered.  Whether a considered
+// method needs a slot only depends on its name and signature.
+static bool already_in_vtable_slots(ConsideredSlots* considered, Method* m) {
+  bool created = false;
+  considered->put_if_absent(NameAndSig(m->name(), m->signature()), true, &created);
+  return !created;
 }
 
 static void find_empty_vtable_slots(GrowableArray<EmptyVtableSlot*>* slots,
@@ -629,10 +649,12 @@ static void find_empty_vtable_slots(GrowableArray<EmptyVtableSlot*>* slots,
 
   assert(klass != NULL, "Must be valid class");
 
+  ConsideredSlots considered;
+
   // All miranda methods are obvious candidates
   for (int i = 0; i < mirandas->length(); ++i) {
     Method* m = mirandas->at(i);
-    if (!already_in_vtable_slots(slots, m)) {
+    if (!already_in_vtable_slots(&considered, m)) {
       slots->append(new EmptyVtableSlot(m));
     }
   }
@@ -648,7 +670,7 @@ static void find_empty_vtable_slots(GrowableArray<EmptyVtableSlot*>* slots,
         // default method processing that occurred on behalf of our superclass,
         // so it's a method we want to re-examine in this new context.  That is,
         // unless we have a real implementation of it in the current class.
-        if (!already_in_vtable_slots(slots, m)) {
+        if (!already_in_vtable_slots(&considered, m)) {
           Method *impl = klass->lookup_method(m->name(), m->signature());
           if (impl == NULL || impl->is_overpass() || impl->is_static()) {
             slots->append(new EmptyVtableSlot(m));
@@ -665,7 +687,7 @@ static void find_empty_vtable_slots(GrowableArray<EmptyVtableSlot*>* slots,
         // default method processing that occurred on behalf of our superclass,
         // so it's a method we want to re-examine in this new context.  That is,
         // unless we have a real implementation of it in the current class.
-        if (!already_in_vtable_slots(slots, m)) {
+        if (!already_in_vtable_slots(&considered, m)) {
           Method* impl = klass->lookup_method(m->name(), m->signature());
           if (impl == NULL || impl->is_overpass() || impl->is_static()) {
             slots->append(new EmptyVtableSlot(m));
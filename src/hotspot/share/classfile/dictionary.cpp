@@ -43,6 +43,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "utilities/growableArray.hpp"
 #include "utilities/hashtable.inline.hpp"
@@ -97,15 +98,13 @@ void Dictionary::free_entry(DictionaryEntry* entry) {
   BasicHashtable<mtClass>::free_entry(entry);
 }
 
-const int _resize_load_trigger = 5;       // load factor that will trigger the resize
-
 bool Dictionary::does_any_dictionary_needs_resizing() {
   return Dictionary::_some_dictionary_needs_resizing;
 }
 
 void Dictionary::check_if_needs_resize() {
   if (_resizable == true) {
-    if (number_of_entries() > (_resize_load_trigger*table_size())) {
+    if (number_of_entries() > (DictionaryResizeLoadFactor * table_size())) {
       _needs_resizing = true;
       Dictionary::_some_dictionary_needs_resizing = true;
     }
@@ -118,7 +117,11 @@ bool Dictionary::resize_if_needed() {
   if (_needs_resizing == true) {
     desired_size = calculate_resize(false);
     assert(desired_size != 0, "bug in calculate_resize");
-    if (desired_size == table_size()) {
+    if (desired_size <= table_size()) {
+      // Outgrown the small table sizes, continue with the large ones
+      desired_size = calculate_resize(true);
+    }
+    if (desired_size <= table_size()) {
       _resizable = false; // hit max
     } else {
       if (!resize(desired_size)) {
@@ -489,11 +492,30 @@ void SymbolPropertyEntry::set_method_type(oop p) {
   _method_type = OopHandle(Universe::vm_global(), p);
 }
 
+oop SymbolPropertyEntry::member_name() const {
+  return _member_name.resolve();
+}
+
+oop SymbolPropertyEntry::appendix() const {
+  return _appendix.resolve();
+}
+
+// Readers that see the MemberName also see the appendix.
+void SymbolPropertyEntry::set_invoker(oop member_name, oop appendix) {
+  if (appendix != NULL) {
+    _appendix = OopHandle(Universe::vm_global(), appendix);
+  }
+  OrderAccess::release();
+  _member_name = OopHandle(Universe::vm_global(), member_name);
+}
+
 void SymbolPropertyEntry::free_entry() {
   // decrement Symbol refcount here because hashtable doesn't.
   literal()->decrement_refcount();
-  // Free OopHandle
+  // Free OopHandles
   _method_type.release(Universe::vm_global());
+  _member_name.release(Universe::vm_global());
+  _appendix.release(Universe::vm_global());
 }
 
 void SymbolPropertyEntry::print_entry(outputStream* st) const {
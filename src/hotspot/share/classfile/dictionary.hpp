@@ -160,6 +160,8 @@ class SymbolPropertyEntry : public HashtableEntry<Symbol*, mtSymbol> {
   intptr_t _symbol_mode;  // secondary key
   Method*   _method;
   OopHandle _method_type;
+  OopHandle _member_name;  // cached invoker linkage
+  OopHandle _appendix;
 
  public:
   Symbol* symbol() const            { return literal(); }
@@ -176,6 +178,12 @@ class SymbolPropertyEntry : public HashtableEntry<Symbol*, mtSymbol> {
   // We need to clear the OopHandle because these hashtable entries are not constructed properly.
   void clear_method_type() { _method_type = OopHandle(); }
 
+  // The MemberName and appendix returned by MethodHandleNatives::linkMethod.
+  oop      member_name() const;
+  oop      appendix() const;
+  void set_invoker(oop member_name, oop appendix);
+  void clear_invoker()     { _member_name = OopHandle(); _appendix = OopHandle(); }
+
   void free_entry();
 
   SymbolPropertyEntry* next() const {
@@ -214,6 +222,7 @@ private:
     entry->set_symbol_mode(symbol_mode);
     entry->set_method(NULL);
     entry->clear_method_type();
+    entry->clear_invoker();
     return entry;
   }
 
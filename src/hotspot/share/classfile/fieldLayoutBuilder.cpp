@@ -26,6 +26,8 @@
 #include "jvm.h"
 #include "classfile/classFileParser.hpp"
 #include "classfile/fieldLayoutBuilder.hpp"
+#include "classfile/symbolTable.hpp"
+#include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/array.hpp"
 #include "oops/fieldStreams.inline.hpp"
@@ -33,6 +35,9 @@
 #include "oops/instanceKlass.inline.hpp"
 #include "oops/klass.inline.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
+#include "runtime/os.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/resourceHash.hpp"
 
 
 LayoutRawBlock::LayoutRawBlock(Kind kind, int size) :
@@ -506,6 +511,7 @@ FieldLayoutBuilder::FieldLayoutBuilder(const Symbol* classname, const InstanceKl
   _fields(fields),
   _info(info),
   _root_group(NULL),
+  _hot_group(NULL),
   _contended_groups(GrowableArray<FieldGroup*>(8)),
   _static_fields(NULL),
   _layout(NULL),
@@ -539,6 +545,62 @@ void FieldLayoutBuilder::prologue() {
   _static_layout->initialize_static_layout();
   _static_fields = new FieldGroup();
   _root_group = new FieldGroup();
+  _hot_group = new FieldGroup();
+}
+
+// Hot fields read from FieldLayoutHotFields, by class name.
+typedef ResourceHashtable<const Symbol*, GrowableArrayCHeap<Symbol*, mtClass>*,
+                          primitive_hash<const Symbol*>, primitive_equals<const Symbol*>,
+                          1009, ResourceObj::C_HEAP, mtClass> HotFieldsTable;
+static HotFieldsTable* _hot_fields = NULL;
+
+void FieldLayoutBuilder::load_hot_fields() {
+  if (FieldLayoutHotFields == NULL) {
+    return;
+  }
+  FILE* file = os::fopen(FieldLayoutHotFields, "r");
+  if (file == NULL) {
+    log_warning(class, load)("Unable to open hot field list %s", FieldLayoutHotFields);
+    return;
+  }
+  _hot_fields = new (ResourceObj::C_HEAP, mtClass) HotFieldsTable();
+  int count = 0;
+  char line[JVM_MAXPATHLEN];
+  while (fgets(line, sizeof(line), file) != NULL) {
+    if (line[0] == '#') {
+      continue;
+    }
+    // <class name> <field name>
+    char* class_name = line + strspn(line, " \t");
+    size_t class_len = strcspn(class_name, " \t\r\n");
+    char* field_name = class_name + class_len;
+    field_name += strspn(field_name, " \t");
+    size_t field_len = strcspn(field_name, " \t\r\n");
+    if (class_len == 0 || field_len == 0) {
+      continue;
+    }
+    class_name[class_len] = '\0';
+    field_name[field_len] = '\0';
+    Symbol* klass = SymbolTable::new_permanent_symbol(class_name);
+    Symbol* field = SymbolTable::new_permanent_symbol(field_name);
+    bool created;
+    GrowableArrayCHeap<Symbol*, mtClass>** fields = _hot_fields->put_if_absent(klass, NULL, &created);
+    if (*fields == NULL) {
+      *fields = new GrowableArrayCHeap<Symbol*, mtClass>(4);
+    }
+    (*fields)->append_if_missing(field);
+    count++;
+  }
+  fclose(file);
+  log_info(class, load)("Read %d hot fields from %s", count, FieldLayoutHotFields);
+}
+
+bool FieldLayoutBuilder::is_hot_field(Symbol* name) const {
+  if (_hot_fields == NULL) {
+    return false;
+  }
+  GrowableArrayCHeap<Symbol*, mtClass>** fields = _hot_fields->get(_classname);
+  return fields != NULL && (*fields)->contains(name);
 }
 
 // Field sorting for regular classes:
@@ -561,6 +623,8 @@ void FieldLayoutBuilder::regular_field_sorting() {
         } else {
           group = get_or_create_contended_group(g);
         }
+      } else if (is_hot_field(fs.name())) {
+        group = _hot_group;
       } else {
         group = _root_group;
       }
@@ -587,6 +651,7 @@ void FieldLayoutBuilder::regular_field_sorting() {
         fatal("Something wrong?");
     }
   }
+  _hot_group->sort_by_size();
   _root_group->sort_by_size();
   _static_fields->sort_by_size();
   if (!_contended_groups.is_empty()) {
@@ -605,6 +670,8 @@ void FieldLayoutBuilder::insert_contended_padding(LayoutRawBlock* slot) {
 
 // Computation of regular classes layout is an evolution of the previous default layout
 // (FieldAllocationStyle 1):
+//   - fields listed in FieldLayoutHotFields are allocated first, so that they
+//     share the first cache line(s) of the object
 //   - primitive fields are allocated first (from the biggest to the smallest)
 //   - then oop fields are allocated, either in existing gaps or at the end of
 //     the layout
@@ -620,6 +687,8 @@ void FieldLayoutBuilder::compute_regular_layout() {
     insert_contended_padding(_layout->start());
     need_tail_padding = true;
   }
+  _layout->add(_hot_group->primitive_fields());
+  _layout->add(_hot_group->oop_fields());
   _layout->add(_root_group->primitive_fields());
   _layout->add(_root_group->oop_fields());
 
@@ -656,6 +725,13 @@ void FieldLayoutBuilder::epilogue() {
     _super_klass->nonstatic_oop_map_count());
   }
 
+  if (_hot_group->oop_fields() != NULL) {
+    for (int i = 0; i < _hot_group->oop_fields()->length(); i++) {
+      LayoutRawBlock* b = _hot_group->oop_fields()->at(i);
+      nonstatic_oop_maps->add(b->offset(), 1);
+    }
+  }
+
   if (_root_group->oop_fields() != NULL) {
     for (int i = 0; i < _root_group->oop_fields()->length(); i++) {
       LayoutRawBlock* b = _root_group->oop_fields()->at(i);
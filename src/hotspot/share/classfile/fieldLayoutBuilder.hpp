@@ -233,6 +233,7 @@ class FieldLayoutBuilder : public ResourceObj {
   Array<u2>* _fields;
   FieldLayoutInfo* _info;
   FieldGroup* _root_group;
+  FieldGroup* _hot_group;     // fields listed in FieldLayoutHotFields
   GrowableArray<FieldGroup*> _contended_groups;
   FieldGroup* _static_fields;
   FieldLayout* _layout;
@@ -255,11 +256,15 @@ class FieldLayoutBuilder : public ResourceObj {
   void compute_regular_layout();
   void insert_contended_padding(LayoutRawBlock* slot);
 
+  // Reads FieldLayoutHotFields, called during VM initialization.
+  static void load_hot_fields();
+
  private:
   void prologue();
   void epilogue();
   void regular_field_sorting();
   FieldGroup* get_or_create_contended_group(int g);
+  bool is_hot_field(Symbol* name) const;
 };
 
 #endif // SHARE_CLASSFILE_FIELDLAYOUTBUILDER_HPP
@@ -46,6 +46,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/timerTrace.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
@@ -197,6 +198,14 @@ class StringTableLookupOop : public StackObj {
   }
 };
 
+// A thread that just interned a string does one range of an ongoing grow, so
+// that a burst of interning is not held up waiting for the service thread.
+static void help_grow(Thread* current) {
+  if (current->is_Java_thread() && !SafepointSynchronize::is_at_safepoint()) {
+    _local_table->help_grow(current);
+  }
+}
+
 static size_t ceil_log2(size_t val) {
   size_t ret;
   for (ret = 1; ((size_t)1 << ret) < val; ++ret);
@@ -366,6 +375,7 @@ oop StringTable::do_intern(Handle string_or_null_h, const jchar* name,
     // The hash table takes ownership of the WeakHandle, even if it's not inserted.
     if (_local_table->insert(THREAD, lookup, wh, &rehash_warning)) {
       update_needs_rehash(rehash_warning);
+      help_grow(THREAD);
       return wh.resolve();
     }
     // In case another thread did a concurrent add, return value already in the table.
@@ -379,7 +389,8 @@ oop StringTable::do_intern(Handle string_or_null_h, const jchar* name,
 
 // Concurrent work
 void StringTable::grow(JavaThread* jt) {
-  StringTableHash::GrowTask gt(_local_table);
+  // Threads adding new entries help with the grow, see help_grow().
+  StringTableHash::GrowTask gt(_local_table, true /* is_mt */);
   if (!gt.prepare(jt)) {
     return;
   }
@@ -777,9 +788,44 @@ void StringTable::serialize_shared_table_header(SerializeClosure* soc) {
   if (soc->writing()) {
     // Sanity. Make sure we don't use the shared table at dump time
     _shared_table.reset();
-  } else if (!HeapShared::closed_archive_heap_region_mapped()) {
+  } else if (!HeapShared::are_archived_strings_available()) {
     _shared_table.reset();
   }
 }
 
+class SharedStringCollector : StackObj {
+  Thread* _thread;
+  GrowableArray<Handle>* _strings;
+ public:
+  SharedStringCollector(Thread* thread, GrowableArray<Handle>* strings) :
+    _thread(thread), _strings(strings) {}
+  void do_value(oop s) {
+    _strings->append(Handle(_thread, s));
+  }
+};
+
+// The shared table refers to the archived strings by their dump time
+// addresses. That is fine for mapped archived heap regions, which are never
+// moved, but loaded strings are ordinary heap objects that the GC may move
+// or free. Move them into the regular table, which the GC keeps up to date.
+void StringTable::transfer_shared_strings_to_table(TRAPS) {
+  assert(HeapShared::is_loaded(), "only needed for loaded archived heap objects");
+  ResourceMark rm(THREAD);
+  HandleMark hm(THREAD);
+  GrowableArray<Handle> strings((int)_shared_table.entry_count());
+  SharedStringCollector collector(THREAD, &strings);
+  _shared_table.iterate(&collector);
+  _shared_table.reset();
+
+  for (int i = 0; i < strings.length(); i++) {
+    ResourceMark rm2(THREAD);
+    Handle s = strings.at(i);
+    int length;
+    jchar* chars = java_lang_String::as_unicode_string(s(), length, CHECK);
+    oop result = intern(s, chars, length, CHECK);
+    assert(result == s(), "archived strings must be unique");
+  }
+  log_info(cds)("Transferred %d loaded archived strings to the string table", strings.length());
+}
+
 #endif //INCLUDE_CDS_JAVA_HEAP
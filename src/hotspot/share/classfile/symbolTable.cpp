@@ -36,6 +36,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/timerTrace.hpp"
 #include "services/diagnosticCommand.hpp"
 #include "utilities/concurrentHashTable.inline.hpp"
@@ -154,6 +155,14 @@ public:
   }
 };
 
+// A thread that just added a symbol does one range of an ongoing grow, so
+// that a burst of additions is not held up waiting for the service thread.
+static void help_grow(Thread* current) {
+  if (current->is_Java_thread() && !SafepointSynchronize::is_at_safepoint()) {
+    _local_table->help_grow(current);
+  }
+}
+
 static size_t ceil_log2(size_t value) {
   size_t ret;
   for (ret = 1; ((size_t)1 << ret) < value; ++ret);
@@ -329,12 +338,69 @@ Symbol* SymbolTable::lookup_common(const char* name,
   return sym;
 }
 
+SymbolLookupCache::SymbolLookupCache() {
+  for (uint i = 0; i < CacheSize; i++) {
+    _entries[i] = NULL;
+  }
+}
+
+SymbolLookupCache::~SymbolLookupCache() {
+  for (uint i = 0; i < CacheSize; i++) {
+    if (_entries[i] != NULL) {
+      _entries[i]->decrement_refcount();
+    }
+  }
+}
+
+Symbol* SymbolLookupCache::lookup(const char* name, int len, uintx hash) const {
+  Symbol* sym = _entries[index_for(hash)];
+  if (sym != NULL && sym->equals(name, len)) {
+    // The reference held by the cache keeps the symbol alive.
+    sym->increment_refcount();
+    return sym;
+  }
+  return NULL;
+}
+
+void SymbolLookupCache::add(Symbol* sym, uintx hash) {
+  Symbol** entry = &_entries[index_for(hash)];
+  if (*entry == sym) {
+    return;
+  }
+  sym->increment_refcount();
+  if (*entry != NULL) {
+    (*entry)->decrement_refcount();
+  }
+  *entry = sym;
+}
+
+static SymbolLookupCache* symbol_lookup_cache() {
+  Thread* current = Thread::current();
+  SymbolLookupCache* cache = current->symbol_lookup_cache();
+  if (cache == NULL) {
+    cache = new SymbolLookupCache();
+    current->set_symbol_lookup_cache(cache);
+  }
+  return cache;
+}
+
 Symbol* SymbolTable::new_symbol(const char* name, int len) {
   unsigned int hash = hash_symbol(name, len, _alt_hash);
+  SymbolLookupCache* cache = NULL;
+  if (UseSymbolLookupCache) {
+    cache = symbol_lookup_cache();
+    Symbol* sym = cache->lookup(name, len, hash);
+    if (sym != NULL) {
+      return sym;
+    }
+  }
   Symbol* sym = lookup_common(name, len, hash);
   if (sym == NULL) {
     sym = do_add_if_needed(name, len, hash, true);
   }
+  if (cache != NULL) {
+    cache->add(sym, hash);
+  }
   assert(sym->refcount() != 0, "lookup should have incremented the count");
   assert(sym->equals(name, len), "symbol must be properly initialized");
   return sym;
@@ -410,6 +476,48 @@ Symbol* SymbolTable::do_lookup(const char* name, int len, uintx hash) {
   return sym;
 }
 
+class SymbolTableBulkLookup : StackObj {
+private:
+  int* _pending;
+  const char** _names;
+  int* _lengths;
+  unsigned int* _hashValues;
+public:
+  SymbolTableBulkLookup(int* pending, const char** names, int* lengths, unsigned int* hashValues)
+  : _pending(pending), _names(names), _lengths(lengths), _hashValues(hashValues) {}
+  uintx get_hash(size_t i) const {
+    return _hashValues[_pending[i]];
+  }
+  bool equals(size_t i, Symbol** value, bool* is_dead) {
+    int n = _pending[i];
+    SymbolTableLookup lookup(_names[n], _lengths[n], _hashValues[n]);
+    return lookup.equals(value, is_dead);
+  }
+};
+
+class SymbolTableBulkGet : public StackObj {
+  int* _pending;
+  Symbol** _syms;
+public:
+  SymbolTableBulkGet(int* pending, Symbol** syms) : _pending(pending), _syms(syms) {}
+  void operator()(size_t i, Symbol** value) {
+    assert(value != NULL, "expected valid value");
+    assert(*value != NULL, "value should point to a symbol");
+    _syms[_pending[i]] = *value;
+  }
+};
+
+// Looks up names[pending[0..count-1]] in the local table with a single bulk
+// get and stores the symbols found into syms.
+void SymbolTable::do_lookup_bulk(int count, int* pending, const char** names, int* lengths,
+                                 unsigned int* hashValues, Symbol** syms) {
+  SymbolTableBulkLookup lookup(pending, names, lengths, hashValues);
+  SymbolTableBulkGet stg(pending, syms);
+  bool rehash_warning = false;
+  _local_table->get_bulk(Thread::current(), lookup, (size_t)count, stg, &rehash_warning);
+  update_needs_rehash(rehash_warning);
+}
+
 Symbol* SymbolTable::lookup_only(const char* name, int len, unsigned int& hash) {
   hash = hash_symbol(name, len, _alt_hash);
   return lookup_common(name, len, hash);
@@ -466,6 +574,58 @@ void SymbolTable::new_symbols(ClassLoaderData* loader_data, const constantPoolHa
   }
 }
 
+void SymbolTable::lookup_or_new_symbols(ClassLoaderData* loader_data, const constantPoolHandle& cp,
+                                        int names_count, const char** names, int* lengths,
+                                        int* cp_indices) {
+  assert(names_count <= symbol_alloc_batch_size, "too many names");
+  unsigned int hashValues[symbol_alloc_batch_size];
+  Symbol* syms[symbol_alloc_batch_size];
+  int pending[symbol_alloc_batch_size];
+  int pending_count = 0;
+
+  // Same search order as lookup_common(), but all names that need the local
+  // table are looked up together.
+  bool shared_first = _lookup_shared_first;
+  for (int i = 0; i < names_count; i++) {
+    hashValues[i] = hash_symbol(names[i], lengths[i], _alt_hash);
+    syms[i] = shared_first ? lookup_shared(names[i], lengths[i], hashValues[i]) : NULL;
+    if (syms[i] == NULL) {
+      pending[pending_count++] = i;
+    }
+  }
+  if (pending_count > 0) {
+    if (shared_first) {
+      _lookup_shared_first = false;
+    }
+    do_lookup_bulk(pending_count, pending, names, lengths, hashValues, syms);
+  }
+
+  const char* new_names[symbol_alloc_batch_size];
+  int new_lengths[symbol_alloc_batch_size];
+  int new_indices[symbol_alloc_batch_size];
+  unsigned int new_hashValues[symbol_alloc_batch_size];
+  int new_count = 0;
+  for (int i = 0; i < names_count; i++) {
+    if (syms[i] == NULL && !shared_first) {
+      syms[i] = lookup_shared(names[i], lengths[i], hashValues[i]);
+      if (syms[i] != NULL) {
+        _lookup_shared_first = true;
+      }
+    }
+    if (syms[i] != NULL) {
+      cp->symbol_at_put(cp_indices[i], syms[i]);
+    } else {
+      new_names[new_count] = names[i];
+      new_lengths[new_count] = lengths[i];
+      new_indices[new_count] = cp_indices[i];
+      new_hashValues[new_count++] = hashValues[i];
+    }
+  }
+  if (new_count > 0) {
+    new_symbols(loader_data, cp, new_count, new_names, new_lengths, new_indices, new_hashValues);
+  }
+}
+
 Symbol* SymbolTable::do_add_if_needed(const char* name, int len, uintx hash, bool heap) {
   SymbolTableLookup lookup(name, len, hash);
   SymbolTableGet stg;
@@ -478,6 +638,7 @@ Symbol* SymbolTable::do_add_if_needed(const char* name, int len, uintx hash, boo
     // Callers have looked up the symbol once, insert the symbol.
     sym = allocate_symbol(name, len, heap);
     if (_local_table->insert(current, lookup, sym, &rehash_warning, &clean_hint)) {
+      help_grow(current);
       break;
     }
     // In case another thread did a concurrent add, return value already in the table.
@@ -637,7 +798,8 @@ void SymbolTable::serialize_shared_table_header(SerializeClosure* soc,
 
 // Concurrent work
 void SymbolTable::grow(JavaThread* jt) {
-  SymbolTableHash::GrowTask gt(_local_table);
+  // Threads adding new entries help with the grow, see help_grow().
+  SymbolTableHash::GrowTask gt(_local_table, true /* is_mt */);
   if (!gt.prepare(jt)) {
     return;
   }
@@ -86,6 +86,26 @@ public:
   operator Symbol*()                             { return _temp; }
 };
 
+// A small direct-mapped cache of the symbols a thread looked up recently,
+// used by SymbolTable::new_symbol() when UseSymbolLookupCache is set. Every
+// cached symbol holds a reference, so it stays in the SymbolTable while it
+// is in the cache. The cache is only accessed by its owning thread.
+class SymbolLookupCache : public CHeapObj<mtSymbol> {
+  static const uint CacheSize = 64;
+  Symbol* _entries[CacheSize];
+
+  static uint index_for(uintx hash) { return (uint)(hash & (CacheSize - 1)); }
+
+ public:
+  SymbolLookupCache();
+  ~SymbolLookupCache();
+
+  // Returns the cached symbol with the given name, with its refcount
+  // incremented, or NULL.
+  Symbol* lookup(const char* name, int len, uintx hash) const;
+  void add(Symbol* sym, uintx hash);
+};
+
 class CompactHashtableWriter;
 class SerializeClosure;
 
@@ -126,6 +146,8 @@ class SymbolTable : public AllStatic {
 
   static Symbol* allocate_symbol(const char* name, int len, bool c_heap); // Assumes no characters larger than 0x7F
   static Symbol* do_lookup(const char* name, int len, uintx hash);
+  static void do_lookup_bulk(int count, int* pending, const char** names, int* lengths,
+                             unsigned int* hashValues, Symbol** syms);
   static Symbol* do_add_if_needed(const char* name, int len, uintx hash, bool heap);
 
   // lookup only, won't add. Also calculate hash. Used by the ClassfileParser.
@@ -138,6 +160,12 @@ class SymbolTable : public AllStatic {
                           const char** name, int* lengths,
                           int* cp_indices, unsigned int* hashValues);
 
+  // Lookup or add a batch of at most symbol_alloc_batch_size names. Used by
+  // the ClassfileParser.
+  static void lookup_or_new_symbols(ClassLoaderData* loader_data,
+                                    const constantPoolHandle& cp, int names_count,
+                                    const char** names, int* lengths, int* cp_indices);
+
   static Symbol* lookup_shared(const char* name, int len, unsigned int hash) NOT_CDS_RETURN_(NULL);
   static Symbol* lookup_dynamic(const char* name, int len, unsigned int hash);
   static Symbol* lookup_common(const char* name, int len, unsigned int hash);
@@ -73,6 +73,7 @@
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/orderAccess.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
 #include "services/classLoadingService.hpp"
@@ -2089,6 +2090,27 @@ Method* SystemDictionary::find_method_handle_invoker(Klass* klass,
                                                           Handle *appendix_result,
                                                           TRAPS) {
   assert(THREAD->can_call_java() ,"");
+
+  // The invoker and appendix linked for an invokeExact, invoke or VarHandle
+  // access mode only depend on the name and the MethodType. When the
+  // MethodType is cached globally, so is the linkage. The name is used as
+  // the secondary key; like klass it belongs to a boot class that is never
+  // unloaded, and as an address it can't collide with an intrinsic id.
+  intptr_t invoker_mode = (intptr_t)name;
+  unsigned int invoker_hash = invoke_method_table()->compute_hash(signature, invoker_mode);
+  int invoker_index = invoke_method_table()->hash_to_index(invoker_hash);
+  if (CacheMethodHandleInvokers) {
+    SymbolPropertyEntry* spe = invoke_method_table()->find_entry(invoker_index, invoker_hash, signature, invoker_mode);
+    if (spe != NULL && spe->member_name() != NULL) {
+      OrderAccess::acquire(); // See SymbolPropertyEntry::set_invoker.
+      methodHandle m(THREAD, java_lang_invoke_MemberName::vmtarget(spe->member_name()));
+      (*appendix_result) = Handle(THREAD, spe->appendix());
+      // As in unpack_method_and_appendix.
+      accessing_klass->class_loader_data()->record_dependency(m->method_holder());
+      return m();
+    }
+  }
+
   Handle method_type =
     SystemDictionary::find_method_handle_type(signature, accessing_klass, CHECK_NULL);
 
@@ -2118,7 +2140,26 @@ Method* SystemDictionary::find_method_handle_invoker(Klass* klass,
                          vmSymbols::linkMethod_signature(),
                          &args, CHECK_NULL);
   Handle mname(THREAD, result.get_oop());
-  return unpack_method_and_appendix(mname, accessing_klass, appendix_box, appendix_result, THREAD);
+  Method* m = unpack_method_and_appendix(mname, accessing_klass, appendix_box, appendix_result, CHECK_NULL);
+
+  if (CacheMethodHandleInvokers) {
+    int null_iid = vmIntrinsics::as_int(vmIntrinsics::_none);
+    unsigned int hash = invoke_method_table()->compute_hash(signature, null_iid);
+    int index = invoke_method_table()->hash_to_index(hash);
+    MutexLocker ml(THREAD, SystemDictionary_lock);
+    SymbolPropertyEntry* mt_spe = invoke_method_table()->find_entry(index, hash, signature, null_iid);
+    if (mt_spe != NULL && mt_spe->method_type() == method_type()) {
+      SymbolPropertyEntry* spe = invoke_method_table()->find_entry(invoker_index, invoker_hash, signature, invoker_mode);
+      if (spe == NULL) {
+        spe = invoke_method_table()->add_entry(invoker_index, invoker_hash, signature, invoker_mode);
+      }
+      if (spe->member_name() == NULL) {
+        // The MemberName keeps the invoker's (possibly hidden) class alive.
+        spe->set_invoker(mname(), (*appendix_result)());
+      }
+    }
+  }
+  return m;
 }
 
 // Decide if we can globally cache a lookup of this class, to be returned to any client that asks.
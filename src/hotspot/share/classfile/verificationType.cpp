@@ -119,8 +119,23 @@ bool VerificationType::is_reference_assignable_from(
       }
     }
 
-    return resolve_and_check_assignability(klass, name(), from.name(),
-          from_field_is_protected, from.is_array(), from.is_object(), THREAD);
+    if (!VerifierCacheAssignability) {
+      return resolve_and_check_assignability(klass, name(), from.name(),
+            from_field_is_protected, from.is_array(), from.is_object(), THREAD);
+    }
+
+    // The classes resolved for a given pair of names cannot change while
+    // the current class is being verified, so a successful check holds for
+    // the rest of the verification.
+    if (context->is_cached_assignable(name(), from.name(), from_field_is_protected)) {
+      return true;
+    }
+    bool assignable = resolve_and_check_assignability(klass, name(), from.name(),
+          from_field_is_protected, from.is_array(), from.is_object(), CHECK_false);
+    if (assignable) {
+      context->cache_assignable(name(), from.name(), from_field_is_protected);
+    }
+    return assignable;
   } else if (is_array() && from.is_array()) {
     VerificationType comp_this = get_component(context);
     VerificationType comp_from = from.get_component(context);
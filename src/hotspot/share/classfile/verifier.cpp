@@ -596,6 +596,11 @@ ClassVerifier::ClassVerifier(JavaThread* current, InstanceKlass* klass)
     : _thread(current), _previous_symbol(NULL), _symbols(NULL), _exception_type(NULL),
       _message(NULL), _method_signatures_table(NULL), _klass(klass) {
   _this_type = VerificationType::reference_type(klass->name());
+  for (int i = 0; i < assignable_cache_size; i++) {
+    _assignable_cache[i]._target = NULL;
+    _assignable_cache[i]._from = NULL;
+    _assignable_cache[i]._from_field_is_protected = false;
+  }
 }
 
 ClassVerifier::~ClassVerifier() {
@@ -290,6 +290,21 @@ class ClassVerifier : public StackObj {
 
   ErrorContext _error_context;  // contains information about an error
 
+  // Direct-mapped cache of reference assignability checks that succeeded
+  // while verifying this class (see VerifierCacheAssignability).
+  class AssignableEntry {
+   public:
+    Symbol* _target;
+    Symbol* _from;
+    bool    _from_field_is_protected;
+  };
+  static const int assignable_cache_size = 64;
+  AssignableEntry _assignable_cache[assignable_cache_size];
+
+  static int assignable_cache_index(Symbol* target, Symbol* from) {
+    return (int)((((uintptr_t)target >> 3) ^ ((uintptr_t)from >> 4)) % assignable_cache_size);
+  }
+
   void verify_method(const methodHandle& method, TRAPS);
   char* generate_code_data(const methodHandle& m, u4 code_length, TRAPS);
   void verify_exception_handler_table(u4 code_length, char* code_data,
@@ -453,6 +468,18 @@ class ClassVerifier : public StackObj {
     return VerificationType::reference_type(cp->klass_name_at(index));
   }
 
+  bool is_cached_assignable(Symbol* target, Symbol* from, bool from_field_is_protected) const {
+    const AssignableEntry& e = _assignable_cache[assignable_cache_index(target, from)];
+    return e._target == target && e._from == from &&
+           e._from_field_is_protected == from_field_is_protected;
+  }
+  void cache_assignable(Symbol* target, Symbol* from, bool from_field_is_protected) {
+    AssignableEntry& e = _assignable_cache[assignable_cache_index(target, from)];
+    e._target = target;
+    e._from = from;
+    e._from_field_is_protected = from_field_is_protected;
+  }
+
   // Keep a list of temporary symbols created during verification because
   // their reference counts need to be decremented when the verifier object
   // goes out of scope.  Since these symbols escape the scope in which they're
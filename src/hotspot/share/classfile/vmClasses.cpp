@@ -27,6 +27,7 @@
 #include "classfile/classLoader.hpp"
 #include "classfile/classLoaderData.hpp"
 #include "classfile/dictionary.hpp"
+#include "classfile/stringTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
@@ -160,6 +161,13 @@ void vmClasses::resolve_all(TRAPS) {
   java_lang_String::compute_offsets();
   java_lang_Class::compute_offsets();
 
+#if INCLUDE_CDS_JAVA_HEAP
+  if (HeapShared::is_loaded()) {
+    // Needs the String offsets. Must be done before strings are interned.
+    StringTable::transfer_shared_strings_to_table(CHECK);
+  }
+#endif
+
   // Fixup mirrors for classes loaded before java.lang.Class.
   Universe::initialize_basic_type_mirrors(CHECK);
   Universe::fixup_mirrors(CHECK);
@@ -460,6 +460,14 @@ bool vmIntrinsics::disabled_by_jvm_flags(vmIntrinsics::ID id) {
   case vmIntrinsics::_vectorizedMismatch:
     if (!UseVectorizedMismatchIntrinsic) return true;
     break;
+  case vmIntrinsics::_hashCodeL:
+  case vmIntrinsics::_hashCodeU:
+  case vmIntrinsics::_hashCodeB:
+  case vmIntrinsics::_hashCodeC:
+  case vmIntrinsics::_hashCodeS:
+  case vmIntrinsics::_hashCodeI:
+    if (!UseVectorizedHashCodeIntrinsic) return true;
+    break;
   case vmIntrinsics::_updateBytesAdler32:
   case vmIntrinsics::_updateByteBufferAdler32:
     if (!UseAdler32Intrinsics) return true;
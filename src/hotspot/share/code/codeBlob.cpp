@@ -197,6 +197,7 @@ void RuntimeBlob::trace_new_stub(RuntimeBlob* stub, const char* name1, const cha
       tty->cr();
     }
     Forte::register_stub(stub_id, stub->code_begin(), stub->code_end());
+    LINUX_ONLY(CodeCache::record_in_perf_map(stub, stub_id);)
 
     if (JvmtiExport::should_post_dynamic_code_generated()) {
       const char* stub_name = name2;
@@ -240,6 +241,7 @@ BufferBlob* BufferBlob::create(const char* name, int buffer_size) {
     MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
     blob = new (size) BufferBlob(name, size);
   }
+  LINUX_ONLY(CodeCache::record_in_perf_map(blob);)
   // Track memory usage statistic after releasing CodeCache_lock
   MemoryService::track_code_cache_memory_usage();
 
@@ -261,6 +263,7 @@ BufferBlob* BufferBlob::create(const char* name, CodeBuffer* cb) {
     MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
     blob = new (size) BufferBlob(name, size, cb);
   }
+  LINUX_ONLY(CodeCache::record_in_perf_map(blob);)
   // Track memory usage statistic after releasing CodeCache_lock
   MemoryService::track_code_cache_memory_usage();
 
@@ -301,6 +304,7 @@ AdapterBlob* AdapterBlob::create(CodeBuffer* cb) {
     MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
     blob = new (size) AdapterBlob(size, cb);
   }
+  LINUX_ONLY(CodeCache::record_in_perf_map(blob);)
   // Track memory usage statistic after releasing CodeCache_lock
   MemoryService::track_code_cache_memory_usage();
 
@@ -347,6 +351,7 @@ VtableBlob* VtableBlob::create(const char* name, int buffer_size) {
     blob = new (size) VtableBlob(name, size);
     CodeCache_lock->unlock();
   }
+  LINUX_ONLY(CodeCache::record_in_perf_map(blob);)
   // Track memory usage statistic after releasing CodeCache_lock
   MemoryService::track_code_cache_memory_usage();
 
@@ -371,6 +376,7 @@ MethodHandlesAdapterBlob* MethodHandlesAdapterBlob::create(int buffer_size) {
       vm_exit_out_of_memory(size, OOM_MALLOC_ERROR, "CodeCache: no room for method handle adapter blob");
     }
   }
+  LINUX_ONLY(CodeCache::record_in_perf_map(blob);)
   // Track memory usage statistic after releasing CodeCache_lock
   MemoryService::track_code_cache_memory_usage();
 
@@ -731,6 +737,7 @@ OptimizedEntryBlob* OptimizedEntryBlob::create(const char* name, CodeBuffer* cb,
     MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
     blob = new (size) OptimizedEntryBlob(name, size, cb, exception_handler_offset, receiver, jfa_sp_offset);
   }
+  LINUX_ONLY(CodeCache::record_in_perf_map(blob);)
   // Track memory usage statistic after releasing CodeCache_lock
   MemoryService::track_code_cache_memory_usage();
 
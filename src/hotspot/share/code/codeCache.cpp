@@ -417,13 +417,18 @@ void CodeCache::add_heap(ReservedSpace rs, const char* name, int code_blob_type)
   CodeHeap* heap = new CodeHeap(name, code_blob_type);
   add_heap(heap);
 
-  // Reserve Space
-  size_t size_initial = MIN2((size_t)InitialCodeCacheSize, rs.size());
+  // Reserve Space. With CodeCachePreTouch the heap is committed up front,
+  // so it never has to be expanded with freshly faulted in pages.
+  size_t size_initial = CodeCachePreTouch ? rs.size() : MIN2((size_t)InitialCodeCacheSize, rs.size());
   size_initial = align_up(size_initial, os::vm_page_size());
   if (!heap->reserve(rs, size_initial, CodeCacheSegmentSize)) {
     vm_exit_during_initialization(err_msg("Could not reserve enough space in %s (" SIZE_FORMAT "K)",
                                           heap->name(), size_initial/K));
   }
+  if (CodeCachePreTouch && !AlwaysPreTouch) {
+    // Touch the pages now; AlwaysPreTouch already did it when committing.
+    os::pretouch_memory(heap->low_boundary(), heap->high(), rs.page_size());
+  }
 
   // Register the CodeHeap
   MemoryService::add_code_heap_memory_pool(heap, name);
@@ -964,6 +969,8 @@ void CodeCache::initialize() {
   // This is used on Windows 64 bit platforms to register
   // Structured Exception Handlers for our generated code.
   os::register_code_area((char*)low_bound(), (char*)high_bound());
+
+  LINUX_ONLY(open_perf_map();)
 }
 
 void codeCache_init() {
@@ -1184,20 +1191,25 @@ void CodeCache::flush_dependents_on(InstanceKlass* dependee) {
 
   if (number_of_nmethods_with_dependencies() == 0) return;
 
+  // C-heap allocated, as resource marks may be entered while marking.
+  GrowableArray<nmethod*> marked_nmethods(16, mtCode);
   int marked = 0;
   if (dependee->is_linked()) {
     // Class initialization state change.
     KlassInitDepChange changes(dependee);
+    changes.set_marked_nmethods(&marked_nmethods);
     marked = mark_for_deoptimization(changes);
   } else {
     // New class is loaded.
     NewKlassDepChange changes(dependee);
+    changes.set_marked_nmethods(&marked_nmethods);
     marked = mark_for_deoptimization(changes);
   }
 
   if (marked > 0) {
-    // At least one nmethod has been marked for deoptimization
-    Deoptimization::deoptimize_all_marked();
+    // At least one nmethod has been marked for deoptimization. Only the
+    // marked ones are made not entrant, instead of scanning the code cache.
+    Deoptimization::deoptimize_all_marked(&marked_nmethods);
   }
 }
 
@@ -1582,6 +1594,40 @@ void CodeCache::write_perf_map() {
                 method_name);
   }
 }
+
+// The map file that new code blobs are appended to, see UpdatePerfMap.
+static int _perf_map_fd = -1;
+
+void CodeCache::open_perf_map() {
+  if (!UpdatePerfMap) {
+    return;
+  }
+  char fname[32];
+  jio_snprintf(fname, sizeof(fname), "/tmp/perf-%d.map", os::current_process_id());
+  _perf_map_fd = os::open(fname, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0666);
+  if (_perf_map_fd < 0) {
+    log_warning(codecache)("Failed to create %s for perf map", fname);
+  }
+}
+
+void CodeCache::record_in_perf_map(CodeBlob* cb, const char* name) {
+  if (_perf_map_fd < 0 || cb == NULL) {
+    return;
+  }
+  ResourceMark rm;
+  if (name == NULL) {
+    name = cb->is_compiled() ? cb->as_compiled_method()->method()->external_name()
+                             : cb->name();
+  }
+  stringStream ss;
+  ss.print_cr(INTPTR_FORMAT " " INTPTR_FORMAT " %s",
+              (intptr_t)cb->code_begin(), (intptr_t)cb->code_size(), name);
+  // A single write to the file opened with O_APPEND, so records written
+  // concurrently do not interleave and need no lock.
+  if (os::write(_perf_map_fd, ss.base(), (unsigned int)ss.size()) != ss.size()) {
+    log_debug(codecache)("Failed to append to perf map");
+  }
+}
 #endif // LINUX
 
 //---<  BEGIN  >--- CodeHeap State Analytics.
@@ -125,6 +125,11 @@ void Dependencies::assert_call_site_target_value(ciCallSite* call_site, ciMethod
   assert_common_2(call_site_target_value, call_site, method_handle);
 }
 
+void Dependencies::assert_being_initialized(ciKlass* ctxk) {
+  check_ctxk(ctxk);
+  assert_common_1(being_initialized, ctxk);
+}
+
 #if INCLUDE_JVMCI
 
 Dependencies::Dependencies(Arena* arena, OopRecorder* oop_recorder, CompileLog* log) {
@@ -574,7 +579,8 @@ const char* Dependencies::_dep_name[TYPE_LIMIT] = {
   "unique_concrete_method_2",
   "unique_concrete_method_4",
   "no_finalizable_subclasses",
-  "call_site_target_value"
+  "call_site_target_value",
+  "being_initialized"
 };
 
 int Dependencies::_dep_args[TYPE_LIMIT] = {
@@ -585,7 +591,8 @@ int Dependencies::_dep_args[TYPE_LIMIT] = {
   2, // unique_concrete_method_2 ctxk, m
   4, // unique_concrete_method_4 ctxk, m, resolved_klass, resolved_method
   1, // no_finalizable_subclasses ctxk
-  2  // call_site_target_value call_site, method_handle
+  2, // call_site_target_value call_site, method_handle
+  1  // being_initialized ctxk
 };
 
 const char* Dependencies::dep_name(Dependencies::DepType dept) {
@@ -1905,6 +1912,10 @@ Klass* Dependencies::check_has_no_finalizable_subclasses(InstanceKlass* ctxk, Ne
   return find_finalizable_subclass(search_at);
 }
 
+Klass* Dependencies::check_being_initialized(InstanceKlass* ctxk) {
+  return ctxk->is_initialized() ? ctxk : NULL;
+}
+
 Klass* Dependencies::check_call_site_target_value(oop call_site, oop method_handle, CallSiteDepChange* changes) {
   assert(call_site != NULL, "sanity");
   assert(method_handle != NULL, "sanity");
@@ -1958,6 +1969,9 @@ Klass* Dependencies::DepStream::check_new_klass_dependency(NewKlassDepChange* ch
   case no_finalizable_subclasses:
     witness = check_has_no_finalizable_subclasses(context_type(), changes);
     break;
+  case being_initialized:
+    witness = check_being_initialized(context_type());
+    break;
   default:
     witness = NULL;
     break;
@@ -1970,11 +1984,17 @@ Klass* Dependencies::DepStream::check_klass_init_dependency(KlassInitDepChange*
   assert_locked_or_safepoint(Compile_lock);
   Dependencies::check_valid_dependency_type(type());
 
-  // No new types added. Only unique_concrete_method_4 is sensitive to class initialization changes.
+  // No new types added. Only unique_concrete_method_4 and being_initialized are
+  // sensitive to class initialization changes.
   Klass* witness = NULL;
   switch (type()) {
   case unique_concrete_method_4:
-    witness = check_unique_concrete_method(context_type(), method_argument(1), type_argument(2), method_argument(3), changes);
+    if (UseVtableBasedCHA) {
+      witness = check_unique_concrete_method(context_type(), method_argument(1), type_argument(2), method_argument(3), changes);
+    }
+    break;
+  case being_initialized:
+    witness = check_being_initialized(context_type());
     break;
   default:
     witness = NULL;
@@ -1989,7 +2009,7 @@ Klass* Dependencies::DepStream::check_klass_dependency(KlassDepChange* changes)
   Dependencies::check_valid_dependency_type(type());
 
   if (changes != NULL) {
-    if (UseVtableBasedCHA && changes->is_klass_init_change()) {
+    if (changes->is_klass_init_change()) {
       return check_klass_init_dependency(changes->as_klass_init_change());
     } else {
       return check_new_klass_dependency(changes->as_new_klass_change());
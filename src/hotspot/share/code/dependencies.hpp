@@ -150,6 +150,11 @@ class Dependencies: public ResourceObj {
     // This dependency asserts when the CallSite.target value changed.
     call_site_target_value,
 
+    // This dependency asserts that class CX is not yet fully initialized,
+    // so that code with class initialization barriers for CX is
+    // deoptimized once CX completes its initialization.
+    being_initialized,
+
     TYPE_LIMIT
   };
   enum {
@@ -345,6 +350,7 @@ class Dependencies: public ResourceObj {
   void assert_unique_concrete_method(ciKlass* ctxk, ciMethod* uniqm, ciKlass* resolved_klass, ciMethod* resolved_method);
   void assert_has_no_finalizable_subclasses(ciKlass* ctxk);
   void assert_call_site_target_value(ciCallSite* call_site, ciMethodHandle* method_handle);
+  void assert_being_initialized(ciKlass* ctxk);
 
 #if INCLUDE_JVMCI
  private:
@@ -414,6 +420,7 @@ class Dependencies: public ResourceObj {
   static Klass* check_unique_concrete_method(InstanceKlass* ctxk, Method* uniqm, Klass* resolved_klass, Method* resolved_method, KlassDepChange* changes = NULL);
   static Klass* check_has_no_finalizable_subclasses(InstanceKlass* ctxk, NewKlassDepChange* changes = NULL);
   static Klass* check_call_site_target_value(oop call_site, oop method_handle, CallSiteDepChange* changes = NULL);
+  static Klass* check_being_initialized(InstanceKlass* ctxk);
   // A returned Klass* is NULL if the dependency assertion is still
   // valid.  A non-NULL Klass* is a 'witness' to the assertion
   // failure, a point in the class hierarchy where the assertion has
@@ -665,7 +672,21 @@ class DependencySignature : public ResourceObj {
 
 // Every particular DepChange is a sub-class of this class.
 class DepChange : public StackObj {
+ private:
+  GrowableArray<nmethod*>* _marked_nmethods;
+
  public:
+  DepChange() : _marked_nmethods(NULL) {}
+
+  // Collect the nmethods marked for deoptimization by this change in list,
+  // so that they can be made not entrant without a scan of the code cache.
+  void set_marked_nmethods(GrowableArray<nmethod*>* list) { _marked_nmethods = list; }
+  void record_marked(nmethod* nm) {
+    if (_marked_nmethods != NULL) {
+      _marked_nmethods->append(nm);
+    }
+  }
+
   // What kind of DepChange is this?
   virtual bool is_klass_change()      const { return false; }
   virtual bool is_new_klass_change()  const { return false; }
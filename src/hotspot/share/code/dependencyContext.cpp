@@ -78,6 +78,7 @@ int DependencyContext::mark_dependent_nmethods(DepChange& changes) {
         nm->print_dependencies();
       }
       changes.mark_for_deoptimization(nm);
+      changes.record_marked(nm);
       found++;
     }
   }
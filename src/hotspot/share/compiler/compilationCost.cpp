@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "compiler/compilationCost.hpp"
+#include "compiler/compilerDefinitions.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "runtime/deoptimization.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/timer.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+#if INCLUDE_JFR
+#include "jfr/jfrEvents.hpp"
+#endif
+
+class CompilationCostEntry {
+ public:
+  static const int TIERS = CompLevel_full_optimization + 1;
+
+  jlong _compile_nanos[TIERS];
+  int   _compile_count[TIERS];
+  int   _osr_count;
+  int   _code_size;
+  int   _deopt_count[Deoptimization::Reason_LIMIT];
+
+  CompilationCostEntry() : _osr_count(0), _code_size(0) {
+    for (int i = 0; i < TIERS; i++) {
+      _compile_nanos[i] = 0;
+      _compile_count[i] = 0;
+    }
+    for (int i = 0; i < Deoptimization::Reason_LIMIT; i++) {
+      _deopt_count[i] = 0;
+    }
+  }
+
+  jlong compile_nanos() const {
+    jlong sum = 0;
+    for (int i = 0; i < TIERS; i++) {
+      sum += _compile_nanos[i];
+    }
+    return sum;
+  }
+
+  int compile_count() const {
+    int sum = 0;
+    for (int i = 0; i < TIERS; i++) {
+      sum += _compile_count[i];
+    }
+    return sum;
+  }
+
+  int deopt_count() const {
+    int sum = 0;
+    for (int i = 0; i < Deoptimization::Reason_LIMIT; i++) {
+      sum += _deopt_count[i];
+    }
+    return sum;
+  }
+};
+
+typedef ResourceHashtable<Method*, CompilationCostEntry,
+                          primitive_hash<Method*>, primitive_equals<Method*>,
+                          1009, ResourceObj::C_HEAP, mtCompiler> CompilationCostTable;
+
+static CompilationCostTable* _table = NULL;
+
+static CompilationCostEntry* entry_for(Method* method) {
+  assert_lock_strong(CompilationCost_lock);
+  if (_table == NULL) {
+    _table = new (ResourceObj::C_HEAP, mtCompiler) CompilationCostTable();
+  }
+  bool created;
+  return _table->put_if_absent(method, &created);
+}
+
+void CompilationCost::record_compilation(Method* method, int comp_level, bool is_osr,
+                                         const elapsedTimer& time, int code_size) {
+  assert(CompilationCostAccounting, "must be enabled");
+  if (comp_level <= CompLevel_none || comp_level > CompLevel_full_optimization) {
+    return;
+  }
+  MutexLocker ml(CompilationCost_lock);
+  CompilationCostEntry* entry = entry_for(method);
+  entry->_compile_nanos[comp_level] += (jlong)(time.seconds() * NANOSECS_PER_SEC);
+  entry->_compile_count[comp_level]++;
+  if (is_osr) {
+    entry->_osr_count++;
+  }
+  if (code_size > 0) {
+    entry->_code_size = code_size;
+  }
+}
+
+void CompilationCost::record_deoptimization(Method* method, int reason) {
+  assert(CompilationCostAccounting, "must be enabled");
+  assert(reason >= 0 && reason < Deoptimization::Reason_LIMIT, "invalid reason %d", reason);
+  MutexLocker ml(CompilationCost_lock);
+  entry_for(method)->_deopt_count[reason]++;
+}
+
+void CompilationCost::remove(Method* method) {
+  if (!CompilationCostAccounting) {
+    return;
+  }
+  MutexLocker ml(CompilationCost_lock);
+  if (_table != NULL) {
+    _table->remove(method);
+  }
+}
+
+class CompilationCostRecord {
+ public:
+  Method* _method;
+  CompilationCostEntry _entry;
+
+  CompilationCostRecord() : _method(NULL), _entry() {}
+  CompilationCostRecord(Method* method, const CompilationCostEntry& entry) :
+    _method(method), _entry(entry) {}
+};
+
+class CompilationCostCollector : public StackObj {
+  GrowableArray<CompilationCostRecord>* _records;
+ public:
+  CompilationCostCollector(GrowableArray<CompilationCostRecord>* records) : _records(records) {}
+
+  bool do_entry(Method* const& method, const CompilationCostEntry& entry) {
+    _records->append(CompilationCostRecord(method, entry));
+    return true;
+  }
+};
+
+// Copies the entries into records, in resource memory.
+static void collect(GrowableArray<CompilationCostRecord>* records) {
+  assert_lock_strong(CompilationCost_lock);
+  if (_table != NULL) {
+    CompilationCostCollector collector(records);
+    _table->iterate(&collector);
+  }
+}
+
+static int compare_by_compile_time(CompilationCostRecord* a, CompilationCostRecord* b) {
+  jlong ta = a->_entry.compile_nanos();
+  jlong tb = b->_entry.compile_nanos();
+  return ta > tb ? -1 : (ta < tb ? 1 : 0);
+}
+
+static double nanos_to_millis_double(jlong nanos) {
+  return (double)nanos / NANOSECS_PER_MILLISEC;
+}
+
+void CompilationCost::print_on(outputStream* st, size_t limit) {
+  if (!CompilationCostAccounting) {
+    st->print_cr("Compilation cost accounting is disabled, see -XX:+CompilationCostAccounting");
+    return;
+  }
+  ResourceMark rm;
+  GrowableArray<CompilationCostRecord> records;
+  // The methods are printed under the lock so that they cannot be freed.
+  MutexLocker ml(CompilationCost_lock);
+  collect(&records);
+  records.sort(compare_by_compile_time);
+
+  st->print_cr("Compilation cost of %d methods:", records.length());
+  st->print_cr("  total ms  compiles   osr  tier1 ms  tier2 ms  tier3 ms  tier4 ms  code size  deopts  method");
+  size_t printed = 0;
+  for (int i = 0; i < records.length() && printed < limit; i++, printed++) {
+    const CompilationCostRecord& record = records.at(i);
+    const CompilationCostEntry& entry = record._entry;
+    st->print("%10.3f  %8d  %4d", nanos_to_millis_double(entry.compile_nanos()),
+              entry.compile_count(), entry._osr_count);
+    for (int level = CompLevel_simple; level <= CompLevel_full_optimization; level++) {
+      st->print("  %8.3f", nanos_to_millis_double(entry._compile_nanos[level]));
+    }
+    st->print("  %9d  %6d  ", entry._code_size, entry.deopt_count());
+    record._method->print_short_name(st);
+    st->cr();
+    for (int reason = 0; reason < Deoptimization::Reason_LIMIT; reason++) {
+      if (entry._deopt_count[reason] > 0) {
+        st->print_cr("%*s%s: %d", 20, "", Deoptimization::trap_reason_name(reason),
+                     entry._deopt_count[reason]);
+      }
+    }
+  }
+}
+
+#if INCLUDE_JFR
+// The periodic events are requested by a thread in the VM, so the copied
+// methods cannot be freed before the events are sent.
+
+void CompilationCost::send_cost_events() {
+  if (!CompilationCostAccounting) {
+    return;
+  }
+  ResourceMark rm;
+  GrowableArray<CompilationCostRecord> records;
+  {
+    MutexLocker ml(CompilationCost_lock);
+    collect(&records);
+  }
+  for (int i = 0; i < records.length(); i++) {
+    const CompilationCostRecord& record = records.at(i);
+    const CompilationCostEntry& entry = record._entry;
+    EventMethodCompilationCost event;
+    event.set_method(record._method);
+    event.set_compilations(entry.compile_count());
+    event.set_osrCompilations(entry._osr_count);
+    event.set_tier1Time(entry._compile_nanos[CompLevel_simple]);
+    event.set_tier2Time(entry._compile_nanos[CompLevel_limited_profile]);
+    event.set_tier3Time(entry._compile_nanos[CompLevel_full_profile]);
+    event.set_tier4Time(entry._compile_nanos[CompLevel_full_optimization]);
+    event.set_codeSize(entry._code_size);
+    event.set_deoptimizations(entry.deopt_count());
+    event.commit();
+  }
+}
+
+void CompilationCost::send_deoptimization_events() {
+  if (!CompilationCostAccounting) {
+    return;
+  }
+  ResourceMark rm;
+  GrowableArray<CompilationCostRecord> records;
+  {
+    MutexLocker ml(CompilationCost_lock);
+    collect(&records);
+  }
+  for (int i = 0; i < records.length(); i++) {
+    const CompilationCostRecord& record = records.at(i);
+    for (int reason = 0; reason < Deoptimization::Reason_LIMIT; reason++) {
+      int count = record._entry._deopt_count[reason];
+      if (count > 0) {
+        EventMethodDeoptimizationCount event;
+        event.set_method(record._method);
+        event.set_reason(Deoptimization::trap_reason_name(reason));
+        event.set_count(count);
+        event.commit();
+      }
+    }
+  }
+}
+#endif // INCLUDE_JFR
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_COMPILER_COMPILATIONCOST_HPP
+#define SHARE_COMPILER_COMPILATIONCOST_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/macros.hpp"
+
+class elapsedTimer;
+class Method;
+class outputStream;
+
+// Per-method accounting of the cost of compiling and deoptimizing a method,
+// see CompilationCostAccounting. Compile time and count are kept per tier,
+// deoptimizations per Deoptimization::DeoptReason, so that methods that are
+// repeatedly recompiled after deoptimization storms stand out.
+//
+// The entries are keyed by Method* and removed when the method is freed, so
+// all accesses are done under CompilationCost_lock.
+class CompilationCost : AllStatic {
+ public:
+  // Called by the compiler thread after a compilation of method finished.
+  // code_size is the size of the installed nmethod, or 0 if none was installed.
+  static void record_compilation(Method* method, int comp_level, bool is_osr,
+                                 const elapsedTimer& time, int code_size);
+  // Called by the thread that hit an uncommon trap in the code of method.
+  static void record_deoptimization(Method* method, int reason);
+  // Called when method is freed.
+  static void remove(Method* method);
+
+  // Prints at most limit methods, most expensive to compile first.
+  static void print_on(outputStream* st, size_t limit);
+
+  // Sends one MethodCompilationCost event per recorded method.
+  static void send_cost_events() NOT_JFR_RETURN();
+  // Sends one MethodDeoptimizationCount event per recorded method and
+  // deoptimization reason.
+  static void send_deoptimization_events() NOT_JFR_RETURN();
+};
+
+#endif // SHARE_COMPILER_COMPILATIONCOST_HPP
@@ -40,6 +40,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "runtime/timer.hpp"
 
 #if INCLUDE_JVMCI
 #include "jvmci/jvmci.hpp"
@@ -111,6 +112,38 @@ void CompilationPolicy::compile_if_required(const methodHandle& m, TRAPS) {
   }
 }
 
+void CompilationPolicy::compile_archived_hot_methods(InstanceKlass* ik, TRAPS) {
+  assert(ik->is_shared() && ik->is_initialized(), "must be");
+  if (!is_compilation_enabled() || !CompileBroker::should_compile_new_jobs()) {
+    return;
+  }
+  if (!THREAD->can_call_java() || THREAD->is_Compiler_thread()) {
+    return;
+  }
+
+  CompLevel level = highest_compile_level();
+  Array<Method*>* methods = ik->methods();
+  for (int i = 0; i < methods->length(); i++) {
+    Method* m = methods->at(i);
+    if (!m->is_archived_hot() || m->has_compiled_code()) {
+      continue;
+    }
+    methodHandle mh(THREAD, m);
+    if (!can_be_compiled(mh, level) || CompileBroker::compilation_is_in_queue(mh)) {
+      continue;
+    }
+    if (PrintTieredEvents) {
+      print_event(COMPILE, mh(), mh(), InvocationEntryBci, level);
+    }
+    CompileBroker::compile_method(mh, InvocationEntryBci, level, methodHandle(), 0, CompileTask::Reason_Archived, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      // Compilation requests are best effort, don't fail the initialization.
+      CLEAR_PENDING_EXCEPTION;
+      return;
+    }
+  }
+}
+
 static inline CompLevel adjust_level_for_compilability_query(CompLevel comp_level) {
   if (comp_level == CompLevel_any) {
      if (CompilerConfig::is_c1_only()) {
@@ -609,27 +642,102 @@ void CompilationPolicy::handle_counter_overflow(Method* method) {
   }
 }
 
+bool CompilationPolicy::remove_if_stale(CompileQueue* compile_queue, CompileTask* task, jlong t) {
+  Method* method = task->method();
+  // If a method was unloaded or has been stale for some time, remove it from the queue.
+  // Blocking tasks and tasks submitted from whitebox API don't become stale
+  if (task->is_unloaded() || (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, method) && !is_old(method))) {
+    if (!task->is_unloaded()) {
+      if (PrintTieredEvents) {
+        print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
+      }
+      method->clear_queued_for_compilation();
+    }
+    compile_queue->remove_and_mark_stale(task);
+    return true;
+  }
+  return false;
+}
+
+void CompilationPolicy::update_priority(CompileTask* task, jlong t) {
+  Method* method = task->method();
+  update_rate(t, method);
+  task->set_priority(method->highest_comp_level(), weight(method));
+}
+
+// The heap keeps the priorities the tasks had when they were last looked
+// at. Refresh the priority of the top task until the top stays the same,
+// so the selected task is at least as good as any task whose priority has
+// not grown since. Deferred large tasks are taken out while looking for a
+// smaller one and put back afterwards. Stale tasks are purged lazily: when
+// they reach the top, and by checking a few leaves of the heap with every
+// selection.
+CompileTask* CompilationPolicy::select_task_from_heap(CompileQueue* compile_queue, jlong t) {
+  const int max_refreshes = 64;
+  const int max_deferred = 8;
+  const int leaves_to_check = 8;
+
+  for (int i = 0; i < leaves_to_check; i++) {
+    int index = compile_queue->heap_length() - 1 - i;
+    if (index <= 0) {
+      break;
+    }
+    remove_if_stale(compile_queue, compile_queue->heap_at(index), t);
+  }
+
+  CompileTask* deferred[max_deferred];
+  int num_deferred = 0;
+  int refreshes = 0;
+  CompileTask* max_task = NULL;
+  CompileTask* task;
+  while ((task = compile_queue->heap_top()) != NULL) {
+    if (remove_if_stale(compile_queue, task, t)) {
+      continue;
+    }
+    if (refreshes < max_refreshes) {
+      refreshes++;
+      update_priority(task, t);
+      compile_queue->heap_update(task);
+      if (compile_queue->heap_top() != task) {
+        continue;
+      }
+    }
+    if (num_deferred < max_deferred && is_deferred_large_task(task)) {
+      compile_queue->heap_remove(task);
+      deferred[num_deferred++] = task;
+      continue;
+    }
+    max_task = task;
+    break;
+  }
+
+  for (int i = 0; i < num_deferred; i++) {
+    compile_queue->heap_insert(deferred[i]);
+  }
+  if (max_task == NULL && num_deferred > 0) {
+    max_task = compile_queue->heap_top();
+  }
+  return max_task;
+}
+
 // Called with the queue locked and with at least one element
 CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_blocking_task = NULL;
   CompileTask *max_task = NULL;
+  CompileTask *max_small_task = NULL;
   Method* max_method = NULL;
 
   jlong t = nanos_to_millis(os::javaTimeNanos());
+  if (compile_queue->has_heap()) {
+    max_task = select_task_from_heap(compile_queue, t);
+    max_method = (max_task != NULL) ? max_task->method() : NULL;
+    max_small_task = max_task;
+  }
   // Iterate through the queue and find a method with a maximum rate.
-  for (CompileTask* task = compile_queue->first(); task != NULL;) {
+  for (CompileTask* task = compile_queue->has_heap() ? NULL : compile_queue->first(); task != NULL;) {
     CompileTask* next_task = task->next();
     Method* method = task->method();
-    // If a method was unloaded or has been stale for some time, remove it from the queue.
-    // Blocking tasks and tasks submitted from whitebox API don't become stale
-    if (task->is_unloaded() || (task->can_become_stale() && is_stale(t, TieredCompileTaskTimeout, method) && !is_old(method))) {
-      if (!task->is_unloaded()) {
-        if (PrintTieredEvents) {
-          print_event(REMOVE_FROM_QUEUE, method, method, task->osr_bci(), (CompLevel) task->comp_level());
-        }
-        method->clear_queued_for_compilation();
-      }
-      compile_queue->remove_and_mark_stale(task);
+    if (remove_if_stale(compile_queue, task, t)) {
       task = next_task;
       continue;
     }
@@ -640,6 +748,11 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       max_method = method;
     }
 
+    if (!is_deferred_large_task(task) &&
+        (max_small_task == NULL || compare_methods(method, max_small_task->method()))) {
+      max_small_task = task;
+    }
+
     if (task->is_blocking()) {
       if (max_blocking_task == NULL || compare_methods(method, max_blocking_task->method())) {
         max_blocking_task = task;
@@ -657,6 +770,12 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
     // chance of such compilations timing out.
     max_task = max_blocking_task;
     max_method = max_task->method();
+  } else if (max_small_task != NULL && max_small_task != max_task) {
+    // Huge C2 compilations take long enough to hold up the whole queue.
+    // Compile the smaller methods first, until the large ones have waited
+    // for TieredLargeMethodMaxDelay.
+    max_task = max_small_task;
+    max_method = max_task->method();
   }
 
   methodHandle max_method_h(Thread::current(), max_method);
@@ -850,6 +969,15 @@ bool CompilationPolicy::is_stale(jlong t, jlong timeout, Method* m) {
 
 // We don't remove old methods from the compile queue even if they have
 // very low activity. See select_task().
+bool CompilationPolicy::is_deferred_large_task(CompileTask* task) {
+  if (TieredLargeMethodSize == 0 || task->comp_level() != CompLevel_full_optimization ||
+      task->method()->code_size() < TieredLargeMethodSize) {
+    return false;
+  }
+  jlong waited = (jlong)TimeHelper::counter_to_millis(os::elapsed_counter() - task->time_queued());
+  return waited < TieredLargeMethodMaxDelay;
+}
+
 bool CompilationPolicy::is_old(Method* method) {
   return method->invocation_count() > 50000 || method->backedge_count() > 500000;
 }
@@ -884,6 +1012,17 @@ bool CompilationPolicy::is_method_profiled(const methodHandle& method) {
   return false;
 }
 
+bool CompilationPolicy::has_archived_full_optimization(const methodHandle& method) {
+#if INCLUDE_CDS
+  if (ArchiveMethodCounters && method->method_data() == NULL) {
+    MethodCounters* mcs = method->method_counters();
+    return mcs != NULL && mcs->is_shared() &&
+           mcs->highest_comp_level() == CompLevel_full_optimization;
+  }
+#endif
+  return false;
+}
+
 
 // Determine is a method is mature.
 bool CompilationPolicy::is_mature(Method* method) {
@@ -1010,6 +1149,10 @@ CompLevel CompilationPolicy::common(const methodHandle& method, CompLevel cur_le
         // If we were at full profile level, would we switch to full opt?
         if (common<Predicate>(method, CompLevel_full_profile, disable_feedback) == CompLevel_full_optimization) {
           next_level = CompLevel_full_optimization;
+        } else if (has_archived_full_optimization(method) && Predicate::apply(i, b, cur_level, method)) {
+          // The method reached full optimization in the run that dumped the archive,
+          // so go there directly instead of spending time in the profiled tiers.
+          next_level = CompLevel_full_optimization;
         } else if (!CompilationModeFlag::disable_intermediate() && Predicate::apply(i, b, cur_level, method)) {
           // C1-generated fully profiled code is about 30% slower than the limited profile
           // code that has only invocation and backedge counters. The observation is that
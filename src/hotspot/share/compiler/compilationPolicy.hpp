@@ -192,6 +192,8 @@ class CompilationPolicy : AllStatic {
   // Was a given method inactive for a given number of milliseconds.
   // If it is, we would remove it from the queue (see select_task()).
   inline static bool is_stale(jlong t, jlong timeout, Method* m);
+  // Should a C2 task of a large method let smaller tasks go first?
+  inline static bool is_deferred_large_task(CompileTask* task);
   // Compute the weight of the method for the compilation scheduling
   inline static double weight(Method* method);
   // Apply heuristics and return true if x should be compiled before y
@@ -199,6 +201,11 @@ class CompilationPolicy : AllStatic {
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline static void update_rate(jlong t, Method* m);
+  // If the task's method was unloaded or has become stale, remove the task
+  // from the queue and return true.
+  static bool remove_if_stale(CompileQueue* compile_queue, CompileTask* task, jlong t);
+  // Select the task with the highest priority from the heap of the queue.
+  static CompileTask* select_task_from_heap(CompileQueue* compile_queue, jlong t);
   // Compute threshold scaling coefficient
   inline static double threshold_scale(CompLevel level, int feedback_k);
   // If a method is old enough and is still in the interpreter we would want to
@@ -209,6 +216,8 @@ class CompilationPolicy : AllStatic {
   static void create_mdo(const methodHandle& mh, JavaThread* THREAD);
   // Is method profiled enough?
   static bool is_method_profiled(const methodHandle& method);
+  // Did the method reach full optimization in the run that dumped the CDS archive?
+  static bool has_archived_full_optimization(const methodHandle& method);
 
   static void set_c1_count(int x) { _c1_count = x;    }
   static void set_c2_count(int x) { _c2_count = x;    }
@@ -245,6 +254,11 @@ public:
   // This supports the -Xcomp option.
   static void compile_if_required(const methodHandle& m, TRAPS);
 
+  // Request compilation of the methods of a newly initialized shared class
+  // which were compiled at the highest tier when the archive was dumped.
+  // This supports the -XX:+ArchiveHotMethods option.
+  static void compile_archived_hot_methods(InstanceKlass* ik, TRAPS);
+
   // m is allowed to be compiled
   static bool can_be_compiled(const methodHandle& m, int comp_level = CompLevel_any);
   // m is allowed to be osr compiled
@@ -259,6 +273,9 @@ public:
                  int branch_bci, int bci, CompLevel comp_level, CompiledMethod* nm, TRAPS);
   // Select task is called by CompileBroker. We should return a task or NULL.
   static CompileTask* select_task(CompileQueue* compile_queue);
+  // Refresh the event rate of the task's method and the task's priority in
+  // the compile queue heap, see TieredCompileQueueHeap.
+  static void update_priority(CompileTask* task, jlong t);
   // Tell the runtime if we think a given method is adequately profiled.
   static bool is_mature(Method* method);
   // Initialize: set compiler thread count
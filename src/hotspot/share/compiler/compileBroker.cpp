@@ -31,6 +31,7 @@
 #include "code/codeCache.hpp"
 #include "code/codeHeapState.hpp"
 #include "code/dependencyContext.hpp"
+#include "compiler/compilationCost.hpp"
 #include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compileLog.hpp"
@@ -134,6 +135,11 @@ int CompileBroker::_c2_count = 0;
 jobject* CompileBroker::_compiler1_objects = NULL;
 jobject* CompileBroker::_compiler2_objects = NULL;
 
+volatile jlong CompileBroker::_compiler_cpu_time[2]    = { 0, 0 };
+volatile jlong CompileBroker::_cpu_window_start[2]     = { 0, 0 };
+volatile jlong CompileBroker::_cpu_window_start_cpu[2] = { 0, 0 };
+volatile jlong CompileBroker::_cpu_throttled_until[2]  = { 0, 0 };
+
 CompileLog** CompileBroker::_compiler1_logs = NULL;
 CompileLog** CompileBroker::_compiler2_logs = NULL;
 
@@ -314,8 +320,10 @@ bool CompileBroker::can_remove(CompilerThread *ct, bool do_it) {
   // Keep at least 1 compiler thread of each type.
   if (compiler_count < 2) return false;
 
-  // Keep thread alive for at least some time.
-  if (ct->idle_time_millis() < (c1 ? 500 : 100)) return false;
+  // Keep thread alive for at least some time, unless the threads of this
+  // compiler are over their CPU budget anyway.
+  if (ct->idle_time_millis() < (c1 ? 500 : 100) &&
+      !is_cpu_throttled(compiler_index(compiler))) return false;
 
 #if INCLUDE_JVMCI
   if (compiler->is_jvmci()) {
@@ -372,6 +380,11 @@ void CompileQueue::add(CompileTask* task) {
   }
   ++_size;
 
+  if (has_heap()) {
+    CompilationPolicy::update_priority(task, nanos_to_millis(os::javaTimeNanos()));
+    heap_insert(task);
+  }
+
   // Mark the method as being in the compile queue.
   task->method()->set_queued_for_compilation();
 
@@ -410,6 +423,9 @@ void CompileQueue::free_all() {
     CompileTask::free(current);
   }
   _first = NULL;
+  if (has_heap()) {
+    _heap->clear();
+  }
 
   // Wake up all threads that block on the queue.
   MethodCompileQueue_lock->notify_all();
@@ -520,6 +536,80 @@ void CompileQueue::remove(CompileTask* task) {
     _last = task->prev();
   }
   --_size;
+
+  if (has_heap() && task->heap_index() >= 0) {
+    heap_remove(task);
+  }
+}
+
+void CompileQueue::heap_set(int index, CompileTask* task) {
+  _heap->at_put(index, task);
+  task->set_heap_index(index);
+}
+
+void CompileQueue::heap_sift_up(int index) {
+  CompileTask* task = _heap->at(index);
+  while (index > 0) {
+    int parent = (index - 1) / 2;
+    CompileTask* p = _heap->at(parent);
+    if (!task->has_higher_priority(p)) {
+      break;
+    }
+    heap_set(index, p);
+    index = parent;
+  }
+  heap_set(index, task);
+}
+
+void CompileQueue::heap_sift_down(int index) {
+  int length = _heap->length();
+  CompileTask* task = _heap->at(index);
+  while (true) {
+    int child = 2 * index + 1;
+    if (child >= length) {
+      break;
+    }
+    if (child + 1 < length && _heap->at(child + 1)->has_higher_priority(_heap->at(child))) {
+      child++;
+    }
+    CompileTask* c = _heap->at(child);
+    if (!c->has_higher_priority(task)) {
+      break;
+    }
+    heap_set(index, c);
+    index = child;
+  }
+  heap_set(index, task);
+}
+
+void CompileQueue::heap_insert(CompileTask* task) {
+  assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  assert(task->heap_index() < 0, "already in heap");
+  _heap->append(task);
+  task->set_heap_index(_heap->length() - 1);
+  heap_sift_up(_heap->length() - 1);
+}
+
+void CompileQueue::heap_remove(CompileTask* task) {
+  assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  int index = task->heap_index();
+  assert(index >= 0 && _heap->at(index) == task, "not in heap");
+  CompileTask* last = _heap->pop();
+  task->set_heap_index(-1);
+  if (last != task) {
+    heap_set(index, last);
+    heap_update(last);
+  }
+}
+
+void CompileQueue::heap_update(CompileTask* task) {
+  int index = task->heap_index();
+  assert(index >= 0 && _heap->at(index) == task, "not in heap");
+  if (index > 0 && task->has_higher_priority(_heap->at((index - 1) / 2))) {
+    heap_sift_up(index);
+  } else {
+    heap_sift_down(index);
+  }
 }
 
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
@@ -1070,7 +1160,8 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   // Only do attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
-  if (_c2_compile_queue != NULL) {
+  // More threads would only wait while the compiler is over its CPU budget.
+  if (_c2_compile_queue != NULL && !is_cpu_throttled(1)) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
     int new_c2_count = MIN4(_c2_count,
         _c2_compile_queue->size() / 2,
@@ -1124,7 +1215,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
     }
   }
 
-  if (_c1_compile_queue != NULL) {
+  if (_c1_compile_queue != NULL && !is_cpu_throttled(0)) {
     int old_c1_count = _compilers[0]->num_compiler_threads();
     int new_c1_count = MIN4(_c1_count,
         _c1_compile_queue->size() / 4,
@@ -1148,6 +1239,58 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   CompileThread_lock->unlock();
 }
 
+// Adds the CPU time of a finished compilation to the account of its compiler.
+// At the end of each sampling window, the CPU time used during the window is
+// compared with the CompilerCPUBudget share of the active processors. If the
+// compiler threads used more, they are throttled for as long as it takes the
+// budget to catch up with the excess.
+void CompileBroker::account_compiler_cpu_time(AbstractCompiler* comp, jlong cpu_time) {
+  const jlong window = 200 * NANOSECS_PER_MILLISEC;
+  int idx = compiler_index(comp);
+  jlong cpu_total = Atomic::add(&_compiler_cpu_time[idx], cpu_time);
+  jlong now = os::javaTimeNanos();
+  jlong start = Atomic::load(&_cpu_window_start[idx]);
+  if (now - start < window) return;
+  // Only one thread closes the window.
+  if (Atomic::cmpxchg(&_cpu_window_start[idx], start, now) != start) return;
+
+  jlong used = cpu_total - Atomic::load(&_cpu_window_start_cpu[idx]);
+  Atomic::store(&_cpu_window_start_cpu[idx], cpu_total);
+
+  double budget = os::active_processor_count() * (double)CompilerCPUBudget / 100;
+  jlong budget_time = (jlong)(used / budget);
+  jlong elapsed = now - start;
+  if (budget_time > elapsed) {
+    // Do not stall compilations for too long after a single expensive one.
+    jlong delay = MIN2(budget_time - elapsed, (jlong)NANOSECS_PER_SEC);
+    Atomic::store(&_cpu_throttled_until[idx], now + delay);
+    if (TraceCompilerThreads) {
+      tty->print_cr("Throttling %s compiler threads for " JLONG_FORMAT " ms (" JLONG_FORMAT " ms CPU time in " JLONG_FORMAT " ms)",
+                    comp->name(), delay / NANOSECS_PER_MILLISEC,
+                    used / NANOSECS_PER_MILLISEC, elapsed / NANOSECS_PER_MILLISEC);
+    }
+  }
+}
+
+bool CompileBroker::is_cpu_throttled(int idx) {
+  return CompilerCPUBudget > 0 &&
+         os::javaTimeNanos() < Atomic::load(&_cpu_throttled_until[idx]);
+}
+
+// Makes a compiler thread wait before it takes the next task as long as its
+// compiler is over its CPU budget.
+void CompileBroker::throttle_compiler_thread(CompilerThread* thread) {
+  int idx = compiler_index(thread->compiler());
+  while (!is_compilation_disabled_forever()) {
+    jlong remaining = Atomic::load(&_cpu_throttled_until[idx]) - os::javaTimeNanos();
+    if (remaining <= 0) {
+      break;
+    }
+    ThreadBlockInVM tbivm(thread);
+    os::naked_short_sleep(clamp(remaining / NANOSECS_PER_MILLISEC, (jlong)1, (jlong)100));
+  }
+}
+
 
 /**
  * Set the methods on the stack as on_stack so that redefine classes doesn't
@@ -1950,6 +2093,10 @@ void CompileBroker::compiler_thread_loop() {
     // We need this HandleMark to avoid leaking VM handles.
     HandleMark hm(thread);
 
+    if (CompilerCPUBudget > 0) {
+      throttle_compiler_thread(thread);
+    }
+
     CompileTask* task = queue->get();
     if (task == NULL) {
       if (UseDynamicNumberOfCompilerThreads) {
@@ -1982,7 +2129,12 @@ void CompileBroker::compiler_thread_loop() {
       if (method()->number_of_breakpoints() == 0) {
         // Compile the method.
         if ((UseCompiler || AlwaysCompileLoopMethods) && CompileBroker::should_compile_new_jobs()) {
+          bool account_cpu = CompilerCPUBudget > 0 && os::is_thread_cpu_time_supported();
+          jlong cpu_start = account_cpu ? os::current_thread_cpu_time() : 0;
           invoke_compiler_on_method(task);
+          if (account_cpu) {
+            account_compiler_cpu_time(thread->compiler(), os::current_thread_cpu_time() - cpu_start);
+          }
           thread->start_idle_timer();
         } else {
           // After compilation is disabled, remove remaining methods from queue
@@ -2160,7 +2312,8 @@ static void post_compilation_event(EventCompilation& event, CompileTask* task) {
                                         task->is_success(),
                                         task->osr_bci() != CompileBroker::standard_entry_bci,
                                         (task->code() == NULL) ? 0 : task->code()->total_size(),
-                                        task->num_inlined_bytecodes());
+                                        task->num_inlined_bytecodes(),
+                                        task->arena_peak());
 }
 
 int DirectivesStack::_depth = 0;
@@ -2221,6 +2374,11 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
     should_log = false;
   }
 
+  // The peak arena memory of the compilation is the high-water mark of
+  // the compiler thread above what it used before.
+  thread->reset_arena_peak();
+  const ssize_t arena_base = thread->arena_bytes();
+
   // Allocate a new set of JNI handles.
   push_jni_handle_block();
   Method* target_handle = task->method();
@@ -2263,6 +2421,7 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
         assert(failure_reason != NULL, "must specify failure_reason");
       }
     }
+    task->set_arena_peak((size_t)(thread->arena_peak() - arena_base));
     post_compile(thread, task, task->code() != NULL, NULL, compilable, failure_reason);
     if (event.should_commit()) {
       post_compilation_event(event, task);
@@ -2336,6 +2495,7 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
       ci_env.report_failure(failure_reason);
     }
 
+    task->set_arena_peak((size_t)(thread->arena_peak() - arena_base));
     post_compile(thread, task, !ci_env.failing(), &ci_env, compilable, failure_reason);
     if (event.should_commit()) {
       post_compilation_event(event, task);
@@ -2549,6 +2709,10 @@ void CompileBroker::collect_statistics(CompilerThread* thread, elapsedTimer time
   CompilerCounters* counters = thread->counters();
 
   assert(code == NULL || code->is_locked_by_vm(), "will survive the MutexLocker");
+  if (CompilationCostAccounting) {
+    CompilationCost::record_compilation(method(), comp_level, is_osr, time,
+                                        code != NULL ? code->total_size() : 0);
+  }
   MutexLocker locker(CompileStatistics_lock);
 
   // _perf variables are production performance counters which are
@@ -90,7 +90,16 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   int _size;
 
+  // With TieredCompileQueueHeap, the tasks are also kept in a binary heap
+  // ordered by the priority they had when they were last looked at by
+  // CompilationPolicy::select_task().
+  GrowableArray<CompileTask*>* _heap;
+
   void purge_stale_tasks();
+
+  void heap_set(int index, CompileTask* task);
+  void heap_sift_up(int index);
+  void heap_sift_down(int index);
  public:
   CompileQueue(const char* name) {
     _name = name;
@@ -98,6 +107,10 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _last = NULL;
     _size = 0;
     _first_stale = NULL;
+    _heap = NULL;
+    if (TieredCompileQueueHeap) {
+      _heap = new (ResourceObj::C_HEAP, mtCompiler) GrowableArray<CompileTask*>(64, mtCompiler);
+    }
   }
 
   const char*  name() const                      { return _name; }
@@ -113,6 +126,15 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   bool         is_empty() const                  { return _first == NULL; }
   int          size()     const                  { return _size;          }
 
+  bool         has_heap() const                  { return _heap != NULL; }
+  int          heap_length() const               { return _heap->length(); }
+  CompileTask* heap_at(int index) const          { return _heap->at(index); }
+  CompileTask* heap_top() const                  { return _heap->is_empty() ? NULL : _heap->at(0); }
+  void         heap_insert(CompileTask* task);
+  void         heap_remove(CompileTask* task);
+  // Restores the heap order after the priority of task changed.
+  void         heap_update(CompileTask* task);
+
 
   // Redefine Classes support
   void mark_on_stack();
@@ -122,6 +144,9 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   ~CompileQueue() {
     assert (is_empty(), " Compile Queue must be empty");
+    if (_heap != NULL) {
+      delete _heap;
+    }
   }
 };
 
@@ -168,6 +193,13 @@ class CompileBroker: AllStatic {
   // An array of compiler thread Java objects
   static jobject *_compiler1_objects, *_compiler2_objects;
 
+  // CPU time accounting for CompilerCPUBudget, indexed like _compilers.
+  // All times are in nanoseconds.
+  static volatile jlong _compiler_cpu_time[2];     // total CPU time used by compilations
+  static volatile jlong _cpu_window_start[2];      // start of the current sampling window
+  static volatile jlong _cpu_window_start_cpu[2];  // _compiler_cpu_time at window start
+  static volatile jlong _cpu_throttled_until[2];   // threads wait until this time
+
   // An array of compiler logs
   static CompileLog **_compiler1_logs, **_compiler2_logs;
 
@@ -239,6 +271,11 @@ class CompileBroker: AllStatic {
   static JavaThread* make_thread(ThreadType type, jobject thread_oop, CompileQueue* queue, AbstractCompiler* comp, JavaThread* THREAD);
   static void init_compiler_sweeper_threads();
   static void possibly_add_compiler_threads(JavaThread* THREAD);
+
+  static int compiler_index(AbstractCompiler* comp) { return comp == _compilers[0] ? 0 : 1; }
+  static void account_compiler_cpu_time(AbstractCompiler* comp, jlong cpu_time);
+  static bool is_cpu_throttled(int idx);
+  static void throttle_compiler_thread(CompilerThread* thread);
   static bool compilation_is_prohibited(const methodHandle& method, int osr_bci, int comp_level, bool excluded);
 
   static CompileTask* create_compile_task(CompileQueue*       queue,
@@ -54,6 +54,7 @@ class CompileTask : public CHeapObj<mtCompiler> {
       Reason_Whitebox,         // Whitebox API
       Reason_MustBeCompiled,   // Used for -Xcomp or AlwaysCompileLoopMethods (see CompilationPolicy::must_be_compiled())
       Reason_Bootstrap,        // JVMCI bootstrap
+      Reason_Archived,         // Compiled at the highest tier when the CDS archive was dumped
       Reason_Count
   };
 
@@ -66,7 +67,8 @@ class CompileTask : public CHeapObj<mtCompiler> {
       "replay",
       "whitebox",
       "must_be_compiled",
-      "bootstrap"
+      "bootstrap",
+      "archived"
     };
     return reason_names[compile_reason];
   }
@@ -88,8 +90,13 @@ class CompileTask : public CHeapObj<mtCompiler> {
 #endif
   int          _comp_level;
   int          _num_inlined_bytecodes;
+  size_t       _arena_peak;         // peak arena memory of the compiler thread during the compilation
   nmethodLocker* _code_handle;  // holder of eventual result
   CompileTask* _next, *_prev;
+  // Position and priority in the heap of the compile queue, see TieredCompileQueueHeap
+  int          _heap_index;
+  int          _priority_level;
+  double       _priority_weight;
   bool         _is_free;
   // Fields used for logging why the compilation was initiated:
   jlong        _time_queued;  // time when task was enqueued
@@ -162,6 +169,25 @@ class CompileTask : public CHeapObj<mtCompiler> {
   void         mark_complete()                   { _is_complete = true; }
   void         mark_success()                    { _is_success = true; }
   void         mark_started(jlong time)          { _time_started = time; }
+  jlong        time_queued() const               { return _time_queued; }
+
+  int          heap_index() const                { return _heap_index; }
+  void         set_heap_index(int index)         { _heap_index = index; }
+  void         set_priority(int level, double weight) {
+    _priority_level = level;
+    _priority_weight = weight;
+  }
+  // Blocking tasks go first, then recompilations at a higher level,
+  // then the higher weight, as in CompilationPolicy::compare_methods().
+  bool         has_higher_priority(const CompileTask* other) const {
+    if (_is_blocking != other->_is_blocking) {
+      return _is_blocking;
+    }
+    if (_priority_level != other->_priority_level) {
+      return _priority_level > other->_priority_level;
+    }
+    return _priority_weight > other->_priority_weight;
+  }
 
   int          comp_level()                      { return _comp_level;}
   void         set_comp_level(int comp_level)    { _comp_level = comp_level;}
@@ -171,6 +197,8 @@ class CompileTask : public CHeapObj<mtCompiler> {
 
   int          num_inlined_bytecodes() const     { return _num_inlined_bytecodes; }
   void         set_num_inlined_bytecodes(int n)  { _num_inlined_bytecodes = n; }
+  size_t       arena_peak() const                { return _arena_peak; }
+  void         set_arena_peak(size_t n)          { _arena_peak = n; }
 
   CompileTask* next() const                      { return _next; }
   void         set_next(CompileTask* next)       { _next = next; }
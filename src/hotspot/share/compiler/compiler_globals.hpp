@@ -164,6 +164,13 @@
           "frequency")                                                      \
           range(0, 30)                                                      \
                                                                             \
+  product(intx, Tier3ProfileSampleFreqLog, 0, EXPERIMENTAL,                 \
+          "If > 0, C1 with MDO profiling (tier 3) updates branch "          \
+          "profiles once every 2^Tier3ProfileSampleFreqLog executions "     \
+          "on average and increments them by 2^Tier3ProfileSampleFreqLog"   \
+          " to reduce contention on shared MethodData")                     \
+          range(0, 10)                                                      \
+                                                                            \
   product(intx, Tier2CompileThreshold, 0,                                   \
           "threshold at which tier 2 compilation is invoked")               \
           range(0, max_jint)                                                \
@@ -238,6 +245,22 @@
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(bool, TieredCompileQueueHeap, false, EXPERIMENTAL,                \
+          "Keep compile queues ordered in a priority heap, so that "        \
+          "selecting the next task only refreshes the priorities of the "   \
+          "tasks at the top instead of scanning the whole queue")           \
+                                                                            \
+  product(intx, TieredLargeMethodSize, 0, EXPERIMENTAL,                     \
+          "Bytecode size from which C2 compile tasks let smaller tasks "    \
+          "in the queue go first, so that a burst of huge methods does "    \
+          "not delay the other compilations. 0 disables this")              \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(intx, TieredLargeMethodMaxDelay, 1000, EXPERIMENTAL,              \
+          "Maximum time in milliseconds that a compile task of a large "    \
+          "method lets smaller tasks go first, see TieredLargeMethodSize")  \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
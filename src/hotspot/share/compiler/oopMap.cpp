@@ -552,6 +552,24 @@ int ImmutableOopMapBuilder::size_for(const OopMap* map) const {
   return align_up((int)sizeof(ImmutableOopMap) + map->data_size(), 8);
 }
 
+// Look for an identical non empty map among the ones already laid
+// out. Only the most recent ones are searched to bound the cost for
+// methods with many safepoints.
+int ImmutableOopMapBuilder::find_earlier_duplicate(const OopMap* map, int index) const {
+  const int search_limit = 64;
+  int searched = 0;
+  for (int j = index - 1; j >= 0 && searched < search_limit; j--) {
+    if (_mapping[j]._kind != Mapping::OOPMAP_NEW || is_empty(_mapping[j]._map)) {
+      continue;
+    }
+    if (_mapping[j]._map->equals(map)) {
+      return j;
+    }
+    searched++;
+  }
+  return -1;
+}
+
 int ImmutableOopMapBuilder::heap_size() {
   int base = sizeof(ImmutableOopMapSet);
   base = align_up(base, 8);
@@ -562,6 +580,7 @@ int ImmutableOopMapBuilder::heap_size() {
 
   for (int i = 0; i < _set->size(); ++i) {
     int size = 0;
+    int dup = -1;
     OopMap* map = _set->at(i);
 
     if (is_empty(map)) {
@@ -577,6 +596,9 @@ int ImmutableOopMapBuilder::heap_size() {
     } else if (is_last_duplicate(map)) {
       /* if this entry is identical to the previous one, just point it there */
       _mapping[i].set(Mapping::OOPMAP_DUPLICATE, _last_offset, 0, map, _last);
+    } else if ((dup = find_earlier_duplicate(map, i)) != -1) {
+      /* identical to an earlier entry, share it */
+      _mapping[i].set(Mapping::OOPMAP_DUPLICATE, _mapping[dup]._offset, 0, map, _mapping[dup]._map);
     } else {
       /* not empty, not an identical copy of the previous entry */
       size = size_for(map);
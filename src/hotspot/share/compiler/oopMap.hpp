@@ -389,6 +389,8 @@ private:
     return false;
   }
 
+  int find_earlier_duplicate(const OopMap* map, int index) const;
+
 #ifdef ASSERT
   void verify(address buffer, int size, const ImmutableOopMapSet* set);
 #endif
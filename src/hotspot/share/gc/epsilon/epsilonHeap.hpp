@@ -26,6 +26,7 @@
 #define SHARE_GC_EPSILON_EPSILONHEAP_HPP
 
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/markBitMap.hpp"
 #include "gc/shared/softRefPolicy.hpp"
 #include "gc/shared/space.hpp"
 #include "gc/epsilon/epsilonMonitoringSupport.hpp"
@@ -48,6 +49,10 @@ private:
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
 
+  // Marking bitmap of EpsilonSlidingGC
+  MarkBitMap _bitmap;
+  MemRegion _bitmap_region;
+
 public:
   static EpsilonHeap* heap();
 
@@ -89,6 +94,7 @@ public:
 
   // Allocation
   HeapWord* allocate_work(size_t size);
+  HeapWord* allocate_or_collect_work(size_t size);
   virtual HeapWord* mem_allocate(size_t size, bool* gc_overhead_limit_was_exceeded);
   virtual HeapWord* allocate_new_tlab(size_t min_size,
                                       size_t requested_size,
@@ -103,6 +109,10 @@ public:
   virtual void collect(GCCause::Cause cause);
   virtual void do_full_collection(bool clear_all_soft_refs);
 
+  // Sliding mark-compact with EpsilonSlidingGC, at a safepoint
+  void vmentry_collect(GCCause::Cause cause);
+  void entry_collect(GCCause::Cause cause);
+
   // Heap walking support
   virtual void object_iterate(ObjectClosure* cl);
 
@@ -139,6 +149,9 @@ private:
   void print_heap_info(size_t used) const;
   void print_metaspace_info() const;
 
+  void process_roots(OopClosure* cl, bool fix_relocations);
+  void walk_bitmap(ObjectClosure* cl);
+
 };
 
 #endif // SHARE_GC_EPSILON_EPSILONHEAP_HPP
@@ -86,7 +86,14 @@
   product(size_t, EpsilonMinHeapExpand, 128 * M, EXPERIMENTAL,              \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  product(bool, EpsilonSlidingGC, false, EXPERIMENTAL,                      \
+          "Run a single-threaded sliding mark-compact at a safepoint "      \
+          "when the heap is exhausted, or on explicit GC requests such as " \
+          "System.gc(). This keeps the barrier-free allocation path, but "  \
+          "avoids yielding OutOfMemoryError while reclaimable memory "      \
+          "exists. All weakly reachable objects are retained.")
 
 // end of GC_EPSILON_FLAGS
 
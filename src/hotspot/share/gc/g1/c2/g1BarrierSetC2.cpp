@@ -649,6 +649,119 @@ Node* G1BarrierSetC2::load_at_resolved(C2Access& access, const Type* val_type) c
   return load;
 }
 
+// Returns the CmpX of the "store and value in the same region" check
+// if the CastP2X node is the start of a G1 post barrier, NULL otherwise.
+static Node* post_barrier_region_check(Node* p2x) {
+  if (p2x->Opcode() != Op_CastP2X || p2x->in(0) == NULL) {
+    return NULL;
+  }
+  Node* xorx = p2x->find_out_with(Op_XorX);
+  if (xorx == NULL || xorx->outcnt() != 1) {
+    return NULL;
+  }
+  Node* shift = xorx->unique_out();
+  if (shift->Opcode() != Op_URShiftX || shift->outcnt() != 1) {
+    return NULL;
+  }
+  Node* cmpx = shift->unique_out();
+  if (!cmpx->is_Cmp() || cmpx->outcnt() != 1 || !cmpx->unique_out()->is_Bool() ||
+      cmpx->unique_out()->as_Bool()->_test._test != BoolTest::ne) {
+    return NULL;
+  }
+  return cmpx;
+}
+
+// Returns true if all control paths reaching ctrl come from the allocation
+// without passing a safepoint. Leaf calls cannot safepoint.
+static bool no_safepoint_since_allocation(Node* ctrl, AllocateNode* alloc) {
+  const uint max_visited = 1000;
+  ResourceMark rm;
+  Unique_Node_List visited;
+  Node_List worklist;
+  worklist.push(ctrl);
+  while (worklist.size() > 0) {
+    Node* n = worklist.pop();
+    if (n == alloc || visited.member(n)) {
+      continue;
+    }
+    visited.push(n);
+    if (visited.size() > max_visited) {
+      // Give up on large scopes
+      return false;
+    }
+    if (n->is_Start() || n->is_Root() || n->is_top()) {
+      // Reached without passing the allocation
+      return false;
+    }
+    if (n->is_SafePoint() && !n->is_CallLeaf()) {
+      return false;
+    }
+    if (n->is_Region()) {
+      for (uint i = 1; i < n->req(); i++) {
+        if (n->in(i) != NULL) {
+          worklist.push(n->in(i));
+        }
+      }
+    } else if (n->in(0) != NULL) {
+      worklist.push(n->in(0));
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+// An object allocated in this compilation is in a young region, or its
+// slow path allocation deferred its card marks (see ReduceInitialCardMarks),
+// until the next safepoint or slow path allocation. Stores into it that are
+// reached without either need no post barrier. This covers stores in
+// inlined callees and in loops without safepoints, not just the stores
+// right after the allocation.
+void G1BarrierSetC2::eliminate_gc_barriers_on_allocations(PhaseMacroExpand* macro) const {
+  if (!G1ElideBarriersOnAllocations || !use_ReduceInitialCardMarks()) {
+    return;
+  }
+  Compile* C = Compile::current();
+  ResourceMark rm;
+  Node_List casts;
+  Node_List allocs;
+  for (int i = 0; i < C->macro_count(); i++) {
+    Node* n = C->macro_node(i);
+    if (!n->is_Allocate()) {
+      continue;
+    }
+    AllocateNode* alloc = n->as_Allocate();
+    Node* res = alloc->result_cast();
+    if (res == NULL) {
+      continue;
+    }
+    // Find the post barriers on addresses derived from the new object
+    Unique_Node_List derived;
+    derived.push(res);
+    for (uint j = 0; j < derived.size(); j++) {
+      Node* d = derived.at(j);
+      for (DUIterator_Fast kmax, k = d->fast_outs(kmax); k < kmax; k++) {
+        Node* use = d->fast_out(k);
+        if (use->is_AddP() || use->Opcode() == Op_CastPP || use->Opcode() == Op_CheckCastPP) {
+          derived.push(use);
+        } else if (post_barrier_region_check(use) != NULL) {
+          casts.push(use);
+          allocs.push(alloc);
+        }
+      }
+    }
+  }
+  for (uint i = 0; i < casts.size(); i++) {
+    Node* p2x = casts.at(i);
+    AllocateNode* alloc = allocs.at(i)->as_Allocate();
+    Node* cmpx = post_barrier_region_check(p2x);
+    if (cmpx != NULL && no_safepoint_since_allocation(p2x->in(0), alloc)) {
+      // Make the region check fail so the rest of the barrier folds away
+      macro->replace_node(cmpx, macro->makecon(TypeInt::CC_EQ));
+    }
+  }
+}
+
 bool G1BarrierSetC2::is_gc_barrier_node(Node* node) const {
   if (CardTableBarrierSetC2::is_gc_barrier_node(node)) {
     return true;
@@ -141,6 +141,9 @@ HeapWord* G1AllocRegion::new_alloc_region_and_allocate(size_t word_size,
   HeapRegion* new_alloc_region = allocate_new_region(word_size, force);
   if (new_alloc_region != NULL) {
     new_alloc_region->reset_pre_dummy_top();
+    if (!_bot_updates && new_alloc_region->is_old()) {
+      new_alloc_region->set_stale_bot();
+    }
     // Need to do this before the allocation
     _used_bytes_before = new_alloc_region->used();
     HeapWord* result = allocate(new_alloc_region, word_size);
@@ -178,6 +181,9 @@ void G1AllocRegion::set(HeapRegion* alloc_region) {
                          _used_bytes_before == 0 && _count == 0,
                          "pre-condition");
 
+  if (!_bot_updates && alloc_region->is_old()) {
+    alloc_region->set_stale_bot();
+  }
   _used_bytes_before = alloc_region->used();
   _alloc_region = alloc_region;
   _count += 1;
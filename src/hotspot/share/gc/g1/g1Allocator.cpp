@@ -44,7 +44,8 @@ G1Allocator::G1Allocator(G1CollectedHeap* heap) :
   _num_alloc_regions(_numa->num_active_nodes()),
   _mutator_alloc_regions(NULL),
   _survivor_gc_alloc_regions(NULL),
-  _old_gc_alloc_region(heap->alloc_buffer_stats(G1HeapRegionAttr::Old)),
+  _num_old_alloc_regions(G1NUMAOldAllocRegions ? (uint)_num_alloc_regions : 1),
+  _old_gc_alloc_regions(NULL),
   _retained_old_gc_alloc_region(NULL) {
 
   _mutator_alloc_regions = NEW_C_HEAP_ARRAY(MutatorAllocRegion, _num_alloc_regions, mtGC);
@@ -55,6 +56,13 @@ G1Allocator::G1Allocator(G1CollectedHeap* heap) :
     ::new(_mutator_alloc_regions + i) MutatorAllocRegion(i);
     ::new(_survivor_gc_alloc_regions + i) SurvivorGCAllocRegion(stat, i);
   }
+
+  _old_gc_alloc_regions = NEW_C_HEAP_ARRAY(OldGCAllocRegion, _num_old_alloc_regions, mtGC);
+  G1EvacStats* old_stat = heap->alloc_buffer_stats(G1HeapRegionAttr::Old);
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    ::new(_old_gc_alloc_regions + i) OldGCAllocRegion(old_stat,
+                                                      _num_old_alloc_regions > 1 ? i : G1NUMA::AnyNodeIndex);
+  }
 }
 
 G1Allocator::~G1Allocator() {
@@ -62,8 +70,12 @@ G1Allocator::~G1Allocator() {
     _mutator_alloc_regions[i].~MutatorAllocRegion();
     _survivor_gc_alloc_regions[i].~SurvivorGCAllocRegion();
   }
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    _old_gc_alloc_regions[i].~OldGCAllocRegion();
+  }
   FREE_C_HEAP_ARRAY(MutatorAllocRegion, _mutator_alloc_regions);
   FREE_C_HEAP_ARRAY(SurvivorGCAllocRegion, _survivor_gc_alloc_regions);
+  FREE_C_HEAP_ARRAY(OldGCAllocRegion, _old_gc_alloc_regions);
 }
 
 #ifdef ASSERT
@@ -134,9 +146,13 @@ void G1Allocator::init_gc_alloc_regions(G1EvacuationInfo& evacuation_info) {
     survivor_gc_alloc_region(i)->init();
   }
 
-  _old_gc_alloc_region.init();
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    old_gc_alloc_region(i)->init();
+  }
+  // The retained region goes back to the alloc region of its node.
+  HeapRegion* retained = _retained_old_gc_alloc_region;
   reuse_retained_old_region(evacuation_info,
-                            &_old_gc_alloc_region,
+                            old_gc_alloc_region(retained != NULL ? retained->node_index() : 0),
                             &_retained_old_gc_alloc_region);
 }
 
@@ -146,22 +162,34 @@ void G1Allocator::release_gc_alloc_regions(G1EvacuationInfo& evacuation_info) {
     survivor_region_count += survivor_gc_alloc_region(node_index)->count();
     survivor_gc_alloc_region(node_index)->release();
   }
-  evacuation_info.set_allocation_regions(survivor_region_count +
-                                         old_gc_alloc_region()->count());
+  uint old_region_count = 0;
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    old_region_count += old_gc_alloc_region(i)->count();
+  }
+  evacuation_info.set_allocation_regions(survivor_region_count + old_region_count);
 
   // If we have an old GC alloc region to release, we'll save it in
   // _retained_old_gc_alloc_region. If we don't
   // _retained_old_gc_alloc_region will become NULL. This is what we
   // want either way so no reason to check explicitly for either
-  // condition.
-  _retained_old_gc_alloc_region = old_gc_alloc_region()->release();
+  // condition. With several old GC alloc regions, only the first one
+  // released is retained, the others are retired like full regions.
+  _retained_old_gc_alloc_region = NULL;
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    HeapRegion* released = old_gc_alloc_region(i)->release();
+    if (_retained_old_gc_alloc_region == NULL) {
+      _retained_old_gc_alloc_region = released;
+    }
+  }
 }
 
 void G1Allocator::abandon_gc_alloc_regions() {
   for (uint i = 0; i < _num_alloc_regions; i++) {
     assert(survivor_gc_alloc_region(i)->get() == NULL, "pre-condition");
   }
-  assert(old_gc_alloc_region()->get() == NULL, "pre-condition");
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    assert(old_gc_alloc_region(i)->get() == NULL, "pre-condition");
+  }
   _retained_old_gc_alloc_region = NULL;
 }
 
@@ -229,7 +257,7 @@ HeapWord* G1Allocator::par_allocate_during_gc(G1HeapRegionAttr dest,
     case G1HeapRegionAttr::Young:
       return survivor_attempt_allocation(min_word_size, desired_word_size, actual_word_size, node_index);
     case G1HeapRegionAttr::Old:
-      return old_attempt_allocation(min_word_size, desired_word_size, actual_word_size);
+      return old_attempt_allocation(min_word_size, desired_word_size, actual_word_size, node_index);
     default:
       ShouldNotReachHere();
       return NULL; // Keep some compilers happy
@@ -263,18 +291,19 @@ HeapWord* G1Allocator::survivor_attempt_allocation(size_t min_word_size,
 
 HeapWord* G1Allocator::old_attempt_allocation(size_t min_word_size,
                                               size_t desired_word_size,
-                                              size_t* actual_word_size) {
+                                              size_t* actual_word_size,
+                                              uint node_index) {
   assert(!_g1h->is_humongous(desired_word_size),
          "we should not be seeing humongous-size allocations in this path");
 
-  HeapWord* result = old_gc_alloc_region()->attempt_allocation(min_word_size,
-                                                               desired_word_size,
-                                                               actual_word_size);
+  HeapWord* result = old_gc_alloc_region(node_index)->attempt_allocation(min_word_size,
+                                                                         desired_word_size,
+                                                                         actual_word_size);
   if (result == NULL && !old_is_full()) {
     MutexLocker x(FreeList_lock, Mutex::_no_safepoint_check_flag);
-    result = old_gc_alloc_region()->attempt_allocation_locked(min_word_size,
-                                                              desired_word_size,
-                                                              actual_word_size);
+    result = old_gc_alloc_region(node_index)->attempt_allocation_locked(min_word_size,
+                                                                        desired_word_size,
+                                                                        actual_word_size);
     if (result == NULL) {
       set_old_full();
     }
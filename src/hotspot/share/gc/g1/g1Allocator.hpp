@@ -56,9 +56,13 @@ private:
   // survivor objects.
   SurvivorGCAllocRegion* _survivor_gc_alloc_regions;
 
+  // The number of OldGCAllocRegions used, one per memory node if
+  // G1NUMAOldAllocRegions is set.
+  uint _num_old_alloc_regions;
+
   // Alloc region used to satisfy allocation requests by the GC for
   // old objects.
-  OldGCAllocRegion _old_gc_alloc_region;
+  OldGCAllocRegion* _old_gc_alloc_regions;
 
   HeapRegion* _retained_old_gc_alloc_region;
 
@@ -75,7 +79,7 @@ private:
   // Accessors to the allocation regions.
   inline MutatorAllocRegion* mutator_alloc_region(uint node_index);
   inline SurvivorGCAllocRegion* survivor_gc_alloc_region(uint node_index);
-  inline OldGCAllocRegion* old_gc_alloc_region();
+  inline OldGCAllocRegion* old_gc_alloc_region(uint node_index);
 
   // Allocation attempt during GC for a survivor object / PLAB.
   HeapWord* survivor_attempt_allocation(size_t min_word_size,
@@ -86,7 +90,8 @@ private:
   // Allocation attempt during GC for an old object / PLAB.
   HeapWord* old_attempt_allocation(size_t min_word_size,
                                    size_t desired_word_size,
-                                   size_t* actual_word_size);
+                                   size_t* actual_word_size,
+                                   uint node_index);
 
   // Node index of current thread.
   inline uint current_node_index() const;
@@ -96,6 +101,9 @@ public:
   ~G1Allocator();
 
   uint num_nodes() { return (uint)_num_alloc_regions; }
+  uint num_old_alloc_regions() const { return _num_old_alloc_regions; }
+  // Index of the old alloc region used for the given node index.
+  inline uint old_alloc_region_index(uint node_index) const;
 
 #ifdef ASSERT
   // Do we currently have an active mutator region to allocate into?
@@ -166,8 +174,8 @@ private:
   inline PLAB* alloc_buffer(region_type_t dest, uint node_index) const;
 
   // Returns the number of allocation buffers for the given dest.
-  // There is only 1 buffer for Old while Young may have multiple buffers depending on
-  // active NUMA nodes.
+  // Young may have multiple buffers depending on active NUMA nodes, and Old
+  // only if G1NUMAOldAllocRegions is set.
   inline uint alloc_buffers_length(region_type_t dest) const;
 
   bool may_throw_away_buffer(size_t const allocation_word_sz, size_t const buffer_size) const;
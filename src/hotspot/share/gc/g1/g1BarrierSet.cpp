@@ -72,13 +72,29 @@ void G1BarrierSet::enqueue(oop pre_val) {
 template <class T> void
 G1BarrierSet::write_ref_array_pre_work(T* dst, size_t count) {
   if (!_satb_mark_queue_set.is_active()) return;
+  SATBMarkQueue& queue = G1ThreadLocalData::satb_mark_queue(Thread::current());
+  if (!queue.is_active()) return;
+
+  // Collect the previous values in batches, each added to the queue at once.
+  const size_t batch_size = 64;
+  oop batch[batch_size];
+  size_t batched = 0;
   T* elem_ptr = dst;
   for (size_t i = 0; i < count; i++, elem_ptr++) {
     T heap_oop = RawAccess<>::oop_load(elem_ptr);
     if (!CompressedOops::is_null(heap_oop)) {
-      enqueue(CompressedOops::decode_not_null(heap_oop));
+      oop pre_val = CompressedOops::decode_not_null(heap_oop);
+      assert(oopDesc::is_oop(pre_val, true), "Error");
+      batch[batched++] = pre_val;
+      if (batched == batch_size) {
+        _satb_mark_queue_set.enqueue_known_active(queue, batch, batched);
+        batched = 0;
+      }
     }
   }
+  if (batched > 0) {
+    _satb_mark_queue_set.enqueue_known_active(queue, batch, batched);
+  }
 }
 
 void G1BarrierSet::write_ref_array_pre(oop* dst, size_t count, bool dest_uninitialized) {
@@ -118,16 +134,8 @@ void G1BarrierSet::invalidate(MemRegion mr) {
     OrderAccess::storeload();
     // Enqueue if necessary.
     Thread* thr = Thread::current();
-    G1DirtyCardQueueSet& qset = G1BarrierSet::dirty_card_queue_set();
     G1DirtyCardQueue& queue = G1ThreadLocalData::dirty_card_queue(thr);
-    for (; byte <= last_byte; byte++) {
-      CardValue bv = *byte;
-      if ((bv != G1CardTable::g1_young_card_val()) &&
-          (bv != G1CardTable::dirty_card_val())) {
-        *byte = G1CardTable::dirty_card_val();
-        qset.enqueue(queue, byte);
-      }
-    }
+    G1BarrierSet::dirty_card_queue_set().dirty_and_enqueue_range(queue, byte, last_byte);
   }
 }
 
@@ -27,7 +27,6 @@
 #include "gc/g1/g1BatchedGangTask.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1GCParPhaseTimesTracker.hpp"
-#include "runtime/atomic.hpp"
 #include "utilities/growableArray.hpp"
 
 void G1AbstractSubTask::record_work_item(uint worker_id, uint index, size_t count) {
@@ -40,24 +39,20 @@ const char* G1AbstractSubTask::name() const {
   return g1h->phase_times()->phase_name(_tag);
 }
 
-bool G1BatchedGangTask::try_claim_serial_task(int& task) {
-  task = Atomic::fetch_and_add(&_num_serial_tasks_done, 1);
-  return task < _serial_tasks.length();
-}
-
 void G1BatchedGangTask::add_serial_task(G1AbstractSubTask* task) {
   assert(task != nullptr, "must be");
   _serial_tasks.push(task);
+  add_task(task, true /* is_serial */);
 }
 
 void G1BatchedGangTask::add_parallel_task(G1AbstractSubTask* task) {
   assert(task != nullptr, "must be");
   _parallel_tasks.push(task);
+  add_task(task, false /* is_serial */);
 }
 
 G1BatchedGangTask::G1BatchedGangTask(const char* name, G1GCPhaseTimes* phase_times) :
-  AbstractGangTask(name),
-  _num_serial_tasks_done(0),
+  WorkerTaskGraph(name),
   _phase_times(phase_times),
   _serial_tasks(),
   _parallel_tasks() {
@@ -83,22 +78,14 @@ void G1BatchedGangTask::set_max_workers(uint max_workers) {
   }
 }
 
-void G1BatchedGangTask::work(uint worker_id) {
-  int t = 0;
-  while (try_claim_serial_task(t)) {
-    G1AbstractSubTask* task = _serial_tasks.at(t);
-    G1GCParPhaseTimesTracker x(_phase_times, task->tag(), worker_id);
-    task->do_work(worker_id);
-  }
-  for (G1AbstractSubTask* task : _parallel_tasks) {
-    G1GCParPhaseTimesTracker x(_phase_times, task->tag(), worker_id);
-    task->do_work(worker_id);
-  }
+void G1BatchedGangTask::run_sub_task(WorkerSubTask* task, uint worker_id) {
+  G1AbstractSubTask* t = static_cast<G1AbstractSubTask*>(task);
+  G1GCParPhaseTimesTracker x(_phase_times, t->tag(), worker_id);
+  t->do_work(worker_id);
 }
 
 G1BatchedGangTask::~G1BatchedGangTask() {
-  assert(Atomic::load(&_num_serial_tasks_done) >= _serial_tasks.length(),
-         "Only %d tasks of %d claimed", Atomic::load(&_num_serial_tasks_done), _serial_tasks.length());
+  assert(is_complete(), "Not all tasks of %s completed", name());
 
   for (G1AbstractSubTask* task : _parallel_tasks) {
     delete task;
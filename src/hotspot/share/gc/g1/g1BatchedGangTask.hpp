@@ -26,11 +26,9 @@
 #define SHARE_GC_G1_G1BATCHEDGANGTASK_HPP
 
 #include "gc/g1/g1GCPhaseTimes.hpp"
-#include "gc/shared/workgroup.hpp"
+#include "gc/shared/workerTaskGraph.hpp"
 #include "memory/allocation.hpp"
-
-template <typename E, MEMFLAGS F>
-class GrowableArrayCHeap;
+#include "utilities/growableArray.hpp"
 
 // G1AbstractSubTask represents a task to be performed either within a
 // G1BatchedGangTask running on a single worker ("serially") or multiple workers
@@ -47,7 +45,7 @@ class GrowableArrayCHeap;
 // card table.
 //
 // See G1BatchedGangTask for information on execution.
-class G1AbstractSubTask : public CHeapObj<mtGC> {
+class G1AbstractSubTask : public WorkerSubTask {
   G1GCPhaseTimes::GCParPhases _tag;
 
   NONCOPYABLE(G1AbstractSubTask);
@@ -98,7 +96,10 @@ public:
 // tasks are executed by a single worker exactly once, but different "serial"
 // tasks may be executed in parallel using different workers. "Parallel" tasks'
 // do_work() method may be called by different workers passing a different
-// worker_id at the same time, but at most once per given worker_id.
+// worker_id at the same time, but at most once per given worker_id. Workers
+// stop joining a "parallel" task once the first worker returned from its
+// do_work(), so do_work() must only return after all of the task's work has
+// been claimed.
 //
 // There is also no guarantee that G1AbstractSubTasks::do_work() of different tasks
 // are actually run in parallel.
@@ -109,7 +110,8 @@ public:
 //
 // The constructor, destructor and the do_work() methods from different
 // G1AbstractSubTasks may run in any order so they must not have any
-// dependencies at all.
+// dependencies, except for the do_work() methods of tasks ordered with
+// add_dependency(), see WorkerTaskGraph.
 //
 // For a given G1AbstractSubTask T call order of its methods are as follows:
 //
@@ -119,12 +121,9 @@ public:
 // 4) T::do_work()  // potentially in parallel with any other registered G1AbstractSubTask
 // 5) ~T()
 //
-class G1BatchedGangTask : public AbstractGangTask {
-  volatile int _num_serial_tasks_done;
+class G1BatchedGangTask : public WorkerTaskGraph {
   G1GCPhaseTimes* _phase_times;
 
-  bool try_claim_serial_task(int& task);
-
   NONCOPYABLE(G1BatchedGangTask);
 
   GrowableArrayCHeap<G1AbstractSubTask*, mtGC> _serial_tasks;
@@ -136,8 +135,9 @@ protected:
 
   G1BatchedGangTask(const char* name, G1GCPhaseTimes* phase_times);
 
+  void run_sub_task(WorkerSubTask* task, uint worker_id) override;
+
 public:
-  void work(uint worker_id) override;
 
   // How many workers can this gang task keep busy and should be started for
   // "optimal" performance.
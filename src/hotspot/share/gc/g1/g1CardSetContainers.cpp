@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CardSetContainers.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+uint G1CardSetInlinePtr::_bits_per_card = 0;
+uint G1CardSetInlinePtr::_max_cards = 0;
+
+void G1CardSetInlinePtr::initialize(uint log_cards_per_region, uint max_cards_limit) {
+  _bits_per_card = MAX2(log_cards_per_region, 1u);
+  uint max_cards = (BitsPerWord - CardsFieldPos) / _bits_per_card;
+  _max_cards = MIN3(max_cards, MaxCardsLimit, max_cards_limit);
+}
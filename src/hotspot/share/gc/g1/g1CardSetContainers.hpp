@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CARDSETCONTAINERS_HPP
+#define SHARE_GC_G1_G1CARDSETCONTAINERS_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// A G1CardSetInlinePtr is a card set container that stores a small number of
+// card indices of a single (remote) region directly in a pointer-sized word.
+// The word lives at an arbitrary address (e.g. a slot of a remembered set) and
+// cards are added to it lock-free using compare-and-exchange.
+//
+// The layout of the word is:
+//
+//  [ card_N-1 | ... | card_1 | card_0 | size ]
+//  63                                 3      0
+//
+// where "size" is the number of valid cards, and each card takes
+// bits_per_card() bits. Cards are never removed; the only way to get
+// a container back to the empty state is to reset the word at a safepoint.
+//
+// The size value OverflowedSize marks a container whose contents have been
+// transferred to a larger container. Any attempt to add a card to such a
+// container fails with Overflow, and the container appears empty to readers.
+// The caller that marks the container is responsible for moving the cards
+// that were contained at that time to their new location.
+class G1CardSetInlinePtr : public StackObj {
+  uintptr_t volatile* _value_addr;
+  uintptr_t _value;
+
+  static const uint SizeFieldPos = 0;
+  static const uint SizeFieldLen = 3;
+  static const uintptr_t SizeFieldMask = (((uintptr_t)1 << SizeFieldLen) - 1) << SizeFieldPos;
+
+  static const uint CardsFieldPos = SizeFieldPos + SizeFieldLen;
+
+  static const uint OverflowedSize = (1u << SizeFieldLen) - 1;
+
+  static uint _bits_per_card;
+  static uint _max_cards;
+
+  static uint card_pos_for(uint const idx) {
+    return CardsFieldPos + idx * _bits_per_card;
+  }
+
+  static uintptr_t card_mask() {
+    return ((uintptr_t)1 << _bits_per_card) - 1;
+  }
+
+  static uint card_at(uintptr_t value, uint const idx) {
+    return (uint)((value >> card_pos_for(idx)) & card_mask());
+  }
+
+  static uintptr_t merge(uintptr_t orig_value, uint card_idx, uint idx);
+
+  static bool find(uintptr_t value, uint card_idx, uint start_idx, uint num_cards);
+
+public:
+  // Upper bound for max_cards() regardless of the card size.
+  static const uint MaxCardsLimit = OverflowedSize - 1;
+
+  enum AddResult {
+    Added,   // The card has been added.
+    Found,   // The card is already in the container.
+    Overflow // The container is full or has been overflowed; the card has not been added.
+  };
+
+  // Sets up the container layout for the given number of cards per region.
+  // The container never holds more than max_cards_limit cards.
+  static void initialize(uint log_cards_per_region, uint max_cards_limit);
+
+  static uint bits_per_card() { return _bits_per_card; }
+  static uint max_cards() { return _max_cards; }
+
+  static uint num_cards_in(uintptr_t value) {
+    uint result = (uint)((value & SizeFieldMask) >> SizeFieldPos);
+    return result == OverflowedSize ? 0 : result;
+  }
+
+  static bool is_overflowed(uintptr_t value) {
+    return ((value & SizeFieldMask) >> SizeFieldPos) == OverflowedSize;
+  }
+
+  explicit G1CardSetInlinePtr(uintptr_t volatile* value_addr);
+
+  AddResult add(uint card_idx);
+
+  bool contains(uint card_idx);
+
+  // Marks the container as overflowed. Returns the value of the container
+  // before marking, containing the final set of cards.
+  uintptr_t mark_overflowed();
+
+  // Calls found(uint card_idx) for every card in the given container value.
+  template <class CardVisitor>
+  static void iterate(uintptr_t value, CardVisitor& found);
+};
+
+#endif // SHARE_GC_G1_G1CARDSETCONTAINERS_HPP
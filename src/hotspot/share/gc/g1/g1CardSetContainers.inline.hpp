@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CARDSETCONTAINERS_INLINE_HPP
+#define SHARE_GC_G1_G1CARDSETCONTAINERS_INLINE_HPP
+
+#include "gc/g1/g1CardSetContainers.hpp"
+
+#include "runtime/atomic.hpp"
+#include "utilities/debug.hpp"
+
+inline G1CardSetInlinePtr::G1CardSetInlinePtr(uintptr_t volatile* value_addr) :
+  _value_addr(value_addr),
+  _value(Atomic::load(value_addr)) {
+  assert(_bits_per_card != 0, "must be initialized");
+}
+
+inline uintptr_t G1CardSetInlinePtr::merge(uintptr_t orig_value, uint card_idx, uint idx) {
+  assert((idx & (SizeFieldMask >> SizeFieldPos)) == idx, "Index %u too large to fit into size field", idx);
+  assert(card_idx <= card_mask(), "Card index %u does not fit into %u bits", card_idx, _bits_per_card);
+
+  uintptr_t value = ((uintptr_t)(idx + 1) << SizeFieldPos) | ((uintptr_t)card_idx << card_pos_for(idx));
+  return (orig_value & ~SizeFieldMask) | value;
+}
+
+inline bool G1CardSetInlinePtr::find(uintptr_t value, uint card_idx, uint start_idx, uint num_cards) {
+  for (uint i = start_idx; i < num_cards; i++) {
+    if (card_at(value, i) == card_idx) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline G1CardSetInlinePtr::AddResult G1CardSetInlinePtr::add(uint card_idx) {
+  uint cur_idx = 0;
+  while (true) {
+    if (is_overflowed(_value)) {
+      return Overflow;
+    }
+    uint num_cards = num_cards_in(_value);
+    // Cards are only ever appended, so after a failed exchange only the
+    // newly added cards need to be looked at.
+    if (find(_value, card_idx, cur_idx, num_cards)) {
+      return Found;
+    }
+    if (num_cards >= _max_cards) {
+      return Overflow;
+    }
+    uintptr_t new_value = merge(_value, card_idx, num_cards);
+    uintptr_t old_value = Atomic::cmpxchg(_value_addr, _value, new_value);
+    if (old_value == _value) {
+      _value = new_value;
+      return Added;
+    }
+    cur_idx = num_cards;
+    _value = old_value;
+  }
+}
+
+inline bool G1CardSetInlinePtr::contains(uint card_idx) {
+  return find(_value, card_idx, 0, num_cards_in(_value));
+}
+
+inline uintptr_t G1CardSetInlinePtr::mark_overflowed() {
+  while (true) {
+    if (is_overflowed(_value)) {
+      return _value;
+    }
+    uintptr_t new_value = _value | SizeFieldMask;
+    uintptr_t old_value = Atomic::cmpxchg(_value_addr, _value, new_value);
+    if (old_value == _value) {
+      uintptr_t result = _value;
+      _value = new_value;
+      return result;
+    }
+    _value = old_value;
+  }
+}
+
+template <class CardVisitor>
+inline void G1CardSetInlinePtr::iterate(uintptr_t value, CardVisitor& found) {
+  uint const num_cards = num_cards_in(value);
+  for (uint i = 0; i < num_cards; i++) {
+    found(card_at(value, i));
+  }
+}
+
+#endif // SHARE_GC_G1_G1CARDSETCONTAINERS_INLINE_HPP
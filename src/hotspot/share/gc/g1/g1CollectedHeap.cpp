@@ -40,6 +40,7 @@
 #include "gc/g1/g1ConcurrentMarkThread.inline.hpp"
 #include "gc/g1/g1DirtyCardQueue.hpp"
 #include "gc/g1/g1EvacStats.inline.hpp"
+#include "gc/g1/g1FixStaleBOTTask.hpp"
 #include "gc/g1/g1FullCollector.hpp"
 #include "gc/g1/g1GCParPhaseTimesTracker.hpp"
 #include "gc/g1/g1GCPhaseTimes.hpp"
@@ -1337,7 +1338,7 @@ void G1CollectedHeap::shrink_helper(size_t shrink_bytes) {
 void G1CollectedHeap::shrink(size_t shrink_bytes) {
   _verifier->verify_region_sets_optional();
 
-  // We should only reach here at the end of a Full GC or during Remark which
+  // We should only reach here at the end of a GC or during Remark which
   // means we should not not be holding to any GC alloc regions. The method
   // below will make sure of that and do any remaining clean up.
   _allocator->abandon_gc_alloc_regions();
@@ -1481,7 +1482,8 @@ G1CollectedHeap::G1CollectedHeap() :
 
   _heap_sizing_policy = G1HeapSizingPolicy::create(this, _policy->analytics());
 
-  _humongous_object_threshold_in_words = humongous_threshold_for(HeapRegion::GrainWords);
+  _humongous_object_threshold_in_words = MAX2(humongous_threshold_for(HeapRegion::GrainWords),
+                                              HeapRegion::GrainWords / 100 * G1HumongousObjectThresholdPercent);
 
   // Override the default _filler_array_max_size so that no humongous filler
   // objects are created.
@@ -1726,7 +1728,7 @@ jint G1CollectedHeap::initialize() {
   {
     G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
     dcqs.set_process_cards_threshold(concurrent_refine()->yellow_zone());
-    dcqs.set_max_cards(concurrent_refine()->red_zone());
+    dcqs.set_max_cards(concurrent_refine()->mutator_refinement_threshold());
   }
 
   // Here we allocate the dummy HeapRegion that is required by the
@@ -2331,9 +2333,10 @@ size_t G1CollectedHeap::tlab_used(Thread* ignored) const {
 }
 
 // For G1 TLABs should not contain humongous objects, so the maximum TLAB size
-// must be equal to the humongous object limit.
+// must be at most the humongous object limit. A raised humongous object
+// limit (G1HumongousObjectThresholdPercent) does not increase it.
 size_t G1CollectedHeap::max_tlab_size() const {
-  return align_down(_humongous_object_threshold_in_words, MinObjAlignment);
+  return align_down(humongous_threshold_for(HeapRegion::GrainWords), MinObjAlignment);
 }
 
 size_t G1CollectedHeap::unsafe_max_tlab_alloc(Thread* ignored) const {
@@ -2356,6 +2359,21 @@ bool G1CollectedHeap::supports_concurrent_gc_breakpoints() const {
   return true;
 }
 
+bool G1CollectedHeap::supports_object_pinning() const {
+  return G1UseRegionPinning;
+}
+
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  assert(G1UseRegionPinning, "must be");
+  heap_region_containing(obj)->increment_pinned_object_count();
+  return obj;
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  assert(G1UseRegionPinning, "must be");
+  heap_region_containing(obj)->decrement_pinned_object_count();
+}
+
 bool G1CollectedHeap::is_archived_object(oop object) const {
   return object != NULL && heap_region_containing(object)->is_archive();
 }
@@ -2842,7 +2860,24 @@ void G1CollectedHeap::verify_after_young_collection(G1HeapVerifier::G1VerifyType
   verify_numa_regions("GC End");
 }
 
-void G1CollectedHeap::expand_heap_after_young_collection(){
+void G1CollectedHeap::resize_heap_after_young_collection() {
+  if (G1GCCPUTargetPercent > 0) {
+    bool should_expand;
+    size_t resize_bytes = _heap_sizing_policy->young_collection_resize_amount(should_expand);
+    if (resize_bytes == 0) {
+      return;
+    } else if (should_expand) {
+      double expand_ms = 0.0;
+      expand(resize_bytes, _workers, &expand_ms);
+      phase_times()->record_expand_heap_time(expand_ms);
+    } else {
+      // The regions removed from the heap are uncommitted concurrently.
+      shrink(resize_bytes);
+      uncommit_regions_if_necessary();
+    }
+    return;
+  }
+
   size_t expand_bytes = _heap_sizing_policy->young_collection_expansion_amount();
   if (expand_bytes > 0) {
     // No need for an ergo logging here,
@@ -3022,7 +3057,11 @@ void G1CollectedHeap::do_collection_pause_at_safepoint_helper(double target_paus
 
         _allocator->init_mutator_alloc_regions();
 
-        expand_heap_after_young_collection();
+        if (G1DeferOldBOTUpdates) {
+          G1FixStaleBOTTask::enqueue();
+        }
+
+        resize_heap_after_young_collection();
 
         // Refine the type of a concurrent mark operation now that we did the
         // evacuation, eventually aborting it.
@@ -3125,6 +3164,11 @@ bool G1STWIsAliveClosure::do_object_b(oop p) {
   return !_g1h->is_in_cset(p) || p->is_forwarded();
 }
 
+bool G1IsYoungOrHumongousClosure::do_object_b(oop p) {
+  HeapRegion* hr = _g1h->heap_region_containing(p);
+  return hr->is_young() || hr->is_humongous();
+}
+
 bool G1STWSubjectToDiscoveryClosure::do_object_b(oop obj) {
   assert(obj != NULL, "must not be NULL");
   assert(_g1h->is_in_reserved(obj), "Trying to discover obj " PTR_FORMAT " not in heap", p2i(obj));
@@ -3741,8 +3785,14 @@ void G1CollectedHeap::post_evacuate_collection_set(G1EvacuationInfo& evacuation_
 
   G1STWIsAliveClosure is_alive(this);
   G1KeepAliveClosure keep_alive(this);
-
-  WeakProcessor::weak_oops_do(workers(), &is_alive, &keep_alive, p->weak_phase_times());
+  // Only referents in young regions may move in a young-only pause. Count
+  // humongous objects as young too, because G1KeepAliveClosure must see any
+  // eager reclaim candidates among them.
+  G1IsYoungOrHumongousClosure is_young(this);
+  bool young_only = YoungGCSkipsOldWeakRoots && collection_set()->old_region_length() == 0;
+
+  WeakProcessor::weak_oops_do(workers(), &is_alive, &keep_alive, p->weak_phase_times(),
+                              young_only ? &is_young : NULL);
 
   _allocator->release_gc_alloc_regions(evacuation_info);
 
@@ -117,6 +117,13 @@ public:
   bool do_object_b(oop p);
 };
 
+class G1IsYoungOrHumongousClosure : public BoolObjectClosure {
+  G1CollectedHeap* _g1h;
+public:
+  G1IsYoungOrHumongousClosure(G1CollectedHeap* g1h) : _g1h(g1h) {}
+  bool do_object_b(oop p);
+};
+
 class G1STWSubjectToDiscoveryClosure : public BoolObjectClosure {
   G1CollectedHeap* _g1h;
 public:
@@ -622,9 +629,7 @@ public:
 
   // We register a region with the fast "in collection set" test. We
   // simply set to true the array slot corresponding to this region.
-  void register_young_region_with_region_attr(HeapRegion* r) {
-    _region_attr.set_in_young(r->hrm_index());
-  }
+  inline void register_young_region_with_region_attr(HeapRegion* r);
   inline void register_region_with_region_attr(HeapRegion* r);
   inline void register_old_region_with_region_attr(HeapRegion* r);
   inline void register_optional_region_with_region_attr(HeapRegion* r);
@@ -830,7 +835,7 @@ public:
                                     G1RedirtyCardsQueueSet* rdcqs,
                                     G1ParScanThreadStateSet* pss);
 
-  void expand_heap_after_young_collection();
+  void resize_heap_after_young_collection();
   // Update object copying statistics.
   void record_obj_copy_mem_stats();
 
@@ -1435,6 +1440,11 @@ public:
 
   virtual WorkGang* safepoint_workers() { return _workers; }
 
+  // Object pinning with G1UseRegionPinning, see HeapRegion::has_pinned_objects().
+  virtual bool supports_object_pinning() const;
+  virtual oop pin_object(JavaThread* thread, oop obj);
+  virtual void unpin_object(JavaThread* thread, oop obj);
+
   virtual bool is_archived_object(oop object) const;
 
   // The methods below are here for convenience and dispatch the
@@ -31,6 +31,7 @@
 #include "gc/g1/g1CollectorState.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1RemSet.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionManager.inline.hpp"
 #include "gc/g1/heapRegionRemSet.hpp"
 #include "gc/g1/heapRegionSet.inline.hpp"
@@ -181,8 +182,12 @@ void G1CollectedHeap::register_region_with_region_attr(HeapRegion* r) {
   _region_attr.set_has_remset(r->hrm_index(), r->rem_set()->is_tracked());
 }
 
+void G1CollectedHeap::register_young_region_with_region_attr(HeapRegion* r) {
+  _region_attr.set_in_young(r->hrm_index(), r->has_pinned_objects());
+}
+
 void G1CollectedHeap::register_old_region_with_region_attr(HeapRegion* r) {
-  _region_attr.set_in_old(r->hrm_index(), r->rem_set()->is_tracked());
+  _region_attr.set_in_old(r->hrm_index(), r->rem_set()->is_tracked(), r->has_pinned_objects());
   _rem_set->exclude_region_from_scan(r->hrm_index());
 }
 
@@ -173,6 +173,19 @@ class G1BuildCandidateRegionsTask : public AbstractGangTask {
 
     bool should_add(HeapRegion* hr) { return G1CollectionSetChooser::should_add(hr); }
 
+    // Regions with a predicted evacuation time that is a large part of the
+    // pause time goal (typically because of a huge remembered set) would make
+    // any mixed gc including them miss its goal. Do not keep them as candidates,
+    // which also saves maintaining their remembered sets until the next marking.
+    bool too_expensive(HeapRegion* hr) const {
+      if (G1MixedGCMaxRegionTimePercent == 0) {
+        return false;
+      }
+      G1Policy* p = G1CollectedHeap::heap()->policy();
+      double const max_time_ms = p->max_pause_time_ms() * G1MixedGCMaxRegionTimePercent / 100.0;
+      return p->predict_region_total_time_ms(hr, false /* for_young_gc */) > max_time_ms;
+    }
+
   public:
     G1BuildCandidateRegionsClosure(G1BuildCandidateArray* array) :
       _array(array),
@@ -185,7 +198,7 @@ class G1BuildCandidateRegionsTask : public AbstractGangTask {
       // We will skip any region that's currently used as an old GC
       // alloc region (we should not consider those for collection
       // before we fill them up).
-      if (should_add(r) && !G1CollectedHeap::heap()->is_old_gc_alloc_region(r)) {
+      if (should_add(r) && !G1CollectedHeap::heap()->is_old_gc_alloc_region(r) && !too_expensive(r)) {
         add_region(r);
       } else if (r->is_old()) {
         // Keep remembered sets for humongous regions, otherwise clean out remembered
@@ -606,7 +606,12 @@ private:
         }
 
         MemRegion mr(cur, MIN2(cur + chunk_size_in_words, end));
-        _bitmap->clear_range(mr);
+        // Most of the bitmap is typically already clear, e.g. for free and
+        // young regions. Reading it is cheaper than writing it, and avoids
+        // dirtying the memory of untouched parts of the bitmap.
+        if (_bitmap->get_next_marked_addr(mr.start(), mr.end()) < mr.end()) {
+          _bitmap->clear_range(mr);
+        }
 
         cur += chunk_size_in_words;
 
@@ -1588,9 +1593,47 @@ public:
   }
 };
 
+class G1CMParallelPrecleanTask : public AbstractGangTask {
+  G1ConcurrentMark* _cm;
+
+public:
+  G1CMParallelPrecleanTask(G1ConcurrentMark* cm) :
+    AbstractGangTask("Parallel Preclean"), _cm(cm) { }
+
+  void work(uint worker_id) {
+    SuspendibleThreadSetJoiner joiner;
+
+    G1CMTask* task = _cm->task(worker_id);
+    G1CMKeepAliveAndDrainClosure keep_alive(_cm, task, false /* is_serial */);
+    G1CMDrainMarkingStackClosure drain_mark_stack(_cm, task, false /* is_serial */);
+    G1PrecleanYieldClosure yield_cl(_cm);
+
+    // With MT discovery, references found while tracing are added to the
+    // lists of the discovering worker thread, so every worker only touches
+    // the lists of its own thread. Lists of threads that do not take part
+    // are left for Remark.
+    ReferenceProcessor* rp = G1CollectedHeap::heap()->ref_processor_cm();
+    rp->preclean_discovered_lists(WorkerThread::current()->id(),
+                                  rp->is_alive_non_header(),
+                                  &keep_alive,
+                                  &drain_mark_stack,
+                                  &yield_cl);
+  }
+};
+
 void G1ConcurrentMark::preclean() {
   assert(G1UseReferencePrecleaning, "Precleaning must be enabled.");
 
+  ReferenceProcessor* rp = _g1h->ref_processor_cm();
+  uint active_workers = _concurrent_workers->active_workers();
+  if (G1UseParallelReferencePrecleaning && active_workers > 1 && rp->discovery_is_mt()) {
+    GCTraceTime(Debug, gc, ref) tm("Parallel Preclean", _gc_timer_cm);
+    set_concurrency_and_phase(active_workers, true /* concurrent */);
+    G1CMParallelPrecleanTask preclean_task(this);
+    _concurrent_workers->run_task(&preclean_task, active_workers);
+    return;
+  }
+
   SuspendibleThreadSetJoiner joiner;
 
   G1CMKeepAliveAndDrainClosure keep_alive(this, task(0), true /* is_serial */);
@@ -1600,7 +1643,6 @@ void G1ConcurrentMark::preclean() {
 
   G1PrecleanYieldClosure yield_cl(this);
 
-  ReferenceProcessor* rp = _g1h->ref_processor_cm();
   // Precleaning is single threaded. Temporarily disable MT discovery.
   ReferenceProcessorMTDiscoveryMutator rp_mut_discovery(rp, false);
   rp->preclean_discovered_references(rp->is_alive_non_header(),
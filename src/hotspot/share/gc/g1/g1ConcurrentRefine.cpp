@@ -394,7 +394,7 @@ void G1ConcurrentRefine::adjust(double logged_cards_scan_time,
       size_t activate = activation_threshold(0);
       dcqs.set_process_cards_threshold(activate);
     }
-    dcqs.set_max_cards(red_zone());
+    dcqs.set_max_cards(mutator_refinement_threshold());
   }
 
   size_t curr_queue_size = dcqs.num_cards();
@@ -407,6 +407,10 @@ void G1ConcurrentRefine::adjust(double logged_cards_scan_time,
   dcqs.notify_if_necessary();
 }
 
+size_t G1ConcurrentRefine::mutator_refinement_threshold() const {
+  return G1UseMutatorRefinement ? red_zone() : G1DirtyCardQueueSet::MaxCardsUnlimited;
+}
+
 G1ConcurrentRefineStats G1ConcurrentRefine::get_and_reset_refinement_stats() {
   struct CollectStats : public ThreadClosure {
     G1ConcurrentRefineStats _total_stats;
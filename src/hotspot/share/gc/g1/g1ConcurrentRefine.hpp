@@ -142,6 +142,10 @@ public:
   size_t green_zone() const      { return _green_zone;  }
   size_t yellow_zone() const     { return _yellow_zone; }
   size_t red_zone() const        { return _red_zone;    }
+
+  // Number of cards in the dirty card queue set above which mutator
+  // threads refine cards themselves, see G1UseMutatorRefinement.
+  size_t mutator_refinement_threshold() const;
 };
 
 #endif // SHARE_GC_G1_G1CONCURRENTREFINE_HPP
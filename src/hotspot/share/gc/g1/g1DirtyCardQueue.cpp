@@ -103,6 +103,29 @@ void G1DirtyCardQueueSet::enqueue(G1DirtyCardQueue& queue,
   }
 }
 
+void G1DirtyCardQueueSet::dirty_and_enqueue_range(G1DirtyCardQueue& queue,
+                                                  volatile CardValue* first,
+                                                  volatile CardValue* last) {
+  size_t index = queue.index();
+  void** buffer = queue.buffer();
+  for (volatile CardValue* card_ptr = first; card_ptr <= last; card_ptr++) {
+    CardValue value = *card_ptr;
+    if ((value == G1CardTable::g1_young_card_val()) ||
+        (value == G1CardTable::dirty_card_val())) {
+      continue;
+    }
+    *card_ptr = G1CardTable::dirty_card_val();
+    if (index == 0) {
+      queue.set_index(0);
+      handle_zero_index(queue);
+      index = queue.index();
+      buffer = queue.buffer();
+    }
+    buffer[--index] = const_cast<CardValue*>(card_ptr);
+  }
+  queue.set_index(index);
+}
+
 void G1DirtyCardQueueSet::handle_zero_index(G1DirtyCardQueue& queue) {
   assert(queue.index() == 0, "precondition");
   BufferNode* old_node = exchange_buffer_with_new(queue);
@@ -181,7 +181,6 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
   // mutator must start doing some of the concurrent refinement work.
   size_t _max_cards;
   volatile size_t _padded_max_cards;
-  static const size_t MaxCardsUnlimited = SIZE_MAX;
 
   G1ConcurrentRefineStats _detached_refinement_stats;
 
@@ -282,6 +281,13 @@ public:
   using CardValue = G1CardTable::CardValue;
   void enqueue(G1DirtyCardQueue& queue, volatile CardValue* card_ptr);
 
+  // Dirty and enqueue the cards in [first, last] that are neither young
+  // nor already dirty. The cards are added directly to the buffer, with
+  // the index only written back when the buffer is full or at the end.
+  void dirty_and_enqueue_range(G1DirtyCardQueue& queue,
+                               volatile CardValue* first,
+                               volatile CardValue* last);
+
   // If there are more than stop_at cards in the completed buffers, pop
   // a buffer, refine its contents, and return true.  Otherwise return
   // false.  Updates stats.
@@ -312,6 +318,9 @@ public:
   // are concurrent refinement threads.
   size_t max_cards() const;
 
+  // Value for set_max_cards() that disables mutator refinement.
+  static const size_t MaxCardsUnlimited = SIZE_MAX;
+
   // Set threshold for mutator threads to also do refinement.
   void set_max_cards(size_t value);
 
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1FixStaleBOTTask.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
+#include "utilities/ticks.hpp"
+
+G1FixStaleBOTTask* G1FixStaleBOTTask::_instance = NULL;
+
+G1FixStaleBOTTask::G1FixStaleBOTTask() :
+    G1ServiceTask("G1 Fix Stale BOT Task"),
+    _active(false) { }
+
+void G1FixStaleBOTTask::initialize() {
+  assert(_instance == NULL, "Already initialized");
+  _instance = new G1FixStaleBOTTask();
+
+  // Register the task with the service thread. This will automatically
+  // schedule the task so we change the state to active.
+  _instance->_active = true;
+  G1CollectedHeap::heap()->service_thread()->register_task(_instance);
+}
+
+G1FixStaleBOTTask* G1FixStaleBOTTask::instance() {
+  if (_instance == NULL) {
+    initialize();
+  }
+  return _instance;
+}
+
+void G1FixStaleBOTTask::enqueue() {
+  assert_at_safepoint_on_vm_thread();
+
+  G1FixStaleBOTTask* task = instance();
+  if (!task->_active) {
+    task->_active = true;
+    G1CollectedHeap::heap()->service_thread()->schedule_task(task, 0);
+  }
+}
+
+class G1FixStaleBOTClosure : public HeapRegionClosure {
+  uint _fixed;
+
+public:
+  G1FixStaleBOTClosure() : _fixed(0) { }
+
+  bool do_heap_region(HeapRegion* r) {
+    if (r->has_stale_bot()) {
+      r->fix_stale_bot(r->end());
+      _fixed++;
+    }
+    // Give way to a pending pause.
+    return SuspendibleThreadSet::should_yield();
+  }
+
+  uint fixed() const { return _fixed; }
+};
+
+void G1FixStaleBOTTask::execute() {
+  assert(_active, "Must be active");
+
+  // Prevent from running during a GC pause.
+  SuspendibleThreadSetJoiner sts;
+
+  Ticks start = Ticks::now();
+  G1FixStaleBOTClosure cl;
+  G1CollectedHeap::heap()->heap_region_iterate(&cl);
+
+  log_debug(gc, heap)("Concurrent Fix Stale BOT: %u regions, %1.3fms",
+                      cl.fixed(), (Ticks::now() - start).seconds() * 1000);
+
+  if (!cl.is_complete()) {
+    schedule(FixTaskDelayMs);
+  } else {
+    _active = false;
+  }
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1FIXSTALEBOTTASK_HPP
+#define SHARE_GC_G1_G1FIXSTALEBOTTASK_HPP
+
+#include "gc/g1/g1ServiceThread.hpp"
+
+// Task updating the BOT of old regions that were allocated into
+// without BOT updates during evacuation (G1DeferOldBOTUpdates).
+class G1FixStaleBOTTask : public G1ServiceTask {
+  // The delay between two executions of the task when it had to
+  // yield to a pause.
+  static const uint FixTaskDelayMs = 10;
+
+  static G1FixStaleBOTTask* _instance;
+  static void initialize();
+  static G1FixStaleBOTTask* instance();
+
+  // Prevents the task from being enqueued more than once. Only set in
+  // a safepoint and only cleared by the task itself while joined with
+  // the suspendible thread set.
+  bool _active;
+
+  G1FixStaleBOTTask();
+
+public:
+  static void enqueue();
+  virtual void execute();
+};
+
+#endif // SHARE_GC_G1_G1FIXSTALEBOTTASK_HPP
@@ -61,6 +61,9 @@ class G1FullCollector : StackObj {
   G1FullGCScope             _scope;
   uint                      _num_workers;
   G1FullGCMarker**          _markers;
+  // Every worker fills G1FullGCCompactionChunksPerWorker compaction points
+  // in the prepare phase, starting at index worker_id * G1FullGCCompactionChunksPerWorker.
+  uint                      _num_compaction_points;
   G1FullGCCompactionPoint** _compaction_points;
   OopQueueSet               _oop_queue_set;
   ObjArrayTaskQueueSet      _array_queue_set;
@@ -91,7 +94,11 @@ public:
   G1FullGCScope*           scope() { return &_scope; }
   uint                     workers() { return _num_workers; }
   G1FullGCMarker*          marker(uint id) { return _markers[id]; }
-  G1FullGCCompactionPoint* compaction_point(uint id) { return _compaction_points[id]; }
+  uint                     num_compaction_points() { return _num_compaction_points; }
+  G1FullGCCompactionPoint* compaction_point(uint id) {
+    assert(id < _num_compaction_points, "sanity");
+    return _compaction_points[id];
+  }
   OopQueueSet*             oop_queue_set() { return &_oop_queue_set; }
   ObjArrayTaskQueueSet*    array_queue_set() { return &_array_queue_set; }
   PreservedMarksSet*       preserved_mark_set() { return &_preserved_marks_set; }
@@ -33,6 +33,7 @@
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/ticks.hpp"
 
 // Do work for all skip-compacting regions.
@@ -89,14 +90,25 @@ void G1FullGCCompactTask::compact_region(HeapRegion* hr) {
   hr->reset_compacted_after_full_gc();
 }
 
-void G1FullGCCompactTask::work(uint worker_id) {
-  Ticks start = Ticks::now();
-  GrowableArray<HeapRegion*>* compaction_queue = collector()->compaction_point(worker_id)->regions();
+void G1FullGCCompactTask::compact_regions(GrowableArray<HeapRegion*>* compaction_queue) {
   for (GrowableArrayIterator<HeapRegion*> it = compaction_queue->begin();
        it != compaction_queue->end();
        ++it) {
     compact_region(*it);
   }
+}
+
+void G1FullGCCompactTask::work(uint worker_id) {
+  Ticks start = Ticks::now();
+  // Objects only move within the regions of one compaction point, so the
+  // compaction points can be compacted independently. Claim them dynamically
+  // so that workers that finish early take over the remaining ones.
+  uint num_compaction_points = collector()->num_compaction_points();
+  for (uint i = Atomic::fetch_and_add(&_next_compaction_point, 1u);
+       i < num_compaction_points;
+       i = Atomic::fetch_and_add(&_next_compaction_point, 1u)) {
+    compact_regions(collector()->compaction_point(i)->regions());
+  }
 
   G1ResetSkipCompactingClosure hc(collector());
   G1CollectedHeap::heap()->heap_region_par_iterate_from_worker_offset(&hc, &_claimer, worker_id);
@@ -105,10 +117,5 @@ void G1FullGCCompactTask::work(uint worker_id) {
 
 void G1FullGCCompactTask::serial_compaction() {
   GCTraceTime(Debug, gc, phases) tm("Phase 4: Serial Compaction", collector()->scope()->timer());
-  GrowableArray<HeapRegion*>* compaction_queue = collector()->serial_compaction_point()->regions();
-  for (GrowableArrayIterator<HeapRegion*> it = compaction_queue->begin();
-       it != compaction_queue->end();
-       ++it) {
-    compact_region(*it);
-  }
+  compact_regions(collector()->serial_compaction_point()->regions());
 }
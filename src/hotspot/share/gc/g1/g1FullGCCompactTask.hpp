@@ -37,14 +37,18 @@ class G1CMBitMap;
 class G1FullGCCompactTask : public G1FullGCTask {
 protected:
   HeapRegionClaimer _claimer;
+  // Index of the next compaction point to claim.
+  volatile uint _next_compaction_point;
 
 private:
   void compact_region(HeapRegion* hr);
+  void compact_regions(GrowableArray<HeapRegion*>* compaction_queue);
 
 public:
   G1FullGCCompactTask(G1FullCollector* collector) :
     G1FullGCTask("G1 Compact Task", collector),
-    _claimer(collector->workers()) { }
+    _claimer(collector->workers()),
+    _next_compaction_point(0) { }
   void work(uint worker_id);
   void serial_compaction();
 
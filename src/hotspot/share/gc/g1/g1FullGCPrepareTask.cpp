@@ -73,6 +73,12 @@ bool G1FullGCPrepareTask::G1CalculatePointersClosure::do_heap_region(HeapRegion*
       }
     } else if (hr->is_closed_archive()) {
       // nothing to do with closed archive region
+    } else if (hr->has_pinned_objects()) {
+      // Already set to skip compaction before marking.
+      if (hr->is_young()) {
+        // Recreate BOT information like for high live ratio young regions below.
+        hr->update_bot();
+      }
     } else {
       assert(MarkSweepDeadRatio > 0,
              "only skip compaction for other regions when MarkSweepDeadRatio > 0");
@@ -100,7 +106,17 @@ bool G1FullGCPrepareTask::G1CalculatePointersClosure::do_heap_region(HeapRegion*
 G1FullGCPrepareTask::G1FullGCPrepareTask(G1FullCollector* collector) :
     G1FullGCTask("G1 Prepare Compact Task", collector),
     _freed_regions(false),
-    _hrclaimer(collector->workers()) {
+    _hrclaimer(collector->workers()),
+    _chunk_live_words(SIZE_MAX) {
+  if (G1FullGCCompactionChunksPerWorker > 1) {
+    // Split the live data evenly across all compaction points, so that the
+    // compaction phase can balance the work by claiming them.
+    size_t total_live_words = 0;
+    for (uint i = 0; i < G1CollectedHeap::heap()->max_regions(); i++) {
+      total_live_words += collector->live_words(i);
+    }
+    _chunk_live_words = MAX2(total_live_words / collector->num_compaction_points(), (size_t)1);
+  }
 }
 
 void G1FullGCPrepareTask::set_freed_regions() {
@@ -115,11 +131,10 @@ bool G1FullGCPrepareTask::has_freed_regions() {
 
 void G1FullGCPrepareTask::work(uint worker_id) {
   Ticks start = Ticks::now();
-  G1FullGCCompactionPoint* compaction_point = collector()->compaction_point(worker_id);
-  G1CalculatePointersClosure closure(collector(), compaction_point);
+  G1CalculatePointersClosure closure(collector(), worker_id, _chunk_live_words);
   G1CollectedHeap::heap()->heap_region_par_iterate_from_start(&closure, &_hrclaimer);
 
-  compaction_point->update();
+  closure.update_compaction_points();
 
   // Check if any regions was freed by this worker and store in task.
   if (closure.freed_regions()) {
@@ -129,15 +144,41 @@ void G1FullGCPrepareTask::work(uint worker_id) {
 }
 
 G1FullGCPrepareTask::G1CalculatePointersClosure::G1CalculatePointersClosure(G1FullCollector* collector,
-                                                                            G1FullGCCompactionPoint* cp) :
+                                                                            uint worker_id,
+                                                                            size_t chunk_live_words) :
     _g1h(G1CollectedHeap::heap()),
     _collector(collector),
     _bitmap(collector->mark_bitmap()),
-    _cp(cp),
-    _regions_freed(false) { }
+    _cp(NULL),
+    _regions_freed(false),
+    _first_cp(worker_id * G1FullGCCompactionChunksPerWorker),
+    _last_cp(_first_cp + G1FullGCCompactionChunksPerWorker - 1),
+    _current_cp(_first_cp),
+    _chunk_live_words(chunk_live_words),
+    _current_live_words(0) {
+  _cp = collector->compaction_point(_current_cp);
+}
+
+void G1FullGCPrepareTask::G1CalculatePointersClosure::switch_compaction_point_if_full(HeapRegion* hr) {
+  size_t live_words = _collector->live_words(hr->hrm_index());
+  if (_current_live_words > 0 &&
+      _current_live_words + live_words > _chunk_live_words &&
+      _current_cp < _last_cp) {
+    _current_cp++;
+    _cp = _collector->compaction_point(_current_cp);
+    _current_live_words = 0;
+  }
+  _current_live_words += live_words;
+}
+
+void G1FullGCPrepareTask::G1CalculatePointersClosure::update_compaction_points() {
+  for (uint i = _first_cp; i <= _current_cp; i++) {
+    _collector->compaction_point(i)->update();
+  }
+}
 
 bool G1FullGCPrepareTask::G1CalculatePointersClosure::should_compact(HeapRegion* hr) {
-  if (hr->is_pinned()) {
+  if (hr->is_pinned() || hr->has_pinned_objects()) {
     return false;
   }
   size_t live_words = _collector->live_words(hr->hrm_index());
@@ -188,6 +229,7 @@ void G1FullGCPrepareTask::G1CalculatePointersClosure::prepare_for_compaction_wor
 }
 
 void G1FullGCPrepareTask::G1CalculatePointersClosure::prepare_for_compaction(HeapRegion* hr) {
+  switch_compaction_point_if_full(hr);
   if (!_cp->is_initialized()) {
     hr->set_compaction_top(hr->bottom());
     _cp->initialize(hr, true);
@@ -203,7 +245,7 @@ void G1FullGCPrepareTask::prepare_serial_compaction() {
   // the parallel compaction. That means that the last region of
   // all compaction queues still have data in them. We try to compact
   // these regions in serial to avoid a premature OOM.
-  for (uint i = 0; i < collector()->workers(); i++) {
+  for (uint i = 0; i < collector()->num_compaction_points(); i++) {
     G1FullGCCompactionPoint* cp = collector()->compaction_point(i);
     if (cp->has_regions()) {
       collector()->serial_compaction_point()->add(cp->remove_last());
@@ -234,17 +276,20 @@ bool G1FullGCPrepareTask::G1CalculatePointersClosure::freed_regions() {
     return true;
   }
 
-  if (!_cp->has_regions()) {
-    // No regions in queue, so no free ones either.
-    return false;
-  }
+  for (uint i = _first_cp; i <= _current_cp; i++) {
+    G1FullGCCompactionPoint* cp = _collector->compaction_point(i);
+    if (!cp->has_regions()) {
+      // No regions in queue, so no free ones either.
+      continue;
+    }
 
-  if (_cp->current_region() != _cp->regions()->last()) {
-    // The current region used for compaction is not the last in the
-    // queue. That means there is at least one free region in the queue.
-    return true;
+    if (cp->current_region() != cp->regions()->last()) {
+      // The current region used for compaction is not the last in the
+      // queue. That means there is at least one free region in the queue.
+      return true;
+    }
   }
 
-  // No free regions in the queue.
+  // No free regions in the queues.
   return false;
 }
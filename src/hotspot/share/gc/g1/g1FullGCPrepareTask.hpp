@@ -39,6 +39,9 @@ class G1FullGCPrepareTask : public G1FullGCTask {
 protected:
   volatile bool     _freed_regions;
   HeapRegionClaimer _hrclaimer;
+  // Amount of live words after which a worker continues with its next
+  // compaction point.
+  size_t            _chunk_live_words;
 
   void set_freed_regions();
 
@@ -60,6 +63,15 @@ protected:
     G1FullGCCompactionPoint* _cp;
     bool _regions_freed;
 
+    // The compaction points of this worker are [_first_cp, _last_cp].
+    uint _first_cp;
+    uint _last_cp;
+    uint _current_cp;
+    size_t _chunk_live_words;
+    size_t _current_live_words;
+
+    void switch_compaction_point_if_full(HeapRegion* hr);
+
     bool should_compact(HeapRegion* hr);
     void prepare_for_compaction(HeapRegion* hr);
     void prepare_for_compaction_work(G1FullGCCompactionPoint* cp, HeapRegion* hr);
@@ -68,10 +80,12 @@ protected:
 
   public:
     G1CalculatePointersClosure(G1FullCollector* collector,
-                               G1FullGCCompactionPoint* cp);
+                               uint worker_id,
+                               size_t chunk_live_words);
 
     bool do_heap_region(HeapRegion* hr);
     bool freed_regions();
+    void update_compaction_points();
   };
 
   class G1PrepareCompactLiveClosure : public StackObj {
@@ -38,7 +38,8 @@ G1HeapSizingPolicy* G1HeapSizingPolicy::create(const G1CollectedHeap* g1h, const
 G1HeapSizingPolicy::G1HeapSizingPolicy(const G1CollectedHeap* g1h, const G1Analytics* analytics) :
   _g1h(g1h),
   _analytics(analytics),
-  _num_prev_pauses_for_heuristics(analytics->number_of_recorded_pause_times()) {
+  _num_prev_pauses_for_heuristics(analytics->number_of_recorded_pause_times()),
+  _cpu_target_error_sum(0.0) {
 
   assert(MinOverThresholdForGrowth < _num_prev_pauses_for_heuristics, "Threshold must be less than %u", _num_prev_pauses_for_heuristics);
   clear_ratio_check_data();
@@ -212,6 +213,67 @@ static size_t target_heap_capacity(size_t used_bytes, uintx free_ratio) {
   return (size_t) desired_capacity_d;
 }
 
+size_t G1HeapSizingPolicy::young_collection_resize_amount(bool& expand) {
+  assert(G1GCCPUTargetPercent > 0, "must be");
+
+  // Gain of the proportional and integral terms, and the limit of the
+  // integral term to avoid overshooting after long phases far from the
+  // target.
+  double const ProportionalGain = 0.1;
+  double const IntegralGain = 0.02;
+  double const MaxErrorSum = 5.0;
+  // At most change the heap size by this fraction of the committed size
+  // after a single collection.
+  double const MaxResizeFraction = 0.1;
+
+  const double target = G1GCCPUTargetPercent / 100.0;
+  const double pause_time_ratio = _analytics->short_term_pause_time_ratio();
+
+  // Relative deviation from the target; positive if we spend too much time
+  // in GC and should expand.
+  double error = clamp((pause_time_ratio - target) / target, -1.0, 1.0);
+  _cpu_target_error_sum = clamp(_cpu_target_error_sum + error, -MaxErrorSum, MaxErrorSum);
+
+  double resize_fraction = ProportionalGain * error + IntegralGain * _cpu_target_error_sum;
+  resize_fraction = clamp(resize_fraction, -MaxResizeFraction, MaxResizeFraction);
+
+  const size_t committed_bytes = _g1h->capacity();
+  size_t resize_bytes = (size_t)(committed_bytes * fabs(resize_fraction));
+
+  if (resize_fraction > 0.0) {
+    expand = true;
+    size_t uncommitted_bytes = _g1h->max_capacity() - committed_bytes;
+    if (uncommitted_bytes == 0) {
+      // Fully expanded; do not let the integral term wind up further.
+      _cpu_target_error_sum = MIN2(_cpu_target_error_sum, 0.0);
+      resize_bytes = 0;
+    } else {
+      resize_bytes = clamp(resize_bytes, HeapRegion::GrainBytes, uncommitted_bytes);
+    }
+  } else {
+    expand = false;
+    // Keep enough free space for the application to run at MinHeapFreeRatio,
+    // and never go below the minimum heap size.
+    const size_t used_bytes = committed_bytes - _g1h->unused_committed_regions_in_bytes();
+    size_t min_capacity = MAX2(target_heap_capacity(used_bytes, MinHeapFreeRatio), MinHeapSize);
+    size_t max_shrink_bytes = committed_bytes > min_capacity ? committed_bytes - min_capacity : 0;
+    if (max_shrink_bytes == 0) {
+      _cpu_target_error_sum = MAX2(_cpu_target_error_sum, 0.0);
+    }
+    resize_bytes = MIN2(resize_bytes, max_shrink_bytes);
+    if (resize_bytes < HeapRegion::GrainBytes) {
+      resize_bytes = 0;
+    }
+  }
+
+  log_debug(gc, ergo, heap)("Heap resize: pause time ratio %1.2f%% target %1.2f%% "
+                            "error %1.2f error sum %1.2f %s by " SIZE_FORMAT "B",
+                            pause_time_ratio * 100.0, target * 100.0,
+                            error, _cpu_target_error_sum,
+                            expand ? "expand" : "shrink", resize_bytes);
+  return resize_bytes;
+}
+
 size_t G1HeapSizingPolicy::full_collection_resize_amount(bool& expand) {
   // Capacity, free and used after the GC counted as full regions to
   // include the waste in the following calculations.
@@ -45,6 +45,10 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   double _ratio_over_threshold_sum;
   uint _pauses_since_start;
 
+  // Accumulated relative deviation of the pause time ratio from
+  // G1GCCPUTargetPercent, the integral term of the resize controller.
+  double _cpu_target_error_sum;
+
   // Scale "full" gc pause time threshold with heap size as we want to resize more
   // eagerly at small heap sizes.
   double scale_with_heap(double pause_time_threshold);
@@ -56,6 +60,11 @@ public:
   // exceeded the desired limit, return an amount to expand by.
   size_t young_collection_expansion_amount();
 
+  // Returns the amount of bytes to resize the heap after a young collection
+  // to move the pause time ratio towards G1GCCPUTargetPercent; if expand is
+  // set, the heap should be expanded by that amount, shrunk otherwise.
+  size_t young_collection_resize_amount(bool& expand);
+
   // Returns the amount of bytes to resize the heap; if expand is set, the heap
   // should by expanded by that amount, shrunk otherwise.
   size_t full_collection_resize_amount(bool& expand);
@@ -29,6 +29,8 @@
 #include "gc/g1/g1MemoryPool.hpp"
 #include "gc/shared/hSpaceCounters.hpp"
 #include "memory/metaspaceCounters.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/orderAccess.hpp"
 #include "services/memoryPool.hpp"
 
 class G1GenerationCounters : public GenerationCounters {
@@ -110,7 +112,8 @@ G1MonitoringSupport::G1MonitoringSupport(G1CollectedHeap* g1h) :
   _eden_space_used(0),
   _survivor_space_committed(0),
   _survivor_space_used(0),
-  _old_gen_used(0) {
+  _old_gen_used(0),
+  _sizes_version(0) {
 
   recalculate_sizes();
 
@@ -202,9 +205,24 @@ void G1MonitoringSupport::initialize_serviceability() {
   _incremental_memory_manager.add_pool(_old_gen_pool, false /* always_affected_by_gc */);
 }
 
+MemoryUsage G1MonitoringSupport::read_memory_usage(size_t initial_size, const size_t* used,
+                                                   const size_t* committed, size_t max_size) {
+  while (true) {
+    uint version = Atomic::load_acquire(&_sizes_version);
+    if ((version & 1) == 0) {
+      size_t used_value = Atomic::load(used);
+      size_t committed_value = Atomic::load(committed);
+      OrderAccess::loadload();
+      if (Atomic::load(&_sizes_version) == version) {
+        return MemoryUsage(initial_size, used_value, committed_value, max_size);
+      }
+    }
+    SpinPause();
+  }
+}
+
 MemoryUsage G1MonitoringSupport::memory_usage() {
-  MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
-  return MemoryUsage(InitialHeapSize, _overall_used, _overall_committed, _g1h->max_capacity());
+  return read_memory_usage(InitialHeapSize, &_overall_used, &_overall_committed, _g1h->max_capacity());
 }
 
 GrowableArray<GCMemoryManager*> G1MonitoringSupport::memory_managers() {
@@ -226,6 +244,12 @@ void G1MonitoringSupport::recalculate_sizes() {
   assert_heap_locked_or_at_safepoint(true);
 
   MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
+  // Writers are serialized by the lock; readers retry until they see the
+  // same even version before and after reading.
+  uint version = _sizes_version;
+  Atomic::store(&_sizes_version, version + 1);
+  OrderAccess::storestore();
+
   // Recalculate all the sizes from scratch.
 
   // This never includes used bytes of current allocating heap region.
@@ -285,6 +309,8 @@ void G1MonitoringSupport::recalculate_sizes() {
   assert(_old_gen_used <= _old_gen_committed, "Old gen used bytes(" SIZE_FORMAT
          ") should be less than or equal to old gen committed(" SIZE_FORMAT ")",
          _old_gen_used, _old_gen_committed);
+
+  Atomic::release_store(&_sizes_version, version + 2);
 }
 
 void G1MonitoringSupport::update_sizes() {
@@ -316,30 +342,15 @@ void G1MonitoringSupport::update_eden_size() {
 }
 
 MemoryUsage G1MonitoringSupport::eden_space_memory_usage(size_t initial_size, size_t max_size) {
-  MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
-
-  return MemoryUsage(initial_size,
-                     _eden_space_used,
-                     _eden_space_committed,
-                     max_size);
+  return read_memory_usage(initial_size, &_eden_space_used, &_eden_space_committed, max_size);
 }
 
 MemoryUsage G1MonitoringSupport::survivor_space_memory_usage(size_t initial_size, size_t max_size) {
-  MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
-
-  return MemoryUsage(initial_size,
-                     _survivor_space_used,
-                     _survivor_space_committed,
-                     max_size);
+  return read_memory_usage(initial_size, &_survivor_space_used, &_survivor_space_committed, max_size);
 }
 
 MemoryUsage G1MonitoringSupport::old_gen_memory_usage(size_t initial_size, size_t max_size) {
-  MutexLocker x(MonitoringSupport_lock, Mutex::_no_safepoint_check_flag);
-
-  return MemoryUsage(initial_size,
-                     _old_gen_used,
-                     _old_gen_committed,
-                     max_size);
+  return read_memory_usage(initial_size, &_old_gen_used, &_old_gen_committed, max_size);
 }
 
 G1MonitoringScope::G1MonitoringScope(G1MonitoringSupport* g1mm, bool full_gc, bool all_memory_pools_affected) :
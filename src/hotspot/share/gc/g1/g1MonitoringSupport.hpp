@@ -174,6 +174,16 @@ class G1MonitoringSupport : public CHeapObj<mtGC> {
 
   size_t _old_gen_used;
 
+  // Sequence count for the sizes above. MemoryPool readers use it instead
+  // of MonitoringSupport_lock, so MXBean polling and low memory detection
+  // never block the allocating threads that publish new sizes. Odd while
+  // recalculate_sizes() is updating.
+  volatile uint _sizes_version;
+
+  // Reads a consistent pair of published sizes.
+  MemoryUsage read_memory_usage(size_t initial_size, const size_t* used,
+                                const size_t* committed, size_t max_size);
+
   // Recalculate all the sizes.
   void recalculate_sizes();
 
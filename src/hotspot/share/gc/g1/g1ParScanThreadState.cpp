@@ -287,6 +287,48 @@ void G1ParScanThreadState::dispatch_task(ScannerTask task) {
   }
 }
 
+void G1ParScanThreadState::prefetch_task(ScannerTask task) const {
+  // Prefetch the header for write like prefetch_and_push(), since we
+  // might need to install the forwarding reference. Partial array tasks
+  // refer to arrays that have already been copied.
+  oop obj;
+  if (task.is_narrow_oop_ptr()) {
+    obj = RawAccess<IS_NOT_NULL>::oop_load(task.to_narrow_oop_ptr());
+  } else if (task.is_oop_ptr()) {
+    obj = RawAccess<IS_NOT_NULL>::oop_load(task.to_oop_ptr());
+  } else {
+    return;
+  }
+  Prefetch::write(obj->mark_addr(), 0);
+  Prefetch::read(obj->mark_addr(), (HeapWordSize*2));
+}
+
+MAYBE_INLINE_EVACUATION
+void G1ParScanThreadState::trim_local_queue_with_prefetch(uint threshold) {
+  const uint MaxPrefetchDistance = 16;
+  ScannerTask pending[MaxPrefetchDistance];
+  const uint distance = G1EvacuationPrefetchDistance;
+  assert(distance > 0 && distance <= MaxPrefetchDistance, "invalid distance %u", distance);
+
+  uint head = 0;
+  uint count = 0;
+  ScannerTask task;
+  while (true) {
+    while (count < distance && _task_queue->pop_local(task, threshold)) {
+      prefetch_task(task);
+      pending[(head + count) % distance] = task;
+      count++;
+    }
+    if (count == 0) {
+      return;
+    }
+    task = pending[head];
+    head = (head + 1) % distance;
+    count--;
+    dispatch_task(task);
+  }
+}
+
 // Process tasks until overflow queue is empty and local queue
 // contains no more than threshold entries.  NOINLINE to prevent
 // inlining into steal_and_trim_queue.
@@ -299,8 +341,12 @@ void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
         dispatch_task(task);
       }
     }
-    while (_task_queue->pop_local(task, threshold)) {
-      dispatch_task(task);
+    if (G1EvacuationPrefetchDistance > 0) {
+      trim_local_queue_with_prefetch(threshold);
+    } else {
+      while (_task_queue->pop_local(task, threshold)) {
+        dispatch_task(task);
+      }
     }
   } while (!_task_queue->overflow_empty());
 }
@@ -428,6 +474,12 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   assert(region_attr.is_in_cset(),
          "Unexpected region attr type: %s", region_attr.get_type_str());
 
+  if (region_attr.is_pinned()) {
+    // Objects in regions with pinned objects must stay in place; handle
+    // them like objects that failed evacuation.
+    return handle_evacuation_failure_par(old, old_mark);
+  }
+
   // Get the klass once.  We'll need it again later, and this avoids
   // re-decoding when it's compressed.
   Klass* klass = old->klass();
@@ -203,6 +203,11 @@ private:
                               HeapWord * const obj_ptr, uint node_index) const;
 
   void trim_queue_to_threshold(uint threshold);
+  // Like popping and dispatching tasks from the local task queue down to
+  // threshold, but prefetches the objects referenced by the next
+  // G1EvacuationPrefetchDistance tasks before dispatching a task.
+  void trim_local_queue_with_prefetch(uint threshold);
+  inline void prefetch_task(ScannerTask task) const;
 
   inline bool needs_partial_trimming() const;
 
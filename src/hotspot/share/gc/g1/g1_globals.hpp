@@ -77,11 +77,31 @@
                "Concurrently preclean java.lang.ref.references instances "  \
                "before the Remark pause.")                                  \
                                                                             \
+  product(bool, G1UseParallelReferencePrecleaning, false, EXPERIMENTAL,     \
+          "Preclean with all concurrent marking threads, each of them "     \
+          "handling the discovered lists of its own thread. Requires "      \
+          "G1UseReferencePrecleaning.")                                     \
+                                                                            \
   product(double, G1LastPLABAverageOccupancy, 50.0, EXPERIMENTAL,           \
                "The expected average occupancy of the last PLAB in "        \
                "percent.")                                                  \
                range(0.001, 100.0)                                          \
                                                                             \
+  product(bool, G1NUMAOldAllocRegions, false, EXPERIMENTAL,                 \
+          "Use one old GC alloc region per NUMA node, so that objects "     \
+          "promoted or copied into old regions stay on the node of the "    \
+          "region they were evacuated from.")                               \
+                                                                            \
+  product(bool, G1DeferOldBOTUpdates, false, EXPERIMENTAL,                  \
+          "Do not update the block offset table when allocating into old "  \
+          "regions during evacuation. The table is fixed on demand or "     \
+          "concurrently by the service thread after the pause.")            \
+                                                                            \
+  product(bool, G1ElideBarriersOnAllocations, false, EXPERIMENTAL,          \
+          "Elide C2 post barriers on stores into objects allocated in the " \
+          "same compilation, when no safepoint can be reached between the " \
+          "allocation and the store")                                       \
+                                                                            \
   product(size_t, G1SATBBufferSize, 1*K,                                    \
           "Number of entries in an SATB log buffer.")                       \
           range(1, max_uintx)                                               \
@@ -102,6 +122,13 @@
           "When expanding, % of uncommitted space to claim.")               \
           range(0, 100)                                                     \
                                                                             \
+  product(uint, G1GCCPUTargetPercent, 0, EXPERIMENTAL,                      \
+          "Target percentage of time spent in garbage collection pauses. "  \
+          "If non-zero, the heap is gradually expanded or shrunk after "    \
+          "every young collection to approach this target, instead of "     \
+          "only being expanded when GCTimeRatio is exceeded.")              \
+          range(0, 100)                                                     \
+                                                                            \
   product(size_t, G1UpdateBufferSize, 256,                                  \
           "Size of an update buffer")                                       \
           range(1, NOT_LP64(32*M) LP64_ONLY(1*G))                           \
@@ -118,6 +145,17 @@
           "Will be selected ergonomically by default.")                     \
           range(0, max_intx)                                                \
                                                                             \
+  product(bool, G1UseRegionPinning, false, EXPERIMENTAL,                    \
+          "Pin the regions of objects accessed by JNI critical functions "  \
+          "instead of locking out garbage collection. Objects in regions "  \
+          "with pinned objects are not moved by garbage collections.")      \
+                                                                            \
+  product(bool, G1UseMutatorRefinement, true, EXPERIMENTAL,                 \
+          "Let mutator threads refine cards when the number of pending "    \
+          "cards exceeds the red zone. Otherwise pending cards are only "   \
+          "processed by the concurrent refinement threads and the next "    \
+          "garbage collection pause.")                                      \
+                                                                            \
   product(size_t, G1ConcRefinementGreenZone, 0,                             \
           "The number of update buffers that are left in the queue by the " \
           "concurrent processing threads. Will be selected ergonomically "  \
@@ -174,6 +212,12 @@
           range(0, max_jint/wordSize)                                       \
           constraint(G1RSetSparseRegionEntriesConstraintFunc,AfterErgo)     \
                                                                             \
+  product(uint, G1RSetInlineRegionEntries, 8, EXPERIMENTAL,                 \
+          "Number of remote regions per remembered set whose first few "    \
+          "cards are kept in lock-free inline containers before being "     \
+          "moved to the sparse table. 0 disables inline containers.")       \
+          range(0, 1024)                                                    \
+                                                                            \
   develop(intx, G1MaxVerifyFailures, -1,                                    \
           "The maximum number of verification failures to print.  "         \
           "-1 means print all.")                                            \
@@ -224,6 +268,13 @@
           "Regions with live bytes exceeding this will not be collected.")  \
           range(0, 100)                                                     \
                                                                             \
+  product(uintx, G1MixedGCMaxRegionTimePercent, 0, EXPERIMENTAL,            \
+          "Regions whose predicted evacuation time in a mixed GC exceeds "  \
+          "this percentage of MaxGCPauseMillis are not considered for "     \
+          "the collection set, and their remembered sets are dropped. "     \
+          "0 disables the check.")                                          \
+          range(0, 100)                                                     \
+                                                                            \
   product(uintx, G1HeapWastePercent, 5,                                     \
           "Amount of space, expressed as a percentage of the heap size, "   \
           "that G1 is willing not to collect to avoid expensive GCs.")      \
@@ -233,6 +284,13 @@
           "The target number of mixed GCs after a marking cycle.")          \
           range(0, max_uintx)                                               \
                                                                             \
+  product(uintx, G1HumongousObjectThresholdPercent, 50, EXPERIMENTAL,       \
+          "Objects larger than this percentage of the region size are "     \
+          "allocated as humongous objects. Smaller objects are allocated "  \
+          "in regular regions, where they are copied and compacted like "   \
+          "other objects instead of wasting the tail of their last region.")\
+          range(50, 90)                                                     \
+                                                                            \
   product(bool, G1EagerReclaimHumongousObjects, true, EXPERIMENTAL,         \
           "Try to reclaim dead large objects at every young GC.")           \
                                                                             \
@@ -249,6 +307,13 @@
           "Chunk size used for rebuilding the remembered set.")             \
           range(4 * K, 32 * M)                                              \
                                                                             \
+  product(uint, G1EvacuationPrefetchDistance, 0, EXPERIMENTAL,              \
+          "Number of tasks taken from the local task queue ahead of "       \
+          "processing during evacuation, so that the headers of the "       \
+          "objects they refer to are prefetched before they are copied. "   \
+          "Zero disables this prefetching.")                                \
+          range(0, 16)                                                      \
+                                                                            \
   product(uintx, G1OldCSetRegionThresholdPercent, 10, EXPERIMENTAL,         \
           "An upper bound for the number of old CSet regions expressed "    \
           "as a percentage of the heap size.")                              \
@@ -282,6 +347,14 @@
           "Force use of evacuation failure handling during mixed "          \
           "evacuation pauses")                                              \
                                                                             \
+  product(uint, G1FullGCCompactionChunksPerWorker, 1, EXPERIMENTAL,         \
+          "Number of compaction queues each worker fills in the prepare "   \
+          "phase of a full GC. Workers claim these queues dynamically "     \
+          "in the compaction phase, so more queues per worker balance "     \
+          "the compaction work better at the cost of more partially "       \
+          "filled regions.")                                                \
+          range(1, 64)                                                      \
+                                                                            \
   product(bool, G1VerifyRSetsDuringFullGC, false, DIAGNOSTIC,               \
           "If true, perform verification of each heap region's "            \
           "remembered set when verifying the heap during a full GC.")       \
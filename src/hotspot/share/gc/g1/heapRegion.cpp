@@ -44,7 +44,9 @@
 #include "oops/access.inline.hpp"
 #include "oops/compressedOops.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
+#include "runtime/safepoint.hpp"
 #include "utilities/powerOfTwo.hpp"
 
 int    HeapRegion::LogOfHRGrainBytes = 0;
@@ -120,12 +122,15 @@ void HeapRegion::hr_clear(bool clear_space) {
          "we should have already filtered out humongous regions");
   assert(!in_collection_set(),
          "Should not clear heap region %u in the collection set", hrm_index());
+  assert(!has_pinned_objects(),
+         "Should not clear heap region %u with pinned objects", hrm_index());
 
   clear_young_index_in_cset();
   clear_index_in_opt_cset();
   uninstall_surv_rate_group();
   set_free();
   reset_pre_dummy_top();
+  _bot_stale_from = NULL;
 
   rem_set()->clear_locked();
 
@@ -238,11 +243,13 @@ HeapRegion::HeapRegion(uint hrm_index,
   _bot_part(bot, this),
   _par_alloc_lock(Mutex::leaf, "HeapRegion par alloc lock", true),
   _pre_dummy_top(NULL),
+  _bot_stale_from(NULL),
   _rem_set(NULL),
   _hrm_index(hrm_index),
   _type(),
   _humongous_start_region(NULL),
   _evacuation_failed(false),
+  _pinned_object_count(0),
   _index_in_opt_cset(InvalidCSetIndex),
   _next(NULL), _prev(NULL),
 #ifdef ASSERT
@@ -857,9 +864,38 @@ void HeapRegion::mangle_unused_area() {
 #endif
 
 HeapWord* HeapRegion::initialize_threshold() {
+  _bot_stale_from = NULL;
   return _bot_part.initialize_threshold();
 }
 
+void HeapRegion::set_stale_bot() {
+  assert_at_safepoint();
+  if (_bot_stale_from == NULL) {
+    Atomic::release_store(&_bot_stale_from, top());
+  }
+}
+
+void HeapRegion::fix_stale_bot(const void* limit) {
+  MutexLocker x(&_par_alloc_lock);
+  HeapWord* cur = _bot_stale_from;
+  if (cur == NULL) {
+    return;
+  }
+  HeapWord* const t = top();
+  while (cur <= limit && cur < t) {
+    HeapWord* next = cur + block_size(cur);
+    _bot_part.alloc_block(cur, next);
+    cur = next;
+  }
+  // Outside of a pause there are no allocations into old regions so
+  // reaching top means that the BOT is up to date. During a pause
+  // this region may still be allocated into.
+  if (cur == t && !SafepointSynchronize::is_at_safepoint()) {
+    cur = NULL;
+  }
+  Atomic::release_store(&_bot_stale_from, cur);
+}
+
 HeapWord* HeapRegion::cross_threshold(HeapWord* start, HeapWord* end) {
   _bot_part.alloc_block(start, end);
   return _bot_part.threshold();
@@ -84,6 +84,11 @@ class HeapRegion : public CHeapObj<mtGC> {
   // into the region was and this is what this keeps track.
   HeapWord* _pre_dummy_top;
 
+  // With G1DeferOldBOTUpdates, allocations into old regions during
+  // evacuation do not update the BOT. The BOT is then only valid for
+  // blocks below this block start. NULL if the BOT is up to date.
+  HeapWord* volatile _bot_stale_from;
+
 public:
   HeapWord* bottom() const         { return _bottom; }
   HeapWord* end() const            { return _end;    }
@@ -192,8 +197,16 @@ public:
 
   void reset_bot() {
     _bot_part.reset_bot();
+    _bot_stale_from = NULL;
   }
 
+  inline bool has_stale_bot() const;
+  // Note that allocations into this region will not update the BOT.
+  void set_stale_bot();
+  // Update the stale part of the BOT at least up to the block that
+  // contains limit.
+  void fix_stale_bot(const void* limit);
+
   void update_bot() {
     _bot_part.update();
   }
@@ -213,6 +226,10 @@ private:
   // True iff an attempt to evacuate an object in the region failed.
   volatile bool _evacuation_failed;
 
+  // The number of objects in the region pinned with G1UseRegionPinning.
+  // Objects in a region with pinned objects are not moved.
+  volatile size_t _pinned_object_count;
+
   static const uint InvalidCSetIndex = UINT_MAX;
 
   // The index in the optional regions array, if this region
@@ -507,6 +524,10 @@ public:
 
   inline void reset_evacuation_failed();
 
+  inline bool has_pinned_objects() const;
+  inline void increment_pinned_object_count();
+  inline void decrement_pinned_object_count();
+
   // Notify the region that we are about to start processing
   // self-forwarded objects during evac failure handling.
   void note_self_forwarding_removal_start(bool during_concurrent_start,
@@ -108,11 +108,31 @@ inline HeapWord* HeapRegion::par_allocate(size_t min_word_size,
   return allocate(min_word_size, desired_word_size, actual_size);
 }
 
+inline bool HeapRegion::has_stale_bot() const {
+  return Atomic::load_acquire(&_bot_stale_from) != NULL;
+}
+
 inline HeapWord* HeapRegion::block_start(const void* p) {
+  HeapWord* stale_from = Atomic::load_acquire(&_bot_stale_from);
+  if (stale_from != NULL && p >= stale_from) {
+    fix_stale_bot(p);
+  }
   return _bot_part.block_start(p);
 }
 
 inline HeapWord* HeapRegion::block_start_const(const void* p) const {
+  HeapWord* stale_from = Atomic::load_acquire(&_bot_stale_from);
+  if (stale_from != NULL && p >= stale_from) {
+    // Walk the blocks from the last known block start without
+    // updating the BOT.
+    HeapWord* q = stale_from;
+    HeapWord* n = q + block_size(q);
+    while (n <= p) {
+      q = n;
+      n += block_size(q);
+    }
+    return q;
+  }
   return _bot_part.block_start_const(p);
 }
 
@@ -202,6 +222,7 @@ inline void HeapRegion::reset_compacted_after_full_gc() {
   // We treat all objects as being above PTAMS.
   zero_marked_bytes();
   init_top_at_mark_start();
+  _bot_stale_from = NULL;
 
   reset_after_full_gc_common();
 }
@@ -256,7 +277,7 @@ inline void HeapRegion::apply_to_marked_objects(G1CMBitMap* bitmap, ApplyToMarke
 inline HeapWord* HeapRegion::par_allocate_no_bot_updates(size_t min_word_size,
                                                          size_t desired_word_size,
                                                          size_t* actual_word_size) {
-  assert(is_young(), "we can only skip BOT updates on young regions");
+  assert(is_young() || has_stale_bot(), "we can only skip BOT updates on young regions or with deferred BOT updates");
   return par_allocate_impl(min_word_size, desired_word_size, actual_word_size);
 }
 
@@ -268,7 +289,7 @@ inline HeapWord* HeapRegion::allocate_no_bot_updates(size_t word_size) {
 inline HeapWord* HeapRegion::allocate_no_bot_updates(size_t min_word_size,
                                                      size_t desired_word_size,
                                                      size_t* actual_word_size) {
-  assert(is_young(), "we can only skip BOT updates on young regions");
+  assert(is_young() || has_stale_bot(), "we can only skip BOT updates on young regions or with deferred BOT updates");
   return allocate_impl(min_word_size, desired_word_size, actual_word_size);
 }
 
@@ -464,4 +485,17 @@ inline void HeapRegion::reset_evacuation_failed() {
   Atomic::store(&_evacuation_failed, false);
 }
 
+inline bool HeapRegion::has_pinned_objects() const {
+  return Atomic::load(&_pinned_object_count) > 0;
+}
+
+inline void HeapRegion::increment_pinned_object_count() {
+  Atomic::inc(&_pinned_object_count, memory_order_relaxed);
+}
+
+inline void HeapRegion::decrement_pinned_object_count() {
+  assert(has_pinned_objects(), "Region %u has no pinned objects", hrm_index());
+  Atomic::dec(&_pinned_object_count, memory_order_relaxed);
+}
+
 #endif // SHARE_GC_G1_HEAPREGION_INLINE_HPP
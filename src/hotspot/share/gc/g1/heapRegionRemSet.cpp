@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/g1/g1BlockOffsetTable.inline.hpp"
+#include "gc/g1/g1CardSetContainers.inline.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1ConcurrentRefine.hpp"
 #include "gc/g1/heapRegionManager.inline.hpp"
@@ -62,6 +63,7 @@ PerRegionTable* PerRegionTable::alloc(HeapRegion* hr) {
 
 PerRegionTable* volatile PerRegionTable::_free_list = NULL;
 
+uint   OtherRegionsTable::_num_inline_slots = 0;
 size_t OtherRegionsTable::_max_fine_entries = 0;
 size_t OtherRegionsTable::_mod_max_fine_entries_mask = 0;
 size_t OtherRegionsTable::_fine_eviction_stride = 0;
@@ -78,7 +80,8 @@ OtherRegionsTable::OtherRegionsTable(Mutex* m) :
   _first_all_fine_prts(NULL),
   _last_all_fine_prts(NULL),
   _fine_eviction_start(0),
-  _sparse_table()
+  _sparse_table(),
+  _inline_slots(NULL)
 {
   typedef PerRegionTable* PerRegionTablePtr;
 
@@ -98,6 +101,91 @@ OtherRegionsTable::OtherRegionsTable(Mutex* m) :
   for (size_t i = 0; i < _max_fine_entries; i++) {
     _fine_grain_regions[i] = NULL;
   }
+
+  if (_num_inline_slots > 0) {
+    _inline_slots = NEW_C_HEAP_ARRAY(InlineSlot, _num_inline_slots, mtGC);
+    for (uint i = 0; i < _num_inline_slots; i++) {
+      _inline_slots[i]._region_idx = G1_NO_HRM_INDEX;
+      _inline_slots[i]._cards = 0;
+    }
+  }
+}
+
+void OtherRegionsTable::setup_inline_cards() {
+  G1CardSetInlinePtr::initialize((uint)HeapRegion::LogCardsPerRegion, (uint)SparsePRTEntry::cards_num());
+  _num_inline_slots = G1RSetInlineRegionEntries;
+}
+
+OtherRegionsTable::InlineSlot* OtherRegionsTable::find_inline_slot(RegionIdx_t from_hrm_ind, bool claim) {
+  uint const start = (uint)from_hrm_ind % _num_inline_slots;
+  uint i = start;
+  do {
+    InlineSlot* slot = &_inline_slots[i];
+    uint region_idx = Atomic::load_acquire(&slot->_region_idx);
+    if (region_idx == G1_NO_HRM_INDEX && claim) {
+      // Slots are never released concurrently, so if we lose the race the
+      // winner might have claimed this slot for the same region.
+      region_idx = Atomic::cmpxchg(&slot->_region_idx, G1_NO_HRM_INDEX, (uint)from_hrm_ind);
+      if (region_idx == G1_NO_HRM_INDEX) {
+        return slot;
+      }
+    }
+    if (region_idx == (uint)from_hrm_ind) {
+      return slot;
+    } else if (region_idx == G1_NO_HRM_INDEX) {
+      // Slots are claimed in probing order, so there can be no slot for the
+      // region further on.
+      return NULL;
+    }
+    i = (i + 1 == _num_inline_slots) ? 0 : i + 1;
+  } while (i != start);
+  return NULL;
+}
+
+bool OtherRegionsTable::add_card_inline(RegionIdx_t from_hrm_ind, CardIdx_t card_index) {
+  if (_num_inline_slots == 0) {
+    return false;
+  }
+  InlineSlot* slot = find_inline_slot(from_hrm_ind, true /* claim */);
+  if (slot == NULL) {
+    return false;
+  }
+  G1CardSetInlinePtr cards(&slot->_cards);
+  switch (cards.add((uint)card_index)) {
+    case G1CardSetInlinePtr::Added:
+      Atomic::inc(&_num_occupied, memory_order_relaxed);
+      return true;
+    case G1CardSetInlinePtr::Found:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void OtherRegionsTable::transfer_inline_cards(RegionIdx_t from_hrm_ind) {
+  assert(_m->owned_by_self(), "Precondition");
+  if (_num_inline_slots == 0) {
+    return;
+  }
+  InlineSlot* slot = find_inline_slot(from_hrm_ind, false /* claim */);
+  if (slot == NULL || G1CardSetInlinePtr::is_overflowed(Atomic::load(&slot->_cards))) {
+    return;
+  }
+  // After marking no more cards can be added to the inline container, so
+  // the returned value holds all cards to transfer. These cards have already
+  // been accounted for in _num_occupied, and there is no sparse entry for the
+  // region yet. As the inline container holds at most as many cards as a
+  // sparse entry, the transfer can not overflow.
+  G1CardSetInlinePtr cards(&slot->_cards);
+  uintptr_t value = cards.mark_overflowed();
+
+  SparsePRTEntry::card_elem_t elems[G1CardSetInlinePtr::MaxCardsLimit];
+  G1InlineCardsCopier copier(elems);
+  G1CardSetInlinePtr::iterate(value, copier);
+  for (uint i = 0; i < copier.num_copied(); i++) {
+    SparsePRT::AddCardResult result = _sparse_table.add_card(from_hrm_ind, elems[i]);
+    assert(result == SparsePRT::added, "Transfer of card %u of region %u failed", elems[i], from_hrm_ind);
+  }
 }
 
 void OtherRegionsTable::link_to_all(PerRegionTable* prt) {
@@ -139,6 +227,12 @@ void OtherRegionsTable::add_reference(OopOrNarrowOopStar from, uint tid) {
     return;
   }
 
+  // Try the lock-free inline container first.
+  if (add_card_inline(from_hrm_ind, card_within_region(from, from_hr))) {
+    assert(contains_reference(from), "We just added " PTR_FORMAT " to the inline container", p2i(from));
+    return;
+  }
+
   size_t num_added_by_coarsening = 0;
   // Otherwise find a per-region table to add it to.
   size_t ind = from_hrm_ind & _mod_max_fine_entries_mask;
@@ -152,6 +246,10 @@ void OtherRegionsTable::add_reference(OopOrNarrowOopStar from, uint tid) {
       return;
     }
 
+    // The inline container for this region overflowed; move its cards into
+    // the sparse table before adding the new card.
+    transfer_inline_cards(from_hrm_ind);
+
     // Confirm that it's really not there...
     prt = find_region_table(ind, from_hr);
     if (prt == NULL) {
@@ -318,6 +416,7 @@ size_t OtherRegionsTable::mem_size() const {
   sum += (sizeof(PerRegionTable*) * _max_fine_entries);
   sum += (_coarse_map.size_in_words() * HeapWordSize);
   sum += (_sparse_table.mem_size());
+  sum += (sizeof(InlineSlot) * _num_inline_slots);
   sum += sizeof(OtherRegionsTable) - sizeof(_sparse_table); // Avoid double counting above.
   return sum;
 }
@@ -342,6 +441,10 @@ void OtherRegionsTable::clear() {
 
   _first_all_fine_prts = _last_all_fine_prts = NULL;
   _sparse_table.clear();
+  for (uint i = 0; i < _num_inline_slots; i++) {
+    _inline_slots[i]._region_idx = G1_NO_HRM_INDEX;
+    _inline_slots[i]._cards = 0;
+  }
   if (Atomic::load(&_has_coarse_entries)) {
     _coarse_map.clear();
   }
@@ -363,12 +466,22 @@ bool OtherRegionsTable::contains_reference_locked(OopOrNarrowOopStar from) const
   // Is this region in the coarse map?
   if (is_region_coarsened(hr_ind)) return true;
 
+  CardIdx_t card_index = card_within_region(from, hr);
+  if (_num_inline_slots > 0) {
+    InlineSlot* slot = const_cast<OtherRegionsTable*>(this)->find_inline_slot(hr_ind, false /* claim */);
+    if (slot != NULL) {
+      G1CardSetInlinePtr cards(&slot->_cards);
+      if (cards.contains((uint)card_index)) {
+        return true;
+      }
+    }
+  }
+
   PerRegionTable* prt = find_region_table(hr_ind & _mod_max_fine_entries_mask,
                                           hr);
   if (prt != NULL) {
     return prt->contains_reference(from);
   } else {
-    CardIdx_t card_index = card_within_region(from, hr);
     return _sparse_table.contains_card(hr_ind, card_index);
   }
 }
@@ -407,6 +520,8 @@ void HeapRegionRemSet::setup_remset_size() {
     G1RSetRegionEntries = G1RSetRegionEntriesBase * (region_size_log_mb + 1);
   }
   guarantee(G1RSetSparseRegionEntries > 0 && G1RSetRegionEntries > 0 , "Sanity");
+
+  OtherRegionsTable::setup_inline_cards();
 }
 
 void HeapRegionRemSet::clear(bool only_cardset) {
@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_G1_HEAPREGIONREMSET_HPP
 #define SHARE_GC_G1_HEAPREGIONREMSET_HPP
 
+#include "gc/g1/g1CardSetContainers.hpp"
 #include "gc/g1/g1CodeCacheRemSet.hpp"
 #include "gc/g1/g1FromCardCache.hpp"
 #include "gc/g1/sparsePRT.hpp"
@@ -53,6 +54,14 @@ class nmethod;
 // deleting an entry and setting the corresponding coarse-grained bit when
 // we would overflow this cap.
 
+// The "_inline_slots" array is a small open hash table of lock-free inline
+// card containers (G1CardSetInlinePtr), one per remote region. Most regions
+// only ever receive a few cards from a given remote region, so the first
+// cards from a region are kept there and only moved into the sparse table
+// (under the lock) once the inline container overflows. Slots are claimed
+// for a region once and only released by clearing the remembered set at a
+// safepoint.
+
 // We use a mixture of locking and lock-free techniques here.  We allow
 // threads to locate PRTs without locking, but threads attempting to alter
 // a bucket list obtain a lock.  This means that any failing attempt to
@@ -97,7 +106,15 @@ class OtherRegionsTable {
 
   SparsePRT   _sparse_table;
 
+  struct InlineSlot {
+    uint volatile      _region_idx;
+    uintptr_t volatile _cards;
+  };
+
+  InlineSlot* _inline_slots;
+
   // These are static after init.
+  static uint   _num_inline_slots;
   static size_t _max_fine_entries;
   static size_t _mod_max_fine_entries_mask;
 
@@ -116,6 +133,19 @@ class OtherRegionsTable {
 
   bool contains_reference_locked(OopOrNarrowOopStar from) const;
 
+  // Returns the inline slot for the given region, claiming a free one if
+  // there is none yet and claim is true. Returns NULL if there is no such
+  // slot.
+  InlineSlot* find_inline_slot(RegionIdx_t from_hrm_ind, bool claim);
+
+  // Tries to add the given card to the inline container for the given region.
+  // Returns false if the card could not be recorded there.
+  bool add_card_inline(RegionIdx_t from_hrm_ind, CardIdx_t card_index);
+
+  // Moves the cards of the inline container for the given region, if any, into
+  // the sparse table. Requires the caller to hold _m.
+  void transfer_inline_cards(RegionIdx_t from_hrm_ind);
+
 public:
   // Create a new remembered set. The given mutex is used to ensure consistency.
   OtherRegionsTable(Mutex* m);
@@ -151,6 +181,9 @@ public:
   // Returns the size of the free list content in bytes.
   static size_t fl_mem_size();
 
+  // Sets up the inline container layout.
+  static void setup_inline_cards();
+
   // Clear the entire contents of this remembered set.
   void clear();
 
@@ -27,6 +27,7 @@
 
 #include "gc/g1/heapRegionRemSet.hpp"
 
+#include "gc/g1/g1CardSetContainers.inline.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/sparsePRT.hpp"
 #include "runtime/atomic.hpp"
@@ -72,6 +73,21 @@ inline void PerRegionTable::init(HeapRegion* hr, bool clear_links_to_all_list) {
   Atomic::release_store(&_hr, hr);
 }
 
+// Copies the cards of an inline container into a card array.
+class G1InlineCardsCopier : public StackObj {
+  SparsePRTEntry::card_elem_t* _cards;
+  uint _num_copied;
+
+public:
+  G1InlineCardsCopier(SparsePRTEntry::card_elem_t* cards) : _cards(cards), _num_copied(0) { }
+
+  void operator()(uint card_idx) {
+    _cards[_num_copied++] = (SparsePRTEntry::card_elem_t)card_idx;
+  }
+
+  uint num_copied() const { return _num_copied; }
+};
+
 template <class Closure>
 void OtherRegionsTable::iterate(Closure& cl) {
   if (Atomic::load(&_has_coarse_entries)) {
@@ -88,6 +104,23 @@ void OtherRegionsTable::iterate(Closure& cl) {
       cur = cur->next();
     }
   }
+  for (uint i = 0; i < _num_inline_slots; i++) {
+    InlineSlot* slot = &_inline_slots[i];
+    uint region_idx = Atomic::load(&slot->_region_idx);
+    if (region_idx == G1_NO_HRM_INDEX) {
+      continue;
+    }
+    uintptr_t value = Atomic::load(&slot->_cards);
+    uint num_cards = G1CardSetInlinePtr::num_cards_in(value);
+    if (num_cards == 0) {
+      continue;
+    }
+    SparsePRTEntry::card_elem_t cards[G1CardSetInlinePtr::MaxCardsLimit];
+    G1InlineCardsCopier copier(cards);
+    G1CardSetInlinePtr::iterate(value, copier);
+    assert(copier.num_copied() == num_cards, "must be");
+    cl.next_sparse_prt(region_idx, cards, num_cards);
+  }
   {
     SparsePRTBucketIter iter(&_sparse_table);
     SparsePRTEntry* cur;
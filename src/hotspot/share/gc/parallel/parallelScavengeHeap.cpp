@@ -34,6 +34,7 @@
 #include "gc/parallel/psPromotionManager.hpp"
 #include "gc/parallel/psScavenge.hpp"
 #include "gc/parallel/psVMOperations.hpp"
+#include "gc/shared/concurrentPretouchThread.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
 #include "gc/shared/gcLocker.hpp"
 #include "gc/shared/gcWhen.hpp"
@@ -41,6 +42,7 @@
 #include "gc/shared/gcInitLogger.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
 #include "gc/shared/scavengableNMethods.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
 #include "logging/log.hpp"
 #include "memory/iterator.hpp"
 #include "memory/metaspaceCounters.hpp"
@@ -178,6 +180,28 @@ void ParallelScavengeHeap::post_initialize() {
   PSPromotionManager::initialize();
 
   ScavengableNMethods::initialize(&_is_scavengable);
+
+  if (ConcurrentPreTouch && !AlwaysPreTouch) {
+    _pretouch_thread = new ConcurrentPretouchThread("ParallelGC PreTouch");
+  }
+}
+
+void ParallelScavengeHeap::stop() {
+  if (_pretouch_thread != NULL) {
+    _pretouch_thread->stop();
+  }
+}
+
+void ParallelScavengeHeap::safepoint_synchronize_begin() {
+  if (_pretouch_thread != NULL) {
+    SuspendibleThreadSet::synchronize();
+  }
+}
+
+void ParallelScavengeHeap::safepoint_synchronize_end() {
+  if (_pretouch_thread != NULL) {
+    SuspendibleThreadSet::desynchronize();
+  }
 }
 
 void ParallelScavengeHeap::update_counters() {
@@ -653,6 +677,21 @@ PSHeapSummary ParallelScavengeHeap::create_ps_heap_summary() {
   return PSHeapSummary(heap_summary, used(), old_summary, old_space, young_summary, eden_space, from_space, to_space);
 }
 
+HeapWord* ParallelScavengeHeap::allocate_loaded_archive_space(size_t word_size) {
+  return _old_gen->allocate(word_size);
+}
+
+void ParallelScavengeHeap::complete_loaded_archive_space(MemRegion archive_space) {
+  assert(_old_gen->object_space()->used_region().contains(archive_space),
+         "Archive space not contained in old gen");
+  // The old gen allocation only recorded the start of the whole space.
+  HeapWord* cur = archive_space.start();
+  while (cur < archive_space.end()) {
+    _old_gen->start_array()->allocate_block(cur);
+    cur += cast_to_oop(cur)->size();
+  }
+}
+
 bool ParallelScavengeHeap::print_location(outputStream* st, void* addr) const {
   return BlockLocationPrinter<ParallelScavengeHeap>::print_location(st, addr);
 }
@@ -676,6 +715,9 @@ void ParallelScavengeHeap::print_on_error(outputStream* st) const {
 
 void ParallelScavengeHeap::gc_threads_do(ThreadClosure* tc) const {
   ParallelScavengeHeap::heap()->workers().threads_do(tc);
+  if (_pretouch_thread != NULL) {
+    tc->do_thread(_pretouch_thread);
+  }
 }
 
 void ParallelScavengeHeap::print_tracing_info() const {
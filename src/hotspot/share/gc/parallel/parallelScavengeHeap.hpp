@@ -42,6 +42,7 @@
 #include "utilities/growableArray.hpp"
 #include "utilities/ostream.hpp"
 
+class ConcurrentPretouchThread;
 class GCHeapSummary;
 class HeapBlockClaimer;
 class MemoryManager;
@@ -73,6 +74,9 @@ class ParallelScavengeHeap : public CollectedHeap {
 
   WorkGang _workers;
 
+  // Pre-touches expanded generations with ConcurrentPreTouch, or NULL.
+  ConcurrentPretouchThread* _pretouch_thread;
+
   virtual void initialize_serviceability();
 
   void trace_actual_reserved_page_size(const size_t reserved_heap_size, const ReservedSpace rs);
@@ -101,7 +105,8 @@ class ParallelScavengeHeap : public CollectedHeap {
     _workers("GC Thread",
              ParallelGCThreads,
              true /* are_GC_task_threads */,
-             false /* are_ConcurrentGC_threads */) { }
+             false /* are_ConcurrentGC_threads */),
+    _pretouch_thread(NULL) { }
 
   // For use by VM operations
   enum CollectionType {
@@ -142,6 +147,12 @@ class ParallelScavengeHeap : public CollectedHeap {
   void post_initialize();
   void update_counters();
 
+  virtual void stop();
+  virtual void safepoint_synchronize_begin();
+  virtual void safepoint_synchronize_end();
+
+  ConcurrentPretouchThread* pretouch_thread() const { return _pretouch_thread; }
+
   size_t capacity() const;
   size_t used() const;
 
@@ -231,6 +242,11 @@ class ParallelScavengeHeap : public CollectedHeap {
   // Used to print information about locations in the hs_err file.
   virtual bool print_location(outputStream* st, void* addr) const;
 
+  // Support for loading objects from CDS archive into the heap
+  virtual bool can_load_archived_objects() const { return true; }
+  virtual HeapWord* allocate_loaded_archive_space(size_t word_size);
+  virtual void complete_loaded_archive_space(MemRegion archive_space);
+
   void verify(VerifyOption option /* ignored */);
 
   // Resize the young generation.  The reserved space for the
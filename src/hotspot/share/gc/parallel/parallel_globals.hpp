@@ -59,7 +59,25 @@
           "Delay in scheduling GC workers (in milliseconds)")               \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  product(uintx, PSOldPLABBatchSize, 1, EXPERIMENTAL,                       \
+          "Number of old generation promotion LABs a GC worker takes "      \
+          "from the old generation at once")                                \
+          range(1, 64)                                                      \
+                                                                            \
+  product(bool, PSNUMAAwarePromotion, false, EXPERIMENTAL,                  \
+          "With UseNUMA, place the memory of old generation promotion "     \
+          "LABs on the NUMA node of the GC worker using them")             \
+                                                                            \
+  product(bool, PSParallelSummary, false, EXPERIMENTAL,                     \
+          "Split the summary phase of spaces that compact into themselves " \
+          "across the active GC worker threads")                           \
+                                                                            \
+  product(bool, PSDynamicCardStripes, false, EXPERIMENTAL,                  \
+          "Let the GC worker threads claim old gen card table stripes "     \
+          "dynamically during scavenges instead of assigning them "         \
+          "round-robin")
 
 // end of GC_PARALLEL_FLAGS
 
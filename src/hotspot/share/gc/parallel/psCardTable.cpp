@@ -32,6 +32,7 @@
 #include "memory/iterator.inline.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "utilities/align.hpp"
 
@@ -158,12 +159,23 @@ class CheckForPreciseMarks : public BasicOopIterateClosure {
 // adding slice_stride to the start of stripe 0 in slice 0 to get to the start
 // of stride 0 in slice 1.
 
+// Return the next stripe to scan: either the next one claimed from the shared
+// counter, which balances stripes with many dirty cards between the workers,
+// or the next one in round-robin order.
+static size_t next_stripe(volatile size_t* claimed_stripes, size_t round_robin_stripe) {
+  if (claimed_stripes != NULL) {
+    return Atomic::fetch_and_add(claimed_stripes, (size_t)1);
+  }
+  return round_robin_stripe;
+}
+
 void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
                                              MutableSpace* sp,
                                              HeapWord* space_top,
                                              PSPromotionManager* pm,
                                              uint stripe_number,
-                                             uint stripe_total) {
+                                             uint stripe_total,
+                                             volatile size_t* claimed_stripes) {
   int ssize = 128; // Naked constant!  Work unit = 64k.
   int dirty_card_count = 0;
 
@@ -173,14 +185,14 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
   CardValue* start_card = byte_for(sp->bottom());
   CardValue* end_card   = byte_for(sp_top - 1) + 1;
   oop* last_scanned = NULL; // Prevent scanning objects more than once
-  // The width of the stripe ssize*stripe_total must be
-  // consistent with the number of stripes so that the complete slice
-  // is covered.
-  size_t slice_width = ssize * stripe_total;
-  for (CardValue* slice = start_card; slice < end_card; slice += slice_width) {
-    CardValue* worker_start_card = slice + stripe_number * ssize;
-    if (worker_start_card >= end_card)
-      return; // We're done.
+  // Stripes are claimed in increasing address order by each worker, so
+  // last_scanned stays valid across the stripes of one worker.
+  const size_t num_stripes = (end_card - start_card + ssize - 1) / ssize;
+  for (size_t stripe = next_stripe(claimed_stripes, stripe_number);
+       stripe < num_stripes;
+       stripe = next_stripe(claimed_stripes, stripe + stripe_total)) {
+    CardValue* worker_start_card = start_card + stripe * ssize;
+    assert(worker_start_card < end_card, "stripe out of range");
 
     CardValue* worker_end_card = worker_start_card + ssize;
     if (worker_end_card > end_card)
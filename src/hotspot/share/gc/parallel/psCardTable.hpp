@@ -56,13 +56,15 @@ class PSCardTable: public CardTable {
   static CardValue youngergen_card_val() { return youngergen_card; }
   static CardValue verify_card_val()     { return verify_card; }
 
-  // Scavenge support
+  // Scavenge support.  If claimed_stripes is not NULL, stripes are claimed
+  // from that shared counter instead of being assigned round-robin.
   void scavenge_contents_parallel(ObjectStartArray* start_array,
                                   MutableSpace* sp,
                                   HeapWord* space_top,
                                   PSPromotionManager* pm,
                                   uint stripe_number,
-                                  uint stripe_total);
+                                  uint stripe_total,
+                                  volatile size_t* claimed_stripes = NULL);
 
   bool addr_is_marked_imprecise(void *addr);
   bool addr_is_marked_precise(void *addr);
@@ -30,6 +30,7 @@
 #include "gc/parallel/psCardTable.hpp"
 #include "gc/parallel/psOldGen.hpp"
 #include "gc/shared/cardTableBarrierSet.hpp"
+#include "gc/shared/concurrentPretouchThread.hpp"
 #include "gc/shared/gcLocker.hpp"
 #include "gc/shared/spaceDecorator.inline.hpp"
 #include "logging/log.hpp"
@@ -241,6 +242,7 @@ bool PSOldGen::expand_by(size_t bytes) {
   assert_lock_strong(ExpandHeap_lock);
   assert_locked_or_safepoint(Heap_lock);
   assert(bytes > 0, "precondition");
+  HeapWord* const prev_high = (HeapWord*) virtual_space()->high();
   bool result = virtual_space()->expand_by(bytes);
   if (result) {
     if (ZapUnusedHeapArea) {
@@ -261,6 +263,10 @@ bool PSOldGen::expand_by(size_t bytes) {
       _space_counters->update_capacity();
       _gen_counters->update_all();
     }
+    ConcurrentPretouchThread* pretouch_thread = ParallelScavengeHeap::heap()->pretouch_thread();
+    if (pretouch_thread != NULL) {
+      pretouch_thread->request(MemRegion(prev_high, (HeapWord*) virtual_space()->high()));
+    }
   }
 
   if (result) {
@@ -293,6 +299,11 @@ void PSOldGen::shrink(size_t bytes) {
   size_t size = align_down(bytes, virtual_space()->alignment());
   if (size > 0) {
     assert_lock_strong(ExpandHeap_lock);
+    ConcurrentPretouchThread* pretouch_thread = ParallelScavengeHeap::heap()->pretouch_thread();
+    if (pretouch_thread != NULL) {
+      // Do not touch memory that is about to be uncommitted.
+      pretouch_thread->cancel_all();
+    }
     virtual_space()->shrink_by(bytes);
     post_resize();
 
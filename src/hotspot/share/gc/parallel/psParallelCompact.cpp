@@ -700,69 +700,19 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
 
   HeapWord *dest_addr = target_beg;
   while (cur_region < end_region) {
-    // The destination must be set even if the region has no data.
-    _region_data[cur_region].set_destination(dest_addr);
-
+    // If cur_region does not fit entirely into the target space, find a point
+    // at which the source space can be 'split' so that part is copied to the
+    // target space and the rest is copied elsewhere.
     size_t words = _region_data[cur_region].data_size();
-    if (words > 0) {
-      // If cur_region does not fit entirely into the target space, find a point
-      // at which the source space can be 'split' so that part is copied to the
-      // target space and the rest is copied elsewhere.
-      if (dest_addr + words > target_end) {
-        assert(source_next != NULL, "source_next is NULL when splitting");
-        *source_next = summarize_split_space(cur_region, split_info, dest_addr,
-                                             target_end, target_next);
-        return false;
-      }
-
-      // Compute the destination_count for cur_region, and if necessary, update
-      // source_region for a destination region.  The source_region field is
-      // updated if cur_region is the first (left-most) region to be copied to a
-      // destination region.
-      //
-      // The destination_count calculation is a bit subtle.  A region that has
-      // data that compacts into itself does not count itself as a destination.
-      // This maintains the invariant that a zero count means the region is
-      // available and can be claimed and then filled.
-      uint destination_count = 0;
-      if (split_info.is_split(cur_region)) {
-        // The current region has been split:  the partial object will be copied
-        // to one destination space and the remaining data will be copied to
-        // another destination space.  Adjust the initial destination_count and,
-        // if necessary, set the source_region field if the partial object will
-        // cross a destination region boundary.
-        destination_count = split_info.destination_count();
-        if (destination_count == 2) {
-          size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
-          _region_data[dest_idx].set_source_region(cur_region);
-        }
-      }
-
-      HeapWord* const last_addr = dest_addr + words - 1;
-      const size_t dest_region_1 = addr_to_region_idx(dest_addr);
-      const size_t dest_region_2 = addr_to_region_idx(last_addr);
-
-      // Initially assume that the destination regions will be the same and
-      // adjust the value below if necessary.  Under this assumption, if
-      // cur_region == dest_region_2, then cur_region will be compacted
-      // completely into itself.
-      destination_count += cur_region == dest_region_2 ? 0 : 1;
-      if (dest_region_1 != dest_region_2) {
-        // Destination regions differ; adjust destination_count.
-        destination_count += 1;
-        // Data from cur_region will be copied to the start of dest_region_2.
-        _region_data[dest_region_2].set_source_region(cur_region);
-      } else if (is_region_aligned(dest_addr)) {
-        // Data from cur_region will be copied to the start of the destination
-        // region.
-        _region_data[dest_region_1].set_source_region(cur_region);
-      }
-
-      _region_data[cur_region].set_destination_count(destination_count);
-      _region_data[cur_region].set_data_location(region_to_addr(cur_region));
-      dest_addr += words;
+    if (words > 0 && dest_addr + words > target_end) {
+      assert(source_next != NULL, "source_next is NULL when splitting");
+      _region_data[cur_region].set_destination(dest_addr);
+      *source_next = summarize_split_space(cur_region, split_info, dest_addr,
+                                           target_end, target_next);
+      return false;
     }
 
+    dest_addr = summarize_region(split_info, cur_region, dest_addr);
     ++cur_region;
   }
 
@@ -770,6 +720,85 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   return true;
 }
 
+HeapWord* ParallelCompactData::summarize_regions(SplitInfo& split_info,
+                                                 size_t beg_region,
+                                                 size_t end_region,
+                                                 HeapWord* dest_addr)
+{
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    dest_addr = summarize_region(split_info, cur_region, dest_addr);
+  }
+  return dest_addr;
+}
+
+size_t ParallelCompactData::data_size(size_t beg_region, size_t end_region) const
+{
+  size_t words = 0;
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    words += _region_data[cur_region].data_size();
+  }
+  return words;
+}
+
+HeapWord* ParallelCompactData::summarize_region(SplitInfo& split_info,
+                                                size_t cur_region,
+                                                HeapWord* dest_addr)
+{
+  // The destination must be set even if the region has no data.
+  _region_data[cur_region].set_destination(dest_addr);
+
+  size_t words = _region_data[cur_region].data_size();
+  if (words > 0) {
+    // Compute the destination_count for cur_region, and if necessary, update
+    // source_region for a destination region.  The source_region field is
+    // updated if cur_region is the first (left-most) region to be copied to a
+    // destination region.
+    //
+    // The destination_count calculation is a bit subtle.  A region that has
+    // data that compacts into itself does not count itself as a destination.
+    // This maintains the invariant that a zero count means the region is
+    // available and can be claimed and then filled.
+    uint destination_count = 0;
+    if (split_info.is_split(cur_region)) {
+      // The current region has been split:  the partial object will be copied
+      // to one destination space and the remaining data will be copied to
+      // another destination space.  Adjust the initial destination_count and,
+      // if necessary, set the source_region field if the partial object will
+      // cross a destination region boundary.
+      destination_count = split_info.destination_count();
+      if (destination_count == 2) {
+        size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
+        _region_data[dest_idx].set_source_region(cur_region);
+      }
+    }
+
+    HeapWord* const last_addr = dest_addr + words - 1;
+    const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+    const size_t dest_region_2 = addr_to_region_idx(last_addr);
+
+    // Initially assume that the destination regions will be the same and
+    // adjust the value below if necessary.  Under this assumption, if
+    // cur_region == dest_region_2, then cur_region will be compacted
+    // completely into itself.
+    destination_count += cur_region == dest_region_2 ? 0 : 1;
+    if (dest_region_1 != dest_region_2) {
+      // Destination regions differ; adjust destination_count.
+      destination_count += 1;
+      // Data from cur_region will be copied to the start of dest_region_2.
+      _region_data[dest_region_2].set_source_region(cur_region);
+    } else if (is_region_aligned(dest_addr)) {
+      // Data from cur_region will be copied to the start of the destination
+      // region.
+      _region_data[dest_region_1].set_source_region(cur_region);
+    }
+
+    _region_data[cur_region].set_destination_count(destination_count);
+    _region_data[cur_region].set_data_location(region_to_addr(cur_region));
+    dest_addr += words;
+  }
+  return dest_addr;
+}
+
 HeapWord* ParallelCompactData::calc_new_pointer(HeapWord* addr, ParCompactionManager* cm) const {
   assert(addr != NULL, "Should detect NULL oop earlier");
   assert(ParallelScavengeHeap::heap()->is_in(addr), "not in heap");
@@ -1430,15 +1459,144 @@ PSParallelCompact::compute_dense_prefix(const SpaceId id,
   return sd.region_to_addr(best_cp);
 }
 
+// Summarizes a space that compacts into itself using the GC workers.  The
+// regions are split into chunks; the first pass summarizes the dense prefix
+// chunks and determines the amount of live data in the compacted chunks, the
+// second pass summarizes the compacted chunks after the destination of the
+// first region of each chunk has been computed by a prefix sum.  In both
+// passes each worker only writes the summary data of regions that are
+// uniquely assigned to it:  the source_region field of a destination region is
+// only set by the source region that copies to the start of that region.
+class PSParallelSummaryTask : public AbstractGangTask {
+  ParallelCompactData& _sd;
+  SplitInfo& _split_info;
+
+  size_t const _dense_prefix_beg;
+  size_t const _compacted_beg;
+  size_t const _end;
+  HeapWord* const _target_beg;
+
+  size_t const _chunk_size;
+  size_t const _num_dense_prefix_chunks;
+  size_t const _num_compacted_chunks;
+
+  // Live words and then, after compute_destinations(), the destination of the
+  // compacted chunks.
+  size_t* const _chunk_words;
+  HeapWord** const _chunk_dest;
+
+  bool _fill_pass;
+  volatile size_t _claimed;
+
+  static size_t num_chunks(size_t beg, size_t end, size_t chunk_size) {
+    return (end - beg + chunk_size - 1) / chunk_size;
+  }
+
+  void do_dense_prefix_chunk(size_t chunk) {
+    size_t const beg = _dense_prefix_beg + chunk * _chunk_size;
+    size_t const end = MIN2(beg + _chunk_size, _compacted_beg);
+    _sd.summarize_dense_prefix(_sd.region_to_addr(beg), _sd.region_to_addr(end));
+  }
+
+  void do_compacted_chunk(size_t chunk) {
+    size_t const beg = _compacted_beg + chunk * _chunk_size;
+    size_t const end = MIN2(beg + _chunk_size, _end);
+    if (_fill_pass) {
+      _sd.summarize_regions(_split_info, beg, end, _chunk_dest[chunk]);
+    } else {
+      _chunk_words[chunk] = _sd.data_size(beg, end);
+    }
+  }
+
+public:
+  PSParallelSummaryTask(ParallelCompactData& sd, SplitInfo& split_info,
+                        HeapWord* bottom, HeapWord* dense_prefix_end,
+                        HeapWord* top, size_t chunk_size) :
+    AbstractGangTask("PSParallelSummaryTask"),
+    _sd(sd),
+    _split_info(split_info),
+    _dense_prefix_beg(sd.addr_to_region_idx(bottom)),
+    _compacted_beg(sd.addr_to_region_idx(dense_prefix_end)),
+    _end(sd.addr_to_region_idx(sd.region_align_up(top))),
+    _target_beg(dense_prefix_end),
+    _chunk_size(chunk_size),
+    _num_dense_prefix_chunks(num_chunks(_dense_prefix_beg, _compacted_beg, chunk_size)),
+    _num_compacted_chunks(num_chunks(_compacted_beg, _end, chunk_size)),
+    _chunk_words(NEW_C_HEAP_ARRAY(size_t, _num_compacted_chunks, mtGC)),
+    _chunk_dest(NEW_C_HEAP_ARRAY(HeapWord*, _num_compacted_chunks, mtGC)),
+    _fill_pass(false),
+    _claimed(0) { }
+
+  ~PSParallelSummaryTask() {
+    FREE_C_HEAP_ARRAY(size_t, _chunk_words);
+    FREE_C_HEAP_ARRAY(HeapWord*, _chunk_dest);
+  }
+
+  // Serial prefix sum over the live words of the compacted chunks.  Returns
+  // the new top of the space.
+  HeapWord* compute_destinations() {
+    HeapWord* dest_addr = _target_beg;
+    for (size_t chunk = 0; chunk < _num_compacted_chunks; chunk++) {
+      _chunk_dest[chunk] = dest_addr;
+      dest_addr += _chunk_words[chunk];
+    }
+    _fill_pass = true;
+    _claimed = 0;
+    return dest_addr;
+  }
+
+  void work(uint worker_id) {
+    size_t const num_chunks = _num_compacted_chunks + (_fill_pass ? 0 : _num_dense_prefix_chunks);
+    for (size_t chunk = Atomic::fetch_and_add(&_claimed, (size_t)1);
+         chunk < num_chunks;
+         chunk = Atomic::fetch_and_add(&_claimed, (size_t)1)) {
+      if (chunk < _num_compacted_chunks) {
+        do_compacted_chunk(chunk);
+      } else {
+        do_dense_prefix_chunk(chunk - _num_compacted_chunks);
+      }
+    }
+  }
+};
+
+void PSParallelCompact::summarize_space_in_place(SpaceId id, HeapWord* dense_prefix_end)
+{
+  const MutableSpace* space = _space_info[id].space();
+  SplitInfo& split_info = _space_info[id].split_info();
+  HeapWord** nta = _space_info[id].new_top_addr();
+
+  // Each worker should get a few chunks to balance the work, but the chunks
+  // should be large enough to amortize claiming them.
+  const size_t min_chunk_size = 1024;
+  WorkGang& workers = ParallelScavengeHeap::heap()->workers();
+  const size_t num_regions = _summary_data.addr_to_region_idx(_summary_data.region_align_up(space->top())) -
+                             _summary_data.addr_to_region_idx(space->bottom());
+  const size_t chunk_size = MAX2(num_regions / (workers.active_workers() * 4), min_chunk_size);
+
+  if (!PSParallelSummary || workers.active_workers() == 1 || num_regions < 2 * chunk_size) {
+    if (dense_prefix_end != space->bottom()) {
+      _summary_data.summarize_dense_prefix(space->bottom(), dense_prefix_end);
+    }
+    bool result = _summary_data.summarize(split_info,
+                                          dense_prefix_end, space->top(), NULL,
+                                          dense_prefix_end, space->end(), nta);
+    assert(result, "space must fit into itself");
+    return;
+  }
+
+  PSParallelSummaryTask task(_summary_data, split_info,
+                             space->bottom(), dense_prefix_end, space->top(), chunk_size);
+  workers.run_task(&task);
+  *nta = task.compute_destinations();
+  workers.run_task(&task);
+  assert(*nta <= space->end(), "space must fit into itself");
+}
+
 void PSParallelCompact::summarize_spaces_quick()
 {
   for (unsigned int i = 0; i < last_space_id; ++i) {
     const MutableSpace* space = _space_info[i].space();
-    HeapWord** nta = _space_info[i].new_top_addr();
-    bool result = _summary_data.summarize(_space_info[i].split_info(),
-                                          space->bottom(), space->top(), NULL,
-                                          space->bottom(), space->end(), nta);
-    assert(result, "space must fit into itself");
+    summarize_space_in_place(SpaceId(i), space->bottom());
     _space_info[i].set_dense_prefix(space->bottom());
   }
 }
@@ -1543,11 +1701,7 @@ PSParallelCompact::summarize_space(SpaceId id, bool maximum_compaction)
       fill_dense_prefix_end(id);
 
       // Compute the destination of each Region, and thus each object.
-      _summary_data.summarize_dense_prefix(space->bottom(), dense_prefix_end);
-      _summary_data.summarize(_space_info[id].split_info(),
-                              dense_prefix_end, space->top(), NULL,
-                              dense_prefix_end, space->end(),
-                              _space_info[id].new_top_addr());
+      summarize_space_in_place(id, dense_prefix_end);
     }
   }
 
@@ -442,6 +442,17 @@ public:
                  HeapWord* target_beg, HeapWord* target_end,
                  HeapWord** target_next);
 
+  // Summarize the regions [beg_region, end_region), whose data must fit into
+  // the target space without splitting, starting at dest_addr.  Returns the
+  // address just past the data copied from those regions.  Used to summarize
+  // disjoint ranges of regions in parallel once the destination of the first
+  // region of each range is known.
+  HeapWord* summarize_regions(SplitInfo& split_info, size_t beg_region,
+                              size_t end_region, HeapWord* dest_addr);
+
+  // Return the amount of live data in [beg_region, end_region).
+  size_t data_size(size_t beg_region, size_t end_region) const;
+
   void clear();
   void clear_range(size_t beg_region, size_t end_region);
   void clear_range(HeapWord* beg, HeapWord* end) {
@@ -493,6 +504,11 @@ public:
 #endif  // #ifdef ASSERT
 
 private:
+  // Set up the summary data of a single region that is compacted to dest_addr;
+  // returns the address following its data.
+  HeapWord* summarize_region(SplitInfo& split_info, size_t cur_region,
+                             HeapWord* dest_addr);
+
   bool initialize_block_data();
   bool initialize_region_data(size_t region_size);
   PSVirtualSpace* create_vspace(size_t count, size_t element_size);
@@ -1104,6 +1120,11 @@ class PSParallelCompact : AllStatic {
   // non-empty.
   static void fill_dense_prefix_end(SpaceId id);
 
+  // Summarize the space starting at dense_prefix_end into itself, and the
+  // regions below dense_prefix_end as the dense prefix.  Uses the active GC
+  // workers if PSParallelSummary is set and the space is large enough.
+  static void summarize_space_in_place(SpaceId id, HeapWord* dense_prefix_end);
+
   static void summarize_spaces_quick();
   static void summarize_space(SpaceId id, bool maximum_compaction);
   static void summary_phase(ParCompactionManager* cm, bool maximum_compaction);
@@ -226,6 +226,8 @@ void PSPromotionManager::reset() {
   lab_base = old_gen()->object_space()->top();
   _old_lab.initialize(MemRegion(lab_base, (size_t)0));
   _old_gen_is_full = false;
+  _old_lab_batch_top = NULL;
+  _old_lab_batch_end = NULL;
 
   _promotion_failed_info.reset();
 
@@ -288,6 +290,7 @@ void PSPromotionManager::flush_labs() {
   assert(!_old_lab.is_flushed() || _old_gen_is_full, "Sanity");
   if (!_old_lab.is_flushed())
     _old_lab.flush();
+  retire_old_lab_batch();
 
   // Let PSScavenge know if we overflowed
   if (_young_gen_is_full) {
@@ -295,6 +298,60 @@ void PSPromotionManager::flush_labs() {
   }
 }
 
+HeapWord* PSPromotionManager::allocate_old_lab() {
+  if (pointer_delta(_old_lab_batch_end, _old_lab_batch_top) < OldPLABSize) {
+    // The batch is used up, take the next one. Fall back to a single lab
+    // if the old gen cannot fit a whole batch.
+    retire_old_lab_batch();
+    size_t batch_size = OldPLABSize * PSOldPLABBatchSize;
+    HeapWord* batch = old_gen()->allocate(batch_size);
+    if (batch == NULL && PSOldPLABBatchSize > 1) {
+      batch_size = OldPLABSize;
+      batch = old_gen()->allocate(batch_size);
+    }
+    if (batch == NULL) {
+      return NULL;
+    }
+    if (UseNUMA && PSNUMAAwarePromotion) {
+      bind_to_local_node(batch, batch_size);
+    }
+    _old_lab_batch_top = batch;
+    _old_lab_batch_end = batch + batch_size;
+  }
+  HeapWord* lab_base = _old_lab_batch_top;
+  _old_lab_batch_top += OldPLABSize;
+  return lab_base;
+}
+
+void PSPromotionManager::retire_old_lab_batch() {
+  if (_old_lab_batch_top < _old_lab_batch_end) {
+    CollectedHeap::fill_with_object(_old_lab_batch_top, _old_lab_batch_end);
+    old_gen()->start_array()->allocate_block(_old_lab_batch_top);
+  }
+  _old_lab_batch_top = NULL;
+  _old_lab_batch_end = NULL;
+}
+
+// The old gen is interleaved across the NUMA nodes. Have the untouched pages
+// of a new batch placed on the node of the worker that will fill them.
+void PSPromotionManager::bind_to_local_node(HeapWord* start, size_t word_size) {
+  Thread* thr = Thread::current();
+  int lgrp_id = thr->lgrp_id();
+  if (lgrp_id == -1 || !os::numa_has_group_homing()) {
+    lgrp_id = os::numa_get_group_id();
+    thr->set_lgrp_id(lgrp_id);
+  }
+  MutableSpace* space = old_gen()->object_space();
+  size_t page_size = UseLargePages ? space->alignment() : os::vm_page_size();
+  HeapWord* aligned_start = align_up(start, page_size);
+  HeapWord* aligned_end = align_down(start + word_size, page_size);
+  if (aligned_end > aligned_start) {
+    os::numa_make_local((char*)aligned_start,
+                        pointer_delta(aligned_end, aligned_start, sizeof(char)),
+                        lgrp_id);
+  }
+}
+
 template <class T> void PSPromotionManager::process_array_chunk_work(
                                                  oop obj,
                                                  int start, int end) {
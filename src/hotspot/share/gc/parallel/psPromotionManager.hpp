@@ -80,6 +80,10 @@ class PSPromotionManager {
   bool                                _young_gen_is_full;
   bool                                _old_gen_is_full;
 
+  // Old gen space taken in advance for the next PSOldPLABBatchSize old labs.
+  HeapWord*                           _old_lab_batch_top;
+  HeapWord*                           _old_lab_batch_end;
+
   PSScannerTasksQueue                 _claimed_stack_depth;
   OverflowTaskQueue<oop, mtGC>        _claimed_stack_breadth;
 
@@ -110,6 +114,13 @@ class PSPromotionManager {
 
   static PSScannerTasksQueueSet* stack_array_depth() { return _stack_array_depth; }
 
+  // Returns the start of a new old lab of OldPLABSize words, or NULL if the
+  // old gen is full.
+  HeapWord* allocate_old_lab();
+  // Fills the unused part of the old lab batch with a dead object.
+  void retire_old_lab_batch();
+  void bind_to_local_node(HeapWord* start, size_t word_size);
+
  public:
   // Static
   static void initialize();
@@ -201,7 +201,7 @@ inline oop PSPromotionManager::copy_to_survivor_space(oop o) {
             // Flush and fill
             _old_lab.flush();
 
-            HeapWord* lab_base = old_gen()->allocate(OldPLABSize);
+            HeapWord* lab_base = allocate_old_lab();
             if(lab_base != NULL) {
 #ifdef ASSERT
               // Delay the initialization of the promotion lab (plab).
@@ -150,6 +150,13 @@ public:
 
 PSIsAliveClosure PSScavenge::_is_alive_closure;
 
+class PSIsYoungClosure: public BoolObjectClosure {
+public:
+  bool do_object_b(oop p) {
+    return PSScavenge::is_obj_in_young(p);
+  }
+};
+
 class PSKeepAliveClosure: public OopClosure {
 protected:
   MutableSpace* _to_space;
@@ -286,6 +293,7 @@ class ScavengeRootsTask : public AbstractGangTask {
   uint _active_workers;
   bool _is_empty;
   TaskTerminator _terminator;
+  volatile size_t _claimed_stripes;
 
 public:
   ScavengeRootsTask(PSOldGen* old_gen,
@@ -299,7 +307,8 @@ public:
       _gen_top(gen_top),
       _active_workers(active_workers),
       _is_empty(is_empty),
-      _terminator(active_workers, PSPromotionManager::vm_thread_promotion_manager()->stack_array_depth()) {
+      _terminator(active_workers, PSPromotionManager::vm_thread_promotion_manager()->stack_array_depth()),
+      _claimed_stripes(0) {
   }
 
   virtual void work(uint worker_id) {
@@ -324,7 +333,8 @@ public:
                                                _gen_top,
                                                pm,
                                                worker_id,
-                                               _active_workers);
+                                               _active_workers,
+                                               PSDynamicCardStripes ? &_claimed_stripes : NULL);
 
         // Do the real work
         pm->drain_stacks(false);
@@ -503,7 +513,9 @@ bool PSScavenge::invoke_no_policy() {
     {
       GCTraceTime(Debug, gc, phases) tm("Weak Processing", &_gc_timer);
       PSAdjustWeakRootsClosure root_closure;
-      WeakProcessor::weak_oops_do(&ParallelScavengeHeap::heap()->workers(), &_is_alive_closure, &root_closure, 1);
+      PSIsYoungClosure is_young;
+      WeakProcessor::weak_oops_do(&ParallelScavengeHeap::heap()->workers(), &_is_alive_closure, &root_closure, 1,
+                                  YoungGCSkipsOldWeakRoots ? &is_young : NULL);
     }
 
     // Verify that usage of root_closure didn't copy any objects.
@@ -27,6 +27,7 @@
 #include "gc/parallel/parallelScavengeHeap.hpp"
 #include "gc/parallel/psScavenge.hpp"
 #include "gc/parallel/psYoungGen.hpp"
+#include "gc/shared/concurrentPretouchThread.hpp"
 #include "gc/shared/gcUtil.hpp"
 #include "gc/shared/genArguments.hpp"
 #include "gc/shared/spaceDecorator.inline.hpp"
@@ -300,6 +301,10 @@ bool PSYoungGen::resize_generation(size_t eden_size, size_t survivor_size) {
       MemRegion mangle_region(prev_high, new_high);
       SpaceMangler::mangle_region(mangle_region);
     }
+    ConcurrentPretouchThread* pretouch_thread = ParallelScavengeHeap::heap()->pretouch_thread();
+    if (pretouch_thread != NULL) {
+      pretouch_thread->request(MemRegion(prev_high, (HeapWord*) virtual_space()->high()));
+    }
     size_changed = true;
   } else if (desired_size < orig_size) {
     size_t desired_change = orig_size - desired_size;
@@ -308,6 +313,11 @@ bool PSYoungGen::resize_generation(size_t eden_size, size_t survivor_size) {
     desired_change = limit_gen_shrink(desired_change);
 
     if (desired_change > 0) {
+      ConcurrentPretouchThread* pretouch_thread = ParallelScavengeHeap::heap()->pretouch_thread();
+      if (pretouch_thread != NULL) {
+        // Do not touch memory that is about to be uncommitted.
+        pretouch_thread->cancel_all();
+      }
       virtual_space()->shrink_by(desired_change);
       reset_survivors_after_shrink();
 
@@ -73,6 +73,10 @@ bool DefNewGeneration::IsAliveClosure::do_object_b(oop p) {
   return cast_from_oop<HeapWord*>(p) >= _young_gen->reserved().end() || p->is_forwarded();
 }
 
+bool DefNewGeneration::IsYoungClosure::do_object_b(oop p) {
+  return cast_from_oop<HeapWord*>(p) < _young_gen->reserved().end();
+}
+
 DefNewGeneration::KeepAliveClosure::
 KeepAliveClosure(ScanWeakRefClosure* cl) : _cl(cl) {
   _rs = GenCollectedHeap::heap()->rem_set();
@@ -596,7 +600,9 @@ void DefNewGeneration::collect(bool   full,
 
   assert(heap->no_allocs_since_save_marks(), "save marks have not been newly set.");
 
-  WeakProcessor::weak_oops_do(&is_alive, &keep_alive);
+  IsYoungClosure is_young(this);
+  WeakProcessor::weak_oops_do(&is_alive, &keep_alive,
+                              YoungGCSkipsOldWeakRoots ? &is_young : NULL);
 
   // Verify that the usage of keep_alive didn't copy any objects.
   assert(heap->no_allocs_since_save_marks(), "save marks have not been newly set.");
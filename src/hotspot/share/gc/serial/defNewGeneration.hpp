@@ -160,6 +160,13 @@ protected:
     bool do_object_b(oop p);
   };
 
+  class IsYoungClosure: public BoolObjectClosure {
+    Generation* _young_gen;
+  public:
+    IsYoungClosure(Generation* young_gen) : _young_gen(young_gen) { }
+    bool do_object_b(oop p);
+  };
+
   class KeepAliveClosure: public OopClosure {
   protected:
     ScanWeakRefClosure* _cl;
@@ -99,3 +99,17 @@ void SerialHeap::young_process_roots(OopIterateClosure* root_closure,
 
   old_gen()->younger_refs_iterate(old_gen_closure);
 }
+
+HeapWord* SerialHeap::allocate_loaded_archive_space(size_t word_size) {
+  MutexLocker ml(Heap_lock);
+  HeapWord* result = old_gen()->allocate(word_size, false /* is_tlab */);
+  if (result == NULL) {
+    result = old_gen()->expand_and_allocate(word_size, false /* is_tlab */);
+  }
+  return result;
+}
+
+void SerialHeap::complete_loaded_archive_space(MemRegion archive_space) {
+  assert(old_gen()->used_region().contains(archive_space), "Archive space not contained in old gen");
+  old_gen()->complete_loaded_archive_space(archive_space);
+}
@@ -80,6 +80,11 @@ public:
   void young_process_roots(OopIterateClosure* root_closure,
                            OopIterateClosure* old_gen_closure,
                            CLDClosure* cld_closure);
+
+  // Support for loading objects from CDS archive into the heap
+  virtual bool can_load_archived_objects() const { return true; }
+  virtual HeapWord* allocate_loaded_archive_space(size_t word_size);
+  virtual void complete_loaded_archive_space(MemRegion archive_space);
 };
 
 #endif // SHARE_GC_SERIAL_SERIALHEAP_HPP
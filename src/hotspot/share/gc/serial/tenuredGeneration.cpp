@@ -218,6 +218,19 @@ TenuredGeneration::expand_and_allocate(size_t word_size,
   }
 }
 
+void TenuredGeneration::complete_loaded_archive_space(MemRegion archive_space) {
+  // Create the BOT for the archive space.
+  TenuredSpace* space = (TenuredSpace*)_the_space;
+  assert(archive_space.start() == space->bottom(), "archive space must be at the bottom");
+  space->initialize_threshold();
+  HeapWord* start = archive_space.start();
+  while (start < archive_space.end()) {
+    size_t word_size = space->block_size(start);
+    space->alloc_block(start, start + word_size);
+    start += word_size;
+  }
+}
+
 bool TenuredGeneration::expand(size_t bytes, size_t expand_bytes) {
   GCMutexLocker x(ExpandHeap_lock);
   return CardGeneration::expand(bytes, expand_bytes);
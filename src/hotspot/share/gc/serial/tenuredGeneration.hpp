@@ -97,6 +97,10 @@ class TenuredGeneration: public CardGeneration {
                                 bool is_tlab,
                                 bool parallel = false);
 
+  // Record the objects in archive_space, which is at the bottom of the
+  // generation, in the block offset table.
+  void complete_loaded_archive_space(MemRegion archive_space);
+
   virtual void prepare_for_verify();
 
   virtual void gc_prologue(bool full);
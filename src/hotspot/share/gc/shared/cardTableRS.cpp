@@ -53,6 +53,29 @@ bool ClearNoncleanCardWrapper::is_word_aligned(CardTable::CardValue* entry) {
   return (((intptr_t)entry) & (BytesPerWord-1)) == 0;
 }
 
+// Returns the lowest entry of the run of clean card words that ends just
+// below the word-aligned entry, not going below limit.  Mostly clean card
+// tables are skipped several words at a time, combining the words with a
+// single test.
+CardTable::CardValue* ClearNoncleanCardWrapper::skip_clean_rows(CardValue* entry,
+                                                                const CardValue* limit) {
+  assert(is_word_aligned(entry), "precondition");
+  const size_t rows_per_step = 4;
+  const size_t step = rows_per_step * BytesPerWord;
+  CardValue* cur_row = entry - BytesPerWord;
+  while (cur_row - (step - BytesPerWord) >= limit) {
+    const intptr_t* rows = (const intptr_t*)(cur_row - (step - BytesPerWord));
+    if ((rows[0] & rows[1] & rows[2] & rows[3]) != CardTableRS::clean_card_row_val()) {
+      break;
+    }
+    cur_row -= step;
+  }
+  while (cur_row >= limit && *((intptr_t*)cur_row) == CardTableRS::clean_card_row_val()) {
+    cur_row -= BytesPerWord;
+  }
+  return cur_row + BytesPerWord;
+}
+
 // The regions are visited in *decreasing* address order.
 // This order aids with imprecise card marking, where a dirty
 // card may cause scanning, and summarization marking, of objects
@@ -81,11 +104,7 @@ void ClearNoncleanCardWrapper::do_MemRegion(MemRegion mr) {
 
       // fast forward through potential continuous whole-word range of clean cards beginning at a word-boundary
       if (is_word_aligned(cur_entry)) {
-        CardValue* cur_row = cur_entry - BytesPerWord;
-        while (cur_row >= limit && *((intptr_t*)cur_row) ==  CardTableRS::clean_card_row_val()) {
-          cur_row -= BytesPerWord;
-        }
-        cur_entry = cur_row + BytesPerWord;
+        cur_entry = skip_clean_rows(cur_entry, limit);
         cur_hw = _ct->addr_for(cur_entry);
       }
 
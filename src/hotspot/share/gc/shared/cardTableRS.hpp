@@ -92,6 +92,8 @@ private:
   inline bool clear_card(CardValue* entry);
   // check alignment of pointer
   bool is_word_aligned(CardValue* entry);
+  // Skip clean card words below entry
+  CardValue* skip_clean_rows(CardValue* entry, const CardValue* limit);
 
 public:
   ClearNoncleanCardWrapper(DirtyCardToOopClosure* dirty_card_closure, CardTableRS* ct);
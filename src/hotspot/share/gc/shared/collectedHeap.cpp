@@ -626,6 +626,10 @@ bool CollectedHeap::is_archived_object(oop object) const {
   return false;
 }
 
+HeapWord* CollectedHeap::allocate_loaded_archive_space(size_t word_size) {
+  return NULL;
+}
+
 uint32_t CollectedHeap::hash_oop(oop obj) const {
   const uintptr_t addr = cast_from_oop<uintptr_t>(obj);
   return static_cast<uint32_t>(addr >> LogMinObjAlignment);
@@ -391,6 +391,12 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   // Keep alive an object that was loaded with AS_NO_KEEPALIVE.
   virtual void keep_alive(oop obj) {}
 
+  // Print a class histogram of live objects without a safepoint heap
+  // inspection, if the collector supports it. Returns false otherwise.
+  virtual bool print_concurrent_class_histogram(outputStream* st) {
+    return false;
+  }
+
   // Perform any cleanup actions necessary before allowing a verification.
   virtual void prepare_for_verify() = 0;
 
@@ -481,6 +487,14 @@ class CollectedHeap : public CHeapObj<mtInternal> {
   // Is the given object inside a CDS archive area?
   virtual bool is_archived_object(oop object) const;
 
+  // Support for loading the CDS archived heap objects into the heap, for
+  // collectors that cannot map the archived heap regions. The space is
+  // allocated during VM initialization; after the objects have been copied
+  // into it, complete_loaded_archive_space() makes the heap aware of them.
+  virtual bool can_load_archived_objects() const { return false; }
+  virtual HeapWord* allocate_loaded_archive_space(size_t word_size);
+  virtual void complete_loaded_archive_space(MemRegion archive_space) { }
+
   virtual bool is_oop(oop object) const;
   // Non product verification and debugging.
 #ifndef PRODUCT
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/concurrentPretouchThread.hpp"
+#include "gc/shared/pretouchTask.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutex.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
+
+ConcurrentPretouchThread::ConcurrentPretouchThread(const char* name) :
+  ConcurrentGCThread(),
+  _monitor(new Monitor(Mutex::leaf - 1, "ConcurrentPretouch_lock", true, Monitor::_safepoint_check_never)),
+  _requests(),
+  _cancel_count(0) {
+  set_name("%s", name);
+  create_and_start();
+}
+
+void ConcurrentPretouchThread::request(MemRegion mr) {
+  if (mr.is_empty()) {
+    return;
+  }
+  MonitorLocker ml(_monitor, Mutex::_no_safepoint_check_flag);
+  _requests.push(mr);
+  ml.notify();
+}
+
+void ConcurrentPretouchThread::cancel_all() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  MutexLocker ml(_monitor, Mutex::_no_safepoint_check_flag);
+  _requests.clear();
+  Atomic::inc(&_cancel_count);
+}
+
+bool ConcurrentPretouchThread::wait_for_requests() {
+  MonitorLocker ml(_monitor, Mutex::_no_safepoint_check_flag);
+  while (_requests.is_empty() && !should_terminate()) {
+    ml.wait();
+  }
+  return !should_terminate();
+}
+
+void ConcurrentPretouchThread::pretouch(MemRegion mr, SuspendibleThreadSetJoiner* sts) {
+  const uint cancel_count = Atomic::load(&_cancel_count);
+  const size_t page_size = os::vm_page_size();
+  const size_t chunk_size = MAX2(PretouchTask::chunk_size(), page_size);
+  char* cur = align_up((char*)mr.start(), page_size);
+  char* const end = (char*)mr.end();
+  log_debug(gc, heap)("%s pre-touching " SIZE_FORMAT "B at " PTR_FORMAT,
+                      name(), mr.byte_size(), p2i(mr.start()));
+  while (cur < end) {
+    if (sts->should_yield()) {
+      sts->yield();
+      if (cancel_count != Atomic::load(&_cancel_count)) {
+        return;
+      }
+    }
+    if (should_terminate()) {
+      return;
+    }
+    char* chunk_end = cur + MIN2(chunk_size, pointer_delta(end, cur, sizeof(char)));
+    for ( ; cur < chunk_end; cur += page_size) {
+      Atomic::add(reinterpret_cast<int*>(cur), 0);
+    }
+  }
+}
+
+void ConcurrentPretouchThread::run_service() {
+  while (wait_for_requests()) {
+    // Take the request only once joined, so that it cannot be cancelled
+    // before pretouch notices.
+    SuspendibleThreadSetJoiner sts;
+    MemRegion mr;
+    {
+      MutexLocker ml(_monitor, Mutex::_no_safepoint_check_flag);
+      if (_requests.is_empty()) {
+        continue;
+      }
+      mr = _requests.pop();
+    }
+    pretouch(mr, &sts);
+  }
+}
+
+void ConcurrentPretouchThread::stop_service() {
+  MonitorLocker ml(_monitor, Mutex::_no_safepoint_check_flag);
+  ml.notify_all();
+}
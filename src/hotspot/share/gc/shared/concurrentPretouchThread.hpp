@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_CONCURRENTPRETOUCHTHREAD_HPP
+#define SHARE_GC_SHARED_CONCURRENTPRETOUCHTHREAD_HPP
+
+#include "gc/shared/concurrentGCThread.hpp"
+#include "memory/memRegion.hpp"
+#include "utilities/growableArray.hpp"
+
+class Monitor;
+class SuspendibleThreadSetJoiner;
+
+// Pre-touches newly committed heap memory in the background, so that the
+// page faults for it are not taken later by allocation or promotion,
+// possibly in a pause.  Unlike the pre-touching for AlwaysPreTouch, the
+// memory may already be in use: pages are touched by atomically adding
+// zero to their first word, which does not change their contents.
+//
+// The thread touches memory while joined to the suspendible thread set,
+// so the heap must synchronize the set at safepoints.  Memory must only be
+// uncommitted at a safepoint, after cancelling all requests.
+class ConcurrentPretouchThread : public ConcurrentGCThread {
+  Monitor* _monitor;
+  GrowableArrayCHeap<MemRegion, mtGC> _requests;
+  // Incremented by cancel_all, so that the thread abandons the region it
+  // is touching when resuming from a safepoint.
+  volatile uint _cancel_count;
+
+  bool wait_for_requests();
+  void pretouch(MemRegion mr, SuspendibleThreadSetJoiner* sts);
+
+protected:
+  virtual void run_service();
+  virtual void stop_service();
+
+public:
+  ConcurrentPretouchThread(const char* name);
+
+  // Request pre-touching of mr.
+  void request(MemRegion mr);
+
+  // Drop all requests, including the one being processed.
+  // precondition: at safepoint
+  void cancel_all();
+};
+
+#endif // SHARE_GC_SHARED_CONCURRENTPRETOUCHTHREAD_HPP
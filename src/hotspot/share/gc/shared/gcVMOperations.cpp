@@ -134,6 +134,15 @@ void VM_GC_Operation::doit_epilogue() {
   VM_GC_Sync_Operation::doit_epilogue();
 }
 
+bool VM_GC_HeapInspection::doit_prologue() {
+  // Let a collector that can do it print the histogram concurrently,
+  // in which case no safepoint operation is needed.
+  if (Universe::heap()->print_concurrent_class_histogram(_out)) {
+    return false;
+  }
+  return VM_GC_Operation::doit_prologue();
+}
+
 bool VM_GC_HeapInspection::skip_operation() const {
   return false;
 }
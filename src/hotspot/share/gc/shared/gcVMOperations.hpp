@@ -173,6 +173,7 @@ class VM_GC_HeapInspection: public VM_GC_Operation {
 
   ~VM_GC_HeapInspection() {}
   virtual VMOp_Type type() const { return VMOp_GC_HeapInspection; }
+  virtual bool doit_prologue();
   virtual bool skip_operation() const;
   virtual void doit();
  protected:
@@ -196,6 +196,11 @@
           "bigger than this")                                               \
           range(1, max_jint/3)                                              \
                                                                             \
+  product(bool, RestorePreservedMarksBySegment, false, EXPERIMENTAL,        \
+          "Restore preserved marks in parallel by stack segment instead "   \
+          "of by whole per-worker stack, to balance the work when few "     \
+          "threads preserved most marks")                                   \
+                                                                            \
                                                                             \
   product(bool, AlwaysPreTouch, false,                                      \
           "Force all freshly committed pages to be pre-touched")            \
@@ -204,6 +209,11 @@
           "Per-thread chunk size for parallel memory pre-touch.")           \
           range(4*K, SIZE_MAX / 2)                                          \
                                                                             \
+  product(bool, ConcurrentPreTouch, false, EXPERIMENTAL,                    \
+          "Pre-touch memory committed by heap expansion in a background "   \
+          "thread. Only supported by Parallel GC, and ignored if "          \
+          "AlwaysPreTouch is set")                                          \
+                                                                            \
   /* where does the range max value of (max_jint - 1) come from? */         \
   product(size_t, MarkStackSizeMax, NOT_LP64(4*M) LP64_ONLY(512*M),         \
           "Maximum size of marking stack")                                  \
@@ -232,6 +242,10 @@
                "ParallelRefProcEnabled is true. Specify 0 to disable and "  \
                "use all threads.")                                          \
                                                                             \
+  product(bool, YoungGCSkipsOldWeakRoots, false, EXPERIMENTAL,              \
+          "Young collections only process the blocks of weak OopStorages "  \
+          "that may refer to young objects, instead of all weak roots")     \
+                                                                            \
   product(uintx, InitiatingHeapOccupancyPercent, 45,                        \
           "The percent occupancy (IHOP) of the current old generation "     \
           "capacity above which a concurrent mark cycle will be initiated " \
@@ -269,6 +283,12 @@
   product(uintx, WorkStealingSleepMillis, 1, EXPERIMENTAL,                  \
           "Sleep time when sleep is used for yields")                       \
                                                                             \
+  product(uintx, WorkStealingMaxSleepMillis, 1, EXPERIMENTAL,               \
+          "Maximum sleep time of a thread waiting for termination. The "    \
+          "sleep time starts at WorkStealingSleepMillis and doubles "       \
+          "every time the thread wakes up without finding work")            \
+          range(1, 1000)                                                    \
+                                                                            \
   product(uintx, WorkStealingYieldsBeforeSleep, 5000, EXPERIMENTAL,         \
           "Number of yields before a sleep is done during work stealing")   \
                                                                             \
@@ -279,6 +299,13 @@
   product(uintx, WorkStealingSpinToYieldRatio, 10, EXPERIMENTAL,            \
           "Ratio of hard spins to calls to yield")                          \
                                                                             \
+  product(uintx, WorkStealingBatchSize, 1, EXPERIMENTAL,                    \
+          "Maximum number of tasks taken from the victim queue by a "       \
+          "successful steal, the tasks beyond the first are moved to the "  \
+          "stealing thread's queue. At most half of the tasks left in the " \
+          "victim queue are taken")                                         \
+          range(1, 1024)                                                    \
+                                                                            \
   develop(uintx, ObjArrayMarkingStride, 2048,                               \
           "Number of object array elements to push onto the marking stack " \
           "before pushing a continuation entry")                            \
@@ -362,6 +362,9 @@ oop MemAllocator::allocate() const {
     Allocation allocation(*this, &obj);
     HeapWord* mem = mem_allocate(allocation);
     if (mem != NULL) {
+      // With ZeroTLAB, TLABs are cleared when they are handed out, and the
+      // unallocated part of a TLAB is never written, like compiled code assumes.
+      _mem_zeroed = UseTLAB && ZeroTLAB && !allocation._allocated_outside_tlab;
       obj = initialize(mem);
     } else {
       // The unhandled oop detector will poison local variable obj,
@@ -376,6 +379,9 @@ void MemAllocator::mem_clear(HeapWord* mem) const {
   assert(mem != NULL, "cannot initialize NULL object");
   const size_t hs = oopDesc::header_size();
   assert(_word_size >= hs, "unexpected object size");
+  if (_mem_zeroed) {
+    return;
+  }
   oopDesc::set_klass_gap(mem, 0);
   Copy::fill_to_aligned_words(mem + hs, _word_size - hs);
 }
@@ -41,6 +41,8 @@ protected:
   Thread* const        _thread;
   Klass* const         _klass;
   const size_t         _word_size;
+  // Set by allocate() if the memory is known to be zeroed already.
+  mutable bool         _mem_zeroed;
 
 private:
   // Allocate from the current thread's TLAB, with broken-out slow path.
@@ -52,10 +54,11 @@ protected:
   MemAllocator(Klass* klass, size_t word_size, Thread* thread)
     : _thread(thread),
       _klass(klass),
-      _word_size(word_size)
+      _word_size(word_size),
+      _mem_zeroed(false)
   { }
 
-  // This function clears the memory of the object
+  // This function clears the memory of the object, unless it is already zeroed
   void mem_clear(HeapWord* mem) const;
   // This finish constructing an oop by installing the mark word and the Klass* pointer
   // last. At the point when the Klass pointer is initialized, this is a constructed object
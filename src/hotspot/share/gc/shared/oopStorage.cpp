@@ -222,7 +222,8 @@ OopStorage::Block::Block(const OopStorage* owner, void* memory) :
   _active_index(0),
   _allocation_list_entry(),
   _deferred_updates_next(NULL),
-  _release_refcount(0)
+  _release_refcount(0),
+  _may_refer_to_young(false)
 {
   STATIC_ASSERT(_data_pos == 0);
   STATIC_ASSERT(section_size * section_count == ARRAY_SIZE(_data));
@@ -329,6 +330,7 @@ oop* OopStorage::Block::allocate() {
   unsigned index = count_trailing_zeros(~allocated);
   // Use atomic update because release may change bitmask.
   atomic_add_allocated(bitmask_for_index(index));
+  set_may_refer_to_young();
   return get_pointer(index);
 }
 
@@ -337,6 +339,7 @@ uintx OopStorage::Block::allocate_all() {
   assert(new_allocated != 0, "attempt to allocate from full block");
   // Use atomic update because release may change bitmask.
   atomic_add_allocated(new_allocated);
+  set_may_refer_to_young();
   return new_allocated;
 }
 
@@ -807,6 +810,43 @@ void OopStorage::release(const oop* const* ptrs, size_t size) {
   }
 }
 
+OopStorage::ThreadCache::ThreadCache() : _entries(), _count(0) {}
+
+OopStorage::ThreadCache::~ThreadCache() {
+  assert(_count == 0, "cache not flushed");
+}
+
+oop* OopStorage::ThreadCache::allocate(OopStorage* storage) {
+  if (_count == 0) {
+    _count = storage->allocate(_entries, ARRAY_SIZE(_entries));
+    if (_count == 0) return NULL;
+  }
+  oop* result = _entries[--_count];
+  assert(*result == NULL, "invariant");
+  // A young collection may have found the block old while the entry was
+  // cached, so mark it again now that the entry is handed out.
+  Block::block_for_ptr(storage, result)->set_may_refer_to_young();
+  return result;
+}
+
+void OopStorage::ThreadCache::release(OopStorage* storage, const oop* ptr) {
+  check_release_entry(ptr);
+  assert(storage->find_block_or_null(ptr) != NULL,
+         "%s: invalid release " PTR_FORMAT, storage->name(), p2i(ptr));
+  if (_count < ARRAY_SIZE(_entries)) {
+    _entries[_count++] = const_cast<oop*>(ptr);
+  } else {
+    storage->release(ptr);
+  }
+}
+
+void OopStorage::ThreadCache::flush(OopStorage* storage) {
+  if (_count > 0) {
+    storage->release(_entries, _count);
+    _count = 0;
+  }
+}
+
 const size_t initial_active_array_size = 8;
 
 static Mutex* make_oopstorage_mutex(const char* storage_name,
@@ -137,6 +137,37 @@ public:
   // precondition: *ptrs[i] == NULL, for i in [0,size).
   void release(const oop* const* ptrs, size_t size);
 
+  // A cache of free entries of a storage object, for use by a single
+  // thread.  An empty cache is refilled by a bulk allocation, so the
+  // _allocation_mutex is taken once per bulk_allocate_limit allocations.
+  // Released entries are retained by the cache and handed out again
+  // without updating their block, until the cache is full.  Entries in a
+  // cache are still allocated as far as the storage object is concerned;
+  // they are NULL entries, which iteration already has to tolerate.
+  class ThreadCache {
+    oop* _entries[bulk_allocate_limit];
+    size_t _count;
+
+    NONCOPYABLE(ThreadCache);
+
+  public:
+    ThreadCache();
+    ~ThreadCache();
+
+    // Returns a new entry of storage, or NULL if memory allocation failed.
+    // postcondition: result == NULL or *result == NULL.
+    oop* allocate(OopStorage* storage);
+
+    // Returns ptr to the cache, or to storage if the cache is full.
+    // precondition: ptr is a valid allocated entry of storage.
+    // precondition: *ptr == NULL.
+    void release(OopStorage* storage, const oop* ptr);
+
+    // Releases all cached entries to storage.  The cache must only contain
+    // entries of storage.
+    void flush(OopStorage* storage);
+  };
+
   // Applies f to each allocated entry's location.  f must be a function or
   // function object.  Assume p is either a const oop* or an oop*, depending
   // on whether the associated storage is const or non-const, respectively.
@@ -169,6 +200,15 @@ public:
   template<typename IsAliveClosure, typename Closure>
   inline void weak_oops_do(IsAliveClosure* is_alive, Closure* closure);
 
+  // young_oops_do is like oops_do, but for use by young collections.  It
+  // skips the blocks that are known to have no entries referring to objects
+  // for which is_young->do_object_b() is true, i.e. blocks whose entries
+  // were all found old by the previous young_oops_do, and from which no
+  // entry has been handed out since.  Entries with young values after the
+  // closure has been applied keep their block from being skipped next time.
+  template<typename IsYoungClosure, typename Closure>
+  inline void young_oops_do(IsYoungClosure* is_young, Closure* closure);
+
   // Parallel iteration is for the exclusive use of the GC.
   // Other clients must use serial iteration.
   template<bool concurrent, bool is_const> class ParState;
@@ -143,6 +143,8 @@ class OopStorage::Block /* No base class, to avoid messing up alignment. */ {
   AllocationListEntry _allocation_list_entry;
   Block* volatile _deferred_updates_next;
   volatile uintx _release_refcount;
+  // Set when an entry is handed out, and recomputed by young_iterate.
+  volatile bool _may_refer_to_young;
 
   Block(const OopStorage* owner, void* memory);
   ~Block();
@@ -196,6 +198,15 @@ public:
 
   template<typename F> bool iterate(F f);
   template<typename F> bool iterate(F f) const;
+
+  // Young iteration support.  Entries handed out from the block may be
+  // given young values, so handing out an entry sets the flag.
+  // young_iterate applies f to the entries of the block if the flag is
+  // set, and then keeps the flag only if an entry's value still satisfies
+  // is_young.  precondition: at safepoint.
+  bool may_refer_to_young() const { return _may_refer_to_young; }
+  void set_may_refer_to_young() { _may_refer_to_young = true; }
+  template<typename IsYoung, typename F> void young_iterate(IsYoung* is_young, F f);
 }; // class Block
 
 inline OopStorage::Block* OopStorage::AllocationList::head() {
@@ -351,6 +362,26 @@ inline bool OopStorage::Block::iterate(F f) const {
   return iterate_impl(f, this);
 }
 
+template<typename IsYoung, typename F>
+inline void OopStorage::Block::young_iterate(IsYoung* is_young, F f) {
+  if (!may_refer_to_young()) {
+    return;
+  }
+  bool found_young = false;
+  uintx bitmask = allocated_bitmask();
+  while (bitmask != 0) {
+    unsigned index = count_trailing_zeros(bitmask);
+    bitmask ^= bitmask_for_index(index);
+    oop* ptr = get_pointer(index);
+    f(ptr);
+    oop v = *ptr;
+    if (!found_young && (v != NULL) && is_young->do_object_b(v)) {
+      found_young = true;
+    }
+  }
+  _may_refer_to_young = found_young;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Support for serial iteration, always at a safepoint.
 
@@ -403,4 +434,14 @@ inline void OopStorage::weak_oops_do(IsAliveClosure* is_alive, Closure* cl) {
   iterate_safepoint(if_alive_fn(is_alive, oop_fn(cl)));
 }
 
+template<typename IsYoungClosure, typename Closure>
+inline void OopStorage::young_oops_do(IsYoungClosure* is_young, Closure* cl) {
+  assert_at_safepoint();
+  ActiveArray* blocks = _active_array;
+  size_t limit = blocks->block_count();
+  for (size_t i = 0; i < limit; ++i) {
+    blocks->at(i)->young_iterate(is_young, oop_fn(cl));
+  }
+}
+
 #endif // SHARE_GC_SHARED_OOPSTORAGE_INLINE_HPP
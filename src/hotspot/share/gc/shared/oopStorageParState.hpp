@@ -110,6 +110,10 @@
 // pre-filtering being applied (successfully or not) to objects that
 // are unrelated to what the closure finds in the entry.
 //
+// template<typename IsYoungClosure, typename Closure>
+// void young_oops_do(IsYoungClosure* is_young, Closure* cl)
+//   Parallel version of OopStorage::young_oops_do.
+//
 // template<typename Closure> void weak_oops_do(Closure* cl)
 // template<typename IsAliveClosure, typename Closure>
 // void weak_oops_do(IsAliveClosure* is_alive, Closure* cl)
@@ -155,6 +159,7 @@ public:
   const OopStorage* storage() const { return _storage; }
 
   template<bool is_const, typename F> void iterate(F f);
+  template<typename IsYoung, typename F> void young_iterate(IsYoung* is_young, F f);
 
   static uint default_estimated_thread_count(bool concurrent);
 
@@ -202,6 +207,8 @@ public:
   template<typename Closure> void weak_oops_do(Closure* cl);
   template<typename IsAliveClosure, typename Closure>
   void weak_oops_do(IsAliveClosure* is_alive, Closure* cl);
+  template<typename IsYoungClosure, typename Closure>
+  void young_oops_do(IsYoungClosure* is_young, Closure* cl);
 
   size_t num_dead() const { return _basic_state.num_dead(); }
   void increment_num_dead(size_t num_dead) { _basic_state.increment_num_dead(num_dead); }
@@ -65,6 +65,20 @@ inline void OopStorage::BasicParState::iterate(F f) {
   }
 }
 
+template<typename IsYoung, typename F>
+inline void OopStorage::BasicParState::young_iterate(IsYoung* is_young, F f) {
+  assert(!_concurrent, "young iteration must be at safepoint");
+  IterationData data = {};      // zero initialize.
+  while (claim_next_segment(&data)) {
+    assert(data._segment_start < data._segment_end, "invariant");
+    assert(data._segment_end <= _block_count, "invariant");
+    size_t i = data._segment_start;
+    do {
+      _active_array->at(i)->young_iterate(is_young, f);
+    } while (++i < data._segment_end);
+  }
+}
+
 template<bool concurrent, bool is_const>
 template<typename F>
 inline void OopStorage::ParState<concurrent, is_const>::iterate(F f) {
@@ -97,4 +111,9 @@ inline void OopStorage::ParState<false, false>::weak_oops_do(IsAliveClosure* is_
   this->iterate(if_alive_fn(is_alive, oop_fn(cl)));
 }
 
+template<typename IsYoungClosure, typename Closure>
+inline void OopStorage::ParState<false, false>::young_oops_do(IsYoungClosure* is_young, Closure* cl) {
+  _basic_state.young_iterate(is_young, oop_fn(cl));
+}
+
 #endif // SHARE_GC_SHARED_OOPSTORAGEPARSTATE_INLINE_HPP
@@ -51,6 +51,15 @@ void PreservedMarks::adjust_during_full_gc() {
   }
 }
 
+void PreservedMarks::add_segments(GrowableArrayCHeap<Segment, mtGC>* segments) {
+  StackIterator<OopAndMarkWord, mtGC> iter(_stack);
+  while (!iter.is_empty()) {
+    size_t size;
+    OopAndMarkWord* base = iter.next_segment(&size);
+    segments->append(Segment(base, size));
+  }
+}
+
 void PreservedMarks::restore_and_increment(volatile size_t* const total_size_addr) {
   const size_t stack_size = size();
   restore();
@@ -100,8 +109,31 @@ class RestorePreservedMarksTask : public AbstractGangTask {
   size_t _total_size_before;
 #endif // ASSERT
 
+  // With RestorePreservedMarksBySegment, the segments of all stacks, which
+  // are claimed one at a time. A single stack holding most of the preserved
+  // marks is restored by all workers then.
+  GrowableArrayCHeap<PreservedMarks::Segment, mtGC> _segments;
+  volatile int _next_segment;
+
+  void restore_segments() {
+    size_t restored = 0;
+    int i;
+    while ((i = Atomic::fetch_and_add(&_next_segment, 1)) < _segments.length()) {
+      const PreservedMarks::Segment& segment = _segments.at(i);
+      segment.restore();
+      restored += segment.size();
+    }
+    if (restored > 0) {
+      Atomic::add(&_total_size, restored);
+    }
+  }
+
 public:
   void work(uint worker_id) override {
+    if (RestorePreservedMarksBySegment) {
+      restore_segments();
+      return;
+    }
     uint task_id = 0;
     while (_sub_tasks.try_claim_task(task_id)) {
       _preserved_marks_set->get(task_id)->restore_and_increment(&_total_size);
@@ -113,16 +145,28 @@ public:
       _preserved_marks_set(preserved_marks_set),
       _sub_tasks(preserved_marks_set->num()),
       _total_size(0)
-      DEBUG_ONLY(COMMA _total_size_before(0)) {
+      DEBUG_ONLY(COMMA _total_size_before(0)),
+      _segments(),
+      _next_segment(0) {
 #ifdef ASSERT
     // This is to make sure the total_size we'll calculate below is correct.
     for (uint i = 0; i < _preserved_marks_set->num(); ++i) {
       _total_size_before += _preserved_marks_set->get(i)->size();
     }
 #endif // ASSERT
+    if (RestorePreservedMarksBySegment) {
+      for (uint i = 0; i < _preserved_marks_set->num(); ++i) {
+        _preserved_marks_set->get(i)->add_segments(&_segments);
+      }
+    }
   }
 
   ~RestorePreservedMarksTask() {
+    if (RestorePreservedMarksBySegment) {
+      for (uint i = 0; i < _preserved_marks_set->num(); ++i) {
+        _preserved_marks_set->get(i)->clear_restored();
+      }
+    }
     assert(_total_size == _total_size_before, "total_size = %zu before = %zu", _total_size, _total_size_before);
 
     log_trace(gc)("Restored %zu marks", _total_size);
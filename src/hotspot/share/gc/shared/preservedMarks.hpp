@@ -28,6 +28,7 @@
 #include "memory/allocation.hpp"
 #include "memory/padded.hpp"
 #include "oops/oop.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/stack.hpp"
 
 class AbstractGangTask;
@@ -55,6 +56,20 @@ private:
   inline bool should_preserve_mark(oop obj, markWord m) const;
 
 public:
+  // The preserved marks in one segment of the stack.
+  class Segment {
+  private:
+    OopAndMarkWord* _base;
+    size_t _size;
+
+  public:
+    Segment() : _base(NULL), _size(0) { }
+    Segment(OopAndMarkWord* base, size_t size) : _base(base), _size(size) { }
+
+    size_t size() const { return _size; }
+    inline void restore() const;
+  };
+
   size_t size() const { return _stack.size(); }
   inline void push(oop obj, markWord m);
   inline void push_if_necessary(oop obj, markWord m);
@@ -66,6 +81,12 @@ public:
   void adjust_during_full_gc();
 
   void restore_and_increment(volatile size_t* const _total_size_addr);
+
+  // Append the segments of the stack to segments, so that they can be
+  // restored by different threads. Once all of them have been restored,
+  // clear_restored() must be called to reclaim the stack segments.
+  void add_segments(GrowableArrayCHeap<Segment, mtGC>* segments);
+  void clear_restored() { _stack.clear(); }
   inline static void init_forwarded_mark(oop obj);
 
   // Assert the stack is empty and has no cached segments.
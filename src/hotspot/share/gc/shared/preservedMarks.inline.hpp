@@ -63,4 +63,10 @@ void PreservedMarks::OopAndMarkWord::set_mark() const {
   _o->set_mark(_m);
 }
 
+void PreservedMarks::Segment::restore() const {
+  for (size_t i = 0; i < _size; i += 1) {
+    _base[i].set_mark();
+  }
+}
+
 #endif // SHARE_GC_SHARED_PRESERVEDMARKS_INLINE_HPP
@@ -27,7 +27,9 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "gc/shared/referencePolicy.hpp"
+#include "logging/log.hpp"
 #include "memory/universe.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
 
 LRUCurrentHeapPolicy::LRUCurrentHeapPolicy() {
@@ -85,3 +87,68 @@ bool LRUMaxHeapPolicy::should_clear_reference(oop p,
 
   return true;
 }
+
+/////////////////////// PressureAdaptive //////////////////////
+
+LRUPressureAdaptivePolicy::LRUPressureAdaptivePolicy() :
+  _max_interval(0), _last_oldest_interval(0), _oldest_interval(0) {
+  setup();
+}
+
+// Capture state (of-the-VM) information needed to evaluate the policy
+void LRUPressureAdaptivePolicy::setup() {
+  size_t used = MIN2(Universe::heap()->used_at_last_gc(), MaxHeapSize);
+  size_t max_heap = (MaxHeapSize - used) / M;
+  jlong max_interval = max_heap * SoftRefLRUPolicyMSPerMB;
+
+  // Only move on once the collections since the last setup have seen
+  // soft references; setup may be called several times per cycle.
+  jlong oldest = Atomic::load(&_oldest_interval);
+  if (oldest > 0) {
+    _last_oldest_interval = oldest;
+    Atomic::store(&_oldest_interval, (jlong)0);
+  }
+
+  // Pressure rises from 0 at IHOP to 1 with a full heap.
+  double occupancy = (double)used / MaxHeapSize;
+  double start = InitiatingHeapOccupancyPercent / 100.0;
+  double pressure = (start < 1.0) ? clamp((occupancy - start) / (1.0 - start), 0.0, 1.0) : 0.0;
+  if (pressure > 0.0 && _last_oldest_interval > 0) {
+    jlong pressure_interval = (jlong)((1.0 - pressure) * _last_oldest_interval);
+    max_interval = MIN2(max_interval, pressure_interval);
+  }
+
+  _max_interval = max_interval;
+  assert(_max_interval >= 0,"Sanity check");
+  log_debug(gc, ref)("SoftReference policy: occupancy %.1f%%, pressure %.2f, oldest " JLONG_FORMAT "ms, "
+                     "clearing older than " JLONG_FORMAT "ms",
+                     occupancy * 100.0, pressure, _last_oldest_interval, _max_interval);
+}
+
+void LRUPressureAdaptivePolicy::record_interval(jlong interval) {
+  jlong oldest = Atomic::load(&_oldest_interval);
+  while (interval > oldest) {
+    jlong prev = Atomic::cmpxchg(&_oldest_interval, oldest, interval);
+    if (prev == oldest) {
+      break;
+    }
+    oldest = prev;
+  }
+}
+
+// The oop passed in is the SoftReference object, and not
+// the object the SoftReference points to.
+bool LRUPressureAdaptivePolicy::should_clear_reference(oop p,
+                                                       jlong timestamp_clock) {
+  jlong interval = timestamp_clock - java_lang_ref_SoftReference::timestamp(p);
+  assert(interval >= 0, "Sanity check");
+
+  record_interval(interval);
+
+  // The interval will be zero if the ref was accessed since the last scavenge/gc.
+  if(interval <= _max_interval) {
+    return false;
+  }
+
+  return true;
+}
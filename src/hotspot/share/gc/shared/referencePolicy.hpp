@@ -80,4 +80,29 @@ class LRUMaxHeapPolicy : public ReferencePolicy {
   virtual bool should_clear_reference(oop p, jlong timestamp_clock);
 };
 
+// Below InitiatingHeapOccupancyPercent this behaves like LRUMaxHeapPolicy.
+// Above it, the oldest part of the age range seen by the previous
+// collection becomes eligible for clearing too, growing linearly with
+// heap occupancy until, with a full heap, every reference not accessed
+// since the previous collection is cleared. That spreads clearing of soft references over
+// several young and mixed collections rather than leaving it all to a
+// full GC.
+class LRUPressureAdaptivePolicy : public ReferencePolicy {
+ private:
+  jlong _max_interval;
+  // Oldest interval observed before the last setup()
+  jlong _last_oldest_interval;
+  // Oldest interval observed since the last setup()
+  volatile jlong _oldest_interval;
+
+  void record_interval(jlong interval);
+
+ public:
+  LRUPressureAdaptivePolicy();
+
+  // Capture state (of-the-VM) information needed to evaluate the policy
+  void setup();
+  virtual bool should_clear_reference(oop p, jlong timestamp_clock);
+};
+
 #endif // SHARE_GC_SHARED_REFERENCEPOLICY_HPP
@@ -60,7 +60,9 @@ void ReferenceProcessor::init_statics() {
   java_lang_ref_SoftReference::set_clock(_soft_ref_timestamp_clock);
 
   _always_clear_soft_ref_policy = new AlwaysClearPolicy();
-  if (CompilerConfig::is_c2_or_jvmci_compiler_enabled()) {
+  if (UsePressureAdaptiveSoftRefPolicy) {
+    _default_soft_ref_policy = new LRUPressureAdaptivePolicy();
+  } else if (CompilerConfig::is_c2_or_jvmci_compiler_enabled()) {
     _default_soft_ref_policy = new LRUMaxHeapPolicy();
   } else {
     _default_soft_ref_policy = new LRUCurrentHeapPolicy();
@@ -1233,6 +1235,25 @@ void ReferenceProcessor::preclean_discovered_references(BoolObjectClosure* is_al
   }
 }
 
+void ReferenceProcessor::preclean_discovered_lists(uint id,
+                                                   BoolObjectClosure* is_alive,
+                                                   OopClosure*        keep_alive,
+                                                   VoidClosure*       complete_gc,
+                                                   YieldClosure*      yield) {
+  assert(id < _max_num_queues, "Id is out of bounds id %u and max id %u", id, _max_num_queues);
+  DiscoveredList* lists[] = { &_discoveredSoftRefs[id],
+                              &_discoveredWeakRefs[id],
+                              &_discoveredFinalRefs[id],
+                              &_discoveredPhantomRefs[id] };
+  for (DiscoveredList* list : lists) {
+    if (yield->should_return() ||
+        preclean_discovered_reflist(*list, is_alive, keep_alive, NULL, yield)) {
+      return;
+    }
+  }
+  complete_gc->do_void();
+}
+
 // Walk the given discovered ref list, and remove all reference objects
 // whose referents are still alive, whose referents are NULL or which
 // are not active (have a non-NULL next field). NOTE: When we are
@@ -1267,7 +1288,9 @@ bool ReferenceProcessor::preclean_discovered_reflist(DiscoveredList&    refs_lis
     }
   }
   // Close the reachable set
-  complete_gc->do_void();
+  if (complete_gc != NULL) {
+    complete_gc->do_void();
+  }
 
   if (iter.processed() > 0) {
     log_develop_trace(gc, ref)(" Dropped " SIZE_FORMAT " Refs out of " SIZE_FORMAT " Refs in discovered list " INTPTR_FORMAT,
@@ -315,6 +315,16 @@ public:
                                       YieldClosure*      yield,
                                       GCTimer*           gc_timer);
 
+  // As above, but only for the discovered lists with the given id, and the
+  // reachable set is closed only once, at the end. Threads may preclean the
+  // lists of different ids concurrently if discovery is MT, and each of
+  // them only precleans the lists of its own worker thread id.
+  void preclean_discovered_lists(uint id,
+                                 BoolObjectClosure* is_alive,
+                                 OopClosure*        keep_alive,
+                                 VoidClosure*       complete_gc,
+                                 YieldClosure*      yield);
+
 private:
   // Returns the name of the discovered reference list
   // occupying the i / _num_queues slot.
@@ -322,7 +332,8 @@ private:
 
   // "Preclean" the given discovered reference list by removing references with
   // the attributes mentioned in preclean_discovered_references().
-  // Supports both normal and fine grain yielding.
+  // Supports both normal and fine grain yielding. Closes the reachable set
+  // with complete_gc, unless it is NULL.
   // Returns whether the operation should be aborted.
   bool preclean_discovered_reflist(DiscoveredList&    refs_list,
                                    BoolObjectClosure* is_alive,
@@ -235,6 +235,23 @@ void SATBMarkQueueSet::enqueue_known_active(SATBMarkQueue& queue, oop obj) {
   }
 }
 
+void SATBMarkQueueSet::enqueue_known_active(SATBMarkQueue& queue, const oop* objs, size_t count) {
+  assert(queue.is_active(), "precondition");
+  size_t i = 0;
+  while (i < count) {
+    if (queue.index() == 0) {
+      handle_zero_index(queue);
+    }
+    size_t index = queue.index();
+    void** buffer = queue.buffer();
+    size_t n = MIN2(index, count - i);
+    for (size_t j = 0; j < n; j++) {
+      buffer[--index] = cast_from_oop<void*>(objs[i++]);
+    }
+    queue.set_index(index);
+  }
+}
+
 void SATBMarkQueueSet::handle_zero_index(SATBMarkQueue& queue) {
   assert(queue.index() == 0, "precondition");
   if (queue.buffer() == nullptr) {
@@ -146,6 +146,9 @@ public:
   }
   // Add obj to queue.  This qset and the queue must be active.
   void enqueue_known_active(SATBMarkQueue& queue, oop obj);
+  // Add count objs to queue, filling its buffer directly.  This qset and
+  // the queue must be active.
+  void enqueue_known_active(SATBMarkQueue& queue, const oop* objs, size_t count);
   virtual void filter(SATBMarkQueue& queue) = 0;
   virtual void enqueue_completed_buffer(BufferNode* node);
 
@@ -706,6 +706,11 @@ class OffsetTableContigSpace: public ContiguousSpace {
   virtual inline HeapWord* allocate(size_t word_size);
   inline HeapWord* par_allocate(size_t word_size);
 
+  // Record a block that was allocated by other means in the offset table.
+  void alloc_block(HeapWord* start, HeapWord* end) {
+    _offsets.alloc_block(start, end);
+  }
+
   // MarkSweep support phase3
   virtual HeapWord* initialize_threshold();
   virtual HeapWord* cross_threshold(HeapWord* start, HeapWord* end);
@@ -40,6 +40,7 @@ double StringDedup::Config::_load_factor_target;
 size_t StringDedup::Config::_minimum_dead_for_cleanup;
 double StringDedup::Config::_dead_factor_for_cleanup;
 uint64_t StringDedup::Config::_hash_seed;
+size_t StringDedup::Config::_batch_size;
 
 size_t StringDedup::Config::initial_table_size() {
   return _initial_table_size;
@@ -58,6 +59,10 @@ uint64_t StringDedup::Config::hash_seed() {
   return _hash_seed;
 }
 
+size_t StringDedup::Config::batch_size() {
+  return _batch_size;
+}
+
 static uint64_t initial_hash_seed() {
   if (StringDeduplicationHashSeed != 0) {
     return StringDeduplicationHashSeed;
@@ -163,4 +168,5 @@ void StringDedup::Config::initialize() {
   _minimum_dead_for_cleanup = StringDeduplicationCleanupDeadMinimum;
   _dead_factor_for_cleanup = percent_of(StringDeduplicationCleanupDeadPercent, 100);
   _hash_seed = initial_hash_seed();
+  _batch_size = StringDeduplicationBatchSize;
 }
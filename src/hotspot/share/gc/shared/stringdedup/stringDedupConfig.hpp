@@ -41,6 +41,7 @@ class StringDedup::Config : AllStatic {
   static size_t _minimum_dead_for_cleanup;
   static double _dead_factor_for_cleanup;
   static uint64_t _hash_seed;
+  static size_t _batch_size;
 
   static const size_t good_sizes[];
   static const size_t min_good_size;
@@ -57,6 +58,7 @@ public:
   static size_t initial_table_size();
   static int age_threshold();
   static uint64_t hash_seed();
+  static size_t batch_size();
 
   static size_t grow_threshold(size_t table_size);
   static size_t shrink_threshold(size_t table_size);
@@ -107,6 +107,7 @@ StringDedup::StorageUse* StringDedup::Processor::storage_for_requests() {
 bool StringDedup::Processor::yield_or_continue(SuspendibleThreadSetJoiner* joiner,
                                                Stat::Phase phase) const {
   if (joiner->should_yield()) {
+    Table::finish_pending();
     _cur_stat.block_phase(phase);
     joiner->yield();
     _cur_stat.unblock_phase();
@@ -151,6 +152,7 @@ public:
   {}
 
   ~ProcessRequest() {
+    Table::finish_pending();
     _storage->release(_bulk_release, _release_index);
   }
 
@@ -171,6 +173,7 @@ public:
       } else {
         Table::deduplicate(java_string);
         if (Table::is_grow_needed()) {
+          Table::finish_pending();
           _cur_stat.report_process_pause();
           _processor->cleanup_table(_joiner, true /* grow_only */, false /* force */);
           _cur_stat.report_process_resume();
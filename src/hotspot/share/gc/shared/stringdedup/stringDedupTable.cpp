@@ -440,6 +440,16 @@ bool StringDedup::Table::Cleaner::step() {
 //////////////////////////////////////////////////////////////////////////////
 // StringDedup::Table
 
+// A deduplication whose string update has been deferred.
+class StringDedup::Table::Pending {
+public:
+  oop _java_string;
+  typeArrayOop _value;
+  typeArrayOop _found;
+  TableValue _tv;
+  bool _deduplicated;
+};
+
 OopStorage* StringDedup::Table::_table_storage;
 StringDedup::Table::Bucket* StringDedup::Table::_buckets;
 size_t StringDedup::Table::_number_of_buckets;
@@ -449,6 +459,8 @@ StringDedup::Table::CleanupState* StringDedup::Table::_cleanup_state = nullptr;
 bool StringDedup::Table::_need_bucket_shrinking = false;
 volatile size_t StringDedup::Table::_dead_count = 0;
 volatile StringDedup::Table::DeadState StringDedup::Table::_dead_state = DeadState::good;
+StringDedup::Table::Pending* StringDedup::Table::_pending = nullptr;
+size_t StringDedup::Table::_pending_count = 0;
 
 void StringDedup::Table::initialize_storage() {
   assert(_table_storage == nullptr, "storage already created");
@@ -461,6 +473,9 @@ void StringDedup::Table::initialize() {
   _number_of_buckets = num_buckets;
   _grow_threshold = Config::grow_threshold(num_buckets);
   _table_storage->register_num_dead_callback(num_dead_callback);
+  if (Config::batch_size() > 1) {
+    _pending = NEW_C_HEAP_ARRAY(Pending, Config::batch_size(), mtStringDedup);
+  }
 }
 
 StringDedup::Table::Bucket*
@@ -624,6 +639,12 @@ bool StringDedup::Table::deduplicate_if_permitted(oop java_string,
                                                   typeArrayOop value) {
   // The non-dedup check and value assignment must be under lock.
   MutexLocker ml(StringDedupIntern_lock, Mutex::_no_safepoint_check_flag);
+  return deduplicate_if_permitted_locked(java_string, value);
+}
+
+bool StringDedup::Table::deduplicate_if_permitted_locked(oop java_string,
+                                                         typeArrayOop value) {
+  assert_lock_strong(StringDedupIntern_lock);
   if (java_lang_String::deduplication_forbidden(java_string)) {
     return false;
   } else {
@@ -632,6 +653,43 @@ bool StringDedup::Table::deduplicate_if_permitted(oop java_string,
   }
 }
 
+void StringDedup::Table::finish_deduplication(bool deduplicated,
+                                              typeArrayOop value,
+                                              typeArrayOop found,
+                                              TableValue tv) {
+  if (deduplicated) {
+    _cur_stat.inc_deduped(found->size() * HeapWordSize);
+  } else {
+    // If string marked deduplication_forbidden then we can't update its
+    // value.  Instead, replace the array in the table with the new one,
+    // as java_string is probably in the StringTable.  That makes it a
+    // good target for future deduplications as it is probably intended
+    // to live for some time.
+    tv.replace(value);
+    _cur_stat.inc_replaced();
+  }
+}
+
+void StringDedup::Table::finish_pending() {
+  if (_pending_count == 0) {
+    return;
+  }
+  {
+    MutexLocker ml(StringDedupIntern_lock, Mutex::_no_safepoint_check_flag);
+    for (size_t i = 0; i < _pending_count; ++i) {
+      Pending& p = _pending[i];
+      p._deduplicated = deduplicate_if_permitted_locked(p._java_string, p._found);
+    }
+  }
+  // Replacing table values is done outside the lock, as it involves GC
+  // barriers.
+  for (size_t i = 0; i < _pending_count; ++i) {
+    const Pending& p = _pending[i];
+    finish_deduplication(p._deduplicated, p._value, p._found, p._tv);
+  }
+  _pending_count = 0;
+}
+
 void StringDedup::Table::deduplicate(oop java_string) {
   assert(java_lang_String::is_instance(java_string), "precondition");
   _cur_stat.inc_inspected();
@@ -651,16 +709,18 @@ void StringDedup::Table::deduplicate(oop java_string) {
     assert(found != nullptr, "invariant");
     // Deduplicate if value array differs from what's in the table.
     if (found != value) {
-      if (deduplicate_if_permitted(java_string, found)) {
-        _cur_stat.inc_deduped(found->size() * HeapWordSize);
+      if (_pending == nullptr) {
+        bool deduplicated = deduplicate_if_permitted(java_string, found);
+        finish_deduplication(deduplicated, value, found, tv);
       } else {
-        // If string marked deduplication_forbidden then we can't update its
-        // value.  Instead, replace the array in the table with the new one,
-        // as java_string is probably in the StringTable.  That makes it a
-        // good target for future deduplications as it is probably intended
-        // to live for some time.
-        tv.replace(value);
-        _cur_stat.inc_replaced();
+        Pending& p = _pending[_pending_count++];
+        p._java_string = java_string;
+        p._value = value;
+        p._found = found;
+        p._tv = tv;
+        if (_pending_count == Config::batch_size()) {
+          finish_pending();
+        }
       }
     }
   }
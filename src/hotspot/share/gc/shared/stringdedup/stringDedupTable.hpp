@@ -62,6 +62,7 @@ class OopStorage;
 class StringDedup::Table : AllStatic {
 private:
   class Bucket;
+  class Pending;
   class CleanupState;
   class Resizer;
   class Cleaner;
@@ -89,6 +90,9 @@ private:
   // read by the dedup thread without holding the lock lock.
   static volatile size_t _dead_count;
   static volatile DeadState _dead_state;
+  // Deduplications deferred by deduplicate, see finish_pending.
+  static Pending* _pending;
+  static size_t _pending_count;
 
   static uint compute_hash(typeArrayOop obj);
   static size_t hash_to_index(uint hash_code);
@@ -96,6 +100,11 @@ private:
   static TableValue find(typeArrayOop obj, uint hash_code);
   static void install(typeArrayOop obj, uint hash_code);
   static bool deduplicate_if_permitted(oop java_string, typeArrayOop value);
+  static bool deduplicate_if_permitted_locked(oop java_string, typeArrayOop value);
+  static void finish_deduplication(bool deduplicated,
+                                   typeArrayOop value,
+                                   typeArrayOop found,
+                                   TableValue tv);
   static bool try_deduplicate_shared(oop java_string);
   static bool try_deduplicate_found_shared(oop java_string, oop found);
   static Bucket* make_buckets(size_t number_of_buckets, size_t reserve = 0);
@@ -117,6 +126,13 @@ public:
   // Otherwise, add the string's data array to the table.
   static void deduplicate(oop java_string);
 
+  // With a StringDeduplicationBatchSize above one, deduplicate defers
+  // updating a string's data array, so that StringDedupIntern_lock is only
+  // taken once per batch.  The deferred updates refer to oops and table
+  // entries directly, so this must be called before yielding to a
+  // safepoint, before cleaning up the table, and once processing ends.
+  static void finish_pending();
+
   // Returns true if table needs to grow.
   static bool is_grow_needed();
 
@@ -34,6 +34,8 @@
 
 TaskTerminator::DelayContext::DelayContext() {
   _yield_count = 0;
+  TASKQUEUE_STATS_ONLY(_spins = 0;)
+  TASKQUEUE_STATS_ONLY(_yields = 0;)
   reset_hard_spin_information();
 }
 
@@ -55,6 +57,7 @@ void TaskTerminator::DelayContext::do_step() {
   // spins.
   if (_hard_spin_count > WorkStealingSpinToYieldRatio) {
     os::naked_yield();
+    TASKQUEUE_STATS_ONLY(_yields++;)
     reset_hard_spin_information();
   } else {
     // Hard spin this time
@@ -62,6 +65,7 @@ void TaskTerminator::DelayContext::do_step() {
       SpinPause();
     }
     _hard_spin_count++;
+    TASKQUEUE_STATS_ONLY(_spins++;)
     // Increase the hard spinning period but only up to a limit.
     _hard_spin_limit = MIN2(2 * _hard_spin_limit,
                             (uint) WorkStealingHardSpins);
@@ -73,11 +77,20 @@ TaskTerminator::TaskTerminator(uint n_threads, TaskQueueSetSuper* queue_set) :
   _queue_set(queue_set),
   _offered_termination(0),
   _blocker(Mutex::leaf, "TaskTerminator", false, Monitor::_safepoint_check_never),
-  _spin_master(NULL) { }
+  _spin_master(NULL)
+#if TASKQUEUE_STATS
+  , _offers(0),
+  _spins(0),
+  _yields(0),
+  _sleeps(0),
+  _timeouts(0)
+#endif
+{ }
 
 TaskTerminator::~TaskTerminator() {
   if (_offered_termination != 0) {
     assert(_offered_termination == _n_threads, "Must be terminated or aborted");
+    TASKQUEUE_STATS_ONLY(print_termination_stats();)
   }
 
   assert(_spin_master == NULL, "Should have been reset");
@@ -94,10 +107,20 @@ void TaskTerminator::reset_for_reuse() {
     assert(_offered_termination == _n_threads,
            "Only %u of %u threads offered termination", _offered_termination, _n_threads);
     assert(_spin_master == NULL, "Leftover spin master " PTR_FORMAT, p2i(_spin_master));
+    TASKQUEUE_STATS_ONLY(print_termination_stats();)
     _offered_termination = 0;
   }
 }
 
+#if TASKQUEUE_STATS
+void TaskTerminator::print_termination_stats() {
+  log_develop_trace(gc, task, stats)("Termination of %u threads: offers " SIZE_FORMAT " spins " SIZE_FORMAT
+                                     " yields " SIZE_FORMAT " sleeps " SIZE_FORMAT " timeouts " SIZE_FORMAT,
+                                     _n_threads, _offers, _spins, _yields, _sleeps, _timeouts);
+  _offers = _spins = _yields = _sleeps = _timeouts = 0;
+}
+#endif
+
 void TaskTerminator::reset_for_reuse(uint n_threads) {
   reset_for_reuse();
   _n_threads = n_threads;
@@ -144,6 +167,11 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
 
   MonitorLocker x(&_blocker, Mutex::_no_safepoint_check_flag);
   _offered_termination++;
+  TASKQUEUE_STATS_ONLY(_offers++;)
+
+  // Waiting threads back off exponentially up to WorkStealingMaxSleepMillis,
+  // the spin master and prepare_for_return() wake them up when tasks appear.
+  uintx sleep_millis = WorkStealingSleepMillis;
 
   if (_offered_termination == _n_threads) {
     prepare_for_return(the_thread);
@@ -167,6 +195,8 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
           tasks = tasks_in_queue_set();
           should_exit_termination = exit_termination(tasks, terminator);
         }
+        TASKQUEUE_STATS_ONLY(_spins += delay_context._spins; delay_context._spins = 0;)
+        TASKQUEUE_STATS_ONLY(_yields += delay_context._yields; delay_context._yields = 0;)
         // Immediately check exit conditions after re-acquiring the lock.
         if (_offered_termination == _n_threads) {
           prepare_for_return(the_thread);
@@ -181,7 +211,8 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
       // Give up spin master before sleeping.
       _spin_master = NULL;
     }
-    bool timed_out = x.wait(WorkStealingSleepMillis);
+    TASKQUEUE_STATS_ONLY(_sleeps++;)
+    bool timed_out = x.wait(sleep_millis);
 
     // Immediately check exit conditions after re-acquiring the lock.
     if (_offered_termination == _n_threads) {
@@ -194,12 +225,14 @@ bool TaskTerminator::offer_termination(TerminatorTerminator* terminator) {
       _offered_termination--;
       return false;
     } else {
+      TASKQUEUE_STATS_ONLY(_timeouts++;)
       size_t tasks = tasks_in_queue_set();
       if (exit_termination(tasks, terminator)) {
         prepare_for_return(the_thread, tasks);
         _offered_termination--;
         return false;
       }
+      sleep_millis = MIN2(sleep_millis * 2, MAX2(WorkStealingMaxSleepMillis, (uintx)WorkStealingSleepMillis));
     }
   }
 }
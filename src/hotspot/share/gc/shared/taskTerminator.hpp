@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_SHARED_TASKTERMINATOR_HPP
 #define SHARE_GC_SHARED_TASKTERMINATOR_HPP
 
+#include "gc/shared/taskqueue.hpp"
 #include "memory/allocation.hpp"
 #include "memory/padded.hpp"
 #include "runtime/mutex.hpp"
@@ -61,6 +62,9 @@ class TaskTerminator : public CHeapObj<mtGC> {
 
     void reset_hard_spin_information();
   public:
+    TASKQUEUE_STATS_ONLY(uint _spins;)
+    TASKQUEUE_STATS_ONLY(uint _yields;)
+
     DelayContext();
 
     // Should the caller sleep (wait) or perform a spin step?
@@ -79,6 +83,17 @@ class TaskTerminator : public CHeapObj<mtGC> {
   Monitor _blocker;
   Thread* _spin_master;
 
+#if TASKQUEUE_STATS
+  // Statistics of the current round, updated with _blocker held.
+  size_t _offers;      // calls to offer_termination
+  size_t _spins;       // hard spin loops of spin masters
+  size_t _yields;      // yields of spin masters
+  size_t _sleeps;      // waits on _blocker
+  size_t _timeouts;    // waits that timed out
+
+  void print_termination_stats();
+#endif
+
   void assert_queue_set_empty() const NOT_DEBUG_RETURN;
 
   // Prepare for return from offer_termination. Gives up the spin master token
@@ -460,6 +460,9 @@ private:
   T** _queues;
 
   bool steal_best_of_2(uint queue_num, E& t);
+  // After a successful steal, moves up to WorkStealingBatchSize - 1 more
+  // tasks from the victim queue to the queue of queue_num.
+  void steal_more(uint queue_num);
 
 public:
   GenericTaskQueueSet(uint n);
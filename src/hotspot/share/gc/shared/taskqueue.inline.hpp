@@ -27,6 +27,7 @@
 
 #include "gc/shared/taskqueue.hpp"
 
+#include "gc/shared/gc_globals.hpp"
 #include "memory/allocation.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
@@ -317,12 +318,40 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
   }
 }
 
+template<class T, MEMFLAGS F> void
+GenericTaskQueueSet<T, F>::steal_more(uint queue_num) {
+  T* const local_queue = _queues[queue_num];
+  uint victim;
+  if (_n == 2) {
+    victim = (queue_num + 1) % 2;
+  } else if (local_queue->is_last_stolen_queue_id_valid()) {
+    victim = local_queue->last_stolen_queue_id();
+  } else {
+    return;
+  }
+  T* const victim_queue = _queues[victim];
+  // Leave at least half of the remaining tasks to the victim, and do not
+  // take more than fits into the local queue.
+  uint n = MIN3((uint)WorkStealingBatchSize - 1,
+                victim_queue->size() / 2,
+                local_queue->max_elems() - local_queue->size());
+  E t;
+  for (; n > 0 && victim_queue->pop_global(t); n--) {
+    bool pushed = local_queue->push(t);
+    assert(pushed, "local queue has room");
+    TASKQUEUE_STATS_ONLY(local_queue->stats.record_steal());
+  }
+}
+
 template<class T, MEMFLAGS F> bool
 GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
   for (uint i = 0; i < 2 * _n; i++) {
     TASKQUEUE_STATS_ONLY(queue(queue_num)->stats.record_steal_attempt());
     if (steal_best_of_2(queue_num, t)) {
       TASKQUEUE_STATS_ONLY(queue(queue_num)->stats.record_steal());
+      if (WorkStealingBatchSize > 1) {
+        steal_more(queue_num);
+      }
       return true;
     }
   }
@@ -27,10 +27,13 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/os.hpp"
 #include "runtime/perfData.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
@@ -55,7 +58,10 @@ ThreadLocalAllocBuffer::ThreadLocalAllocBuffer() :
   _gc_waste(0),
   _slow_allocations(0),
   _allocated_size(0),
-  _allocation_fraction(TLABAllocationWeight) {
+  _allocation_fraction(TLABAllocationWeight),
+  _last_refill_time_ns(0),
+  _allocated_before_last_refill(0),
+  _allocation_rate(TLABAllocationWeight) {
 
   // do nothing. TLABs must be inited by initialize() calls
 }
@@ -83,6 +89,7 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   _allocated_before_last_gc = total_allocated;
 
   print_stats("gc");
+  post_statistics_event();
 
   if (_number_of_refills > 0) {
     // Update allocation history if a reasonable amount of eden was allocated.
@@ -152,8 +159,33 @@ void ThreadLocalAllocBuffer::retire_before_allocation() {
 }
 
 void ThreadLocalAllocBuffer::resize() {
-  // Compute the next tlab size using expected allocation amount
   assert(ResizeTLAB, "Should not call this otherwise");
+  if (TLABElasticSizing && _last_refill_time_ns != 0) {
+    // A thread that has not refilled since the last GC keeps its TLAB
+    // size until the next refill, unless it has been idle for a while.
+    // Then the time since the last refill is sampled as well, so that
+    // idle threads shrink their TLABs and do not hold on to eden.
+    jlong now = os::javaTimeNanos();
+    double idle_ms = (double)(now - _last_refill_time_ns) / NANOSECS_PER_MILLISEC;
+    if (idle_ms > TLABTargetRefillInterval) {
+      size_t total_allocated = thread()->allocated_bytes();
+      _allocation_rate.sample((float)((total_allocated - _allocated_before_last_refill) / idle_ms));
+      _last_refill_time_ns = now;
+      _allocated_before_last_refill = total_allocated;
+    }
+    if (_allocation_rate.count() > 0) {
+      size_t new_size = elastic_desired_size();
+      log_trace(gc, tlab)("TLAB new size: thread: " INTPTR_FORMAT " [id: %2d]"
+                          " rate: %8.1fKB/ms desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT,
+                          p2i(thread()), thread()->osthread()->thread_id(),
+                          _allocation_rate.average() / K, desired_size(), new_size);
+      set_desired_size(new_size);
+      set_refill_waste_limit(initial_refill_waste_limit());
+      return;
+    }
+  }
+
+  // Compute the next tlab size using expected allocation amount
   size_t alloc = (size_t)(_allocation_fraction.average() *
                           (Universe::heap()->tlab_capacity(thread()) / HeapWordSize));
   size_t new_size = alloc / _target_refills;
@@ -171,6 +203,24 @@ void ThreadLocalAllocBuffer::resize() {
   set_refill_waste_limit(initial_refill_waste_limit());
 }
 
+void ThreadLocalAllocBuffer::sample_allocation_rate() {
+  jlong now = os::javaTimeNanos();
+  // The previous TLAB has been retired, so this is exact.
+  size_t total_allocated = thread()->allocated_bytes();
+  if (_last_refill_time_ns != 0 && now > _last_refill_time_ns) {
+    double elapsed_ms = (double)(now - _last_refill_time_ns) / NANOSECS_PER_MILLISEC;
+    _allocation_rate.sample((float)((total_allocated - _allocated_before_last_refill) / elapsed_ms));
+    set_desired_size(elastic_desired_size());
+  }
+  _last_refill_time_ns = now;
+  _allocated_before_last_refill = total_allocated;
+}
+
+size_t ThreadLocalAllocBuffer::elastic_desired_size() const {
+  size_t bytes = (size_t)(_allocation_rate.average() * TLABTargetRefillInterval);
+  return align_object_size(clamp(bytes / HeapWordSize, min_size(), max_size()));
+}
+
 void ThreadLocalAllocBuffer::reset_statistics() {
   _number_of_refills = 0;
   _refill_waste      = 0;
@@ -184,6 +234,9 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
                                   size_t    new_size) {
   _number_of_refills++;
   _allocated_size += new_size;
+  if (TLABElasticSizing && ResizeTLAB) {
+    sample_allocation_rate();
+  }
   print_stats("fill");
   assert(top <= start + new_size - alignment_reserve(), "size too small");
 
@@ -310,6 +363,22 @@ void ThreadLocalAllocBuffer::print_stats(const char* tag) {
             _refill_waste * HeapWordSize);
 }
 
+void ThreadLocalAllocBuffer::post_statistics_event() {
+  EventThreadTLABStatistics event;
+  if (_number_of_refills == 0 || !event.should_commit()) {
+    return;
+  }
+  event.set_thread(JFR_THREAD_ID(thread()));
+  event.set_refills(_number_of_refills);
+  event.set_allocated(_allocated_size * HeapWordSize);
+  event.set_refillWaste(_refill_waste * HeapWordSize);
+  event.set_gcWaste(_gc_waste * HeapWordSize);
+  event.set_slowAllocations(_slow_allocations);
+  event.set_desiredSize(_desired_size * HeapWordSize);
+  event.set_allocationRate(TLABElasticSizing ? (u8)(_allocation_rate.average() * MILLIUNITS) : 0);
+  event.commit();
+}
+
 void ThreadLocalAllocBuffer::set_sample_end(bool reset_byte_accumulation) {
   size_t heap_words_remaining = pointer_delta(_end, _top);
   size_t bytes_until_sample = thread()->heap_sampler().bytes_until_sample();
@@ -70,8 +70,18 @@ private:
 
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
 
+  // TLABElasticSizing
+  jlong     _last_refill_time_ns;                // time of the last refill, zero before the first
+  size_t    _allocated_before_last_refill;       // total bytes allocated up until the last refill
+  AdaptiveWeightedAverage _allocation_rate;      // bytes allocated per millisecond between refills
+
   void reset_statistics();
 
+  // Samples the allocation rate since the last refill and sizes the next
+  // TLAB so that it lasts TLABTargetRefillInterval at that rate.
+  void sample_allocation_rate();
+  size_t elastic_desired_size() const;
+
   void set_start(HeapWord* start)                { _start = start; }
   void set_end(HeapWord* end)                    { _end = end; }
   void set_allocation_end(HeapWord* ptr)         { _allocation_end = ptr; }
@@ -108,6 +118,8 @@ private:
   int gc_waste() const          { return _gc_waste; }
   int slow_allocations() const  { return _slow_allocations; }
 
+  void post_statistics_event();
+
 public:
   ThreadLocalAllocBuffer();
 
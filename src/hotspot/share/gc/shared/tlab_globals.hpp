@@ -85,6 +85,15 @@
           range(0, max_jint)                                                \
           constraint(TLABWasteIncrementConstraintFunc,AfterMemoryInit)      \
                                                                             \
+  product(bool, TLABElasticSizing, false, EXPERIMENTAL,                     \
+          "Size TLABs from the allocation rate of the thread between "      \
+          "refills, aiming at one refill per TLABTargetRefillInterval")     \
+                                                                            \
+  product(uintx, TLABTargetRefillInterval, 10, EXPERIMENTAL,                \
+          "Target time between two TLAB refills of a thread with "          \
+          "TLABElasticSizing (in milliseconds)")                            \
+          range(1, max_juint)                                               \
+                                                                            \
 
 // end of TLAB_FLAGS
 
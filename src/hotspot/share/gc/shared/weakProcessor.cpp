@@ -58,12 +58,20 @@ void notify_jvmti_tagmaps() {
 #endif // INCLUDE_JVMTI
 }
 
-void WeakProcessor::weak_oops_do(BoolObjectClosure* is_alive, OopClosure* keep_alive) {
+void WeakProcessor::weak_oops_do(BoolObjectClosure* is_alive,
+                                 OopClosure* keep_alive,
+                                 BoolObjectClosure* is_young) {
 
   notify_jvmti_tagmaps();
 
   for (OopStorage* storage : OopStorageSet::Range<OopStorageSet::WeakId>()) {
-    if (storage->should_report_num_dead()) {
+    if (is_young != NULL) {
+      CountingClosure<BoolObjectClosure, OopClosure> cl(is_alive, keep_alive);
+      storage->young_oops_do(is_young, &cl);
+      if (storage->should_report_num_dead()) {
+        storage->report_num_dead(cl.dead());
+      }
+    } else if (storage->should_report_num_dead()) {
       CountingClosure<BoolObjectClosure, OopClosure> cl(is_alive, keep_alive);
       storage->oops_do(&cl);
       storage->report_num_dead(cl.dead());
@@ -113,10 +121,11 @@ void WeakProcessor::Task::initialize() {
 
 WeakProcessor::Task::Task(uint nworkers) : Task(nullptr, nworkers) {}
 
-WeakProcessor::Task::Task(WeakProcessorTimes* times, uint nworkers) :
+WeakProcessor::Task::Task(WeakProcessorTimes* times, uint nworkers, BoolObjectClosure* is_young) :
   _times(times),
   _nworkers(nworkers),
-  _storage_states()
+  _storage_states(),
+  _is_young(is_young)
 {
   initialize();
 }
@@ -42,7 +42,14 @@ public:
   // Visit all oop*s and apply the keep_alive closure if the referenced
   // object is considered alive by the is_alive closure, otherwise do some
   // container specific cleanup of element holding the oop.
-  static void weak_oops_do(BoolObjectClosure* is_alive, OopClosure* keep_alive);
+  //
+  // Young collections may pass an is_young closure, which makes them skip
+  // the storage blocks without entries referring to young objects, see
+  // OopStorage::young_oops_do.  The reported dead counts then only cover
+  // the visited blocks.
+  static void weak_oops_do(BoolObjectClosure* is_alive,
+                           OopClosure* keep_alive,
+                           BoolObjectClosure* is_young = NULL);
 
   // Visit all oop*s and apply the given closure.
   static void oops_do(OopClosure* closure);
@@ -56,7 +63,8 @@ public:
   static void weak_oops_do(WorkGang* workers,
                            IsAlive* is_alive,
                            KeepAlive* keep_alive,
-                           WeakProcessorTimes* times);
+                           WeakProcessorTimes* times,
+                           BoolObjectClosure* is_young = NULL);
 
   // Convenience parallel version.  Uses ergo_workers() to determine the
   // number of threads to use, limited by the total workers.  Implicitly
@@ -67,7 +75,8 @@ public:
   static void weak_oops_do(WorkGang* workers,
                            IsAlive* is_alive,
                            KeepAlive* keep_alive,
-                           uint indent_log);
+                           uint indent_log,
+                           BoolObjectClosure* is_young = NULL);
 
   // Uses the total number of weak references and ReferencesPerThread to
   // determine the number of threads to use, limited by max_workers.
@@ -88,12 +97,13 @@ class WeakProcessor::Task {
   WeakProcessorTimes* _times;
   uint _nworkers;
   OopStorageSetWeakParState<false, false> _storage_states;
+  BoolObjectClosure* _is_young;
 
   void initialize();
 
 public:
   Task(uint nworkers);          // No time tracking.
-  Task(WeakProcessorTimes* times, uint nworkers);
+  Task(WeakProcessorTimes* times, uint nworkers, BoolObjectClosure* is_young = NULL);
 
   template<typename IsAlive, typename KeepAlive>
   void work(uint worker_id, IsAlive* is_alive, KeepAlive* keep_alive);
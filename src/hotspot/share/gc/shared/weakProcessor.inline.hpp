@@ -88,7 +88,11 @@ void WeakProcessor::Task::work(uint worker_id,
     WeakProcessorParTimeTracker pt(_times, id, worker_id);
     StorageState* cur_state = _storage_states.par_state(id);
     assert(cur_state->storage() == OopStorageSet::storage(id), "invariant");
-    cur_state->oops_do(&cl);
+    if (_is_young != NULL) {
+      cur_state->young_oops_do(_is_young, &cl);
+    } else {
+      cur_state->oops_do(&cl);
+    }
     cur_state->increment_num_dead(cl.dead());
     if (_times != NULL) {
       _times->record_worker_items(worker_id, id, cl.new_dead(), cl.total());
@@ -115,9 +119,10 @@ public:
            IsAlive* is_alive,
            KeepAlive* keep_alive,
            WeakProcessorTimes* times,
-           uint nworkers) :
+           uint nworkers,
+           BoolObjectClosure* is_young) :
     AbstractGangTask(name),
-    _task(times, nworkers),
+    _task(times, nworkers, is_young),
     _is_alive(is_alive),
     _keep_alive(keep_alive),
     _erased_do_work(&erased_do_work<IsAlive, KeepAlive>)
@@ -131,13 +136,14 @@ template<typename IsAlive, typename KeepAlive>
 void WeakProcessor::weak_oops_do(WorkGang* workers,
                                  IsAlive* is_alive,
                                  KeepAlive* keep_alive,
-                                 WeakProcessorTimes* times) {
+                                 WeakProcessorTimes* times,
+                                 BoolObjectClosure* is_young) {
   WeakProcessorTimeTracker tt(times);
 
   uint nworkers = ergo_workers(MIN2(workers->total_workers(),
                                     times->max_threads()));
 
-  GangTask task("Weak Processor", is_alive, keep_alive, times, nworkers);
+  GangTask task("Weak Processor", is_alive, keep_alive, times, nworkers, is_young);
   workers->run_task(&task, nworkers);
   task.report_num_dead();
 }
@@ -146,10 +152,11 @@ template<typename IsAlive, typename KeepAlive>
 void WeakProcessor::weak_oops_do(WorkGang* workers,
                                  IsAlive* is_alive,
                                  KeepAlive* keep_alive,
-                                 uint indent_log) {
+                                 uint indent_log,
+                                 BoolObjectClosure* is_young) {
   uint nworkers = ergo_workers(workers->total_workers());
   WeakProcessorTimes times(nworkers);
-  weak_oops_do(workers, is_alive, keep_alive, &times);
+  weak_oops_do(workers, is_alive, keep_alive, &times, is_young);
   times.log_subtotals(indent_log); // Caller logs total if desired.
 }
 
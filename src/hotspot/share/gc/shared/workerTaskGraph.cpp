@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/workerTaskGraph.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/spinYield.hpp"
+
+WorkerSubTask::WorkerSubTask() :
+  _is_serial(false),
+  _num_pending_predecessors(0),
+  _state(0),
+  _successors() {
+}
+
+bool WorkerSubTask::is_ready() const {
+  return Atomic::load_acquire(&_num_pending_predecessors) == 0;
+}
+
+bool WorkerSubTask::is_closed() const {
+  return (Atomic::load(&_state) & ClosedBit) != 0;
+}
+
+bool WorkerSubTask::try_enter() {
+  if (_is_serial) {
+    return Atomic::cmpxchg(&_state, 0u, ClosedBit | 1) == 0;
+  }
+  uint state = Atomic::load(&_state);
+  while ((state & ClosedBit) == 0) {
+    uint prev = Atomic::cmpxchg(&_state, state, state + 1);
+    if (prev == state) {
+      return true;
+    }
+    state = prev;
+  }
+  return false;
+}
+
+bool WorkerSubTask::leave() {
+  uint state = Atomic::load(&_state);
+  while (true) {
+    assert((state & ~ClosedBit) > 0, "no worker to leave");
+    uint new_state = (state | ClosedBit) - 1;
+    uint prev = Atomic::cmpxchg(&_state, state, new_state);
+    if (prev == state) {
+      return new_state == ClosedBit;
+    }
+    state = prev;
+  }
+}
+
+WorkerTaskGraph::WorkerTaskGraph(const char* name) :
+  AbstractGangTask(name),
+  _tasks(),
+  _num_incomplete(0) {
+}
+
+void WorkerTaskGraph::add_task(WorkerSubTask* task, bool is_serial) {
+  assert(task != NULL, "must be");
+  assert(!_tasks.contains(task), "added twice");
+  task->_is_serial = is_serial;
+  _tasks.push(task);
+  _num_incomplete++;
+}
+
+void WorkerTaskGraph::add_dependency(WorkerSubTask* predecessor, WorkerSubTask* successor) {
+  assert(_tasks.contains(predecessor) && _tasks.contains(successor), "not in this graph");
+  assert(predecessor != successor, "must be");
+  predecessor->_successors.push(successor);
+  successor->_num_pending_predecessors++;
+}
+
+WorkerSubTask* WorkerTaskGraph::claim_ready_task(bool& all_closed) {
+  all_closed = true;
+  for (WorkerSubTask* task : _tasks) {
+    if (task->is_closed()) {
+      continue;
+    }
+    all_closed = false;
+    if (task->is_ready() && task->try_enter()) {
+      return task;
+    }
+  }
+  return NULL;
+}
+
+void WorkerTaskGraph::complete(WorkerSubTask* task) {
+  for (WorkerSubTask* successor : task->_successors) {
+    Atomic::dec(&successor->_num_pending_predecessors);
+  }
+  Atomic::dec(&_num_incomplete);
+}
+
+void WorkerTaskGraph::run_sub_task(WorkerSubTask* task, uint worker_id) {
+  task->do_work(worker_id);
+}
+
+void WorkerTaskGraph::work(uint worker_id) {
+  SpinYield spin;
+  while (true) {
+    bool all_closed;
+    WorkerSubTask* task = claim_ready_task(all_closed);
+    if (task != NULL) {
+      run_sub_task(task, worker_id);
+      if (task->leave()) {
+        complete(task);
+      }
+    } else if (all_closed) {
+      // Sub tasks still executed by other workers can not be entered any
+      // more, there is nothing left for this worker.
+      return;
+    } else {
+      // Wait for the predecessors of the remaining sub tasks.
+      spin.wait();
+    }
+  }
+}
+
+bool WorkerTaskGraph::is_complete() const {
+  return Atomic::load(&_num_incomplete) == 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_WORKERTASKGRAPH_HPP
+#define SHARE_GC_SHARED_WORKERTASKGRAPH_HPP
+
+#include "gc/shared/workgroup.hpp"
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/growableArray.hpp"
+
+// A WorkerSubTask is a piece of work within a WorkerTaskGraph.
+//
+// A serial sub task is executed by a single worker. A parallel sub task is
+// executed by every worker that picks it up until the first of them returns
+// from do_work(). do_work() of a parallel sub task must therefore only
+// return when all the work of the sub task has been claimed. The sub task
+// is complete when the last worker executing it returns.
+class WorkerSubTask : public CHeapObj<mtGC> {
+  friend class WorkerTaskGraph;
+
+  static const uint ClosedBit = 1u << 31;
+
+  bool _is_serial;
+  // The number of predecessors that are not complete yet.
+  volatile uint _num_pending_predecessors;
+  // ClosedBit, set once no further worker may start the sub task, and the
+  // number of workers executing it.
+  volatile uint _state;
+  GrowableArrayCHeap<WorkerSubTask*, mtGC> _successors;
+
+  bool is_ready() const;
+  bool is_closed() const;
+  bool try_enter();
+  // Returns true if the calling worker was the last to leave.
+  bool leave();
+
+  NONCOPYABLE(WorkerSubTask);
+
+public:
+  WorkerSubTask();
+  virtual ~WorkerSubTask() { }
+
+  bool is_serial() const { return _is_serial; }
+
+  virtual void do_work(uint worker_id) = 0;
+};
+
+// A WorkerTaskGraph runs a set of WorkerSubTasks as a single gang task.
+// A sub task may depend on other sub tasks of the same graph; it is only
+// started after all of them completed. Workers repeatedly pick the first
+// ready sub task in the order the sub tasks were added, so there is no
+// barrier between sub tasks that do not depend on each other. A worker
+// returns when no sub task is left that it could start.
+//
+// The graph does not own its sub tasks.
+class WorkerTaskGraph : public AbstractGangTask {
+  GrowableArrayCHeap<WorkerSubTask*, mtGC> _tasks;
+  volatile uint _num_incomplete;
+
+  // Returns a ready sub task the calling worker entered, or NULL. Sets
+  // all_closed if no sub task may be started any more.
+  WorkerSubTask* claim_ready_task(bool& all_closed);
+  void complete(WorkerSubTask* task);
+
+  NONCOPYABLE(WorkerTaskGraph);
+
+protected:
+  // Executes task on the given worker; subclasses may wrap it, e.g. for timing.
+  virtual void run_sub_task(WorkerSubTask* task, uint worker_id);
+
+public:
+  explicit WorkerTaskGraph(const char* name);
+
+  void add_task(WorkerSubTask* task, bool is_serial);
+  // Makes successor wait for the completion of predecessor. Both must have
+  // been added to this graph.
+  void add_dependency(WorkerSubTask* predecessor, WorkerSubTask* successor);
+
+  void work(uint worker_id) override;
+
+  // Returns true if all sub tasks completed.
+  bool is_complete() const;
+};
+
+#endif // SHARE_GC_SHARED_WORKERTASKGRAPH_HPP
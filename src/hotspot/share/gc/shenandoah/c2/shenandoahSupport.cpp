@@ -411,6 +411,9 @@ void ShenandoahBarrierC2Support::verify(RootNode* root) {
         "vectorizedMismatch",
         { { TypeFunc::Parms, ShenandoahLoad },   { TypeFunc::Parms+1, ShenandoahLoad },   { -1,  ShenandoahNone},
           { -1,  ShenandoahNone},                 { -1,  ShenandoahNone},                 { -1,  ShenandoahNone} },
+        "vectorizedHashCode",
+        { { TypeFunc::Parms, ShenandoahLoad },   { -1,  ShenandoahNone},                  { -1,  ShenandoahNone},
+          { -1,  ShenandoahNone},                 { -1,  ShenandoahNone},                 { -1,  ShenandoahNone} },
         "updateBytesCRC32",
         { { TypeFunc::Parms+1, ShenandoahLoad }, { -1,  ShenandoahNone},                  { -1,  ShenandoahNone},
           { -1,  ShenandoahNone},                 { -1,  ShenandoahNone},                 { -1,  ShenandoahNone} },
@@ -1790,6 +1793,32 @@ void ShenandoahBarrierC2Support::merge_back_to_back_tests(Node* n, PhaseIdealLoo
   }
 }
 
+// The gc state only changes at safepoints, so a heap stable test that is
+// dominated by a projection of another one, with no safepoint in between,
+// has the same outcome. When the dominating test is outside a loop with no
+// safepoint, this removes the test from the loop body altogether.
+bool ShenandoahBarrierC2Support::fold_dominated_heap_stable_test(IfNode* iff, PhaseIdealLoop* phase) {
+  assert(is_heap_stable_test(iff), "only evacuation test");
+  const uint max_depth = 100;
+  Node* prevdom = iff;
+  Node* dom = phase->idom(prevdom);
+  for (uint depth = 0; depth < max_depth && !dom->is_Start(); depth++) {
+    if (dom->is_SafePoint() && !dom->is_CallLeaf()) {
+      return false;
+    }
+    if (dom->is_If() && is_heap_stable_test(dom)) {
+      if (prevdom->in(0) != dom || has_safepoint_between(iff, dom, phase)) {
+        return false;
+      }
+      phase->dominated_by(prevdom, iff, false, true);
+      return true;
+    }
+    prevdom = dom;
+    dom = phase->idom(prevdom);
+  }
+  return false;
+}
+
 IfNode* ShenandoahBarrierC2Support::find_unswitching_candidate(const IdealLoopTree* loop, PhaseIdealLoop* phase) {
   // Find first invariant test that doesn't exit the loop
   LoopNode *head = loop->_head->as_Loop();
@@ -1862,6 +1891,19 @@ void ShenandoahBarrierC2Support::optimize_after_expansion(VectorSet &visited, No
     merge_back_to_back_tests(n, phase);
   }
 
+  if (ShenandoahFoldHeapStableTests && !phase->C->major_progress()) {
+    bool progress = false;
+    for (uint i = 0; i < heap_stable_tests.size(); i++) {
+      Node* n = heap_stable_tests.at(i);
+      if (is_heap_stable_test(n) && fold_dominated_heap_stable_test(n->as_If(), phase)) {
+        progress = true;
+      }
+    }
+    if (progress) {
+      phase->C->set_major_progress();
+    }
+  }
+
   if (!phase->C->major_progress()) {
     VectorSet seen;
     for (uint i = 0; i < heap_stable_tests.size(); i++) {
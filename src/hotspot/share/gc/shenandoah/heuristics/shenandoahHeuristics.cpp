@@ -30,6 +30,7 @@
 #include "gc/shenandoah/shenandoahHeapRegion.inline.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "gc/shenandoah/heuristics/shenandoahHeuristics.hpp"
+#include "gc/shenandoah/mode/shenandoahMode.hpp"
 #include "logging/log.hpp"
 #include "logging/logTag.hpp"
 #include "runtime/globals_extension.hpp"
@@ -94,6 +95,11 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
 
   ShenandoahMarkingContext* const ctx = heap->complete_marking_context();
 
+  // In generational mode, old regions are only considered for evacuation
+  // once they have accumulated enough garbage.
+  const bool generational = heap->mode()->is_generational();
+  const size_t old_garbage_threshold = ShenandoahHeapRegion::region_size_bytes() * ShenandoahOldGarbageThreshold / 100;
+
   for (size_t i = 0; i < num_regions; i++) {
     ShenandoahHeapRegion* region = heap->get_region(i);
 
@@ -109,6 +115,8 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
         immediate_regions++;
         immediate_garbage += garbage;
         region->make_trash_immediate();
+      } else if (generational && region->is_old() && garbage < old_garbage_threshold) {
+        // Old region that is not fragmented enough; leave it in place.
       } else {
         // This is our candidate for later consideration.
         candidates[cand_idx]._region = region;
@@ -152,6 +160,16 @@ void ShenandoahHeuristics::choose_collection_set(ShenandoahCollectionSet* collec
     choose_collection_set_from_regiondata(collection_set, candidates, cand_idx, immediate_garbage + free);
   }
 
+  if (generational) {
+    // Every region that survives this cycle in place gets older.
+    for (size_t i = 0; i < num_regions; i++) {
+      ShenandoahHeapRegion* region = heap->get_region(i);
+      if (region->is_regular() && !collection_set->is_in(region)) {
+        region->increment_age();
+      }
+    }
+  }
+
   size_t cset_percent = (total_garbage == 0) ? 0 : (collection_set->garbage() * 100 / total_garbage);
 
   size_t collectable_garbage = collection_set->garbage() + immediate_garbage;
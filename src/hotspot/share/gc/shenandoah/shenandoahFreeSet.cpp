@@ -30,14 +30,22 @@
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 
 ShenandoahFreeSet::ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions) :
   _heap(heap),
   _mutator_free_bitmap(max_regions, mtGC),
   _collector_free_bitmap(max_regions, mtGC),
-  _max(max_regions)
+  _max(max_regions),
+  _cpu_regions(NULL),
+  _num_cpu_regions(0)
 {
+  if (ShenandoahPerCPUAllocRegions) {
+    _num_cpu_regions = (uint)os::processor_count();
+    _cpu_regions = NEW_C_HEAP_ARRAY(ShenandoahHeapRegion* volatile, _num_cpu_regions, mtGC);
+  }
   clear_internal();
 }
 
@@ -400,6 +408,11 @@ void ShenandoahFreeSet::clear_internal() {
   _collector_rightmost = 0;
   _capacity = 0;
   _used = 0;
+  // Rebuilding the free set re-adds the remaining space of the current
+  // CPU regions to the mutator view.
+  for (uint i = 0; i < _num_cpu_regions; i++) {
+    Atomic::store(&_cpu_regions[i], (ShenandoahHeapRegion*)NULL);
+  }
 }
 
 void ShenandoahFreeSet::rebuild() {
@@ -559,6 +572,87 @@ HeapWord* ShenandoahFreeSet::allocate(ShenandoahAllocRequest& req, bool& in_new_
   }
 }
 
+HeapWord* ShenandoahFreeSet::allocate_in_cpu_region(ShenandoahHeapRegion* r, ShenandoahAllocRequest& req) {
+  size_t min_size = ShenandoahElasticTLAB ? req.min_size() : req.size();
+  size_t actual_size = 0;
+  HeapWord* result = r->allocate_tlab_atomic(min_size, req.size(), &actual_size);
+  if (result != NULL) {
+    req.set_actual_size(actual_size);
+  }
+  return result;
+}
+
+ShenandoahHeapRegion* ShenandoahFreeSet::claim_cpu_region(size_t min_words, bool& in_new_region) {
+  shenandoah_assert_heaplocked();
+
+  for (size_t idx = _mutator_leftmost; idx <= _mutator_rightmost; idx++) {
+    if (!is_mutator_free(idx)) {
+      continue;
+    }
+    ShenandoahHeapRegion* r = _heap->get_region(idx);
+    if (_heap->is_concurrent_weak_root_in_progress() && r->is_trash()) {
+      continue;
+    }
+    try_recycle_trashed(r);
+    if ((r->free() >> LogHeapWordSize) < min_words) {
+      continue;
+    }
+
+    in_new_region = r->is_empty();
+    r->make_regular_allocation();
+
+    // Take the region out of the mutator view, and account all its free
+    // space as used up front, since allocations in it are not tracked.
+    increase_used(r->free());
+    _mutator_free_bitmap.clear_bit(idx);
+    if (touches_bounds(idx)) {
+      adjust_bounds();
+    }
+    assert_bounds();
+    return r;
+  }
+
+  return NULL;
+}
+
+HeapWord* ShenandoahFreeSet::par_allocate_tlab(ShenandoahAllocRequest& req, bool& in_new_region) {
+  assert(ShenandoahPerCPUAllocRegions, "sanity");
+  assert(req.type() == ShenandoahAllocRequest::_alloc_tlab, "only for TLABs");
+
+  const uint cpu = (uint)os::processor_id() % _num_cpu_regions;
+  ShenandoahHeapRegion* r = Atomic::load_acquire(&_cpu_regions[cpu]);
+  if (r != NULL) {
+    HeapWord* result = allocate_in_cpu_region(r, req);
+    if (result != NULL) {
+      return result;
+    }
+  }
+
+  ShenandoahHeapLocker locker(_heap->lock());
+
+  // Another thread might have replaced the region in the meantime.
+  ShenandoahHeapRegion* current = Atomic::load(&_cpu_regions[cpu]);
+  if (current != NULL && current != r) {
+    HeapWord* result = allocate_in_cpu_region(current, req);
+    if (result != NULL) {
+      return result;
+    }
+  }
+
+  size_t min_size = ShenandoahElasticTLAB ? req.min_size() : req.size();
+  ShenandoahHeapRegion* claimed = claim_cpu_region(min_size, in_new_region);
+  Atomic::release_store(&_cpu_regions[cpu], claimed);
+  if (claimed != NULL) {
+    HeapWord* result = allocate_in_cpu_region(claimed, req);
+    if (result != NULL) {
+      return result;
+    }
+  }
+
+  // Fall back to the regular allocation path.
+  return allocate(req, in_new_region);
+}
+
 size_t ShenandoahFreeSet::unsafe_peek_free() const {
   // Deliberately not locked, this method is unsafe when free set is modified.
 
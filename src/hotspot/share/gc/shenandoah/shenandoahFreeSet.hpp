@@ -43,6 +43,12 @@ private:
   size_t _capacity;
   size_t _used;
 
+  // Current TLAB allocation region of each CPU with ShenandoahPerCPUAllocRegions.
+  // Claimed regions are removed from the mutator view, and their free space is
+  // accounted as used when they are claimed.
+  ShenandoahHeapRegion* volatile* _cpu_regions;
+  uint _num_cpu_regions;
+
   void assert_bounds() const NOT_DEBUG_RETURN;
 
   bool is_mutator_free(size_t idx) const;
@@ -66,6 +72,9 @@ private:
 
   void try_recycle_trashed(ShenandoahHeapRegion *r);
 
+  HeapWord* allocate_in_cpu_region(ShenandoahHeapRegion* r, ShenandoahAllocRequest& req);
+  ShenandoahHeapRegion* claim_cpu_region(size_t min_words, bool& in_new_region);
+
   bool can_allocate_from(ShenandoahHeapRegion *r);
   size_t alloc_capacity(ShenandoahHeapRegion *r);
   bool has_no_alloc_capacity(ShenandoahHeapRegion *r);
@@ -88,6 +97,10 @@ public:
   }
 
   HeapWord* allocate(ShenandoahAllocRequest& req, bool& in_new_region);
+
+  // Allocates a TLAB from the current region of this CPU, taking the heap
+  // lock only when a new region has to be claimed.
+  HeapWord* par_allocate_tlab(ShenandoahAllocRequest& req, bool& in_new_region);
   size_t unsafe_peek_free() const;
 
   double internal_fragmentation();
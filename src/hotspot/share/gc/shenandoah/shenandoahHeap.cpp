@@ -64,6 +64,7 @@
 #include "gc/shenandoah/shenandoahVMOperations.hpp"
 #include "gc/shenandoah/shenandoahWorkGroup.hpp"
 #include "gc/shenandoah/shenandoahWorkerPolicy.hpp"
+#include "gc/shenandoah/mode/shenandoahGenerationalMode.hpp"
 #include "gc/shenandoah/mode/shenandoahIUMode.hpp"
 #include "gc/shenandoah/mode/shenandoahPassiveMode.hpp"
 #include "gc/shenandoah/mode/shenandoahSATBMode.hpp"
@@ -412,6 +413,8 @@ void ShenandoahHeap::initialize_mode() {
       _gc_mode = new ShenandoahIUMode();
     } else if (strcmp(ShenandoahGCMode, "passive") == 0) {
       _gc_mode = new ShenandoahPassiveMode();
+    } else if (strcmp(ShenandoahGCMode, "generational") == 0) {
+      _gc_mode = new ShenandoahGenerationalMode();
     } else {
       vm_exit_during_initialization("Unknown -XX:ShenandoahGCMode option");
     }
@@ -775,6 +778,7 @@ HeapWord* ShenandoahHeap::allocate_from_gclab_slow(Thread* thread, size_t size)
   }
 
   assert (size <= actual_size, "allocation should fit");
+  ShenandoahThreadLocalData::add_gclab_allocated(thread, actual_size);
 
   if (ZeroTLAB) {
     // ..and clear it.
@@ -831,7 +835,11 @@ HeapWord* ShenandoahHeap::allocate_memory(ShenandoahAllocRequest& req) {
     }
 
     if (!ShenandoahAllocFailureALot || !should_inject_alloc_failure()) {
-      result = allocate_memory_under_lock(req, in_new_region);
+      if (ShenandoahPerCPUAllocRegions && req.type() == ShenandoahAllocRequest::_alloc_tlab) {
+        result = _free_set->par_allocate_tlab(req, in_new_region);
+      } else {
+        result = allocate_memory_under_lock(req, in_new_region);
+      }
     }
 
     // Allocation failed, block until control thread reacted, then retry allocation.
@@ -1074,8 +1082,21 @@ public:
     PLAB* gclab = ShenandoahThreadLocalData::gclab(thread);
     assert(gclab != NULL, "GCLAB should be initialized for %s", thread->name());
     gclab->retire();
-    if (_resize && ShenandoahThreadLocalData::gclab_size(thread) > 0) {
-      ShenandoahThreadLocalData::set_gclab_size(thread, 0);
+    if (_resize) {
+      if (ShenandoahGCLABTargetRefills > 0) {
+        // Start the next cycle with the GCLAB size that would have allowed
+        // this thread to evacuate what it did in this cycle with the target
+        // number of refills. Threads that evacuated nothing start from the
+        // minimum size again. The slow path doubles the size before the
+        // refill, so record half of it.
+        size_t allocated = ShenandoahThreadLocalData::gclab_allocated(thread);
+        size_t desired = allocated / ShenandoahGCLABTargetRefills;
+        desired = clamp(desired, PLAB::min_size(), PLAB::max_size());
+        ShenandoahThreadLocalData::set_gclab_size(thread, allocated == 0 ? 0 : desired / 2);
+        ShenandoahThreadLocalData::reset_gclab_allocated(thread);
+      } else if (ShenandoahThreadLocalData::gclab_size(thread) > 0) {
+        ShenandoahThreadLocalData::set_gclab_size(thread, 0);
+      }
     }
   }
 };
@@ -244,6 +244,10 @@ private:
   volatile size_t _live_data;
   volatile size_t _critical_pins;
 
+  // Number of GC cycles the objects in this region have survived without
+  // being evacuated. Only maintained in generational mode.
+  uint _age;
+
   HeapWord* volatile _update_watermark;
 
 public:
@@ -336,6 +340,10 @@ public:
   // Allocation (return NULL if full)
   inline HeapWord* allocate(size_t word_size, ShenandoahAllocRequest::Type type);
 
+  // Lock-free TLAB allocation of between min_size and word_size words in a
+  // region that has been claimed for allocation, see ShenandoahFreeSet.
+  inline HeapWord* allocate_tlab_atomic(size_t min_size, size_t word_size, size_t* actual_size);
+
   inline void clear_live_data();
   void set_live_data(size_t s);
 
@@ -351,6 +359,14 @@ public:
 
   inline size_t garbage() const;
 
+  uint age() const               { return _age; }
+  void increment_age()           { if (_age < ShenandoahTenuringThreshold) _age++; }
+  void reset_age()               { _age = 0; }
+
+  // Old regions hold objects that survived at least ShenandoahTenuringThreshold
+  // cycles, and are only collected when they have accumulated enough garbage.
+  bool is_old() const            { return _age >= ShenandoahTenuringThreshold; }
+
   void print_on(outputStream* st) const;
 
   void recycle();
@@ -52,6 +52,29 @@ HeapWord* ShenandoahHeapRegion::allocate(size_t size, ShenandoahAllocRequest::Ty
   }
 }
 
+HeapWord* ShenandoahHeapRegion::allocate_tlab_atomic(size_t min_size, size_t word_size, size_t* actual_size) {
+  assert(is_alloc_allowed() && !is_empty(), "region must be claimed for allocation: " SIZE_FORMAT, index());
+
+  HeapWord* obj = Atomic::load(&_top);
+  while (true) {
+    size_t free = align_down(pointer_delta(end(), obj), MinObjAlignment);
+    size_t size = MIN2(word_size, free);
+    if (size < min_size) {
+      return NULL;
+    }
+
+    HeapWord* const new_top = obj + size;
+    HeapWord* const witness = Atomic::cmpxchg(&_top, obj, new_top);
+    if (witness == obj) {
+      assert(is_object_aligned(obj), "obj is not aligned: " PTR_FORMAT, p2i(obj));
+      Atomic::add(&_tlab_allocs, size, memory_order_relaxed);
+      *actual_size = size;
+      return obj;
+    }
+    obj = witness;
+  }
+}
+
 inline void ShenandoahHeapRegion::adjust_alloc_metadata(ShenandoahAllocRequest::Type type, size_t size) {
   switch (type) {
     case ShenandoahAllocRequest::_alloc_shared:
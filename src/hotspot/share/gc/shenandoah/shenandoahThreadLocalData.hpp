@@ -47,6 +47,8 @@ private:
   SATBMarkQueue           _satb_mark_queue;
   PLAB* _gclab;
   size_t _gclab_size;
+  // Words allocated for GCLABs since the last GCLAB resize
+  size_t _gclab_allocated;
   uint  _worker_id;
   int  _disarmed_value;
   double _paced_time;
@@ -58,6 +60,7 @@ private:
     _satb_mark_queue(&ShenandoahBarrierSet::satb_mark_queue_set()),
     _gclab(NULL),
     _gclab_size(0),
+    _gclab_allocated(0),
     _worker_id(INVALID_WORKER_ID),
     _disarmed_value(0),
     _paced_time(0) {
@@ -132,6 +135,18 @@ public:
     data(thread)->_gclab_size = v;
   }
 
+  static size_t gclab_allocated(Thread* thread) {
+    return data(thread)->_gclab_allocated;
+  }
+
+  static void add_gclab_allocated(Thread* thread, size_t v) {
+    data(thread)->_gclab_allocated += v;
+  }
+
+  static void reset_gclab_allocated(Thread* thread) {
+    data(thread)->_gclab_allocated = 0;
+  }
+
   static void add_paced_time(Thread* thread, double v) {
     data(thread)->_paced_time += v;
   }
@@ -62,7 +62,20 @@
           "barriers are in in use. Possible values are:"                    \
           " satb - snapshot-at-the-beginning concurrent GC (three pass mark-evac-update);"  \
           " iu - incremental-update concurrent GC (three pass mark-evac-update);"  \
-          " passive - stop the world GC only (either degenerated or full)") \
+          " passive - stop the world GC only (either degenerated or full);" \
+          " generational - satb GC that rarely evacuates long-lived "       \
+          "regions (experimental)")                                         \
+                                                                            \
+  product(uintx, ShenandoahTenuringThreshold, 4, EXPERIMENTAL,              \
+          "In generational mode, the number of GC cycles a region must "    \
+          "survive before it is considered old.")                           \
+          range(1, 15)                                                      \
+                                                                            \
+  product(uintx, ShenandoahOldGarbageThreshold, 50, EXPERIMENTAL,           \
+          "In generational mode, how much garbage an old region has to "    \
+          "contain before it can be taken for collection. In percents "     \
+          "of region size.")                                                \
+          range(0,100)                                                      \
                                                                             \
   product(ccstr, ShenandoahGCHeuristics, "adaptive",                        \
           "GC heuristics to use. This fine-tunes the GC mode selected, "    \
@@ -223,6 +236,18 @@
   product(bool, ShenandoahElasticTLAB, true, DIAGNOSTIC,                    \
           "Use Elastic TLABs with Shenandoah")                              \
                                                                             \
+  product(uintx, ShenandoahGCLABTargetRefills, 0, EXPERIMENTAL,             \
+          "Size the first GCLAB of a thread in a GC cycle so that the "     \
+          "amount the thread allocated in GCLABs during the previous "      \
+          "cycle would have needed about this many refills. Fewer "         \
+          "refills mean less contention on the heap lock. Set zero to "     \
+          "always start from the minimum GCLAB size.")                      \
+                                                                            \
+  product(bool, ShenandoahPerCPUAllocRegions, false, EXPERIMENTAL,          \
+          "Refill TLABs from a current region per CPU with atomic bump "    \
+          "pointer allocation. The heap lock is only taken to claim a "     \
+          "new region when the current one is exhausted.")                  \
+                                                                            \
   product(uintx, ShenandoahEvacReserve, 5, EXPERIMENTAL,                    \
           "How much of heap to reserve for evacuations. Larger values make "\
           "GC evacuate more live objects on every cycle, while leaving "    \
@@ -364,6 +389,12 @@
   product(bool, ShenandoahLoopOptsAfterExpansion, true, DIAGNOSTIC,         \
           "Attempt more loop opts after barrier expansion.")                \
                                                                             \
+  product(bool, ShenandoahFoldHeapStableTests, false, EXPERIMENTAL,         \
+          "After barrier expansion, fold heap stable tests that are "       \
+          "dominated by another heap stable test with no safepoint in "     \
+          "between, including tests in safepoint-free loops dominated by "  \
+          "a test before the loop. Needs ShenandoahLoopOptsAfterExpansion") \
+                                                                            \
   product(bool, ShenandoahSelfFixing, true, DIAGNOSTIC,                     \
           "Fix references with load reference barrier. Disabling this "     \
           "might degrade performance.")
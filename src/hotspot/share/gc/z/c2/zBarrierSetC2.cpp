@@ -317,6 +317,84 @@ static uint block_index(const Block* block, const Node* node) {
   return 0;
 }
 
+// Returns true if the node at mem_index in mem_block is executed before the
+// node at load_index in load_block on all paths, without a safepoint in between.
+static bool dominates_without_safepoint(PhaseCFG* cfg,
+                                        Block* mem_block, uint mem_index,
+                                        Block* load_block, uint load_index) {
+  if (load_block == mem_block) {
+    // Earlier accesses in the same block
+    return mem_index < load_index && !block_has_safepoint(mem_block, mem_index + 1, load_index);
+  }
+
+  if (!mem_block->dominates(load_block)) {
+    return false;
+  }
+
+  // Dominating block? Look around for safepoints
+  ResourceMark rm;
+  Block_List stack;
+  VectorSet visited;
+  stack.push(load_block);
+  bool safepoint_found = block_has_safepoint(load_block);
+  while (!safepoint_found && stack.size() > 0) {
+    Block* block = stack.pop();
+    if (visited.test_set(block->_pre_order)) {
+      continue;
+    }
+    if (block_has_safepoint(block)) {
+      safepoint_found = true;
+      break;
+    }
+    if (block == mem_block) {
+      continue;
+    }
+
+    // Push predecessor blocks
+    for (uint p = 1; p < block->num_preds(); ++p) {
+      Block* pred = cfg->get_block_for_node(block->pred(p));
+      stack.push(pred);
+    }
+  }
+
+  return !safepoint_found;
+}
+
+// Returns true if the node is the result of an expanded allocation, i.e. a
+// Phi merging the slow path result with the old TLAB top of the fast path.
+static bool is_allocation(const Node* node) {
+  if (!node->is_Phi() || node->req() != 3) {
+    return false;
+  }
+  const Node* const fast_node = node->in(2);
+  if (fast_node == NULL || !fast_node->is_Mach()) {
+    return false;
+  }
+  const MachNode* const fast_mach = fast_node->as_Mach();
+  if (fast_mach->ideal_Opcode() != Op_LoadP) {
+    return false;
+  }
+  const TypePtr* adr_type = NULL;
+  intptr_t offset = 0;
+  const Node* const base = fast_mach->get_base_and_disp(offset, adr_type);
+  if (base == NULL || base == NodeSentinel || !base->is_Mach() ||
+      base->as_Mach()->ideal_Opcode() != Op_ThreadLocal) {
+    return false;
+  }
+  return offset == in_bytes(Thread::tlab_top_offset());
+}
+
+// Look through the casts and spill copies between an allocation and the base
+// of an access to the allocated object.
+static const Node* look_through_casts(const Node* node) {
+  while (node->is_Mach() &&
+         (node->as_Mach()->ideal_Opcode() == Op_CheckCastPP || node->is_MachSpillCopy()) &&
+         node->in(1) != NULL) {
+    node = node->in(1);
+  }
+  return node;
+}
+
 void ZBarrierSetC2::analyze_dominating_barriers() const {
   ResourceMark rm;
   Compile* const C = Compile::current();
@@ -324,12 +402,17 @@ void ZBarrierSetC2::analyze_dominating_barriers() const {
   Block_List worklist;
   Node_List mem_ops;
   Node_List barrier_loads;
+  Node_List allocations;
 
   // Step 1 - Find accesses, and track them in lists
   for (uint i = 0; i < cfg->number_of_blocks(); ++i) {
     const Block* const block = cfg->get_block(i);
     for (uint j = 0; j < block->number_of_nodes(); ++j) {
-      const Node* const node = block->get_node(j);
+      Node* const node = block->get_node(j);
+      if (ZElideBarriersOnAllocations && is_allocation(node)) {
+        allocations.push(node);
+        continue;
+      }
       if (!node->is_Mach()) {
         continue;
       }
@@ -389,42 +472,30 @@ void ZBarrierSetC2::analyze_dominating_barriers() const {
         continue;
       }
 
-      if (load_block == mem_block) {
-        // Earlier accesses in the same block
-        if (mem_index < load_index && !block_has_safepoint(mem_block, mem_index + 1, load_index)) {
-          load->set_barrier_data(ZLoadBarrierElided);
-        }
-      } else if (mem_block->dominates(load_block)) {
-        // Dominating block? Look around for safepoints
-        ResourceMark rm;
-        Block_List stack;
-        VectorSet visited;
-        stack.push(load_block);
-        bool safepoint_found = block_has_safepoint(load_block);
-        while (!safepoint_found && stack.size() > 0) {
-          Block* block = stack.pop();
-          if (visited.test_set(block->_pre_order)) {
-            continue;
-          }
-          if (block_has_safepoint(block)) {
-            safepoint_found = true;
-            break;
-          }
-          if (block == mem_block) {
-            continue;
-          }
-
-          // Push predecessor blocks
-          for (uint p = 1; p < block->num_preds(); ++p) {
-            Block* pred = cfg->get_block_for_node(block->pred(p));
-            stack.push(pred);
-          }
-        }
+      if (dominates_without_safepoint(cfg, mem_block, mem_index, load_block, load_index)) {
+        load->set_barrier_data(ZLoadBarrierElided);
+      }
+    }
 
-        if (!safepoint_found) {
-          load->set_barrier_data(ZLoadBarrierElided);
-        }
+    // Fields of an object allocated without a safepoint before the load can
+    // only contain null or oops stored since the allocation, which are good.
+    if (load->barrier_data() == ZLoadBarrierElided ||
+        allocations.size() == 0 ||
+        load_obj == NULL || load_obj == NodeSentinel || load_offset < 0) {
+      continue;
+    }
+    const Node* const load_base = look_through_casts(load_obj);
+    for (uint j = 0; j < allocations.size(); j++) {
+      Node* const alloc = allocations.at(j);
+      if (alloc != load_base) {
+        continue;
+      }
+      Block* const alloc_block = cfg->get_block_for_node(alloc);
+      const uint alloc_index = block_index(alloc_block, alloc);
+      if (dominates_without_safepoint(cfg, alloc_block, alloc_index, load_block, load_index)) {
+        load->set_barrier_data(ZLoadBarrierElided);
       }
+      break;
     }
   }
 }
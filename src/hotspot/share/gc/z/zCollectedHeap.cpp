@@ -30,6 +30,7 @@
 #include "gc/z/zDriver.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zMarkHistogram.hpp"
 #include "gc/z/zNMethod.hpp"
 #include "gc/z/zObjArrayAllocator.hpp"
 #include "gc/z/zOop.inline.hpp"
@@ -251,6 +252,31 @@ void ZCollectedHeap::keep_alive(oop obj) {
   _heap.keep_alive(obj);
 }
 
+bool ZCollectedHeap::print_concurrent_class_histogram(outputStream* st) {
+  if (!ZConcurrentClassHistogram) {
+    return false;
+  }
+
+  ZMarkHistogram histogram(st);
+  if (!histogram.is_initialized() || !_heap.request_mark_histogram(&histogram)) {
+    // Out of memory or another histogram is pending,
+    // fall back to a heap inspection in a safepoint
+    return false;
+  }
+
+  // Start a synchronous GC, which prints the histogram
+  // once marking and class unloading have completed
+  collect(GCCause::_heap_inspection);
+
+  if (!histogram.is_printed()) {
+    // The GC cycle was aborted, the VM is shutting down
+    _heap.cancel_mark_histogram(&histogram);
+    st->print_cr("ERROR: GC cycle aborted; histogram not generated");
+  }
+
+  return true;
+}
+
 void ZCollectedHeap::register_nmethod(nmethod* nm) {
   ZNMethod::register_nmethod(nm);
 }
@@ -98,6 +98,7 @@ public:
   virtual ParallelObjectIterator* parallel_object_iterator(uint nworkers);
 
   virtual void keep_alive(oop obj);
+  virtual bool print_concurrent_class_histogram(outputStream* st);
 
   virtual void register_nmethod(nmethod* nm);
   virtual void unregister_nmethod(nmethod* nm);
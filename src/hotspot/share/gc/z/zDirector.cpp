@@ -131,6 +131,44 @@ bool ZDirector::rule_allocation_rate() const {
   return time_until_gc <= 0;
 }
 
+bool ZDirector::rule_allocation_rate_trend() const {
+  if (!ZAllocationRateTrend || !ZStatCycle::is_normalized_duration_trustable()) {
+    // Rule disabled
+    return false;
+  }
+
+  // Perform GC if the short term trend of the allocation rate indicates that
+  // we will run out of memory. The moving average used by the allocation rate
+  // rule lags behind sudden allocation bursts, so this rule instead uses the
+  // allocation rate predicted by a linear regression over the samples in the
+  // last sample window, or the moving average if that is higher, plus ~3.3 sigma
+  // of the variance of the individual samples.
+
+  // Calculate amount of free memory available. Note that we take the
+  // relocation headroom into account to avoid in-place relocation.
+  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
+  const size_t used = ZHeap::heap()->used();
+  const size_t free_including_headroom = soft_max_capacity - MIN2(soft_max_capacity, used);
+  const size_t free = free_including_headroom - MIN2(free_including_headroom, _relocation_headroom);
+
+  const double predicted_alloc_rate = MAX2(ZStatAllocRate::predict(), ZStatAllocRate::avg());
+  const double max_alloc_rate = predicted_alloc_rate + (ZStatAllocRate::sd() * one_in_1000);
+  const double time_until_oom = free / (max_alloc_rate + 1.0); // Plus 1.0B/s to avoid division by zero
+
+  // Calculate max duration of a GC cycle. The duration of GC is a moving
+  // average, we add ~3.3 sigma to account for the GC duration variance.
+  const AbsSeq& duration_of_gc = ZStatCycle::normalized_duration();
+  const double max_duration_of_gc = duration_of_gc.davg() + (duration_of_gc.dsd() * one_in_1000);
+
+  const double sample_interval = 1.0 / ZStatAllocRate::sample_hz;
+  const double time_until_gc = time_until_oom - max_duration_of_gc - sample_interval;
+
+  log_debug(gc, director)("Rule: Allocation Rate Trend, MaxAllocRate: %.3fMB/s, Free: " SIZE_FORMAT "MB, MaxDurationOfGC: %.3fs, TimeUntilGC: %.3fs",
+                          max_alloc_rate / M, free / M, max_duration_of_gc, time_until_gc);
+
+  return time_until_gc <= 0;
+}
+
 bool ZDirector::rule_proactive() const {
   if (!ZProactive || !ZStatCycle::is_warm()) {
     // Rule disabled
@@ -206,7 +244,7 @@ GCCause::Cause ZDirector::make_gc_decision() const {
   }
 
   // Rule 2: Allocation rate
-  if (rule_allocation_rate()) {
+  if (rule_allocation_rate() || rule_allocation_rate_trend()) {
     return GCCause::_z_allocation_rate;
   }
 
@@ -252,6 +252,7 @@ void ZDriver::collect(GCCause::Cause cause) {
   case GCCause::_scavenge_alot:
   case GCCause::_jvmti_force_gc:
   case GCCause::_metadata_GC_clear_soft_refs:
+  case GCCause::_heap_inspection:
     // Start synchronous GC
     _gc_cycle_port.send_sync(cause);
     break;
@@ -44,6 +44,7 @@ private:
 
   const ZVirtualMemory   _virtual;
   const size_t           _object_alignment_shift;
+  const uint8_t          _page_age;
   const AttachedArray    _entries;
   ZPage*                 _page;
   mutable ZConditionLock _ref_lock;
@@ -63,6 +64,8 @@ public:
   static ZForwarding* alloc(ZForwardingAllocator* allocator, ZPage* page);
 
   uint8_t type() const;
+  uint8_t page_age() const;
+  uint32_t numa_id() const;
   uintptr_t start() const;
   size_t size() const;
   size_t object_alignment_shift() const;
@@ -44,6 +44,14 @@ inline uint32_t ZForwarding::nentries(const ZPage* page) {
   // inexpensive indexing/masking. The table is also sized to have a load
   // factor of 50%, i.e. sized to have double the number of entries actually
   // inserted, to allow for good lookup/insert performance.
+  //
+  // With ZCompactForwardingTables the table is instead sized to have a load
+  // factor of at most 75%, trading some probing for less memory. The table
+  // always has at least one empty entry, which terminates the probing.
+  if (ZCompactForwardingTables) {
+    const uint32_t live_objects = page->live_objects();
+    return round_up_power_of_2(live_objects + live_objects / 3 + 1);
+  }
   return round_up_power_of_2(page->live_objects() * 2);
 }
 
@@ -56,6 +64,7 @@ inline ZForwarding* ZForwarding::alloc(ZForwardingAllocator* allocator, ZPage* p
 inline ZForwarding::ZForwarding(ZPage* page, size_t nentries) :
     _virtual(page->virtual_memory()),
     _object_alignment_shift(page->object_alignment_shift()),
+    _page_age(page->age()),
     _entries(nentries),
     _page(page),
     _ref_lock(),
@@ -67,6 +76,14 @@ inline uint8_t ZForwarding::type() const {
   return _page->type();
 }
 
+inline uint8_t ZForwarding::page_age() const {
+  return _page_age;
+}
+
+inline uint32_t ZForwarding::numa_id() const {
+  return _page->numa_id();
+}
+
 inline uintptr_t ZForwarding::start() const {
   return _virtual.start();
 }
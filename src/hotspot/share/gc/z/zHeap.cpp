@@ -250,6 +250,14 @@ void ZHeap::mark(bool initial) {
   _mark.mark(initial);
 }
 
+bool ZHeap::request_mark_histogram(ZMarkHistogram* histogram) {
+  return _mark.request_histogram(histogram);
+}
+
+void ZHeap::cancel_mark_histogram(ZMarkHistogram* histogram) {
+  _mark.cancel_histogram(histogram);
+}
+
 void ZHeap::mark_flush_and_free(Thread* thread) {
   _mark.flush_and_free(thread);
 }
@@ -331,6 +339,11 @@ void ZHeap::process_non_strong_references() {
   // Purge stale metadata and nmethods that were unlinked
   _unload.purge();
 
+  // Print any class histogram collected while marking. All classes
+  // still around have live instances, so none of them can be unloaded
+  // in this cycle.
+  _mark.print_histogram();
+
   // Enqueue Soft/Weak/Final/PhantomReferences. Note that this
   // must be done after unblocking resurrection. Otherwise the
   // Finalizer thread could call Reference.get() on the Finalizers
@@ -364,6 +377,9 @@ void ZHeap::select_relocation_set() {
     }
 
     if (page->is_marked()) {
+      // The live objects on this page survived another cycle
+      page->inc_age();
+
       // Register live page
       selector.register_live_page(page);
     } else {
@@ -40,6 +40,7 @@
 #include "gc/z/zWorkers.hpp"
 
 class ThreadClosure;
+class ZMarkHistogram;
 class ZPage;
 class ZRelocationSetSelector;
 
@@ -129,6 +130,8 @@ public:
   bool mark_end();
   void mark_free();
   void keep_alive(oop obj);
+  bool request_mark_histogram(ZMarkHistogram* histogram);
+  void cancel_mark_histogram(ZMarkHistogram* histogram);
 
   // Relocation set
   void select_relocation_set();
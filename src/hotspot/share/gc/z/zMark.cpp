@@ -32,6 +32,7 @@
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zMark.inline.hpp"
 #include "gc/z/zMarkCache.inline.hpp"
+#include "gc/z/zMarkHistogram.hpp"
 #include "gc/z/zMarkStack.inline.hpp"
 #include "gc/z/zMarkTerminate.inline.hpp"
 #include "gc/z/zNMethod.hpp"
@@ -80,7 +81,9 @@ ZMark::ZMark(ZWorkers* workers, ZPageTable* page_table) :
     _nterminateflush(0),
     _ntrycomplete(0),
     _ncontinue(0),
-    _nworkers(0) {}
+    _nworkers(0),
+    _requested_histogram(NULL),
+    _histogram(NULL) {}
 
 bool ZMark::is_initialized() const {
   return _allocator.is_initialized();
@@ -113,6 +116,9 @@ void ZMark::start() {
   // Set number of workers to use
   _nworkers = _workers->nconcurrent();
 
+  // Pick up any class histogram to collect during this mark
+  _histogram = Atomic::xchg(&_requested_histogram, (ZMarkHistogram*)NULL);
+
   // Set number of mark stripes to use, based on number
   // of workers we will use in the concurrent mark phase.
   const size_t nstripes = calculate_nstripes(_nworkers);
@@ -311,6 +317,7 @@ void ZMark::mark_and_follow(ZMarkCache* cache, ZMarkStackEntry entry) {
     const size_t size = ZUtils::object_size(addr);
     const size_t aligned_size = align_up(size, page->object_alignment());
     cache->inc_live(page, aligned_size);
+    cache->inc_histogram(ZOop::from_address(addr));
   }
 
   // Follow
@@ -581,14 +588,28 @@ void ZMark::work_with_timeout(ZMarkCache* cache, ZMarkStripe* stripe, ZMarkThrea
 }
 
 void ZMark::work(uint64_t timeout_in_micros) {
-  ZMarkCache cache(_stripes.nstripes());
+  if (_histogram != NULL) {
+    // Record marked objects in a worker local table, which
+    // is merged into the shared histogram when done
+    KlassInfoTable table(false /* add_all_classes */);
+    KlassInfoTable* const histogram = table.allocation_failed() ? NULL : &table;
+    ZMarkCache cache(_stripes.nstripes(), histogram);
+    work(&cache, timeout_in_micros);
+    _histogram->merge(histogram, cache.histogram_missed());
+  } else {
+    ZMarkCache cache(_stripes.nstripes());
+    work(&cache, timeout_in_micros);
+  }
+}
+
+void ZMark::work(ZMarkCache* cache, uint64_t timeout_in_micros) {
   ZMarkStripe* const stripe = _stripes.stripe_for_worker(_nworkers, ZThread::worker_id());
   ZMarkThreadLocalStacks* const stacks = ZThreadLocalData::stacks(Thread::current());
 
   if (timeout_in_micros == 0) {
-    work_without_timeout(&cache, stripe, stacks);
+    work_without_timeout(cache, stripe, stacks);
   } else {
-    work_with_timeout(&cache, stripe, stacks, timeout_in_micros);
+    work_with_timeout(cache, stripe, stacks, timeout_in_micros);
   }
 
   // Flush and publish stacks
@@ -768,6 +789,23 @@ bool ZMark::end() {
   return true;
 }
 
+bool ZMark::request_histogram(ZMarkHistogram* histogram) {
+  // Only one histogram can be pending at a time
+  return Atomic::cmpxchg(&_requested_histogram, (ZMarkHistogram*)NULL, histogram) == NULL;
+}
+
+void ZMark::cancel_histogram(ZMarkHistogram* histogram) {
+  // Withdraw the request if no mark has picked it up
+  Atomic::cmpxchg(&_requested_histogram, histogram, (ZMarkHistogram*)NULL);
+}
+
+void ZMark::print_histogram() {
+  if (_histogram != NULL) {
+    _histogram->print();
+    _histogram = NULL;
+  }
+}
+
 void ZMark::free() {
   // Free any unused mark stack space
   _allocator.free();
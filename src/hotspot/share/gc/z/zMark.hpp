@@ -33,6 +33,7 @@
 
 class Thread;
 class ZMarkCache;
+class ZMarkHistogram;
 class ZPageTable;
 class ZWorkers;
 
@@ -53,6 +54,8 @@ private:
   size_t              _ntrycomplete;
   size_t              _ncontinue;
   uint                _nworkers;
+  ZMarkHistogram* volatile _requested_histogram;
+  ZMarkHistogram*     _histogram;
 
   size_t calculate_nstripes(uint nworkers) const;
 
@@ -91,6 +94,7 @@ private:
                          ZMarkStripe* stripe,
                          ZMarkThreadLocalStacks* stacks,
                          uint64_t timeout_in_micros);
+  void work(ZMarkCache* cache, uint64_t timeout_in_micros);
   void work(uint64_t timeout_in_micros);
 
   void verify_all_stacks_empty() const;
@@ -109,6 +113,10 @@ public:
 
   void flush_and_free();
   bool flush_and_free(Thread* thread);
+
+  bool request_histogram(ZMarkHistogram* histogram);
+  void cancel_histogram(ZMarkHistogram* histogram);
+  void print_histogram();
 };
 
 #endif // SHARE_GC_Z_ZMARK_HPP
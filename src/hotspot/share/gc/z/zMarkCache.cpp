@@ -31,8 +31,14 @@ ZMarkCacheEntry::ZMarkCacheEntry() :
     _objects(0),
     _bytes(0) {}
 
-ZMarkCache::ZMarkCache(size_t nstripes) :
-    _shift(ZMarkStripeShift + exact_log2(nstripes)) {}
+ZMarkCache::ZMarkCache(size_t nstripes, KlassInfoTable* histogram) :
+    _shift(ZMarkStripeShift + exact_log2(nstripes)),
+    _histogram(histogram),
+    _histogram_missed(0) {}
+
+size_t ZMarkCache::histogram_missed() const {
+  return _histogram_missed;
+}
 
 ZMarkCache::~ZMarkCache() {
   // Evict all entries
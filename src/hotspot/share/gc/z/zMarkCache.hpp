@@ -26,7 +26,9 @@
 
 #include "gc/z/zGlobals.hpp"
 #include "memory/allocation.hpp"
+#include "oops/oopsHierarchy.hpp"
 
+class KlassInfoTable;
 class ZPage;
 
 class ZMarkCacheEntry {
@@ -44,14 +46,18 @@ public:
 
 class ZMarkCache : public StackObj {
 private:
-  const size_t    _shift;
-  ZMarkCacheEntry _cache[ZMarkCacheSize];
+  const size_t          _shift;
+  ZMarkCacheEntry       _cache[ZMarkCacheSize];
+  KlassInfoTable* const _histogram;
+  size_t                _histogram_missed;
 
 public:
-  ZMarkCache(size_t nstripes);
+  ZMarkCache(size_t nstripes, KlassInfoTable* histogram = NULL);
   ~ZMarkCache();
 
   void inc_live(ZPage* page, size_t bytes);
+  void inc_histogram(oop obj);
+  size_t histogram_missed() const;
 };
 
 #endif // SHARE_GC_Z_ZMARKCACHE_HPP
@@ -27,6 +27,7 @@
 #include "gc/z/zMarkCache.hpp"
 
 #include "gc/z/zPage.inline.hpp"
+#include "memory/heapInspection.hpp"
 
 inline void ZMarkCacheEntry::inc_live(ZPage* page, size_t bytes) {
   if (_page == page) {
@@ -56,4 +57,10 @@ inline void ZMarkCache::inc_live(ZPage* page, size_t bytes) {
   _cache[index].inc_live(page, bytes);
 }
 
+inline void ZMarkCache::inc_histogram(oop obj) {
+  if (_histogram != NULL && !_histogram->record_instance(obj)) {
+    _histogram_missed++;
+  }
+}
+
 #endif // SHARE_GC_Z_ZMARKCACHE_INLINE_HPP
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/z/zLock.inline.hpp"
+#include "gc/z/zMarkHistogram.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/ostream.hpp"
+
+ZMarkHistogram::ZMarkHistogram(outputStream* out) :
+    _out(out),
+    _table(false /* add_all_classes */),
+    _lock(),
+    _missed(0),
+    _failed(false),
+    _printed(false) {}
+
+bool ZMarkHistogram::is_initialized() {
+  return !_table.allocation_failed();
+}
+
+bool ZMarkHistogram::is_printed() const {
+  return Atomic::load_acquire(&_printed);
+}
+
+void ZMarkHistogram::merge(KlassInfoTable* table, size_t missed) {
+  ZLocker<ZLock> locker(&_lock);
+
+  if (table == NULL || !_table.merge(table)) {
+    // Worker table could not be allocated or merged
+    _failed = true;
+  }
+  _missed += missed;
+}
+
+void ZMarkHistogram::print() {
+  ResourceMark rm;
+
+  if (_failed) {
+    _out->print_cr("WARNING: Ran out of C-heap; undercounted instances in data below");
+  } else if (_missed != 0) {
+    _out->print_cr("WARNING: Ran out of C-heap; undercounted " SIZE_FORMAT
+                   " total instances in data below", _missed);
+  }
+  HeapInspection::print_histogram(&_table, _out);
+  _out->flush();
+
+  Atomic::release_store(&_printed, true);
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#ifndef SHARE_GC_Z_ZMARKHISTOGRAM_HPP
+#define SHARE_GC_Z_ZMARKHISTOGRAM_HPP
+
+#include "gc/z/zLock.hpp"
+#include "memory/allocation.hpp"
+#include "memory/heapInspection.hpp"
+
+class outputStream;
+
+// A class histogram of the live objects found by a GC cycle. Each mark
+// worker records the objects it marks in a local table, which is merged
+// into this one when the worker is done. The histogram is printed by the
+// GC driver once stale classes have been unloaded, so all recorded
+// classes are still alive.
+class ZMarkHistogram : public StackObj {
+private:
+  outputStream* const _out;
+  KlassInfoTable      _table;
+  ZLock               _lock;
+  size_t              _missed;
+  bool                _failed;
+  volatile bool       _printed;
+
+public:
+  ZMarkHistogram(outputStream* out);
+
+  bool is_initialized();
+  bool is_printed() const;
+
+  void merge(KlassInfoTable* table, size_t missed);
+  void print();
+};
+
+#endif // SHARE_GC_Z_ZMARKHISTOGRAM_HPP
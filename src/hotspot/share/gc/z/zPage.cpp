@@ -35,6 +35,7 @@ ZPage::ZPage(const ZVirtualMemory& vmem, const ZPhysicalMemory& pmem) :
 ZPage::ZPage(uint8_t type, const ZVirtualMemory& vmem, const ZPhysicalMemory& pmem) :
     _type(type),
     _numa_id((uint8_t)-1),
+    _age(0),
     _seqnum(0),
     _virtual(vmem),
     _top(start()),
@@ -59,6 +60,7 @@ void ZPage::assert_initialized() const {
 
 void ZPage::reset() {
   _seqnum = ZGlobalSeqNum;
+  _age = 0;
   _top = start();
   _livemap.reset();
   _last_used = 0;
@@ -119,8 +121,8 @@ ZPage* ZPage::split_committed() {
 }
 
 void ZPage::print_on(outputStream* out) const {
-  out->print_cr(" %-6s  " PTR_FORMAT " " PTR_FORMAT " " PTR_FORMAT " %s%s",
-                type_to_string(), start(), top(), end(),
+  out->print_cr(" %-6s  " PTR_FORMAT " " PTR_FORMAT " " PTR_FORMAT " Age %u%s%s",
+                type_to_string(), start(), top(), end(), _age,
                 is_allocating()  ? " Allocating"  : "",
                 is_relocatable() ? " Relocatable" : "");
 }
@@ -37,6 +37,7 @@ class ZPage : public CHeapObj<mtGC> {
 private:
   uint8_t            _type;
   uint8_t            _numa_id;
+  uint8_t            _age;
   uint32_t           _seqnum;
   ZVirtualMemory     _virtual;
   volatile uintptr_t _top;
@@ -75,6 +76,11 @@ public:
 
   uint8_t numa_id();
 
+  uint8_t age() const;
+  void set_age(uint8_t age);
+  void inc_age();
+  bool is_old() const;
+
   bool is_allocating() const;
   bool is_relocatable() const;
 
@@ -26,6 +26,7 @@
 
 #include "gc/z/zPage.hpp"
 
+#include "gc/shared/gc_globals.hpp"
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zLiveMap.inline.hpp"
@@ -161,6 +162,26 @@ inline void ZPage::set_last_used() {
   _last_used = ceil(os::elapsedTime());
 }
 
+inline uint8_t ZPage::age() const {
+  return _age;
+}
+
+inline void ZPage::set_age(uint8_t age) {
+  assert(age <= ZPageAgeMax, "Invalid age");
+  _age = age;
+}
+
+inline void ZPage::inc_age() {
+  if (_age < ZPageAgeMax) {
+    _age++;
+  }
+}
+
+inline bool ZPage::is_old() const {
+  // Page aging is disabled when the tenuring threshold is zero
+  return ZTenuringThreshold > 0 && _age >= ZTenuringThreshold;
+}
+
 inline bool ZPage::is_in(uintptr_t addr) const {
   const uintptr_t offset = ZAddress::offset(addr);
   return offset >= start() && offset < top();
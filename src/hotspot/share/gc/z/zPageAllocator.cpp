@@ -132,7 +132,7 @@ ZPageAllocator::ZPageAllocator(ZWorkers* workers,
                                size_t initial_capacity,
                                size_t max_capacity) :
     _lock(),
-    _cache(),
+    _cache(&_safe_delete),
     _virtual(max_capacity),
     _physical(max_capacity),
     _min_capacity(min_capacity),
@@ -752,12 +752,33 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
     Atomic::add(&_claimed, flushed);
   }
 
-  // Unmap, uncommit, and destroy flushed pages
-  ZListRemoveIterator<ZPage> iter(&pages);
-  for (ZPage* page; iter.next(&page);) {
-    unmap_page(page);
-    uncommit_page(page);
-    destroy_page(page);
+  if (ZUncommitCoalesce && ZUncommit) {
+    // Unmap flushed pages and collect their physical memory, merging
+    // adjacent segments, so that each contiguous range is uncommitted
+    // at once instead of page by page.
+    ZPhysicalMemory pmem;
+    ZListIterator<ZPage> iter(&pages);
+    for (ZPage* page; iter.next(&page);) {
+      unmap_page(page);
+      pmem.add_segments(page->physical_memory());
+    }
+
+    // Uncommit physical memory
+    _physical.uncommit(pmem);
+
+    // Destroy flushed pages
+    ZListRemoveIterator<ZPage> remove_iter(&pages);
+    for (ZPage* page; remove_iter.next(&page);) {
+      destroy_page(page);
+    }
+  } else {
+    // Unmap, uncommit, and destroy flushed pages
+    ZListRemoveIterator<ZPage> iter(&pages);
+    for (ZPage* page; iter.next(&page);) {
+      unmap_page(page);
+      uncommit_page(page);
+      destroy_page(page);
+    }
   }
 
   {
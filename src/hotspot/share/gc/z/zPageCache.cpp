@@ -22,11 +22,13 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/z/zArray.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zList.inline.hpp"
 #include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageCache.hpp"
+#include "gc/z/zSafeDelete.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zValue.inline.hpp"
 #include "memory/allocation.hpp"
@@ -54,11 +56,12 @@ ZPageCacheFlushClosure::ZPageCacheFlushClosure(size_t requested) :
     _requested(requested),
     _flushed(0) {}
 
-ZPageCache::ZPageCache() :
+ZPageCache::ZPageCache(ZSafeDelete<ZPage>* safe_delete) :
     _small(),
     _medium(),
     _large(),
-    _last_commit(0) {}
+    _last_commit(0),
+    _safe_delete(safe_delete) {}
 
 ZPage* ZPageCache::alloc_small_page() {
   const uint32_t numa_id = ZNUMA::id();
@@ -151,6 +154,85 @@ ZPage* ZPageCache::alloc_oversized_page(size_t size) {
   return page;
 }
 
+void ZPageCache::remove_page(ZPage* page) {
+  const uint8_t type = page->type();
+  if (type == ZPageTypeSmall) {
+    _small.get(page->numa_id()).remove(page);
+  } else if (type == ZPageTypeMedium) {
+    _medium.remove(page);
+  } else {
+    _large.remove(page);
+  }
+}
+
+static int compare_page_start(ZPage** p1, ZPage** p2) {
+  const uintptr_t start1 = (*p1)->start();
+  const uintptr_t start2 = (*p2)->start();
+  return start1 < start2 ? -1 : (start1 > start2 ? 1 : 0);
+}
+
+ZPage* ZPageCache::alloc_merged_page(size_t size) {
+  // Collect all cached pages, sorted by address
+  ZArray<ZPage*> pages;
+  ZPerNUMAIterator<ZList<ZPage> > iter_numa(&_small);
+  for (ZList<ZPage>* list; iter_numa.next(&list);) {
+    ZListIterator<ZPage> iter_small(list);
+    for (ZPage* page; iter_small.next(&page);) {
+      pages.append(page);
+    }
+  }
+  ZListIterator<ZPage> iter_medium(&_medium);
+  for (ZPage* page; iter_medium.next(&page);) {
+    pages.append(page);
+  }
+  ZListIterator<ZPage> iter_large(&_large);
+  for (ZPage* page; iter_large.next(&page);) {
+    pages.append(page);
+  }
+  pages.sort(compare_page_start);
+
+  // Find the first run of pages with adjacent virtual memory that
+  // together are large enough
+  int run_start = 0;
+  size_t run_size = 0;
+  int run_end = -1;
+  for (int i = 0; i < pages.length(); i++) {
+    if (i == 0 || pages.at(i - 1)->end() != pages.at(i)->start()) {
+      // Start new run
+      run_start = i;
+      run_size = 0;
+    }
+
+    run_size += pages.at(i)->size();
+    if (run_size >= size) {
+      run_end = i;
+      break;
+    }
+  }
+
+  if (run_end < 0) {
+    // No run large enough
+    return NULL;
+  }
+
+  // Merge the pages of the run. The virtual memory is already mapped to
+  // the physical memory of the pages, so no remapping is needed.
+  const uintptr_t start = pages.at(run_start)->start();
+  ZPhysicalMemory pmem;
+  for (int i = run_start; i <= run_end; i++) {
+    ZPage* const page = pages.at(i);
+    remove_page(page);
+
+    ZPhysicalMemory& fmem = page->physical_memory();
+    pmem.add_segments(fmem);
+    fmem.remove_segments();
+    (*_safe_delete)(page);
+  }
+
+  const ZVirtualMemory vmem(start, run_size);
+  return new ZPage(vmem, pmem);
+}
+
 ZPage* ZPageCache::alloc_page(uint8_t type, size_t size) {
   ZPage* page;
 
@@ -180,6 +262,26 @@ ZPage* ZPageCache::alloc_page(uint8_t type, size_t size) {
     }
   }
 
+  if (page == NULL && ZPageCacheMerge && type != ZPageTypeSmall) {
+    // Try merge adjacent pages
+    ZPage* const merged = alloc_merged_page(size);
+    if (merged != NULL) {
+      ZStatInc(ZCounterPageCacheHitL3);
+      if (size < merged->size()) {
+        // Split merged page
+        page = merged->split(type, size);
+
+        // Cache remainder
+        free_page(merged);
+      } else if (merged->type() != type) {
+        // Re-type correctly sized page
+        page = merged->retype(type);
+      } else {
+        page = merged;
+      }
+    }
+  }
+
   if (page == NULL) {
     ZStatInc(ZCounterPageCacheMiss);
   }
@@ -26,6 +26,7 @@
 
 #include "gc/z/zList.hpp"
 #include "gc/z/zPage.hpp"
+#include "gc/z/zSafeDelete.hpp"
 #include "gc/z/zValue.hpp"
 
 class ZPageCacheFlushClosure;
@@ -36,6 +37,7 @@ private:
   ZList<ZPage>            _medium;
   ZList<ZPage>            _large;
   uint64_t                _last_commit;
+  ZSafeDelete<ZPage>*     _safe_delete;
 
   ZPage* alloc_small_page();
   ZPage* alloc_medium_page();
@@ -45,13 +47,16 @@ private:
   ZPage* alloc_oversized_large_page(size_t size);
   ZPage* alloc_oversized_page(size_t size);
 
+  void remove_page(ZPage* page);
+  ZPage* alloc_merged_page(size_t size);
+
   bool flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_list(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList<ZPage> >* from, ZList<ZPage>* to);
   void flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to);
 
 public:
-  ZPageCache();
+  ZPageCache(ZSafeDelete<ZPage>* safe_delete);
 
   ZPage* alloc_page(uint8_t type, size_t size);
   void free_page(ZPage* page);
@@ -28,6 +28,7 @@
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zForwarding.inline.hpp"
 #include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zRelocate.hpp"
 #include "gc/z/zRelocationSet.inline.hpp"
@@ -135,7 +136,15 @@ static ZPage* alloc_page(const ZForwarding* forwarding) {
   ZAllocationFlags flags;
   flags.set_non_blocking();
   flags.set_worker_relocation();
-  return ZHeap::heap()->alloc_page(forwarding->type(), forwarding->size(), flags);
+  ZPage* const page = ZHeap::heap()->alloc_page(forwarding->type(), forwarding->size(), flags);
+  if (page != NULL) {
+    // The target page inherits the age of the page that caused it to be
+    // allocated. Objects from pages of other ages may end up on the same
+    // target page when it is shared or reused, which only affects how soon
+    // those objects are considered old.
+    page->set_age(forwarding->page_age());
+  }
+  return page;
 }
 
 static void free_page(ZPage* page) {
@@ -377,9 +386,104 @@ public:
   }
 };
 
+// Iterates over the relocation set in parallel, handing out forwardings of
+// pages on the NUMA node the calling worker runs on first. Since target pages
+// are allocated on the NUMA node of the allocating thread, this keeps both
+// reading the relocated objects and writing their copies node-local. Once
+// the local node has no more work, the worker helps out with the other nodes.
+class ZRelocateNUMAIterator : public StackObj {
+private:
+  const uint32_t   _numa_count;
+  ZForwarding**    _forwardings;
+  size_t*          _end;
+  volatile size_t* _next;
+
+  bool next_on_node(uint32_t numa_id, ZForwarding** forwarding) {
+    const size_t end = _end[numa_id];
+    if (Atomic::load(&_next[numa_id]) >= end) {
+      // Fast path, node already exhausted
+      return false;
+    }
+
+    const size_t index = Atomic::fetch_and_add(&_next[numa_id], 1u);
+    if (index >= end) {
+      return false;
+    }
+
+    *forwarding = _forwardings[index];
+    return true;
+  }
+
+public:
+  ZRelocateNUMAIterator(ZRelocationSet* relocation_set) :
+      _numa_count(ZNUMA::count()),
+      _forwardings(NULL),
+      _end(NEW_C_HEAP_ARRAY(size_t, _numa_count, mtGC)),
+      _next(NEW_C_HEAP_ARRAY(size_t, _numa_count, mtGC)) {
+    // Count forwardings per node
+    size_t nforwardings = 0;
+    for (uint32_t i = 0; i < _numa_count; i++) {
+      _end[i] = 0;
+    }
+    ZRelocationSetIterator count_iter(relocation_set);
+    for (ZForwarding* forwarding; count_iter.next(&forwarding);) {
+      _end[forwarding->numa_id()]++;
+      nforwardings++;
+    }
+
+    // Partition the forwardings by node, keeping their relative order
+    size_t start = 0;
+    for (uint32_t i = 0; i < _numa_count; i++) {
+      _next[i] = start;
+      start += _end[i];
+      _end[i] = start;
+    }
+    _forwardings = NEW_C_HEAP_ARRAY(ZForwarding*, MAX2(nforwardings, (size_t)1), mtGC);
+    ZRelocationSetIterator install_iter(relocation_set);
+    for (ZForwarding* forwarding; install_iter.next(&forwarding);) {
+      _forwardings[_next[forwarding->numa_id()]++] = forwarding;
+    }
+
+    // Reset cursors to the start of each node
+    for (uint32_t i = 0; i < _numa_count; i++) {
+      _next[i] = (i == 0) ? 0 : _end[i - 1];
+    }
+  }
+
+  ~ZRelocateNUMAIterator() {
+    FREE_C_HEAP_ARRAY(ZForwarding*, _forwardings);
+    FREE_C_HEAP_ARRAY(size_t, _end);
+    FREE_C_HEAP_ARRAY(size_t, _next);
+  }
+
+  bool next(uint32_t numa_id, ZForwarding** forwarding) {
+    // Try NUMA local forwardings
+    if (next_on_node(numa_id, forwarding)) {
+      return true;
+    }
+
+    // Try NUMA remote forwardings
+    uint32_t remote_numa_id = numa_id + 1;
+    const uint32_t remote_numa_count = _numa_count - 1;
+    for (uint32_t i = 0; i < remote_numa_count; i++) {
+      if (remote_numa_id == _numa_count) {
+        remote_numa_id = 0;
+      }
+
+      if (next_on_node(remote_numa_id, forwarding)) {
+        return true;
+      }
+
+      remote_numa_id++;
+    }
+
+    return false;
+  }
+};
+
 class ZRelocateTask : public ZTask {
 private:
-  ZRelocationSetParallelIterator _iter;
+  ZRelocateNUMAIterator          _iter;
   ZRelocateSmallAllocator        _small_allocator;
   ZRelocateMediumAllocator       _medium_allocator;
 
@@ -403,7 +507,9 @@ public:
     ZRelocateClosure<ZRelocateSmallAllocator> small(&_small_allocator);
     ZRelocateClosure<ZRelocateMediumAllocator> medium(&_medium_allocator);
 
-    for (ZForwarding* forwarding; _iter.next(&forwarding);) {
+    const uint32_t numa_id = ZNUMA::id();
+
+    for (ZForwarding* forwarding; _iter.next(numa_id, &forwarding);) {
       if (is_small(forwarding)) {
         small.do_forwarding(forwarding);
       } else {
@@ -35,6 +35,7 @@
 
 ZRelocationSetSelectorGroupStats::ZRelocationSetSelectorGroupStats() :
     _npages(0),
+    _old_npages(0),
     _total(0),
     _live(0),
     _empty(0),
@@ -49,6 +50,7 @@ ZRelocationSetSelectorGroup::ZRelocationSetSelectorGroup(const char* name,
     _page_size(page_size),
     _object_size_limit(object_size_limit),
     _fragmentation_limit(page_size * (ZFragmentationLimit / 100)),
+    _old_fragmentation_limit(page_size * (MAX2(ZOldFragmentationLimit, ZFragmentationLimit) / 100)),
     _live_pages(),
     _forwarding_entries(0),
     _stats() {}
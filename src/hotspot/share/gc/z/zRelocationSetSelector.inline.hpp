@@ -33,6 +33,10 @@ inline size_t ZRelocationSetSelectorGroupStats::npages() const {
   return _npages;
 }
 
+inline size_t ZRelocationSetSelectorGroupStats::old_npages() const {
+  return _old_npages;
+}
+
 inline size_t ZRelocationSetSelectorGroupStats::total() const {
   return _total;
 }
@@ -66,11 +70,18 @@ inline void ZRelocationSetSelectorGroup::register_live_page(ZPage* page) {
   const size_t size = page->size();
   const size_t live = page->live_bytes();
   const size_t garbage = size - live;
+  const bool old = page->is_old();
 
-  if (garbage > _fragmentation_limit) {
+  // Old pages contain objects that have survived many cycles and are likely
+  // to stay alive. Only relocate them when they are considerably fragmented,
+  // to avoid copying the same long-lived objects over and over again.
+  if (garbage > (old ? _old_fragmentation_limit : _fragmentation_limit)) {
     _live_pages.append(page);
   }
 
+  if (old) {
+    _stats._old_npages++;
+  }
   _stats._npages++;
   _stats._total += size;
   _stats._live += live;
@@ -855,6 +855,14 @@ double ZStatAllocRate::avg_sd() {
   return _rate_avg.sd();
 }
 
+double ZStatAllocRate::predict() {
+  return _rate.predict_next();
+}
+
+double ZStatAllocRate::sd() {
+  return _rate.sd();
+}
+
 //
 // Stat thread
 //
@@ -1193,6 +1201,9 @@ void ZStatRelocation::print(const char* name,
                       selector_group.empty() / M,
                       selector_group.relocate() / M,
                       in_place_count);
+  if (ZTenuringThreshold > 0) {
+    log_info(gc, reloc)("%s Pages: " SIZE_FORMAT " old", name, selector_group.old_npages());
+  }
 }
 
 void ZStatRelocation::print() {
@@ -343,6 +343,8 @@ public:
 
   static double avg();
   static double avg_sd();
+  static double predict();
+  static double sd();
 };
 
 //
@@ -33,7 +33,9 @@
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zNMethod.hpp"
 #include "gc/z/zStat.hpp"
+#include "gc/z/zTask.hpp"
 #include "gc/z/zUnload.hpp"
+#include "gc/z/zWorkers.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "oops/access.inline.hpp"
 
@@ -153,6 +155,20 @@ void ZUnload::unlink() {
   DependencyContext::cleaning_end();
 }
 
+class ZPurgeClassLoaderDataTask : public ZTask {
+private:
+  ClassLoaderDataGraphParallelPurger* const _purger;
+
+public:
+  ZPurgeClassLoaderDataTask(ClassLoaderDataGraphParallelPurger* purger) :
+      ZTask("ZPurgeClassLoaderDataTask"),
+      _purger(purger) {}
+
+  virtual void work() {
+    _purger->work();
+  }
+};
+
 void ZUnload::purge() {
   if (!ClassUnloading) {
     return;
@@ -165,7 +181,14 @@ void ZUnload::purge() {
     ZNMethod::purge(_workers);
   }
 
-  ClassLoaderDataGraph::purge(/*at_safepoint*/false);
+  if (ZParallelClassUnloadingPurge) {
+    ClassLoaderDataGraphParallelPurger purger;
+    ZPurgeClassLoaderDataTask task(&purger);
+    _workers->run_concurrent(&task);
+    purger.complete(/*at_safepoint*/false);
+  } else {
+    ClassLoaderDataGraph::purge(/*at_safepoint*/false);
+  }
   CodeCache::purge_exception_caches();
 }
 
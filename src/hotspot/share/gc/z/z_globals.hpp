@@ -35,9 +35,43 @@
   product(double, ZAllocationSpikeTolerance, 2.0,                           \
           "Allocation spike tolerance factor")                              \
                                                                             \
+  product(bool, ZAllocationRateTrend, false, EXPERIMENTAL,                  \
+          "Also start GC cycles when the short term trend of the "          \
+          "allocation rate predicts running out of memory before a GC "     \
+          "cycle could complete")                                           \
+                                                                            \
   product(double, ZFragmentationLimit, 25.0,                                \
           "Maximum allowed heap fragmentation")                             \
                                                                             \
+  product(uint, ZTenuringThreshold, 0, EXPERIMENTAL,                        \
+          "Number of GC cycles a page must survive before its objects "     \
+          "are considered old. 0 disables page aging")                      \
+          range(0, 15)                                                      \
+                                                                            \
+  product(double, ZOldFragmentationLimit, 50.0, EXPERIMENTAL,               \
+          "Maximum allowed fragmentation of pages with old objects")        \
+                                                                            \
+  product(bool, ZParallelClassUnloadingPurge, false, EXPERIMENTAL,          \
+          "Delete unloaded class loader data in parallel")                  \
+                                                                            \
+  product(bool, ZPageCacheMerge, false, EXPERIMENTAL,                       \
+          "Satisfy medium and large page allocations by merging cached "    \
+          "pages with adjacent virtual memory before flushing the page "    \
+          "cache")                                                          \
+                                                                            \
+  product(bool, ZElideBarriersOnAllocations, false, EXPERIMENTAL,           \
+          "Elide C2 load barriers on loads from objects allocated "         \
+          "without a safepoint before the load")                            \
+                                                                            \
+  product(bool, ZCompactForwardingTables, false, EXPERIMENTAL,              \
+          "Size forwarding tables for a load factor of up to 75% instead "  \
+          "of 50% to reduce their memory usage during relocation")          \
+                                                                            \
+  product(bool, ZConcurrentClassHistogram, false, EXPERIMENTAL,             \
+          "Collect class histograms (jmap -histo, GC.class_histogram) "     \
+          "during the marking of a concurrent GC cycle instead of in a "    \
+          "safepoint. Only live objects are reported")                      \
+                                                                            \
   product(size_t, ZMarkStackSpaceLimit, 8*G,                                \
           "Maximum number of bytes allocated for mark stacks")              \
           range(32*M, 1024*G)                                               \
@@ -55,6 +89,10 @@
           "Uncommit memory if it has been unused for the specified "        \
           "amount of time (in seconds)")                                    \
                                                                             \
+  product(bool, ZUncommitCoalesce, false, EXPERIMENTAL,                     \
+          "Coalesce the physical memory of all pages flushed for uncommit " \
+          "and uncommit each contiguous range with a single operation")     \
+                                                                            \
   product(uint, ZStatisticsInterval, 10, DIAGNOSTIC,                        \
           "Time between statistics print outs (in seconds)")                \
           range(1, (uint)-1)                                                \
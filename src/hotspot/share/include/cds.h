@@ -36,7 +36,7 @@
 #define NUM_CDS_REGIONS 7 // this must be the same as MetaspaceShared::n_regions
 #define CDS_ARCHIVE_MAGIC 0xf00baba2
 #define CDS_DYNAMIC_ARCHIVE_MAGIC 0xf00baba8
-#define CURRENT_CDS_ARCHIVE_VERSION 11
+#define CURRENT_CDS_ARCHIVE_VERSION 12
 #define INVALID_CDS_ARCHIVE_VERSION -1
 
 struct CDSFileMapRegion {
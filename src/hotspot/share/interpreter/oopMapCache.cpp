@@ -433,15 +433,23 @@ void InterpreterOopMap::resource_copy(OopMapCacheEntry* from) {
 inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int bci) const {
   // We use method->code_size() rather than method->identity_hash() below since
   // the mark may not be present if a pointer to the method is already reversed.
+  // With a larger cache, also mix in the address of the method, which is
+  // stable, to spread methods of the same shape over the cache. The result
+  // must stay a small positive int, as the probes are computed as int.
+  unsigned int method_bits = 0;
+  if (_size > 32) {
+    method_bits = ((unsigned int)(p2i(method()) >> LogBytesPerWord) * 31) & (max_jint >> 1);
+  }
   return   ((unsigned int) bci)
          ^ ((unsigned int) method->max_locals()         << 2)
          ^ ((unsigned int) method->code_size()          << 4)
-         ^ ((unsigned int) method->size_of_parameters() << 6);
+         ^ ((unsigned int) method->size_of_parameters() << 6)
+         ^ method_bits;
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = NULL;
 
-OopMapCache::OopMapCache() {
+OopMapCache::OopMapCache() : _size(InterpreterOopMapCacheSize) {
   _array  = NEW_C_HEAP_ARRAY(OopMapCacheEntry*, _size, mtClass);
   for(int i = 0; i < _size; i++) _array[i] = NULL;
 }
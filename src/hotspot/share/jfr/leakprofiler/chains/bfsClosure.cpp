@@ -30,12 +30,17 @@
 #include "jfr/leakprofiler/chains/edgeQueue.hpp"
 #include "jfr/leakprofiler/utilities/granularTimer.hpp"
 #include "jfr/leakprofiler/utilities/unifiedOopRef.inline.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "logging/log.hpp"
 #include "memory/iterator.inline.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/align.hpp"
+#include "utilities/growableArray.hpp"
 
 BFSClosure::BFSClosure(EdgeQueue* edge_queue, EdgeStore* edge_store, BitSet* mark_bits) :
   _edge_queue(edge_queue),
@@ -100,7 +105,12 @@ void BFSClosure::log_dfs_fallback() const {
 
 void BFSClosure::process() {
   process_root_set();
-  process_queue();
+  WorkGang* const workers = JfrPathToGcRootsThreads > 1 ? Universe::heap()->safepoint_workers() : NULL;
+  if (workers != NULL) {
+    process_queue_parallel(workers, MIN2(JfrPathToGcRootsThreads, workers->total_workers()));
+  } else {
+    process_queue();
+  }
 }
 
 void BFSClosure::process_root_set() {
@@ -176,6 +186,167 @@ void BFSClosure::process_queue() {
   }
 }
 
+// An edge found by a worker, added to the edge queue or the edge store
+// by the VM thread once the frontier has been processed.
+struct PendingEdge {
+  const Edge* _parent;
+  UnifiedOopRef _reference;
+};
+
+typedef GrowableArrayCHeap<PendingEdge, mtTracing> PendingEdges;
+
+// Iterates the pointees of the edges of one frontier for a worker.
+class BFSWorkerClosure : public BasicOopIterateClosure {
+ private:
+  BitSet* const _mark_bits;
+  PendingEdges* const _edges;
+  PendingEdges* const _chains;
+  const Edge* _current_parent;
+
+  void closure_impl(UnifiedOopRef reference, const oop pointee) {
+    if (_mark_bits->par_mark_obj(pointee)) {
+      PendingEdge edge = { _current_parent, reference };
+      // is the pointee a sample object?
+      if (pointee->mark().is_marked()) {
+        _chains->append(edge);
+      }
+      _edges->append(edge);
+    }
+  }
+
+ public:
+  BFSWorkerClosure(BitSet* mark_bits, PendingEdges* edges, PendingEdges* chains) :
+    _mark_bits(mark_bits), _edges(edges), _chains(chains), _current_parent(NULL) {}
+
+  virtual ReferenceIterationMode reference_iteration_mode() { return DO_FIELDS_EXCEPT_REFERENT; }
+
+  void iterate(const Edge* parent) {
+    _current_parent = parent;
+    parent->pointee()->oop_iterate(this);
+  }
+
+  virtual void do_oop(oop* ref) {
+    const oop pointee = HeapAccess<AS_NO_KEEPALIVE>::oop_load(ref);
+    if (pointee != NULL) {
+      closure_impl(UnifiedOopRef::encode_in_heap(ref), pointee);
+    }
+  }
+
+  virtual void do_oop(narrowOop* ref) {
+    const oop pointee = HeapAccess<AS_NO_KEEPALIVE>::oop_load(ref);
+    if (pointee != NULL) {
+      closure_impl(UnifiedOopRef::encode_in_heap(ref), pointee);
+    }
+  }
+};
+
+// Processes the edges [begin, end) of the edge queue in parallel.
+class BFSFrontierTask : public AbstractGangTask {
+  static const size_t chunk_size = 64;
+
+  EdgeQueue* const _edge_queue;
+  BitSet* const _mark_bits;
+  const size_t _end;
+  const uint _num_workers;
+  volatile size_t _claimed;
+  volatile bool _timed_out;
+  PendingEdges** _edges;
+  PendingEdges** _chains;
+
+ public:
+  BFSFrontierTask(EdgeQueue* edge_queue, BitSet* mark_bits, size_t begin, size_t end, uint num_workers) :
+      AbstractGangTask("JFR Path To GC Roots"),
+      _edge_queue(edge_queue),
+      _mark_bits(mark_bits),
+      _end(end),
+      _num_workers(num_workers),
+      _claimed(begin),
+      _timed_out(false),
+      _edges(NEW_C_HEAP_ARRAY(PendingEdges*, num_workers, mtTracing)),
+      _chains(NEW_C_HEAP_ARRAY(PendingEdges*, num_workers, mtTracing)) {
+    for (uint i = 0; i < num_workers; i++) {
+      _edges[i] = new PendingEdges();
+      _chains[i] = new PendingEdges();
+    }
+  }
+
+  ~BFSFrontierTask() {
+    for (uint i = 0; i < _num_workers; i++) {
+      delete _edges[i];
+      delete _chains[i];
+    }
+    FREE_C_HEAP_ARRAY(PendingEdges*, _edges);
+    FREE_C_HEAP_ARRAY(PendingEdges*, _chains);
+  }
+
+  PendingEdges* edges(uint worker_id) const { return _edges[worker_id]; }
+  PendingEdges* chains(uint worker_id) const { return _chains[worker_id]; }
+  bool timed_out() const { return _timed_out; }
+
+  virtual void work(uint worker_id) {
+    BFSWorkerClosure cl(_mark_bits, _edges[worker_id], _chains[worker_id]);
+    while (!_timed_out) {
+      const size_t begin = Atomic::fetch_and_add(&_claimed, chunk_size);
+      if (begin >= _end) {
+        return;
+      }
+      // The GranularTimer is not thread-safe, compare with its deadline instead
+      if (JfrTicks::now() > GranularTimer::end_time()) {
+        _timed_out = true;
+        return;
+      }
+      const size_t end = MIN2(begin + chunk_size, _end);
+      for (size_t idx = begin; idx < end; ++idx) {
+        cl.iterate(_edge_queue->element_at(idx));
+      }
+    }
+  }
+};
+
+void BFSClosure::process_queue_parallel(WorkGang* workers, uint num_workers) {
+  assert(_current_frontier_level == 0, "invariant");
+  _mark_bits->prepare_par_mark(Universe::heap()->max_capacity());
+
+  _next_frontier_idx = _edge_queue->top();
+  while (!_edge_queue->is_empty() && JfrTicks::now() <= GranularTimer::end_time()) {
+    const size_t begin = _edge_queue->bottom();
+    const size_t end = _next_frontier_idx;
+    assert(begin < end, "invariant");
+
+    BFSFrontierTask task(_edge_queue, _mark_bits, begin, end, num_workers);
+    workers->run_task(&task, num_workers);
+    while (_edge_queue->bottom() < end) {
+      _edge_queue->remove();
+    }
+
+    // Add the found edges to the next frontier, in worker order to
+    // keep the result independent of timing as much as possible.
+    for (uint i = 0; i < num_workers; i++) {
+      const PendingEdges* const chains = task.chains(i);
+      for (int j = 0; j < chains->length(); j++) {
+        const PendingEdge& pending = chains->at(j);
+        Edge leak_edge(pending._parent, pending._reference);
+        _edge_store->put_chain(&leak_edge, _current_frontier_level + 2);
+      }
+      const PendingEdges* const edges = task.edges(i);
+      for (int j = 0; j < edges->length(); j++) {
+        const PendingEdge& pending = edges->at(j);
+        if (!_edge_queue->is_full()) {
+          _edge_queue->add(pending._parent, pending._reference);
+        } else {
+          // The edge queue is full, search from here depth-first instead
+          Edge edge(pending._parent, pending._reference);
+          DFSClosure::find_leaks_from_edge(_edge_store, _mark_bits, &edge);
+        }
+      }
+    }
+    if (task.timed_out()) {
+      break;
+    }
+    step_frontier();
+  }
+}
+
 void BFSClosure::step_frontier() const {
   log_completed_frontier();
   ++_current_frontier_level;
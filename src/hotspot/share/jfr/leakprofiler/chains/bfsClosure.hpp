@@ -32,6 +32,7 @@ class BitSet;
 class Edge;
 class EdgeStore;
 class EdgeQueue;
+class WorkGang;
 
 // Class responsible for iterating the heap breadth-first
 class BFSClosure : public BasicOopIterateClosure {
@@ -61,6 +62,7 @@ class BFSClosure : public BasicOopIterateClosure {
 
   void process_root_set();
   void process_queue();
+  void process_queue_parallel(WorkGang* workers, uint num_workers);
 
  public:
   virtual ReferenceIterationMode reference_iteration_mode() { return DO_FIELDS_EXCEPT_REFERENT; }
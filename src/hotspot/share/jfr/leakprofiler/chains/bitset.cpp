@@ -23,6 +23,7 @@
  */
 #include "precompiled.hpp"
 #include "jfr/leakprofiler/chains/bitset.inline.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 BitSet::BitMapFragment::BitMapFragment(uintptr_t granule, BitMapFragment* next) :
     _bits(_bitmap_granularity_size >> LogMinObjAlignmentInBytes, mtTracing, true /* clear */),
@@ -33,7 +34,16 @@ BitSet::BitSet() :
     _bitmap_fragments(32),
     _fragment_list(NULL),
     _last_fragment_bits(NULL),
-    _last_fragment_granule(0) {
+    _last_fragment_granule(0),
+    _fragment_lock(0) {
+}
+
+void BitSet::prepare_par_mark(size_t heap_size) {
+  const size_t fragments = (heap_size >> _bitmap_granularity_shift) + 1;
+  const int table_size = (int)MIN2(round_up_power_of_2(fragments * 4), (size_t)max_jint / 2 + 1);
+  if (table_size > _bitmap_fragments.table_size()) {
+    _bitmap_fragments.resize(table_size);
+  }
 }
 
 BitSet::~BitSet() {
@@ -73,11 +73,14 @@ class BitSet : public CHeapObj<mtTracing> {
   };
 
   CHeapBitMap* get_fragment_bits(uintptr_t addr);
+  CHeapBitMap* par_get_fragment_bits(uintptr_t addr);
+  CHeapBitMap* add_fragment(uintptr_t granule);
 
   BitMapFragmentTable _bitmap_fragments;
   BitMapFragment* _fragment_list;
   CHeapBitMap* _last_fragment_bits;
   uintptr_t _last_fragment_granule;
+  volatile int _fragment_lock;
 
  public:
   BitSet();
@@ -96,6 +99,13 @@ class BitSet : public CHeapObj<mtTracing> {
   bool is_marked(oop obj) {
     return is_marked(cast_from_oop<uintptr_t>(obj));
   }
+
+  // Parallel marking. The fragment table must be large enough for the
+  // heap before marking in parallel, it is not resized concurrently.
+  void prepare_par_mark(size_t heap_size);
+
+  // Returns true if this call marked the object.
+  bool par_mark_obj(oop obj);
 };
 
 class BitSet::BitMapFragment : public CHeapObj<mtTracing> {
@@ -29,6 +29,7 @@
 
 #include "jfr/recorder/storage/jfrVirtualMemory.hpp"
 #include "memory/memRegion.hpp"
+#include "runtime/thread.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/hashtable.inline.hpp"
 
@@ -77,13 +78,10 @@ inline CHeapBitMap* BitSet::get_fragment_bits(uintptr_t addr) {
   if (found != NULL) {
     bits = *found;
   } else {
-    BitMapFragment* fragment = new BitMapFragment(granule, _fragment_list);
-    bits = fragment->bits();
-    _fragment_list = fragment;
+    bits = add_fragment(granule);
     if (_bitmap_fragments.number_of_entries() * 100 / _bitmap_fragments.table_size() > 25) {
       _bitmap_fragments.resize(_bitmap_fragments.table_size() * 2);
     }
-    _bitmap_fragments.add(granule, bits);
   }
 
   _last_fragment_bits = bits;
@@ -104,4 +102,31 @@ inline bool BitSet::is_marked(uintptr_t addr) {
   return bits->at(bit);
 }
 
+inline CHeapBitMap* BitSet::add_fragment(uintptr_t granule) {
+  BitMapFragment* fragment = new BitMapFragment(granule, _fragment_list);
+  _fragment_list = fragment;
+  _bitmap_fragments.add(granule, fragment->bits());
+  return fragment->bits();
+}
+
+inline CHeapBitMap* BitSet::par_get_fragment_bits(uintptr_t addr) {
+  uintptr_t granule = addr >> _bitmap_granularity_shift;
+  // Entries are published with release semantics, lookups can race with adds
+  CHeapBitMap** found = _bitmap_fragments.lookup(granule);
+  if (found != NULL) {
+    return *found;
+  }
+  Thread::SpinAcquire(&_fragment_lock, "BitSet fragment lock");
+  found = _bitmap_fragments.lookup(granule);
+  CHeapBitMap* bits = found != NULL ? *found : add_fragment(granule);
+  Thread::SpinRelease(&_fragment_lock);
+  return bits;
+}
+
+inline bool BitSet::par_mark_obj(oop obj) {
+  const uintptr_t addr = cast_from_oop<uintptr_t>(obj);
+  CHeapBitMap* bits = par_get_fragment_bits(addr);
+  return bits->par_set_bit(addr_to_bit(addr));
+}
+
 #endif // SHARE_JFR_LEAKPROFILER_CHAINS_BITSET_INLINE_HPP
@@ -31,6 +31,7 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
+#include "compiler/compilationCost.hpp"
 #include "compiler/compileBroker.hpp"
 #include "gc/shared/gcConfiguration.hpp"
 #include "gc/shared/gcTrace.hpp"
@@ -43,6 +44,7 @@
 #include "jfr/periodic/jfrThreadDumpEvent.hpp"
 #include "jfr/periodic/jfrNetworkUtilization.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
+#include "jfr/support/jfrAllocationSiteProfiler.hpp"
 #include "jfr/support/jfrThreadId.hpp"
 #include "jfr/utilities/jfrThreadIterator.hpp"
 #include "jfr/utilities/jfrTime.hpp"
@@ -462,6 +464,10 @@ TRACE_REQUEST_FUNC(PhysicalMemory) {
   event.commit();
 }
 
+TRACE_REQUEST_FUNC(AllocationSiteSummary) {
+  JfrAllocationSiteProfiler::send_events();
+}
+
 TRACE_REQUEST_FUNC(JavaThreadStatistics) {
   EventJavaThreadStatistics event;
   event.set_activeCount(ThreadService::get_live_thread_count());
@@ -585,6 +591,14 @@ TRACE_REQUEST_FUNC(CompilerConfiguration) {
   event.commit();
 }
 
+TRACE_REQUEST_FUNC(MethodCompilationCost) {
+  CompilationCost::send_cost_events();
+}
+
+TRACE_REQUEST_FUNC(MethodDeoptimizationCount) {
+  CompilationCost::send_deoptimization_events();
+}
+
 TRACE_REQUEST_FUNC(CodeCacheStatistics) {
   // Emit stats for all available code heaps
   for (int bt = 0; bt < CodeBlobType::NumTypes; ++bt) {
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/periodic/sampling/jfrCPUTimer.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "runtime/osThread.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/threadSMR.hpp"
+
+#ifdef LINUX
+
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+// The states of the timer of a thread. A thread that manipulates the
+// timer of another thread holds it in the busy state, so that the owner
+// cannot exit and delete it concurrently.
+enum JfrCPUTimerState {
+  TIMER_NONE = 0,
+  TIMER_ARMED,
+  TIMER_BUSY,
+  TIMER_DEAD
+};
+
+static volatile size_t _period_ms = 0;
+static bool _signal_installed = false;
+
+static void handle_cpu_timer_signal(int sig, siginfo_t* info, void* context) {
+  Thread* const t = Thread::current_or_null_safe();
+  if (t != NULL && t->is_Java_thread()) {
+    Atomic::release_store(t->jfr_thread_local()->cpu_timer_expired_addr(), (jint)1);
+  }
+}
+
+static bool install_signal_handler() {
+  if (_signal_installed) {
+    return true;
+  }
+  struct sigaction old_act;
+  if (sigaction(SIGPROF, NULL, &old_act) != 0) {
+    return false;
+  }
+  void* const old_handler = (old_act.sa_flags & SA_SIGINFO) != 0 ?
+    (void*)old_act.sa_sigaction : (void*)old_act.sa_handler;
+  if (old_handler != (void*)SIG_DFL && old_handler != (void*)SIG_IGN) {
+    log_warning(jfr)("SIGPROF is already in use, not sampling Java threads by CPU time");
+    return false;
+  }
+  struct sigaction act;
+  memset(&act, 0, sizeof(act));
+  sigemptyset(&act.sa_mask);
+  act.sa_sigaction = handle_cpu_timer_signal;
+  act.sa_flags = SA_SIGINFO | SA_RESTART;
+  if (sigaction(SIGPROF, &act, NULL) != 0) {
+    return false;
+  }
+  _signal_installed = true;
+  return true;
+}
+
+static bool create_timer(JavaThread* jt, timer_t* timer) {
+  clockid_t clock;
+  if (pthread_getcpuclockid(jt->osthread()->pthread_id(), &clock) != 0) {
+    return false;
+  }
+  struct sigevent sev;
+  memset(&sev, 0, sizeof(sev));
+  sev.sigev_notify = SIGEV_THREAD_ID;
+  sev.sigev_signo = SIGPROF;
+  sev.sigev_notify_thread_id = jt->osthread()->thread_id();
+  return timer_create(clock, &sev, timer) == 0;
+}
+
+static void set_timer(timer_t timer, size_t period_ms) {
+  struct itimerspec its;
+  its.it_interval.tv_sec = period_ms / MILLIUNITS;
+  its.it_interval.tv_nsec = (period_ms % MILLIUNITS) * NANOSECS_PER_MILLISEC;
+  its.it_value = its.it_interval;
+  timer_settime(timer, 0, &its, NULL);
+}
+
+// Moves the timer state of tl to busy. Returns false if the thread has exited.
+static bool acquire_timer(JfrThreadLocal* tl, int* state) {
+  volatile int* const addr = tl->cpu_timer_state_addr();
+  while (true) {
+    const int cur = Atomic::load_acquire(addr);
+    if (cur == TIMER_DEAD) {
+      return false;
+    }
+    if (cur != TIMER_BUSY && Atomic::cmpxchg(addr, cur, (int)TIMER_BUSY) == cur) {
+      *state = cur;
+      return true;
+    }
+    os::naked_yield();
+  }
+}
+
+// Brings the timer of jt in line with the current period. The period is
+// read while the timer is held, so the last update of a timer always sees
+// the last period set.
+static void update_timer(JavaThread* jt) {
+  JfrThreadLocal* const tl = jt->jfr_thread_local();
+  int state;
+  if (!acquire_timer(tl, &state)) {
+    return;
+  }
+  const size_t period_ms = Atomic::load(&_period_ms);
+  if (period_ms > 0) {
+    if (state == TIMER_NONE) {
+      timer_t timer;
+      if (create_timer(jt, &timer)) {
+        tl->set_cpu_timer(timer);
+        state = TIMER_ARMED;
+      }
+    }
+    if (state == TIMER_ARMED) {
+      set_timer((timer_t)tl->cpu_timer(), period_ms);
+    }
+  } else if (state == TIMER_ARMED) {
+    timer_delete((timer_t)tl->cpu_timer());
+    state = TIMER_NONE;
+  }
+  Atomic::release_store(tl->cpu_timer_state_addr(), state);
+}
+
+bool JfrCPUTimer::is_enabled() {
+  return JfrSampleJavaByCPUTime && Atomic::load(&_period_ms) > 0;
+}
+
+void JfrCPUTimer::set_period(size_t period_ms) {
+  if (!JfrSampleJavaByCPUTime || period_ms == Atomic::load(&_period_ms)) {
+    return;
+  }
+  if (period_ms > 0 && !install_signal_handler()) {
+    return;
+  }
+  log_trace(jfr)("Setting CPU time sampling period to " SIZE_FORMAT " ms", period_ms);
+  Atomic::release_store(&_period_ms, period_ms);
+  JavaThreadIteratorWithHandle jtiwh;
+  for (JavaThread* jt = jtiwh.next(); jt != NULL; jt = jtiwh.next()) {
+    update_timer(jt);
+  }
+}
+
+void JfrCPUTimer::on_javathread_start(JavaThread* jt) {
+  if (is_enabled()) {
+    update_timer(jt);
+  }
+}
+
+void JfrCPUTimer::on_javathread_exit(JavaThread* jt) {
+  JfrThreadLocal* const tl = jt->jfr_thread_local();
+  int state;
+  if (acquire_timer(tl, &state)) {
+    if (state == TIMER_ARMED) {
+      timer_delete((timer_t)tl->cpu_timer());
+    }
+    Atomic::release_store(tl->cpu_timer_state_addr(), (int)TIMER_DEAD);
+  }
+}
+
+bool JfrCPUTimer::has_expired(JavaThread* jt) {
+  return Atomic::xchg(jt->jfr_thread_local()->cpu_timer_expired_addr(), (jint)0) != 0;
+}
+
+#else // LINUX
+
+bool JfrCPUTimer::is_enabled() {
+  return false;
+}
+
+void JfrCPUTimer::set_period(size_t period_ms) {}
+
+void JfrCPUTimer::on_javathread_start(JavaThread* jt) {}
+
+void JfrCPUTimer::on_javathread_exit(JavaThread* jt) {}
+
+bool JfrCPUTimer::has_expired(JavaThread* jt) {
+  return true;
+}
+
+#endif // LINUX
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_JFR_PERIODIC_SAMPLING_JFRCPUTIMER_HPP
+#define SHARE_JFR_PERIODIC_SAMPLING_JFRCPUTIMER_HPP
+
+#include "memory/allocation.hpp"
+
+class JavaThread;
+
+// With JfrSampleJavaByCPUTime, every Java thread has a timer that expires
+// each time the thread has consumed a sampling period of CPU time. The
+// JfrThreadSampler then only samples the threads whose timers have expired,
+// instead of suspending threads in turn regardless of how much CPU they use.
+//
+// The timers are only available on Linux.
+class JfrCPUTimer : AllStatic {
+ public:
+  static bool is_enabled();
+  // Arms the timers of all Java threads with the given period, or disarms
+  // them if the period is 0.
+  static void set_period(size_t period_ms);
+
+  static void on_javathread_start(JavaThread* jt);
+  static void on_javathread_exit(JavaThread* jt);
+
+  // Returns true if the timer of jt has expired since the last call.
+  static bool has_expired(JavaThread* jt);
+};
+
+#endif // SHARE_JFR_PERIODIC_SAMPLING_JFRCPUTIMER_HPP
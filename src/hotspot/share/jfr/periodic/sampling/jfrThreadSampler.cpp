@@ -26,6 +26,7 @@
 #include "jfr/jfrEvents.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
 #include "jfr/periodic/sampling/jfrCallTrace.hpp"
+#include "jfr/periodic/sampling/jfrCPUTimer.hpp"
 #include "jfr/periodic/sampling/jfrThreadSampler.hpp"
 #include "jfr/recorder/service/jfrOptionSet.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
@@ -523,6 +524,8 @@ void JfrThreadSampler::task_stacktrace(JfrSampleType type, JavaThread** last_thr
   const uint sample_limit = JAVA_SAMPLE == type ? MAX_NR_OF_JAVA_SAMPLES : MAX_NR_OF_NATIVE_SAMPLES;
   uint num_samples = 0;
   JavaThread* start = NULL;
+  // Only sample the threads that have used up a period of CPU time.
+  const bool by_cpu_time = JAVA_SAMPLE == type && JfrCPUTimer::is_enabled();
 
   {
     elapsedTimer sample_time;
@@ -546,6 +549,9 @@ void JfrThreadSampler::task_stacktrace(JfrSampleType type, JavaThread** last_thr
         if (current->is_Compiler_thread()) {
           continue;
         }
+        if (by_cpu_time && !JfrCPUTimer::has_expired(current)) {
+          continue;
+        }
         if (sample_task.do_sample_thread(current, _frames, _max_frames, type)) {
           num_samples++;
         }
@@ -583,6 +589,7 @@ void JfrThreadSampling::destroy() {
 JfrThreadSampling::JfrThreadSampling() : _sampler(NULL) {}
 
 JfrThreadSampling::~JfrThreadSampling() {
+  JfrCPUTimer::set_period(0);
   if (_sampler != NULL) {
     _sampler->disenroll();
   }
@@ -609,6 +616,7 @@ void JfrThreadSampling::set_sampling_interval(bool java_interval, size_t period)
   }
   if (java_interval) {
     interval_java = period;
+    JfrCPUTimer::set_period(period);
   } else {
     interval_native = period;
   }
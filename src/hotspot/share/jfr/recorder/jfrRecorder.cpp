@@ -41,6 +41,7 @@
 #include "jfr/recorder/storage/jfrStorage.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/recorder/stringpool/jfrStringPool.hpp"
+#include "jfr/support/jfrAllocationSiteProfiler.hpp"
 #include "jfr/utilities/jfrTime.hpp"
 #include "jfr/writers/jfrJavaEventWriter.hpp"
 #include "logging/log.hpp"
@@ -76,8 +77,8 @@ bool JfrRecorder::is_enabled() {
 }
 
 bool JfrRecorder::create_oop_storages() {
-  // currently only a single weak oop storage for Leak Profiler
-  return ObjectSampler::create_oop_storage();
+  // weak oop storages for the Leak Profiler and the allocation site profiler
+  return ObjectSampler::create_oop_storage() && JfrAllocationSiteProfiler::create_oop_storage();
 }
 
 bool JfrRecorder::on_create_vm_1() {
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/recorder/repository/jfrChunkStreamer.hpp"
+#include "logging/log.hpp"
+#include "runtime/os.hpp"
+#include "services/heapDumperCompression.hpp"
+
+#ifdef LINUX
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/sendfile.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+// How long a started chunk may wait for the consumer before the
+// connection is abandoned.
+static const int STREAM_TIMEOUT_MS = 1000;
+
+static const size_t COMPRESSION_BLOCK_SIZE = 1 * M;
+
+static int _out = -1;
+static size_t _dropped_chunks = 0;
+
+static GZipCompressor* _compressor = NULL;
+static bool _compression_failed = false;
+static char* _block = NULL;
+static char* _compressed = NULL;
+static char* _tmp = NULL;
+static size_t _compressed_size = 0;
+static size_t _tmp_size = 0;
+
+static int connect_output(const char* path) {
+  struct stat st;
+  if (os::stat(path, &st) != 0) {
+    return -1;
+  }
+  if (S_ISFIFO(st.st_mode)) {
+    // Fails with ENXIO while there is no reader.
+    return ::open(path, O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+  }
+  if (!S_ISSOCK(st.st_mode)) {
+    log_warning(jfr)("JfrStreamChunksTo=%s is neither a FIFO nor a socket", path);
+    return -1;
+  }
+  struct sockaddr_un addr;
+  if (strlen(path) >= sizeof(addr.sun_path)) {
+    return -1;
+  }
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, path);
+  const int fd = os::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    return -1;
+  }
+  if (os::connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+    ::close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+static void disconnect_output() {
+  assert(_out >= 0, "invariant");
+  ::close(_out);
+  _out = -1;
+}
+
+static bool wait_writable(int timeout_ms) {
+  struct pollfd pfd;
+  pfd.fd = _out;
+  pfd.events = POLLOUT;
+  pfd.revents = 0;
+  return poll(&pfd, 1, timeout_ms) == 1 && (pfd.revents & POLLOUT) != 0;
+}
+
+// Returns true when all of the chunk has been sent.
+static bool send_chunk(int in, int64_t size) {
+  off_t offset = 0;
+  while (offset < size) {
+    const ssize_t sent = sendfile(_out, in, &offset, (size_t)(size - offset));
+    if (sent > 0) {
+      continue;
+    }
+    if (sent < 0 && errno == EINTR) {
+      continue;
+    }
+    if (sent < 0 && errno == EAGAIN && wait_writable(STREAM_TIMEOUT_MS)) {
+      continue;
+    }
+    return false;
+  }
+  return true;
+}
+
+static bool write_fully(const char* buf, size_t len) {
+  while (len > 0) {
+    const ssize_t written = ::write(_out, buf, len);
+    if (written > 0) {
+      buf += written;
+      len -= written;
+      continue;
+    }
+    if (written < 0 && errno == EINTR) {
+      continue;
+    }
+    if (written < 0 && errno == EAGAIN && wait_writable(STREAM_TIMEOUT_MS)) {
+      continue;
+    }
+    return false;
+  }
+  return true;
+}
+
+static bool initialize_compression() {
+  if (_compressor != NULL) {
+    return true;
+  }
+  if (_compression_failed) {
+    return false;
+  }
+  GZipCompressor* const compressor = new GZipCompressor((int)JfrStreamCompressionLevel);
+  const char* const msg = compressor->init(COMPRESSION_BLOCK_SIZE, &_compressed_size, &_tmp_size);
+  if (msg != NULL) {
+    log_warning(jfr)("Streaming chunks uncompressed: %s", msg);
+    delete compressor;
+    _compression_failed = true;
+    return false;
+  }
+  _block = NEW_C_HEAP_ARRAY(char, COMPRESSION_BLOCK_SIZE, mtTracing);
+  _compressed = NEW_C_HEAP_ARRAY(char, _compressed_size, mtTracing);
+  _tmp = _tmp_size > 0 ? NEW_C_HEAP_ARRAY(char, _tmp_size, mtTracing) : NULL;
+  _compressor = compressor;
+  return true;
+}
+
+// Returns true when all of the chunk has been compressed and sent.
+static bool send_compressed_chunk(int in, int64_t size) {
+  int64_t remaining = size;
+  while (remaining > 0) {
+    const size_t len = (size_t)MIN2<int64_t>(remaining, COMPRESSION_BLOCK_SIZE);
+    if (os::read(in, _block, (unsigned int)len) != (ssize_t)len) {
+      return false;
+    }
+    size_t compressed_len = 0;
+    if (_compressor->compress(_block, len, _compressed, _compressed_size,
+                              _tmp, _tmp_size, &compressed_len) != NULL) {
+      return false;
+    }
+    if (!write_fully(_compressed, compressed_len)) {
+      return false;
+    }
+    remaining -= len;
+  }
+  return true;
+}
+
+void JfrChunkStreamer::stream(const char* path, int64_t size) {
+  assert(is_enabled(), "invariant");
+  if (path == NULL || size <= 0) {
+    return;
+  }
+  if (_out < 0) {
+    _out = connect_output(JfrStreamChunksTo);
+    if (_out < 0) {
+      log_debug(jfr, system)("No consumer connected to %s", JfrStreamChunksTo);
+      return;
+    }
+    log_info(jfr, system)("Streaming chunks to %s", JfrStreamChunksTo);
+  }
+  // Backpressure: do not start a chunk the consumer is not ready for.
+  if (!wait_writable(0)) {
+    _dropped_chunks++;
+    log_debug(jfr, system)("Consumer busy, dropped chunk %s (" SIZE_FORMAT " dropped)", path, _dropped_chunks);
+    return;
+  }
+  const int in = os::open(path, O_RDONLY, 0);
+  if (in < 0) {
+    return;
+  }
+  const bool compress = JfrStreamCompressionLevel > 0 && initialize_compression();
+  if (!(compress ? send_compressed_chunk(in, size) : send_chunk(in, size))) {
+    // A partially sent chunk cannot be recovered by the consumer, so end
+    // the stream and reconnect with the next chunk.
+    _dropped_chunks++;
+    log_info(jfr, system)("Failed to stream chunk %s, disconnecting from %s", path, JfrStreamChunksTo);
+    disconnect_output();
+  }
+  ::close(in);
+}
+
+#else // LINUX
+
+void JfrChunkStreamer::stream(const char* path, int64_t size) {
+  static bool warned = false;
+  if (!warned) {
+    log_warning(jfr)("JfrStreamChunksTo is not supported on this platform");
+    warned = true;
+  }
+}
+
+#endif // LINUX
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_JFR_RECORDER_REPOSITORY_JFRCHUNKSTREAMER_HPP
+#define SHARE_JFR_RECORDER_REPOSITORY_JFRCHUNKSTREAMER_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/globals.hpp"
+
+// With JfrStreamChunksTo, every completed chunk is sent to the named FIFO
+// or Unix domain socket, so that a consumer can follow a recording without
+// reading the repository. The output is connected lazily and reconnected
+// after a failure. A chunk the consumer cannot accept right away is dropped
+// as a whole, so that the stream only ever contains complete chunks and the
+// recorder is never blocked by a slow consumer.
+//
+// With JfrStreamCompressionLevel, each chunk is sent as gzip members of
+// at most COMPRESSION_BLOCK_SIZE uncompressed bytes.
+//
+// Streaming is only available on Linux.
+class JfrChunkStreamer : AllStatic {
+ public:
+  static bool is_enabled() {
+    return JfrStreamChunksTo != NULL;
+  }
+  // Sends the first size bytes of the chunk file at path.
+  static void stream(const char* path, int64_t size);
+};
+
+#endif // SHARE_JFR_RECORDER_REPOSITORY_JFRCHUNKSTREAMER_HPP
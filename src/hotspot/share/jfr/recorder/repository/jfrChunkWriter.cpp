@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "jfr/recorder/repository/jfrChunk.hpp"
+#include "jfr/recorder/repository/jfrChunkStreamer.hpp"
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/utilities/jfrTime.hpp"
 #include "jfr/utilities/jfrTypes.hpp"
@@ -289,5 +290,8 @@ int64_t JfrChunkWriter::close() {
   const int64_t size_written = flush_chunk(false);
   this->close_fd();
   assert(!this->is_valid(), "invariant");
+  if (JfrChunkStreamer::is_enabled()) {
+    JfrChunkStreamer::stream(_chunk->path(), size_written);
+  }
   return size_written;
 }
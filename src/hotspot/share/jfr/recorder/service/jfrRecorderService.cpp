@@ -40,6 +40,7 @@
 #include "jfr/recorder/storage/jfrStorage.hpp"
 #include "jfr/recorder/storage/jfrStorageControl.hpp"
 #include "jfr/recorder/stringpool/jfrStringPool.hpp"
+#include "jfr/support/jfrAllocationSiteProfiler.hpp"
 #include "jfr/utilities/jfrAllocation.hpp"
 #include "jfr/utilities/jfrTime.hpp"
 #include "jfr/writers/jfrJavaEventWriter.hpp"
@@ -453,6 +454,7 @@ void JfrRecorderService::safepoint_clear() {
   _storage.clear();
   _chunkwriter.set_time_stamp();
   JfrStackTraceRepository::clear();
+  JfrAllocationSiteProfiler::clear();
   _checkpoint_manager.end_epoch_shift();
 }
 
@@ -568,6 +570,7 @@ void JfrRecorderService::safepoint_write() {
   _storage.write_at_safepoint();
   _chunkwriter.set_time_stamp();
   write_stacktrace(_stack_trace_repository, _chunkwriter, true);
+  JfrAllocationSiteProfiler::clear();
   _checkpoint_manager.end_epoch_shift();
 }
 
@@ -28,18 +28,30 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/thread.inline.hpp"
 
 /*
  * There are two separate repository instances.
  * One instance is dedicated to stacktraces taken as part of the leak profiler subsystem.
  * It is kept separate because at the point of insertion, it is unclear if a trace will be serialized,
  * which is a decision postponed and taken during rotation.
+ *
+ * Traces are added and looked up without taking a lock. New traces are
+ * pushed onto the head of their bucket with a CAS. Writing and clearing
+ * are serialized by the JfrStacktrace_lock. Traces are only deleted at a
+ * safepoint; traces cleared outside of one are retired until the next
+ * safepoint clear. Adding threads never hold on to a trace across a
+ * safepoint, except through the recent stack traces of their
+ * JfrThreadLocal, which are invalidated by bumping _generation.
  */
 
 static JfrStackTraceRepository* _instance = NULL;
 static JfrStackTraceRepository* _leak_profiler_instance = NULL;
-static traceid _next_id = 0;
+static volatile traceid _next_id = 0;
+static volatile u4 _generation = 0;
 
 JfrStackTraceRepository& JfrStackTraceRepository::instance() {
   assert(_instance != NULL, "invariant");
@@ -51,8 +63,8 @@ static JfrStackTraceRepository& leak_profiler_instance() {
   return *_leak_profiler_instance;
 }
 
-JfrStackTraceRepository::JfrStackTraceRepository() : _last_entries(0), _entries(0) {
-  memset(_table, 0, sizeof(_table));
+JfrStackTraceRepository::JfrStackTraceRepository() : _retired(NULL), _last_entries(0), _entries(0) {
+  memset((void*)_table, 0, sizeof(_table));
 }
 
 JfrStackTraceRepository* JfrStackTraceRepository::create() {
@@ -94,54 +106,87 @@ void JfrStackTraceRepository::destroy() {
 }
 
 bool JfrStackTraceRepository::is_modified() const {
-  return _last_entries != _entries;
+  return _last_entries != Atomic::load(&_entries);
+}
+
+void JfrStackTraceRepository::delete_chain(const JfrStackTrace* stacktrace) {
+  while (stacktrace != NULL) {
+    const JfrStackTrace* next = stacktrace->next();
+    delete const_cast<JfrStackTrace*>(stacktrace);
+    stacktrace = next;
+  }
+}
+
+void JfrStackTraceRepository::free_retired() {
+  assert(SafepointSynchronize::is_at_safepoint(), "invariant");
+  delete_chain(_retired);
+  _retired = NULL;
 }
 
 size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
-  if (_entries == 0) {
+  // Traces added while writing are picked up by the next write.
+  const u4 entries = Atomic::load_acquire(&_entries);
+  if (entries == 0) {
     return 0;
   }
   MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  assert(_entries > 0, "invariant");
+  assert(!clear || SafepointSynchronize::is_at_safepoint(), "invariant");
   int count = 0;
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
+    const JfrStackTrace* stacktrace = Atomic::load_acquire(&_table[i]);
     while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
+      const JfrStackTrace* next = stacktrace->next();
       if (stacktrace->should_write()) {
         stacktrace->write(sw);
         ++count;
       }
       if (clear) {
-        delete stacktrace;
+        delete const_cast<JfrStackTrace*>(stacktrace);
       }
       stacktrace = next;
     }
   }
   if (clear) {
-    memset(_table, 0, sizeof(_table));
+    memset((void*)_table, 0, sizeof(_table));
+    free_retired();
+    Atomic::inc(&_generation);
     _entries = 0;
+    _last_entries = 0;
+  } else {
+    _last_entries = entries;
   }
-  _last_entries = _entries;
   return count;
 }
 
 size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
   MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (repo._entries == 0) {
+  const bool at_safepoint = SafepointSynchronize::is_at_safepoint();
+  if (at_safepoint) {
+    repo.free_retired();
+  }
+  if (Atomic::load(&repo._entries) == 0) {
     return 0;
   }
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
-    while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      delete stacktrace;
-      stacktrace = next;
+    const JfrStackTrace* const stacktrace = Atomic::xchg(&repo._table[i], (const JfrStackTrace*)NULL);
+    if (stacktrace == NULL) {
+      continue;
+    }
+    if (at_safepoint) {
+      delete_chain(stacktrace);
+    } else {
+      // Concurrent lookups may still be traversing the chain.
+      const JfrStackTrace* last = stacktrace;
+      while (last->next() != NULL) {
+        last = last->next();
+      }
+      const_cast<JfrStackTrace*>(last)->set_next(repo._retired);
+      repo._retired = stacktrace;
     }
   }
-  memset(repo._table, 0, sizeof(repo._table));
-  const size_t processed = repo._entries;
-  repo._entries = 0;
+  // Only bumped once no new lookup can find the cleared traces.
+  Atomic::inc(&_generation);
+  const size_t processed = Atomic::xchg(&repo._entries, (u4)0);
   repo._last_entries = 0;
   return processed;
 }
@@ -168,14 +213,34 @@ traceid JfrStackTraceRepository::record(Thread* thread, int skip /* 0 */) {
 
 traceid JfrStackTraceRepository::record_for(JavaThread* thread, int skip, JfrStackFrame *frames, u4 max_frames) {
   JfrStackTrace stacktrace(frames, max_frames);
-  return stacktrace.record_safe(thread, skip) ? add(instance(), stacktrace) : 0;
+  if (!stacktrace.record_safe(thread, skip)) {
+    return 0;
+  }
+  // Repeated stacks of a thread are usually found among its recent traces,
+  // which saves the lookup in the shared table.
+  const JfrStackTrace** const recent =
+    thread->jfr_thread_local()->recent_stack_traces(Atomic::load_acquire(&_generation));
+  const u4 slot = stacktrace.hash() % JfrThreadLocal::RECENT_STACK_TRACES;
+  if (recent[slot] != NULL && recent[slot]->equals(stacktrace)) {
+    return recent[slot]->id();
+  }
+  const JfrStackTrace* const entry = add_entry(instance(), stacktrace);
+  recent[slot] = entry;
+  return entry->id();
 }
-traceid JfrStackTraceRepository::add(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace) {
-  traceid tid = repo.add_trace(stacktrace);
-  if (tid == 0) {
+
+const JfrStackTrace* JfrStackTraceRepository::add_entry(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace) {
+  const JfrStackTrace* entry = repo.add_trace(stacktrace);
+  if (entry == NULL) {
     stacktrace.resolve_linenos();
-    tid = repo.add_trace(stacktrace);
+    entry = repo.add_trace(stacktrace);
   }
+  assert(entry != NULL, "invariant");
+  return entry;
+}
+
+traceid JfrStackTraceRepository::add(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace) {
+  const traceid tid = add_entry(repo, stacktrace)->id();
   assert(tid != 0, "invariant");
   return tid;
 }
@@ -197,32 +262,50 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* thread, int s
   }
 }
 
-traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
-
-  while (table_entry != NULL) {
-    if (table_entry->equals(stacktrace)) {
-      return table_entry->id();
+const JfrStackTrace* JfrStackTraceRepository::find(const JfrStackTrace* head, const JfrStackTrace* stop, const JfrStackTrace& stacktrace) {
+  for (const JfrStackTrace* entry = head; entry != stop; entry = entry->next()) {
+    if (entry->equals(stacktrace)) {
+      return entry;
     }
-    table_entry = table_entry->next();
+  }
+  return NULL;
+}
+
+const JfrStackTrace* JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
+  const size_t index = stacktrace._hash % TABLE_SIZE;
+  const JfrStackTrace* head = Atomic::load_acquire(&_table[index]);
+  const JfrStackTrace* found = find(head, NULL, stacktrace);
+  if (found != NULL) {
+    return found;
   }
 
   if (!stacktrace.have_lineno()) {
-    return 0;
+    return NULL;
   }
 
-  traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
-  ++_entries;
-  return id;
+  JfrStackTrace* const entry = new JfrStackTrace(Atomic::add(&_next_id, (traceid)1), stacktrace, head);
+  while (true) {
+    const JfrStackTrace* const witness = Atomic::cmpxchg(&_table[index], head, (const JfrStackTrace*)entry);
+    if (witness == head) {
+      Atomic::inc(&_entries);
+      return entry;
+    }
+    // Another thread pushed onto the bucket, or it was cleared. Only the
+    // pushed entries need to be checked for the trace.
+    found = find(witness, head, stacktrace);
+    if (found != NULL) {
+      delete entry;
+      return found;
+    }
+    head = witness;
+    entry->set_next(head);
+  }
 }
 
 // invariant is that the entry to be resolved actually exists in the table
 const JfrStackTrace* JfrStackTraceRepository::lookup_for_leak_profiler(unsigned int hash, traceid id) {
   const size_t index = (hash % TABLE_SIZE);
-  const JfrStackTrace* trace = leak_profiler_instance()._table[index];
+  const JfrStackTrace* trace = Atomic::load_acquire(&leak_profiler_instance()._table[index]);
   while (trace != NULL && trace->id() != id) {
     trace = trace->next();
   }
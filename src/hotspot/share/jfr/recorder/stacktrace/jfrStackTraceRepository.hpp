@@ -45,9 +45,11 @@ class JfrStackTraceRepository : public JfrCHeapObj {
 
  private:
   static const u4 TABLE_SIZE = 2053;
-  JfrStackTrace* _table[TABLE_SIZE];
+  const JfrStackTrace* volatile _table[TABLE_SIZE];
+  // Traces cleared outside of a safepoint, see clear().
+  const JfrStackTrace* _retired;
   u4 _last_entries;
-  u4 _entries;
+  volatile u4 _entries;
 
   JfrStackTraceRepository();
   static JfrStackTraceRepository& instance();
@@ -58,13 +60,17 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   bool is_modified() const;
   static size_t clear();
   static size_t clear(JfrStackTraceRepository& repo);
+  void free_retired();
+  static void delete_chain(const JfrStackTrace* stacktrace);
+  static const JfrStackTrace* find(const JfrStackTrace* head, const JfrStackTrace* stop, const JfrStackTrace& stacktrace);
   size_t write(JfrChunkWriter& cw, bool clear);
 
   static const JfrStackTrace* lookup_for_leak_profiler(unsigned int hash, traceid id);
   static void record_for_leak_profiler(JavaThread* thread, int skip = 0);
   static void clear_leak_profiler();
 
-  traceid add_trace(const JfrStackTrace& stacktrace);
+  const JfrStackTrace* add_trace(const JfrStackTrace& stacktrace);
+  static const JfrStackTrace* add_entry(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace);
   static traceid add(JfrStackTraceRepository& repo, const JfrStackTrace& stacktrace);
   static traceid add(const JfrStackTrace& stacktrace);
   traceid record_for(JavaThread* thread, int skip, JfrStackFrame* frames, u4 max_frames);
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/oopStorage.hpp"
+#include "gc/shared/oopStorageSet.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
+#include "jfr/support/jfrAllocationSiteProfiler.hpp"
+#include "jfr/utilities/jfrSpinlockHelper.hpp"
+#include "jfr/utilities/jfrTypes.hpp"
+#include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/threadHeapSampler.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/resourceHash.hpp"
+
+// Upper bound on the number of samples whose survival is tracked.
+static const int max_tracked_samples = 4096;
+
+class JfrAllocationSite {
+ public:
+  u8 _samples;
+  u8 _allocated;
+  JfrAllocationSite() : _samples(0), _allocated(0) {}
+};
+
+class JfrAllocationSiteSample {
+ public:
+  oop* _ref;
+  traceid _stack_trace_id;
+  size_t _weight;
+  unsigned int _total_collections;
+  JfrAllocationSiteSample() : _ref(NULL), _stack_trace_id(0), _weight(0), _total_collections(0) {}
+  JfrAllocationSiteSample(oop* ref, traceid stack_trace_id, size_t weight, unsigned int total_collections) :
+    _ref(ref), _stack_trace_id(stack_trace_id), _weight(weight), _total_collections(total_collections) {}
+};
+
+typedef ResourceHashtable<traceid, JfrAllocationSite,
+                          primitive_hash<traceid>, primitive_equals<traceid>,
+                          1031, ResourceObj::C_HEAP, mtTracing> JfrAllocationSiteTable;
+
+typedef ResourceHashtable<traceid, u8,
+                          primitive_hash<traceid>, primitive_equals<traceid>,
+                          1031> SurvivingBytesTable;
+
+static OopStorage* _oop_storage = NULL;
+static JfrAllocationSiteTable* _sites = NULL;
+static GrowableArray<JfrAllocationSiteSample>* _samples = NULL;
+static volatile int _lock = 0;
+
+static THREAD_LOCAL int64_t _last_sample_allocated_bytes = 0;
+static THREAD_LOCAL int64_t _bytes_until_sample = 0;
+
+bool JfrAllocationSiteProfiler::create_oop_storage() {
+  _oop_storage = OopStorageSet::create_weak("Weak JFR Allocation Site Samples", mtTracing);
+  assert(_oop_storage != NULL, "invariant");
+  _sites = new (ResourceObj::C_HEAP, mtTracing) JfrAllocationSiteTable();
+  _samples = new (ResourceObj::C_HEAP, mtTracing) GrowableArray<JfrAllocationSiteSample>(max_tracked_samples, mtTracing);
+  return true;
+}
+
+static oop load_referent(const JfrAllocationSiteSample& sample) {
+  return NativeAccess<ON_PHANTOM_OOP_REF | AS_NO_KEEPALIVE>::oop_load(sample._ref);
+}
+
+static void release(const JfrAllocationSiteSample& sample) {
+  NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(sample._ref, (oop)NULL);
+  _oop_storage->release(sample._ref);
+}
+
+// Releases the samples whose objects have died.
+static void remove_dead_samples() {
+  int live = 0;
+  for (int i = 0; i < _samples->length(); i++) {
+    const JfrAllocationSiteSample& sample = _samples->at(i);
+    if (load_referent(sample) == NULL) {
+      release(sample);
+    } else {
+      _samples->at_put(live++, sample);
+    }
+  }
+  _samples->trunc_to(live);
+}
+
+void JfrAllocationSiteProfiler::sample(HeapWord* obj, JavaThread* thread) {
+  if (!EventAllocationSiteSummary::is_enabled()) {
+    return;
+  }
+  const int64_t allocated_bytes = thread->allocated_bytes();
+  if (allocated_bytes < _last_sample_allocated_bytes) {
+    // A hw thread can detach and reattach to the VM and then gets a new
+    // JavaThread, see JfrObjectAllocationSample.
+    _last_sample_allocated_bytes = 0;
+  }
+  const int64_t weight = allocated_bytes - _last_sample_allocated_bytes;
+  if (weight < _bytes_until_sample) {
+    return;
+  }
+  _last_sample_allocated_bytes = allocated_bytes;
+  _bytes_until_sample = static_cast<int64_t>(ThreadHeapSampler::next_geometric_sample());
+
+  const traceid stack_trace_id = JfrStackTraceRepository::record(thread);
+  if (stack_trace_id == 0) {
+    return;
+  }
+  JfrSpinlockHelper lock(&_lock);
+  bool created;
+  JfrAllocationSite* const site = _sites->put_if_absent(stack_trace_id, &created);
+  site->_samples++;
+  site->_allocated += weight;
+  if (_samples->length() == max_tracked_samples) {
+    remove_dead_samples();
+    if (_samples->length() == max_tracked_samples) {
+      // Only the allocation is accounted for.
+      return;
+    }
+  }
+  oop* const ref = _oop_storage->allocate();
+  if (ref != NULL) {
+    NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(ref, cast_to_oop(obj));
+    _samples->append(JfrAllocationSiteSample(ref, stack_trace_id, weight,
+                                          Universe::heap()->total_collections()));
+  }
+}
+
+class AllocationSiteEventSender : public StackObj {
+  const SurvivingBytesTable& _surviving;
+ public:
+  AllocationSiteEventSender(const SurvivingBytesTable& surviving) : _surviving(surviving) {}
+
+  bool do_entry(const traceid& stack_trace_id, const JfrAllocationSite& site) {
+    const u8* const surviving = _surviving.get(stack_trace_id);
+    EventAllocationSiteSummary event;
+    event.set_stackTrace(stack_trace_id);
+    event.set_samples(site._samples);
+    event.set_allocated(site._allocated);
+    event.set_surviving(surviving != NULL ? *surviving : 0);
+    event.commit();
+    return true;
+  }
+};
+
+void JfrAllocationSiteProfiler::send_events() {
+  ResourceMark rm;
+  JfrSpinlockHelper lock(&_lock);
+  remove_dead_samples();
+  const unsigned int total_collections = Universe::heap()->total_collections();
+  SurvivingBytesTable surviving;
+  for (int i = 0; i < _samples->length(); i++) {
+    const JfrAllocationSiteSample& sample = _samples->at(i);
+    if (sample._total_collections != total_collections) {
+      bool created;
+      u8* const bytes = surviving.put_if_absent(sample._stack_trace_id, 0, &created);
+      *bytes += sample._weight;
+    }
+  }
+  AllocationSiteEventSender sender(surviving);
+  _sites->iterate(&sender);
+}
+
+void JfrAllocationSiteProfiler::clear() {
+  assert(SafepointSynchronize::is_at_safepoint(), "invariant");
+  if (_sites == NULL) {
+    return;
+  }
+  for (int i = 0; i < _samples->length(); i++) {
+    release(_samples->at(i));
+  }
+  _samples->clear();
+  delete _sites;
+  _sites = new (ResourceObj::C_HEAP, mtTracing) JfrAllocationSiteTable();
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_JFR_SUPPORT_JFRALLOCATIONSITEPROFILER_HPP
+#define SHARE_JFR_SUPPORT_JFRALLOCATIONSITEPROFILER_HPP
+
+#include "memory/allocation.hpp"
+
+class JavaThread;
+
+// Aggregates sampled allocations per allocation site, for the
+// AllocationSiteSummary event. Allocations are sampled at the points where
+// the other allocation events are sent, TLAB refills and allocations
+// outside TLABs, with the geometric sampler of the ThreadHeapSampler. A
+// sample records the stack trace of the allocation and is weighted with the
+// bytes the thread allocated since its previous sample. Sampled objects are
+// tracked with weak references, so their survival across GCs can be
+// reported.
+//
+// Stack trace ids are only valid within a chunk, so all data is discarded
+// at each chunk rotation.
+class JfrAllocationSiteProfiler : AllStatic {
+  friend class JfrAllocationTracer;
+  friend class JfrRecorder;
+  friend class JfrRecorderService;
+
+  static bool create_oop_storage();
+  static void sample(HeapWord* obj, JavaThread* thread);
+  // Discards all samples. Called at a safepoint.
+  static void clear();
+
+ public:
+  // Sends one AllocationSiteSummary event per sampled allocation site.
+  static void send_events();
+};
+
+#endif // SHARE_JFR_SUPPORT_JFRALLOCATIONSITEPROFILER_HPP
@@ -27,6 +27,7 @@
 #include "jfr/jni/jfrJavaSupport.hpp"
 #include "jfr/leakprofiler/checkpoint/objectSampleCheckpoint.hpp"
 #include "jfr/periodic/jfrThreadCPULoadEvent.hpp"
+#include "jfr/periodic/sampling/jfrCPUTimer.hpp"
 #include "jfr/recorder/checkpoint/jfrCheckpointManager.hpp"
 #include "jfr/recorder/checkpoint/types/traceid/jfrTraceIdEpoch.hpp"
 #include "jfr/recorder/jfrRecorder.hpp"
@@ -55,11 +56,24 @@ JfrThreadLocal::JfrThreadLocal() :
   _wallclock_time(os::javaTimeNanos()),
   _stack_trace_hash(0),
   _stackdepth(0),
+  _recent_stack_traces_generation(0),
   _entering_suspend_flag(0),
+  _cpu_timer(NULL),
+  _cpu_timer_state(0),
+  _cpu_timer_expired(0),
   _excluded(false),
   _dead(false) {
   Thread* thread = Thread::current_or_null();
   _parent_trace_id = thread != NULL ? thread->jfr_thread_local()->trace_id() : (traceid)0;
+  memset(_recent_stack_traces, 0, sizeof(_recent_stack_traces));
+}
+
+const JfrStackTrace** JfrThreadLocal::recent_stack_traces(u4 generation) {
+  if (_recent_stack_traces_generation != generation) {
+    memset(_recent_stack_traces, 0, sizeof(_recent_stack_traces));
+    _recent_stack_traces_generation = generation;
+  }
+  return _recent_stack_traces;
 }
 
 u8 JfrThreadLocal::add_data_lost(u8 value) {
@@ -99,6 +113,9 @@ void JfrThreadLocal::on_start(Thread* t) {
       }
     }
   }
+  if (t->is_Java_thread()) {
+    JfrCPUTimer::on_javathread_start(t->as_Java_thread());
+  }
   if (t->jfr_thread_local()->has_cached_stack_trace()) {
     t->jfr_thread_local()->clear_cached_stack_trace();
   }
@@ -158,6 +175,9 @@ void JfrThreadLocal::on_exit(Thread* t) {
   assert(t != NULL, "invariant");
   JfrThreadLocal * const tl = t->jfr_thread_local();
   assert(!tl->is_dead(), "invariant");
+  if (t->is_Java_thread()) {
+    JfrCPUTimer::on_javathread_exit(t->as_Java_thread());
+  }
   if (JfrRecorder::is_recording()) {
     if (t->is_Java_thread()) {
       JavaThread* const jt = t->as_Java_thread();
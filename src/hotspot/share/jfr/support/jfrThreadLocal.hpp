@@ -31,9 +31,13 @@
 class JavaThread;
 class JfrBuffer;
 class JfrStackFrame;
+class JfrStackTrace;
 class Thread;
 
 class JfrThreadLocal {
+ public:
+  static const u4 RECENT_STACK_TRACES = 4;
+
  private:
   jobject _java_event_writer;
   mutable JfrBuffer* _java_buffer;
@@ -51,7 +55,12 @@ class JfrThreadLocal {
   jlong _wallclock_time;
   unsigned int _stack_trace_hash;
   mutable u4 _stackdepth;
+  const JfrStackTrace* _recent_stack_traces[RECENT_STACK_TRACES];
+  u4 _recent_stack_traces_generation;
   volatile jint _entering_suspend_flag;
+  void* _cpu_timer;
+  volatile int _cpu_timer_state;
+  volatile jint _cpu_timer_expired;
   bool _excluded;
   bool _dead;
   traceid _parent_trace_id;
@@ -157,6 +166,10 @@ class JfrThreadLocal {
     return _stack_trace_hash;
   }
 
+  // The stack traces this thread has recently added to the repository,
+  // valid for the given repository generation.
+  const JfrStackTrace** recent_stack_traces(u4 generation);
+
   void set_trace_block() {
     _entering_suspend_flag = 1;
   }
@@ -169,6 +182,23 @@ class JfrThreadLocal {
     return _entering_suspend_flag != 0;
   }
 
+  // See JfrCPUTimer
+  void* cpu_timer() const {
+    return _cpu_timer;
+  }
+
+  void set_cpu_timer(void* timer) {
+    _cpu_timer = timer;
+  }
+
+  volatile int* cpu_timer_state_addr() {
+    return &_cpu_timer_state;
+  }
+
+  volatile jint* cpu_timer_expired_addr() {
+    return &_cpu_timer_expired;
+  }
+
   u8 data_lost() const {
     return _data_lost;
   }
@@ -116,7 +116,8 @@ OopMap* CodeInstaller::create_oop_map(JVMCIObject debug_info, JVMCI_TRAPS) {
   if (JVMCIENV->get_length(objects) != JVMCIENV->get_length(derivedBase) || JVMCIENV->get_length(objects) != JVMCIENV->get_length(sizeInBytes)) {
     JVMCI_ERROR_NULL("arrays in reference map have different sizes: %d %d %d", JVMCIENV->get_length(objects), JVMCIENV->get_length(derivedBase), JVMCIENV->get_length(sizeInBytes));
   }
-  for (int i = 0; i < JVMCIENV->get_length(objects); i++) {
+  int length = JVMCIENV->get_length(objects);
+  for (int i = 0; i < length; i++) {
     JVMCIObject location = JVMCIENV->get_object_at(objects, i);
     JVMCIObject baseLocation = JVMCIENV->get_object_at(derivedBase, i);
     jint bytes = JVMCIENV->get_int_at(sizeInBytes, i);
@@ -154,7 +155,8 @@ OopMap* CodeInstaller::create_oop_map(JVMCIObject debug_info, JVMCI_TRAPS) {
   if (callee_save_info.is_non_null()) {
     JVMCIObjectArray registers = jvmci_env()->get_RegisterSaveLayout_registers(callee_save_info);
     JVMCIPrimitiveArray slots = jvmci_env()->get_RegisterSaveLayout_slots(callee_save_info);
-    for (jint i = 0; i < JVMCIENV->get_length(slots); i++) {
+    jint slots_length = JVMCIENV->get_length(slots);
+    for (jint i = 0; i < slots_length; i++) {
       JVMCIObject jvmci_reg = JVMCIENV->get_object_at(registers, i);
       jint jvmci_reg_number = jvmci_env()->get_code_Register_number(jvmci_reg);
       VMReg hotspot_reg = CodeInstaller::get_hotspot_reg(jvmci_reg_number, JVMCI_CHECK_NULL);
@@ -367,7 +369,8 @@ void CodeInstaller::record_object_value(ObjectValue* sv, JVMCIObject value, Grow
 
   JVMCIObjectArray values = jvmci_env()->get_VirtualObject_values(value);
   JVMCIObjectArray slotKinds = jvmci_env()->get_VirtualObject_slotKinds(value);
-  for (jint i = 0; i < JVMCIENV->get_length(values); i++) {
+  jint length = JVMCIENV->get_length(values);
+  for (jint i = 0; i < length; i++) {
     ScopeValue* cur_second = NULL;
     JVMCIObject object = JVMCIENV->get_object_at(values, i);
     BasicType type = jvmci_env()->kindToBasicType(JVMCIENV->get_object_at(slotKinds, i), JVMCI_CHECK);
@@ -616,7 +619,8 @@ int CodeInstaller::estimate_stubs_size(JVMCI_TRAPS) {
   int static_call_stubs = 0;
   int trampoline_stubs = 0;
   JVMCIObjectArray sites = this->sites();
-  for (int i = 0; i < JVMCIENV->get_length(sites); i++) {
+  int length = JVMCIENV->get_length(sites);
+  for (int i = 0; i < length; i++) {
     JVMCIObject site = JVMCIENV->get_object_at(sites, i);
     if (!site.is_null()) {
       if (jvmci_env()->isa_site_Mark(site)) {
@@ -652,7 +656,8 @@ int CodeInstaller::estimate_stubs_size(JVMCI_TRAPS) {
 JVMCI::CodeInstallResult CodeInstaller::initialize_buffer(CodeBuffer& buffer, bool check_size, JVMCI_TRAPS) {
   HandleMark hm(Thread::current());
   JVMCIObjectArray sites = this->sites();
-  int locs_buffer_size = JVMCIENV->get_length(sites) * (relocInfo::length_limit + sizeof(relocInfo));
+  int sites_length = JVMCIENV->get_length(sites);
+  int locs_buffer_size = sites_length * (relocInfo::length_limit + sizeof(relocInfo));
 
   // Allocate enough space in the stub section for the static call
   // stubs.  Stubs have extra relocs but they are managed by the stub
@@ -688,9 +693,11 @@ JVMCI::CodeInstallResult CodeInstaller::initialize_buffer(CodeBuffer& buffer, bo
   JVMCIENV->copy_bytes_to(code(), (jbyte*) _instructions->start(), 0, _code_size);
   _instructions->set_end(end_pc);
 
-  for (int i = 0; i < JVMCIENV->get_length(data_section_patches()); i++) {
+  JVMCIObjectArray patches = data_section_patches();
+  int patches_length = JVMCIENV->get_length(patches);
+  for (int i = 0; i < patches_length; i++) {
     // HandleMark hm(THREAD);
-    JVMCIObject patch = JVMCIENV->get_object_at(data_section_patches(), i);
+    JVMCIObject patch = JVMCIENV->get_object_at(patches, i);
     if (patch.is_null()) {
       JVMCI_THROW_(NullPointerException, JVMCI::ok);
     }
@@ -734,8 +741,13 @@ JVMCI::CodeInstallResult CodeInstaller::initialize_buffer(CodeBuffer& buffer, bo
       JVMCI_ERROR_OK("invalid constant in data section: %s", jvmci_env()->klass_name(constant));
     }
   }
+  // The infopoint reasons denoting safepoints are the same for all sites.
+  JVMCIObject reason_safepoint = jvmci_env()->get_site_InfopointReason_SAFEPOINT();
+  JVMCIObject reason_call = jvmci_env()->get_site_InfopointReason_CALL();
+  JVMCIObject reason_implicit_exception = jvmci_env()->get_site_InfopointReason_IMPLICIT_EXCEPTION();
+  JavaThread* thread = JavaThread::current();
   jint last_pc_offset = -1;
-  for (int i = 0; i < JVMCIENV->get_length(sites); i++) {
+  for (int i = 0; i < sites_length; i++) {
     // HandleMark hm(THREAD);
     JVMCIObject site = JVMCIENV->get_object_at(sites, i);
     if (site.is_null()) {
@@ -750,15 +762,16 @@ JVMCI::CodeInstallResult CodeInstaller::initialize_buffer(CodeBuffer& buffer, bo
     } else if (jvmci_env()->isa_site_Infopoint(site)) {
       // three reasons for infopoints denote actual safepoints
       JVMCIObject reason = jvmci_env()->get_site_Infopoint_reason(site);
-      if (JVMCIENV->equals(reason, jvmci_env()->get_site_InfopointReason_SAFEPOINT()) ||
-          JVMCIENV->equals(reason, jvmci_env()->get_site_InfopointReason_CALL()) ||
-          JVMCIENV->equals(reason, jvmci_env()->get_site_InfopointReason_IMPLICIT_EXCEPTION())) {
+      bool is_implicit_exception = JVMCIENV->equals(reason, reason_implicit_exception);
+      if (is_implicit_exception ||
+          JVMCIENV->equals(reason, reason_safepoint) ||
+          JVMCIENV->equals(reason, reason_call)) {
         JVMCI_event_4("safepoint at %i", pc_offset);
         site_Safepoint(buffer, pc_offset, site, JVMCI_CHECK_OK);
         if (_orig_pc_offset < 0) {
           JVMCI_ERROR_OK("method contains safepoint, but has no deopt rescue slot");
         }
-        if (JVMCIENV->equals(reason, jvmci_env()->get_site_InfopointReason_IMPLICIT_EXCEPTION())) {
+        if (is_implicit_exception) {
           if (jvmci_env()->isa_site_ImplicitExceptionDispatch(site)) {
             jint dispatch_offset = jvmci_env()->get_site_ImplicitExceptionDispatch_dispatchOffset(site);
             JVMCI_event_4("implicit exception at %i, dispatch to %i", pc_offset, dispatch_offset);
@@ -786,7 +799,6 @@ JVMCI::CodeInstallResult CodeInstaller::initialize_buffer(CodeBuffer& buffer, bo
     }
     last_pc_offset = pc_offset;
 
-    JavaThread* thread = JavaThread::current();
     if (SafepointMechanism::should_process(thread)) {
       // this is a hacky way to force a safepoint check but nothing else was jumping out at me.
       ThreadToNativeFromVM ttnfv(thread);
@@ -795,7 +807,8 @@ JVMCI::CodeInstallResult CodeInstaller::initialize_buffer(CodeBuffer& buffer, bo
 
 #ifndef PRODUCT
   if (comments().is_non_null()) {
-    for (int i = 0; i < JVMCIENV->get_length(comments()); i++) {
+    int length = JVMCIENV->get_length(comments());
+    for (int i = 0; i < length; i++) {
       JVMCIObject comment = JVMCIENV->get_object_at(comments(), i);
       assert(jvmci_env()->isa_HotSpotCompiledCode_Comment(comment), "cce");
       jint offset = jvmci_env()->get_HotSpotCompiledCode_Comment_pcOffset(comment);
@@ -883,9 +896,10 @@ GrowableArray<ScopeValue*>* CodeInstaller::record_virtual_objects(JVMCIObject de
   if (virtualObjects.is_null()) {
     return NULL;
   }
-  GrowableArray<ScopeValue*>* objects = new GrowableArray<ScopeValue*>(JVMCIENV->get_length(virtualObjects), JVMCIENV->get_length(virtualObjects), NULL);
+  int length = JVMCIENV->get_length(virtualObjects);
+  GrowableArray<ScopeValue*>* objects = new GrowableArray<ScopeValue*>(length, length, NULL);
   // Create the unique ObjectValues
-  for (int i = 0; i < JVMCIENV->get_length(virtualObjects); i++) {
+  for (int i = 0; i < length; i++) {
     // HandleMark hm(THREAD);
     JVMCIObject value = JVMCIENV->get_object_at(virtualObjects, i);
     int id = jvmci_env()->get_VirtualObject_id(value);
@@ -908,7 +922,7 @@ GrowableArray<ScopeValue*>* CodeInstaller::record_virtual_objects(JVMCIObject de
   }
   // All the values which could be referenced by the VirtualObjects
   // exist, so now describe all the VirtualObjects themselves.
-  for (int i = 0; i < JVMCIENV->get_length(virtualObjects); i++) {
+  for (int i = 0; i < length; i++) {
     // HandleMark hm(THREAD);
     JVMCIObject value = JVMCIENV->get_object_at(virtualObjects, i);
     int id = jvmci_env()->get_VirtualObject_id(value);
@@ -1020,7 +1034,8 @@ void CodeInstaller::record_scope(jint pc_offset, JVMCIObject position, ScopeMode
     JVMCI_event_2("Scope at bci %d with %d values", bci, JVMCIENV->get_length(values));
     JVMCI_event_2("%d locals %d expressions, %d monitors", local_count, expression_count, monitor_count);
 
-    for (jint i = 0; i < JVMCIENV->get_length(values); i++) {
+    jint length = JVMCIENV->get_length(values);
+    for (jint i = 0; i < length; i++) {
       // HandleMark hm(THREAD);
       ScopeValue* second = NULL;
       JVMCIObject value = JVMCIENV->get_object_at(values, i);
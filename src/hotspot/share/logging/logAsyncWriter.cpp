@@ -24,9 +24,11 @@
 #include "precompiled.hpp"
 #include "logging/logAsyncWriter.hpp"
 #include "logging/logConfiguration.hpp"
+#include "logging/logDeferredFormat.hpp"
 #include "logging/logFileOutput.hpp"
 #include "logging/logHandle.hpp"
 #include "runtime/atomic.hpp"
+#include "utilities/spinYield.hpp"
 
 Semaphore AsyncLogWriter::_sem(0);
 Semaphore AsyncLogWriter::_io_sem(1);
@@ -46,108 +48,293 @@ class AsyncLogLocker : public StackObj {
 
 Semaphore AsyncLogLocker::_lock(1);
 
-void AsyncLogWriter::enqueue_locked(const AsyncLogMessage& msg) {
-  if (_buffer.size() >= _buffer_max_size)  {
-    bool p_created;
-    uint32_t* counter = _stats.add_if_absent(msg.output(), 0, &p_created);
-    *counter = *counter + 1;
-    // drop the enqueueing message.
-    return;
+AsyncLogBuffer::AsyncLogBuffer(size_t capacity)
+  : _buf(NEW_C_HEAP_ARRAY(char, capacity, mtLogging)),
+    _capacity(capacity),
+    _top(SEALED),
+    _committed(0) {
+  assert(is_aligned(_buf, sizeof(void*)), "must be");
+}
+
+AsyncLogBuffer::~AsyncLogBuffer() {
+  FREE_C_HEAP_ARRAY(char, _buf);
+}
+
+char* AsyncLogBuffer::reserve(size_t size, bool* sealed) {
+  size_t top = Atomic::load(&_top);
+  while (true) {
+    if ((top & SEALED) != 0) {
+      *sealed = true;
+      return NULL;
+    }
+    if (size > _capacity - top) {
+      *sealed = false;
+      return NULL;
+    }
+    size_t old = Atomic::cmpxchg(&_top, top, top + size);
+    if (old == top) {
+      return _buf + top;
+    }
+    top = old;
   }
+}
 
-  assert(_buffer.size() < _buffer_max_size, "_buffer is over-sized.");
-  _buffer.push_back(msg);
-  _sem.signal();
+void AsyncLogBuffer::commit(size_t size) {
+  Atomic::add(&_committed, size);
 }
 
-void AsyncLogWriter::enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg) {
-  AsyncLogMessage m(output, decorations, os::strdup(msg));
+size_t AsyncLogBuffer::seal() {
+  size_t top = Atomic::load(&_top);
+  while (true) {
+    assert((top & SEALED) == 0, "sealed twice");
+    size_t old = Atomic::cmpxchg(&_top, top, top | SEALED);
+    if (old == top) {
+      break;
+    }
+    top = old;
+  }
 
-  { // critical area
+  // Log sites that have reserved space before the buffer got sealed only
+  // copy their message before committing it, so this wait is short.
+  SpinYield spinner;
+  while (Atomic::load_acquire(&_committed) != top) {
+    spinner.wait();
+  }
+  return top;
+}
+
+void AsyncLogBuffer::reset() {
+  assert((Atomic::load(&_top) & SEALED) != 0, "only a sealed buffer can be reset");
+  Atomic::store(&_committed, (size_t)0);
+  Atomic::release_store(&_top, (size_t)0);
+}
+
+AsyncLogBuffer* AsyncLogWriter::reserve(size_t size, char** addr) {
+  while (true) {
+    AsyncLogBuffer* buffer = Atomic::load_acquire(&_buffer);
+    bool sealed;
+    *addr = buffer->reserve(size, &sealed);
+    if (*addr != NULL) {
+      return buffer;
+    } else if (!sealed) {
+      return NULL;
+    }
+    // The buffer has been swapped out by the flushing thread, retry.
+  }
+}
+
+// Wakes up the flushing thread, unless it has been signalled already
+// since it last picked up the messages.
+void AsyncLogWriter::enqueued() {
+  if (Atomic::load(&_pending) == 0 && Atomic::cmpxchg(&_pending, 0, 1) == 0) {
+    _sem.signal();
+  }
+}
+
+void AsyncLogWriter::dropped(LogFileOutput* output, uint32_t count) {
+  {
     AsyncLogLocker lock;
-    enqueue_locked(m);
+    bool p_created;
+    uint32_t* counter = _stats.add_if_absent(output, 0, &p_created);
+    *counter = *counter + count;
   }
+  // The dropped counters are reported by the next flush.
+  enqueued();
+}
+
+void AsyncLogWriter::enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg) {
+  const size_t len = strlen(msg);
+  const size_t size = AsyncLogBuffer::Message::size_for(len);
+  char* addr;
+  AsyncLogBuffer* buffer = reserve(size, &addr);
+  if (buffer == NULL) {
+    dropped(&output, 1);
+    return;
+  }
+
+  AsyncLogBuffer::Message* m = new (addr) AsyncLogBuffer::Message(&output, decorations, size);
+  memcpy(m->message(), msg, len + 1);
+  buffer->commit(size);
+  enqueued();
 }
 
 // LogMessageBuffer consists of a multiple-part/multiple-line messsage.
-// The lock here guarantees its integrity.
+// All parts are reserved at once, which keeps them consecutive and
+// either enqueues or drops the message as a whole.
 void AsyncLogWriter::enqueue(LogFileOutput& output, LogMessageBuffer::Iterator msg_iterator) {
-  AsyncLogLocker lock;
+  size_t size = 0;
+  uint32_t parts = 0;
+  for (LogMessageBuffer::Iterator it = msg_iterator; !it.is_at_end(); it++) {
+    size += AsyncLogBuffer::Message::size_for(strlen(it.message()));
+    parts++;
+  }
+  if (parts == 0) {
+    return;
+  }
+
+  char* addr;
+  AsyncLogBuffer* buffer = reserve(size, &addr);
+  if (buffer == NULL) {
+    dropped(&output, parts);
+    return;
+  }
 
   for (; !msg_iterator.is_at_end(); msg_iterator++) {
-    AsyncLogMessage m(output, msg_iterator.decorations(), os::strdup(msg_iterator.message()));
-    enqueue_locked(m);
+    const char* msg = msg_iterator.message();
+    const size_t len = strlen(msg);
+    const size_t msg_size = AsyncLogBuffer::Message::size_for(len);
+    AsyncLogBuffer::Message* m = new (addr) AsyncLogBuffer::Message(&output, msg_iterator.decorations(), msg_size);
+    memcpy(m->message(), msg, len + 1);
+    addr += msg_size;
   }
+  buffer->commit(size);
+  enqueued();
+}
+
+void AsyncLogWriter::enqueue_deferred(LogFileOutput& output, const LogDecorations& decorations,
+                                      const char* record, size_t record_size) {
+  const size_t size = AsyncLogBuffer::Message::size_for_payload(record_size);
+  char* addr;
+  AsyncLogBuffer* buffer = reserve(size, &addr);
+  if (buffer == NULL) {
+    dropped(&output, 1);
+    return;
+  }
+
+  AsyncLogBuffer::Message* m = new (addr) AsyncLogBuffer::Message(&output, decorations, size, true /* deferred */);
+  memcpy(m->message(), record, record_size);
+  buffer->commit(size);
+  enqueued();
 }
 
 AsyncLogWriter::AsyncLogWriter()
   : _initialized(false),
-    _stats(17 /*table_size*/) {
+    _pending(0),
+    _stats(17 /*table_size*/),
+    _buffer(new AsyncLogBuffer(align_down(AsyncLogBufferSize / 2, sizeof(void*)))),
+    _staging(new AsyncLogBuffer(align_down(AsyncLogBufferSize / 2, sizeof(void*)))) {
+  _buffer->reset();
   if (os::create_thread(this, os::asynclog_thread)) {
     _initialized = true;
   } else {
     log_warning(logging, thread)("AsyncLogging failed to create thread. Falling back to synchronous logging.");
   }
 
-  log_info(logging)("The maximum entries of AsyncLogBuffer: " SIZE_FORMAT ", estimated memory use: " SIZE_FORMAT " bytes",
-                    _buffer_max_size, AsyncLogBufferSize);
+  log_info(logging)("The capacity of AsyncLogBuffer: 2 x " SIZE_FORMAT " bytes", _buffer->capacity());
 }
 
+// Collects the dropped counters of up to Max outputs and resets them.
 class AsyncLogMapIterator {
-  AsyncLogBuffer& _logs;
+ public:
+  static const int Max = 16;
+
+ private:
+  LogFileOutput* _outputs[Max];
+  uint32_t _counters[Max];
+  int _count;
 
  public:
-  AsyncLogMapIterator(AsyncLogBuffer& logs) :_logs(logs) {}
-  bool do_entry(LogFileOutput* output, uint32_t* counter) {
-    using none = LogTagSetMapping<LogTag::__NO_TAG>;
+  AsyncLogMapIterator() : _count(0) {}
 
+  bool do_entry(LogFileOutput* output, uint32_t* counter) {
     if (*counter > 0) {
-      LogDecorations decorations(LogLevel::Warning, none::tagset(), output->decorators());
-      stringStream ss;
-      ss.print(UINT32_FORMAT_W(6) " messages dropped due to async logging", *counter);
-      AsyncLogMessage msg(*output, decorations, ss.as_string(true /*c_heap*/));
-      _logs.push_back(msg);
+      _outputs[_count] = output;
+      _counters[_count] = *counter;
+      _count++;
       *counter = 0;
     }
+    return _count < Max;
+  }
+
+  int count() const { return _count; }
+
+  void write() const {
+    using none = LogTagSetMapping<LogTag::__NO_TAG>;
 
-    return true;
+    for (int i = 0; i < _count; i++) {
+      LogDecorations decorations(LogLevel::Warning, none::tagset(), _outputs[i]->decorators());
+      char msg[64];
+      jio_snprintf(msg, sizeof(msg), UINT32_FORMAT_W(6) " messages dropped due to async logging", _counters[i]);
+      _outputs[i]->write_blocking(decorations, msg);
+    }
   }
 };
 
-void AsyncLogWriter::write() {
-  // Use kind of copy-and-swap idiom here.
-  // Empty 'logs' swaps the content with _buffer.
-  // Along with logs destruction, all processed messages are deleted.
-  //
-  // The operation 'pop_all()' is done in O(1). All I/O jobs are then performed without
-  // lock protection. This guarantees I/O jobs don't block logsites.
-  AsyncLogBuffer logs;
-  bool own_io = false;
-
-  { // critical region
-    AsyncLogLocker lock;
+void AsyncLogWriter::write_dropped_counters() {
+  while (true) {
+    AsyncLogMapIterator dropped_counters_iter;
+    { // critical region
+      AsyncLogLocker lock;
+      _stats.iterate(&dropped_counters_iter);
+    }
+    dropped_counters_iter.write();
+    if (dropped_counters_iter.count() < AsyncLogMapIterator::Max) {
+      return;
+    }
+  }
+}
 
-    _buffer.pop_all(&logs);
-    // append meta-messages of dropped counters
-    AsyncLogMapIterator dropped_counters_iter(logs);
-    _stats.iterate(&dropped_counters_iter);
-    own_io = _io_sem.trywait();
+void AsyncLogWriter::write_deferred(const AsyncLogBuffer::Message* m, bool flush_stream) {
+  char buf[vwrite_buffer_size];
+  size_t len = LogDeferredFormat::format(m->message(), buf, sizeof(buf));
+  if (len < sizeof(buf)) {
+    m->output()->write_blocking(m->decorations(), buf, flush_stream);
+    return;
   }
 
-  LinkedListIterator<AsyncLogMessage> it(logs.head());
-  if (!own_io) {
-    _io_sem.wait();
+  // Buffer too small, use malloc/free to avoid circularity, like LogTagSet::vwrite().
+  char* newbuf = (char*)::malloc(len + 1);
+  if (newbuf != nullptr) {
+    LogDeferredFormat::format(m->message(), newbuf, len + 1);
   }
+  m->output()->write_blocking(m->decorations(), newbuf != nullptr ? newbuf : buf, flush_stream);
+  ::free(newbuf);
+}
+
+void AsyncLogWriter::write() {
+  _io_sem.wait();
+
+  // Messages enqueued from here on need another flush, so the flushing
+  // thread has to be signalled again.
+  Atomic::release_store_fence(&_pending, 0);
 
-  while (!it.is_empty()) {
-    AsyncLogMessage* e = it.next();
-    char* msg = e->message();
+  // Swap the buffers. Log sites continue in the new buffer while the old one
+  // is drained, and without any lock on their side.
+  AsyncLogBuffer* full = _buffer;
+  _staging->reset();
+  Atomic::release_store(&_buffer, _staging);
+  const size_t used = full->seal();
+  _staging = full;
 
-    if (msg != nullptr) {
-      e->output()->write_blocking(e->decorations(), msg);
-      os::free(msg);
+  // The messages are written without flushing the file streams in between;
+  // each output is flushed once at the end. A flush typically touches a
+  // handful of outputs, so a small array of them suffices, and an output
+  // that does not fit in is flushed right away.
+  const int max_outputs = 8;
+  LogFileOutput* outputs[max_outputs];
+  int num_outputs = 0;
+  for (size_t offset = 0; offset < used; ) {
+    AsyncLogBuffer::Message* m = full->at(offset);
+    LogFileOutput* output = m->output();
+    int i = 0;
+    while (i < num_outputs && outputs[i] != output) {
+      i++;
     }
+    if (i == num_outputs && num_outputs < max_outputs) {
+      outputs[num_outputs++] = output;
+    }
+    if (m->is_deferred()) {
+      write_deferred(m, i == max_outputs /* flush_stream */);
+    } else {
+      output->write_blocking(m->decorations(), m->message(), i == max_outputs /* flush_stream */);
+    }
+    offset += m->size();
   }
+  for (int i = 0; i < num_outputs; i++) {
+    outputs[i]->flush_blocking();
+  }
+
+  write_dropped_counters();
   _io_sem.signal();
 }
 
@@ -185,7 +372,7 @@ AsyncLogWriter* AsyncLogWriter::instance() {
   return _instance;
 }
 
-// write() acquires and releases _io_sem even _buffer is empty.
+// write() acquires and releases _io_sem even if _buffer is empty.
 // This guarantees all logging I/O of dequeued messages are done when it returns.
 void AsyncLogWriter::flush() {
   if (_instance != nullptr) {
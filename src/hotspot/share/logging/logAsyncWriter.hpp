@@ -27,87 +27,77 @@
 #include "logging/logDecorations.hpp"
 #include "logging/logFileOutput.hpp"
 #include "logging/logMessageBuffer.hpp"
-#include "memory/resourceArea.hpp"
+#include "memory/allocation.hpp"
 #include "runtime/nonJavaThread.hpp"
+#include "utilities/align.hpp"
 #include "utilities/hashtable.hpp"
-#include "utilities/linkedlist.hpp"
-
-template <typename E, MEMFLAGS F>
-class LinkedListDeque : private LinkedListImpl<E, ResourceObj::C_HEAP, F> {
- private:
-  LinkedListNode<E>* _tail;
-  size_t _size;
 
+// AsyncLogBuffer is a pre-allocated buffer of variable-length log messages.
+// Log sites reserve space by bumping _top with a CAS and publish their message
+// by adding its size to _committed, so enqueueing takes no lock and does not
+// allocate. Before the flushing thread drains a buffer, it seals it and waits
+// until all reserved space has been committed. A log site that finds the
+// buffer sealed retries on the buffer that has replaced it.
+class AsyncLogBuffer : public CHeapObj<mtLogging> {
  public:
-  LinkedListDeque() : _tail(NULL), _size(0) {}
-  void push_back(const E& e) {
-    if (!_tail) {
-      _tail = this->add(e);
-    } else {
-      _tail = this->insert_after(e, _tail);
-    }
-
-    ++_size;
-  }
-
-  // pop all elements to logs.
-  void pop_all(LinkedList<E>* logs) {
-    logs->move(static_cast<LinkedList<E>* >(this));
-    _tail = NULL;
-    _size = 0;
-  }
-
-  void pop_all(LinkedListDeque<E, F>* logs) {
-    logs->_size = _size;
-    logs->_tail = _tail;
-    pop_all(static_cast<LinkedList<E>* >(logs));
-  }
-
-  void pop_front() {
-    LinkedListNode<E>* h = this->unlink_head();
-    if (h == _tail) {
-      _tail = NULL;
+  // A message is laid out in the buffer as a Message, immediately followed by
+  // its NUL-terminated text and padded to pointer alignment. The text of a
+  // deferred message is a LogDeferredFormat record instead.
+  class Message {
+    LogFileOutput* const _output;
+    const LogDecorations _decorations;
+    const size_t _size;
+    const bool _deferred;
+
+   public:
+    Message(LogFileOutput* output, const LogDecorations& decorations, size_t size, bool deferred = false)
+      : _output(output), _decorations(decorations), _size(size), _deferred(deferred) {}
+
+    LogFileOutput* output() const { return _output; }
+    const LogDecorations& decorations() const { return _decorations; }
+    char* message() const { return (char*)(this + 1); }
+    size_t size() const { return _size; }
+    bool is_deferred() const { return _deferred; }
+
+    // The buffer space needed for a message with a payload of the given size.
+    static size_t size_for_payload(size_t payload_size) {
+      return align_up(sizeof(Message) + payload_size, sizeof(void*));
     }
-
-    if (h != NULL) {
-      --_size;
-      this->delete_node(h);
+    // The buffer space needed for a message with a text of length len.
+    static size_t size_for(size_t len) {
+      return size_for_payload(len + 1);
     }
-  }
+  };
 
-  size_t size() const { return _size; }
-
-  const E* front() const {
-    return this->_head == NULL ? NULL : this->_head->peek();
-  }
-
-  const E* back() const {
-    return _tail == NULL ? NULL : _tail->peek();
-  }
-
-  LinkedListNode<E>* head() const {
-    return this->_head;
-  }
-};
-
-class AsyncLogMessage {
-  LogFileOutput& _output;
-  const LogDecorations _decorations;
-  char* _message;
-
-public:
-  AsyncLogMessage(LogFileOutput& output, const LogDecorations& decorations, char* msg)
-    : _output(output), _decorations(decorations), _message(msg) {}
+ private:
+  static const size_t SEALED = ~(SIZE_MAX >> 1);
 
-  // placeholder for LinkedListImpl.
-  bool equals(const AsyncLogMessage& o) const { return false; }
+  char* const _buf;
+  const size_t _capacity;
+  volatile size_t _top;
+  volatile size_t _committed;
 
-  LogFileOutput* output() const { return &_output; }
-  const LogDecorations& decorations() const { return _decorations; }
-  char* message() const { return _message; }
+ public:
+  // A new buffer is sealed; it is opened with reset().
+  AsyncLogBuffer(size_t capacity);
+  ~AsyncLogBuffer();
+
+  // Reserves size bytes. Returns NULL if there is not enough room left, or if
+  // the buffer is sealed, in which case *sealed is set.
+  char* reserve(size_t size, bool* sealed);
+  // Publishes size bytes that have been reserved and written.
+  void commit(size_t size);
+
+  // Closes the buffer to further reservations, waits for the outstanding
+  // ones to be committed and returns the number of bytes used.
+  size_t seal();
+  // Empties the buffer and opens it for reservations.
+  void reset();
+
+  Message* at(size_t offset) const { return (Message*)(_buf + offset); }
+  size_t capacity() const { return _capacity; }
 };
 
-typedef LinkedListDeque<AsyncLogMessage, mtLogging> AsyncLogBuffer;
 typedef KVHashtable<LogFileOutput*, uint32_t, mtLogging> AsyncLogMap;
 
 //
@@ -134,22 +124,29 @@ typedef KVHashtable<LogFileOutput*, uint32_t, mtLogging> AsyncLogMap;
 //
 class AsyncLogWriter : public NonJavaThread {
   static AsyncLogWriter* _instance;
-  // _sem is a semaphore whose value denotes how many messages have been enqueued.
-  // It decreases in AsyncLogWriter::run()
+  // _sem is signalled when the first message is enqueued after the last flush.
+  // AsyncLogWriter::run() waits on it.
   static Semaphore _sem;
   // A lock of IO
   static Semaphore _io_sem;
 
   volatile bool _initialized;
-  AsyncLogMap _stats; // statistics for dropped messages
-  AsyncLogBuffer _buffer;
+  // Set when the flushing thread has been signalled and has not yet picked up
+  // the messages.
+  volatile int _pending;
+  AsyncLogMap _stats; // statistics for dropped messages, guarded by AsyncLogLocker
 
-  // The memory use of each AsyncLogMessage (payload) consists of itself and a variable-length c-str message.
-  // A regular logging message is smaller than vwrite_buffer_size, which is defined in logtagset.cpp
-  const size_t _buffer_max_size = {AsyncLogBufferSize / (sizeof(AsyncLogMessage) + vwrite_buffer_size)};
+  // Log sites enqueue into _buffer. The flushing thread swaps it with
+  // _staging, and drains the old buffer while the log sites fill the new one.
+  AsyncLogBuffer* volatile _buffer;
+  AsyncLogBuffer* _staging;
 
   AsyncLogWriter();
-  void enqueue_locked(const AsyncLogMessage& msg);
+  AsyncLogBuffer* reserve(size_t size, char** addr);
+  void enqueued();
+  void dropped(LogFileOutput* output, uint32_t count);
+  void write_dropped_counters();
+  void write_deferred(const AsyncLogBuffer::Message* m, bool flush_stream);
   void write();
   void run() override;
   void pre_run() override {
@@ -167,6 +164,8 @@ class AsyncLogWriter : public NonJavaThread {
  public:
   void enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg);
   void enqueue(LogFileOutput& output, LogMessageBuffer::Iterator msg_iterator);
+  // Enqueues a record of LogDeferredFormat::capture(), which is formatted by the AsyncLog Thread.
+  void enqueue_deferred(LogFileOutput& output, const LogDecorations& decorations, const char* record, size_t record_size);
 
   static AsyncLogWriter* instance();
   static void initialize();
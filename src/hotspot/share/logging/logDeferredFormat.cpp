@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "logging/logDeferredFormat.hpp"
+#include "runtime/os.hpp"
+#include "utilities/compilerWarnings.hpp"
+#include "utilities/debug.hpp"
+
+// The kind of argument a conversion consumes. The integer kinds name the
+// type that the argument is passed as after default argument promotion.
+enum LogArgKind {
+  arg_none,        // "%%"
+  arg_int,
+  arg_long,
+  arg_llong,
+  arg_intmax,
+  arg_size,
+  arg_ptrdiff,
+  arg_double,
+  arg_string,
+  arg_pointer,
+  arg_unsupported
+};
+
+// Conversions with longer specifications are not deferred.
+static const size_t max_spec_length = 32;
+
+struct LogConversionSpec {
+  const char* _begin;
+  const char* _end;
+  int _stars;        // number of '*' width and precision arguments
+  int _precision;    // -1 if none, -2 if given by a '*' argument
+  LogArgKind _kind;
+};
+
+// Parses the conversion specification at p, which points to a '%'.
+// Returns the position after it.
+static const char* parse_spec(const char* p, LogConversionSpec* spec) {
+  assert(*p == '%', "must be");
+  spec->_begin = p++;
+  spec->_stars = 0;
+  spec->_precision = -1;
+  spec->_kind = arg_unsupported;
+
+  while (*p != '\0' && strchr("-+ #0'", *p) != NULL) {
+    p++;
+  }
+  if (*p == '*') {
+    spec->_stars++;
+    p++;
+  } else {
+    while (isdigit(*p)) {
+      p++;
+    }
+  }
+  if (*p == '.') {
+    p++;
+    if (*p == '*') {
+      spec->_stars++;
+      spec->_precision = -2;
+      p++;
+    } else {
+      int precision = 0;
+      while (isdigit(*p)) {
+        precision = precision * 10 + (*p - '0');
+        p++;
+      }
+      spec->_precision = precision;
+    }
+  }
+
+  LogArgKind int_kind = arg_int;
+  bool has_length = true;
+  switch (*p) {
+    case 'h': p++; if (*p == 'h') p++; break;
+    case 'l': p++; if (*p == 'l') { p++; int_kind = arg_llong; } else { int_kind = arg_long; } break;
+    case 'j': p++; int_kind = arg_intmax; break;
+    case 'z': p++; int_kind = arg_size; break;
+    case 't': p++; int_kind = arg_ptrdiff; break;
+    case 'L': p++; int_kind = arg_unsupported; break;
+    default:  has_length = false; break;
+  }
+
+  const char c = *p;
+  if (c == '\0') {
+    spec->_end = p;
+    return p;
+  }
+  p++;
+  switch (c) {
+    case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+      spec->_kind = int_kind;
+      break;
+    case 'c':
+      spec->_kind = has_length ? arg_unsupported : arg_int;
+      break;
+    case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+      // The 'l' length is a no-op for these, 'L' denotes a long double.
+      spec->_kind = (int_kind == arg_unsupported) ? arg_unsupported : arg_double;
+      break;
+    case 's':
+      spec->_kind = has_length ? arg_unsupported : arg_string;
+      break;
+    case 'p':
+      spec->_kind = has_length ? arg_unsupported : arg_pointer;
+      break;
+    case '%':
+      spec->_kind = (p - spec->_begin == 2) ? arg_none : arg_unsupported;
+      break;
+    default:
+      break;
+  }
+  spec->_end = p;
+  if ((size_t)(p - spec->_begin) >= max_spec_length) {
+    spec->_kind = arg_unsupported;
+  }
+  return p;
+}
+
+class LogRecordWriter : public StackObj {
+  char* const _buf;
+  const size_t _buflen;
+  size_t _pos;
+  bool _overflow;
+
+ public:
+  LogRecordWriter(char* buf, size_t buflen) : _buf(buf), _buflen(buflen), _pos(0), _overflow(false) {}
+
+  void put(const void* p, size_t n) {
+    if (n > _buflen - _pos) {
+      _overflow = true;
+      _pos = _buflen;
+      return;
+    }
+    memcpy(_buf + _pos, p, n);
+    _pos += n;
+  }
+
+  void put_string(const char* s, size_t len) {
+    put(s, len);
+    put("", 1);
+  }
+
+  template <typename T>
+  void put_value(T value) {
+    put(&value, sizeof(T));
+  }
+
+  bool overflow() const { return _overflow; }
+  size_t size() const { return _pos; }
+};
+
+class LogRecordReader : public StackObj {
+  const char* _pos;
+
+ public:
+  LogRecordReader(const char* record) : _pos(record) {}
+
+  const char* get_string() {
+    const char* s = _pos;
+    _pos += strlen(s) + 1;
+    return s;
+  }
+
+  // Values are not aligned in the record.
+  template <typename T>
+  T get_value() {
+    T value;
+    memcpy(&value, _pos, sizeof(T));
+    _pos += sizeof(T);
+    return value;
+  }
+};
+
+size_t LogDeferredFormat::capture(char* buf, size_t buflen, const char* prefix, size_t prefix_len,
+                                  const char* fmt, va_list args) {
+  LogRecordWriter w(buf, buflen);
+  w.put_string(prefix, prefix_len);
+  w.put_string(fmt, strlen(fmt));
+
+  for (const char* p = fmt; *p != '\0' && !w.overflow(); ) {
+    if (*p != '%') {
+      p++;
+      continue;
+    }
+    LogConversionSpec spec;
+    p = parse_spec(p, &spec);
+
+    int precision = spec._precision;
+    for (int i = 0; i < spec._stars; i++) {
+      int star = va_arg(args, int);
+      if (i == spec._stars - 1 && precision == -2) {
+        precision = star;
+      }
+      w.put_value(star);
+    }
+
+    switch (spec._kind) {
+      case arg_none:    break;
+      case arg_int:     w.put_value(va_arg(args, int)); break;
+      case arg_long:    w.put_value(va_arg(args, long)); break;
+      case arg_llong:   w.put_value(va_arg(args, long long)); break;
+      case arg_intmax:  w.put_value(va_arg(args, intmax_t)); break;
+      case arg_size:    w.put_value(va_arg(args, size_t)); break;
+      case arg_ptrdiff: w.put_value(va_arg(args, ptrdiff_t)); break;
+      case arg_double:  w.put_value(va_arg(args, double)); break;
+      case arg_pointer: w.put_value(va_arg(args, void*)); break;
+      case arg_string: {
+        const char* s = va_arg(args, const char*);
+        if (s == NULL) {
+          s = "(null)";
+        }
+        // With a precision, the string does not need to be NUL-terminated.
+        w.put_string(s, precision >= 0 ? strnlen(s, precision) : strlen(s));
+        break;
+      }
+      default:
+        return 0;
+    }
+  }
+
+  return w.overflow() ? 0 : w.size();
+}
+
+class LogFormatWriter : public StackObj {
+  char* const _buf;
+  const size_t _buflen;
+  size_t _length;
+
+  char* dst() const { return _length < _buflen ? _buf + _length : NULL; }
+  size_t remaining() const { return _length < _buflen ? _buflen - _length : 0; }
+
+ public:
+  LogFormatWriter(char* buf, size_t buflen) : _buf(buf), _buflen(buflen), _length(0) {
+    if (buflen > 0) {
+      buf[0] = '\0';
+    }
+  }
+
+  void append(const char* s, size_t n) {
+    if (remaining() > 0) {
+      size_t copy = MIN2(n, remaining() - 1);
+      memcpy(dst(), s, copy);
+      dst()[copy] = '\0';
+    }
+    _length += n;
+  }
+
+PRAGMA_DIAG_PUSH
+PRAGMA_FORMAT_NONLITERAL_IGNORED
+  template <typename T>
+  void print(const char* spec, int stars, const int* star, T value) {
+    int ret;
+    switch (stars) {
+      case 0:  ret = os::snprintf(dst(), remaining(), spec, value); break;
+      case 1:  ret = os::snprintf(dst(), remaining(), spec, star[0], value); break;
+      default: ret = os::snprintf(dst(), remaining(), spec, star[0], star[1], value); break;
+    }
+    if (ret > 0) {
+      _length += ret;
+    }
+  }
+PRAGMA_DIAG_POP
+
+  size_t length() const { return _length; }
+};
+
+size_t LogDeferredFormat::format(const char* record, char* buf, size_t buflen) {
+  LogRecordReader r(record);
+  LogFormatWriter out(buf, buflen);
+  const char* prefix = r.get_string();
+  const char* fmt = r.get_string();
+  out.append(prefix, strlen(prefix));
+
+  for (const char* p = fmt; *p != '\0'; ) {
+    if (*p != '%') {
+      const char* q = strchr(p, '%');
+      size_t n = (q == NULL) ? strlen(p) : (size_t)(q - p);
+      out.append(p, n);
+      p += n;
+      continue;
+    }
+    LogConversionSpec spec;
+    p = parse_spec(p, &spec);
+    char s[max_spec_length];
+    size_t spec_len = spec._end - spec._begin;
+    memcpy(s, spec._begin, spec_len);
+    s[spec_len] = '\0';
+
+    int star[2] = { 0, 0 };
+    for (int i = 0; i < spec._stars; i++) {
+      star[i] = r.get_value<int>();
+    }
+
+    switch (spec._kind) {
+      case arg_none:    out.append("%", 1); break;
+      case arg_int:     out.print(s, spec._stars, star, r.get_value<int>()); break;
+      case arg_long:    out.print(s, spec._stars, star, r.get_value<long>()); break;
+      case arg_llong:   out.print(s, spec._stars, star, r.get_value<long long>()); break;
+      case arg_intmax:  out.print(s, spec._stars, star, r.get_value<intmax_t>()); break;
+      case arg_size:    out.print(s, spec._stars, star, r.get_value<size_t>()); break;
+      case arg_ptrdiff: out.print(s, spec._stars, star, r.get_value<ptrdiff_t>()); break;
+      case arg_double:  out.print(s, spec._stars, star, r.get_value<double>()); break;
+      case arg_pointer: out.print(s, spec._stars, star, r.get_value<void*>()); break;
+      case arg_string:  out.print(s, spec._stars, star, r.get_string()); break;
+      default:
+        ShouldNotReachHere();
+    }
+  }
+
+  return out.length();
+}
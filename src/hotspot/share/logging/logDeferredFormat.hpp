@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_LOGGING_LOGDEFERREDFORMAT_HPP
+#define SHARE_LOGGING_LOGDEFERREDFORMAT_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// Deferred formatting of log messages, see AsyncLogDeferredFormatting.
+//
+// capture() records the prefix, the format string and the raw arguments of a
+// log message at the log site, without formatting it. Strings are copied, so
+// the record does not refer to memory of the log site. format() produces the
+// same text as vsnprintf would have, typically on the AsyncLog Thread.
+//
+// The conversions of the C99 printf family are supported, except for 'n',
+// long double and wide characters. Messages that use them, or do not fit the
+// record buffer, are formatted eagerly instead.
+class LogDeferredFormat : AllStatic {
+ public:
+  // Records the message into buf. Returns the size of the record, or 0 if
+  // the message cannot be deferred.
+  ATTRIBUTE_PRINTF(5, 0)
+  static size_t capture(char* buf, size_t buflen, const char* prefix, size_t prefix_len,
+                        const char* fmt, va_list args);
+
+  // Formats a record into buf, truncating it if needed. Returns the length
+  // of the full text, like vsnprintf.
+  static size_t format(const char* record, char* buf, size_t buflen);
+};
+
+#endif // SHARE_LOGGING_LOGDEFERREDFORMAT_HPP
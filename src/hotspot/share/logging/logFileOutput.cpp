@@ -298,14 +298,15 @@ class RotationLocker : public StackObj {
   }
 };
 
-int LogFileOutput::write_blocking(const LogDecorations& decorations, const char* msg) {
+int LogFileOutput::write_blocking(const LogDecorations& decorations, const char* msg, bool flush_stream) {
   RotationLocker lock(_rotation_semaphore);
   if (_stream == NULL) {
     // An error has occurred with this output, avoid writing to it.
     return 0;
   }
 
-  int written = LogFileStreamOutput::write(decorations, msg);
+  int written = flush_stream ? LogFileStreamOutput::write(decorations, msg)
+                             : LogFileStreamOutput::write_unflushed(decorations, msg);
   if (written > 0) {
     _current_size += written;
 
@@ -317,6 +318,13 @@ int LogFileOutput::write_blocking(const LogDecorations& decorations, const char*
   return written;
 }
 
+void LogFileOutput::flush_blocking() {
+  RotationLocker lock(_rotation_semaphore);
+  if (_stream != NULL) {
+    flush();
+  }
+}
+
 int LogFileOutput::write(const LogDecorations& decorations, const char* msg) {
   if (_stream == NULL) {
     // An error has occurred with this output, avoid writing to it.
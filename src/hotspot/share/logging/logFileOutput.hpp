@@ -85,7 +85,9 @@ class LogFileOutput : public LogFileStreamOutput {
   virtual bool initialize(const char* options, outputStream* errstream);
   virtual int write(const LogDecorations& decorations, const char* msg);
   virtual int write(LogMessageBuffer::Iterator msg_iterator);
-  int write_blocking(const LogDecorations& decorations, const char* msg);
+  // With flush_stream false, the caller has to call flush_blocking() later on.
+  int write_blocking(const LogDecorations& decorations, const char* msg, bool flush_stream = true);
+  void flush_blocking();
   virtual void force_rotate();
   virtual void describe(outputStream* out);
 
@@ -117,7 +117,7 @@ bool LogFileStreamOutput::flush() {
   total += result;                                            \
 }
 
-int LogFileStreamOutput::write(const LogDecorations& decorations, const char* msg) {
+int LogFileStreamOutput::write_unflushed(const LogDecorations& decorations, const char* msg) {
   const bool use_decorations = !_decorators.is_empty();
 
   int written = 0;
@@ -128,6 +128,14 @@ int LogFileStreamOutput::write(const LogDecorations& decorations, const char* ms
   }
   WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, "%s\n", msg), written);
 
+  return written;
+}
+
+int LogFileStreamOutput::write(const LogDecorations& decorations, const char* msg) {
+  int written = write_unflushed(decorations, msg);
+  if (written < 0) {
+    return -1;
+  }
   return flush() ? written : -1;
 }
 
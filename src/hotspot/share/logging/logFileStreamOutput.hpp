@@ -53,6 +53,8 @@ class LogFileStreamOutput : public LogOutput {
   }
 
   int write_decorations(const LogDecorations& decorations);
+  // Writes a message like write() below, but leaves it to the caller to flush the stream.
+  int write_unflushed(const LogDecorations& decorations, const char* msg);
   bool flush();
 
  public:
@@ -23,7 +23,10 @@
  */
 #include "precompiled.hpp"
 #include "jvm.h"
+#include "logging/logAsyncWriter.hpp"
 #include "logging/logDecorations.hpp"
+#include "logging/logDeferredFormat.hpp"
+#include "logging/logFileOutput.hpp"
 #include "logging/logFileStreamOutput.hpp"
 #include "logging/logLevel.hpp"
 #include "logging/logMessageBuffer.hpp"
@@ -32,6 +35,7 @@
 #include "logging/logTagSet.hpp"
 #include "logging/logTagSetDescriptions.hpp"
 #include "memory/allocation.inline.hpp"
+#include "runtime/globals.hpp"
 #include "utilities/ostream.hpp"
 
 LogTagSet*  LogTagSet::_list      = NULL;
@@ -111,8 +115,52 @@ void LogTagSet::write(LogLevelType level, const char* fmt, ...) {
 
 const size_t vwrite_buffer_size = 512;
 
+// Hands the message over to the AsyncLog Thread for formatting, see
+// AsyncLogDeferredFormatting. This is only possible if all outputs of
+// the message are asynchronous, that is if none is stdout or stderr.
+// Returns false if the message has to be formatted by the caller.
+bool LogTagSet::vwrite_deferred(LogLevelType level, const char* fmt, va_list args) {
+  AsyncLogWriter* writer = AsyncLogWriter::instance();
+  if (writer == nullptr) {
+    return false;
+  }
+  for (LogOutputList::Iterator it = _output_list.iterator(level); it != _output_list.end(); it++) {
+    if (*it == &StdoutLog || *it == &StderrLog) {
+      return false;
+    }
+  }
+
+  char prefix[vwrite_buffer_size];
+  size_t prefix_len = _write_prefix(prefix, sizeof(prefix));
+  if (prefix_len >= sizeof(prefix)) {
+    return false;
+  }
+  char record[vwrite_buffer_size];
+  size_t size = LogDeferredFormat::capture(record, sizeof(record), prefix, prefix_len, fmt, args);
+  if (size == 0) {
+    return false;
+  }
+
+  LogDecorations decorations(level, *this, _decorators);
+  for (LogOutputList::Iterator it = _output_list.iterator(level); it != _output_list.end(); it++) {
+    // All outputs other than stdout and stderr are file outputs.
+    writer->enqueue_deferred(*static_cast<LogFileOutput*>(*it), decorations, record, size);
+  }
+  return true;
+}
+
 void LogTagSet::vwrite(LogLevelType level, const char* fmt, va_list args) {
   assert(level >= LogLevel::First && level <= LogLevel::Last, "Log level:%d is incorrect", level);
+  if (AsyncLogDeferredFormatting) {
+    va_list deferred_args;
+    va_copy(deferred_args, args);
+    bool deferred = vwrite_deferred(level, fmt, deferred_args);
+    va_end(deferred_args);
+    if (deferred) {
+      return;
+    }
+  }
+
   char buf[vwrite_buffer_size];
   va_list saved_args;           // For re-format on buf overflow.
   va_copy(saved_args, args);
@@ -60,6 +60,9 @@ class LogTagSet {
   // and their configurations to reflect the new global log configuration.
   LogTagSet(PrefixWriter prefix_writer, LogTagType t0, LogTagType t1, LogTagType t2, LogTagType t3, LogTagType t4);
 
+  ATTRIBUTE_PRINTF(3, 0)
+  bool vwrite_deferred(LogLevelType level, const char* fmt, va_list args);
+
   template <LogTagType T0, LogTagType T1, LogTagType T2, LogTagType T3, LogTagType T4, LogTagType GuardTag>
   friend class LogTagSetMapping;
 
@@ -26,9 +26,13 @@
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/nonJavaThread.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/threadCritical.hpp"
+#include "runtime/threadSMR.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/ostream.hpp"
 
@@ -42,6 +46,7 @@ class ChunkPool: public CHeapObj<mtInternal> {
   size_t       _num_chunks;   // number of unused chunks in pool
   size_t       _num_used;     // number of chunks currently checked out
   const size_t _size;         // size of each chunk (must be uniform)
+  const int    _index;        // slot of this pool in a ChunkCache
 
   // Our four static pools
   static ChunkPool* _large_pool;
@@ -59,13 +64,30 @@ class ChunkPool: public CHeapObj<mtInternal> {
     return c;
   }
 
+  // The chunk cache of the current thread, if any.
+  static ChunkCache* current_cache() {
+    if (!UseThreadLocalChunkCache) {
+      return NULL;
+    }
+    Thread* thread = Thread::current_or_null();
+    return thread != NULL ? thread->chunk_cache() : NULL;
+  }
+
  public:
   // All chunks in a ChunkPool has the same size
-   ChunkPool(size_t size) : _size(size) { _first = NULL; _num_chunks = _num_used = 0; }
+   ChunkPool(size_t size, int index) : _size(size), _index(index) { _first = NULL; _num_chunks = _num_used = 0; }
 
   // Allocate a new chunk from the pool (might expand the pool)
   NOINLINE void* allocate(size_t bytes, AllocFailType alloc_failmode) {
     assert(bytes == _size, "bad size");
+    ChunkCache* cache = current_cache();
+    if (cache != NULL) {
+      // A cached chunk is still accounted as used by this pool.
+      void* c = cache->take(_index);
+      if (c != NULL) {
+        return c;
+      }
+    }
     void* p = NULL;
     // No VM lock can be taken inside ThreadCritical lock, so os::malloc
     // should be done outside ThreadCritical lock due to NMT
@@ -83,6 +105,15 @@ class ChunkPool: public CHeapObj<mtInternal> {
   // Return a chunk to the pool
   void free(Chunk* chunk) {
     assert(chunk->length() + Chunk::aligned_overhead_size() == _size, "bad size");
+    ChunkCache* cache = current_cache();
+    if (cache != NULL && cache->put(_index, chunk)) {
+      return;
+    }
+    return_chunk(chunk);
+  }
+
+  // Return a chunk to the pool, bypassing the thread's chunk cache
+  void return_chunk(Chunk* chunk) {
     ThreadCritical tc;
     _num_used--;
 
@@ -128,11 +159,22 @@ class ChunkPool: public CHeapObj<mtInternal> {
   static ChunkPool* small_pool()  { assert(_small_pool  != NULL, "must be initialized"); return _small_pool;  }
   static ChunkPool* tiny_pool()   { assert(_tiny_pool   != NULL, "must be initialized"); return _tiny_pool;   }
 
+  static ChunkPool* pool_at(int index) {
+    switch (index) {
+      case 0:  return large_pool();
+      case 1:  return medium_pool();
+      case 2:  return small_pool();
+      case 3:  return tiny_pool();
+      default: ShouldNotReachHere(); return NULL;
+    }
+  }
+
   static void initialize() {
-    _large_pool  = new ChunkPool(Chunk::size        + Chunk::aligned_overhead_size());
-    _medium_pool = new ChunkPool(Chunk::medium_size + Chunk::aligned_overhead_size());
-    _small_pool  = new ChunkPool(Chunk::init_size   + Chunk::aligned_overhead_size());
-    _tiny_pool   = new ChunkPool(Chunk::tiny_size   + Chunk::aligned_overhead_size());
+    STATIC_ASSERT(ChunkCache::num_pools == 4);
+    _large_pool  = new ChunkPool(Chunk::size        + Chunk::aligned_overhead_size(), 0);
+    _medium_pool = new ChunkPool(Chunk::medium_size + Chunk::aligned_overhead_size(), 1);
+    _small_pool  = new ChunkPool(Chunk::init_size   + Chunk::aligned_overhead_size(), 2);
+    _tiny_pool   = new ChunkPool(Chunk::tiny_size   + Chunk::aligned_overhead_size(), 3);
   }
 
   static void clean() {
@@ -153,6 +195,56 @@ void chunkpool_init() {
   ChunkPool::initialize();
 }
 
+//--------------------------------------------------------------------------------------
+// ChunkCache implementation
+
+ChunkCache::ChunkCache() {
+  for (int i = 0; i < num_pools; i++) {
+    _chunks[i] = NULL;
+  }
+}
+
+ChunkCache::~ChunkCache() {
+  flush();
+}
+
+Chunk* ChunkCache::take(int pool_index) {
+  if (Atomic::load(&_chunks[pool_index]) == NULL) {
+    return NULL;
+  }
+  // The cleaner may concurrently flush the slot.
+  return Atomic::xchg(&_chunks[pool_index], (Chunk*)NULL);
+}
+
+bool ChunkCache::put(int pool_index, Chunk* chunk) {
+  return Atomic::load(&_chunks[pool_index]) == NULL &&
+         Atomic::cmpxchg(&_chunks[pool_index], (Chunk*)NULL, chunk) == NULL;
+}
+
+void ChunkCache::flush() {
+  for (int i = 0; i < num_pools; i++) {
+    Chunk* chunk = take(i);
+    if (chunk != NULL) {
+      ChunkPool::pool_at(i)->return_chunk(chunk);
+    }
+  }
+}
+
+void ChunkCache::flush_all() {
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* thread = jtiwh.next(); ) {
+    ChunkCache* cache = thread->chunk_cache();
+    if (cache != NULL) {
+      cache->flush();
+    }
+  }
+  for (NonJavaThread::Iterator njti; !njti.end(); njti.step()) {
+    ChunkCache* cache = njti.current()->chunk_cache();
+    if (cache != NULL) {
+      cache->flush();
+    }
+  }
+}
+
 
 //--------------------------------------------------------------------------------------
 // ChunkPoolCleaner implementation
@@ -164,6 +256,9 @@ class ChunkPoolCleaner : public PeriodicTask {
  public:
    ChunkPoolCleaner() : PeriodicTask(CleaningInterval) {}
    void task() {
+     if (UseThreadLocalChunkCache) {
+       ChunkCache::flush_all();
+     }
      ChunkPool::clean();
    }
 };
@@ -323,6 +418,10 @@ void Arena::set_size_in_bytes(size_t size) {
     ssize_t delta = size - size_in_bytes();
     _size_in_bytes = size;
     MemTracker::record_arena_size_change(delta, _flags);
+    Thread* thread = Thread::current_or_null();
+    if (thread != NULL) {
+      thread->update_arena_bytes(delta);
+    }
   }
 }
 
@@ -87,6 +87,33 @@ class Chunk: CHeapObj<mtChunk> {
   static void start_chunk_pool_cleaner_task();
 };
 
+//------------------------------ChunkCache-------------------------------------
+// Per-thread cache of at most one chunk for each of the pooled chunk sizes,
+// used when UseThreadLocalChunkCache is set. Arena growth and chopping by
+// the owning thread is then mostly served without taking ThreadCritical.
+// The chunk pool cleaner periodically returns cached chunks to the pools.
+class ChunkCache : public CHeapObj<mtChunk> {
+ public:
+  enum { num_pools = 4 };
+
+ private:
+  Chunk* volatile _chunks[num_pools];
+
+ public:
+  ChunkCache();
+  ~ChunkCache();
+
+  // Take the cached chunk of the given pool, or NULL.
+  Chunk* take(int pool_index);
+  // Cache the chunk; returns false if this pool's slot is already taken.
+  bool put(int pool_index, Chunk* chunk);
+  // Return all cached chunks to the global pools.
+  void flush();
+
+  // Flush the caches of all threads.
+  static void flush_all();
+};
+
 //------------------------------Arena------------------------------------------
 // Fast allocation of memory
 class Arena : public CHeapObj<mtNone> {
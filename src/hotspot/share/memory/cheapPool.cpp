@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "memory/allocation.inline.hpp"
+#include "memory/cheapPool.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/thread.hpp"
+#include "services/nmtCommon.hpp"
+
+CHeapPool::Pool CHeapPool::_pools[mt_number_of_types][CHeapPool::NumSizeClasses];
+
+bool CHeapPool::is_pooled(size_t size) {
+  return UsePooledCHeapObjs && size > 0 && size <= MaxPooledSize;
+}
+
+CHeapPool::Pool* CHeapPool::pool_for(size_t size, MEMFLAGS flag) {
+  assert(is_pooled(size), "not a pooled size: " SIZE_FORMAT, size);
+  return &_pools[NMTUtil::flag_to_index(flag)][size_class(size)];
+}
+
+void* CHeapPool::allocate_from_new_slab(Pool* pool, size_t block_size, MEMFLAGS flag) {
+  char* slab = AllocateHeap(SlabSize, flag);
+  size_t count = SlabSize / block_size;
+  assert(count > 1, "slab too small");
+
+  // The first block goes to the caller, the rest onto the free list.
+  Block* first = (Block*)(slab + block_size);
+  Block* last = first;
+  for (size_t i = 2; i < count; i++) {
+    Block* block = (Block*)(slab + i * block_size);
+    last->_next = block;
+    last = block;
+  }
+
+  Thread::SpinAcquire(&pool->_lock, "CHeapPool");
+  last->_next = pool->_free_list;
+  pool->_free_list = first;
+  Thread::SpinRelease(&pool->_lock);
+
+  return slab;
+}
+
+void* CHeapPool::allocate(size_t size, MEMFLAGS flag) {
+  if (!is_pooled(size)) {
+    return AllocateHeap(size, flag);
+  }
+
+  Pool* pool = pool_for(size, flag);
+  Thread::SpinAcquire(&pool->_lock, "CHeapPool");
+  Block* block = pool->_free_list;
+  if (block != NULL) {
+    pool->_free_list = block->_next;
+  }
+  Thread::SpinRelease(&pool->_lock);
+
+  if (block == NULL) {
+    return allocate_from_new_slab(pool, (size_class(size) + 1) * SizeClassGranule, flag);
+  }
+  return block;
+}
+
+void CHeapPool::free(void* p, size_t size, MEMFLAGS flag) {
+  if (p == NULL) {
+    return;
+  }
+  if (!is_pooled(size)) {
+    FreeHeap(p);
+    return;
+  }
+
+  Pool* pool = pool_for(size, flag);
+  Block* block = (Block*)p;
+  Thread::SpinAcquire(&pool->_lock, "CHeapPool");
+  block->_next = pool->_free_list;
+  pool->_free_list = block;
+  Thread::SpinRelease(&pool->_lock);
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#ifndef SHARE_MEMORY_CHEAPPOOL_HPP
+#define SHARE_MEMORY_CHEAPPOOL_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// Size-class pools for small C-heap objects that are allocated and freed
+// at a high rate.
+//
+// Every MEMFLAGS type has its own free list per size class. Blocks are
+// carved out of slabs allocated with AllocateHeap under the same MEMFLAGS,
+// so NMT still attributes the memory to its owner, at slab granularity.
+// Freed blocks go back onto their free list and are never returned to the
+// C heap. Requests larger than the largest size class, and all requests
+// when UsePooledCHeapObjs is off, are forwarded to AllocateHeap/FreeHeap.
+class CHeapPool : AllStatic {
+ public:
+  static const size_t SizeClassGranule = 16;
+  static const size_t NumSizeClasses   = 32;
+  static const size_t MaxPooledSize    = SizeClassGranule * NumSizeClasses;
+  static const size_t SlabSize         = 4 * K;
+
+ private:
+  struct Block {
+    Block* _next;
+  };
+
+  struct Pool {
+    volatile int _lock;
+    Block*       _free_list;
+  };
+
+  static Pool _pools[mt_number_of_types][NumSizeClasses];
+
+  static bool    is_pooled(size_t size);
+  static size_t size_class(size_t size) { return (size - 1) / SizeClassGranule; }
+  static Pool*   pool_for(size_t size, MEMFLAGS flag);
+
+  static void*   allocate_from_new_slab(Pool* pool, size_t block_size, MEMFLAGS flag);
+
+ public:
+  static void* allocate(size_t size, MEMFLAGS flag);
+  static void  free(void* p, size_t size, MEMFLAGS flag);
+};
+
+// Base class for objects allocated from CHeapPool. Deallocation needs the
+// size of the object, so subclasses deleted through a base class pointer
+// must have a virtual destructor.
+template <MEMFLAGS F> class PooledCHeapObj ALLOCATION_SUPER_CLASS_SPEC {
+ public:
+  ALWAYSINLINE void* operator new(size_t size) throw() {
+    return CHeapPool::allocate(size, F);
+  }
+
+  void operator delete(void* p, size_t size) { CHeapPool::free(p, size, F); }
+};
+
+#endif // SHARE_MEMORY_CHEAPPOOL_HPP
@@ -139,6 +139,15 @@ void ClassLoaderMetaspace::deallocate(MetaWord* ptr, size_t word_size, bool is_c
   DEBUG_ONLY(InternalStats::inc_num_deallocs();)
 }
 
+void ClassLoaderMetaspace::trim_if_quiescent() {
+  if (non_class_space_arena() != NULL) {
+    non_class_space_arena()->trim_if_quiescent();
+  }
+  if (class_space_arena() != NULL) {
+    class_space_arena()->trim_if_quiescent();
+  }
+}
+
 // Update statistics. This walks all in-use chunks.
 void ClassLoaderMetaspace::add_to_statistics(metaspace::ClmsStats* out) const {
   if (non_class_space_arena() != NULL) {
@@ -94,6 +94,10 @@ public:
   // because it is not needed anymore.
   void deallocate(MetaWord* ptr, size_t word_size, bool is_class);
 
+  // Uncommit unused committed space of the arenas that did not allocate since
+  // the last call, see MetaspaceTrimQuiescentArenas.
+  void trim_if_quiescent();
+
   // Update statistics. This walks all in-use chunks.
   void add_to_statistics(metaspace::ClmsStats* out) const;
 
@@ -620,20 +620,24 @@ void HeapInspection::heap_inspection(outputStream* st, uint parallel_thread_num)
                                missed_count);
     }
 
-    // Sort and print klass instance info
-    KlassInfoHisto histo(&cit);
-    HistoClosure hc(&histo);
-
-    cit.iterate(&hc);
-
-    histo.sort();
-    histo.print_histo_on(st);
+    print_histogram(&cit, st);
   } else {
     st->print_cr("ERROR: Ran out of C-heap; histogram not generated");
   }
   st->flush();
 }
 
+void HeapInspection::print_histogram(KlassInfoTable* cit, outputStream* st) {
+  // Sort and print klass instance info
+  KlassInfoHisto histo(cit);
+  HistoClosure hc(&histo);
+
+  cit->iterate(&hc);
+
+  histo.sort();
+  histo.print_histo_on(st);
+}
+
 class FindInstanceClosure : public ObjectClosure {
  private:
   Klass* _klass;
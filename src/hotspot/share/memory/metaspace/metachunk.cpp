@@ -152,6 +152,26 @@ void Metachunk::uncommit_locked() {
     _committed_words = 0;
   }
 }
+
+size_t Metachunk::uncommit_free_tail() {
+  // Chunks smaller than a commit granule share their granule with their neighbors.
+  if (word_size() < Settings::commit_granule_words()) {
+    return 0;
+  }
+  MutexLocker cl(Metaspace_lock, Mutex::_no_safepoint_check_flag);
+  assert(_state == State::InUse, "Only in-use chunks have a free tail "
+         "(chunk " METACHUNK_FULL_FORMAT ").", METACHUNK_FULL_FORMAT_ARGS(this));
+  const size_t new_committed_words = align_up(_used_words, Settings::commit_granule_words());
+  if (new_committed_words >= _committed_words) {
+    return 0;
+  }
+  const size_t uncommitted_words = _committed_words - new_committed_words;
+  _vsnode->uncommit_range(base() + new_committed_words, uncommitted_words);
+  _committed_words = new_committed_words;
+  DEBUG_ONLY(verify();)
+  return uncommitted_words;
+}
+
 void Metachunk::set_committed_words(size_t v) {
   // Set committed words. Since we know that we only commit whole commit granules, we can round up v here.
   v = MIN2(align_up(v, Settings::commit_granule_words()), word_size());
@@ -312,6 +312,10 @@ public:
   void uncommit();
   void uncommit_locked();
 
+  // Uncommit the committed granules above the used area of an in-use chunk.
+  // Returns the number of uncommitted words.
+  size_t uncommit_free_tail();
+
   // Allocation from a chunk
 
   // Allocate word_size words from this chunk (word_size must be aligned to
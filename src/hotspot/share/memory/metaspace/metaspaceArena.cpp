@@ -41,6 +41,7 @@
 #include "runtime/atomic.hpp"
 #include "runtime/init.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/thread.hpp"
 #include "services/memoryService.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
@@ -121,6 +122,8 @@ MetaspaceArena::MetaspaceArena(ChunkManager* chunk_manager, const ArenaGrowthPol
   _growth_policy(growth_policy),
   _chunks(),
   _fbl(NULL),
+  _windows(NULL),
+  _allocated_since_trim(true),
   _total_used_words_counter(total_used_words_counter),
   _name(name)
 {
@@ -161,6 +164,8 @@ MetaspaceArena::~MetaspaceArena() {
   _total_used_words_counter->decrement_by(return_counter.total_size());
   DEBUG_ONLY(chunk_manager()->verify();)
   delete _fbl;
+  // The windows point into the chunks returned above.
+  FREE_C_HEAP_ARRAY(AllocationWindow, _windows);
   UL(debug, ": dies.");
 
   // Update statistics
@@ -223,7 +228,85 @@ bool MetaspaceArena::attempt_enlarge_current_chunk(size_t requested_word_size) {
 // 4) Attempt to get a new chunk and allocate from that chunk.
 // At any point, if we hit a commit limit, we return NULL.
 MetaWord* MetaspaceArena::allocate(size_t requested_word_size) {
+  if (use_allocation_windows(requested_word_size)) {
+    AllocationWindow* windows = Atomic::load_acquire(&_windows);
+    if (windows == NULL) {
+      if (lock()->try_lock()) {
+        MetaWord* p = allocate_locked(requested_word_size);
+        lock()->unlock();
+        return p;
+      }
+      // Another thread allocates from this arena right now. From now on,
+      // serve small allocations from the allocation windows.
+      windows = create_allocation_windows();
+    }
+    return allocate_from_window(windows, requested_word_size);
+  }
   MutexLocker cl(lock(), Mutex::_no_safepoint_check_flag);
+  return allocate_locked(requested_word_size);
+}
+
+bool MetaspaceArena::use_allocation_windows(size_t requested_word_size) {
+  // Only allocations much smaller than a window are worth it; the guards are
+  // established by allocate_locked and cannot be used with the windows.
+  return MetaspaceAllocationWindowSize > 0 && !Settings::use_allocation_guard() &&
+         requested_word_size > 0 && requested_word_size <= MetaspaceAllocationWindowSize / BytesPerWord / 8;
+}
+
+MetaspaceArena::AllocationWindow* MetaspaceArena::create_allocation_windows() {
+  MutexLocker cl(lock(), Mutex::_no_safepoint_check_flag);
+  if (_windows == NULL) {
+    AllocationWindow* windows = NEW_C_HEAP_ARRAY(AllocationWindow, num_allocation_windows, mtClass);
+    for (int i = 0; i < num_allocation_windows; i++) {
+      windows[i]._lock = 0;
+      windows[i]._top = NULL;
+      windows[i]._end = NULL;
+    }
+    UL(debug, "created allocation windows.");
+    Atomic::release_store(&_windows, windows);
+  }
+  return _windows;
+}
+
+MetaWord* MetaspaceArena::allocate_from_window(AllocationWindow* windows, size_t requested_word_size) {
+  const size_t raw_word_size = get_raw_word_size_for_requested_word_size(requested_word_size);
+  const uintptr_t hash = (uintptr_t)Thread::current();
+  AllocationWindow* w = windows + ((hash >> 6) ^ (hash >> 12)) % num_allocation_windows;
+
+  Thread::SpinAcquire(&w->_lock, "MetaspaceArena window");
+  MetaWord* p = NULL;
+  if (w->_top != NULL && pointer_delta(w->_end, w->_top, BytesPerWord) >= raw_word_size) {
+    p = w->_top;
+    w->_top += raw_word_size;
+  } else {
+    MutexLocker cl(lock(), Mutex::_no_safepoint_check_flag);
+    // Give the rest of the window back. Like the free blocks list, the window
+    // counts as used already.
+    if (w->_top != NULL) {
+      size_t remaining_words = pointer_delta(w->_end, w->_top, BytesPerWord);
+      if (Settings::handle_deallocations() && remaining_words > FreeBlocks::MinWordSize) {
+        add_allocation_to_fbl(w->_top, remaining_words);
+      }
+      w->_top = w->_end = NULL;
+    }
+    const size_t window_word_size = MetaspaceAllocationWindowSize / BytesPerWord;
+    MetaWord* window = allocate_locked(window_word_size);
+    if (window != NULL) {
+      p = window;
+      w->_top = window + raw_word_size;
+      w->_end = window + window_word_size;
+    } else {
+      // We may still be able to allocate the requested size.
+      p = allocate_locked(requested_word_size);
+    }
+  }
+  Thread::SpinRelease(&w->_lock);
+  return p;
+}
+
+// Allocate memory from Metaspace with the arena lock held.
+MetaWord* MetaspaceArena::allocate_locked(size_t requested_word_size) {
+  assert_lock_strong(lock());
   UL2(trace, "requested " SIZE_FORMAT " words.", requested_word_size);
 
   MetaWord* p = NULL;
@@ -323,6 +406,7 @@ MetaWord* MetaspaceArena::allocate(size_t requested_word_size) {
   } else {
     DEBUG_ONLY(InternalStats::inc_num_allocs();)
     _total_used_words_counter->increment_by(raw_word_size);
+    _allocated_since_trim = true;
   }
 
   SOMETIMES(verify_locked();)
@@ -367,6 +451,27 @@ void MetaspaceArena::deallocate(MetaWord* p, size_t word_size) {
   deallocate_locked(p, word_size);
 }
 
+// Uncommit the unused committed space of the current chunk if nothing has been
+// allocated from this arena since the last call. Retired chunks have no such
+// space, it has been moved to the free block list by salvage_chunk().
+void MetaspaceArena::trim_if_quiescent() {
+  if (!Settings::uncommit_free_chunks()) {
+    return;
+  }
+  MutexLocker cl(lock(), Mutex::_no_safepoint_check_flag);
+  if (_allocated_since_trim) {
+    _allocated_since_trim = false;
+    return;
+  }
+  if (current_chunk() != NULL) {
+    size_t uncommitted_words = current_chunk()->uncommit_free_tail();
+    if (uncommitted_words > 0) {
+      UL2(debug, "uncommitted " SIZE_FORMAT " words of current chunk " METACHUNK_FORMAT ".",
+          uncommitted_words, METACHUNK_FORMAT_ARGS(current_chunk()));
+    }
+  }
+}
+
 // Update statistics. This walks all in-use chunks.
 void MetaspaceArena::add_to_statistics(ArenaStats* out) const {
   MutexLocker cl(lock(), Mutex::_no_safepoint_check_flag);
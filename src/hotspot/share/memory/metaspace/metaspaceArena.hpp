@@ -98,6 +98,23 @@ class MetaspaceArena : public CHeapObj<mtClass> {
   // Owned by the Arena. Gets allocated on demand only.
   FreeBlocks* _fbl;
 
+  // With MetaspaceAllocationWindowSize, an arena that is found contended gets a
+  //  small set of allocation windows. Each window is a slice of the current chunk
+  //  which is handed out by pointer bump under its own spin lock. Threads are
+  //  mapped to windows by their address, so threads allocating concurrently
+  //  mostly use different windows and only take the arena lock to refill them.
+  //  The unused rest of a window goes to the free block list when it is refilled.
+  struct AllocationWindow {
+    volatile int _lock;
+    MetaWord* _top;
+    MetaWord* _end;
+  };
+  static const int num_allocation_windows = 8;
+  AllocationWindow* volatile _windows;
+
+  // Set by every allocation from a chunk, cleared by trim_if_quiescent().
+  bool _allocated_since_trim;
+
   Metachunk* current_chunk()              { return _chunks.first(); }
   const Metachunk* current_chunk() const  { return _chunks.first(); }
 
@@ -134,6 +151,14 @@ class MetaspaceArena : public CHeapObj<mtClass> {
   // because it is not needed anymore (requires CLD lock to be active).
   void deallocate_locked(MetaWord* p, size_t word_size);
 
+  // Allocate memory from Metaspace with the arena lock held, see allocate().
+  MetaWord* allocate_locked(size_t requested_word_size);
+
+  // Allocation windows support.
+  static bool use_allocation_windows(size_t requested_word_size);
+  AllocationWindow* create_allocation_windows();
+  MetaWord* allocate_from_window(AllocationWindow* windows, size_t requested_word_size);
+
   // Returns true if the area indicated by pointer and size have actually been allocated
   // from this arena.
   DEBUG_ONLY(bool is_valid_area(MetaWord* p, size_t word_size) const;)
@@ -158,6 +183,10 @@ public:
   // needed anymore.
   void deallocate(MetaWord* p, size_t word_size);
 
+  // Uncommit the unused committed space of the current chunk if nothing has been
+  // allocated from this arena since the last call.
+  void trim_if_quiescent();
+
   // Update statistics. This walks all in-use chunks.
   void add_to_statistics(ArenaStats* out) const;
 
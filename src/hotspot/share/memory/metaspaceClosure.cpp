@@ -95,12 +95,13 @@ MetaspaceClosure::~MetaspaceClosure() {
 
 bool UniqueMetaspaceClosure::do_ref(MetaspaceClosure::Ref* ref, bool read_only) {
   bool created;
-  _has_been_visited.add_if_absent(ref->obj(), read_only, &created);
+  unsigned old_capacity = _has_been_visited.capacity();
+  _has_been_visited.put_if_absent(ref->obj(), read_only, &created);
   if (!created) {
     return false; // Already visited: no need to iterate embedded pointers.
   } else {
-    if (_has_been_visited.maybe_grow(MAX_TABLE_SIZE)) {
-      log_info(cds, hashtables)("Expanded _has_been_visited table to %d", _has_been_visited.table_size());
+    if (_has_been_visited.capacity() != old_capacity) {
+      log_info(cds, hashtables)("Expanded _has_been_visited table to %u", _has_been_visited.capacity());
     }
     return do_unique_ref(ref, read_only);
   }
@@ -33,6 +33,7 @@
 #include "utilities/growableArray.hpp"
 #include "utilities/hashtable.inline.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/openHashtable.hpp"
 #include <type_traits>
 
 // The metadata hierarchy is separate from the oop hierarchy
@@ -385,7 +386,6 @@ public:
 // This is a special MetaspaceClosure that visits each unique MetaspaceObj once.
 class UniqueMetaspaceClosure : public MetaspaceClosure {
   static const int INITIAL_TABLE_SIZE = 15889;
-  static const int MAX_TABLE_SIZE     = 1000000;
 
   // Do not override. Returns true if we are discovering ref->obj() for the first time.
   virtual bool do_ref(Ref* ref, bool read_only);
@@ -396,7 +396,8 @@ public:
   UniqueMetaspaceClosure() : _has_been_visited(INITIAL_TABLE_SIZE) {}
 
 private:
-  KVHashtable<address, bool, mtInternal> _has_been_visited;
+  OpenHashtable<address, bool, primitive_hash<address>, primitive_equals<address>,
+                ResourceObj::C_HEAP, mtInternal> _has_been_visited;
 };
 
 #endif // SHARE_MEMORY_METASPACECLOSURE_HPP
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "cds/heapShared.hpp"
+#include "classfile/systemDictionaryShared.hpp"
 #include "classfile/resolutionErrors.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
@@ -78,6 +79,22 @@ void ConstantPoolCacheEntry::reinitialize(bool f2_used) {
   }
 }
 
+#if INCLUDE_CDS
+// Only called for the entries accepted by ConstantPoolCache::can_archive_resolved_entry().
+void ConstantPoolCacheEntry::metaspace_pointers_do(MetaspaceClosure* it) {
+  if (is_field_entry()) {
+    it->push((Klass**)&_f1);
+  } else {
+    if (bytecode_1() == Bytecodes::_invokespecial) {
+      it->push((Method**)&_f1);
+    }
+    if (bytecode_2() == Bytecodes::_invokevirtual && is_vfinal()) {
+      it->push((Method**)&_f2);
+    }
+  }
+}
+#endif
+
 int ConstantPoolCacheEntry::make_flags(TosState state,
                                        int option_bits,
                                        int field_index_or_method_params) {
@@ -673,8 +690,24 @@ ConstantPoolCache* ConstantPoolCache::allocate(ClassLoaderData* loader_data,
   const int length = index_map.length() + invokedynamic_index_map.length();
   int size = ConstantPoolCache::size(length);
 
-  return new (loader_data, size, MetaspaceObj::ConstantPoolCacheType, THREAD)
+  ConstantPoolCache* cache = new (loader_data, size, MetaspaceObj::ConstantPoolCacheType, THREAD)
     ConstantPoolCache(length, index_map, invokedynamic_index_map, invokedynamic_map);
+  if (cache != NULL && UseInterpreterInterfaceCallCache && length > 0) {
+    cache->_call_site_methods = MetadataFactory::new_array<Method*>(loader_data, length, NULL, CHECK_NULL);
+  }
+  return cache;
+}
+
+void ConstantPoolCache::clean_call_site_methods() {
+  if (_call_site_methods == NULL) {
+    return;
+  }
+  for (int i = 0; i < _call_site_methods->length(); i++) {
+    Method* m = Atomic::load(_call_site_methods->adr_at(i));
+    if (m != NULL && !m->method_holder()->is_loader_alive()) {
+      Atomic::store(_call_site_methods->adr_at(i), (Method*)NULL);
+    }
+  }
 }
 
 void ConstantPoolCache::initialize(const intArray& inverse_index_map,
@@ -711,6 +744,8 @@ void ConstantPoolCache::verify_just_initialized() {
 
 void ConstantPoolCache::remove_unshareable_info() {
   walk_entries_for_initialization(/*check_only = */ false);
+  // The call site methods are not archived.
+  _call_site_methods = NULL;
 }
 
 void ConstantPoolCache::walk_entries_for_initialization(bool check_only) {
@@ -723,6 +758,8 @@ void ConstantPoolCache::walk_entries_for_initialization(bool check_only) {
   // - We keep the ConstantPoolCache::constant_pool_index() bits for all entries.
   // - We keep the "f2" field for entries used by invokedynamic and invokehandle
   // - All other bits in the entries are cleared to zero.
+  // - With ArchiveResolvedConstantPoolEntries, the entries accepted by
+  //   can_archive_resolved_entry() are kept as they are.
   ResourceMark rm;
 
   InstanceKlass* ik = constant_pool()->pool_holder();
@@ -762,17 +799,83 @@ void ConstantPoolCache::walk_entries_for_initialization(bool check_only) {
       })
   } else {
     for (int i=0; i<length(); i++) {
+#if INCLUDE_CDS
+      if (can_archive_resolved_entry(i)) {
+        continue;
+      }
+#endif
       entry_at(i)->reinitialize(f2_used[i]);
     }
   }
 }
 
+#if INCLUDE_CDS
+// With ArchiveResolvedConstantPoolEntries, keep the entries whose resolution gives
+// the same result in every run and has no side effect: getfield/putfield,
+// invokevirtual and invokespecial entries that refer to the pool holder or one of
+// its super classes. These classes are always loaded before the pool holder and
+// resolving the entries never loads or initializes a class.
+bool ConstantPoolCache::can_archive_resolved_entry(int i) {
+  if (!ArchiveResolvedConstantPoolEntries) {
+    return false;
+  }
+  InstanceKlass* holder = constant_pool()->pool_holder();
+  if (holder->is_hidden() || !SystemDictionaryShared::is_builtin(holder)) {
+    return false;
+  }
+  ConstantPoolCacheEntry* e = entry_at(i);
+  Bytecodes::Code b1 = e->bytecode_1();
+  Bytecodes::Code b2 = e->bytecode_2();
+  if (e->is_field_entry()) {
+    if (b1 != Bytecodes::_getfield && b2 != Bytecodes::_putfield) {
+      return false;
+    }
+    Klass* k = e->f1_as_klass();
+    return k != NULL && holder->is_subclass_of(k);
+  }
+  if (b1 == 0 && b2 == 0) {
+    return false;
+  }
+  if (b1 != 0) {
+    if (b1 != Bytecodes::_invokespecial) {
+      return false;
+    }
+    if (!holder->is_subclass_of(e->f1_as_method()->method_holder())) {
+      return false;
+    }
+  }
+  if (b2 != 0) {
+    assert(b2 == Bytecodes::_invokevirtual, "only b2 for method entries");
+    if (e->is_vfinal()) {
+      if (!holder->is_subclass_of(e->f2_as_vfinal_method()->method_holder())) {
+        return false;
+      }
+    } else {
+      // The vtable index is taken from the method resolved in the referenced class.
+      Symbol* name = constant_pool()->uncached_klass_ref_at_noresolve(e->constant_pool_index());
+      Klass* k = holder;
+      while (k != NULL && k->name() != name) {
+        k = k->super();
+      }
+      if (k == NULL) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+#endif // INCLUDE_CDS
+
 void ConstantPoolCache::deallocate_contents(ClassLoaderData* data) {
   assert(!is_shared(), "shared caches are not deallocated");
   data->remove_handle(_resolved_references);
   set_resolved_references(OopHandle());
   MetadataFactory::free_array<u2>(data, _reference_map);
   set_reference_map(NULL);
+  if (_call_site_methods != NULL) {
+    MetadataFactory::free_array<Method*>(data, _call_site_methods);
+    _call_site_methods = NULL;
+  }
 }
 
 #if INCLUDE_CDS_JAVA_HEAP
@@ -815,6 +918,15 @@ void ConstantPoolCache::adjust_method_entries(bool * trace_name_printed) {
     Method* new_method = old_method->get_new_method();
     entry_at(i)->adjust_method_entry(old_method, new_method, trace_name_printed);
   }
+  if (_call_site_methods != NULL) {
+    // Old methods are looked up again by the next call.
+    for (int i = 0; i < _call_site_methods->length(); i++) {
+      Method* m = _call_site_methods->at(i);
+      if (m != NULL && m->is_old()) {
+        _call_site_methods->at_put(i, NULL);
+      }
+    }
+  }
 }
 
 // the constant pool cache should never contain old or obsolete methods
@@ -845,6 +957,15 @@ void ConstantPoolCache::metaspace_pointers_do(MetaspaceClosure* it) {
   log_trace(cds)("Iter(ConstantPoolCache): %p", this);
   it->push(&_constant_pool);
   it->push(&_reference_map);
+#if INCLUDE_CDS
+  if (ArchiveResolvedConstantPoolEntries) {
+    for (int i = 0; i < length(); i++) {
+      if (can_archive_resolved_entry(i)) {
+        entry_at(i)->metaspace_pointers_do(it);
+      }
+    }
+  }
+#endif
 }
 
 // Printing
@@ -391,6 +391,9 @@ class ConstantPoolCacheEntry {
 
   void verify_just_initialized(bool f2_used);
   void reinitialize(bool f2_used);
+#if INCLUDE_CDS
+  void metaspace_pointers_do(MetaspaceClosure* it);
+#endif
 };
 
 
@@ -414,6 +417,10 @@ class ConstantPoolCache: public MetaspaceObj {
   // object index to original constant pool index
   OopHandle            _resolved_references;
   Array<u2>*           _reference_map;
+  // With UseInterpreterInterfaceCallCache, the last Method* selected by each
+  // invokeinterface entry, for receivers of the method's holder class.
+  // Indexed like the entries, written by the interpreter. Not archived.
+  Array<Method*>*      _call_site_methods;
   // The narrowOop pointer to the archived resolved_references. Set at CDS dump
   // time when caching java heap object is supported.
   CDS_JAVA_HEAP_ONLY(int _archived_references_index;)
@@ -450,14 +457,22 @@ class ConstantPoolCache: public MetaspaceObj {
   Array<u2>* reference_map() const        { return _reference_map; }
   void set_reference_map(Array<u2>* o)    { _reference_map = o; }
 
+  Array<Method*>* call_site_methods() const { return _call_site_methods; }
+  // Drops the call site methods of unloaded classes.
+  void clean_call_site_methods();
+
   // Assembly code support
   static int resolved_references_offset_in_bytes() { return offset_of(ConstantPoolCache, _resolved_references); }
+  static int call_site_methods_offset_in_bytes()   { return offset_of(ConstantPoolCache, _call_site_methods); }
 
   // CDS support
   void remove_unshareable_info();
   void verify_just_initialized();
  private:
   void walk_entries_for_initialization(bool check_only);
+#if INCLUDE_CDS
+  bool can_archive_resolved_entry(int i);
+#endif
   void set_length(int length)                    { _length = length; }
 
   static int header_size()                       { return sizeof(ConstantPoolCache) / wordSize; }
@@ -1142,6 +1142,9 @@ void InstanceKlass::initialize_impl(TRAPS) {
     {
       debug_only(vtable().verify(tty, true);)
     }
+    if (ArchiveHotMethods && is_shared()) {
+      CompilationPolicy::compile_archived_hot_methods(this, THREAD);
+    }
   }
   else {
     // Step 10 and 11
@@ -1185,6 +1188,13 @@ void InstanceKlass::set_initialization_state_and_notify(ClassState state, TRAPS)
     set_init_thread(NULL); // reset _init_thread before changing _init_state
     set_init_state(state);
   }
+#ifdef COMPILER2
+  if (ClinitBarrierDependencies && state == fully_initialized && Universe::is_fully_initialized()) {
+    // Flush code with class initialization barriers for this class.
+    MutexLocker ml(THREAD, Compile_lock);
+    CodeCache::flush_dependents_on(this);
+  }
+#endif
 }
 
 InstanceKlass* InstanceKlass::implementor() const {
@@ -2309,6 +2319,9 @@ bool InstanceKlass::is_dependent_nmethod(nmethod* nm) {
 void InstanceKlass::clean_weak_instanceklass_links() {
   clean_implementors_list();
   clean_method_data();
+  if (constants()->cache() != NULL) {
+    constants()->cache()->clean_call_site_methods();
+  }
 }
 
 void InstanceKlass::clean_implementors_list() {
@@ -116,6 +116,11 @@ bool Klass::search_secondary_supers(Klass* k) const {
   // This is necessary, since I am never in my own secondary_super list.
   if (this == k)
     return true;
+  // If the slot of k is clear, k cannot be in the array.
+  if (UseSecondarySupersTable &&
+      (secondary_supers_bitmap() & (uintx(1) << k->hash_slot())) == 0) {
+    return false;
+  }
   // Scan the array-of-objects for a match
   int cnt = secondary_supers()->length();
   for (int i = 0; i < cnt; i++) {
@@ -201,9 +206,19 @@ void* Klass::operator new(size_t size, ClassLoaderData* loader_data, size_t word
 // which zeros out memory - calloc equivalent.
 // The constructor is also used from CppVtableCloner,
 // which doesn't zero out the memory before calling the constructor.
+// Hash slots are handed out in Fibonacci order, so that consecutively
+// created klasses, such as a class and its interfaces, land in different slots.
+static volatile uint _next_hash_slot = 0;
+
+static u1 next_hash_slot() {
+  uint n = Atomic::add(&_next_hash_slot, 1u);
+  return (u1)((n * 0x9E3779B9u) >> (32 - LogBitsPerWord));
+}
+
 Klass::Klass(KlassID id) : _id(id),
                            _prototype_header(markWord::prototype()),
-                           _shared_class_path_index(-1) {
+                           _shared_class_path_index(-1),
+                           _hash_slot(next_hash_slot()) {
   CDS_ONLY(_shared_class_flags = 0;)
   CDS_JAVA_HEAP_ONLY(_archived_mirror_index = -1;)
   _primary_supers[0] = this;
@@ -352,6 +367,24 @@ void Klass::initialize_supers(Klass* k, Array<InstanceKlass*>* transitive_interf
   }
 }
 
+void Klass::set_secondary_supers(Array<Klass*>* secondaries) {
+  uintx bitmap = 0;
+  if (secondaries != NULL) {
+    for (int i = 0; i < secondaries->length(); i++) {
+      Klass* k = secondaries->at(i);
+      if (k == NULL) {
+        // A placeholder that is filled during bootstrapping, e.g. in
+        // Universe::the_array_interfaces_array(). Never skip the scan.
+        bitmap = ~uintx(0);
+        break;
+      }
+      bitmap |= uintx(1) << k->hash_slot();
+    }
+  }
+  _secondary_supers = secondaries;
+  _secondary_supers_bitmap = bitmap;
+}
+
 GrowableArray<Klass*>* Klass::compute_secondary_supers(int num_extra_slots,
                                                        Array<InstanceKlass*>* transitive_interfaces) {
   assert(num_extra_slots == 0, "override for complex klasses");
@@ -600,7 +633,7 @@ void Klass::restore_unshareable_info(ClassLoaderData* loader_data, Handle protec
   if (this->has_archived_mirror_index()) {
     ResourceMark rm(THREAD);
     log_debug(cds, mirror)("%s has raw archived mirror", external_name());
-    if (HeapShared::open_archive_heap_region_mapped()) {
+    if (HeapShared::are_archived_mirrors_available()) {
       bool present = java_lang_Class::restore_archived_mirror(this, loader, module_handle,
                                                               protection_domain,
                                                               CHECK);
@@ -136,6 +136,8 @@ class Klass : public Metadata {
   Klass*      _secondary_super_cache;
   // Array of all secondary supertypes
   Array<Klass*>* _secondary_supers;
+  // Bitmap of the hash slots of all secondary supertypes
+  uintx       _secondary_supers_bitmap;
   // Ordered list of all primary supertypes
   Klass*      _primary_supers[_primary_super_limit];
   // java/lang/Class instance mirroring this class
@@ -172,6 +174,9 @@ private:
   // -1.
   jshort _shared_class_path_index;
 
+  // Bit of this klass in the _secondary_supers_bitmap of its subtypes.
+  u1     _hash_slot;
+
 #if INCLUDE_CDS
   // Flags of the current shared class.
   u2     _shared_class_flags;
@@ -225,7 +230,10 @@ protected:
   void set_secondary_super_cache(Klass* k) { _secondary_super_cache = k; }
 
   Array<Klass*>* secondary_supers() const { return _secondary_supers; }
-  void set_secondary_supers(Array<Klass*>* k) { _secondary_supers = k; }
+  void set_secondary_supers(Array<Klass*>* k);
+
+  uintx secondary_supers_bitmap() const { return _secondary_supers_bitmap; }
+  u1 hash_slot() const                  { return _hash_slot; }
 
   // Return the element of the _super chain of the given depth.
   // If there is no such element, return either NULL or this.
@@ -359,6 +367,8 @@ protected:
   static ByteSize primary_supers_offset()        { return in_ByteSize(offset_of(Klass, _primary_supers)); }
   static ByteSize secondary_super_cache_offset() { return in_ByteSize(offset_of(Klass, _secondary_super_cache)); }
   static ByteSize secondary_supers_offset()      { return in_ByteSize(offset_of(Klass, _secondary_supers)); }
+  static ByteSize secondary_supers_bitmap_offset() { return in_ByteSize(offset_of(Klass, _secondary_supers_bitmap)); }
+  static ByteSize hash_slot_offset()             { return in_ByteSize(offset_of(Klass, _hash_slot)); }
   static ByteSize java_mirror_offset()           { return in_ByteSize(offset_of(Klass, _java_mirror)); }
   static ByteSize class_loader_data_offset()     { return in_ByteSize(offset_of(Klass, _class_loader_data)); }
   static ByteSize modifier_flags_offset()        { return in_ByteSize(offset_of(Klass, _modifier_flags)); }
@@ -67,7 +67,9 @@ void markWord::print_on(outputStream* st, bool print_monitor_info) const {
   } else if (has_monitor()) {  // last bits = 10
     // have to check has_monitor() before is_locked()
     st->print(" monitor(" INTPTR_FORMAT ")=", value());
-    if (print_monitor_info) {
+    if (UseObjectMonitorTable) {
+      st->print("hash=" INTPTR_FORMAT, hash());
+    } else if (print_monitor_info) {
       ObjectMonitor* mon = monitor();
       if (mon == NULL) {
         st->print("NULL (this should never be seen!)");
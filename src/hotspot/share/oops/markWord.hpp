@@ -90,6 +90,16 @@
 //  - INFLATING() is a distinguished markword value of all zeros that is
 //    used when inflating an existing stack-lock into an ObjectMonitor.
 //    See below for is_being_inflated() and INFLATING().
+//
+//  - With UseCompactObjectHeaders (64 bits only), the narrow klass pointer
+//    takes the unused upper bits and objects have no separate klass word:
+//
+//    narrow_klass:25 hash:31 -->| unused_gap:1   age:4    biased_lock:1 lock:2
+//
+//    The klass can only be found in the header if the header is never
+//    displaced or overwritten by a JavaThread*, i.e. with
+//    UseLightweightLocking and UseObjectMonitorTable and without biased
+//    locking. Narrow klass pointers must fit in 25 bits.
 
 class BasicLock;
 class ObjectMonitor;
@@ -156,6 +166,14 @@ class markWord {
   static const uintptr_t hash_mask                = right_n_bits(hash_bits);
   static const uintptr_t hash_mask_in_place       = hash_mask << hash_shift;
 
+#ifdef _LP64
+  // Compact object headers, see UseCompactObjectHeaders.
+  static const int klass_shift                    = hash_shift + hash_bits;
+  static const int klass_bits                     = BitsPerWord - klass_shift;
+  static const uintptr_t klass_mask               = right_n_bits(klass_bits);
+  static const uintptr_t klass_mask_in_place      = klass_mask << klass_shift;
+#endif
+
   // Alignment of JavaThread pointers encoded in object header required by biased locking
   static const size_t biased_lock_alignment       = 2 << (epoch_shift + epoch_bits);
 
@@ -266,6 +284,22 @@ class markWord {
   markWord set_unlocked() const {
     return markWord(value() | unlocked_value);
   }
+  // With UseLightweightLocking a locked header only has its lock bits
+  // cleared, the owner is found on the lock stacks of the threads.
+  bool is_fast_locked() const {
+    return (value() & lock_mask_in_place) == locked_value;
+  }
+  markWord set_fast_locked() const {
+    return markWord(value() & ~lock_mask_in_place);
+  }
+  // With UseObjectMonitorTable an inflated header keeps the hash and age
+  // in place, only the lock bits tell that the object has a monitor.
+  markWord set_has_monitor() const {
+    return markWord((value() & ~lock_mask_in_place) | monitor_value);
+  }
+  markWord clear_has_monitor() const {
+    return markWord((value() & ~lock_mask_in_place) | unlocked_value);
+  }
   bool has_locker() const {
     return ((value() & lock_mask_in_place) == locked_value);
   }
@@ -278,11 +312,17 @@ class markWord {
   }
   ObjectMonitor* monitor() const {
     assert(has_monitor(), "check");
+    assert(!UseObjectMonitorTable, "the header does not refer to the monitor");
     // Use xor instead of &~ to provide one extra tag-bit check.
     return (ObjectMonitor*) (value() ^ monitor_value);
   }
   bool has_displaced_mark_helper() const {
-    return ((value() & unlocked_value) == 0);
+    intptr_t lockbits = value() & lock_mask_in_place;
+    if (UseObjectMonitorTable) {
+      return false;  // The header is never displaced.
+    }
+    return UseLightweightLocking ? lockbits == monitor_value   // monitor?
+                                 : (lockbits & unlocked_value) == 0; // monitor | stack-locked?
   }
   markWord displaced_mark_helper() const;
   void set_displaced_mark_helper(markWord m) const;
@@ -336,6 +376,18 @@ class markWord {
     return hash() == no_hash;
   }
 
+#ifdef _LP64
+  // klass operations, only valid with UseCompactObjectHeaders
+  narrowKlass narrow_klass() const {
+    return narrowKlass(value() >> klass_shift);
+  }
+  markWord set_narrow_klass(narrowKlass nklass) const {
+    assert((nklass & ~klass_mask) == 0, "narrow klass pointer does not fit in the header");
+    return markWord((value() & ~klass_mask_in_place) | ((uintptr_t)nklass << klass_shift));
+  }
+  inline Klass* klass() const;
+#endif
+
   // Prototype mark for initialization
   static markWord prototype() {
     return markWord( no_hash_in_place | no_lock_in_place );
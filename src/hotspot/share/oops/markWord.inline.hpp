@@ -27,6 +27,7 @@
 
 #include "oops/markWord.hpp"
 
+#include "oops/compressedOops.inline.hpp"
 #include "oops/klass.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/globals.hpp"
@@ -75,4 +76,12 @@ inline markWord markWord::prototype_for_klass(const Klass* klass) {
   return prototype_header;
 }
 
+#ifdef _LP64
+inline Klass* markWord::klass() const {
+  assert(UseCompactObjectHeaders, "only used with compact object headers");
+  assert(!has_displaced_mark_helper(), "the header must be in place");
+  return CompressedKlassPointers::decode_not_null(narrow_klass());
+}
+#endif
+
 #endif // SHARE_OOPS_MARKWORD_INLINE_HPP
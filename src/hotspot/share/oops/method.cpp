@@ -32,6 +32,7 @@
 #include "classfile/vmClasses.hpp"
 #include "code/codeCache.hpp"
 #include "code/debugInfoRec.hpp"
+#include "compiler/compilationCost.hpp"
 #include "compiler/compilationPolicy.hpp"
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "interpreter/bytecodeStream.hpp"
@@ -130,11 +131,13 @@ void Method::deallocate_contents(ClassLoaderData* loader_data) {
   set_method_data(NULL);
   MetadataFactory::free_metadata(loader_data, method_counters());
   clear_method_counters();
+  CompilationCost::remove(this);
   // The nmethod will be gone when we get here.
   if (code() != NULL) _code = NULL;
 }
 
 void Method::release_C_heap_structures() {
+  CompilationCost::remove(this);
   if (method_data()) {
 #if INCLUDE_JVMCI
     FailedSpeculation::free_failed_speculations(method_data()->get_failed_speculations_address());
@@ -404,6 +407,9 @@ void Method::metaspace_pointers_do(MetaspaceClosure* it) {
 // entries now in order allow them to be write protected later.
 
 void Method::remove_unshareable_info() {
+  if (ArchiveHotMethods) {
+    set_archived_hot(_code != NULL && _code->comp_level() == CompLevel_full_optimization);
+  }
   unlink_method();
   JFR_ONLY(REMOVE_METHOD_ID(this);)
 }
@@ -1180,7 +1186,11 @@ void Method::unlink_method() {
   NOT_PRODUCT(set_compiled_invocation_count(0);)
 
   set_method_data(NULL);
-  clear_method_counters();
+  if (ArchiveMethodCounters && method_counters() != NULL) {
+    method_counters()->remove_unshareable_info();
+  } else {
+    clear_method_counters();
+  }
 }
 #endif
 
@@ -1246,6 +1256,10 @@ address Method::make_adapters(const methodHandle& mh, TRAPS) {
 
 void Method::restore_unshareable_info(TRAPS) {
   assert(is_method() && is_valid_method(this), "ensure C++ vtable is restored");
+  if (_method_counters != NULL) {
+    methodHandle mh(THREAD, this);
+    _method_counters->restore_unshareable_info(mh);
+  }
 }
 
 address Method::from_compiled_entry_no_trampoline() const {
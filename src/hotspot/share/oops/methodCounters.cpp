@@ -43,7 +43,11 @@ MethodCounters::MethodCounters(const methodHandle& mh) :
     set_nmethod_age(HotMethodDetectionLimit);
   }
 
-  // Set per-method thresholds.
+  set_notify_masks(mh);
+}
+
+// Set per-method thresholds.
+void MethodCounters::set_notify_masks(const methodHandle& mh) {
   double scale = 1.0;
   CompilerOracle::has_option_value(mh, CompileCommand::CompileThresholdScaling, scale);
 
@@ -73,6 +77,24 @@ void MethodCounters::clear_counters() {
   set_highest_osr_comp_level(0);
 }
 
+#if INCLUDE_CDS
+void MethodCounters::remove_unshareable_info() {
+  set_interpreter_throwout_count(0);
+  JVMTI_ONLY(clear_number_of_breakpoints());
+  set_nmethod_age(INT_MAX);
+  set_prev_time(0);
+  set_prev_event_count(0);
+  set_rate(0);
+}
+
+void MethodCounters::restore_unshareable_info(const methodHandle& mh) {
+  if (StressCodeAging) {
+    set_nmethod_age(HotMethodDetectionLimit);
+  }
+  set_notify_masks(mh);
+}
+#endif
+
 void MethodCounters::print_value_on(outputStream* st) const {
   assert(is_methodCounters(), "must be methodCounters");
   st->print("method counters");
@@ -61,7 +61,11 @@ class MethodCounters : public Metadata {
   u1                _highest_osr_comp_level;      // Same for OSR level
 
   MethodCounters(const methodHandle& mh);
+  void set_notify_masks(const methodHandle& mh);
  public:
+  // CDS and vtbl checking can create an empty MethodCounters to get vtbl pointer.
+  MethodCounters() {}
+
   virtual bool is_methodCounters() const { return true; }
 
   static MethodCounters* allocate_no_exception(const methodHandle& mh);
@@ -78,6 +82,14 @@ class MethodCounters : public Metadata {
   MetaspaceObj::Type type() const { return MethodCountersType; }
   void clear_counters();
 
+#if INCLUDE_CDS
+  // The invocation and backedge counts and the highest compile levels are
+  // kept in the archive; the state that only makes sense within one run is
+  // reset when dumping and re-computed when the archive is loaded.
+  void remove_unshareable_info();
+  void restore_unshareable_info(const methodHandle& mh);
+#endif
+
 #if COMPILER2_OR_JVMCI
   void interpreter_throwout_increment() {
     if (_interpreter_throwout_count < 65534) {
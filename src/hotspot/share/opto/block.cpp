@@ -1441,6 +1441,13 @@ extern "C" int trace_frequency_order(const void *p0, const void *p1) {
   return diff;
 }
 
+bool PhaseBlockLayout::is_cold(const Block* b) const {
+  // Block frequencies are relative to the method entry.
+  return BlockLayoutColdBlockFrequency > 0.0 &&
+         b->_freq < BlockLayoutColdBlockFrequency &&
+         !b->head()->is_Root() && !b->head()->is_Start();
+}
+
 // Find edges of interest, i.e, those which can fall through. Presumes that
 // edges which don't fall through are of low frequency and can be generally
 // ignored.  Initialize the list of traces.
@@ -1472,6 +1479,9 @@ void PhaseBlockLayout::find_edges() {
       // We see a merge point, so stop search for the next block
       if (n->num_preds() != 1) break;
 
+      // Keep hot and cold blocks in separate traces
+      if (is_cold(n) != is_cold(b)) break;
+
       i++;
       assert(n == _cfg.get_block(i), "expecting next block");
       tr->append(n);
@@ -1487,6 +1497,11 @@ void PhaseBlockLayout::find_edges() {
       for (uint j = 0; j < b->_num_succs; j++ ) {
         if (b->succ_fall_through(j)) {
           Block *target = b->non_connector_successor(j);
+          if (is_cold(target) != is_cold(b)) {
+            // No fall through between hot and cold code; the cold traces
+            // are sorted after the hot ones by reorder_traces().
+            continue;
+          }
           float freq = b->_freq * b->succ_prob(j);
           int from_pct = (int) ((100 * freq) / b->_freq);
           int to_pct = (int) ((100 * freq) / target->_freq);
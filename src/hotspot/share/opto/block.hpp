@@ -886,6 +886,9 @@ class PhaseBlockLayout : public Phase {
   Trace * trace(Block *b) {
     return traces[uf->Find_compress(b->_pre_order)];
   }
+
+  // True if b goes to the cold part of the method, see BlockLayoutColdBlockFrequency
+  bool is_cold(const Block* b) const;
  public:
   PhaseBlockLayout(PhaseCFG &cfg);
 
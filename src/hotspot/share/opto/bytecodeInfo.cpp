@@ -55,6 +55,8 @@ InlineTree::InlineTree(Compile* c,
   _count_inlines = 0;
   _forced_inline = false;
 #endif
+  _hot_call_site = false;
+  _budget_candidate = false;
   if (_caller_jvms != NULL) {
     // Keep a private copy of the caller_jvms:
     _caller_jvms = new (C) JVMState(caller_jvms->method(), caller_tree->caller_jvms());
@@ -165,6 +167,7 @@ bool InlineTree::should_inline(ciMethod* callee_method, ciMethod* caller_method,
       is_init_with_ea(callee_method, caller_method, C)) {
 
     max_inline_size = C->freq_inline_size();
+    _hot_call_site = true;
     if (size <= max_inline_size && TraceFrequencyInlining) {
       CompileTask::print_inline_indent(inline_level());
       tty->print_cr("Inlined frequent method (freq=%d count=%d):", freq, call_site_count);
@@ -266,8 +269,13 @@ bool InlineTree::should_not_inline(ciMethod *callee_method,
 
   if (callee_method->has_compiled_code() &&
       callee_method->instructions_size() > InlineSmallCode) {
-    set_msg("already compiled into a big method");
-    return true;
+    if (UseInliningBudget && IncrementalInline && _hot_call_site) {
+      // Let post parse inlining weigh this call site against the others.
+      _budget_candidate = true;
+    } else {
+      set_msg("already compiled into a big method");
+      return true;
+    }
   }
 
   // don't inline exception code unless the top method belongs to an
@@ -365,6 +373,8 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
   }
 
   _forced_inline = false; // Reset
+  _hot_call_site = false;
+  _budget_candidate = false;
   if (!should_inline(callee_method, caller_method, caller_bci, profile)) {
     return false;
   }
@@ -469,6 +479,11 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
     }
   }
 
+  if (budget_candidate()) {
+    set_msg("inlining budget candidate");
+    should_delay = true;
+  }
+
   // ok, inline this method
   return true;
 }
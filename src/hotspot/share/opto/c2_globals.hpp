@@ -98,6 +98,11 @@
           "Trace all operations on this IndexSet (-1 means all, 0 none)")   \
           range(-1, 0)                                                      \
                                                                             \
+  product(bool, ReuseDeadNodeMemory, false, EXPERIMENTAL,                   \
+          "Keep the node arena memory of dead nodes and outgrown edge "     \
+          "arrays on free lists and reuse it for new nodes, reducing the "  \
+          "footprint of large compilations")                                \
+                                                                            \
   develop(intx, OptoNodeListSize, 4,                                        \
           "Starting allocation size of Node_List data structures")          \
           range(1, max_jint)                                                \
@@ -174,6 +179,11 @@
           "Unroll loop bodies with node count less than this")              \
           range(0, max_jint / 4)                                            \
                                                                             \
+  product(bool, UnrollLockedLoops, false, EXPERIMENTAL,                     \
+          "Unroll counted loops that lock a loop invariant object up "      \
+          "to 4 times LoopUnrollLimit, so that lock coarsening merges "     \
+          "the lock regions of the unrolled iterations")                    \
+                                                                            \
   product_pd(intx, LoopPercentProfileLimit,                                 \
              "Unroll loop bodies with % node count of profile limit")       \
              range(10, 100)                                                 \
@@ -335,8 +345,10 @@
   product(bool, UseSuperWord, true,                                         \
           "Transform scalar operations into superword operations")          \
                                                                             \
-  develop(bool, SuperWordRTDepCheck, false,                                 \
-          "Enable runtime dependency checks.")                              \
+  product(bool, SuperWordRTDepCheck, false, EXPERIMENTAL,                   \
+          "Vectorize loops with accesses to arrays that might alias by "    \
+          "checking at runtime that the arrays are distinct, and falling "  \
+          "back to the scalar loop otherwise")                              \
                                                                             \
   product(bool, SuperWordReductions, true,                                  \
           "Enable reductions support in superword.")                        \
@@ -468,6 +480,11 @@
   product(bool, AggressiveUnboxing, true, DIAGNOSTIC,                       \
           "Control optimizations for aggressive boxing elimination")        \
                                                                             \
+  product(bool, AggressiveBoxElimination, false, EXPERIMENTAL,              \
+          "Keep valueOf() calls whose box is only stored into a non-"       \
+          "escaping object out of line so the box can be eliminated "       \
+          "together with its container, rematerializing it on deopt")       \
+                                                                            \
   develop(bool, TracePostallocExpand, false, "Trace expanding nodes after"  \
           " register allocation.")                                          \
                                                                             \
@@ -481,6 +498,17 @@
   develop(bool, ExitEscapeAnalysisOnTimeout, true,                          \
           "Exit or throw assert in EA when it reaches time limit")          \
                                                                             \
+  product(bool, PartialEscapeAnalysis, false, EXPERIMENTAL,                 \
+          "Replace rarely taken branches by uncommon traps while a "        \
+          "freshly allocated object is live, so that the allocation can "   \
+          "be scalar replaced on the hot path and is only materialized "    \
+          "by deoptimization on the cold one")                              \
+                                                                            \
+  product(double, PartialEscapeColdBranchProbability, 0.001, EXPERIMENTAL,  \
+          "Branch probability below which a path is considered cold by "    \
+          "PartialEscapeAnalysis")                                          \
+          range(0.0, 0.1)                                                   \
+                                                                            \
   notproduct(bool, PrintEscapeAnalysis, false,                              \
           "Print the results of escape analysis")                           \
                                                                             \
@@ -513,6 +541,9 @@
   product(bool, OptimizeStringConcat, true,                                 \
           "Optimize the construction of Strings by StringBuilder")          \
                                                                             \
+  product(bool, OptimizeBoolStringConcat, false, EXPERIMENTAL,              \
+          "Also fuse StringBuilder chains that append boolean values")      \
+                                                                            \
   notproduct(bool, PrintOptimizeStringConcat, false,                        \
           "Print information about transformations performed on Strings")   \
                                                                             \
@@ -539,6 +570,11 @@
   product(bool, BlockLayoutRotateLoops, true,                               \
           "Allow back branches to be fall throughs in the block layout")    \
                                                                             \
+  product(double, BlockLayoutColdBlockFrequency, 0.0, EXPERIMENTAL,         \
+          "Blocks executed less often than this fraction of the method "    \
+          "entries are laid out after all other blocks. 0 disables it")     \
+          range(0.0, 1.0)                                                   \
+                                                                            \
   product(bool, InlineReflectionGetCallerClass, true, DIAGNOSTIC,           \
           "inline sun.reflect.Reflection.getCallerClass(), known to be "    \
           "part of base library DLL")                                       \
@@ -689,6 +725,16 @@
           "max number of live nodes in a method")                           \
           range(0, max_juint / 8)                                           \
                                                                             \
+  product(bool, UseInliningBudget, false, EXPERIMENTAL,                     \
+          "Delay hot call sites into methods already compiled big to "      \
+          "post parse inlining, where they are inlined in order of "        \
+          "profiled uses per bytecode until InliningBudget is spent")       \
+                                                                            \
+  product(intx, InliningBudget, 2000, EXPERIMENTAL,                         \
+          "Bytecodes that UseInliningBudget may inline into one "           \
+          "compilation")                                                    \
+          range(0, max_jint)                                                \
+                                                                            \
   product(bool, OptimizeExpensiveOps, true, DIAGNOSTIC,                     \
           "Find best control for expensive operations")                     \
                                                                             \
@@ -725,6 +771,10 @@
   product(bool, UseVectorStubs, false, EXPERIMENTAL,                        \
           "Use stubs for vector transcendental operations")                 \
                                                                             \
+  product(bool, VectorizeMathCalls, false, EXPERIMENTAL,                    \
+          "Let SuperWord vectorize loops calling Math.sin, cos, log, exp "  \
+          "and pow using the vector stubs enabled by UseVectorStubs")       \
+                                                                            \
   product(bool, UseTypeSpeculation, true,                                   \
           "Speculatively propagate types from profiles")                    \
                                                                             \
@@ -747,6 +797,10 @@
   develop(bool, RenumberLiveNodes, true,                                    \
           "Renumber live nodes")                                            \
                                                                             \
+  product(bool, RenumberLiveNodesInLoopOpts, false, EXPERIMENTAL,           \
+          "Renumber live nodes between loop optimization rounds when"       \
+          "most node ids belong to dead nodes")                             \
+                                                                            \
   product(uintx, LoopStripMiningIter, 0,                                    \
           "Number of iterations in strip mined loop")                       \
           range(0, max_juint)                                               \
@@ -762,11 +816,28 @@
   product(bool, ExpandSubTypeCheckAtParseTime, false, DIAGNOSTIC,           \
           "Do not use subtype check macro node")                            \
                                                                             \
+  product(bool, UseTrivialNativeCalls, true, DIAGNOSTIC,                    \
+          "Call foreign functions that are marked as not needing a thread " \
+          "state transition directly from compiled code, without a native " \
+          "invoker stub or safepoint poll")                                 \
+                                                                            \
   develop(uintx, StressLongCountedLoop, 0,                                  \
           "if > 0, convert int counted loops to long counted loops"         \
           "to stress handling of long counted loops: run inner loop"        \
           "for at most jint_max / StressLongCountedLoop")                   \
           range(0, max_juint)                                               \
+                                                                            \
+  product(bool, TransformLongRangeChecks, false, EXPERIMENTAL,              \
+          "When a long counted loop is transformed into a loop nest, "      \
+          "rewrite long range checks of the inner loop into int range "     \
+          "checks on the inner loop induction variable so they can be "     \
+          "eliminated by int range check elimination")                      \
+                                                                            \
+  product(bool, ClinitBarrierDependencies, false, EXPERIMENTAL,             \
+          "Record a dependency on each class a class initialization "       \
+          "barrier is emitted for, so that the code is deoptimized and "    \
+          "can be recompiled without the barrier once the class is "        \
+          "fully initialized")
 
 // end of C2_FLAGS
 
@@ -209,6 +209,14 @@ bool C2Compiler::is_intrinsic_supported(const methodHandle& method, bool is_virt
   case vmIntrinsics::_hasNegatives:
     if (!Matcher::match_rule_supported(Op_HasNegatives))  return false;
     break;
+  case vmIntrinsics::_hashCodeL:
+  case vmIntrinsics::_hashCodeU:
+  case vmIntrinsics::_hashCodeB:
+  case vmIntrinsics::_hashCodeC:
+  case vmIntrinsics::_hashCodeS:
+  case vmIntrinsics::_hashCodeI:
+    if (StubRoutines::vectorizedHashCode() == NULL) return false;
+    break;
   case vmIntrinsics::_bitCount_i:
     if (!Matcher::match_rule_supported(Op_PopCountI)) return false;
     break;
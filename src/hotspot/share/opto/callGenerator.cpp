@@ -380,6 +380,36 @@ CallGenerator* CallGenerator::for_late_inline(ciMethod* method, CallGenerator* i
   return new LateInlineCallGenerator(method, inline_cg);
 }
 
+// Late inline of a hot call site that is only inlined while the inlining
+// budget of the compilation lasts. Compile::inline_incrementally_one()
+// visits these in order of decreasing benefit.
+class LateInlineBudgetCallGenerator : public LateInlineCallGenerator {
+  float _benefit;   // profiled uses per bytecode of the callee
+
+  virtual bool do_late_inline_check(Compile* C, JVMState* jvms) {
+    // Once the budget is spent, the call site stays a call.
+    return C->consume_inlining_budget(method()->code_size_for_inlining());
+  }
+
+ public:
+  LateInlineBudgetCallGenerator(ciMethod* method, CallGenerator* inline_cg, float benefit) :
+    LateInlineCallGenerator(method, inline_cg), _benefit(benefit) {}
+
+  virtual bool is_budget_late_inline() const { return true; }
+  virtual float inline_benefit() const { return _benefit; }
+
+  virtual CallGenerator* with_call_node(CallNode* call) {
+    LateInlineBudgetCallGenerator* cg = new LateInlineBudgetCallGenerator(method(), _inline_cg, _benefit);
+    cg->set_call_node(call->as_CallStaticJava());
+    return cg;
+  }
+};
+
+CallGenerator* CallGenerator::for_budget_late_inline(ciMethod* method, CallGenerator* inline_cg, float benefit) {
+  assert(UseInliningBudget && IncrementalInline, "required");
+  return new LateInlineBudgetCallGenerator(method, inline_cg, benefit);
+}
+
 class LateInlineMHCallGenerator : public LateInlineCallGenerator {
   ciMethod* _caller;
   bool _input_not_const;
@@ -813,6 +843,8 @@ class LateInlineBoxingCallGenerator : public LateInlineCallGenerator {
 
   virtual bool is_boxing_late_inline() const { return true; }
 
+  virtual bool do_late_inline_check(Compile* C, JVMState* jvms);
+
   virtual CallGenerator* with_call_node(CallNode* call) {
     LateInlineBoxingCallGenerator* cg = new LateInlineBoxingCallGenerator(method(), _inline_cg);
     cg->set_call_node(call->as_CallStaticJava());
@@ -820,6 +852,51 @@ class LateInlineBoxingCallGenerator : public LateInlineCallGenerator {
   }
 };
 
+// Returns true if every non-debug use of the box is a store of the box into
+// a field of a freshly allocated object.
+static bool is_only_stored_into_allocation(Node* box, PhaseGVN* gvn) {
+  bool has_store = false;
+  for (DUIterator_Fast imax, i = box->fast_outs(imax); i < imax; i++) {
+    Node* use = box->fast_out(i);
+    if (use->is_SafePoint() && !(use->is_Call() && use->as_Call()->has_non_debug_use(box))) {
+      continue;
+    }
+    if (use->Opcode() == Op_EncodeP) {
+      for (DUIterator_Fast jmax, j = use->fast_outs(jmax); j < jmax; j++) {
+        Node* st = use->fast_out(j);
+        if (st->Opcode() != Op_StoreN || st->in(MemNode::ValueIn) != use ||
+            AllocateNode::Ideal_allocation(st->in(MemNode::Address), gvn) == NULL) {
+          return false;
+        }
+        has_store = true;
+      }
+      continue;
+    }
+    if (use->Opcode() != Op_StoreP || use->in(MemNode::ValueIn) != box ||
+        AllocateNode::Ideal_allocation(use->in(MemNode::Address), gvn) == NULL) {
+      return false;
+    }
+    has_store = true;
+  }
+  return has_store;
+}
+
+bool LateInlineBoxingCallGenerator::do_late_inline_check(Compile* C, JVMState* jvms) {
+  // Inlining valueOf() merges the cached box with a new allocation, which
+  // pins the box and every object it is stored into. If the box only flows
+  // into fresh objects, leave the call in place: escape analysis may then
+  // scalar replace the containers and macro expansion eliminates the box,
+  // describing it to deoptimization as a (possibly cached) auto-box.
+  if (AggressiveBoxElimination && C->do_escape_analysis() && is_box_cache_valid(call_node())) {
+    ProjNode* res = call_node()->proj_out_or_null(TypeFunc::Parms);
+    if (res != NULL && is_only_stored_into_allocation(res, C->initial_gvn())) {
+      C->add_macro_node(call_node());
+      return false;
+    }
+  }
+  return true;
+}
+
 CallGenerator* CallGenerator::for_boxing_late_inline(ciMethod* method, CallGenerator* inline_cg) {
   return new LateInlineBoxingCallGenerator(method, inline_cg);
 }
@@ -77,6 +77,9 @@ class CallGenerator : public ResourceObj {
   virtual bool      is_boxing_late_inline() const  { return false; }
   virtual bool      is_string_late_inline() const  { return false; }
   virtual bool      is_virtual_late_inline() const { return false; }
+  // same but competes for the inlining budget, see UseInliningBudget
+  virtual bool      is_budget_late_inline() const  { return false; }
+  virtual float     inline_benefit() const         { return 0.0f; }
 
   // Replace the call with an inline version of the code
   virtual void do_late_inline() { ShouldNotReachHere(); }
@@ -138,6 +141,7 @@ class CallGenerator : public ResourceObj {
 
   // How to generate a replace a direct call with an inline version
   static CallGenerator* for_late_inline(ciMethod* m, CallGenerator* inline_cg);
+  static CallGenerator* for_budget_late_inline(ciMethod* m, CallGenerator* inline_cg, float benefit);
   static CallGenerator* for_mh_late_inline(ciMethod* caller, ciMethod* callee, bool input_not_const);
   static CallGenerator* for_string_late_inline(ciMethod* m, CallGenerator* inline_cg);
   static CallGenerator* for_boxing_late_inline(ciMethod* m, CallGenerator* inline_cg);
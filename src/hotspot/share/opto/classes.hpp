@@ -207,6 +207,7 @@ macro(LoopLimit)
 macro(Mach)
 macro(MachNullCheck)
 macro(MachProj)
+macro(MathCall)
 macro(MulAddS2I)
 macro(MaxI)
 macro(MaxL)
@@ -455,6 +456,7 @@ macro(VectorBox)
 macro(VectorBoxAllocate)
 macro(VectorUnbox)
 macro(VectorMaskWrapper)
+macro(VectorMathCall)
 macro(VectorMaskCmp)
 macro(VectorMaskCast)
 macro(VectorTest)
@@ -582,6 +582,7 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
                   _vector_reboxing_late_inlines(comp_arena(), 2, 0, NULL),
                   _late_inlines_pos(0),
                   _number_of_mh_late_inlines(0),
+                  _inlining_budget_used(0),
                   _native_invokers(comp_arena(), 1, 0, NULL),
                   _print_inlining_stream(NULL),
                   _print_inlining_list(NULL),
@@ -867,6 +868,7 @@ Compile::Compile( ciEnv* ci_env,
     _initial_gvn(NULL),
     _for_igvn(NULL),
     _number_of_mh_late_inlines(0),
+    _inlining_budget_used(0),
     _native_invokers(),
     _print_inlining_stream(NULL),
     _print_inlining_list(NULL),
@@ -1847,6 +1849,31 @@ void Compile::inline_boxing_calls(PhaseIterGVN& igvn) {
   }
 }
 
+// Move the late inlines that compete for the inlining budget behind all
+// others, ordered by decreasing benefit, so that the budget left after the
+// inlining decisions already taken goes to the most profitable call sites.
+void Compile::sort_late_inlines_by_benefit() {
+  ResourceMark rm;
+  GrowableArray<CallGenerator*> candidates;
+  int pos = 0;
+  for (int i = 0; i < _late_inlines.length(); i++) {
+    CallGenerator* cg = _late_inlines.at(i);
+    if (!cg->is_budget_late_inline()) {
+      _late_inlines.at_put(pos++, cg);
+    } else {
+      int j = 0;
+      while (j < candidates.length() && candidates.at(j)->inline_benefit() >= cg->inline_benefit()) {
+        j++;
+      }
+      candidates.insert_before(j, cg);
+    }
+  }
+  for (int i = 0; i < candidates.length(); i++) {
+    _late_inlines.at_put(pos++, candidates.at(i));
+  }
+  assert(pos == _late_inlines.length(), "lost a late inline");
+}
+
 bool Compile::inline_incrementally_one() {
   assert(IncrementalInline, "incremental inlining should be on");
 
@@ -1855,6 +1882,10 @@ bool Compile::inline_incrementally_one() {
   set_inlining_progress(false);
   set_do_cleanup(false);
 
+  if (UseInliningBudget) {
+    sort_late_inlines_by_benefit();
+  }
+
   for (int i = 0; i < _late_inlines.length(); i++) {
     _late_inlines_pos = i+1;
     CallGenerator* cg = _late_inlines.at(i);
@@ -2001,6 +2032,8 @@ bool Compile::optimize_loops(PhaseIterGVN& igvn, LoopOptsMode mode) {
   if (_loop_opts_cnt > 0) {
     debug_only( int cnt = 0; );
     while (major_progress() && (_loop_opts_cnt > 0)) {
+      renumber_live_nodes_before_loop_opts(igvn);
+      if (failing())  return false;
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
       assert( cnt++ < 40, "infinite cycle in loop optimization" );
       PhaseIdealLoop::optimize(igvn, mode);
@@ -2012,6 +2045,35 @@ bool Compile::optimize_loops(PhaseIterGVN& igvn, LoopOptsMode mode) {
   return true;
 }
 
+void Compile::renumber_live_nodes(PhaseIterGVN& igvn) {
+  Compile::TracePhase tp("", &timers[_t_renumberLive]);
+  initial_gvn()->replace_with(&igvn);
+  for_igvn()->clear();
+  Unique_Node_List new_worklist(C->comp_arena());
+  {
+    ResourceMark rm;
+    PhaseRenumberLive prl = PhaseRenumberLive(initial_gvn(), for_igvn(), &new_worklist);
+  }
+  Unique_Node_List* save_for_igvn = for_igvn();
+  set_for_igvn(&new_worklist);
+  igvn = PhaseIterGVN(initial_gvn());
+  igvn.optimize();
+  set_for_igvn(save_for_igvn);
+}
+
+// Every PhaseIdealLoop round sizes its side tables (loop tree and
+// dominator maps, preorders, LCA tags) by unique() and walks them.
+// Unrolling, peeling and splitting leave many dead nodes behind, so
+// by the later rounds most of that id space may be dead. Compact it
+// first. The clone map used by vector loops is keyed by node id and
+// is not renumbered, so leave such compilations alone.
+void Compile::renumber_live_nodes_before_loop_opts(PhaseIterGVN& igvn) {
+  if (RenumberLiveNodesInLoopOpts && RenumberLiveNodes && !do_vector_loop() &&
+      2 * live_nodes() + NodeLimitFudgeFactor < unique()) {
+    renumber_live_nodes(igvn);
+  }
+}
+
 // Remove edges from "root" to each SafePoint at a backward branch.
 // They were inserted during parsing (see add_safepoint()) to make
 // infinite loops without calls or exceptions visible to root, i.e.,
@@ -2122,19 +2184,7 @@ void Compile::Optimize() {
   assert(!has_vbox_nodes(), "sanity");
 
   if (!failing() && RenumberLiveNodes && live_nodes() + NodeLimitFudgeFactor < unique()) {
-    Compile::TracePhase tp("", &timers[_t_renumberLive]);
-    initial_gvn()->replace_with(&igvn);
-    for_igvn()->clear();
-    Unique_Node_List new_worklist(C->comp_arena());
-    {
-      ResourceMark rm;
-      PhaseRenumberLive prl = PhaseRenumberLive(initial_gvn(), for_igvn(), &new_worklist);
-    }
-    Unique_Node_List* save_for_igvn = for_igvn();
-    set_for_igvn(&new_worklist);
-    igvn = PhaseIterGVN(initial_gvn());
-    igvn.optimize();
-    set_for_igvn(save_for_igvn);
+    renumber_live_nodes(igvn);
   }
 
   // Perform escape analysis
@@ -2183,6 +2233,8 @@ void Compile::Optimize() {
     }
     // Loop opts pass if partial peeling occurred in previous pass
     if(PartialPeelLoop && major_progress() && (_loop_opts_cnt > 0)) {
+      renumber_live_nodes_before_loop_opts(igvn);
+      if (failing())  return;
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
       PhaseIdealLoop::optimize(igvn, LoopOptsSkipSplitIf);
       _loop_opts_cnt--;
@@ -2191,6 +2243,8 @@ void Compile::Optimize() {
     }
     // Loop opts pass for loop-unrolling before CCP
     if(major_progress() && (_loop_opts_cnt > 0)) {
+      renumber_live_nodes_before_loop_opts(igvn);
+      if (failing())  return;
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
       PhaseIdealLoop::optimize(igvn, LoopOptsSkipSplitIf);
       _loop_opts_cnt--;
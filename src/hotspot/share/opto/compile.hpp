@@ -160,6 +160,57 @@ class CloneMap {
   bool same_gen(node_idx_t k1, node_idx_t k2)  const { return gen(k1) == gen(k2); }
 };
 
+// Free lists of node arena memory that could not be returned to the arena
+// when nodes died or their edge arrays grew, segregated by size in words.
+// Only used with ReuseDeadNodeMemory, and disabled once the matcher moves
+// the ideal graph to old-space, since it tells old and new nodes apart by
+// the arena they are allocated in.
+class NodeArenaFreeList {
+ private:
+  static const size_t MaxWords = 64;
+
+  void* _lists[MaxWords + 1];
+  bool  _enabled;
+
+ public:
+  NodeArenaFreeList() : _enabled(ReuseDeadNodeMemory) {
+    clear();
+  }
+
+  bool is_enabled() const { return _enabled; }
+
+  void clear() {
+    for (size_t i = 0; i <= MaxWords; i++) {
+      _lists[i] = NULL;
+    }
+  }
+
+  void disable() {
+    _enabled = false;
+    clear();
+  }
+
+  // Returns a released block of exactly size bytes, or NULL.
+  void* allocate(size_t size) {
+    size_t words = size / BytesPerWord;
+    if (!_enabled || words > MaxWords || _lists[words] == NULL) {
+      return NULL;
+    }
+    void* block = _lists[words];
+    _lists[words] = *(void**)block;
+    return block;
+  }
+
+  void release(void* block, size_t size) {
+    assert(is_aligned(size, BytesPerWord), "node arena sizes are word aligned");
+    size_t words = size / BytesPerWord;
+    if (_enabled && words > 0 && words <= MaxWords) {
+      *(void**)block = _lists[words];
+      _lists[words] = block;
+    }
+  }
+};
+
 //------------------------------Compile----------------------------------------
 // This class defines a top-level Compiler invocation.
 
@@ -336,6 +387,7 @@ class Compile : public Phase {
   debug_only(static int _debug_idx;)            // Monotonic counter (not reset), use -XX:BreakAtNode=<idx>
   Arena                 _node_arena;            // Arena for new-space Nodes
   Arena                 _old_arena;             // Arena for old-space Nodes, lifetime during xform
+  NodeArenaFreeList     _node_free_list;        // Released memory of _node_arena
   RootNode*             _root;                  // Unique root of compilation, or NULL after bail-out.
   Node*                 _top;                   // Unique top node.  (Reset by various phases.)
 
@@ -385,6 +437,7 @@ class Compile : public Phase {
 
   int                           _late_inlines_pos;    // Where in the queue should the next late inlining candidate go (emulate depth first inlining)
   uint                          _number_of_mh_late_inlines; // number of method handle late inlining still pending
+  int                           _inlining_budget_used; // bytecodes inlined by budget late inlines, see UseInliningBudget
 
   GrowableArray<RuntimeStub*>   _native_invokers;
 
@@ -754,6 +807,20 @@ class Compile : public Phase {
   static void  set_debug_idx(int i)        { debug_only(_debug_idx = i); }
   Arena*       node_arena()                { return &_node_arena; }
   Arena*       old_arena()                 { return &_old_arena; }
+  NodeArenaFreeList* node_free_list()      { return &_node_free_list; }
+
+  // Allocates from the node free list, or else from the node arena.
+  void* node_arena_alloc(size_t size) {
+    void* block = _node_free_list.allocate(size);
+    return (block != NULL) ? block : _node_arena.Amalloc_D(size);
+  }
+  // Returns memory to the node arena if it was the last allocation, or
+  // else to the node free list.
+  void node_arena_free(void* block, size_t size) {
+    if (!_node_arena.Afree(block, size)) {
+      _node_free_list.release(block, size);
+    }
+  }
   RootNode*    root() const                { return _root; }
   void         set_root(RootNode* r)       { _root = r; }
   StartNode*   start() const;              // (Derived from root.)
@@ -971,12 +1038,24 @@ class Compile : public Phase {
   void dec_number_of_mh_late_inlines() { assert(_number_of_mh_late_inlines > 0, "_number_of_mh_late_inlines < 0 !"); _number_of_mh_late_inlines--; }
   bool has_mh_late_inlines() const     { return _number_of_mh_late_inlines > 0; }
 
+  // Charge size bytecodes to the inlining budget. Returns false if they do not fit.
+  bool consume_inlining_budget(int size) {
+    if (_inlining_budget_used + size > InliningBudget) {
+      return false;
+    }
+    _inlining_budget_used += size;
+    return true;
+  }
+
+  void sort_late_inlines_by_benefit();
   bool inline_incrementally_one();
   void inline_incrementally_cleanup(PhaseIterGVN& igvn);
   void inline_incrementally(PhaseIterGVN& igvn);
   void inline_string_calls(bool parse_time);
   void inline_boxing_calls(PhaseIterGVN& igvn);
   bool optimize_loops(PhaseIterGVN& igvn, LoopOptsMode mode);
+  void renumber_live_nodes(PhaseIterGVN& igvn);
+  void renumber_live_nodes_before_loop_opts(PhaseIterGVN& igvn);
   void remove_root_to_sfpts_edges(PhaseIterGVN& igvn);
 
   void inline_vector_reboxing_calls();
@@ -174,6 +174,9 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
             return CallGenerator::for_boxing_late_inline(callee, cg);
           } else if (should_delay_vector_reboxing_inlining(callee, jvms)) {
             return CallGenerator::for_vector_reboxing_late_inline(callee, cg);
+          } else if (ilt->budget_candidate()) {
+            float benefit = expected_uses / MAX2(1, callee->code_size_for_inlining());
+            return CallGenerator::for_budget_late_inline(callee, cg, benefit);
           } else if ((should_delay || AlwaysIncrementalInline)) {
             return CallGenerator::for_late_inline(callee, cg);
           } else {
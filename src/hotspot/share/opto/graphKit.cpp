@@ -2621,7 +2621,10 @@ Node* GraphKit::make_native_call(address call_addr, const TypeFunc* call_type, u
     TypeTuple::make(TypeFunc::Parms + n_returns, ret_types)
   );
 
-  if (nep->need_transition()) {
+  // A trivial call has been declared by the library to neither block nor
+  // upcall, so it can run in Java thread state without a safepoint poll.
+  bool need_transition = nep->need_transition() || !UseTrivialNativeCalls;
+  if (need_transition) {
     RuntimeStub* invoker = SharedRuntime::make_native_invoker(call_addr,
                                                               nep->shadow_space(),
                                                               arg_regs, ret_regs);
@@ -2638,7 +2641,7 @@ Node* GraphKit::make_native_call(address call_addr, const TypeFunc* call_type, u
                                             arg_regs,
                                             ret_regs,
                                             nep->shadow_space(),
-                                            nep->need_transition());
+                                            need_transition);
 
   if (call->_need_transition) {
     add_safepoint_edges(call);
@@ -3064,6 +3067,10 @@ void GraphKit::guard_init_thread(Node* klass) {
 void GraphKit::clinit_barrier(ciInstanceKlass* ik, ciMethod* context) {
   if (ik->is_being_initialized()) {
     if (C->needs_clinit_barrier(ik, context)) {
+      if (ClinitBarrierDependencies) {
+        // Deoptimize the code once the barrier is no longer needed.
+        C->dependencies()->assert_being_initialized(ik);
+      }
       Node* klass = makecon(TypeKlassPtr::make(ik));
       guard_klass_being_initialized(klass);
       guard_init_thread(klass);
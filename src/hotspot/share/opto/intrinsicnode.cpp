@@ -26,6 +26,7 @@
 #include "opto/intrinsicnode.hpp"
 #include "opto/memnode.hpp"
 #include "opto/phaseX.hpp"
+#include "opto/runtime.hpp"
 
 //=============================================================================
 // Do not match memory edge.
@@ -112,3 +113,23 @@ SignumFNode* SignumFNode::make(PhaseGVN& gvn, Node* in) {
   return new SignumFNode(in, gvn.makecon(TypeF::ZERO), gvn.makecon(TypeF::ONE));
 }
 
+
+//------------------------------MathCall-----------------------------------------
+const Type* MathCallNode::Value(PhaseGVN* phase) const {
+  for (uint i = 0; i < req(); i++) {
+    if (in(i) == NULL || phase->type(in(i)) == Type::TOP) {
+      return Type::TOP;
+    }
+  }
+  return Type::DOUBLE;
+}
+
+const TypeFunc* MathCallNode::tf() const {
+  return req() == 3 ? OptoRuntime::Math_DD_D_Type() : OptoRuntime::Math_D_D_Type();
+}
+
+#ifndef PRODUCT
+void MathCallNode::dump_spec(outputStream* st) const {
+  st->print("# %s", _name);
+}
+#endif
@@ -258,4 +258,47 @@ class SignumFNode : public Node {
   virtual uint ideal_reg() const { return Op_RegF; }
 };
 
+//------------------------------MathCall----------------------------------------
+// Call to a double precision math stub (sin, cos, log, exp, pow) that has no
+// side effects. It is kept as a pinned data node so SuperWord can pack it into
+// a VectorMathCall. Both are expanded into leaf calls during macro expansion.
+class MathCallNode : public Node {
+ private:
+  int         _vop;   // VectorSupport operation id
+  address     _entry;
+  const char* _name;
+
+ protected:
+  virtual uint size_of() const { return sizeof(*this); }
+
+ public:
+  MathCallNode(Compile* C, Node* ctrl, Node* in1, Node* in2, int vop, address entry, const char* name) :
+      Node(in2 == NULL ? 2 : 3), _vop(vop), _entry(entry), _name(name) {
+    init_req(0, ctrl);
+    init_req(1, in1);
+    if (in2 != NULL) {
+      init_req(2, in2);
+    }
+    init_flags(Flag_is_macro);
+    C->add_macro_node(this);
+  }
+
+  virtual int Opcode() const;
+  virtual uint hash() const { return Node::hash() + _vop; }
+  virtual bool cmp(const Node& n) const {
+    return Node::cmp(n) && _vop == ((MathCallNode&)n)._vop && _entry == ((MathCallNode&)n)._entry;
+  }
+  virtual const Type* bottom_type() const { return Type::DOUBLE; }
+  virtual uint ideal_reg() const { return Op_RegD; }
+  virtual const Type* Value(PhaseGVN* phase) const;
+
+  int vop() const { return _vop; }
+  address entry() const { return _entry; }
+  const char* name() const { return _name; }
+  const TypeFunc* tf() const;
+#ifndef PRODUCT
+  virtual void dump_spec(outputStream* st) const;
+#endif
+};
+
 #endif // SHARE_OPTO_INTRINSICNODE_HPP
@@ -51,6 +51,7 @@
 #include "opto/rootnode.hpp"
 #include "opto/subnode.hpp"
 #include "prims/unsafe.hpp"
+#include "prims/vectorSupport.hpp"
 #include "runtime/objectMonitor.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -579,6 +580,14 @@ bool LibraryCallKit::try_to_inline(int predicate) {
   case vmIntrinsics::_vectorizedMismatch:
     return inline_vectorizedMismatch();
 
+  case vmIntrinsics::_hashCodeL:
+  case vmIntrinsics::_hashCodeU:
+  case vmIntrinsics::_hashCodeB:
+  case vmIntrinsics::_hashCodeC:
+  case vmIntrinsics::_hashCodeS:
+  case vmIntrinsics::_hashCodeI:
+    return inline_vectorizedHashCode(intrinsic_id());
+
   case vmIntrinsics::_ghash_processBlocks:
     return inline_ghash_processBlocks();
   case vmIntrinsics::_base64_encodeBlock:
@@ -1620,7 +1629,7 @@ bool LibraryCallKit::inline_math(vmIntrinsics::ID id) {
 }
 
 //------------------------------runtime_math-----------------------------
-bool LibraryCallKit::runtime_math(const TypeFunc* call_type, address funcAddr, const char* funcName) {
+bool LibraryCallKit::runtime_math(const TypeFunc* call_type, address funcAddr, const char* funcName, int vop) {
   assert(call_type == OptoRuntime::Math_DD_D_Type() || call_type == OptoRuntime::Math_D_D_Type(),
          "must be (DD)D or (D)D type");
 
@@ -1628,6 +1637,13 @@ bool LibraryCallKit::runtime_math(const TypeFunc* call_type, address funcAddr, c
   Node* a = round_double_node(argument(0));
   Node* b = (call_type == OptoRuntime::Math_DD_D_Type()) ? round_double_node(argument(2)) : NULL;
 
+  if (vop != 0 && VectorizeMathCalls && UseVectorStubs && UseSuperWord &&
+      Matcher::supports_vector_calling_convention()) {
+    // Keep the call as a side effect free node that SuperWord can pack.
+    set_result(_gvn.transform(new MathCallNode(C, control(), a, b, vop, funcAddr, funcName)));
+    return true;
+  }
+
   const TypePtr* no_memory_effects = NULL;
   Node* trig = make_runtime_call(RC_LEAF, call_type, funcAddr, funcName,
                                  no_memory_effects,
@@ -1697,8 +1713,8 @@ bool LibraryCallKit::inline_math_pow() {
   }
 
   return StubRoutines::dpow() != NULL ?
-    runtime_math(OptoRuntime::Math_DD_D_Type(), StubRoutines::dpow(),  "dpow") :
-    runtime_math(OptoRuntime::Math_DD_D_Type(), CAST_FROM_FN_PTR(address, SharedRuntime::dpow),  "POW");
+    runtime_math(OptoRuntime::Math_DD_D_Type(), StubRoutines::dpow(),  "dpow", VectorSupport::VECTOR_OP_POW) :
+    runtime_math(OptoRuntime::Math_DD_D_Type(), CAST_FROM_FN_PTR(address, SharedRuntime::dpow),  "POW", VectorSupport::VECTOR_OP_POW);
 }
 
 //------------------------------inline_math_native-----------------------------
@@ -1708,20 +1724,20 @@ bool LibraryCallKit::inline_math_native(vmIntrinsics::ID id) {
     // These intrinsics are not properly supported on all hardware
   case vmIntrinsics::_dsin:
     return StubRoutines::dsin() != NULL ?
-      runtime_math(OptoRuntime::Math_D_D_Type(), StubRoutines::dsin(), "dsin") :
-      runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dsin),   "SIN");
+      runtime_math(OptoRuntime::Math_D_D_Type(), StubRoutines::dsin(), "dsin", VectorSupport::VECTOR_OP_SIN) :
+      runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dsin),   "SIN", VectorSupport::VECTOR_OP_SIN);
   case vmIntrinsics::_dcos:
     return StubRoutines::dcos() != NULL ?
-      runtime_math(OptoRuntime::Math_D_D_Type(), StubRoutines::dcos(), "dcos") :
-      runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dcos),   "COS");
+      runtime_math(OptoRuntime::Math_D_D_Type(), StubRoutines::dcos(), "dcos", VectorSupport::VECTOR_OP_COS) :
+      runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dcos),   "COS", VectorSupport::VECTOR_OP_COS);
   case vmIntrinsics::_dtan:
     return StubRoutines::dtan() != NULL ?
       runtime_math(OptoRuntime::Math_D_D_Type(), StubRoutines::dtan(), "dtan") :
       runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dtan), "TAN");
   case vmIntrinsics::_dlog:
     return StubRoutines::dlog() != NULL ?
-      runtime_math(OptoRuntime::Math_D_D_Type(), StubRoutines::dlog(), "dlog") :
-      runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dlog),   "LOG");
+      runtime_math(OptoRuntime::Math_D_D_Type(), StubRoutines::dlog(), "dlog", VectorSupport::VECTOR_OP_LOG) :
+      runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dlog),   "LOG", VectorSupport::VECTOR_OP_LOG);
   case vmIntrinsics::_dlog10:
     return StubRoutines::dlog10() != NULL ?
       runtime_math(OptoRuntime::Math_D_D_Type(), StubRoutines::dlog10(), "dlog10") :
@@ -1739,8 +1755,8 @@ bool LibraryCallKit::inline_math_native(vmIntrinsics::ID id) {
 
   case vmIntrinsics::_dexp:
     return StubRoutines::dexp() != NULL ?
-      runtime_math(OptoRuntime::Math_D_D_Type(), StubRoutines::dexp(),  "dexp") :
-      runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dexp),  "EXP");
+      runtime_math(OptoRuntime::Math_D_D_Type(), StubRoutines::dexp(),  "dexp", VectorSupport::VECTOR_OP_EXP) :
+      runtime_math(OptoRuntime::Math_D_D_Type(), FN_PTR(SharedRuntime::dexp),  "EXP", VectorSupport::VECTOR_OP_EXP);
 #undef FN_PTR
 
   case vmIntrinsics::_dpow:      return inline_math_pow();
@@ -5367,6 +5383,76 @@ bool LibraryCallKit::inline_vectorizedMismatch() {
   return true;
 }
 
+//-------------inline_vectorizedHashCode------------------------------
+// int StringLatin1.hashCode(byte[] value)
+// int StringUTF16.hashCode(byte[] value)
+// int Arrays.hashCode(byte[] a), and likewise for char[], short[] and int[]
+bool LibraryCallKit::inline_vectorizedHashCode(vmIntrinsics::ID id) {
+  assert(UseVectorizedHashCodeIntrinsic, "not implemented on this platform");
+  assert(callee()->signature()->size() == 1, "hashCode has 1 parameter");
+
+  BasicType ary_bt;  // element type of the Java array
+  BasicType elem_bt; // element type the stub hashes, T_BOOLEAN for unsigned bytes
+  int initial;
+  switch (id) {
+    case vmIntrinsics::_hashCodeL: ary_bt = T_BYTE;  elem_bt = T_BOOLEAN; initial = 0; break;
+    case vmIntrinsics::_hashCodeU: ary_bt = T_BYTE;  elem_bt = T_CHAR;    initial = 0; break;
+    case vmIntrinsics::_hashCodeB: ary_bt = T_BYTE;  elem_bt = T_BYTE;    initial = 1; break;
+    case vmIntrinsics::_hashCodeC: ary_bt = T_CHAR;  elem_bt = T_CHAR;    initial = 1; break;
+    case vmIntrinsics::_hashCodeS: ary_bt = T_SHORT; elem_bt = T_SHORT;   initial = 1; break;
+    case vmIntrinsics::_hashCodeI: ary_bt = T_INT;   elem_bt = T_INT;     initial = 1; break;
+    default:
+      fatal_unexpected_iid(id);
+      return false;
+  }
+  bool is_string = (id == vmIntrinsics::_hashCodeL || id == vmIntrinsics::_hashCodeU);
+
+  enum { null_path = 1,  // Arrays.hashCode(null) is 0
+         stub_path = 2,
+         PATH_LIMIT = 3
+  };
+
+  RegionNode* exit_block = new RegionNode(PATH_LIMIT);
+  Node* result_phi = new PhiNode(exit_block, TypeInt::INT);
+  Node* memory_phi = new PhiNode(exit_block, Type::MEMORY, TypePtr::BOTTOM);
+
+  Node* ary = argument(0);
+  Node* null_ctl = top();
+  if (is_string) {
+    // The value array of a String is never null.
+    ary = must_be_not_null(ary, true);
+  } else {
+    ary = null_check_oop(ary, &null_ctl);
+  }
+  exit_block->init_req(null_path, null_ctl);
+  memory_phi->init_req(null_path, map()->memory());
+  result_phi->init_req(null_path, intcon(0));
+
+  if (!stopped()) {
+    Node* length = load_array_length(ary);
+    if (id == vmIntrinsics::_hashCodeU) {
+      length = _gvn.transform(new RShiftINode(length, intcon(1)));
+    }
+    Node* ary_start = array_element_address(ary, intcon(0), ary_bt);
+
+    Node* call = make_runtime_call(RC_LEAF,
+                                   OptoRuntime::vectorizedHashCode_Type(),
+                                   StubRoutines::vectorizedHashCode(), "vectorizedHashCode",
+                                   TypeAryPtr::get_array_body_type(ary_bt),
+                                   ary_start, length, intcon(initial), intcon(elem_bt));
+
+    exit_block->init_req(stub_path, control());
+    memory_phi->init_req(stub_path, map()->memory());
+    result_phi->init_req(stub_path, _gvn.transform(new ProjNode(call, TypeFunc::Parms)));
+  }
+
+  set_control(_gvn.transform(exit_block));
+  set_all_memory(_gvn.transform(memory_phi));
+  set_result(_gvn.transform(result_phi));
+
+  return true;
+}
+
 /**
  * Calculate CRC32 for byte.
  * int java.util.zip.CRC32.update(int crc, int b)
@@ -197,7 +197,7 @@ class LibraryCallKit : public GraphKit {
   bool inline_string_copy(bool compress);
   bool inline_string_char_access(bool is_store);
   Node* round_double_node(Node* n);
-  bool runtime_math(const TypeFunc* call_type, address funcAddr, const char* funcName);
+  bool runtime_math(const TypeFunc* call_type, address funcAddr, const char* funcName, int vop = 0);
   bool inline_math_native(vmIntrinsics::ID id);
   bool inline_math(vmIntrinsics::ID id);
   bool inline_double_math(vmIntrinsics::ID id);
@@ -302,6 +302,7 @@ class LibraryCallKit : public GraphKit {
   bool inline_montgomerySquare();
   bool inline_bigIntegerShift(bool isRightShift);
   bool inline_vectorizedMismatch();
+  bool inline_vectorizedHashCode(vmIntrinsics::ID id);
   bool inline_fma(vmIntrinsics::ID id);
   bool inline_character_compare(vmIntrinsics::ID id);
   bool inline_fp_min_max(vmIntrinsics::ID id);
@@ -939,11 +939,20 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
   uint body_size = _body.size();
   // Key test to unroll loop in CRC32 java code
   int xors_in_loop = 0;
+  // Locks of a loop invariant object, which coarsen across unrolled iterations
+  int invariant_locks_in_loop = 0;
   // Also count ModL, DivL and MulL which expand mightly
   for (uint k = 0; k < _body.size(); k++) {
     Node* n = _body.at(k);
     switch (n->Opcode()) {
       case Op_XorI: xors_in_loop++; break; // CRC32 java code
+      case Op_Lock: {
+        Node* obj = n->as_Lock()->obj_node();
+        if (UnrollLockedLoops && !is_member(phase->get_loop(phase->get_ctrl(obj)))) {
+          invariant_locks_in_loop++;
+        }
+        break;
+      }
       case Op_ModL: body_size += 30; break;
       case Op_DivL: body_size += 30; break;
       case Op_MulL: body_size += 10; break;
@@ -1004,6 +1013,13 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
     if ((cl->is_subword_loop() || xors_in_loop >= 4) && body_size < 4u * LoopUnrollLimit) {
       return phase->may_require_nodes(estimate);
     }
+    // Unrolling places the unlock of one iteration right before the lock of
+    // the next, where lock coarsening can merge them. The iterations that run
+    // under one lock are bounded by LoopMaxUnroll, and a strip mined loop
+    // still polls for safepoints in its outer loop.
+    if (invariant_locks_in_loop > 0 && body_size < 4u * LoopUnrollLimit) {
+      return phase->may_require_nodes(estimate);
+    }
     return false; // Loop too big.
   }
 
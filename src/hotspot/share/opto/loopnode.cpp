@@ -548,6 +548,155 @@ void PhaseIdealLoop::long_loop_replace_long_iv(Node* iv_to_replace, Node* inner_
   }
 }
 
+// Is exp, a long expression, of the form s * iv with s a constant?
+bool PhaseIdealLoop::is_long_scaled_iv(Node* exp, Node* iv, jlong* p_scale) {
+  if (exp == iv) {
+    *p_scale = 1;
+    return true;
+  }
+  int opc = exp->Opcode();
+  if (opc == Op_MulL) {
+    if (exp->in(1) == iv && exp->in(2)->is_Con()) {
+      *p_scale = exp->in(2)->get_long();
+      return true;
+    }
+    if (exp->in(2) == iv && exp->in(1)->is_Con()) {
+      *p_scale = exp->in(1)->get_long();
+      return true;
+    }
+  } else if (opc == Op_LShiftL) {
+    if (exp->in(1) == iv && exp->in(2)->is_Con()) {
+      jint shift = exp->in(2)->get_int();
+      if (shift >= 0 && shift < 31) {
+        *p_scale = ((jlong)1) << shift;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Is exp, a long expression, of the form s * iv + offset with s a
+// constant and offset loop invariant? If so, build the offset
+// expression (NULL if the offset is 0).
+bool PhaseIdealLoop::is_long_scaled_iv_plus_offset(Node* exp, Node* iv, IdealLoopTree* loop, jlong* p_scale, Node** p_offset, int depth) {
+  if (is_long_scaled_iv(exp, iv, p_scale)) {
+    *p_offset = NULL;
+    return true;
+  }
+  if (depth >= 2) {
+    return false;
+  }
+  int opc = exp->Opcode();
+  if (opc == Op_AddL) {
+    for (uint i = 1; i <= 2; i++) {
+      Node* inv = exp->in(3 - i);
+      Node* offset = NULL;
+      if (loop->is_invariant(inv) && is_long_scaled_iv_plus_offset(exp->in(i), iv, loop, p_scale, &offset, depth + 1)) {
+        if (offset != NULL) {
+          inv = new AddLNode(offset, inv);
+          _igvn.register_new_node_with_optimizer(inv);
+        }
+        *p_offset = inv;
+        return true;
+      }
+    }
+  } else if (opc == Op_SubL) {
+    Node* offset = NULL;
+    if (loop->is_invariant(exp->in(2)) && is_long_scaled_iv_plus_offset(exp->in(1), iv, loop, p_scale, &offset, depth + 1)) {
+      Node* neg = new SubLNode(offset != NULL ? offset : _igvn.longcon(0), exp->in(2));
+      _igvn.register_new_node_with_optimizer(neg);
+      *p_offset = neg;
+      return true;
+    }
+    if (loop->is_invariant(exp->in(1)) && is_long_scaled_iv_plus_offset(exp->in(2), iv, loop, p_scale, &offset, depth + 1)) {
+      Node* inv = exp->in(1);
+      if (offset != NULL) {
+        inv = new SubLNode(inv, offset);
+        _igvn.register_new_node_with_optimizer(inv);
+      }
+      *p_scale = -*p_scale;
+      *p_offset = inv;
+      return true;
+    }
+  }
+  return false;
+}
+
+// a - b clamped to [-vmax, vmax+1]. The difference is computed
+// without overflow.
+Node* PhaseIdealLoop::long_clamped_diff(Node* a, Node* b, jlong vmax) {
+  Node* pos = MaxNode::max_diff_with_zero(a, b, TypeLong::LONG, _igvn);
+  pos = MaxNode::unsigned_min(pos, _igvn.longcon(vmax + 1), TypeLong::make(0, vmax + 1, Type::WidenMin), _igvn);
+  Node* neg = MaxNode::max_diff_with_zero(b, a, TypeLong::LONG, _igvn);
+  neg = MaxNode::unsigned_min(neg, _igvn.longcon(vmax), TypeLong::make(0, vmax, Type::WidenMin), _igvn);
+  return _igvn.transform(new SubLNode(pos, neg));
+}
+
+// Rewrite long range checks of the inner loop of a loop nest
+// (collected by transform_long_counted_loop()):
+//
+// if ((s * phi + offset) <u range) // phi = outer_phi + inner_phi
+//
+// as:
+//
+// long L = s * outer_phi + offset;
+// int lo = (int) clamp(-L, -vmax, vmax+1);
+// int hi = (int) clamp(range - L, -vmax, vmax+1);
+// if ((s * inner_phi - lo) <u MAX(hi - lo, 0))
+//
+// where vmax = |s| * iters_max bounds |s * inner_phi|. lo and hi are
+// computed in the outer loop and are invariant in the inner loop so
+// the new check is a candidate for int range check elimination. The
+// new check fails if the long index wraps around while the original
+// check wouldn't but then execution continues in the interpreter.
+void PhaseIdealLoop::transform_long_range_checks(Node_List& range_checks, Node_List& offsets, GrowableArray<jlong>& scales,
+                                                 Node* outer_phi, Node* inner_phi, Node* inner_head, jlong iters_max) {
+  Node* zero = _igvn.longcon(0);
+  set_ctrl(zero, C->root());
+  for (uint i = 0; i < range_checks.size(); i++) {
+    Node* rc = range_checks.at(i);
+    Node* range = rc->in(1)->in(1)->in(2);
+    Node* offset = offsets.at(i);
+    jlong scale = scales.at(i);
+    jlong vmax = ABS(scale) * iters_max;
+
+    Node* outer_index = outer_phi;
+    if (scale != 1) {
+      outer_index = new MulLNode(outer_phi, _igvn.longcon(scale));
+      _igvn.register_new_node_with_optimizer(outer_index);
+    }
+    if (offset != NULL) {
+      outer_index = new AddLNode(outer_index, offset);
+      _igvn.register_new_node_with_optimizer(outer_index);
+    }
+    Node* lo = long_clamped_diff(zero, outer_index, vmax);
+    Node* hi = long_clamped_diff(range, outer_index, vmax);
+    Node* len = MaxNode::max_diff_with_zero(hi, lo, TypeLong::make(0, 2 * vmax + 1, Type::WidenMin), _igvn);
+    Node* lo_int = new ConvL2INode(lo);
+    _igvn.register_new_node_with_optimizer(lo_int);
+    Node* len_int = new ConvL2INode(len);
+    _igvn.register_new_node_with_optimizer(len_int);
+    set_subtree_ctrl(lo_int, true);
+    set_subtree_ctrl(len_int, true);
+
+    Node* inner_index = inner_phi;
+    if (scale != 1) {
+      Node* int_scale = _igvn.intcon((jint)scale);
+      set_ctrl(int_scale, C->root());
+      inner_index = new MulINode(inner_phi, int_scale);
+      register_new_node(inner_index, inner_head);
+    }
+    inner_index = new SubINode(inner_index, lo_int);
+    register_new_node(inner_index, inner_head);
+    Node* new_cmp = new CmpUNode(inner_index, len_int);
+    register_new_node(new_cmp, inner_head);
+    Node* new_bol = new BoolNode(new_cmp, BoolTest::lt);
+    register_new_node(new_bol, inner_head);
+    _igvn.replace_input_of(rc, 1, new_bol);
+  }
+}
+
 void PhaseIdealLoop::add_empty_predicate(Deoptimization::DeoptReason reason, Node* inner_head, IdealLoopTree* loop, SafePointNode* sfpt) {
   if (!C->too_many_traps(reason)) {
     Node *cont = _igvn.intcon(1);
@@ -817,6 +966,50 @@ bool PhaseIdealLoop::transform_long_counted_loop(IdealLoopTree* loop, Node_List
   assert(phi_t->_hi >= phi_t->_lo, "dead phi?");
   iters_limit = (int)MIN2((julong)iters_limit, (julong)(phi_t->_hi - phi_t->_lo));
 
+  // Collect long range checks of the form (s * phi + offset) <u range
+  // with s and offset loop invariant. Once the loop is nested, they
+  // are rewritten as int range checks on the inner loop iv. The inner
+  // loop is then run for fewer iterations so the rewritten index
+  // can't overflow an int.
+  Node_List range_checks;
+  Node_List offsets;
+  GrowableArray<jlong> scales;
+  if (TransformLongRangeChecks) {
+    jlong max_scale = 0;
+    for (uint i = 0; i < loop->_body.size(); i++) {
+      Node* rc = loop->_body.at(i);
+      if (rc->Opcode() != Op_RangeCheck || !rc->in(1)->is_Bool()) {
+        continue;
+      }
+      BoolNode* bol = rc->in(1)->as_Bool();
+      Node* rc_cmp = bol->in(1);
+      if (bol->_test._test != BoolTest::lt || rc_cmp->Opcode() != Op_CmpUL || !loop->is_invariant(rc_cmp->in(2))) {
+        continue;
+      }
+      jlong scale = 0;
+      Node* offset = NULL;
+      if (!is_long_scaled_iv_plus_offset(rc_cmp->in(1), head->phi(), loop, &scale, &offset)) {
+        continue;
+      }
+      if (scale == 0 || scale != (jint)scale || ABS(scale) > max_jint / 4) {
+        continue;
+      }
+      range_checks.push(rc);
+      offsets.push(offset);
+      scales.push(scale);
+      max_scale = MAX2(max_scale, ABS(scale));
+    }
+    if (range_checks.size() > 0) {
+      // The rewritten index is at most 2 * (max_scale * (iters_limit + |stride|)) + 1
+      jlong rc_iters_limit = (max_jint - 1) / (2 * max_scale) - ABS(stride_con);
+      if (rc_iters_limit / ABS(stride_con) < 2) {
+        range_checks.clear();
+      } else {
+        iters_limit = (int)MIN2((jlong)iters_limit, rc_iters_limit);
+      }
+    }
+  }
+
   LongCountedLoopEndNode* exit_test = head->loopexit();
   BoolTest::mask bt = exit_test->test_trip();
 
@@ -921,6 +1114,10 @@ bool PhaseIdealLoop::transform_long_counted_loop(IdealLoopTree* loop, Node_List
   // loop iv phi
   long_loop_replace_long_iv(incr, inner_incr, outer_phi, head);
 
+  if (range_checks.size() > 0) {
+    transform_long_range_checks(range_checks, offsets, scales, outer_phi, inner_phi, head, iters_limit + ABS(stride_con));
+  }
+
   set_subtree_ctrl(inner_iters_actual_int, body_populated);
 
   LoopNode* inner_head = create_inner_head(loop, head, exit_test);
@@ -5312,6 +5509,8 @@ void PhaseIdealLoop::build_loop_late_post_work(Node *n, bool pinned) {
     case Op_StrIndexOfChar:
     case Op_AryEq:
     case Op_HasNegatives:
+    case Op_MathCall:           // Pure, expanded at a legal control point
+    case Op_VectorMathCall:
       pinned = false;
     }
     if (n->is_CMove() || n->is_ConstraintCast()) {
@@ -5422,6 +5621,14 @@ void PhaseIdealLoop::build_loop_late_post_work(Node *n, bool pinned) {
   verify_strip_mined_scheduling(n, least);
   set_ctrl(n, least);
 
+  if ((n->Opcode() == Op_MathCall || n->Opcode() == Op_VectorMathCall) &&
+      !_verify_only && n->in(0) != least) {
+    // Math calls become leaf calls at their control input during macro
+    // expansion, so keep that input at a position that is dominated by
+    // all the inputs of the node.
+    _igvn.replace_input_of(n, 0, least);
+  }
+
   // Collect inner loop bodies
   IdealLoopTree *chosen_loop = get_loop(least);
   if( !chosen_loop->_child )   // Inner loop?
@@ -299,6 +299,7 @@ public:
   void set_main_no_pre_loop() { _loop_flags |= MainHasNoPreLoop; }
 
   int main_idx() const { return _main_idx; }
+  void set_main_idx(node_idx_t idx) { _main_idx = idx; }
 
 
   void set_pre_loop  (CountedLoopNode *main) { assert(is_normal_loop(),""); _loop_flags |= Pre ; _main_idx = main->_idx; }
@@ -1170,6 +1171,11 @@ public:
 
   void long_loop_replace_long_iv(Node* iv_to_replace, Node* inner_iv, Node* outer_phi, Node* inner_head);
   bool transform_long_counted_loop(IdealLoopTree* loop, Node_List &old_new);
+  bool is_long_scaled_iv(Node* exp, Node* iv, jlong* p_scale);
+  bool is_long_scaled_iv_plus_offset(Node* exp, Node* iv, IdealLoopTree* loop, jlong* p_scale, Node** p_offset, int depth = 0);
+  Node* long_clamped_diff(Node* a, Node* b, jlong vmax);
+  void transform_long_range_checks(Node_List& range_checks, Node_List& offsets, GrowableArray<jlong>& scales,
+                                   Node* outer_phi, Node* inner_phi, Node* inner_head, jlong iters_max);
 #ifdef ASSERT
   bool convert_to_long_loop(Node* cmp, Node* phi, IdealLoopTree* loop);
 #endif
@@ -1725,6 +1731,7 @@ class CountedLoopReserveKit {
     ~CountedLoopReserveKit();
     void use_new()                {_use_new = true;}
     void set_iff(IfNode* x)       {_iff = x;}
+    IfNode* iff()           const { return _iff;}
     bool has_reserved()     const { return _active && _has_reserved;}
   private:
     bool create_reserve();
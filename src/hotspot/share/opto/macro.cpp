@@ -50,6 +50,7 @@
 #include "opto/subnode.hpp"
 #include "opto/subtypenode.hpp"
 #include "opto/type.hpp"
+#include "opto/vectornode.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "utilities/macros.hpp"
@@ -1075,9 +1076,61 @@ bool PhaseMacroExpand::eliminate_allocate_node(AllocateNode *alloc) {
   return true;
 }
 
+// Replace the debug info references to the result of a boxing call with an
+// auto-box scalar object so the call can be removed. Deoptimization
+// rematerializes the box through valueOf() semantics, which keeps the
+// identity of cached boxes intact.
+bool PhaseMacroExpand::scalarize_boxing_debug_uses(CallStaticJavaNode* boxing) {
+  ProjNode* res = boxing->proj_out_or_null(TypeFunc::Parms);
+  if (res == NULL) {
+    return true;
+  }
+  ciInstanceKlass* klass = boxing->method()->holder();
+  if (!klass->is_box_cache_valid()) {
+    return false;
+  }
+  for (DUIterator_Fast imax, i = res->fast_outs(imax); i < imax; i++) {
+    Node* use = res->fast_out(i);
+    if (!use->is_SafePoint() || (use->is_Call() && use->as_Call()->has_non_debug_use(res))) {
+      return false;
+    }
+  }
+  int n_fields = klass->nof_nonstatic_fields();
+  assert(n_fields == 1, "the klass must be an auto-boxing klass");
+  const TypeOopPtr* res_type = _igvn.type(res)->isa_oopptr();
+  for (DUIterator_Last imin, i = res->last_outs(imin); i >= imin;) {
+    SafePointNode* sfpt = res->last_out(i)->as_SafePoint();
+    uint first_ind = sfpt->req() - sfpt->jvms()->scloff();
+    SafePointScalarObjectNode* sobj = new SafePointScalarObjectNode(res_type,
+#ifdef ASSERT
+                                                 boxing,
+#endif
+                                                 first_ind, n_fields, true);
+    sobj->init_req(0, C->root());
+    transform_later(sobj);
+    sfpt->add_req(boxing->in(TypeFunc::Parms));
+    JVMState* jvms = sfpt->jvms();
+    jvms->set_endoff(sfpt->req());
+    int start = jvms->debug_start();
+    int end   = jvms->debug_end();
+    int num_edges = sfpt->replace_edges_in_range(res, sobj, start, end, &_igvn);
+    _igvn._worklist.push(sfpt);
+    i -= num_edges;
+  }
+  assert(res->outcnt() == 0, "the box must have no use after replace");
+  _igvn.remove_dead_node(res);
+  return true;
+}
+
 bool PhaseMacroExpand::eliminate_boxing_node(CallStaticJavaNode *boxing) {
-  // EA should remove all uses of non-escaping boxing node.
-  if (!C->eliminate_boxing() || boxing->proj_out_or_null(TypeFunc::Parms) != NULL) {
+  if (!C->eliminate_boxing()) {
+    return false;
+  }
+  // EA should remove all uses of non-escaping boxing node. With
+  // AggressiveBoxElimination the box may still be referenced by the debug
+  // info of a scalar replaced container.
+  if (boxing->proj_out_or_null(TypeFunc::Parms) != NULL &&
+      (!AggressiveBoxElimination || !scalarize_boxing_debug_uses(boxing))) {
     return false;
   }
 
@@ -2560,6 +2613,8 @@ void PhaseMacroExpand::eliminate_macro_nodes() {
         assert(n->Opcode() == Op_LoopLimit ||
                n->Opcode() == Op_Opaque2   ||
                n->Opcode() == Op_Opaque3   ||
+               n->Opcode() == Op_MathCall  ||
+               n->Opcode() == Op_VectorMathCall ||
                BarrierSet::barrier_set()->barrier_set_c2()->is_gc_barrier_node(n),
                "unknown node type in macro list");
       }
@@ -2569,12 +2624,86 @@ void PhaseMacroExpand::eliminate_macro_nodes() {
   }
 }
 
+//------------------------------expand_math_call_node-----------------------
+// Turn a MathCall or VectorMathCall into a leaf call placed right after its
+// control input. The stubs have no side effects so the call only needs the
+// immutable memory state.
+void PhaseMacroExpand::expand_math_call_node(Node* n) {
+  Node* ctrl = n->in(0);
+  CallLeafNode* call = NULL;
+  if (n->Opcode() == Op_MathCall) {
+    MathCallNode* m = (MathCallNode*)n;
+    call = new CallLeafNode(m->tf(), m->entry(), m->name(), NULL);
+  } else {
+    VectorMathCallNode* vm = (VectorMathCallNode*)n;
+    const TypeVect* vt = vm->vect_type();
+    const TypeFunc* tf = OptoRuntime::Math_Vector_Vector_Type(vm->req() - 1, vt, vt);
+    call = new CallLeafVectorNode(tf, vm->entry(), vm->name(), NULL, vt->length_in_bytes() * BitsPerByte);
+  }
+  call->init_req(TypeFunc::Control, ctrl);
+  call->init_req(TypeFunc::I_O, top());
+  call->init_req(TypeFunc::Memory, C->immutable_memory());
+  call->init_req(TypeFunc::ReturnAdr, top());
+  call->init_req(TypeFunc::FramePtr, top());
+  if (n->Opcode() == Op_MathCall) {
+    // Doubles take two argument slots
+    call->init_req(TypeFunc::Parms + 0, n->in(1));
+    call->init_req(TypeFunc::Parms + 1, top());
+    if (n->req() == 3) {
+      call->init_req(TypeFunc::Parms + 2, n->in(2));
+      call->init_req(TypeFunc::Parms + 3, top());
+    }
+  } else {
+    for (uint i = 1; i < n->req(); i++) {
+      call->init_req(TypeFunc::Parms + i - 1, n->in(i));
+    }
+  }
+  transform_later(call);
+  Node* call_ctrl = transform_later(new ProjNode(call, TypeFunc::Control));
+  Node* result = transform_later(new ProjNode(call, TypeFunc::Parms));
+
+  // Route the control flow that followed ctrl through the call.
+  for (DUIterator_Last imin, i = ctrl->last_outs(imin); i >= imin;) {
+    Node* use = ctrl->last_out(i);
+    if (use != call && use != ctrl && use->is_CFG()) {
+      int nrep = use->replace_edge(ctrl, call_ctrl, &_igvn);
+      _igvn._worklist.push(use);
+      i -= nrep;
+    } else {
+      --i;
+    }
+  }
+
+  // Data nodes pinned at ctrl that consume the result must now be pinned
+  // after the call.
+  Unique_Node_List wq;
+  wq.push(n);
+  for (uint next = 0; next < wq.size(); next++) {
+    Node* m = wq.at(next);
+    for (DUIterator_Fast imax, j = m->fast_outs(imax); j < imax; j++) {
+      Node* use = m->fast_out(j);
+      if (use->is_CFG() || use->is_Phi()) {
+        continue;
+      }
+      if (use->in(0) == ctrl) {
+        _igvn.replace_input_of(use, 0, call_ctrl);
+      }
+      wq.push(use);
+    }
+  }
+
+  _igvn.replace_node(n, result);
+}
+
 //------------------------------expand_macro_nodes----------------------
 //  Returns true if a failure occurred.
 bool PhaseMacroExpand::expand_macro_nodes() {
   // Last attempt to eliminate macro nodes.
   eliminate_macro_nodes();
 
+  // Let the GC remove barriers on stores into the remaining allocations
+  BarrierSet::barrier_set()->barrier_set_c2()->eliminate_gc_barriers_on_allocations(this);
+
   // Eliminate Opaque and LoopLimit nodes. Do it after all loop optimizations.
   bool progress = true;
   while (progress) {
@@ -2624,6 +2753,9 @@ bool PhaseMacroExpand::expand_macro_nodes() {
         n->as_OuterStripMinedLoop()->adjust_strip_mined_loop(&_igvn);
         C->remove_macro_node(n);
         success = true;
+      } else if (n->Opcode() == Op_MathCall || n->Opcode() == Op_VectorMathCall) {
+        expand_math_call_node(n);
+        success = true;
       }
       assert(!success || (C->macro_count() == (old_macro_count - 1)), "elimination must have deleted one node from macro list");
       progress = progress || success;
@@ -330,7 +330,9 @@ void Matcher::match( ) {
   // pointers.
   Node* new_ideal_null = ConNode::make(TypePtr::NULL_PTR);
 
-  // Swap out to old-space; emptying new-space
+  // Swap out to old-space; emptying new-space. Released memory on the node
+  // free list belongs to old-space now and must not be handed to new nodes.
+  C->node_free_list()->disable();
   Arena *old = C->node_arena()->move_contents(C->old_arena());
 
   // Save debug and profile information for nodes in old space:
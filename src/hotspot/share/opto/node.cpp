@@ -308,7 +308,7 @@ inline int Node::Init(int req) {
   // Allocate memory for the necessary number of edges.
   if (req > 0) {
     // Allocate space for _in array to have double alignment.
-    _in = (Node **) ((char *) (C->node_arena()->Amalloc_D(req * sizeof(void*))));
+    _in = (Node **) ((char *) (C->node_arena_alloc(req * sizeof(void*))));
   }
   // If there are default notes floating around, capture them:
   Node_Notes* nn = C->default_node_notes();
@@ -499,7 +499,7 @@ Node::Node(Node *n0, Node *n1, Node *n2, Node *n3,
 Node *Node::clone() const {
   Compile* C = Compile::current();
   uint s = size_of();           // Size of inherited Node
-  Node *n = (Node*)C->node_arena()->Amalloc_D(size_of() + _max*sizeof(Node*));
+  Node *n = (Node*)C->node_arena_alloc(size_of() + _max*sizeof(Node*));
   Copy::conjoint_words_to_lower((HeapWord*)this, (HeapWord*)n, s);
   // Set the new input pointer array
   n->_in = (Node**)(((char*)n)+s);
@@ -627,22 +627,24 @@ void Node::destruct(PhaseValues* phase) {
 
   // Free the output edge array
   if (out_edge_size > 0) {
-    compile->node_arena()->Afree(out_array, out_edge_size);
+    compile->node_arena_free(out_array, out_edge_size);
   }
 
   // Free the input edge array and the node itself
   if( edge_end == (char*)this ) {
     // It was; free the input array and object all in one hit
 #ifndef ASSERT
-    compile->node_arena()->Afree(_in,edge_size+node_size);
+    compile->node_arena_free(_in,edge_size+node_size);
 #endif
   } else {
     // Free just the input array
-    compile->node_arena()->Afree(_in,edge_size);
+    if (edge_size > 0) {
+      compile->node_arena_free(_in,edge_size);
+    }
 
     // Free just the object
 #ifndef ASSERT
-    compile->node_arena()->Afree(this,node_size);
+    compile->node_arena_free(this,node_size);
 #endif
   }
   if (is_macro()) {
@@ -672,6 +674,18 @@ void Node::destruct(PhaseValues* phase) {
 #endif
 }
 
+// Moves an edge array to a larger block. Without ReuseDeadNodeMemory the
+// arena extends the block in place if it was the last allocation.
+static Node** grow_edge_array(Compile* C, Node** edges, uint old_max, uint new_max) {
+  if (!C->node_free_list()->is_enabled()) {
+    return (Node**)C->node_arena()->Arealloc(edges, old_max*sizeof(Node*), new_max*sizeof(Node*));
+  }
+  Node** new_edges = (Node**)C->node_arena_alloc(new_max*sizeof(Node*));
+  Copy::disjoint_words((HeapWord*)edges, (HeapWord*)new_edges, old_max);
+  C->node_arena_free(edges, old_max*sizeof(Node*));
+  return new_edges;
+}
+
 //------------------------------grow-------------------------------------------
 // Grow the input array, making space for more edges
 void Node::grow(uint len) {
@@ -691,7 +705,7 @@ void Node::grow(uint len) {
   // Trimming to limit allows a uint8 to handle up to 255 edges.
   // Previously I was using only powers-of-2 which peaked at 128 edges.
   //if( new_max >= limit ) new_max = limit-1;
-  _in = (Node**)arena->Arealloc(_in, _max*sizeof(Node*), new_max*sizeof(Node*));
+  _in = grow_edge_array(Compile::current(), _in, _max, new_max);
   Copy::zero_to_bytes(&_in[_max], (new_max-_max)*sizeof(Node*)); // NULL all new space
   _max = new_max;               // Record new max length
   // This assertion makes sure that Node::_max is wide enough to
@@ -715,7 +729,7 @@ void Node::out_grow( uint len ) {
   // Previously I was using only powers-of-2 which peaked at 128 edges.
   //if( new_max >= limit ) new_max = limit-1;
   assert(_out != NULL && _out != NO_OUT_ARRAY, "out must have sensible value");
-  _out = (Node**)arena->Arealloc(_out,_outmax*sizeof(Node*),new_max*sizeof(Node*));
+  _out = grow_edge_array(Compile::current(), _out, _outmax, new_max);
   //Copy::zero_to_bytes(&_out[_outmax], (new_max-_outmax)*sizeof(Node*)); // NULL all new space
   _outmax = new_max;               // Record new max length
   // This assertion makes sure that Node::_max is wide enough to
@@ -130,6 +130,9 @@ public:
 
   bool        _forced_inline;     // Inlining was forced by CompilerOracle, ciReplay or annotation
   bool        forced_inline()     const { return _forced_inline; }
+  bool        _hot_call_site;     // Call site passed the frequency checks of should_inline
+  bool        _budget_candidate;  // Inlining competes for the budget of UseInliningBudget
+  bool        budget_candidate()  const { return _budget_candidate; }
   // Count number of nodes in this subtree
   int         count() const;
   // Dump inlining replay data to the stream.
@@ -531,6 +534,7 @@ class Parse : public GraphKit {
   bool    seems_never_taken(float prob) const;
   bool    path_is_suitable_for_uncommon_trap(float prob) const;
   bool    seems_stable_comparison() const;
+  bool    seems_cold_for_live_allocation(float prob) const;
 
   void    do_ifnull(BoolTest::mask btest, Node* c);
   void    do_if(BoolTest::mask btest, Node* c);
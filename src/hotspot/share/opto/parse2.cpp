@@ -1555,12 +1555,37 @@ void Parse::do_if(BoolTest::mask btest, Node* c) {
   }
 }
 
+// True if the path is rarely taken and the JVM state holds an object that
+// was allocated in this compilation.  With PartialEscapeAnalysis, such a path
+// is replaced by an uncommon trap, so that an allocation which would only
+// escape on the cold path can still be scalar replaced.  The deoptimization
+// then materializes the object from its SafePointScalarObjectNode state.  If
+// the path turns out to be taken more often, seems_stable_comparison() stops
+// trapping after the recompilation.
+bool Parse::seems_cold_for_live_allocation(float prob) const {
+  if (!PartialEscapeAnalysis || !DoEscapeAnalysis || !EliminateAllocations ||
+      prob >= PartialEscapeColdBranchProbability) {
+    return false;
+  }
+  for (JVMState* jvms = this->jvms(); jvms != NULL; jvms = jvms->caller()) {
+    uint limit = jvms->stkoff() + jvms->sp();
+    for (uint i = jvms->locoff(); i < limit; i++) {
+      Node* n = map()->in(i);
+      if (n != NULL && n != top() && AllocateNode::Ideal_allocation(n, &_gvn) != NULL) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 bool Parse::path_is_suitable_for_uncommon_trap(float prob) const {
   // Don't want to speculate on uncommon traps when running with -Xcomp
   if (!UseInterpreter) {
     return false;
   }
-  return (seems_never_taken(prob) && seems_stable_comparison());
+  return ((seems_never_taken(prob) || seems_cold_for_live_allocation(prob)) &&
+          seems_stable_comparison());
 }
 
 void Parse::maybe_add_predicate_after_if(Block* path) {
@@ -553,6 +553,18 @@ int PhaseRenumberLive::update_embedded_ids(Node* n) {
     }
   }
 
+  if (n->is_CountedLoop()) {
+    // Pre and post loops refer to their main loop by id
+    CountedLoopNode* cl = n->as_CountedLoop();
+    if (cl->is_pre_loop() || cl->is_post_loop()) {
+      if (!_is_pass_finished) {
+        return -1; // delay
+      }
+      cl->set_main_idx(new_index(cl->main_idx()));
+      no_of_updates++;
+    }
+  }
+
   const Type* type = _new_type_array.fast_lookup(n->_idx);
   if (type != NULL && type->isa_oopptr() && type->is_oopptr()->is_known_instance()) {
     if (!_is_pass_finished) {
@@ -32,6 +32,7 @@
 #include "opto/divnode.hpp"
 #include "opto/graphKit.hpp"
 #include "opto/idealKit.hpp"
+#include "opto/movenode.hpp"
 #include "opto/rootnode.hpp"
 #include "opto/runtime.hpp"
 #include "opto/stringopts.hpp"
@@ -65,6 +66,7 @@ class StringConcat : public ResourceObj {
     StringMode,
     IntMode,
     CharMode,
+    BoolMode,
     StringNullCheckMode
   };
 
@@ -131,6 +133,9 @@ class StringConcat : public ResourceObj {
   void push_char(Node* value) {
     push(value, CharMode);
   }
+  void push_bool(Node* value) {
+    push(value, BoolMode);
+  }
 
   static bool is_SB_toString(Node* call) {
     if (call->is_CallStaticJava()) {
@@ -418,14 +423,17 @@ StringConcat* PhaseStringOpts::build_candidate(CallStaticJavaNode* call) {
   ciSymbol* string_sig;
   ciSymbol* int_sig;
   ciSymbol* char_sig;
+  ciSymbol* bool_sig;
   if (m->holder() == C->env()->StringBuilder_klass()) {
     string_sig = ciSymbols::String_StringBuilder_signature();
     int_sig = ciSymbols::int_StringBuilder_signature();
     char_sig = ciSymbols::char_StringBuilder_signature();
+    bool_sig = ciSymbols::bool_StringBuilder_signature();
   } else if (m->holder() == C->env()->StringBuffer_klass()) {
     string_sig = ciSymbols::String_StringBuffer_signature();
     int_sig = ciSymbols::int_StringBuffer_signature();
     char_sig = ciSymbols::char_StringBuffer_signature();
+    bool_sig = ciSymbols::bool_StringBuffer_signature();
   } else {
     return NULL;
   }
@@ -539,7 +547,9 @@ StringConcat* PhaseStringOpts::build_candidate(CallStaticJavaNode* call) {
                cnode->method()->name() == ciSymbols::append_name() &&
                (cnode->method()->signature()->as_symbol() == string_sig ||
                 cnode->method()->signature()->as_symbol() == char_sig ||
-                cnode->method()->signature()->as_symbol() == int_sig)) {
+                cnode->method()->signature()->as_symbol() == int_sig ||
+                (OptimizeBoolStringConcat &&
+                 cnode->method()->signature()->as_symbol() == bool_sig))) {
       sc->add_control(cnode);
       Node* arg = cnode->in(TypeFunc::Parms + 1);
       if (arg == NULL || arg->is_top()) {
@@ -555,6 +565,8 @@ StringConcat* PhaseStringOpts::build_candidate(CallStaticJavaNode* call) {
         sc->push_int(arg);
       } else if (cnode->method()->signature()->as_symbol() == char_sig) {
         sc->push_char(arg);
+      } else if (cnode->method()->signature()->as_symbol() == bool_sig) {
+        sc->push_bool(arg);
       } else {
         if (arg->is_Proj() && arg->in(0)->is_CallStaticJava()) {
           CallStaticJavaNode* csj = arg->in(0)->as_CallStaticJava();
@@ -1654,6 +1666,29 @@ Node* PhaseStringOpts::copy_char(GraphKit& kit, Node* val, Node* dst_array, Node
 #undef __
 #define __ kit.
 
+Node* PhaseStringOpts::bool_stringSize(GraphKit& kit, Node* arg) {
+  Node* is_true = __ Bool(__ CmpI(arg, __ intcon(0)), BoolTest::ne);
+  return __ gvn().transform(CMoveNode::make(NULL, is_true, __ intcon(5), __ intcon(4), TypeInt::make(4, 5, Type::WidenMin)));
+}
+
+// Copy "true" or "false" into dst_array starting at start. The first four
+// characters are selected branch free. The last character is 'e' in both
+// cases, so it is stored at start + size - 1 which is either the end of
+// "true" (overwriting the same value) or the end of "false".
+Node* PhaseStringOpts::bool_getChars(GraphKit& kit, Node* arg, Node* dst_array, Node* dst_coder, Node* start, Node* size) {
+  static const char t_chars[] = "true";
+  static const char f_chars[] = "fals";
+  Node* is_true = __ Bool(__ CmpI(arg, __ intcon(0)), BoolTest::ne);
+  Node* index = start;
+  for (int i = 0; i < 4; i++) {
+    Node* c = __ gvn().transform(CMoveNode::make(NULL, is_true, __ intcon(f_chars[i]), __ intcon(t_chars[i]), TypeInt::CHAR));
+    index = copy_char(kit, c, dst_array, dst_coder, index);
+  }
+  Node* last = __ AddI(start, __ LShiftI(__ SubI(size, __ intcon(1)), dst_coder));
+  copy_char(kit, __ intcon('e'), dst_array, dst_coder, last);
+  return __ AddI(start, __ LShiftI(size, dst_coder));
+}
+
 // Allocate a byte array of specified length.
 Node* PhaseStringOpts::allocate_byte_array(GraphKit& kit, IdealKit* ideal, Node* length) {
   if (ideal != NULL) {
@@ -1905,6 +1940,13 @@ void PhaseStringOpts::replace_string_concat(StringConcat* sc) {
         length = __ AddI(length, __ intcon(1));
         break;
       }
+      case StringConcat::BoolMode: {
+        // "true" or "false", always Latin1 encodable
+        Node* string_size = bool_stringSize(kit, arg);
+        length = __ AddI(length, string_size);
+        string_sizes->init_req(argi, string_size);
+        break;
+      }
       default:
         ShouldNotReachHere();
     }
@@ -1961,6 +2003,10 @@ void PhaseStringOpts::replace_string_concat(StringConcat* sc) {
             start = copy_char(kit, arg, dst_array, coder, start);
           break;
           }
+          case StringConcat::BoolMode: {
+            start = bool_getChars(kit, arg, dst_array, coder, start, string_sizes->in(argi));
+            break;
+          }
           default:
             ShouldNotReachHere();
         }
@@ -88,6 +88,12 @@ class PhaseStringOpts : public Phase {
   // Copy the char into dst_array at index start.
   Node* copy_char(GraphKit& kit, Node* val, Node* dst_array, Node* dst_coder, Node* start);
 
+  // Compute the number of characters required to represent the boolean value
+  Node* bool_stringSize(GraphKit& kit, Node* arg);
+
+  // Copy "true" or "false" into dst_array starting at index start.
+  Node* bool_getChars(GraphKit& kit, Node* arg, Node* dst_array, Node* dst_coder, Node* start, Node* size);
+
   // Allocate a byte array of specified length.
   Node* allocate_byte_array(GraphKit& kit, IdealKit* ideal, Node* length);
 
@@ -31,6 +31,7 @@
 #include "opto/castnode.hpp"
 #include "opto/convertnode.hpp"
 #include "opto/divnode.hpp"
+#include "opto/intrinsicnode.hpp"
 #include "opto/matcher.hpp"
 #include "opto/memnode.hpp"
 #include "opto/mulnode.hpp"
@@ -1096,7 +1097,9 @@ void SuperWord::dependence_graph() {
 
         int cmp = p1.cmp(p2);
         if (SuperWordRTDepCheck &&
-            p1.base() != p2.base() && p1.valid() && p2.valid()) {
+            p1.base() != p2.base() && p1.valid() && p2.valid() &&
+            _igvn.type(p1.base())->isa_aryptr() != NULL &&
+            _igvn.type(p2.base())->isa_aryptr() != NULL) {
           // Create a runtime check to disambiguate
           OrderedPair pp(p1.base(), p2.base());
           _disjoint_ptrs.append_if_missing(pp);
@@ -1250,6 +1253,7 @@ bool SuperWord::are_adjacent_refs(Node* s1, Node* s2) {
 bool SuperWord::isomorphic(Node* s1, Node* s2) {
   if (s1->Opcode() != s2->Opcode()) return false;
   if (s1->req() != s2->req()) return false;
+  if (s1->Opcode() == Op_MathCall && ((MathCallNode*)s1)->vop() != ((MathCallNode*)s2)->vop()) return false;
   if (!same_velt_type(s1, s2)) return false;
   Node* s1_ctrl = s1->in(0);
   Node* s2_ctrl = s2->in(0);
@@ -1394,6 +1398,38 @@ int SuperWord::data_size(Node* s) {
   return bsize;
 }
 
+//------------------------------longer_type_for_conversion---------------------------
+BasicType SuperWord::longer_type_for_conversion(Node* n) {
+  if (!VectorNode::is_convert_opcode(n->Opcode()) || !in_bb(n->in(1))) {
+    return T_ILLEGAL;
+  }
+  BasicType src_t = velt_basic_type(n->in(1));
+  BasicType dst_t = velt_basic_type(n);
+  if (!is_java_primitive(src_t) || !is_java_primitive(dst_t)) {
+    return T_ILLEGAL;
+  }
+  if (type2aelembytes(src_t) == type2aelembytes(dst_t)) {
+    // Same size conversions do not need any special handling.
+    return T_ILLEGAL;
+  }
+  return type2aelembytes(src_t) > type2aelembytes(dst_t) ? src_t : dst_t;
+}
+
+//------------------------------adjust_alignment_for_type_conversion---------------------------
+// The alignment of a pack is measured in bytes, so when following a def-use
+// edge through a conversion the alignment has to be scaled to the element
+// size on the other side of the conversion.
+int SuperWord::adjust_alignment_for_type_conversion(Node* s, Node* t, int align) {
+  if (align == top_align || align == bottom_align) {
+    return align;
+  }
+  if (longer_type_for_conversion(s) != T_ILLEGAL ||
+      longer_type_for_conversion(t) != T_ILLEGAL) {
+    align = align / data_size(s) * data_size(t);
+  }
+  return align;
+}
+
 //------------------------------extend_packlist---------------------------
 // Extend packset by following use->def and def->use links from pack members.
 void SuperWord::extend_packlist() {
@@ -1442,14 +1478,15 @@ bool SuperWord::follow_use_defs(Node_List* p) {
     Node* t2 = s2->in(j);
     if (!in_bb(t1) || !in_bb(t2))
       continue;
-    if (stmts_can_pack(t1, t2, align)) {
+    int t1_align = adjust_alignment_for_type_conversion(s1, t1, align);
+    if (stmts_can_pack(t1, t2, t1_align)) {
       if (est_savings(t1, t2) >= 0) {
         Node_List* pair = new Node_List();
         pair->push(t1);
         pair->push(t2);
         _packset.append(pair);
-        NOT_PRODUCT(if(is_trace_alignment()) tty->print_cr("SuperWord::follow_use_defs: set_alignment(%d, %d, %d)", t1->_idx, t2->_idx, align);)
-        set_alignment(t1, t2, align);
+        NOT_PRODUCT(if(is_trace_alignment()) tty->print_cr("SuperWord::follow_use_defs: set_alignment(%d, %d, %d)", t1->_idx, t2->_idx, t1_align);)
+        set_alignment(t1, t2, t1_align);
         changed = true;
       }
     }
@@ -1475,6 +1512,7 @@ bool SuperWord::follow_def_uses(Node_List* p) {
   int num_s1_uses = 0;
   Node* u1 = NULL;
   Node* u2 = NULL;
+  int u1_align = align;
   for (DUIterator_Fast imax, i = s1->fast_outs(imax); i < imax; i++) {
     Node* t1 = s1->fast_out(i);
     num_s1_uses++;
@@ -1485,12 +1523,14 @@ bool SuperWord::follow_def_uses(Node_List* p) {
       if (t2->Opcode() == Op_AddI && t2 == _lp->as_CountedLoop()->incr()) continue; // don't mess with the iv
       if (!opnd_positions_match(s1, t1, s2, t2))
         continue;
-      if (stmts_can_pack(t1, t2, align)) {
+      int t1_align = adjust_alignment_for_type_conversion(s1, t1, align);
+      if (stmts_can_pack(t1, t2, t1_align)) {
         int my_savings = est_savings(t1, t2);
         if (my_savings > savings) {
           savings = my_savings;
           u1 = t1;
           u2 = t2;
+          u1_align = t1_align;
         }
       }
     }
@@ -1503,8 +1543,8 @@ bool SuperWord::follow_def_uses(Node_List* p) {
     pair->push(u1);
     pair->push(u2);
     _packset.append(pair);
-    NOT_PRODUCT(if(is_trace_alignment()) tty->print_cr("SuperWord::follow_def_uses: set_alignment(%d, %d, %d)", u1->_idx, u2->_idx, align);)
-    set_alignment(u1, u2, align);
+    NOT_PRODUCT(if(is_trace_alignment()) tty->print_cr("SuperWord::follow_def_uses: set_alignment(%d, %d, %d)", u1->_idx, u2->_idx, u1_align);)
+    set_alignment(u1, u2, u1_align);
     changed = true;
   }
   return changed;
@@ -1683,8 +1723,7 @@ void SuperWord::combine_packs() {
   for (int i = 0; i < _packset.length(); i++) {
     Node_List* p1 = _packset.at(i);
     if (p1 != NULL) {
-      BasicType bt = velt_basic_type(p1->at(0));
-      uint max_vlen = Matcher::max_vector_size(bt); // Max elements in vector
+      uint max_vlen = max_vector_size_in_def_use_chain(p1->at(0)); // Max elements in vector
       assert(is_power_of_2(max_vlen), "sanity");
       uint psize = p1->size();
       if (!is_power_of_2(psize)) {
@@ -1723,6 +1762,40 @@ void SuperWord::combine_packs() {
   }
 }
 
+//-----------------------------max_vector_size_in_def_use_chain--------------------------
+// A conversion and its input end up in packs of the same length, so the
+// pack length is limited by the widest type converted from or to.
+uint SuperWord::max_vector_size_in_def_use_chain(Node* n) {
+  BasicType bt = velt_basic_type(n);
+  BasicType vt = bt;
+
+  // find the longest type among def nodes.
+  uint start, end;
+  VectorNode::vector_operands(n, &start, &end);
+  for (uint i = start; i < end; ++i) {
+    Node* input = n->in(i);
+    if (!in_bb(input)) continue;
+    BasicType newt = longer_type_for_conversion(input);
+    vt = (newt == T_ILLEGAL) ? vt : newt;
+  }
+
+  // find the longest type among use nodes.
+  for (DUIterator_Fast imax, i = n->fast_outs(imax); i < imax; i++) {
+    Node* output = n->fast_out(i);
+    if (!in_bb(output)) continue;
+    BasicType newt = longer_type_for_conversion(output);
+    vt = (newt == T_ILLEGAL) ? vt : newt;
+  }
+
+  BasicType self_t = longer_type_for_conversion(n);
+  vt = (self_t == T_ILLEGAL) ? vt : self_t;
+
+  int max = Matcher::max_vector_size(vt);
+  // If there are no vectors for the longest type, the nodes with that type
+  // are not packed in stmts_can_pack(), so fall back to the node's own type.
+  return max < 2 ? Matcher::max_vector_size(bt) : max;
+}
+
 //-----------------------------construct_my_pack_map--------------------------
 // Construct the map from nodes to packs.  Only valid after the
 // point where a node is only in one pack (after combine_packs).
@@ -2007,6 +2080,10 @@ bool SuperWord::implemented(Node_List* p) {
       } else {
         retValue = ReductionNode::implemented(opc, size, arith_type->basic_type());
       }
+    } else if (VectorNode::is_convert_opcode(opc)) {
+      retValue = VectorCastNode::implemented(opc, size, velt_basic_type(p0->in(1)), velt_basic_type(p0));
+    } else if (opc == Op_MathCall) {
+      retValue = VectorMathCallNode::implemented(((MathCallNode*)p0)->vop(), size, velt_basic_type(p0));
     } else {
       retValue = VectorNode::implemented(opc, size, velt_basic_type(p0));
     }
@@ -2432,6 +2509,15 @@ void SuperWord::output() {
     return;
   }
 
+  if (_disjoint_ptrs.length() > 0) {
+    // The packs assume that the arrays in _disjoint_ptrs are distinct, which
+    // needs the reserved scalar loop as a fallback.
+    if (!do_reserve_copy() || !insert_disjoint_ptrs_checks(make_reversable.iff())) {
+      NOT_PRODUCT(if(is_trace_loop_reverse() || TraceLoopOpts) {tty->print_cr("SWPointer::output: cannot check disjoint pointers, exiting SuperWord");})
+      return;
+    }
+  }
+
   for (int i = 0; i < _block.length(); i++) {
     Node* n = _block.at(i);
     Node_List* p = my_pack(n);
@@ -2501,6 +2587,12 @@ void SuperWord::output() {
         assert(in2->is_Con(), "Constant rounding mode expected.");
         vn = VectorNode::make(opc, in1, in2, vlen, velt_basic_type(n));
         vlen_in_bytes = vn->as_Vector()->length_in_bytes();
+      } else if (opc == Op_MathCall) {
+        Node* in1 = vector_opd(p, 1);
+        Node* in2 = (n->req() == 3) ? vector_opd(p, 2) : NULL;
+        vn = new VectorMathCallNode(C, _phase->get_ctrl(p->at(0)), in1, in2,
+                                    ((MathCallNode*)n)->vop(), TypeVect::make(velt_basic_type(n), vlen));
+        vlen_in_bytes = vn->as_Vector()->length_in_bytes();
       } else if (VectorNode::is_muladds2i(n)) {
         assert(n->req() == 5u, "MulAddS2I should have 4 operands.");
         Node* in1 = vector_opd(p, 1);
@@ -2559,6 +2651,13 @@ void SuperWord::output() {
         Node* in = vector_opd(p, 1);
         vn = VectorNode::make(opc, in, NULL, vlen, velt_basic_type(n));
         vlen_in_bytes = vn->as_Vector()->length_in_bytes();
+      } else if (VectorNode::is_convert_opcode(opc)) {
+        assert(n->req() == 2, "only one input expected");
+        BasicType bt = velt_basic_type(n);
+        Node* in = vector_opd(p, 1);
+        int vopc = VectorCastNode::opcode(in->bottom_type()->is_vect()->element_basic_type());
+        vn = VectorCastNode::make(vopc, in, bt, vlen);
+        vlen_in_bytes = vn->as_Vector()->length_in_bytes();
       } else if (is_cmov_pack(p)) {
         if (can_process_post_loop) {
           // do not refactor of flow in post loop context
@@ -2730,6 +2829,67 @@ void SuperWord::output() {
   return;
 }
 
+//------------------------------insert_disjoint_ptrs_checks---------------------------
+// Replace the condition that selects between the vectorized loop and its
+// reserved scalar copy by checks that the array bases of each pair in
+// _disjoint_ptrs differ. Distinct Java arrays never overlap, so accesses
+// to them are independent. The first pair is tested by iff itself, the
+// others by Ifs chained on its fast projection, whose failing projections
+// are merged into the entry of the scalar loop.
+bool SuperWord::insert_disjoint_ptrs_checks(IfNode* iff) {
+  Node* entry = iff->in(0);
+  for (int i = 0; i < _disjoint_ptrs.length(); i++) {
+    OrderedPair pp = _disjoint_ptrs.at(i);
+    if (!_phase->is_dominator(_phase->get_ctrl(pp.p1()), entry) ||
+        !_phase->is_dominator(_phase->get_ctrl(pp.p2()), entry)) {
+      return false;
+    }
+  }
+
+  IdealLoopTree* outer_loop = _phase->get_loop(entry);
+  Node* fast_ctrl = iff->proj_out(true);
+  Node* slow_ctrl = iff->proj_out(false);
+  LoopNode* fast_head = fast_ctrl->unique_ctrl_out()->as_Loop();
+  LoopNode* slow_head = slow_ctrl->unique_ctrl_out()->as_Loop();
+  RegionNode* slow_region = NULL;
+  if (_disjoint_ptrs.length() > 1) {
+    slow_region = new RegionNode(1);
+    slow_region->add_req(slow_ctrl);
+  }
+
+  for (int i = 0; i < _disjoint_ptrs.length(); i++) {
+    OrderedPair pp = _disjoint_ptrs.at(i);
+    Node* cmp = new CmpPNode(pp.p1(), pp.p2());
+    _phase->register_new_node(cmp, entry);
+    Node* bol = new BoolNode(cmp, BoolTest::ne);
+    _phase->register_new_node(bol, entry);
+    if (i == 0) {
+      _igvn.replace_input_of(iff, 1, bol);
+      continue;
+    }
+    IfNode* rt_check = new IfNode(fast_ctrl, bol, PROB_MAX, COUNT_UNKNOWN);
+    _phase->register_control(rt_check, outer_loop, fast_ctrl);
+    Node* iftrue = new IfTrueNode(rt_check);
+    _phase->register_control(iftrue, outer_loop, rt_check);
+    Node* iffalse = new IfFalseNode(rt_check);
+    _phase->register_control(iffalse, outer_loop, rt_check);
+    slow_region->add_req(iffalse);
+    fast_ctrl = iftrue;
+  }
+
+  _igvn.replace_input_of(fast_head, LoopNode::EntryControl, fast_ctrl);
+  _phase->set_idom(fast_head, fast_ctrl, _phase->dom_depth(fast_ctrl) + 1);
+  if (slow_region != NULL) {
+    _phase->register_control(slow_region, outer_loop, iff);
+    _igvn.replace_input_of(slow_head, LoopNode::EntryControl, slow_region);
+    _phase->set_idom(slow_head, slow_region, _phase->dom_depth(slow_region) + 1);
+  }
+  _phase->recompute_dom_depth();
+
+  NOT_PRODUCT(if (TraceLoopOpts) { tty->print_cr("SuperWord: %d runtime checks for disjoint pointers", _disjoint_ptrs.length()); })
+  return true;
+}
+
 //------------------------------vector_opd---------------------------
 // Create a vector operand for the nodes in pack p for operand: in(opd_idx)
 Node* SuperWord::vector_opd(Node_List* p, int opd_idx) {
@@ -2938,6 +3098,18 @@ bool SuperWord::is_vector_use(Node* use, int u_idx) {
   }
   if (u_pk->size() != d_pk->size())
     return false;
+  if (longer_type_for_conversion(use) != T_ILLEGAL) {
+    // A conversion between types of different sizes: the alignments
+    // of the use and the def are measured in different element sizes.
+    for (uint i = 0; i < u_pk->size(); i++) {
+      Node* ui = u_pk->at(i);
+      Node* di = d_pk->at(i);
+      if (ui->in(u_idx) != di ||
+          alignment(ui) / data_size(ui) != alignment(di) / data_size(di))
+        return false;
+    }
+    return true;
+  }
   for (uint i = 0; i < u_pk->size(); i++) {
     Node* ui = u_pk->at(i);
     Node* di = d_pk->at(i);
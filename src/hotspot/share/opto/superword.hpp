@@ -236,6 +236,9 @@ class OrderedPair {
     }
   }
 
+  Node* p1() const { return _p1; }
+  Node* p2() const { return _p2; }
+
   bool operator==(const OrderedPair &rhs) {
     return _p1 == rhs._p1 && _p2 == rhs._p2;
   }
@@ -475,6 +478,12 @@ class SuperWord : public ResourceObj {
   bool independent_path(Node* shallow, Node* deep, uint dp=0);
   void set_alignment(Node* s1, Node* s2, int align);
   int data_size(Node* s);
+  // Returns the wider of the element types of a vectorizable conversion
+  // node and its input, or T_ILLEGAL if 'n' is not such a conversion.
+  BasicType longer_type_for_conversion(Node* n);
+  // Scales the alignment of s to the element size of t if one of them is a
+  // conversion between types of different sizes.
+  int adjust_alignment_for_type_conversion(Node* s, Node* t, int align);
   // Extend packset by following use->def and def->use links from pack members.
   void extend_packlist();
   // Extend the packset by visiting operand definitions of nodes in pack p
@@ -490,6 +499,9 @@ class SuperWord : public ResourceObj {
   int unpack_cost(int ct);
   // Combine packs A and B with A.last == B.first into A.first..,A.last,B.second,..B.last
   void combine_packs();
+  // Max number of elements for a pack of n, limited by the widest type
+  // converted from or to in its def-use chain.
+  uint max_vector_size_in_def_use_chain(Node* n);
   // Construct the map from nodes to packs.
   void construct_my_pack_map();
   // Remove packs that are not implemented or not profitable.
@@ -510,6 +522,8 @@ class SuperWord : public ResourceObj {
 
   // Convert packs into vector node operations
   void output();
+  // Guard the vectorized loop with runtime checks for _disjoint_ptrs
+  bool insert_disjoint_ptrs_checks(IfNode* iff);
   // Create a vector operand for the nodes in pack p for operand: in(opd_idx)
   Node* vector_opd(Node_List* p, int opd_idx);
   // Can code be generated for pack p?
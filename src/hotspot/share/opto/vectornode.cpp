@@ -27,6 +27,8 @@
 #include "opto/mulnode.hpp"
 #include "opto/subnode.hpp"
 #include "opto/vectornode.hpp"
+#include "prims/vectorSupport.hpp"
+#include "runtime/stubRoutines.hpp"
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -327,6 +329,26 @@ bool VectorNode::is_vector_rotate_supported(int vopc, uint vlen, BasicType bt) {
   }
 }
 
+// Scalar conversions which can be vectorized by SuperWord. Conversions from
+// floating point to integral types are not included since their vector forms
+// do not implement the Java semantics for NaN and out-of-range values on all
+// platforms.
+bool VectorNode::is_convert_opcode(int opc) {
+  switch (opc) {
+  case Op_ConvI2L:
+  case Op_ConvL2I:
+  case Op_ConvI2F:
+  case Op_ConvI2D:
+  case Op_ConvL2F:
+  case Op_ConvL2D:
+  case Op_ConvF2D:
+  case Op_ConvD2F:
+    return true;
+  default:
+    return false;
+  }
+}
+
 bool VectorNode::is_shift_opcode(int opc) {
   switch (opc) {
   case Op_LShiftI:
@@ -623,6 +645,50 @@ static bool is_con_M1(Node* n) {
   return false;
 }
 
+static bool is_con_zero(Node* n) {
+  if (n->is_Con()) {
+    const Type* t = n->bottom_type();
+    if (t->isa_int() && t->is_int()->get_con() == 0) {
+      return true;
+    }
+    if (t->isa_long() && t->is_long()->get_con() == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Returns 1 if all lanes of the vector mask n are set, 0 if none are set,
+// and -1 if that is not known at compile time. Masks are either boolean
+// vectors converted by VectorLoadMask, or vectors with all bits of a lane
+// set for true lanes.
+static int constant_mask_value(Node* n) {
+  if (n->Opcode() == Op_VectorLoadMask) {
+    Node* bv = n->in(1);
+    if (bv->Opcode() == Op_ReplicateB && bv->in(1)->is_Con()) {
+      const TypeInt* t = bv->in(1)->bottom_type()->isa_int();
+      if (t != NULL) {
+        return (t->get_con() != 0) ? 1 : 0;
+      }
+    }
+    return -1;
+  }
+  switch (n->Opcode()) {
+  case Op_ReplicateB:
+  case Op_ReplicateS:
+  case Op_ReplicateI:
+  case Op_ReplicateL:
+    if (is_con_M1(n->in(1))) {
+      return 1;
+    } else if (is_con_zero(n->in(1))) {
+      return 0;
+    }
+    return -1;
+  default:
+    return -1;
+  }
+}
+
 bool VectorNode::is_all_ones_vector(Node* n) {
   switch (n->Opcode()) {
   case Op_ReplicateB:
@@ -975,6 +1041,20 @@ ReductionNode* ReductionNode::make(int opc, Node *ctrl, Node* n1, Node* n2, Basi
   }
 }
 
+Node* VectorBlendNode::Identity(PhaseGVN* phase) {
+  // VectorBlend selects vec2 for the set lanes of the mask.
+  if (vec1() == vec2()) {
+    return vec1();
+  }
+  int mask_value = constant_mask_value(vec_mask());
+  if (mask_value == 1) {
+    return vec2();
+  } else if (mask_value == 0) {
+    return vec1();
+  }
+  return this;
+}
+
 Node* VectorLoadMaskNode::Identity(PhaseGVN* phase) {
   BasicType out_bt = type()->is_vect()->element_basic_type();
   if (out_bt == T_BOOLEAN) {
@@ -1029,6 +1109,22 @@ int VectorCastNode::opcode(BasicType bt) {
   }
 }
 
+bool VectorCastNode::implemented(int opc, uint vlen, BasicType src_type, BasicType dst_type) {
+  // There are no vector casts from unsigned subword types.
+  if (src_type == T_BOOLEAN || src_type == T_CHAR) {
+    return false;
+  }
+  if (is_java_primitive(dst_type) &&
+      is_java_primitive(src_type) &&
+      (vlen > 1) && is_power_of_2(vlen) &&
+      Matcher::vector_size_supported(src_type, vlen) &&
+      Matcher::vector_size_supported(dst_type, vlen)) {
+    int vopc = VectorCastNode::opcode(src_type);
+    return vopc > 0 && Matcher::match_rule_supported_vector(vopc, vlen, dst_type);
+  }
+  return false;
+}
+
 Node* VectorCastNode::Identity(PhaseGVN* phase) {
   if (!in(1)->is_top()) {
     BasicType  in_bt = in(1)->bottom_type()->is_vect()->element_basic_type();
@@ -1309,6 +1405,26 @@ Node* VectorMaskOpNode::make(Node* mask, const Type* ty, int mopc) {
   return NULL;
 }
 
+address VectorMathCallNode::entry(int vop, uint vlen, BasicType bt) {
+  assert(vop >= VectorSupport::VECTOR_OP_SVML_START && vop <= VectorSupport::VECTOR_OP_SVML_END, "unexpected");
+  int bits = vlen * type2aelembytes(bt) * BitsPerByte;
+  if (bt != T_DOUBLE || bits < 128 || bits > 512 || !is_power_of_2(bits)) {
+    return NULL;
+  }
+  return StubRoutines::_vector_d_math[exact_log2(bits / 64)][vop - VectorSupport::VECTOR_OP_SVML_START];
+}
+
+bool VectorMathCallNode::implemented(int vop, uint vlen, BasicType bt) {
+  if (!UseVectorStubs || !Matcher::supports_vector_calling_convention() ||
+      !Matcher::vector_size_supported(bt, vlen)) {
+    return false;
+  }
+  return entry(vop, vlen, bt) != NULL;
+}
+
+const char* VectorMathCallNode::name() const {
+  return VectorSupport::svmlname[_vop - VectorSupport::VECTOR_OP_SVML_START];
+}
 
 #ifndef PRODUCT
 void VectorBoxAllocateNode::dump_spec(outputStream *st) const {
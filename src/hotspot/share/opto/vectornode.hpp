@@ -76,6 +76,7 @@ class VectorNode : public TypeNode {
   static VectorNode* make(int vopc, Node* n1, Node* n2, Node* n3, const TypeVect* vt);
 
   static bool is_shift_opcode(int opc);
+  static bool is_convert_opcode(int opc);
 
   static int  opcode(int opc, BasicType bt);
   static int replicate_opcode(BasicType bt);
@@ -1249,6 +1250,7 @@ class VectorBlendNode : public VectorNode {
   }
 
   virtual int Opcode() const;
+  virtual Node* Identity(PhaseGVN* phase);
   Node* vec1() const { return in(1); }
   Node* vec2() const { return in(2); }
   Node* vec_mask() const { return in(3); }
@@ -1335,7 +1337,7 @@ class VectorCastNode : public VectorNode {
 
   static VectorCastNode* make(int vopc, Node* n1, BasicType bt, uint vlen);
   static int  opcode(BasicType bt);
-  static bool implemented(BasicType bt, uint vlen);
+  static bool implemented(int opc, uint vlen, BasicType src_type, BasicType dst_type);
 
   virtual Node* Identity(PhaseGVN* phase);
 };
@@ -1463,6 +1465,40 @@ class VectorUnboxNode : public VectorNode {
   bool is_shuffle_to_vector() { return _shuffle_to_vector; }
 };
 
+// Vector counterpart of MathCallNode created by SuperWord. Expanded into a
+// CallLeafVector to the vector math stub during macro expansion.
+class VectorMathCallNode : public VectorNode {
+ private:
+  int _vop;   // VectorSupport operation id
+
+ protected:
+  virtual uint size_of() const { return sizeof(*this); }
+
+ public:
+  VectorMathCallNode(Compile* C, Node* ctrl, Node* in1, Node* in2, int vop, const TypeVect* vt) :
+      VectorNode(in1, vt), _vop(vop) {
+    init_req(0, ctrl);
+    if (in2 != NULL) {
+      add_req(in2);
+    }
+    init_flags(Flag_is_macro);
+    C->add_macro_node(this);
+  }
+
+  virtual int Opcode() const;
+  virtual uint hash() const { return VectorNode::hash() + _vop; }
+  virtual bool cmp(const Node& n) const {
+    return VectorNode::cmp(n) && _vop == ((VectorMathCallNode&)n)._vop;
+  }
+
+  int vop() const { return _vop; }
+  address entry() const { return entry(_vop, length(), vect_type()->element_basic_type()); }
+  const char* name() const;
+
+  static address entry(int vop, uint vlen, BasicType bt);
+  static bool implemented(int vop, uint vlen, BasicType bt);
+};
+
 class RotateRightVNode : public VectorNode {
 public:
   RotateRightVNode(Node* in1, Node* in2, const TypeVect* vt)
@@ -97,7 +97,7 @@
 #include "jvmci/jvmciCompiler.hpp"
 #endif
 
-static jint CurrentVersion = JNI_VERSION_10;
+static jint CurrentVersion = JNI_VERSION_17;
 
 #if defined(_WIN32) && !defined(USE_VECTORED_EXCEPTION_HANDLING)
 extern LONG WINAPI topLevelExceptionFilter(_EXCEPTION_POINTERS* );
@@ -2312,6 +2312,20 @@ JNI_END
 DT_VOID_RETURN_MARK_DECL(SetObjectArrayElement
                          , HOTSPOT_JNI_SETOBJECTARRAYELEMENT_RETURN());
 
+static void throw_array_store_exception(objArrayOop a, oop v, jsize index, TRAPS) {
+  ResourceMark rm(THREAD);
+  stringStream ss;
+  Klass *bottom_kl = ObjArrayKlass::cast(a->klass())->bottom_klass();
+  ss.print("type mismatch: can not store %s to %s[%d]",
+           v->klass()->external_name(),
+           bottom_kl->is_typeArray_klass() ? type2name_tab[ArrayKlass::cast(bottom_kl)->element_type()] : bottom_kl->external_name(),
+           index);
+  for (int dims = ArrayKlass::cast(a->klass())->dimension(); dims > 1; --dims) {
+    ss.print("[]");
+  }
+  THROW_MSG(vmSymbols::java_lang_ArrayStoreException(), ss.as_string());
+}
+
 JNI_ENTRY(void, jni_SetObjectArrayElement(JNIEnv *env, jobjectArray array, jsize index, jobject value))
  HOTSPOT_JNI_SETOBJECTARRAYELEMENT_ENTRY(env, array, index, value);
   DT_VOID_RETURN_MARK(SetObjectArrayElement);
@@ -2322,17 +2336,7 @@ JNI_ENTRY(void, jni_SetObjectArrayElement(JNIEnv *env, jobjectArray array, jsize
     if (v == NULL || v->is_a(ObjArrayKlass::cast(a->klass())->element_klass())) {
       a->obj_at_put(index, v);
     } else {
-      ResourceMark rm(THREAD);
-      stringStream ss;
-      Klass *bottom_kl = ObjArrayKlass::cast(a->klass())->bottom_klass();
-      ss.print("type mismatch: can not store %s to %s[%d]",
-               v->klass()->external_name(),
-               bottom_kl->is_typeArray_klass() ? type2name_tab[ArrayKlass::cast(bottom_kl)->element_type()] : bottom_kl->external_name(),
-               index);
-      for (int dims = ArrayKlass::cast(a->klass())->dimension(); dims > 1; --dims) {
-        ss.print("[]");
-      }
-      THROW_MSG(vmSymbols::java_lang_ArrayStoreException(), ss.as_string());
+      throw_array_store_exception(a, v, index, THREAD);
     }
   } else {
     ResourceMark rm(THREAD);
@@ -2816,6 +2820,27 @@ static void unlock_gc_or_unpin_object(JavaThread* thread, jobject obj) {
   }
 }
 
+// The characters of a string are in its value array, so that array is
+// what must not move, not the string.
+static typeArrayOop lock_gc_or_pin_string_value(JavaThread* thread, jstring str) {
+  if (Universe::heap()->supports_object_pinning()) {
+    const oop s = JNIHandles::resolve_non_null(str);
+    return typeArrayOop(Universe::heap()->pin_object(thread, java_lang_String::value(s)));
+  } else {
+    GCLocker::lock_critical(thread);
+    return java_lang_String::value(JNIHandles::resolve_non_null(str));
+  }
+}
+
+static void unlock_gc_or_unpin_string_value(JavaThread* thread, jstring str) {
+  if (Universe::heap()->supports_object_pinning()) {
+    const oop s = JNIHandles::resolve_non_null(str);
+    Universe::heap()->unpin_object(thread, java_lang_String::value(s));
+  } else {
+    GCLocker::unlock_critical(thread);
+  }
+}
+
 JNI_ENTRY(void*, jni_GetPrimitiveArrayCritical(JNIEnv *env, jarray array, jboolean *isCopy))
  HOTSPOT_JNI_GETPRIMITIVEARRAYCRITICAL_ENTRY(env, array, (uintptr_t *) isCopy);
   if (isCopy != NULL) {
@@ -2844,16 +2869,19 @@ JNI_END
 
 JNI_ENTRY(const jchar*, jni_GetStringCritical(JNIEnv *env, jstring string, jboolean *isCopy))
   HOTSPOT_JNI_GETSTRINGCRITICAL_ENTRY(env, string, (uintptr_t *) isCopy);
-  oop s = lock_gc_or_pin_object(thread, string);
-  typeArrayOop s_value = java_lang_String::value(s);
+  oop s = JNIHandles::resolve_non_null(string);
   bool is_latin1 = java_lang_String::is_latin1(s);
   if (isCopy != NULL) {
     *isCopy = is_latin1 ? JNI_TRUE : JNI_FALSE;
   }
   jchar* ret;
   if (!is_latin1) {
+    // Only the UTF16 characters are returned in place, a latin1 string is
+    // copied and needs no protection from the GC.
+    typeArrayOop s_value = lock_gc_or_pin_string_value(thread, string);
     ret = (jchar*) s_value->base(T_CHAR);
   } else {
+    typeArrayOop s_value = java_lang_String::value(s);
     // Inflate latin1 encoded string to UTF16
     int s_len = java_lang_String::length(s, s_value);
     ret = NEW_C_HEAP_ARRAY_RETURN_NULL(jchar, s_len + 1, mtInternal);  // add one for zero termination
@@ -2879,8 +2907,9 @@ JNI_ENTRY(void, jni_ReleaseStringCritical(JNIEnv *env, jstring str, const jchar
     // For latin1 string, free jchar array allocated by earlier call to GetStringCritical.
     // This assumes that ReleaseStringCritical bookends GetStringCritical.
     FREE_C_HEAP_ARRAY(jchar, chars);
+  } else {
+    unlock_gc_or_unpin_string_value(thread, str);
   }
-  unlock_gc_or_unpin_object(thread, str);
 HOTSPOT_JNI_RELEASESTRINGCRITICAL_RETURN();
 JNI_END
 
@@ -3113,6 +3142,35 @@ JNI_ENTRY(jobject, jni_GetModule(JNIEnv* env, jclass clazz))
 JNI_END
 
 
+// Bulk object array access, which needs a single transition into the VM
+// for a whole region, like the Get/Set<Type>ArrayRegion functions.
+
+JNI_ENTRY(void, jni_GetObjectArrayRegion(JNIEnv *env, jobjectArray array, jsize start,
+                                         jsize len, jobject *buf))
+  objArrayOop a = objArrayOop(JNIHandles::resolve_non_null(array));
+  check_bounds(start, len, a->length(), CHECK);
+  for (jsize i = 0; i < len; i++) {
+    buf[i] = JNIHandles::make_local(THREAD, a->obj_at(start + i));
+  }
+JNI_END
+
+JNI_ENTRY(void, jni_SetObjectArrayRegion(JNIEnv *env, jobjectArray array, jsize start,
+                                         jsize len, const jobject *buf))
+  objArrayOop a = objArrayOop(JNIHandles::resolve_non_null(array));
+  check_bounds(start, len, a->length(), CHECK);
+  Klass* element_klass = ObjArrayKlass::cast(a->klass())->element_klass();
+  for (jsize i = 0; i < len; i++) {
+    oop v = JNIHandles::resolve(buf[i]);
+    if (v != NULL && !v->is_a(element_klass)) {
+      // The elements before the mismatching one have been stored.
+      throw_array_store_exception(a, v, start + i, THREAD);
+      return;
+    }
+    a->obj_at_put(start + i, v);
+  }
+JNI_END
+
+
 // Structure containing all jni functions
 struct JNINativeInterface_ jni_NativeInterface = {
     NULL,
@@ -3396,7 +3454,12 @@ struct JNINativeInterface_ jni_NativeInterface = {
 
     // Module features
 
-    jni_GetModule
+    jni_GetModule,
+
+    // Bulk object array access
+
+    jni_GetObjectArrayRegion,
+    jni_SetObjectArrayRegion
 };
 
 
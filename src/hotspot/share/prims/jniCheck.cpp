@@ -1660,6 +1660,34 @@ JNI_ENTRY_CHECKED(void,
     functionExit(thr);
 JNI_END
 
+JNI_ENTRY_CHECKED(void,
+  checked_jni_GetObjectArrayRegion(JNIEnv *env,
+                                   jobjectArray array,
+                                   jsize start,
+                                   jsize len,
+                                   jobject *buf))
+    functionEnter(thr);
+    IN_VM(
+      check_is_obj_array(thr, array);
+    )
+    UNCHECKED()->GetObjectArrayRegion(env,array,start,len,buf);
+    functionExit(thr);
+JNI_END
+
+JNI_ENTRY_CHECKED(void,
+  checked_jni_SetObjectArrayRegion(JNIEnv *env,
+                                   jobjectArray array,
+                                   jsize start,
+                                   jsize len,
+                                   const jobject *buf))
+    functionEnter(thr);
+    IN_VM(
+      check_is_obj_array(thr, array);
+    )
+    UNCHECKED()->SetObjectArrayRegion(env,array,start,len,buf);
+    functionExit(thr);
+JNI_END
+
 #define WRAPPER_NewScalarArray(Return, Result) \
 JNI_ENTRY_CHECKED(Return, \
   checked_jni_New##Result##Array(JNIEnv *env, \
@@ -2304,7 +2332,12 @@ struct JNINativeInterface_  checked_jni_NativeInterface = {
 
     // Module Features
 
-    checked_jni_GetModule
+    checked_jni_GetModule,
+
+    // Bulk Object Array Access
+
+    checked_jni_GetObjectArrayRegion,
+    checked_jni_SetObjectArrayRegion
 };
 
 
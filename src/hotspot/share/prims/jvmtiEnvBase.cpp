@@ -51,6 +51,7 @@
 #include "runtime/objectMonitor.inline.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/signature.hpp"
+#include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vframe.inline.hpp"
@@ -980,13 +981,18 @@ JvmtiEnvBase::get_object_monitor_usage(JavaThread* calling_thread, jobject objec
       if (!mark.has_monitor()) {
         // this object has a lightweight monitor
 
-        if (mark.has_locker()) {
+        if (UseLightweightLocking) {
+          if (mark.is_fast_locked()) {
+            owning_thread = Threads::owning_thread_from_object(tlh.list(), hobj());
+          }
+        } else if (mark.has_locker()) {
           owner = (address)mark.locker(); // save the address of the Lock word
         }
         // implied else: no owner
       } else {
         // this object has a heavyweight monitor
-        mon = mark.monitor();
+        mon = ObjectSynchronizer::read_monitor(current_thread, hobj(), mark);
+        assert(mon != NULL, "monitors are not deflated during a safepoint");
 
         // The owner field of a heavyweight monitor may be NULL for no
         // owner, a JavaThread * or it may still be the address of the
@@ -994,7 +1000,11 @@ JvmtiEnvBase::get_object_monitor_usage(JavaThread* calling_thread, jobject objec
         // by a non-owning JavaThread, but only the owning JavaThread
         // can change the owner field from the Lock word to the
         // JavaThread * and it may not have done that yet.
-        owner = (address)mon->owner();
+        if (UseLightweightLocking && mon->is_owner_anonymous()) {
+          owning_thread = Threads::owning_thread_from_object(tlh.list(), hobj());
+        } else {
+          owner = (address)mon->owner();
+        }
       }
     }
 
@@ -1002,11 +1012,12 @@ JvmtiEnvBase::get_object_monitor_usage(JavaThread* calling_thread, jobject objec
       // This monitor is owned so we have to find the owning JavaThread.
       owning_thread = Threads::owning_thread_from_monitor_owner(tlh.list(), owner);
       assert(owning_thread != NULL, "owning JavaThread must not be NULL");
-      Handle     th(current_thread, owning_thread->threadObj());
-      ret.owner = (jthread)jni_reference(calling_thread, th);
     }
 
     if (owning_thread != NULL) {  // monitor is owned
+      Handle     th(current_thread, owning_thread->threadObj());
+      ret.owner = (jthread)jni_reference(calling_thread, th);
+
       // The recursions field of a monitor does not reflect recursions
       // as lightweight locks before inflating the monitor are not included.
       // We have to count the number of recursive monitor entries the hard way.
@@ -23,8 +23,16 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/javaClasses.inline.hpp"
+#include "jvmtifiles/jvmtiEnv.hpp"
+#include "logging/log.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "prims/jvmtiExtensions.hpp"
+#include "prims/jvmtiTagMap.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/jniHandles.inline.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/timerTrace.hpp"
 
 // the list of extension functions
 GrowableArray<jvmtiExtensionFunctionInfo*>* JvmtiExtensions::_ext_functions;
@@ -49,11 +57,76 @@ static jvmtiError JNICALL IsClassUnloadingEnabled(const jvmtiEnv* env, ...) {
   return JVMTI_ERROR_NONE;
 }
 
+// extension function, like IterateThroughHeap but with the callbacks run
+// on up to parallel_thread_num GC worker threads at the same time
+static jvmtiError JNICALL IterateThroughHeapInParallel(const jvmtiEnv* env, ...) {
+  va_list ap;
+
+  va_start(ap, env);
+  jint heap_filter = va_arg(ap, jint);
+  jclass klass = va_arg(ap, jclass);
+  const jvmtiHeapCallbacks* callbacks = va_arg(ap, const jvmtiHeapCallbacks*);
+  const void* user_data = va_arg(ap, const void*);
+  jint parallel_thread_num = va_arg(ap, jint);
+  va_end(ap);
+
+  if (!JvmtiEnv::is_vm_live()) {
+    return JVMTI_ERROR_WRONG_PHASE;
+  }
+  Thread* this_thread = Thread::current_or_null();
+  if (this_thread == NULL || !this_thread->is_Java_thread()) {
+    return JVMTI_ERROR_UNATTACHED_THREAD;
+  }
+  JavaThread* current_thread = this_thread->as_Java_thread();
+  MACOS_AARCH64_ONLY(ThreadWXEnable __wx(WXWrite, current_thread));
+  ThreadInVMfromNative __tiv(current_thread);
+  VM_ENTRY_BASE(jvmtiError, IterateThroughHeapInParallel, current_thread)
+  debug_only(VMNativeEntryWrapper __vew;)
+  PreserveExceptionMark __em(this_thread);
+
+  JvmtiEnv* jvmti_env = JvmtiEnv::JvmtiEnv_from_jvmti_env((jvmtiEnv*)env);
+  if (!jvmti_env->is_valid()) {
+    return JVMTI_ERROR_INVALID_ENVIRONMENT;
+  }
+  if (jvmti_env->get_capabilities()->can_tag_objects == 0) {
+    return JVMTI_ERROR_MUST_POSSESS_CAPABILITY;
+  }
+  if (callbacks == NULL) {
+    return JVMTI_ERROR_NULL_POINTER;
+  }
+  // The field maps used for primitive field callbacks are cached serially.
+  if (callbacks->primitive_field_callback != NULL || parallel_thread_num < 1) {
+    return JVMTI_ERROR_ILLEGAL_ARGUMENT;
+  }
+
+  // check klass if provided
+  Klass* k = NULL;
+  if (klass != NULL) {
+    oop k_mirror = JNIHandles::resolve_external_guard(klass);
+    if (k_mirror == NULL) {
+      return JVMTI_ERROR_INVALID_CLASS;
+    }
+    if (java_lang_Class::is_primitive(k_mirror)) {
+      return JVMTI_ERROR_NONE;
+    }
+    k = java_lang_Class::as_Klass(k_mirror);
+    if (k == NULL) {
+      return JVMTI_ERROR_INVALID_CLASS;
+    }
+  }
+
+  TraceTime t("IterateThroughHeapInParallel", TRACETIME_LOG(Debug, jvmti, objecttagging));
+  JvmtiTagMap::tag_map_for(jvmti_env)->iterate_through_heap_in_parallel(heap_filter, k, callbacks, user_data,
+                                                                         (uint)parallel_thread_num);
+  return JVMTI_ERROR_NONE;
+}
+
 // register extension functions and events. In this implementation we
-// have a single extension function (to prove the API) that tests if class
-// unloading is enabled or disabled. We also have a single extension event
+// have an extension function (to prove the API) that tests if class
+// unloading is enabled or disabled, and one that iterates through the heap
+// in parallel. We also have a single extension event
 // EXT_EVENT_CLASS_UNLOAD which is used to provide the JVMDI_EVENT_CLASS_UNLOAD
-// event. The function and the event are registered here.
+// event. The functions and the event are registered here.
 //
 void JvmtiExtensions::register_extensions() {
   _ext_functions = new (ResourceObj::C_HEAP, mtServiceability) GrowableArray<jvmtiExtensionFunctionInfo*>(1, mtServiceability);
@@ -74,6 +147,29 @@ void JvmtiExtensions::register_extensions() {
   };
   _ext_functions->append(&ext_func);
 
+  static jvmtiParamInfo parallel_heap_params[] = {
+    { (char*)"heap_filter", JVMTI_KIND_IN, JVMTI_TYPE_JINT, JNI_FALSE },
+    { (char*)"klass", JVMTI_KIND_IN, JVMTI_TYPE_JCLASS, JNI_TRUE },
+    { (char*)"callbacks", JVMTI_KIND_IN_PTR, JVMTI_TYPE_CVOID, JNI_FALSE },
+    { (char*)"user_data", JVMTI_KIND_IN_PTR, JVMTI_TYPE_CVOID, JNI_TRUE },
+    { (char*)"parallel_thread_num", JVMTI_KIND_IN, JVMTI_TYPE_JINT, JNI_FALSE }
+  };
+  static jvmtiError parallel_heap_errors[] = {
+    JVMTI_ERROR_MUST_POSSESS_CAPABILITY,
+    JVMTI_ERROR_INVALID_CLASS,
+    JVMTI_ERROR_ILLEGAL_ARGUMENT
+  };
+  static jvmtiExtensionFunctionInfo parallel_heap_func = {
+    (jvmtiExtensionFunction)IterateThroughHeapInParallel,
+    (char*)"com.sun.hotspot.functions.IterateThroughHeapInParallel",
+    (char*)"IterateThroughHeap with thread-safe callbacks run on GC worker threads",
+    sizeof(parallel_heap_params)/sizeof(parallel_heap_params[0]),
+    parallel_heap_params,
+    sizeof(parallel_heap_errors)/sizeof(parallel_heap_errors[0]),
+    parallel_heap_errors
+  };
+  _ext_functions->append(&parallel_heap_func);
+
   // register our extension event
 
   static jvmtiParamInfo event_params[] = {
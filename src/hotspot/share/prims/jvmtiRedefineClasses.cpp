@@ -25,7 +25,7 @@
 #include "precompiled.hpp"
 #include "cds/metaspaceShared.hpp"
 #include "classfile/classFileStream.hpp"
-#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/classLoaderDataGraph.inline.hpp"
 #include "classfile/classLoadInfo.hpp"
 #include "classfile/javaClasses.inline.hpp"
 #include "classfile/metadataOnStackMark.hpp"
@@ -36,6 +36,8 @@
 #include "classfile/vmSymbols.hpp"
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "interpreter/oopMapCache.hpp"
 #include "interpreter/rewriter.hpp"
 #include "jfr/jfrEvents.hpp"
@@ -268,8 +270,10 @@ void VM_RedefineClasses::doit() {
   // that reference methods of the evolved classes.
   // Have to do this after all classes are redefined and all methods that
   // are redefined are marked as old.
-  AdjustAndCleanMetadata adjust_and_clean_metadata(current);
-  ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
+  if (!ParallelRedefineClassesAdjust || !adjust_and_clean_metadata_in_parallel()) {
+    AdjustAndCleanMetadata adjust_and_clean_metadata(current);
+    ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
+  }
 
   // JSR-292 support
   if (_any_class_has_resolved_methods) {
@@ -3784,6 +3788,59 @@ void VM_RedefineClasses::AdjustAndCleanMetadata::do_klass(Klass* k) {
   }
 }
 
+// Collects the loaded classes so they can be handed out to workers.
+class CollectKlassesClosure : public KlassClosure {
+  GrowableArray<Klass*>* _klasses;
+ public:
+  CollectKlassesClosure(GrowableArray<Klass*>* klasses) : _klasses(klasses) {}
+  void do_klass(Klass* k) { _klasses->append(k); }
+};
+
+// Each class's AdjustAndCleanMetadata only writes to that class's own
+// metadata, so the workers can claim chunks of classes independently.
+class VM_RedefineClasses::ParallelAdjustAndCleanMetadataTask : public AbstractGangTask {
+  GrowableArray<Klass*>* _klasses;
+  volatile int _next;
+
+  static const int ChunkSize = 64;
+
+ public:
+  ParallelAdjustAndCleanMetadataTask(GrowableArray<Klass*>* klasses) :
+    AbstractGangTask("Adjust and clean metadata after redefinition"),
+    _klasses(klasses),
+    _next(0) {}
+
+  void work(uint worker_id) {
+    AdjustAndCleanMetadata adjust_and_clean_metadata(Thread::current());
+    int start;
+    while ((start = Atomic::fetch_and_add(&_next, ChunkSize)) < _klasses->length()) {
+      int end = MIN2(start + ChunkSize, _klasses->length());
+      for (int i = start; i < end; i++) {
+        adjust_and_clean_metadata.do_klass(_klasses->at(i));
+      }
+    }
+  }
+};
+
+// Returns false if there are no safepoint workers to do the work.
+bool VM_RedefineClasses::adjust_and_clean_metadata_in_parallel() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  WorkGang* gang = Universe::heap()->safepoint_workers();
+  if (gang == NULL) {
+    return false;
+  }
+  ResourceMark rm;
+  GrowableArray<Klass*> klasses((int)ClassLoaderDataGraph::num_instance_classes());
+  CollectKlassesClosure collect(&klasses);
+  ClassLoaderDataGraph::classes_do(&collect);
+
+  ParallelAdjustAndCleanMetadataTask task(&klasses);
+  gang->run_task(&task);
+  log_debug(redefine, class, update)("adjusted %d classes on %u workers",
+                                     klasses.length(), gang->active_workers());
+  return true;
+}
+
 void VM_RedefineClasses::update_jmethod_ids() {
   for (int j = 0; j < _matching_methods_length; ++j) {
     Method* old_method = _matching_old_methods[j];
@@ -522,6 +522,11 @@ class VM_RedefineClasses: public VM_Operation {
     void do_klass(Klass* k);
   };
 
+  // Runs AdjustAndCleanMetadata over the loaded classes on the GC's
+  // safepoint workers, see ParallelRedefineClassesAdjust.
+  class ParallelAdjustAndCleanMetadataTask;
+  static bool adjust_and_clean_metadata_in_parallel();
+
  public:
   VM_RedefineClasses(jint class_count,
                      const jvmtiClassDefinition *class_defs,
@@ -29,6 +29,7 @@
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workgroup.hpp"
 #include "jvmtifiles/jvmtiEnv.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
@@ -49,6 +50,7 @@
 #include "prims/jvmtiImpl.hpp"
 #include "prims/jvmtiTagMap.hpp"
 #include "prims/jvmtiTagMapTable.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/biasedLocking.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/frame.inline.hpp"
@@ -76,7 +78,8 @@ JvmtiTagMap::JvmtiTagMap(JvmtiEnv* env) :
   _lock(Mutex::nonleaf+1, "JvmtiTagMap_lock", Mutex::_allow_vm_block_flag,
         Mutex::_safepoint_check_never),
   _needs_rehashing(false),
-  _needs_cleaning(false) {
+  _needs_cleaning(false),
+  _cleaning_requests(0) {
 
   assert(JvmtiThreadState_lock->is_locked(), "sanity check");
   assert(((JvmtiEnvBase *)env)->tag_map() == NULL, "tag map already exists for environment");
@@ -187,6 +190,20 @@ static inline jlong tag_for(JvmtiTagMap* tag_map, oop o) {
 }
 
 
+// A tag change made by a callback on a parallel heap walk worker. The
+// hashmap can't change while the workers read it, so the changes are
+// applied by the VM thread once all workers are done.
+class DeferredTagUpdate {
+ public:
+  oop _o;
+  jlong _tag;
+
+  DeferredTagUpdate() : _o(NULL), _tag(0) {}
+  DeferredTagUpdate(oop o, jlong tag) : _o(o), _tag(tag) {}
+};
+
+typedef GrowableArray<DeferredTagUpdate> DeferredTagUpdates;
+
 // A CallbackWrapper is a support class for querying and tagging an object
 // around a callback to a profiler. The constructor does pre-callback
 // work to get the tag value, klass tag value, ... and the destructor
@@ -210,20 +227,24 @@ class CallbackWrapper : public StackObj {
   jlong _obj_size;
   jlong _obj_tag;
   jlong _klass_tag;
+  DeferredTagUpdates* _deferred_updates;
 
  protected:
   JvmtiTagMap* tag_map() const      { return _tag_map; }
 
-  // invoked post-callback to tag, untag, or update the tag of an object
-  void inline post_callback_tag_update(oop o, JvmtiTagMapTable* hashmap,
-                                       JvmtiTagMapEntry* entry, jlong obj_tag);
  public:
-  CallbackWrapper(JvmtiTagMap* tag_map, oop o) {
-    assert(Thread::current()->is_VM_thread() || tag_map->is_locked(),
+  // invoked post-callback to tag, untag, or update the tag of an object
+  static void inline post_callback_tag_update(oop o, JvmtiTagMapTable* hashmap,
+                                              JvmtiTagMapEntry* entry, jlong obj_tag);
+
+  CallbackWrapper(JvmtiTagMap* tag_map, oop o, DeferredTagUpdates* deferred_updates = NULL) {
+    assert(Thread::current()->is_VM_thread() || tag_map->is_locked() ||
+           (deferred_updates != NULL && SafepointSynchronize::is_at_safepoint()),
            "MT unsafe or must be VM thread");
 
     // object to tag
     _o = o;
+    _deferred_updates = deferred_updates;
 
     // object size
     _obj_size = (jlong)_o->size() * wordSize;
@@ -243,7 +264,13 @@ class CallbackWrapper : public StackObj {
   }
 
   ~CallbackWrapper() {
-    post_callback_tag_update(_o, _hashmap, _entry, _obj_tag);
+    if (_deferred_updates != NULL) {
+      if (_obj_tag != ((_entry == NULL) ? 0 : _entry->tag())) {
+        _deferred_updates->append(DeferredTagUpdate(_o, _obj_tag));
+      }
+    } else {
+      post_callback_tag_update(_o, _hashmap, _entry, _obj_tag);
+    }
   }
 
   inline jlong* obj_tag_p()                     { return &_obj_tag; }
@@ -1001,6 +1028,8 @@ class IterateThroughHeapObjectClosure: public ObjectClosure {
   int _heap_filter;
   const jvmtiHeapCallbacks* _callbacks;
   const void* _user_data;
+  DeferredTagUpdates* _deferred_updates;           // set on parallel heap walk workers
+  volatile bool* _shared_iteration_aborted;        // set on parallel heap walk workers
 
   // accessor functions
   JvmtiTagMap* tag_map() const                     { return _tag_map; }
@@ -1011,7 +1040,10 @@ class IterateThroughHeapObjectClosure: public ObjectClosure {
 
   // indicates if the iteration has been aborted
   bool _iteration_aborted;
-  bool is_iteration_aborted() const                { return _iteration_aborted; }
+  bool is_iteration_aborted() const {
+    return _iteration_aborted ||
+           (_shared_iteration_aborted != NULL && Atomic::load(_shared_iteration_aborted));
+  }
 
   // used to check the visit control flags. If the abort flag is set
   // then we set the iteration aborted flag so that the iteration completes
@@ -1020,6 +1052,9 @@ class IterateThroughHeapObjectClosure: public ObjectClosure {
     bool is_abort = (flags & JVMTI_VISIT_ABORT) != 0;
     if (is_abort) {
       _iteration_aborted = true;
+      if (_shared_iteration_aborted != NULL) {
+        Atomic::store(_shared_iteration_aborted, true);
+      }
     }
     return is_abort;
   }
@@ -1029,12 +1064,16 @@ class IterateThroughHeapObjectClosure: public ObjectClosure {
                                   Klass* klass,
                                   int heap_filter,
                                   const jvmtiHeapCallbacks* heap_callbacks,
-                                  const void* user_data) :
+                                  const void* user_data,
+                                  DeferredTagUpdates* deferred_updates = NULL,
+                                  volatile bool* shared_iteration_aborted = NULL) :
     _tag_map(tag_map),
     _klass(klass),
     _heap_filter(heap_filter),
     _callbacks(heap_callbacks),
     _user_data(user_data),
+    _deferred_updates(deferred_updates),
+    _shared_iteration_aborted(shared_iteration_aborted),
     _iteration_aborted(false)
   {
   }
@@ -1058,7 +1097,7 @@ void IterateThroughHeapObjectClosure::do_object(oop obj) {
   }
 
   // prepare for callback
-  CallbackWrapper wrapper(tag_map(), obj);
+  CallbackWrapper wrapper(tag_map(), obj, _deferred_updates);
 
   // check if filtered by the heap filter
   if (is_filtered_by_heap_filter(wrapper.obj_tag(), wrapper.klass_tag(), heap_filter())) {
@@ -1165,6 +1204,139 @@ void JvmtiTagMap::iterate_through_heap(jint heap_filter,
   VMThread::execute(&op);
 }
 
+// Runs the IterateThroughHeap callbacks on the GC's safepoint workers. Each
+// worker collects the tag changes made by its callbacks, and they are all
+// applied to the hashmap when the workers are done.
+class ParallelIterateThroughHeapTask : public AbstractGangTask {
+ private:
+  ParallelObjectIterator* _poi;
+  JvmtiTagMap* _tag_map;
+  Klass* _klass;
+  jint _heap_filter;
+  const jvmtiHeapCallbacks* _callbacks;
+  const void* _user_data;
+  volatile bool _iteration_aborted;
+  DeferredTagUpdates _updates;
+  Mutex _mutex;
+
+ public:
+  ParallelIterateThroughHeapTask(ParallelObjectIterator* poi,
+                                 JvmtiTagMap* tag_map,
+                                 Klass* klass,
+                                 jint heap_filter,
+                                 const jvmtiHeapCallbacks* callbacks,
+                                 const void* user_data) :
+      AbstractGangTask("Iterating heap for JVMTI"),
+      _poi(poi),
+      _tag_map(tag_map),
+      _klass(klass),
+      _heap_filter(heap_filter),
+      _callbacks(callbacks),
+      _user_data(user_data),
+      _iteration_aborted(false),
+      _updates(16, mtServiceability),
+      _mutex(Mutex::leaf, "Parallel JVMTI heap iteration tag update lock") {}
+
+  void work(uint worker_id) {
+    ResourceMark rm;
+    DeferredTagUpdates updates;
+    IterateThroughHeapObjectClosure blk(_tag_map, _klass, _heap_filter, _callbacks, _user_data,
+                                        &updates, &_iteration_aborted);
+    _poi->object_iterate(&blk, worker_id);
+    if (updates.is_nonempty()) {
+      MutexLocker ml(&_mutex, Mutex::_no_safepoint_check_flag);
+      _updates.appendAll(&updates);
+    }
+  }
+
+  void apply_tag_updates() {
+    assert(Thread::current()->is_VM_thread(), "must be VMThread");
+    JvmtiTagMapTable* hashmap = _tag_map->hashmap();
+    for (int i = 0; i < _updates.length(); i++) {
+      DeferredTagUpdate& update = _updates.at(i);
+      CallbackWrapper::post_callback_tag_update(update._o, hashmap,
+                                                hashmap->find(update._o), update._tag);
+    }
+    log_debug(jvmti, objecttagging)("Parallel heap iteration made %d tag updates", _updates.length());
+  }
+};
+
+class VM_ParallelIterateThroughHeapOperation: public VM_Operation {
+ private:
+  JvmtiTagMap* _tag_map;
+  Klass* _klass;
+  jint _heap_filter;
+  const jvmtiHeapCallbacks* _callbacks;
+  const void* _user_data;
+  uint _parallel_thread_num;
+
+ public:
+  VM_ParallelIterateThroughHeapOperation(JvmtiTagMap* tag_map,
+                                         Klass* klass,
+                                         jint heap_filter,
+                                         const jvmtiHeapCallbacks* callbacks,
+                                         const void* user_data,
+                                         uint parallel_thread_num) :
+    _tag_map(tag_map),
+    _klass(klass),
+    _heap_filter(heap_filter),
+    _callbacks(callbacks),
+    _user_data(user_data),
+    _parallel_thread_num(parallel_thread_num) {}
+
+  VMOp_Type type() const { return VMOp_HeapIterateOperation; }
+  void doit() {
+    // allows class files maps to be cached during iteration
+    ClassFieldMapCacheMark cm;
+
+    JvmtiTagMap::check_hashmaps_for_heapwalk();
+
+    // make sure that heap is parsable (fills TLABs with filler objects)
+    Universe::heap()->ensure_parsability(false);  // no need to retire TLABs
+
+    if (VerifyBeforeIteration) {
+      Universe::verify();
+    }
+
+    WorkGang* gang = Universe::heap()->safepoint_workers();
+    if (_parallel_thread_num > 1 && gang != NULL) {
+      // Can't run with more threads than provided by the WorkGang.
+      WithUpdatedActiveWorkers update_and_restore(gang, _parallel_thread_num);
+      ParallelObjectIterator* poi = Universe::heap()->parallel_object_iterator(gang->active_workers());
+      if (poi != NULL) {
+        ParallelIterateThroughHeapTask task(poi, _tag_map, _klass, _heap_filter, _callbacks, _user_data);
+        gang->run_task(&task);
+        delete poi;
+        task.apply_tag_updates();
+        return;
+      }
+    }
+
+    // If no parallel iteration available, run serially.
+    IterateThroughHeapObjectClosure blk(_tag_map, _klass, _heap_filter, _callbacks, _user_data);
+    Universe::heap()->object_iterate(&blk);
+  }
+};
+
+// Iterates over all objects in the heap using up to parallel_thread_num
+// GC worker threads. The callbacks must be thread-safe, and must not include
+// a primitive field callback, whose field maps are cached serially.
+void JvmtiTagMap::iterate_through_heap_in_parallel(jint heap_filter,
+                                                   Klass* klass,
+                                                   const jvmtiHeapCallbacks* callbacks,
+                                                   const void* user_data,
+                                                   uint parallel_thread_num)
+{
+  assert(callbacks->primitive_field_callback == NULL, "not supported in parallel");
+  // EA based optimizations on tagged objects are already reverted.
+  EscapeBarrier eb(!(heap_filter & JVMTI_HEAP_FILTER_UNTAGGED), JavaThread::current());
+  eb.deoptimize_objects_all_threads();
+  MutexLocker ml(Heap_lock);
+  VM_ParallelIterateThroughHeapOperation op(this, klass, heap_filter, callbacks, user_data,
+                                            parallel_thread_num);
+  VMThread::execute(&op);
+}
+
 void JvmtiTagMap::remove_dead_entries_locked(bool post_object_free) {
   assert(is_locked(), "precondition");
   if (_needs_cleaning) {
@@ -1182,6 +1354,42 @@ void JvmtiTagMap::remove_dead_entries(bool post_object_free) {
   remove_dead_entries_locked(post_object_free);
 }
 
+// Remove dead entries JvmtiTagMapCleanupChunkSize buckets at a time, so
+// SetTag and GetTag can take the lock between chunks. The scan starts over
+// if entries may have moved to buckets that were already cleaned, or if
+// another GC has found more dead entries in the meantime.
+void JvmtiTagMap::remove_dead_entries_incrementally() {
+  assert(JvmtiTagMapCleanupChunkSize > 0, "precondition");
+  JavaThread* thread = JavaThread::current();
+  int index = 0;
+  int reorganizations = -1;
+  int cleaning_requests = -1;
+  int removed = 0;
+  while (true) {
+    {
+      MutexLocker ml(lock(), Mutex::_no_safepoint_check_flag);
+      if (!_needs_cleaning) {
+        return;
+      }
+      if (hashmap()->reorganizations() != reorganizations ||
+          _cleaning_requests != cleaning_requests) {
+        reorganizations = hashmap()->reorganizations();
+        cleaning_requests = _cleaning_requests;
+        index = 0;
+      }
+      int end = MIN2(index + JvmtiTagMapCleanupChunkSize, hashmap()->table_size());
+      removed += hashmap()->remove_dead_entries(index, end);
+      index = end;
+      if (index == hashmap()->table_size()) {
+        log_info(jvmti, table)("TagMap table cleaned incrementally, removed %d", removed);
+        _needs_cleaning = false;
+        return;
+      }
+    }
+    ThreadBlockInVM tbiv(thread); // Be safepoint-polite between chunks.
+  }
+}
+
 class VM_JvmtiPostObjectFree: public VM_Operation {
   JvmtiTagMap* _tag_map;
  public:
@@ -3048,6 +3256,7 @@ void JvmtiTagMap::set_needs_cleaning() {
     JvmtiTagMap* tag_map = env->tag_map_acquire();
     if (tag_map != NULL) {
       tag_map->_needs_cleaning = !tag_map->is_empty();
+      tag_map->_cleaning_requests++;
     }
   }
 }
@@ -3091,7 +3300,11 @@ void JvmtiTagMap::flush_all_object_free_events() {
   for (JvmtiEnv* env = it.first(); env != NULL; env = it.next(env)) {
     JvmtiTagMap* tag_map = env->tag_map_acquire();
     if (tag_map != NULL) {
-      tag_map->flush_object_free_events();
+      if (JvmtiTagMapCleanupChunkSize > 0 && !env->is_enabled(JVMTI_EVENT_OBJECT_FREE)) {
+        tag_map->remove_dead_entries_incrementally();
+      } else {
+        tag_map->flush_object_free_events();
+      }
       ThreadBlockInVM tbiv(thread); // Be safepoint-polite while looping.
     }
   }
@@ -42,6 +42,7 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
   JvmtiTagMapTable*     _hashmap;                   // the hashmap for tags
   bool                  _needs_rehashing;
   bool                  _needs_cleaning;
+  int                   _cleaning_requests;         // number of GCs that asked for cleaning
 
   static bool           _has_object_free_events;
 
@@ -98,6 +99,13 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
                             const jvmtiHeapCallbacks* callbacks,
                             const void* user_data);
 
+  // iterate_through_heap on GC worker threads, see jvmtiExtensions.cpp
+  void iterate_through_heap_in_parallel(jint heap_filter,
+                                        Klass* klass,
+                                        const jvmtiHeapCallbacks* callbacks,
+                                        const void* user_data,
+                                        uint parallel_thread_num);
+
   void follow_references(jint heap_filter,
                          Klass* klass,
                          jobject initial_object,
@@ -112,6 +120,7 @@ class JvmtiTagMap :  public CHeapObj<mtInternal> {
 
   void remove_dead_entries(bool post_object_free);
   void remove_dead_entries_locked(bool post_object_free);
+  void remove_dead_entries_incrementally();
 
   static void check_hashmaps_for_heapwalk();
   static void set_needs_rehashing() NOT_JVMTI_RETURN;
@@ -48,7 +48,8 @@ oop JvmtiTagMapEntry::object_no_keepalive() {
 }
 
 JvmtiTagMapTable::JvmtiTagMapTable()
-  : Hashtable<WeakHandle, mtServiceability>(_table_size, sizeof(JvmtiTagMapEntry)) {}
+  : Hashtable<WeakHandle, mtServiceability>(_table_size, sizeof(JvmtiTagMapEntry)),
+    _reorganizations(0) {}
 
 void JvmtiTagMapTable::clear() {
   // Clear this table
@@ -181,46 +182,65 @@ void JvmtiTagMapTable::resize_if_needed() {
         // Something went wrong, turn resizing off
         _resizable = false;
       }
+      _reorganizations++;
       log_info(jvmti, table) ("JvmtiTagMap table resized to %d", table_size());
     }
   }
 }
 
+// Remove entries for dead oops from one bucket, and notify jvmti.
+int JvmtiTagMapTable::remove_dead_entries(int index, JvmtiEnv* env, bool post_object_free,
+                                          int* oops_counted) {
+  int oops_removed = 0;
+  JvmtiTagMapEntry** p = bucket_addr(index);
+  JvmtiTagMapEntry* entry = bucket(index);
+  while (entry != NULL) {
+    (*oops_counted)++;
+    oop l = entry->object_no_keepalive();
+    if (l != NULL) {
+      p = entry->next_addr();
+    } else {
+      // Entry has been removed.
+      oops_removed++;
+      log_trace(jvmti, table)("JvmtiTagMap entry removed for index %d", index);
+      jlong tag = entry->tag();
+      *p = entry->next();
+      free_entry(entry);
+
+      // post the event to the profiler
+      if (post_object_free) {
+        JvmtiExport::post_object_free(env, tag);
+      }
+
+    }
+    // get next entry
+    entry = *p;
+  }
+  return oops_removed;
+}
+
 // Serially remove entries for dead oops from the table, and notify jvmti.
 void JvmtiTagMapTable::remove_dead_entries(JvmtiEnv* env, bool post_object_free) {
   int oops_removed = 0;
   int oops_counted = 0;
   for (int i = 0; i < table_size(); ++i) {
-    JvmtiTagMapEntry** p = bucket_addr(i);
-    JvmtiTagMapEntry* entry = bucket(i);
-    while (entry != NULL) {
-      oops_counted++;
-      oop l = entry->object_no_keepalive();
-      if (l != NULL) {
-        p = entry->next_addr();
-      } else {
-        // Entry has been removed.
-        oops_removed++;
-        log_trace(jvmti, table)("JvmtiTagMap entry removed for index %d", i);
-        jlong tag = entry->tag();
-        *p = entry->next();
-        free_entry(entry);
-
-        // post the event to the profiler
-        if (post_object_free) {
-          JvmtiExport::post_object_free(env, tag);
-        }
-
-      }
-      // get next entry
-      entry = *p;
-    }
+    oops_removed += remove_dead_entries(i, env, post_object_free, &oops_counted);
   }
 
   log_info(jvmti, table) ("JvmtiTagMap entries counted %d removed %d; %s",
                           oops_counted, oops_removed, post_object_free ? "free object posted" : "no posting");
 }
 
+int JvmtiTagMapTable::remove_dead_entries(int start, int end) {
+  assert(0 <= start && start <= end && end <= table_size(), "invalid bucket range");
+  int oops_removed = 0;
+  int oops_counted = 0;
+  for (int i = start; i < end; ++i) {
+    oops_removed += remove_dead_entries(i, NULL, false /* post_object_free */, &oops_counted);
+  }
+  return oops_removed;
+}
+
 // Rehash oops in the table
 void JvmtiTagMapTable::rehash() {
   ResourceMark rm;
@@ -255,6 +275,9 @@ void JvmtiTagMapTable::rehash() {
   }
 
   int rehash_len = moved_entries.length();
+  if (rehash_len > 0) {
+    _reorganizations++;
+  }
   // Now add back in the entries that were removed.
   for (int i = 0; i < rehash_len; i++) {
     JvmtiTagMapEntry* moved_entry = moved_entries.at(i);
@@ -55,6 +55,8 @@ class JvmtiTagMapTable : public Hashtable<WeakHandle, mtServiceability> {
     _table_size  = 1007
   };
 
+  int _reorganizations;                 // number of resizes and rehashes
+
 private:
   JvmtiTagMapEntry* bucket(int i) {
     return (JvmtiTagMapEntry*) Hashtable<WeakHandle, mtServiceability>::bucket(i);
@@ -73,6 +75,8 @@ private:
 
   void resize_if_needed();
 
+  int remove_dead_entries(int index, JvmtiEnv* env, bool post_object_free, int* oops_counted);
+
 public:
   JvmtiTagMapTable();
   ~JvmtiTagMapTable();
@@ -89,6 +93,10 @@ public:
 
   // Cleanup cleared entries and post
   void remove_dead_entries(JvmtiEnv* env, bool post_object_free);
+  // Remove entries for dead oops from the buckets [start, end) without posting.
+  int remove_dead_entries(int start, int end);
+  // Changes whenever entries may have moved between buckets.
+  int reorganizations() const { return _reorganizations; }
   void rehash();
   void clear();
 };
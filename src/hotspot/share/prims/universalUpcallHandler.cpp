@@ -38,6 +38,10 @@ extern struct JavaVM_ main_vm;
 
 void ProgrammableUpcallHandler::upcall_helper(JavaThread* thread, jobject rec, address buff) {
   JavaThread* THREAD = thread; // For exception macros.
+  // A trivial downcall leaves the thread in Java state, so the function it
+  // called must not call back into Java.
+  guarantee(thread->thread_state() == _thread_in_native,
+            "upcall from a native function that was called without a thread state transition");
   ThreadInVMfromNative tiv(THREAD);
   const UpcallMethod& upcall_method = instance().upcall_method;
 
@@ -387,13 +387,45 @@ UNSAFE_ENTRY(void, Unsafe_FreeMemory0(JNIEnv *env, jobject unsafe, jlong addr))
   os::free(p);
 } UNSAFE_END
 
+typedef void (*UnsafeFillStub)(void* to, jint value, jint count);
+
+// Fill sz bytes at p with value using the jint fill stub. The stub only
+// issues naturally aligned stores once the destination is jlong aligned,
+// so the per-unit atomicity of fill_to_memory_atomic is preserved for
+// 4-byte aligned fills. Returns false if the stub can't be used.
+static bool fill_to_memory_with_stub(JavaThread* thread, void* p, size_t sz, jbyte value) {
+  address stub = StubRoutines::jint_fill();
+  if (!UseUnsafeFillStubs || stub == NULL ||
+      !is_aligned(p, BytesPerInt) || !is_aligned(sz, BytesPerInt)) {
+    return false;
+  }
+  juint v = (juint)(u1)value;
+  v |= v << 8;
+  v |= v << 16;
+
+  // The stub takes an int element count, so fill in chunks.
+  const size_t max_chunk = (size_t)1 << 30;
+  char* to = (char*)p;
+  GuardUnsafeAccess guard(thread);
+  MACOS_AARCH64_ONLY(ThreadWXEnable wx(WXExec, thread));
+  while (sz > 0) {
+    size_t chunk = MIN2(sz, max_chunk);
+    CAST_TO_FN_PTR(UnsafeFillStub, stub)(to, (jint)v, (jint)(chunk / BytesPerInt));
+    to += chunk;
+    sz -= chunk;
+  }
+  return true;
+}
+
 UNSAFE_ENTRY(void, Unsafe_SetMemory0(JNIEnv *env, jobject unsafe, jobject obj, jlong offset, jlong size, jbyte value)) {
   size_t sz = (size_t)size;
 
   oop base = JNIHandles::resolve(obj);
   void* p = index_oop_from_field_offset_long(base, offset);
 
-  Copy::fill_to_memory_atomic(p, sz, value);
+  if (!fill_to_memory_with_stub(thread, p, sz, value)) {
+    Copy::fill_to_memory_atomic(p, sz, value);
+  }
 } UNSAFE_END
 
 UNSAFE_ENTRY(void, Unsafe_CopyMemory0(JNIEnv *env, jobject unsafe, jobject srcObj, jlong srcOffset, jobject dstObj, jlong dstOffset, jlong size)) {
@@ -3134,6 +3134,19 @@ jint Arguments::finalize_vm_init_args(bool patch_mod_javabase) {
     return JNI_ERR;
   }
 
+  if (ArchiveClassesWhenIdle != NULL) {
+    if (ArchiveClassesAtExit != NULL) {
+      log_info(cds)("ArchiveClassesWhenIdle could not be set with -XX:ArchiveClassesAtExit.");
+      return JNI_ERR;
+    }
+    struct stat st;
+    if (os::stat(ArchiveClassesWhenIdle, &st) != 0) {
+      // There is no archive yet. Record what is needed to create it once the
+      // application has finished loading its classes, see DynamicArchive::dump_when_idle().
+      FLAG_SET_ERGO(RecordDynamicDumpInfo, true);
+    }
+  }
+
   if (ArchiveClassesAtExit == NULL && !RecordDynamicDumpInfo) {
     FLAG_SET_DEFAULT(DynamicDumpSharedSpaces, false);
   } else {
@@ -3551,6 +3564,10 @@ bool Arguments::init_shared_archive_paths() {
       SharedArchivePath = os::strdup_check_oom(SharedArchiveFile, mtArguments);
     }
   }
+  if (ArchiveClassesWhenIdle != NULL && !is_dumping_archive() && SharedDynamicArchivePath == NULL) {
+    // The archive has been created by an earlier run, use it as the top archive.
+    SharedDynamicArchivePath = os::strdup_check_oom(ArchiveClassesWhenIdle, mtArguments);
+  }
   return (SharedArchivePath != NULL);
 }
 #endif // INCLUDE_CDS
@@ -4024,10 +4041,45 @@ jint Arguments::apply_ergo() {
     return code;
   }
 
+#if !(defined(X86) || defined(AARCH64)) || defined(ZERO)
+  if (UseLightweightLocking) {
+    warning("UseLightweightLocking is not supported on this platform");
+    FLAG_SET_CMDLINE(UseLightweightLocking, false);
+  }
+#endif
+#if INCLUDE_JVMCI
+  if (UseLightweightLocking && EnableJVMCI) {
+    // JVMCI compilers emit their own stack-locking code.
+    warning("UseLightweightLocking is not supported with JVMCI");
+    FLAG_SET_CMDLINE(UseLightweightLocking, false);
+  }
+#endif
+  if (UseLightweightLocking && UseHeavyMonitors) {
+    // Heavy monitors take precedence, the lock stack stays unused.
+    FLAG_SET_CMDLINE(UseLightweightLocking, false);
+  }
+  if (UseObjectMonitorTable && !UseLightweightLocking) {
+    // Stack-locking and the compiled fast paths expect the monitor in the header.
+    warning("UseObjectMonitorTable requires UseLightweightLocking; ignoring UseObjectMonitorTable flag.");
+    FLAG_SET_CMDLINE(UseObjectMonitorTable, false);
+  }
+  if (UseCompactObjectHeaders) {
+    // The 64-bit header layout is defined in markWord.hpp, but the interpreter,
+    // the compilers and the garbage collectors still use the separate klass word.
+    warning("UseCompactObjectHeaders is not yet supported; ignoring UseCompactObjectHeaders flag.");
+    FLAG_SET_CMDLINE(UseCompactObjectHeaders, false);
+  }
+#if !defined(X86) || defined(ZERO)
+  if (UseInterpreterInterfaceCallCache) {
+    warning("UseInterpreterInterfaceCallCache is not supported on this platform");
+    FLAG_SET_CMDLINE(UseInterpreterInterfaceCallCache, false);
+  }
+#endif
+
   // Turn off biased locking for locking debug mode flags,
   // which are subtly different from each other but neither works with
-  // biased locking
-  if (UseHeavyMonitors
+  // biased locking. Lightweight locking replaces biased locking.
+  if (UseHeavyMonitors || UseLightweightLocking
 #ifdef COMPILER1
       || !UseFastLocking
 #endif // COMPILER1
@@ -33,6 +33,7 @@
 #include "code/nmethod.hpp"
 #include "code/pcDesc.hpp"
 #include "code/scopeDesc.hpp"
+#include "compiler/compilationCost.hpp"
 #include "compiler/compilationPolicy.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "interpreter/bytecode.hpp"
@@ -895,6 +896,30 @@ void Deoptimization::deoptimize_all_marked(nmethod* nmethod_only) {
   }
 }
 
+void Deoptimization::deoptimize_all_marked(GrowableArray<nmethod*>* marked) {
+  ResourceMark rm;
+  DeoptimizationMarker dm;
+
+  // Make the dependent methods not entrant. The caller has not allowed a
+  // safepoint since marking them, so the nmethods have not been freed.
+  {
+    MutexLocker mu(SafepointSynchronize::is_at_safepoint() ? NULL : CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    for (int i = 0; i < marked->length(); i++) {
+      nmethod* nm = marked->at(i);
+      if (nm->is_alive() && !nm->is_unloading() && nm->is_marked_for_deoptimization()) {
+        nm->make_not_entrant();
+      }
+    }
+  }
+
+  DeoptimizeMarkedClosure deopt;
+  if (SafepointSynchronize::is_at_safepoint()) {
+    Threads::java_threads_do(&deopt);
+  } else {
+    Handshake::execute(&deopt);
+  }
+}
+
 Deoptimization::DeoptAction Deoptimization::_unloaded_action
   = Deoptimization::Action_reinterpret;
 
@@ -1452,7 +1477,7 @@ bool Deoptimization::relock_objects(JavaThread* thread, GrowableArray<MonitorInf
           markWord unbiased_prototype = markWord::prototype().set_age(mark.age());
           obj->set_mark(unbiased_prototype);
         } else if (exec_mode == Unpack_none) {
-          if (mark.has_locker() && fr.sp() > (intptr_t*)mark.locker()) {
+          if (!UseLightweightLocking && mark.has_locker() && fr.sp() > (intptr_t*)mark.locker()) {
             // With exec_mode == Unpack_none obj may be thread local and locked in
             // a callee frame. In this case the bias was revoked before in revoke_for_object_deoptimization().
             // Make the lock in the callee a recursive lock and restore the displaced header.
@@ -1474,6 +1499,13 @@ bool Deoptimization::relock_objects(JavaThread* thread, GrowableArray<MonitorInf
         BasicLock* lock = mon_info->lock();
         ObjectSynchronizer::enter(obj, lock, deoptee_thread);
         assert(mon_info->owner()->is_locked(), "object must be locked now");
+        if (UseLightweightLocking && exec_mode == Unpack_none) {
+          // The deoptee is not the current thread, so its lock stack can not
+          // express where this lock belongs among its other locks. Inflate
+          // the lock instead, after entering to avoid racing with deflation.
+          ObjectMonitor* mon = ObjectSynchronizer::inflate(deoptee_thread, obj(), ObjectSynchronizer::inflate_cause_vm_internal);
+          assert(mon->owner() == deoptee_thread, "must be");
+        }
       }
     }
   }
@@ -1989,6 +2021,10 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* current, jint tr
     Bytecodes::Code trap_bc     = trap_method->java_code_at(trap_bci);
     // Record this event in the histogram.
     gather_statistics(reason, action, trap_bc);
+    if (CompilationCostAccounting) {
+      // Charge the compiled method, which is the one that gets recompiled.
+      CompilationCost::record_deoptimization(nm->method(), reason);
+    }
 
     // Ensure that we can record deopt. history:
     // Need MDO to record RTM code generation state.
@@ -150,6 +150,8 @@ class Deoptimization : AllStatic {
   // marked_for_deoptimization and made not_entrant.  Otherwise a scan of the code cache is done to
   // find all marked nmethods and they are made not_entrant.
   static void deoptimize_all_marked(nmethod* nmethod_only = NULL);
+  // Same as above for the given marked nmethods, without a scan of the code cache.
+  static void deoptimize_all_marked(GrowableArray<nmethod*>* marked);
 
  private:
   // Revoke biased locks at deopt.
@@ -354,6 +354,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, UseVectorizedMismatchIntrinsic, false, DIAGNOSTIC,          \
           "Enables intrinsification of ArraysSupport.vectorizedMismatch()") \
                                                                             \
+  product(bool, UseVectorizedHashCodeIntrinsic, false, EXPERIMENTAL,        \
+          "Enables vectorized intrinsics for StringLatin1.hashCode(), "     \
+          "StringUTF16.hashCode() and Arrays.hashCode() of byte[], "        \
+          "char[], short[] and int[]")                                      \
+                                                                            \
   product(bool, UseCopySignIntrinsic, false, DIAGNOSTIC,                    \
           "Enables intrinsification of Math.copySign")                      \
                                                                             \
@@ -420,6 +425,26 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, AbortVMOnSafepointTimeout, false, DIAGNOSTIC,               \
           "Abort upon failure to reach safepoint (see SafepointTimeout)")   \
                                                                             \
+  product(bool, ParallelSafepointSynchronization, false, EXPERIMENTAL,      \
+          "Use the safepoint workers of the GC to arm the thread polls "    \
+          "and to wait for the threads to reach a safepoint")               \
+                                                                            \
+  product(uint, ParallelSafepointSynchronizationMinThreads, 1024,           \
+          EXPERIMENTAL,                                                     \
+          "The minimum number of Java threads for which "                   \
+          "ParallelSafepointSynchronization is used")                       \
+          range(1, max_jint)                                                \
+                                                                            \
+  product(bool, CoalesceVMOperations, false, EXPERIMENTAL,                  \
+          "Let VM operations that allow it wait for the next safepoint "    \
+          "instead of waiting for their own, when the VM thread is "        \
+          "already busy with another operation")                            \
+                                                                            \
+  product(bool, UseHandshakeThreadDump, false, EXPERIMENTAL,                \
+          "Take thread dumps without locked synchronizers by handshaking "  \
+          "with each thread in turn instead of stopping all threads at "    \
+          "a safepoint")                                                    \
+                                                                            \
   product(bool, AbortVMOnVMOperationTimeout, false, DIAGNOSTIC,             \
           "Abort upon failure to complete VM operation promptly")           \
                                                                             \
@@ -443,6 +468,10 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, BytecodeVerificationLocal, false, DIAGNOSTIC,               \
           "Enable the Java bytecode verifier for local classes")            \
                                                                             \
+  product(bool, VerifierCacheAssignability, false, EXPERIMENTAL,            \
+          "Remember successful reference assignability checks while "       \
+          "verifying a class to avoid repeating class resolution")          \
+                                                                            \
   develop(bool, VerifyStackAtCalls, false,                                  \
           "Verify that the stack pointer is unchanged after calls")         \
                                                                             \
@@ -455,6 +484,11 @@ const intx ObjectAlignmentInBytes = 8;
   develop(bool, UseMallocOnly, false,                                       \
           "Use only malloc/free for allocation (no resource area/arena)")   \
                                                                             \
+  product(bool, UseThreadLocalChunkCache, false, EXPERIMENTAL,              \
+          "Cache one arena chunk of each pooled size per thread, so that "  \
+          "most arena growth and release avoids the global chunk pools"     \
+          " and their ThreadCritical lock")                                 \
+                                                                            \
   develop(bool, ZapResourceArea, trueInDebug,                               \
           "Zap freed resource/arena space with 0xABABABAB")                 \
                                                                             \
@@ -548,6 +582,13 @@ const intx ObjectAlignmentInBytes = 8;
   product(ccstr, NativeMemoryTracking, "off",                               \
           "Native memory tracking options")                                 \
                                                                             \
+  product(size_t, NMTMallocSiteSampleInterval, 0, EXPERIMENTAL,             \
+          "With detail native memory tracking, capture the call stack of "  \
+          "a geometric sample of the malloced bytes with this mean "        \
+          "interval, and estimate the malloc sites from the samples. "      \
+          "Virtual memory is then recorded without call stacks. "           \
+          "0 captures the call stack of every malloc")                      \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -677,6 +718,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, DynamicallyResizeSystemDictionaries, true, DIAGNOSTIC,      \
           "Dynamically resize system dictionaries as needed")               \
                                                                             \
+  product(int, DictionaryResizeLoadFactor, 5, EXPERIMENTAL,                 \
+          "Average number of classes per bucket of a class loader's "       \
+          "dictionary that triggers resizing it at the next safepoint")     \
+          range(1, 100)                                                     \
+                                                                            \
   product(bool, AlwaysLockClassLoader, false,                               \
           "(Deprecated) Require the VM to acquire the class loader lock "   \
           "before calling loadClass() even for class loaders registering "  \
@@ -686,6 +732,26 @@ const intx ObjectAlignmentInBytes = 8;
           "Allow parallel defineClass requests for class loaders "          \
           "registering as parallel capable")                                \
                                                                             \
+  product(bool, PrefetchClassPathZipFiles, false, EXPERIMENTAL,             \
+          "Ask the OS to start reading jar files opened by the VM's class " \
+          "path entries in the background, ahead of the class lookups")     \
+                                                                            \
+  product(ccstr, PreParseClassList, NULL, EXPERIMENTAL,                     \
+          "A class list, in the format written by DumpLoadedClassList. "    \
+          "At startup, the classfiles in the modules image of the listed "  \
+          "classes are read and pre-parsed in parallel, so that their "     \
+          "later loading is faster")                                        \
+                                                                            \
+  product(uint, PreParseClassListThreads, 0, EXPERIMENTAL,                  \
+          "Number of threads used for PreParseClassList, 0 means the "      \
+          "number of GC worker threads")                                    \
+                                                                            \
+  product(ccstr, FieldLayoutHotFields, NULL, EXPERIMENTAL,                  \
+          "A file listing frequently accessed instance fields, one "        \
+          "\"<class name> <field name>\" per line with the class name in "  \
+          "internal form. These fields are laid out together at the "       \
+          "start of the fields of their class")                             \
+                                                                            \
   product_pd(bool, DontYieldALot,                                           \
           "Throw away obvious excess yield calls")                          \
                                                                             \
@@ -760,6 +826,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, UseFastJNIAccessors, true,                                  \
           "Use optimized versions of Get<Primitive>Field")                  \
                                                                             \
+  product(bool, UseJNIHandleCache, false, EXPERIMENTAL,                     \
+          "Cache free JNI global and weak global handles in each Java "     \
+          "thread to reduce contention when creating and deleting "         \
+          "them. Ignored with CheckJNICalls")                               \
+                                                                            \
   product(intx, MaxJNILocalCapacity, 65536,                                 \
           "Maximum allowable local JNI handle capacity to "                 \
           "EnsureLocalCapacity() and PushLocalFrame(), "                    \
@@ -866,6 +937,11 @@ const intx ObjectAlignmentInBytes = 8;
           "(Deprecated) Allow redefinition to add and delete private "      \
           "static or final methods for compatibility with old releases")    \
                                                                             \
+  product(bool, ParallelRedefineClassesAdjust, false, EXPERIMENTAL,         \
+          "Use the GC's safepoint workers to adjust the constant pool "     \
+          "caches, vtables and itables of all loaded classes after a "      \
+          "class redefinition")                                             \
+                                                                            \
   develop(bool, TraceBytecodes, false,                                      \
           "Trace bytecode execution")                                       \
                                                                             \
@@ -899,6 +975,11 @@ const intx ObjectAlignmentInBytes = 8;
   develop(bool, TraceOopMapRewrites, false,                                 \
           "Trace rewriting of methods during oop map generation")           \
                                                                             \
+  product(int, InterpreterOopMapCacheSize, 32, EXPERIMENTAL,                \
+          "Number of entries in the per-class cache of oop maps for "       \
+          "interpreted frames")                                             \
+          range(32, 4096)                                                   \
+                                                                            \
   develop(bool, TraceICBuffer, false,                                       \
           "Trace usage of IC buffer")                                       \
                                                                             \
@@ -938,6 +1019,12 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, VerifyBeforeIteration, false, DIAGNOSTIC,                   \
           "Verify memory system before JVMTI iteration")                    \
                                                                             \
+  product(int, JvmtiTagMapCleanupChunkSize, 0, EXPERIMENTAL,                \
+          "If > 0, the service thread removes dead JVMTI tag map entries "  \
+          "this many buckets at a time, releasing the tag map lock in "     \
+          "between, when no ObjectFree events need to be posted")           \
+          range(0, max_jint)                                                \
+                                                                            \
   /* compiler */                                                            \
                                                                             \
   /* notice: the max range value here is max_jint, not max_intx  */         \
@@ -957,6 +1044,17 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, TraceCompilerThreads, false, DIAGNOSTIC,                    \
              "Trace creation and removal of compiler threads")              \
                                                                             \
+  product(uintx, CompilerCPUBudget, 0, EXPERIMENTAL,                        \
+          "Percentage of the active processors that the threads of each "    \
+          "compiler may use before they are throttled. 0 means unlimited")  \
+          range(0, 100)                                                     \
+                                                                            \
+  product(bool, CompilationCostAccounting, false, EXPERIMENTAL,             \
+          "Account the time spent compiling each method per tier, its "     \
+          "compiled code size, OSR compilations and deoptimizations by "    \
+          "reason. Printed by the Compiler.stats diagnostic command and "   \
+          "sent as MethodCompilationCost JFR events")                       \
+                                                                            \
   develop(bool, InjectCompilerCreationFailure, false,                       \
           "Inject thread creation failures for "                            \
           "UseDynamicNumberOfCompilerThreads")                              \
@@ -983,6 +1081,25 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, EnableThreadSMRStatistics, trueInDebug, DIAGNOSTIC,         \
              "Enable Thread SMR Statistics")                                \
                                                                             \
+  product(uint, ThreadSMRFreeListBatchSize, 1, EXPERIMENTAL,                \
+          "Number of retired ThreadsLists that are collected before the "   \
+          "hazard pointers of all threads are scanned to free them. "       \
+          "Larger values make thread start and exit cheaper with many "     \
+          "threads, at the cost of keeping more ThreadsLists alive.")       \
+          range(1, 1024)                                                    \
+                                                                            \
+  product(uint, GlobalCounterReaderGroups, 0, EXPERIMENTAL,                 \
+          "Number of shared reader counters used by GlobalCounter. "        \
+          "Readers are hashed to a counter, and write_synchronize scans "   \
+          "the counters instead of all threads. 0 uses per-thread "         \
+          "counters.")                                                      \
+          range(0, 256)                                                     \
+                                                                            \
+  product(bool, ProfileVMLocks, false, DIAGNOSTIC,                          \
+          "Count acquisitions of VM mutexes and monitors and measure the "  \
+          "time spent blocked on and holding them. Printed by the "         \
+          "VM.mutex_stats diagnostic command")                              \
+                                                                            \
   product(bool, UseNotificationThread, true,                                \
           "Use Notification Thread")                                        \
                                                                             \
@@ -1106,6 +1223,26 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, UseHeavyMonitors, false,                                    \
           "use heavyweight instead of lightweight Java monitors")           \
                                                                             \
+  product(bool, LimitMonitorSpinnersToCPUs, false, EXPERIMENTAL,            \
+          "Do not let more threads spin for contended monitors than "       \
+          "there are active processors left for them, according to "        \
+          "os::active_processor_count() (e.g. the container CPU quota)")    \
+                                                                            \
+  product(bool, UseLightweightLocking, false, EXPERIMENTAL,                 \
+          "Lock objects by only clearing the lock bits of the header and "  \
+          "recording the object on a per-thread lock stack, instead of "    \
+          "displacing the header to the stack. Disables biased locking")    \
+                                                                            \
+  product(bool, UseObjectMonitorTable, false, EXPERIMENTAL,                 \
+          "With UseLightweightLocking, find inflated monitors in a "        \
+          "concurrent hash table instead of storing them in the object "    \
+          "header, which keeps the identity hash in the header")            \
+                                                                            \
+  product(bool, UseCompactObjectHeaders, false, EXPERIMENTAL,               \
+          "Store the narrow klass pointer in the upper bits of the mark "   \
+          "word instead of a separate header word. Not yet supported by "   \
+          "the interpreter, the compilers and the garbage collectors")      \
+                                                                            \
   product(bool, PrintStringTableStatistics, false,                          \
           "print statistics about the StringTable and SymbolTable")         \
                                                                             \
@@ -1187,6 +1324,11 @@ const intx ObjectAlignmentInBytes = 8;
   product_pd(bool, RewriteFrequentPairs,                                    \
           "Rewrite frequently used bytecode pairs into a single bytecode")  \
                                                                             \
+  product(bool, UseInterpreterInterfaceCallCache, false, EXPERIMENTAL,      \
+          "Remember the last target of each invokeinterface call site in "  \
+          "the interpreter and reuse it for receivers of the same class, "  \
+          "instead of searching the itable")                                \
+                                                                            \
   product(bool, PrintInterpreter, false, DIAGNOSTIC,                        \
           "Print the generated interpreter code")                           \
                                                                             \
@@ -1404,6 +1546,11 @@ const intx ObjectAlignmentInBytes = 8;
           "allocate (for testing only)")                                    \
           range(0, max_uintx)                                               \
                                                                             \
+  product(bool, UsePooledCHeapObjs, false, EXPERIMENTAL,                    \
+          "Allocate selected small, frequently allocated C-heap objects "   \
+          "from per-memory-type size-class pools instead of malloc. "       \
+          "Freed blocks are retained for reuse")                            \
+                                                                            \
   product(intx, TypeProfileWidth, 2,                                        \
           "Number of receiver types to record in call/cast profile")        \
           range(0, 8)                                                       \
@@ -1478,6 +1625,18 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, MetaspaceHandleDeallocations, true, DIAGNOSTIC,             \
           "Switch off Metapace deallocation handling.")                     \
                                                                             \
+  product(size_t, MetaspaceAllocationWindowSize, 0, EXPERIMENTAL,           \
+          "Size in bytes of the windows that metaspace arenas hand out to " \
+          "the threads allocating from them concurrently. Small "           \
+          "allocations are then served from a window without taking the "   \
+          "lock of the class loader. 0 disables the windows.")              \
+          range(0, 64*K)                                                    \
+                                                                            \
+  product(bool, MetaspaceTrimQuiescentArenas, false, EXPERIMENTAL,          \
+          "After class unloading, uncommit the unused committed space of "  \
+          "the current chunks of the class loaders that did not allocate "  \
+          "metaspace since the previous class unloading")                   \
+                                                                            \
   product(uintx, MinHeapFreeRatio, 40, MANAGEABLE,                          \
           "The minimum percentage of heap free after GC to avoid expansion."\
           " For most GCs this applies to the old generation. In G1 and"     \
@@ -1502,6 +1661,13 @@ const intx ObjectAlignmentInBytes = 8;
           range(0, max_intx)                                                \
           constraint(SoftRefLRUPolicyMSPerMBConstraintFunc,AfterMemoryInit) \
                                                                             \
+  product(bool, UsePressureAdaptiveSoftRefPolicy, false, EXPERIMENTAL,      \
+          "Above InitiatingHeapOccupancyPercent, also clear the oldest "    \
+          "SoftReferences in proportion to heap occupancy, so that they "   \
+          "are cleared gradually by young and mixed collections instead "   \
+          "of all at once by a full GC. Applies to the collectors that "    \
+          "use the shared reference processor")                             \
+                                                                            \
   product(size_t, MinHeapDeltaBytes, ScaleForWordSize(128*K),               \
           "The minimum change in heap space due to GC (in bytes)")          \
           range(0, max_uintx)                                               \
@@ -1598,6 +1764,11 @@ const intx ObjectAlignmentInBytes = 8;
           "Reserved code cache size (in bytes) - maximum code cache size")  \
           constraint(VMPageSizeConstraintFunc, AtParse)                     \
                                                                             \
+  product(bool, CodeCachePreTouch, false, EXPERIMENTAL,                     \
+          "Commit and pre-touch the whole code cache at startup, so that "  \
+          "it is backed by large pages from the start when they are used "  \
+          "for the code cache")                                             \
+                                                                            \
   product_pd(uintx, NonProfiledCodeHeapSize,                                \
           "Size of code heap with non-profiled methods (in bytes)")         \
           range(0, max_uintx)                                               \
@@ -1799,6 +1970,12 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, PerfDisableSharedMem, false,                                \
           "Store performance data in standard memory")                      \
                                                                             \
+  product(bool, PerfDataCopyToSharedMem, false, EXPERIMENTAL,               \
+          "Store performance data in standard memory and copy it to the "   \
+          "shared memory file every PerfDataSamplingInterval "              \
+          "milliseconds, so that counter updates never stall on file "      \
+          "writeback")                                                      \
+                                                                            \
   product(intx, PerfDataMemorySize, 32*K,                                   \
           "Size of performance data memory region. Will be rounded "        \
           "up to a multiple of the native os page size.")                   \
@@ -1886,6 +2063,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, VerifyMethodHandles, trueInDebug, DIAGNOSTIC,               \
           "perform extra checks when constructing method handles")          \
                                                                             \
+  product(bool, CacheMethodHandleInvokers, false, EXPERIMENTAL,             \
+          "Share the invoker linked for a MethodHandle or VarHandle "       \
+          "invocation among all callers when its MethodType only uses "     \
+          "always visible classes")                                         \
+                                                                            \
   product(bool, ShowHiddenFrames, false, DIAGNOSTIC,                        \
           "show method handle implementation frames (usually hidden)")      \
                                                                             \
@@ -1938,6 +2120,10 @@ const intx ObjectAlignmentInBytes = 8;
           "Number of buckets in the JVM internal Symbol table")             \
           range(minimumSymbolTableSize, 16777216ul /* 2^24 */)              \
                                                                             \
+  product(bool, UseSymbolLookupCache, false, EXPERIMENTAL,                  \
+          "Keep a small per-thread cache of recently looked up symbols "    \
+          "in front of the Symbol table")                                   \
+                                                                            \
   product(bool, UseStringDeduplication, false,                              \
           "Use string deduplication")                                       \
                                                                             \
@@ -1969,6 +2155,11 @@ const intx ObjectAlignmentInBytes = 8;
           "Minimum percentage of dead table entries for cleaning the table") \
           range(1, 100)                                                     \
                                                                             \
+  product(uint, StringDeduplicationBatchSize, 1, EXPERIMENTAL,              \
+          "Number of deduplications applied under a single acquisition "    \
+          "of the lock that synchronizes with interning")                   \
+          range(1, 1024)                                                    \
+                                                                            \
   product(bool, StringDeduplicationResizeALot, false, DIAGNOSTIC,           \
           "Force more frequent table resizing")                             \
                                                                             \
@@ -1991,6 +2182,39 @@ const intx ObjectAlignmentInBytes = 8;
   product(ccstr, ArchiveClassesAtExit, NULL,                                \
           "The path and name of the dynamic archive file")                  \
                                                                             \
+  product(ccstr, ArchiveClassesWhenIdle, NULL, EXPERIMENTAL,                \
+          "The path and name of a dynamic archive file that is created "    \
+          "once class loading has been idle for ArchiveClassesIdleDelay "   \
+          "ms. If the file already exists, it is used as the top archive "  \
+          "instead")                                                        \
+                                                                            \
+  product(uintx, ArchiveClassesIdleDelay, 10000, EXPERIMENTAL,              \
+          "The time in ms no class may be loaded before the archive of "    \
+          "ArchiveClassesWhenIdle is created")                              \
+          range(100, max_jint)                                              \
+                                                                            \
+  product(bool, ArchiveHotMethods, false, EXPERIMENTAL,                     \
+          "When dumping a CDS archive, record the methods compiled at "     \
+          "the highest tier. When using the archive, compile these "        \
+          "methods as soon as their class has been initialized")            \
+                                                                            \
+  product(bool, ArchiveMethodCounters, false, EXPERIMENTAL,                 \
+          "When dumping a CDS archive, keep the invocation counters and "   \
+          "the highest compile levels of the archived methods. When "       \
+          "using the archive, methods that reached the highest tier go "    \
+          "there directly, skipping the profiling tiers")                   \
+                                                                            \
+  product(bool, ArchiveResolvedConstantPoolEntries, false, EXPERIMENTAL,    \
+          "When dumping a CDS archive, keep the resolved field, "           \
+          "invokevirtual and invokespecial entries of the constant pool "   \
+          "caches of classes loaded by the builtin loaders if they refer "  \
+          "to the class itself or one of its super classes")               \
+                                                                            \
+  product(uint, ArchiveRelocationThreads, 0, EXPERIMENTAL,                  \
+          "Number of GC worker threads that relocate the pointers "         \
+          "embedded in the copied metadata when dumping a CDS archive. "    \
+          "0 or 1 relocates on the VM thread only")                         \
+                                                                            \
   product(ccstr, ExtraSharedClassListFile, NULL,                            \
           "Extra classlist for building the CDS archive file")              \
                                                                             \
@@ -2012,6 +2236,15 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, UseUnalignedAccesses, false, DIAGNOSTIC,                    \
           "Use unaligned memory accesses in Unsafe")                        \
                                                                             \
+  product(bool, UseUnsafeFillStubs, false, EXPERIMENTAL,                    \
+          "Use the generated fill stubs for Unsafe.setMemory when the "     \
+          "destination and size are 4-byte aligned")                        \
+                                                                            \
+  product(bool, UseSecondarySupersTable, false, DIAGNOSTIC,                 \
+          "Skip the scan of the secondary supers array when the hash "      \
+          "slot of the super klass is not set in the bitmap of the "        \
+          "secondary supers of the sub klass")                              \
+                                                                            \
   product_pd(bool, PreserveFramePointer,                                    \
              "Use the FP register for holding the frame pointer "           \
              "and not as a general purpose register.")                      \
@@ -2021,6 +2254,11 @@ const intx ObjectAlignmentInBytes = 8;
           "Logging (-Xlog:async).")                                         \
           range(100*K, 50*M)                                                \
                                                                             \
+  product(bool, AsyncLogDeferredFormatting, false, EXPERIMENTAL,            \
+          "With -Xlog:async, log sites only record the format string and "  \
+          "the arguments of messages that go to log files. The messages "   \
+          "are formatted by the AsyncLog Thread.")                          \
+                                                                            \
   product(bool, CheckIntrinsics, true, DIAGNOSTIC,                          \
              "When a class C is loaded, check that "                        \
              "(1) all intrinsics defined by the VM for class C are present "\
@@ -2067,6 +2305,28 @@ const intx ObjectAlignmentInBytes = 8;
   JFR_ONLY(product(ccstr, StartFlightRecording, NULL,                       \
           "Start flight recording with options"))                           \
                                                                             \
+  JFR_ONLY(product(bool, JfrSampleJavaByCPUTime, false, EXPERIMENTAL,       \
+          "Only take execution samples of the Java threads that have "      \
+          "consumed a sampling period of CPU time since their last "        \
+          "sample, using per-thread CPU-time timers that signal SIGPROF. "  \
+          "Only supported on Linux."))                                      \
+                                                                            \
+  JFR_ONLY(product(ccstr, JfrStreamChunksTo, NULL, EXPERIMENTAL,            \
+          "Send every completed Flight Recorder chunk to this FIFO or Unix "\
+          "domain socket. Chunks the consumer is not ready for are "        \
+          "dropped. Only supported on Linux."))                             \
+                                                                            \
+  JFR_ONLY(product(uintx, JfrStreamCompressionLevel, 0, EXPERIMENTAL,       \
+          "Compress the chunks sent to JfrStreamChunksTo with gzip at this "\
+          "level. The stream then decompresses to the concatenated chunks. "\
+          "0 sends the chunks uncompressed."))                              \
+          JFR_ONLY(range(0, 9))                                             \
+                                                                            \
+  JFR_ONLY(product(uint, JfrPathToGcRootsThreads, 0, EXPERIMENTAL,          \
+          "Number of GC worker threads that search the breadth-first "      \
+          "frontiers for old object sample paths to GC roots. "             \
+          "0 or 1 searches on the VM thread only."))                        \
+                                                                            \
   product(bool, UseFastUnorderedTimeStamps, false, EXPERIMENTAL,            \
           "Use platform unstable time where supported for timestamps only") \
                                                                             \
@@ -26,6 +26,7 @@
 #include "jvm_io.h"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
+#include "memory/cheapPool.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/handshake.hpp"
@@ -42,7 +43,7 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/preserveException.hpp"
 
-class HandshakeOperation : public CHeapObj<mtThread> {
+class HandshakeOperation : public PooledCHeapObj<mtThread> {
   friend class HandshakeState;
  protected:
   HandshakeClosure*   _handshake_cl;
@@ -332,6 +333,27 @@ void HandshakeOperation::do_handshake(JavaThread* thread) {
   // It is no longer safe to refer to 'this' as the VMThread/Handshaker may have destroyed this operation
 }
 
+// Executes a number of handshake closures, in order, for a thread.
+class HandshakeBatchClosure : public HandshakeClosure {
+  HandshakeClosure** const _closures;
+  const int _count;
+ public:
+  HandshakeBatchClosure(HandshakeClosure** closures, int count) :
+    HandshakeClosure("HandshakeBatch"), _closures(closures), _count(count) {
+#ifdef ASSERT
+    for (int i = 0; i < count; i++) {
+      assert(!closures[i]->is_async(), "Asynchronous closure %s cannot be batched", closures[i]->name());
+    }
+#endif
+  }
+
+  void do_thread(Thread* thread) {
+    for (int i = 0; i < _count; i++) {
+      _closures[i]->do_thread(thread);
+    }
+  }
+};
+
 void Handshake::execute(HandshakeClosure* hs_cl) {
   HandshakeOperation cto(hs_cl, NULL, Thread::current());
   VM_HandshakeAllThreads handshake(&cto);
@@ -388,6 +410,26 @@ void Handshake::execute(HandshakeClosure* hs_cl, JavaThread* target) {
   log_handshake_info(start_time_ns, op.name(), 1, emitted_handshakes_executed);
 }
 
+void Handshake::execute(HandshakeClosure** hs_cls, int count) {
+  assert(count > 0, "must have closures to execute");
+  if (count == 1) {
+    execute(hs_cls[0]);
+    return;
+  }
+  HandshakeBatchClosure batch(hs_cls, count);
+  execute(&batch);
+}
+
+void Handshake::execute(HandshakeClosure** hs_cls, int count, JavaThread* target) {
+  assert(count > 0, "must have closures to execute");
+  if (count == 1) {
+    execute(hs_cls[0], target);
+    return;
+  }
+  HandshakeBatchClosure batch(hs_cls, count);
+  execute(&batch, target);
+}
+
 void Handshake::execute(AsyncHandshakeClosure* hs_cl, JavaThread* target) {
   jlong start_time_ns = os::javaTimeNanos();
   AsyncHandshakeOperation* op = new AsyncHandshakeOperation(hs_cl, target, start_time_ns);
@@ -64,6 +64,13 @@ class Handshake : public AllStatic {
   static void execute(HandshakeClosure*       hs_cl);
   static void execute(HandshakeClosure*       hs_cl, JavaThread* target);
   static void execute(AsyncHandshakeClosure*  hs_cl, JavaThread* target);
+
+  // Execution of a batch of handshake closures as a single handshake
+  // operation. Each target thread is armed once and executes the closures
+  // in order, so the per-operation cost is paid once for the whole batch.
+  // Asynchronous closures cannot be batched.
+  static void execute(HandshakeClosure** hs_cls, int count);
+  static void execute(HandshakeClosure** hs_cls, int count, JavaThread* target);
 };
 
 class JvmtiRawMonitor;
@@ -23,6 +23,8 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/classPreParser.hpp"
+#include "classfile/fieldLayoutBuilder.hpp"
 #include "classfile/stringTable.hpp"
 #include "classfile/symbolTable.hpp"
 #include "code/icBuffer.hpp"
@@ -46,9 +48,11 @@
 #include "runtime/icache.hpp"
 #include "runtime/init.hpp"
 #include "runtime/safepoint.hpp"
+#include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/ostream.hpp"
 
 
 // Initialization done by VM thread in vm_init_globals()
@@ -109,6 +113,50 @@ void vm_init_globals() {
   SuspendibleThreadSet_init();
 }
 
+// Startup phases are only recorded by the main thread during Threads::create_vm,
+// so no locking is needed. Readers check _startup_phase_count after create_vm.
+struct StartupPhase {
+  const char* _name;
+  jlong       _nanos;
+};
+
+static const int max_startup_phases = 64;
+static StartupPhase _startup_phases[max_startup_phases];
+static int _startup_phase_count = 0;
+static jlong _startup_phase_start = 0;
+static jlong _startup_phase_last = 0;
+
+void start_startup_phases() {
+  _startup_phase_start = os::javaTimeNanos();
+  _startup_phase_last = _startup_phase_start;
+  _startup_phase_count = 0;
+}
+
+void record_startup_phase(const char* name) {
+  jlong now = os::javaTimeNanos();
+  if (_startup_phase_start != 0 && _startup_phase_count < max_startup_phases) {
+    StartupPhase* phase = &_startup_phases[_startup_phase_count++];
+    phase->_name = name;
+    phase->_nanos = now - _startup_phase_last;
+  }
+  _startup_phase_last = now;
+}
+
+void print_startup_phases(outputStream* st) {
+  if (_startup_phase_count == 0) {
+    st->print_cr("No startup phases recorded");
+    return;
+  }
+  jlong total = _startup_phase_last - _startup_phase_start;
+  for (int i = 0; i < _startup_phase_count; i++) {
+    const StartupPhase* phase = &_startup_phases[i];
+    st->print_cr("%-32s %10.3f ms %5.1f%%", phase->_name,
+                 (double)phase->_nanos / NANOSECS_PER_MILLISEC,
+                 total > 0 ? (double)phase->_nanos * 100.0 / total : 0.0);
+  }
+  st->print_cr("%-32s %10.3f ms", "total", (double)total / NANOSECS_PER_MILLISEC);
+}
+
 
 jint init_globals() {
   management_init();
@@ -116,24 +164,34 @@ jint init_globals() {
   bytecodes_init();
   classLoader_init1();
   compilationPolicy_init();
+  record_startup_phase("init_globals: early");
   codeCache_init();
+  record_startup_phase("init_globals: code cache");
   VM_Version_init();              // depends on codeCache_init for emitting code
   stubRoutines_init1();
+  record_startup_phase("init_globals: stubs phase 1");
   jint status = universe_init();  // dependent on codeCache_init and
                                   // stubRoutines_init1 and metaspace_init.
   if (status != JNI_OK)
     return status;
+  record_startup_phase("init_globals: heap and CDS map");
 
   AsyncLogWriter::initialize();
+  ClassPreParser::pre_parse_class_list(); // dependent on universe_init
+  FieldLayoutBuilder::load_hot_fields();  // dependent on universe_init
   gc_barrier_stubs_init();  // depends on universe_init, must be before interpreter_init
   interpreter_init_stub();  // before methods get loaded
+  record_startup_phase("init_globals: interpreter");
   accessFlags_init();
   InterfaceSupport_init();
   VMRegImpl::set_regName(); // need this before generate_stubs (for printing oop maps).
   SharedRuntime::generate_stubs();
+  record_startup_phase("init_globals: runtime stubs");
   universe2_init();  // dependent on codeCache_init and stubRoutines_init1
+  record_startup_phase("init_globals: well-known classes");
   javaClasses_init();// must happen after vtable initialization, before referenceProcessor_init
   interpreter_init_code();  // after javaClasses_init and before any method gets linked
+  record_startup_phase("init_globals: interpreter code");
   referenceProcessor_init();
   jni_handles_init();
 #if INCLUDE_VM_STRUCTS
@@ -149,6 +207,7 @@ jint init_globals() {
   if (!compileBroker_init()) {
     return JNI_EINVAL;
   }
+  record_startup_phase("init_globals: compile broker");
 #if INCLUDE_JVMCI
   if (EnableJVMCI) {
     JVMCI::initialize_globals();
@@ -158,8 +217,10 @@ jint init_globals() {
   if (!universe_post_init()) {
     return JNI_ERR;
   }
+  record_startup_phase("init_globals: universe post init");
   stubRoutines_init2(); // note: StubRoutines need 2-phase init
   MethodHandles::generate_adapters();
+  record_startup_phase("init_globals: stubs phase 2");
 
   // All the flags that get adjusted by VM_Version_init and os::init_2
   // have been set so dump the flags now.
@@ -27,6 +27,8 @@
 
 #include "utilities/globalDefinitions.hpp"
 
+class outputStream;
+
 // init_globals replaces C++ global objects so we can use the standard linker
 // to link Delta (which is at least twice as fast as using the GNU C++ linker).
 // Also, init.c gives explicit control over the sequence of initialization.
@@ -43,4 +45,10 @@ bool is_init_completed();     // returns true when bootstrapping has completed
 void wait_init_completed();   // wait until set_init_completed() has been called
 void set_init_completed();    // set basic init to completed
 
+// Startup phase timing, reported by the VM.startup_report diagnostic command.
+// Each recorded phase covers the time since the previous mark.
+void start_startup_phases();
+void record_startup_phase(const char* name);
+void print_startup_phases(outputStream* st);
+
 #endif // SHARE_RUNTIME_INIT_HPP
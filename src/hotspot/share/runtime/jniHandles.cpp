@@ -82,6 +82,44 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+// The free global and weak global handles cached by a JavaThread, see
+// UseJNIHandleCache.
+class JNIHandleCache : public CHeapObj<mtInternal> {
+ public:
+  OopStorage::ThreadCache _global;
+  OopStorage::ThreadCache _weak_global;
+};
+
+// Returns the handle cache of the current thread, or NULL if the current
+// thread does not cache handles.
+static JNIHandleCache* current_thread_handle_cache() {
+  // Checked JNI relies on the storage to detect the use of deleted handles.
+  if (!UseJNIHandleCache || CheckJNICalls) {
+    return NULL;
+  }
+  Thread* thread = Thread::current();
+  if (!thread->is_Java_thread()) {
+    return NULL;
+  }
+  JavaThread* jt = thread->as_Java_thread();
+  JNIHandleCache* cache = jt->jni_handle_cache();
+  if (cache == NULL) {
+    cache = new JNIHandleCache();
+    jt->set_jni_handle_cache(cache);
+  }
+  return cache;
+}
+
+void JNIHandles::delete_thread_cache(JavaThread* thread) {
+  JNIHandleCache* cache = thread->jni_handle_cache();
+  if (cache != NULL) {
+    cache->_global.flush(global_handles());
+    cache->_weak_global.flush(weak_global_handles());
+    thread->set_jni_handle_cache(NULL);
+    delete cache;
+  }
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_gc_active(), "can't extend the root set during GC");
   assert(!current_thread_in_native(), "must not be in native");
@@ -89,7 +127,9 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    JNIHandleCache* cache = current_thread_handle_cache();
+    oop* ptr = (cache != NULL) ? cache->_global.allocate(global_handles())
+                               : global_handles()->allocate();
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
@@ -110,7 +150,9 @@ jobject JNIHandles::make_weak_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = weak_global_handles()->allocate();
+    JNIHandleCache* cache = current_thread_handle_cache();
+    oop* ptr = (cache != NULL) ? cache->_weak_global.allocate(weak_global_handles())
+                               : weak_global_handles()->allocate();
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
@@ -149,7 +191,12 @@ void JNIHandles::destroy_global(jobject handle) {
     assert(!is_jweak(handle), "wrong method for detroying jweak");
     oop* oop_ptr = jobject_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)NULL);
-    global_handles()->release(oop_ptr);
+    JNIHandleCache* cache = current_thread_handle_cache();
+    if (cache != NULL) {
+      cache->_global.release(global_handles(), oop_ptr);
+    } else {
+      global_handles()->release(oop_ptr);
+    }
   }
 }
 
@@ -159,7 +206,12 @@ void JNIHandles::destroy_weak_global(jobject handle) {
     assert(is_jweak(handle), "JNI handle not jweak");
     oop* oop_ptr = jweak_ptr(handle);
     NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(oop_ptr, (oop)NULL);
-    weak_global_handles()->release(oop_ptr);
+    JNIHandleCache* cache = current_thread_handle_cache();
+    if (cache != NULL) {
+      cache->_weak_global.release(weak_global_handles(), oop_ptr);
+    } else {
+      weak_global_handles()->release(oop_ptr);
+    }
   }
 }
 
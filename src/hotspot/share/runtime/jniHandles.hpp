@@ -99,6 +99,10 @@ class JNIHandles : AllStatic {
   static void destroy_weak_global(jobject handle);
   static bool is_global_weak_cleared(jweak handle); // Test jweak without resolution
 
+  // Releases the global and weak global handles cached by thread, see
+  // UseJNIHandleCache.
+  static void delete_thread_cache(JavaThread* thread);
+
   // Debugging
   static void print_on(outputStream* st);
   static void print();
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "runtime/lockStack.inline.hpp"
+#include "runtime/objectMonitor.inline.hpp"
+#include "utilities/ostream.hpp"
+
+LockStack::LockStack() : _top(0) {
+  for (int i = 0; i < CAPACITY; i++) {
+    _base[i] = NULL;
+  }
+}
+
+#ifndef PRODUCT
+void LockStack::verify(const char* msg) const {
+  assert(_top >= 0 && _top <= CAPACITY, "%s: top out of bounds: %d", msg, _top);
+  for (int i = 0; i < _top; i++) {
+    assert(_base[i] != NULL, "%s: entry %d must not be NULL", msg, i);
+    // Entries of the same object must be adjacent.
+    for (int j = i + 2; j < _top; j++) {
+      assert(_base[i] != _base[j] || _base[j - 1] == _base[i],
+             "%s: entries %d and %d must be adjacent", msg, i, j);
+    }
+  }
+  for (int i = _top; i < CAPACITY; i++) {
+    assert(_base[i] == NULL, "%s: unused entry %d must be NULL", msg, i);
+  }
+}
+#endif
+
+void LockStack::print_on(outputStream* st) const {
+  for (int i = _top - 1; i >= 0; i--) {
+    st->print("LockStack[%d]: ", i);
+    oop o = _base[i];
+    if (oopDesc::is_oop(o)) {
+      o->print_on(st);
+    } else {
+      st->print_cr("not an oop: " PTR_FORMAT, p2i(o));
+    }
+  }
+}
+
+OMCache::OMCache() {
+  clear();
+}
+
+ObjectMonitor* OMCache::get_monitor(oop o) {
+  for (int i = 0; i < CAPACITY; i++) {
+    ObjectMonitor* monitor = _entries[i];
+    if (monitor == NULL) {
+      break;
+    }
+    if (monitor->object_peek() == o && !monitor->is_being_async_deflated()) {
+      return monitor;
+    }
+  }
+  return NULL;
+}
+
+void OMCache::set_monitor(ObjectMonitor* monitor) {
+  // Move the entries after the slot of monitor, or drop the least
+  // recently used entry, and insert monitor in front.
+  int i = 0;
+  while (i < CAPACITY - 1 && _entries[i] != NULL && _entries[i] != monitor) {
+    i++;
+  }
+  for (; i > 0; i--) {
+    _entries[i] = _entries[i - 1];
+  }
+  _entries[0] = monitor;
+}
+
+void OMCache::clear() {
+  for (int i = 0; i < CAPACITY; i++) {
+    _entries[i] = NULL;
+  }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_LOCKSTACK_HPP
+#define SHARE_RUNTIME_LOCKSTACK_HPP
+
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class ObjectMonitor;
+class OopClosure;
+class outputStream;
+
+// The lock stack of a JavaThread holds the objects that the thread has
+// fast-locked with UseLightweightLocking. A fast-locked object only has
+// the lock bits of its markWord cleared; the rest of the header stays in
+// place and the owner is found by searching the lock stacks.
+//
+// Recursive locking is supported by pushing the same object again, as long
+// as it is on the top of the stack. Objects that cannot be pushed, because
+// the stack is full or the recursion is not on the top, get inflated.
+//
+// The lock stack is only modified by its owning thread, or by a thread that
+// operates on the owner's behalf while the owner is stopped in a handshake
+// or safepoint.
+class LockStack {
+ private:
+  static const int CAPACITY = 8;
+
+  // The number of used entries.
+  int _top;
+  oop _base[CAPACITY];
+
+  void verify(const char* msg) const PRODUCT_RETURN;
+
+ public:
+  LockStack();
+
+  // Returns true if there is room to push onto this lock stack.
+  inline bool can_push() const;
+  inline bool is_empty() const;
+
+  // Pushes an object on this lock stack.
+  inline void push(oop o);
+  // Pops the topmost object from this lock stack.
+  inline oop pop();
+
+  // Pushes o again if it is on the top of this lock stack. Returns true on success.
+  inline bool try_recursive_enter(oop o);
+  // Pops o if the two topmost entries are o. Returns true on success.
+  inline bool try_recursive_exit(oop o);
+
+  // Removes all entries of o from this lock stack. Returns the number of
+  // removed entries.
+  inline int remove(oop o);
+
+  // Tests whether o is on this lock stack.
+  inline bool contains(oop o) const;
+  // Tests whether o is on this lock stack more than once.
+  inline bool is_recursive(oop o) const;
+
+  // GC support
+  inline void oops_do(OopClosure* cl);
+
+  void print_on(outputStream* st) const;
+};
+
+// The monitor cache of a JavaThread remembers the ObjectMonitors that the
+// thread has recently found in the ObjectMonitor table, so that repeated
+// synchronization on the same objects does not have to search the table,
+// see UseObjectMonitorTable. The cache is cleared by the handshake that
+// precedes freeing deflated monitors, so its entries are always valid
+// ObjectMonitors; an entry may refer to a monitor that is being deflated
+// and is then skipped.
+//
+// The monitor cache is only accessed by its owning thread, or by the
+// handshake operation that clears it.
+class OMCache {
+ private:
+  static const int CAPACITY = 8;
+
+  ObjectMonitor* _entries[CAPACITY];
+
+ public:
+  OMCache();
+
+  // Returns the cached ObjectMonitor of o, or NULL.
+  ObjectMonitor* get_monitor(oop o);
+  // Makes monitor the most recently used entry.
+  void set_monitor(ObjectMonitor* monitor);
+  void clear();
+};
+
+#endif // SHARE_RUNTIME_LOCKSTACK_HPP
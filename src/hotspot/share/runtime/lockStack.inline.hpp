@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_LOCKSTACK_INLINE_HPP
+#define SHARE_RUNTIME_LOCKSTACK_INLINE_HPP
+
+#include "runtime/lockStack.hpp"
+
+#include "memory/iterator.hpp"
+#include "oops/oop.hpp"
+#include "utilities/debug.hpp"
+
+inline bool LockStack::can_push() const {
+  return _top < CAPACITY;
+}
+
+inline bool LockStack::is_empty() const {
+  return _top == 0;
+}
+
+inline void LockStack::push(oop o) {
+  verify("pre-push");
+  assert(oopDesc::is_oop(o), "must be");
+  assert(!contains(o), "entries must be unique");
+  assert(can_push(), "must have room");
+  _base[_top++] = o;
+  verify("post-push");
+}
+
+inline oop LockStack::pop() {
+  verify("pre-pop");
+  assert(!is_empty(), "lock stack underflow");
+  oop o = _base[--_top];
+  _base[_top] = NULL;
+  verify("post-pop");
+  return o;
+}
+
+inline bool LockStack::try_recursive_enter(oop o) {
+  if (!can_push() || is_empty() || _base[_top - 1] != o) {
+    return false;
+  }
+  _base[_top++] = o;
+  verify("post-recursive-enter");
+  return true;
+}
+
+inline bool LockStack::try_recursive_exit(oop o) {
+  if (_top < 2 || _base[_top - 1] != o || _base[_top - 2] != o) {
+    return false;
+  }
+  _base[--_top] = NULL;
+  verify("post-recursive-exit");
+  return true;
+}
+
+inline int LockStack::remove(oop o) {
+  verify("pre-remove");
+  int removed = 0;
+  int j = 0;
+  for (int i = 0; i < _top; i++) {
+    if (_base[i] == o) {
+      removed++;
+    } else {
+      _base[j++] = _base[i];
+    }
+  }
+  for (int i = j; i < _top; i++) {
+    _base[i] = NULL;
+  }
+  _top = j;
+  verify("post-remove");
+  return removed;
+}
+
+inline bool LockStack::contains(oop o) const {
+  for (int i = _top - 1; i >= 0; i--) {
+    if (_base[i] == o) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline bool LockStack::is_recursive(oop o) const {
+  int count = 0;
+  for (int i = 0; i < _top; i++) {
+    if (_base[i] == o && ++count > 1) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline void LockStack::oops_do(OopClosure* cl) {
+  verify("pre-oops-do");
+  for (int i = 0; i < _top; i++) {
+    cl->do_oop(&_base[i]);
+  }
+  verify("post-oops-do");
+}
+
+#endif // SHARE_RUNTIME_LOCKSTACK_INLINE_HPP
@@ -106,13 +106,20 @@ void Mutex::lock(Thread* self) {
   check_safepoint_state(self);
   check_rank(self);
 
+  jlong contended_since = 0;
   if (!_lock.try_lock()) {
     // The lock is contended, use contended slow-path function to lock
+    if (ProfileVMLocks) {
+      contended_since = os::elapsed_counter();
+    }
     lock_contended(self);
   }
 
   assert_owner(NULL);
   set_owner(self);
+  if (ProfileVMLocks) {
+    record_acquired(contended_since);
+  }
 }
 
 void Mutex::lock() {
@@ -131,9 +138,18 @@ void Mutex::lock_without_safepoint_check(Thread * self) {
   check_no_safepoint_state(self);
   check_rank(self);
 
-  _lock.lock();
+  jlong contended_since = 0;
+  if (!ProfileVMLocks) {
+    _lock.lock();
+  } else if (!_lock.try_lock()) {
+    contended_since = os::elapsed_counter();
+    _lock.lock();
+  }
   assert_owner(NULL);
   set_owner(self);
+  if (ProfileVMLocks) {
+    record_acquired(contended_since);
+  }
 }
 
 void Mutex::lock_without_safepoint_check() {
@@ -160,6 +176,9 @@ bool Mutex::try_lock_inner(bool do_rank_checks) {
   if (_lock.try_lock()) {
     assert_owner(NULL);
     set_owner(self);
+    if (ProfileVMLocks) {
+      record_acquired(0);
+    }
     return true;
   }
   return false;
@@ -182,6 +201,9 @@ void Mutex::release_for_safepoint() {
 
 void Mutex::unlock() {
   DEBUG_ONLY(assert_owner(Thread::current()));
+  if (ProfileVMLocks) {
+    record_released();
+  }
   set_owner(NULL);
   _lock.unlock();
 }
@@ -206,6 +228,9 @@ bool Monitor::wait_without_safepoint_check(int64_t timeout) {
 
   // conceptually set the owner to NULL in anticipation of
   // abdicating the lock in wait
+  if (ProfileVMLocks) {
+    record_released();
+  }
   set_owner(NULL);
 
   // Check safepoint state after resetting owner and possible NSV.
@@ -213,6 +238,9 @@ bool Monitor::wait_without_safepoint_check(int64_t timeout) {
 
   int wait_status = _lock.wait(timeout);
   set_owner(self);
+  if (ProfileVMLocks) {
+    record_acquired(0);
+  }
   return wait_status != 0;          // return true IFF timeout
 }
 
@@ -228,6 +256,9 @@ bool Monitor::wait(int64_t timeout) {
 
   // conceptually set the owner to NULL in anticipation of
   // abdicating the lock in wait
+  if (ProfileVMLocks) {
+    record_released();
+  }
   set_owner(NULL);
 
   // Check safepoint state after resetting owner and possible NSV.
@@ -249,6 +280,9 @@ bool Monitor::wait(int64_t timeout) {
     assert_owner(NULL);
     // Conceptually reestablish ownership of the lock.
     set_owner(self);
+    if (ProfileVMLocks) {
+      record_acquired(0);
+    }
   } else {
     lock(self);
   }
@@ -262,7 +296,9 @@ Mutex::~Mutex() {
 }
 
 Mutex::Mutex(int Rank, const char * name, bool allow_vm_block,
-             SafepointCheckRequired safepoint_check_required) : _owner(NULL) {
+             SafepointCheckRequired safepoint_check_required) : _owner(NULL),
+  _acquisitions(0), _contended_acquisitions(0), _wait_ticks(0), _max_wait_ticks(0),
+  _hold_ticks(0), _max_hold_ticks(0), _acquired_ticks(0) {
   assert(os::mutex_init_done(), "Too early!");
   assert(name != NULL, "Mutex requires a name");
   _name = os::strdup(name, mtInternal);
@@ -285,6 +321,41 @@ bool Mutex::owned_by_self() const {
   return owner() == Thread::current();
 }
 
+void Mutex::record_acquired(jlong contended_since) {
+  jlong now = os::elapsed_counter();
+  _acquisitions++;
+  if (contended_since != 0) {
+    jlong waited = now - contended_since;
+    _contended_acquisitions++;
+    _wait_ticks += waited;
+    _max_wait_ticks = MAX2(_max_wait_ticks, waited);
+  }
+  _acquired_ticks = now;
+}
+
+void Mutex::record_released() {
+  // The lock may have been acquired before ProfileVMLocks was set.
+  if (_acquired_ticks != 0) {
+    jlong held = os::elapsed_counter() - _acquired_ticks;
+    _hold_ticks += held;
+    _max_hold_ticks = MAX2(_max_hold_ticks, held);
+    _acquired_ticks = 0;
+  }
+}
+
+void Mutex::print_stats_on(outputStream* st) const {
+  uint64_t acquisitions = _acquisitions;
+  if (acquisitions == 0) {
+    return;
+  }
+  double us_per_tick = 1000000.0 / os::elapsed_frequency();
+  st->print_cr("%-32s " UINT64_FORMAT_W(12) " " UINT64_FORMAT_W(12)
+               " %14.3f %12.3f %14.3f %12.3f",
+               _name, acquisitions, _contended_acquisitions,
+               _wait_ticks * us_per_tick, _max_wait_ticks * us_per_tick,
+               _hold_ticks * us_per_tick, _max_hold_ticks * us_per_tick);
+}
+
 void Mutex::print_on_error(outputStream* st) const {
   st->print("[" PTR_FORMAT, p2i(this));
   st->print("] %s", _name);
@@ -87,6 +87,19 @@ class Mutex : public CHeapObj<mtSynchronizer> {
   os::PlatformMonitor _lock;             // Native monitor implementation
   const char* _name;                     // Name of mutex/monitor
 
+  // Contention statistics, maintained with ProfileVMLocks. They are only
+  // updated by the owner of the lock, so reads by other threads are racy.
+  uint64_t _acquisitions;                // Number of acquisitions
+  uint64_t _contended_acquisitions;      // Acquisitions that had to block
+  jlong    _wait_ticks;                  // Ticks spent blocked acquiring
+  jlong    _max_wait_ticks;
+  jlong    _hold_ticks;                  // Ticks the lock was held
+  jlong    _max_hold_ticks;
+  jlong    _acquired_ticks;              // When the current owner got the lock
+
+  void record_acquired(jlong contended_since);
+  void record_released();
+
   // Debugging fields for naming, deadlock detection, etc. (some only used in debug mode)
 #ifndef PRODUCT
   bool    _allow_vm_block;
@@ -195,6 +208,8 @@ class Mutex : public CHeapObj<mtSynchronizer> {
   const char *name() const                  { return _name; }
 
   void print_on_error(outputStream* st) const;
+  // Print the ProfileVMLocks statistics of this lock, if it was acquired.
+  void print_stats_on(outputStream* st) const;
   #ifndef PRODUCT
     void print_on(outputStream* st) const;
     void print() const                      { print_on(::tty); }
@@ -86,6 +86,7 @@ Monitor* CompileThread_lock           = NULL;
 Monitor* Compilation_lock             = NULL;
 Mutex*   CompileTaskAlloc_lock        = NULL;
 Mutex*   CompileStatistics_lock       = NULL;
+Mutex*   CompilationCost_lock         = NULL;
 Mutex*   DirectivesStack_lock         = NULL;
 Mutex*   MultiArray_lock              = NULL;
 Monitor* Terminator_lock              = NULL;
@@ -291,6 +292,9 @@ void mutex_init() {
   def(CompiledIC_lock              , PaddedMutex  , nonleaf+2,   false, _safepoint_check_never);      // locks VtableStubs_lock, InlineCacheBuffer_lock
   def(CompileTaskAlloc_lock        , PaddedMutex  , nonleaf+2,   true,  _safepoint_check_always);
   def(CompileStatistics_lock       , PaddedMutex  , nonleaf+2,   false, _safepoint_check_always);
+  if (CompilationCostAccounting) {
+    def(CompilationCost_lock       , PaddedMutex  , leaf,        false, _safepoint_check_always);
+  }
   def(DirectivesStack_lock         , PaddedMutex  , special,     true,  _safepoint_check_never);
   def(MultiArray_lock              , PaddedMutex  , nonleaf+2,   false, _safepoint_check_always);
 
@@ -383,3 +387,17 @@ void print_owned_locks_on_error(outputStream* st) {
   }
   if (none) st->print_cr("None");
 }
+
+// Print the ProfileVMLocks statistics of all global mutexes/monitors.
+void print_lock_stats_on(outputStream* st) {
+  if (!ProfileVMLocks) {
+    st->print_cr("VM lock statistics are not available, ProfileVMLocks is off");
+    return;
+  }
+  st->print_cr("%-32s %12s %12s %14s %12s %14s %12s",
+               "Lock", "Acquired", "Contended", "Wait (us)", "Max wait",
+               "Hold (us)", "Max hold");
+  for (int i = 0; i < _num_mutex; i++) {
+    _mutex_array[i]->print_stats_on(st);
+  }
+}
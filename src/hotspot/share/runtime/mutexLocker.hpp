@@ -82,6 +82,7 @@ extern Monitor* CompileThread_lock;              // a lock held by compile threa
 extern Monitor* Compilation_lock;                // a lock used to pause compilation
 extern Mutex*   CompileTaskAlloc_lock;           // a lock held when CompileTasks are allocated
 extern Mutex*   CompileStatistics_lock;          // a lock held when updating compilation statistics
+extern Mutex*   CompilationCost_lock;            // a lock held when updating per-method compilation cost accounting
 extern Mutex*   DirectivesStack_lock;            // a lock held when mutating the dirstack and ref counting directives
 extern Mutex*   MultiArray_lock;                 // a lock used to guard allocation of multi-dim arrays
 extern Monitor* Terminator_lock;                 // a lock used to guard termination of the vm
@@ -179,6 +180,9 @@ extern Mutex* tty_lock;                          // lock to synchronize output.
 // by fatal error handler.
 void print_owned_locks_on_error(outputStream* st);
 
+// Print the ProfileVMLocks statistics of all global mutexes/monitors.
+void print_lock_stats_on(outputStream* st);
+
 char *lock_name(Mutex *mutex);
 
 // for debugging: check that we're already owning this lock (or are at a safepoint / handshake)
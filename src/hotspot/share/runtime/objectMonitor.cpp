@@ -31,6 +31,7 @@
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/cheapPool.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/markWord.hpp"
 #include "oops/oop.inline.hpp"
@@ -50,6 +51,7 @@
 #include "runtime/safefetch.inline.hpp"
 #include "runtime/safepointMechanism.inline.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "runtime/synchronizer.hpp"
 #include "runtime/thread.inline.hpp"
 #include "services/threadService.hpp"
 #include "utilities/dtrace.hpp"
@@ -119,6 +121,34 @@ static int Knob_Poverty             = 1000;
 static int Knob_FixedSpin           = 0;
 static int Knob_PreSpin             = 10;      // 20-100 likely better
 
+// With LimitMonitorSpinnersToCPUs, the number of threads currently in the
+// adaptive spin of TrySpin() and how many may spin at the same time.
+int ObjectMonitor::_spinner_limit   = 0;
+volatile int ObjectMonitor::_spinners = 0;
+
+// Counts the current thread as a spinner, if the spinner limit allows.
+class SpinnerMark : public StackObj {
+  bool _counted;
+ public:
+  SpinnerMark() : _counted(false) {}
+  ~SpinnerMark() {
+    if (_counted) {
+      Atomic::dec(&ObjectMonitor::_spinners);
+    }
+  }
+  bool enter() {
+    if (!LimitMonitorSpinnersToCPUs) {
+      return true;
+    }
+    if (Atomic::add(&ObjectMonitor::_spinners, 1) > ObjectMonitor::_spinner_limit) {
+      Atomic::dec(&ObjectMonitor::_spinners);
+      return false;
+    }
+    _counted = true;
+    return true;
+  }
+};
+
 DEBUG_ONLY(static volatile bool InitDone = false;)
 
 OopStorage* ObjectMonitor::_oop_storage = NULL;
@@ -234,16 +264,16 @@ OopStorage* ObjectMonitor::_oop_storage = NULL;
 
 
 void* ObjectMonitor::operator new (size_t size) throw() {
-  return AllocateHeap(size, mtInternal);
+  return CHeapPool::allocate(size, mtInternal);
 }
 void* ObjectMonitor::operator new[] (size_t size) throw() {
-  return operator new (size);
+  return AllocateHeap(size, mtInternal);
 }
-void ObjectMonitor::operator delete(void* p) {
-  FreeHeap(p);
+void ObjectMonitor::operator delete(void* p, size_t size) {
+  CHeapPool::free(p, size, mtInternal);
 }
 void ObjectMonitor::operator delete[] (void *p) {
-  operator delete(p);
+  FreeHeap(p);
 }
 
 // Check that object() and set_object() are called from the right context:
@@ -366,7 +396,7 @@ bool ObjectMonitor::enter(JavaThread* current) {
   if (TrySpin(current) > 0) {
     assert(owner_raw() == current, "must be current: owner=" INTPTR_FORMAT, p2i(owner_raw()));
     assert(_recursions == 0, "must be 0: recursions=" INTX_FORMAT, _recursions);
-    assert(object()->mark() == markWord::encode(this),
+    assert(is_installed_in_object(),
            "object mark must match encoded this: mark=" INTPTR_FORMAT
            ", encoded this=" INTPTR_FORMAT, object()->mark().value(),
            markWord::encode(this).value());
@@ -460,7 +490,7 @@ bool ObjectMonitor::enter(JavaThread* current) {
   assert(_recursions == 0, "invariant");
   assert(owner_raw() == current, "invariant");
   assert(_succ != current, "invariant");
-  assert(object()->mark() == markWord::encode(this), "invariant");
+  assert(is_installed_in_object(), "invariant");
 
   // The thread -- now the owner -- is back in vm mode.
   // Report the glorious news via TI,DTrace and jvmstat.
@@ -546,6 +576,10 @@ bool ObjectMonitor::deflate_monitor() {
     set_owner_from(NULL, DEFLATER_MARKER);
     assert(contentions() >= 0, "must be non-negative: contentions=%d", contentions());
     _contentions = -max_jint;
+    if (UseObjectMonitorTable) {
+      // The table entry is still keyed by the cached hash.
+      ObjectSynchronizer::remove_deflated_monitor(Thread::current(), this, NULL);
+    }
   } else {
     // Attempt async deflation protocol.
 
@@ -604,8 +638,12 @@ bool ObjectMonitor::deflate_monitor() {
                                   obj->klass()->external_name());
     }
 
-    // Install the old mark word if nobody else has already done it.
-    install_displaced_markword_in_object(obj);
+    if (UseObjectMonitorTable) {
+      ObjectSynchronizer::remove_deflated_monitor(Thread::current(), this, obj);
+    } else {
+      // Install the old mark word if nobody else has already done it.
+      install_displaced_markword_in_object(obj);
+    }
   }
 
   // We leave owner == DEFLATER_MARKER and contentions < 0
@@ -626,6 +664,11 @@ void ObjectMonitor::install_displaced_markword_in_object(const oop obj) {
 
   guarantee(obj != NULL, "must be non-NULL");
 
+  if (UseObjectMonitorTable) {
+    // Only the deflater restores the header, see deflate_monitor().
+    return;
+  }
+
   // Separate loads in is_being_async_deflated(), which is almost always
   // called before this function, from the load of dmw/header below.
 
@@ -667,6 +710,14 @@ void ObjectMonitor::install_displaced_markword_in_object(const oop obj) {
   // because it is restored they will only retry once.
 }
 
+bool ObjectMonitor::is_installed_in_object() {
+  markWord mark = object()->mark();
+  if (UseObjectMonitorTable) {
+    return mark.has_monitor();
+  }
+  return mark == markWord::encode(this);
+}
+
 // Convert the fields used by is_busy() to a string that can be
 // used for diagnostic output.
 const char* ObjectMonitor::is_busy_to_string(stringStream* ss) {
@@ -955,7 +1006,7 @@ void ObjectMonitor::ReenterI(JavaThread* current, ObjectWaiter* currentNode) {
   assert(currentNode != NULL, "invariant");
   assert(currentNode->_thread == current, "invariant");
   assert(_waiters > 0, "invariant");
-  assert(object()->mark() == markWord::encode(this), "invariant");
+  assert(is_installed_in_object(), "invariant");
 
   assert(current->thread_state() != _thread_blocked, "invariant");
 
@@ -1014,7 +1065,7 @@ void ObjectMonitor::ReenterI(JavaThread* current, ObjectWaiter* currentNode) {
   // In addition, current.TState is stable.
 
   assert(owner_raw() == current, "invariant");
-  assert(object()->mark() == markWord::encode(this), "invariant");
+  assert(is_installed_in_object(), "invariant");
   UnlinkAfterAcquire(current, currentNode);
   if (_succ == current) _succ = NULL;
   assert(_succ != current, "invariant");
@@ -1651,7 +1702,7 @@ void ObjectMonitor::wait(jlong millis, bool interruptible, TRAPS) {
   // Verify a few postconditions
   assert(owner_raw() == current, "invariant");
   assert(_succ != current, "invariant");
-  assert(object()->mark() == markWord::encode(this), "invariant");
+  assert(is_installed_in_object(), "invariant");
 
   // check if the notification happened
   if (!WasNotified) {
@@ -1884,6 +1935,14 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
     return 0;
   }
 
+  // Spinning threads beyond the available processors only take CPU
+  // time away from the owner. Don't penalize _SpinDuration for that,
+  // the monitor itself may still be worth spinning for.
+  SpinnerMark sm;
+  if (!sm.enter()) {
+    return 0;
+  }
+
   // We're good to spin ... spin ingress.
   // CONSIDER: use Prefetch::write() to avoid RTS->RTO upgrades
   // when preparing to LD...CAS _owner, etc and the CAS is likely
@@ -2040,6 +2099,8 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
 int ObjectMonitor::NotRunnable(JavaThread* current, JavaThread* ox) {
   // Check ox->TypeTag == 2BAD.
   if (ox == NULL) return 0;
+  // The owner of a fast-lock that has been inflated is not known yet.
+  if (ox == ANONYMOUS_OWNER) return 0;
 
   // Avoid transitive spinning ...
   // Say T1 spins or blocks trying to acquire L.  T1._Stalled is set to L.
@@ -2164,6 +2225,9 @@ void ObjectMonitor::Initialize() {
     Knob_FixedSpin = -1;
   }
 
+  // Leave at least one processor for the owners to run on.
+  _spinner_limit = MAX2(os::active_processor_count() - 1, 1);
+
   if (UsePerfData) {
     EXCEPTION_MARK;
 #define NEWPERFCOUNTER(n)                                                \
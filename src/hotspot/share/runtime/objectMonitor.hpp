@@ -147,6 +147,10 @@ class ObjectMonitor : public CHeapObj<mtInternal> {
                         sizeof(WeakHandle));
   // Used by async deflation as a marker in the _owner field:
   #define DEFLATER_MARKER reinterpret_cast<void*>(-1)
+  // Used with UseLightweightLocking as the owner of a monitor that was
+  // inflated over a fast-lock held by another thread. The owning thread
+  // replaces it with itself when it next operates on the monitor:
+  #define ANONYMOUS_OWNER reinterpret_cast<void*>(1)
   void* volatile _owner;            // pointer to owning thread OR BasicLock
   volatile jlong _previous_owner_tid;  // thread id of the previous owner of the monitor
   // Separate _owner and _next_om on different cache lines since
@@ -202,10 +206,12 @@ class ObjectMonitor : public CHeapObj<mtInternal> {
   static PerfLongVariable * _sync_MonExtant;
 
   static int Knob_SpinLimit;
+  static int _spinner_limit;
+  static volatile int _spinners;
 
   void* operator new (size_t size) throw();
   void* operator new[] (size_t size) throw();
-  void operator delete(void* p);
+  void operator delete(void* p, size_t size);
   void operator delete[] (void* p);
 
   // TODO-FIXME: the "offset" routines should return a type of off_t instead of int ...
@@ -268,6 +274,16 @@ class ObjectMonitor : public CHeapObj<mtInternal> {
   // _owner field. Returns the prior value of the _owner field.
   void*     try_set_owner_from(void* old_value, void* new_value);
 
+  void      set_owner_anonymous() {
+    set_owner_from(NULL, ANONYMOUS_OWNER);
+  }
+  bool      is_owner_anonymous() const {
+    return owner_raw() == ANONYMOUS_OWNER;
+  }
+  void      set_owner_from_anonymous(JavaThread* owner) {
+    set_owner_from(ANONYMOUS_OWNER, owner);
+  }
+
   // Simply get _next_om field.
   ObjectMonitor* next_om() const;
   // Get _next_om field with acquire semantics.
@@ -349,6 +365,10 @@ class ObjectMonitor : public CHeapObj<mtInternal> {
   int       TrySpin(JavaThread* current);
   void      ExitEpilog(JavaThread* current, ObjectWaiter* Wakee);
 
+  // Returns true if the object's header refers to this ObjectMonitor. With
+  // UseObjectMonitorTable only the monitor bits of the header are checked.
+  bool      is_installed_in_object();
+
   // Deflation support
   bool      deflate_monitor();
   void      install_displaced_markword_in_object(const oop obj);
@@ -30,6 +30,7 @@
 #include "logging/log.hpp"
 #include "oops/access.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/lockStack.inline.hpp"
 #include "runtime/synchronizer.hpp"
 
 inline intptr_t ObjectMonitor::is_entered(JavaThread* current) const {
@@ -37,6 +38,9 @@ inline intptr_t ObjectMonitor::is_entered(JavaThread* current) const {
   if (current == owner || current->is_lock_owned((address)owner)) {
     return 1;
   }
+  if (owner == ANONYMOUS_OWNER && current->lock_stack().contains(object_peek())) {
+    return 1;
+  }
   return 0;
 }
 
@@ -48,6 +48,7 @@ static const size_t PERFDATA_FILENAME_LEN = sizeof(PERFDATA_NAME) +
                                             UINT_CHARS + 1;
 
 char*                    PerfMemory::_start = NULL;
+char*                    PerfMemory::_shared_copy = NULL;
 char*                    PerfMemory::_end = NULL;
 char*                    PerfMemory::_top = NULL;
 size_t                   PerfMemory::_capacity = 0;
@@ -240,6 +241,14 @@ void PerfMemory::mark_updated() {
   _prologue->mod_time_stamp = os::elapsed_counter();
 }
 
+void PerfMemory::copy_to_shared() {
+  if (_shared_copy == NULL || !is_usable()) return;
+
+  // readers see the same kind of racy counter values as they do with the
+  // counters mapped directly, only up to PerfDataSamplingInterval older.
+  memcpy(_shared_copy, _start, used());
+}
+
 // Returns the complete path including the file name of performance data file.
 // Caller is expected to release the allocated memory.
 char* PerfMemory::get_perfdata_file_path() {
@@ -117,6 +117,7 @@ class PerfMemory : AllStatic {
     friend class PerfMemoryTest;
   private:
     static char*  _start;
+    static char*  _shared_copy;
     static char*  _end;
     static char*  _top;
     static size_t _capacity;
@@ -146,6 +147,11 @@ class PerfMemory : AllStatic {
     }
     static void mark_updated();
 
+    // copies the used part of the PerfData memory region to the shared
+    // memory file, if the region is kept in standard memory with
+    // PerfDataCopyToSharedMem.
+    static void copy_to_shared();
+
     // methods for attaching to and detaching from the PerfData
     // memory segment of another JVM process on the same system.
     static void attach(const char* user, int vmid, PerfMemoryMode mode,
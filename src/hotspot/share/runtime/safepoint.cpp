@@ -154,15 +154,19 @@ void SafepointSynchronize::init(Thread* vmthread) {
   SafepointTracing::init();
 }
 
+// With ParallelSafepointSynchronization the counts are also updated by the
+// safepoint workers, see ParallelSafepointSyncTask.
 void SafepointSynchronize::increment_jni_active_count() {
-  assert(Thread::current()->is_VM_thread(), "Only VM thread may increment");
-  ++_current_jni_active_count;
+  assert(Thread::current()->is_VM_thread() || _state == _synchronizing,
+         "Only VM thread may increment outside synchronization");
+  Atomic::inc(&_current_jni_active_count);
 }
 
 void SafepointSynchronize::decrement_waiting_to_block() {
   assert(_waiting_to_block > 0, "sanity check");
-  assert(Thread::current()->is_VM_thread(), "Only VM thread may decrement");
-  --_waiting_to_block;
+  assert(Thread::current()->is_VM_thread() || _state == _synchronizing,
+         "Only VM thread may decrement outside synchronization");
+  Atomic::dec(&_waiting_to_block);
 }
 
 bool SafepointSynchronize::thread_not_running(ThreadSafepointState *cur_state) {
@@ -205,6 +209,29 @@ static void back_off(int64_t start_time) {
   }
 }
 
+// Examines each thread of the list once, and unlinks the threads that are
+// no longer running. Returns the number of unlinked threads.
+int SafepointSynchronize::unlink_not_running(ThreadSafepointState** tss_head) {
+  int not_running = 0;
+  ThreadSafepointState** p_prev = tss_head;
+  ThreadSafepointState* cur_tss = *tss_head;
+  while (cur_tss != NULL) {
+    assert(cur_tss->is_running(), "Illegal initial state");
+    if (thread_not_running(cur_tss)) {
+      ++not_running;
+      *p_prev = NULL;
+      ThreadSafepointState *tmp = cur_tss;
+      cur_tss = cur_tss->get_next();
+      tmp->set_next(NULL);
+    } else {
+      *p_prev = cur_tss;
+      p_prev = cur_tss->next_ptr();
+      cur_tss = cur_tss->get_next();
+    }
+  }
+  return not_running;
+}
+
 int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
 {
   JavaThreadIteratorWithHandle jtiwh;
@@ -251,22 +278,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       print_safepoint_timeout();
     }
 
-    p_prev = &tss_head;
-    ThreadSafepointState *cur_tss = tss_head;
-    while (cur_tss != NULL) {
-      assert(cur_tss->is_running(), "Illegal initial state");
-      if (thread_not_running(cur_tss)) {
-        --still_running;
-        *p_prev = NULL;
-        ThreadSafepointState *tmp = cur_tss;
-        cur_tss = cur_tss->get_next();
-        tmp->set_next(NULL);
-      } else {
-        *p_prev = cur_tss;
-        p_prev = cur_tss->next_ptr();
-        cur_tss = cur_tss->get_next();
-      }
-    }
+    still_running -= unlink_not_running(&tss_head);
 
     DEBUG_ONLY(assert_list_is_valid(tss_head, still_running);)
 
@@ -282,7 +294,98 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   return iterations;
 }
 
-void SafepointSynchronize::arm_safepoint() {
+// Each worker arms the polls of a contiguous part of the threads list, and
+// then waits for these threads the same way synchronize_threads() waits for
+// all threads.
+class ParallelSafepointSyncTask : public AbstractGangTask {
+  ThreadsList* const _threads;
+  const uint _num_workers;
+  const jlong _safepoint_limit_time;
+  volatile int _initial_running;
+  volatile int _iterations;
+
+  void update_iterations(int iterations) {
+    int cur = Atomic::load(&_iterations);
+    while (cur < iterations) {
+      int prev = Atomic::cmpxchg(&_iterations, cur, iterations);
+      if (prev == cur) {
+        break;
+      }
+      cur = prev;
+    }
+  }
+
+ public:
+  ParallelSafepointSyncTask(ThreadsList* threads, uint num_workers, jlong safepoint_limit_time) :
+    AbstractGangTask("Parallel Safepoint Synchronization"),
+    _threads(threads), _num_workers(num_workers),
+    _safepoint_limit_time(safepoint_limit_time),
+    _initial_running(0), _iterations(1) {}
+
+  void work(uint worker_id) {
+    const uint length = _threads->length();
+    const uint start = (uint)((uint64_t)length * worker_id / _num_workers);
+    const uint end = (uint)((uint64_t)length * (worker_id + 1) / _num_workers);
+
+    for (uint i = start; i < end; i++) {
+      // Make sure the threads start polling, it is time to yield.
+      SafepointMechanism::arm_local_poll(_threads->thread_at(i));
+    }
+    OrderAccess::fence(); // storestore|storeload, global state -> local state
+
+    int still_running = 0;
+    ThreadSafepointState* tss_head = NULL;
+    ThreadSafepointState** p_prev = &tss_head;
+    for (uint i = start; i < end; i++) {
+      ThreadSafepointState* cur_tss = _threads->thread_at(i)->safepoint_state();
+      assert(cur_tss->get_next() == NULL, "Must be NULL");
+      if (!SafepointSynchronize::thread_not_running(cur_tss)) {
+        *p_prev = cur_tss;
+        p_prev = cur_tss->next_ptr();
+        ++still_running;
+      }
+    }
+    *p_prev = NULL;
+    Atomic::add(&_initial_running, still_running);
+
+    int iterations = 1; // The first iteration is above.
+    int64_t start_time = os::javaTimeNanos();
+    while (still_running > 0) {
+      if (SafepointTimeout && _safepoint_limit_time < os::javaTimeNanos()) {
+        SafepointSynchronize::print_safepoint_timeout();
+      }
+      back_off(start_time);
+      still_running -= SafepointSynchronize::unlink_not_running(&tss_head);
+      iterations++;
+    }
+    assert(tss_head == NULL, "Must be empty");
+    update_iterations(iterations);
+  }
+
+  int initial_running() const { return _initial_running; }
+  int iterations() const      { return _iterations; }
+};
+
+WorkGang* SafepointSynchronize::parallel_synchronize_workers(int nof_threads) {
+  if (!ParallelSafepointSynchronization ||
+      nof_threads < (int)ParallelSafepointSynchronizationMinThreads) {
+    return NULL;
+  }
+  return Universe::heap()->safepoint_workers();
+}
+
+int SafepointSynchronize::synchronize_threads_parallel(WorkGang* workers,
+                                                       jlong safepoint_limit_time,
+                                                       int* initial_running) {
+  ThreadsListHandle tlh;
+  uint num_workers = workers->active_workers();
+  ParallelSafepointSyncTask task(tlh.list(), num_workers, safepoint_limit_time);
+  workers->run_task(&task, num_workers);
+  *initial_running = task.initial_running();
+  return task.iterations();
+}
+
+void SafepointSynchronize::arm_safepoint(bool arm_local_polls) {
   // Begin the process of bringing the system to a safepoint.
   // Java threads can be in several different states and are
   // stopped by different mechanisms:
@@ -325,11 +428,13 @@ void SafepointSynchronize::arm_safepoint() {
   _state = _synchronizing;
 
   // Arming the per thread poll while having _state != _not_synchronized means safepointing
-  log_trace(safepoint)("Setting thread local yield flag for threads");
   OrderAccess::storestore(); // storestore, global state -> local state
-  for (JavaThreadIteratorWithHandle jtiwh; JavaThread *cur = jtiwh.next(); ) {
-    // Make sure the threads start polling, it is time to yield.
-    SafepointMechanism::arm_local_poll(cur);
+  if (arm_local_polls) {
+    log_trace(safepoint)("Setting thread local yield flag for threads");
+    for (JavaThreadIteratorWithHandle jtiwh; JavaThread *cur = jtiwh.next(); ) {
+      // Make sure the threads start polling, it is time to yield.
+      SafepointMechanism::arm_local_poll(cur);
+    }
   }
 
   OrderAccess::fence(); // storestore|storeload, global state -> local state
@@ -373,11 +478,19 @@ void SafepointSynchronize::begin() {
   EventSafepointStateSynchronization sync_event;
   int initial_running = 0;
 
+  WorkGang* sync_workers = parallel_synchronize_workers(nof_threads);
+
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
-  arm_safepoint();
+  // The safepoint workers arm the local polls when synchronizing in parallel.
+  arm_safepoint(sync_workers == NULL /* arm_local_polls */);
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  int iterations;
+  if (sync_workers != NULL) {
+    iterations = synchronize_threads_parallel(sync_workers, safepoint_limit_time, &initial_running);
+  } else {
+    iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  }
   assert(_waiting_to_block == 0, "No thread should be running");
 
 #ifndef PRODUCT
@@ -47,6 +47,7 @@
 // exit points *must* be at a safepoint.
 
 class ThreadSafepointState;
+class WorkGang;
 
 class SafepointStateTracker {
   uint64_t _safepoint_id;
@@ -86,6 +87,7 @@ class SafepointSynchronize : AllStatic {
   friend class ThreadSafepointState;
   friend class HandshakeState;
   friend class SafepointStateTracker;
+  friend class ParallelSafepointSyncTask;
 
   // Threads might read this flag directly, without acquiring the Threads_lock:
   static volatile SynchronizeState _state;
@@ -114,8 +116,13 @@ class SafepointSynchronize : AllStatic {
   static void print_safepoint_timeout();
 
   // Helper methods for safepoint procedure:
-  static void arm_safepoint();
+  static void arm_safepoint(bool arm_local_polls);
   static int synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running);
+  // Returns the workers to synchronize with, or NULL to synchronize on the VM thread.
+  static WorkGang* parallel_synchronize_workers(int nof_threads);
+  // Arms the local polls and synchronizes the threads, split among the workers.
+  static int synchronize_threads_parallel(WorkGang* workers, jlong safepoint_limit_time, int* initial_running);
+  static int unlink_not_running(ThreadSafepointState** tss_head);
   static void disarm_safepoint();
   static void increment_jni_active_count();
   static void decrement_waiting_to_block();
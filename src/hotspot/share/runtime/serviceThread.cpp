@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "cds/dynamicArchive.hpp"
 #include "classfile/classLoaderDataGraph.inline.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/protectionDomainCache.hpp"
@@ -149,6 +150,8 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     bool oop_handles_to_release = false;
     bool cldg_cleanup_work = false;
     bool jvmti_tagmap_work = false;
+    bool dynamic_archive_work = false;
+    bool metaspace_trim_work = false;
     {
       // Need state transition ThreadBlockInVM so that this thread
       // will be handled by safepoint correctly when this thread is
@@ -177,7 +180,9 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
               (oopstorage_work = OopStorage::has_cleanup_work_and_reset()) |
               (oop_handles_to_release = (_oop_handle_list != NULL)) |
               (cldg_cleanup_work = ClassLoaderDataGraph::should_clean_metaspaces_and_reset()) |
-              (jvmti_tagmap_work = JvmtiTagMap::has_object_free_events_and_reset())
+              (jvmti_tagmap_work = JvmtiTagMap::has_object_free_events_and_reset()) |
+              (dynamic_archive_work = CDS_ONLY(DynamicArchive::has_idle_dump_request_and_reset()) NOT_CDS(false)) |
+              (metaspace_trim_work = ClassLoaderDataGraph::should_trim_metaspaces_and_reset())
              ) == 0) {
         // Wait until notified that there is some work to do.
         ml.wait();
@@ -241,9 +246,19 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
       ClassLoaderDataGraph::safepoint_and_clean_metaspaces();
     }
 
+    if (metaspace_trim_work) {
+      ClassLoaderDataGraph::trim_metaspaces();
+    }
+
     if (jvmti_tagmap_work) {
       JvmtiTagMap::flush_all_object_free_events();
     }
+
+#if INCLUDE_CDS
+    if (dynamic_archive_work) {
+      DynamicArchive::dump_when_idle(jt);
+    }
+#endif
   }
 }
 
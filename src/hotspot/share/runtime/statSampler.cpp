@@ -34,6 +34,7 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/os.hpp"
 #include "runtime/perfData.inline.hpp"
+#include "runtime/perfMemory.hpp"
 #include "runtime/statSampler.hpp"
 #include "runtime/vm_version.hpp"
 
@@ -111,6 +112,7 @@ void StatSampler::disengage() {
 
   // force a final sample
   sample_data(_sampled);
+  PerfMemory::copy_to_shared();
 }
 
 /*
@@ -171,6 +173,8 @@ void StatSampler::collect_sample() {
   assert(_sampled != NULL, "list not initialized");
 
   sample_data(_sampled);
+
+  PerfMemory::copy_to_shared();
 }
 
 /*
@@ -155,6 +155,7 @@ address StubRoutines::_bigIntegerRightShiftWorker = NULL;
 address StubRoutines::_bigIntegerLeftShiftWorker = NULL;
 
 address StubRoutines::_vectorizedMismatch = NULL;
+address StubRoutines::_vectorizedHashCode = NULL;
 
 address StubRoutines::_dexp = NULL;
 address StubRoutines::_dlog = NULL;
@@ -237,6 +237,7 @@ class StubRoutines: AllStatic {
   static address _bigIntegerLeftShiftWorker;
 
   static address _vectorizedMismatch;
+  static address _vectorizedHashCode;
 
   static address _dexp;
   static address _dlog;
@@ -412,6 +413,7 @@ class StubRoutines: AllStatic {
   static address bigIntegerLeftShift()  { return _bigIntegerLeftShiftWorker; }
 
   static address vectorizedMismatch()  { return _vectorizedMismatch; }
+  static address vectorizedHashCode()  { return _vectorizedHashCode; }
 
   static address dexp()                { return _dexp; }
   static address dlog()                { return _dlog; }
@@ -218,7 +218,8 @@ void NMethodSweeper::sweeper_loop() {
       ThreadBlockInVM tbivm(JavaThread::current());
       MonitorLocker waiter(CodeSweeper_lock, Mutex::_no_safepoint_check_flag);
       const long wait_time = 60*60*24 * 1000;
-      timeout = waiter.wait(wait_time);
+      // A sweep may have requested a follow-up sweep, see sweep().
+      timeout = !_should_sweep && !_force_sweep && waiter.wait(wait_time);
     }
     if (!timeout && (_should_sweep || _force_sweep)) {
       sweep();
@@ -288,11 +289,20 @@ void NMethodSweeper::sweep() {
   do_stack_scanning();
 
   init_sweeper_log();
-  sweep_code_cache();
+  int zombified_count = sweep_code_cache();
 
   // We are done with sweeping the code cache once.
   _total_nof_code_cache_sweeps++;
 
+  // The nmethods made zombies by this sweep are only flushed by the next
+  // one. If compilation has been stopped because the code cache is full,
+  // no allocation will request that sweep, so request it right away
+  // instead of leaving compilation off until some nmethod changes state.
+  if (zombified_count > 0 && !CompileBroker::should_compile_new_jobs()) {
+    MutexLocker mu(CodeSweeper_lock, Mutex::_no_safepoint_check_flag);
+    _should_sweep = true;
+  }
+
   if (_force_sweep) {
     // Notify requester that forced sweep finished
     MutexLocker mu(CodeSweeper_lock, Mutex::_no_safepoint_check_flag);
@@ -319,7 +329,7 @@ static void post_sweep_event(EventSweepCodeCache* event,
   event->commit();
 }
 
-void NMethodSweeper::sweep_code_cache() {
+int NMethodSweeper::sweep_code_cache() {
   ResourceMark rm;
   Ticks sweep_start_counter = Ticks::now();
 
@@ -438,6 +448,8 @@ void NMethodSweeper::sweep_code_cache() {
     log.debug("restart compiler");
     log_sweep("restart_compiler");
   }
+
+  return zombified_count;
 }
 
  // This function updates the sweeper statistics that keep track of nmethods
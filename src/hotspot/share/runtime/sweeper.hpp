@@ -92,7 +92,7 @@ class NMethodSweeper : public AllStatic {
 
   static void init_sweeper_log() NOT_DEBUG_RETURN;
   static bool wait_for_stack_scanning();
-  static void sweep_code_cache();
+  static int  sweep_code_cache();
   static void handle_safepoint_request();
   static void do_stack_scanning();
   static void sweep();
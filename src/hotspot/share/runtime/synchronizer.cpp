@@ -38,6 +38,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/lockStack.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/objectMonitor.hpp"
 #include "runtime/objectMonitor.inline.hpp"
@@ -54,6 +55,7 @@
 #include "runtime/vframe.hpp"
 #include "runtime/vmThread.hpp"
 #include "utilities/align.hpp"
+#include "utilities/concurrentHashTable.inline.hpp"
 #include "utilities/dtrace.hpp"
 #include "utilities/events.hpp"
 #include "utilities/preserveException.hpp"
@@ -204,6 +206,150 @@ int dtrace_waited_probe(ObjectMonitor* monitor, Handle obj, Thread* thr) {
   return 0;
 }
 
+// -----------------------------------------------------------------------------
+// ObjectMonitor table
+//
+// With UseObjectMonitorTable the header of an inflated object keeps its
+// identity hash and only the lock bits tell that the object has a monitor,
+// see markWord::set_has_monitor(). The monitor is found by looking up the
+// identity hash in a concurrent hash table. An object is hashed before its
+// monitor is inserted into the table, and the monitor caches that hash in
+// its header, so entries can still be found after the object died.
+//
+// A monitor is inserted into the table before the monitor bits are set in
+// the header, and the deflater removes it from the table before clearing
+// them. A thread that sees the monitor bits but does not find the monitor
+// is racing with one of these two transitions and retries.
+
+class ObjectMonitorTableConfig : public AllStatic {
+ public:
+  typedef ObjectMonitor* Value;
+
+  static uintx get_hash(Value const& value, bool* is_dead) {
+    *is_dead = false;
+    return (uintx)value->header().hash();
+  }
+  static void* allocate_node(void* context, size_t size, Value const& value) {
+    return AllocateHeap(size, mtSynchronizer);
+  }
+  static void free_node(void* context, void* memory, Value const& value) {
+    FreeHeap(memory);
+  }
+};
+
+typedef ConcurrentHashTable<ObjectMonitorTableConfig, mtSynchronizer> ObjectMonitorTableHash;
+
+static ObjectMonitorTableHash* _object_monitor_table = NULL;
+
+static const size_t ObjectMonitorTableSizeLog = 10;
+static const size_t ObjectMonitorTableEndSizeLog = 24;
+static const size_t ObjectMonitorTableGrowHint = 32;
+
+// Finds the monitor of a live object.
+class ObjectMonitorTableLookup : public StackObj {
+  oop _obj;
+
+ public:
+  explicit ObjectMonitorTableLookup(oop obj) : _obj(obj) {}
+  uintx get_hash() const {
+    return (uintx)_obj->mark().hash();
+  }
+  bool equals(ObjectMonitor** value, bool* is_dead) {
+    *is_dead = false;
+    return (*value)->object_peek() == _obj;
+  }
+};
+
+// Finds a specific monitor, whether or not its object is still alive.
+class ObjectMonitorTableRemoval : public StackObj {
+  ObjectMonitor* _monitor;
+
+ public:
+  explicit ObjectMonitorTableRemoval(ObjectMonitor* monitor) : _monitor(monitor) {}
+  uintx get_hash() const {
+    return (uintx)_monitor->header().hash();
+  }
+  bool equals(ObjectMonitor** value, bool* is_dead) {
+    *is_dead = false;
+    return *value == _monitor;
+  }
+};
+
+class ObjectMonitorTableFound : public StackObj {
+  ObjectMonitor* _monitor;
+
+ public:
+  ObjectMonitorTableFound() : _monitor(NULL) {}
+  void operator()(ObjectMonitor** value) {
+    _monitor = *value;
+  }
+  ObjectMonitor* monitor() const { return _monitor; }
+};
+
+static ObjectMonitor* object_monitor_table_get(Thread* current, oop obj) {
+  ObjectMonitorTableLookup lookup(obj);
+  ObjectMonitorTableFound found;
+  _object_monitor_table->get(current, lookup, found);
+  return found.monitor();
+}
+
+// Returns false if obj already has a monitor in the table.
+static bool object_monitor_table_insert(Thread* current, ObjectMonitor* monitor, oop obj) {
+  assert(monitor->header().hash() == obj->mark().hash(), "must have the hash of obj");
+  ObjectMonitorTableLookup lookup(obj);
+  return _object_monitor_table->insert(current, lookup, monitor);
+}
+
+static void object_monitor_table_remove(Thread* current, ObjectMonitor* monitor) {
+  ObjectMonitorTableRemoval lookup(monitor);
+  bool removed = _object_monitor_table->remove(current, lookup);
+  assert(removed, "monitor must be in the table: " INTPTR_FORMAT, p2i(monitor));
+}
+
+// Grows the table when it has fewer buckets than monitors.
+static void object_monitor_table_try_grow(JavaThread* current, size_t count) {
+  if (!_object_monitor_table->is_max_size_reached() &&
+      count > ((size_t)1 << _object_monitor_table->get_size_log2(current))) {
+    _object_monitor_table->grow(current);
+  }
+}
+
+ObjectMonitor* ObjectSynchronizer::read_monitor(Thread* current, oop obj, markWord mark) {
+  assert(mark.has_monitor(), "must be inflated");
+  if (!UseObjectMonitorTable) {
+    return mark.monitor();
+  }
+  OMCache* cache = current->is_Java_thread() ? &current->as_Java_thread()->om_cache() : NULL;
+  if (cache != NULL) {
+    ObjectMonitor* monitor = cache->get_monitor(obj);
+    if (monitor != NULL) {
+      return monitor;
+    }
+  }
+  ObjectMonitor* monitor = object_monitor_table_get(current, obj);
+  if (monitor == NULL || monitor->is_being_async_deflated()) {
+    return NULL;
+  }
+  if (cache != NULL) {
+    cache->set_monitor(monitor);
+  }
+  return monitor;
+}
+
+void ObjectSynchronizer::remove_deflated_monitor(Thread* current, ObjectMonitor* monitor, oop obj) {
+  assert(UseObjectMonitorTable, "only used with the ObjectMonitor table");
+  object_monitor_table_remove(current, monitor);
+  if (obj != NULL) {
+    // Nobody else changes an inflated header, but use a CAS to catch
+    // violations of that protocol.
+    markWord mark = obj->mark();
+    assert(mark.has_monitor(), "must be inflated: mark=" INTPTR_FORMAT, mark.value());
+    markWord res = obj->cas_set_mark(mark.clear_has_monitor(), mark);
+    guarantee(res == mark, "inflated header must be stable: mark=" INTPTR_FORMAT
+              ", res=" INTPTR_FORMAT, mark.value(), res.value());
+  }
+}
+
 static const int NINFLATIONLOCKS = 256;
 static os::PlatformMutex* gInflationLocks[NINFLATIONLOCKS];
 
@@ -211,6 +357,11 @@ void ObjectSynchronizer::initialize() {
   for (int i = 0; i < NINFLATIONLOCKS; i++) {
     gInflationLocks[i] = new os::PlatformMutex();
   }
+  if (UseObjectMonitorTable) {
+    _object_monitor_table = new ObjectMonitorTableHash(ObjectMonitorTableSizeLog,
+                                                       ObjectMonitorTableEndSizeLog,
+                                                       ObjectMonitorTableGrowHint);
+  }
   // Start the ceiling with the estimate for one thread.
   set_in_use_list_ceiling(AvgMonitorsPerThreadEstimate);
 }
@@ -270,14 +421,24 @@ bool ObjectSynchronizer::quick_notify(oopDesc* obj, JavaThread* current, bool al
   if (obj == NULL) return false;  // slow-path for invalid obj
   const markWord mark = obj->mark();
 
-  if (mark.has_locker() && current->is_lock_owned((address)mark.locker())) {
+  if (UseLightweightLocking) {
+    if (mark.is_fast_locked() && current->lock_stack().contains(oop(obj))) {
+      // Degenerate notify
+      // fast-locked by caller so by definition the implied waitset is empty.
+      return true;
+    }
+  } else if (mark.has_locker() && current->is_lock_owned((address)mark.locker())) {
     // Degenerate notify
     // stack-locked by caller so by definition the implied waitset is empty.
     return true;
   }
 
   if (mark.has_monitor()) {
-    ObjectMonitor* const mon = mark.monitor();
+    ObjectMonitor* const mon = read_monitor(current, obj, mark);
+    if (mon == NULL) {
+      // Racing with deflation, take the slow-path.
+      return false;
+    }
     assert(mon->object() == oop(obj), "invariant");
     if (mon->owner() != current) return false;  // slow-path for IMS exception
 
@@ -324,11 +485,11 @@ bool ObjectSynchronizer::quick_enter(oop obj, JavaThread* current,
   const markWord mark = obj->mark();
 
   if (mark.has_monitor()) {
-    ObjectMonitor* const m = mark.monitor();
+    ObjectMonitor* const m = read_monitor(current, obj, mark);
     // An async deflation or GC can race us before we manage to make
     // the ObjectMonitor busy by setting the owner below. If we detect
     // that race we just bail out to the slow-path here.
-    if (m->object_peek() == NULL) {
+    if (m == NULL || m->object_peek() == NULL) {
       return false;
     }
     JavaThread* const owner = (JavaThread*) m->owner_raw();
@@ -438,7 +599,27 @@ void ObjectSynchronizer::enter(Handle obj, BasicLock* lock, JavaThread* current)
   markWord mark = obj->mark();
   assert(!mark.has_bias_pattern(), "should not see bias pattern here");
 
-  if (mark.is_neutral()) {
+  if (UseLightweightLocking) {
+    // The object header is never displaced to the BasicLock, mark it
+    // as unused so that it is not mistaken for a stack-lock.
+    lock->set_displaced_header(markWord::unused_mark());
+    LockStack& lock_stack = current->lock_stack();
+    if (lock_stack.can_push()) {
+      while (mark.is_neutral()) {
+        // Try to swing into the fast-locked state.
+        markWord old_mark = obj()->cas_set_mark(mark.set_fast_locked(), mark);
+        if (old_mark == mark) {
+          lock_stack.push(obj());
+          return;
+        }
+        mark = old_mark;
+      }
+      if (mark.is_fast_locked() && lock_stack.try_recursive_enter(obj())) {
+        return;
+      }
+    }
+    // Fall through to inflate() ...
+  } else if (mark.is_neutral()) {
     // Anticipate successful CAS -- the ST of the displaced mark must
     // be visible <= the ST performed by the CAS.
     lock->set_displaced_header(mark);
@@ -472,6 +653,35 @@ void ObjectSynchronizer::enter(Handle obj, BasicLock* lock, JavaThread* current)
 
 void ObjectSynchronizer::exit(oop object, BasicLock* lock, JavaThread* current) {
   markWord mark = object->mark();
+
+  if (UseLightweightLocking) {
+    LockStack& lock_stack = current->lock_stack();
+    if (mark.is_fast_locked() && lock_stack.try_recursive_exit(object)) {
+      return;
+    }
+    // A fast-lock that is recursive but not on the top of the lock stack
+    // has to be inflated to be exited.
+    if (!lock_stack.is_recursive(object)) {
+      while (mark.is_fast_locked()) {
+        markWord old_mark = object->cas_set_mark(mark.set_unlocked(), mark);
+        if (old_mark == mark) {
+          int removed = lock_stack.remove(object);
+          assert(removed == 1, "must not be recursive here");
+          return;
+        }
+        // Another thread installed a hash code or inflated the monitor.
+        mark = old_mark;
+      }
+    }
+    // The ObjectMonitor* can't be async deflated until ownership is
+    // dropped inside exit() and the ObjectMonitor* must be !is_busy().
+    // If the monitor was inflated by another thread, inflate() makes
+    // the current thread its owner.
+    ObjectMonitor* monitor = inflate(current, object, inflate_cause_vm_internal);
+    monitor->exit(current);
+    return;
+  }
+
   // We cannot check for Biased Locking if we are racing an inflation.
   assert(mark == markWord::INFLATING() ||
          !mark.has_bias_pattern(), "should not see bias pattern here");
@@ -683,7 +893,12 @@ void ObjectSynchronizer::notify(Handle obj, TRAPS) {
   }
 
   markWord mark = obj->mark();
-  if (mark.has_locker() && current->is_lock_owned((address)mark.locker())) {
+  if (UseLightweightLocking) {
+    if (mark.is_fast_locked() && current->lock_stack().contains(obj())) {
+      // Not inflated so there can't be any waiters to notify.
+      return;
+    }
+  } else if (mark.has_locker() && current->is_lock_owned((address)mark.locker())) {
     // Not inflated so there can't be any waiters to notify.
     return;
   }
@@ -702,7 +917,12 @@ void ObjectSynchronizer::notifyall(Handle obj, TRAPS) {
   }
 
   markWord mark = obj->mark();
-  if (mark.has_locker() && current->is_lock_owned((address)mark.locker())) {
+  if (UseLightweightLocking) {
+    if (mark.is_fast_locked() && current->lock_stack().contains(obj())) {
+      // Not inflated so there can't be any waiters to notify.
+      return;
+    }
+  } else if (mark.has_locker() && current->is_lock_owned((address)mark.locker())) {
     // Not inflated so there can't be any waiters to notify.
     return;
   }
@@ -730,7 +950,9 @@ static SharedGlobals GVars;
 
 static markWord read_stable_mark(oop obj) {
   markWord mark = obj->mark();
-  if (!mark.is_being_inflated()) {
+  if (!mark.is_being_inflated() || UseLightweightLocking) {
+    // Lightweight locking does not use the INFLATING protocol, and a
+    // fast-locked header can be all zeros.
     return mark;       // normal fast-path return
   }
 
@@ -875,7 +1097,8 @@ intptr_t ObjectSynchronizer::FastHashCode(Thread* current, oop obj) {
     // object should remain ineligible for biased locking
     assert(!mark.has_bias_pattern(), "invariant");
 
-    if (mark.is_neutral()) {               // if this is a normal header
+    if (mark.is_neutral() ||               // if this is a normal header
+        (UseLightweightLocking && mark.is_fast_locked())) { // or fast-locked, which keeps it in place
       hash = mark.hash();
       if (hash != 0) {                     // if it has a hash, just return it
         return hash;
@@ -891,6 +1114,15 @@ intptr_t ObjectSynchronizer::FastHashCode(Thread* current, oop obj) {
       // installed the hash just before our attempt or inflation has
       // occurred or... so we fall thru to inflate the monitor for
       // stability and then install the hash.
+      if (UseObjectMonitorTable) {
+        // Inflation needs the hash, so the header is retried instead.
+        continue;
+      }
+    } else if (mark.has_monitor() && UseObjectMonitorTable) {
+      // The hash is installed before inflation and stays in the header.
+      hash = mark.hash();
+      assert(hash != 0, "inflated object must be hashed: mark=" INTPTR_FORMAT, mark.value());
+      return hash;
     } else if (mark.has_monitor()) {
       monitor = mark.monitor();
       temp = monitor->header();
@@ -918,7 +1150,7 @@ intptr_t ObjectSynchronizer::FastHashCode(Thread* current, oop obj) {
       }
       // Fall thru so we only have one place that installs the hash in
       // the ObjectMonitor.
-    } else if (current->is_lock_owned((address)mark.locker())) {
+    } else if (!UseLightweightLocking && current->is_lock_owned((address)mark.locker())) {
       // This is a stack lock owned by the calling thread so fetch the
       // displaced markWord from the BasicLock on the stack.
       temp = mark.displaced_mark_helper();
@@ -995,6 +1227,11 @@ bool ObjectSynchronizer::current_thread_holds_lock(JavaThread* current,
 
   markWord mark = read_stable_mark(obj);
 
+  if (UseLightweightLocking && mark.is_fast_locked()) {
+    // Fast-locked case, see if the object is on the current lock stack
+    return current->lock_stack().contains(obj);
+  }
+
   // Uncontended case, header points to stack
   if (mark.has_locker()) {
     return current->is_lock_owned((address)mark.locker());
@@ -1003,8 +1240,9 @@ bool ObjectSynchronizer::current_thread_holds_lock(JavaThread* current,
   if (mark.has_monitor()) {
     // The first stage of async deflation does not affect any field
     // used by this comparison so the ObjectMonitor* is usable here.
-    ObjectMonitor* monitor = mark.monitor();
-    return monitor->is_entered(current) != 0;
+    ObjectMonitor* monitor = read_monitor(current, obj, mark);
+    // A monitor that is being deflated has no owner.
+    return monitor != NULL && monitor->is_entered(current) != 0;
   }
   // Unlocked case, header in place
   assert(mark.is_neutral(), "sanity check");
@@ -1027,6 +1265,11 @@ JavaThread* ObjectSynchronizer::get_lock_owner(ThreadsList * t_list, Handle h_ob
 
   markWord mark = read_stable_mark(obj);
 
+  if (UseLightweightLocking && mark.is_fast_locked()) {
+    // Fast-locked case, the owner has the object on its lock stack
+    return Threads::owning_thread_from_object(t_list, obj);
+  }
+
   // Uncontended case, header points to stack
   if (mark.has_locker()) {
     owner = (address) mark.locker();
@@ -1036,9 +1279,14 @@ JavaThread* ObjectSynchronizer::get_lock_owner(ThreadsList * t_list, Handle h_ob
   else if (mark.has_monitor()) {
     // The first stage of async deflation does not affect any field
     // used by this comparison so the ObjectMonitor* is usable here.
-    ObjectMonitor* monitor = mark.monitor();
-    assert(monitor != NULL, "monitor should be non-null");
-    owner = (address) monitor->owner();
+    ObjectMonitor* monitor = read_monitor(Thread::current(), obj, mark);
+    if (monitor == NULL) {
+      // Only a monitor without an owner is deflated.
+      assert(UseObjectMonitorTable, "monitor should be non-null");
+      return NULL;
+    }
+    // owning_thread_from_monitor() may also return NULL here
+    return Threads::owning_thread_from_monitor(t_list, monitor);
   }
 
   if (owner != NULL) {
@@ -1188,7 +1436,8 @@ static void post_monitor_inflate_event(EventJavaMonitorInflate* event,
 void ObjectSynchronizer::inflate_helper(oop obj) {
   markWord mark = obj->mark();
   if (mark.has_monitor()) {
-    ObjectMonitor* monitor = mark.monitor();
+    ObjectMonitor* monitor = read_monitor(Thread::current(), obj, mark);
+    assert(monitor != NULL, "a locked monitor is not deflated");
     markWord dmw = monitor->header();
     assert(dmw.is_neutral(), "sanity check: header=" INTPTR_FORMAT, dmw.value());
     return;
@@ -1200,12 +1449,17 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread* current, oop object,
                                            const InflateCause cause) {
   EventJavaMonitorInflate event;
 
+  // With lightweight locking only the owner of a fast-lock knows that it
+  // owns the monitor, see ANONYMOUS_OWNER.
+  JavaThread* inflating_thread = current->is_Java_thread() ? current->as_Java_thread() : NULL;
+
   for (;;) {
     const markWord mark = object->mark();
     assert(!mark.has_bias_pattern(), "invariant");
 
     // The mark can be in one of the following states:
     // *  Inflated     - just return
+    // *  Fast-locked  - coerce it to inflated (UseLightweightLocking)
     // *  Stack-locked - coerce it to inflated
     // *  INFLATING    - busy wait for conversion to complete
     // *  Neutral      - aggressively inflate the object.
@@ -1213,19 +1467,132 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread* current, oop object,
 
     // CASE: inflated
     if (mark.has_monitor()) {
-      ObjectMonitor* inf = mark.monitor();
+      ObjectMonitor* inf = read_monitor(current, object, mark);
+      if (inf == NULL) {
+        // UseObjectMonitorTable: racing with the deflation of the
+        // previous monitor, wait for the header to be restored.
+        SpinPause();
+        continue;
+      }
       markWord dmw = inf->header();
       assert(dmw.is_neutral(), "invariant: header=" INTPTR_FORMAT, dmw.value());
+      if (UseLightweightLocking && inf->is_owner_anonymous() &&
+          inflating_thread != NULL && inflating_thread->lock_stack().contains(object)) {
+        inf->set_owner_from_anonymous(inflating_thread);
+        inf->_recursions = inflating_thread->lock_stack().remove(object) - 1;
+      }
       return inf;
     }
 
+    LogStreamHandle(Trace, monitorinflation) lsh;
+
+    // CASE: neutral or fast-locked with the ObjectMonitor table
+    // The monitor is keyed by the identity hash, so the object is hashed
+    // first. The inflating thread inserts the monitor into the table and
+    // then sets the monitor bits; the other threads wait for that to be
+    // done, see ObjectMonitor table above.
+    if (UseObjectMonitorTable) {
+      if (mark.hash() == 0) {
+        FastHashCode(current, object);
+        continue;
+      }
+      ObjectMonitor* m = new ObjectMonitor(object);
+      m->set_header(mark.set_unlocked());
+      if (!object_monitor_table_insert(current, m, object)) {
+        // Another thread is inflating the object.
+        delete m;
+        SpinPause();
+        continue;
+      }
+      // Nobody else can install a monitor now, but the object can still
+      // be fast-locked and unlocked until the monitor bits are set.
+      markWord cur = object->mark();
+      bool own;
+      for (;;) {
+        assert(!cur.has_monitor(), "only the inserting thread inflates");
+        own = cur.is_fast_locked() && inflating_thread != NULL &&
+              inflating_thread->lock_stack().contains(object);
+        void* owner = NULL;
+        if (cur.is_fast_locked()) {
+          owner = own ? (void*)inflating_thread : ANONYMOUS_OWNER;
+        }
+        m->set_owner_from(m->owner_raw(), owner);
+        markWord res = object->cas_set_mark(cur.set_has_monitor(), cur);
+        if (res == cur) {
+          break;
+        }
+        cur = res;
+      }
+      if (own) {
+        m->_recursions = inflating_thread->lock_stack().remove(object) - 1;
+      }
+
+      // Once ObjectMonitor is configured and the object is associated
+      // with the ObjectMonitor, it is safe to allow async deflation:
+      _in_use_list.add(m);
+
+      OM_PERFDATA_OP(Inflations, inc());
+      if (log_is_enabled(Trace, monitorinflation)) {
+        ResourceMark rm(current);
+        lsh.print_cr("inflate(table): object=" INTPTR_FORMAT ", mark="
+                     INTPTR_FORMAT ", type='%s'", p2i(object),
+                     object->mark().value(), object->klass()->external_name());
+      }
+      if (event.should_commit()) {
+        post_monitor_inflate_event(&event, object, cause);
+      }
+      return m;
+    }
+
+    // CASE: fast-locked
+    // Could be fast-locked either by this thread or by some other thread.
+    // Without the INFLATING protocol the monitor is installed directly; an
+    // owner that is not the inflating thread is recorded as anonymous and
+    // claims the monitor the next time it operates on it.
+    if (UseLightweightLocking) {
+      if (mark.is_fast_locked()) {
+        ObjectMonitor* m = new ObjectMonitor(object);
+        m->set_header(mark.set_unlocked());
+        bool own = inflating_thread != NULL && inflating_thread->lock_stack().contains(object);
+        if (own) {
+          m->set_owner_from(NULL, inflating_thread);
+        } else {
+          m->set_owner_anonymous();
+        }
+        if (object->cas_set_mark(markWord::encode(m), mark) != mark) {
+          delete m;
+          continue;       // Interference -- just retry
+        }
+        if (own) {
+          m->_recursions = inflating_thread->lock_stack().remove(object) - 1;
+        }
+
+        // Once ObjectMonitor is configured and the object is associated
+        // with the ObjectMonitor, it is safe to allow async deflation:
+        _in_use_list.add(m);
+
+        OM_PERFDATA_OP(Inflations, inc());
+        if (log_is_enabled(Trace, monitorinflation)) {
+          ResourceMark rm(current);
+          lsh.print_cr("inflate(fast-locked): object=" INTPTR_FORMAT ", mark="
+                       INTPTR_FORMAT ", type='%s'", p2i(object),
+                       object->mark().value(), object->klass()->external_name());
+        }
+        if (event.should_commit()) {
+          post_monitor_inflate_event(&event, object, cause);
+        }
+        return m;
+      }
+      // Fall through to the neutral case.
+    }
+
     // CASE: inflation in progress - inflating over a stack-lock.
     // Some other thread is converting from stack-locked to inflated.
     // Only that thread can complete inflation -- other threads must wait.
     // The INFLATING value is transient.
     // Currently, we spin/yield/park and poll the markword, waiting for inflation to finish.
     // We could always eliminate polling by parking the thread on some auxiliary list.
-    if (mark == markWord::INFLATING()) {
+    if (!UseLightweightLocking && mark == markWord::INFLATING()) {
       read_stable_mark(object);
       continue;
     }
@@ -1240,9 +1607,7 @@ ObjectMonitor* ObjectSynchronizer::inflate(Thread* current, oop object,
     // the interval in which INFLATING appeared in the mark, thus increasing
     // the odds of inflation contention.
 
-    LogStreamHandle(Trace, monitorinflation) lsh;
-
-    if (mark.has_locker()) {
+    if (!UseLightweightLocking && mark.has_locker()) {
       ObjectMonitor* m = new ObjectMonitor(object);
       // Optimistically prepare the ObjectMonitor - anticipate successful CAS
       // We do this before the CAS in order to minimize the length of time
@@ -1432,6 +1797,10 @@ class HandshakeForDeflation : public HandshakeClosure {
   void do_thread(Thread* thread) {
     log_trace(monitorinflation)("HandshakeForDeflation::do_thread: thread="
                                 INTPTR_FORMAT, p2i(thread));
+    if (UseObjectMonitorTable) {
+      // Drop the references to the ObjectMonitors that are about to be freed.
+      thread->as_Java_thread()->om_cache().clear();
+    }
   }
 };
 
@@ -1526,6 +1895,10 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
   OM_PERFDATA_OP(MonExtant, set_value(_in_use_list.count()));
   OM_PERFDATA_OP(Deflations, inc(deflated_count));
 
+  if (UseObjectMonitorTable && current->is_Java_thread()) {
+    object_monitor_table_try_grow(current->as_Java_thread(), _in_use_list.count());
+  }
+
   GVars.stw_random = os::random();
 
   if (deflated_count != 0) {
@@ -1742,7 +2115,7 @@ void ObjectSynchronizer::chk_in_use_entry(ObjectMonitor* n, outputStream* out,
                     p2i(obj), mark.value());
       *error_cnt_p = *error_cnt_p + 1;
     }
-    ObjectMonitor* const obj_mon = mark.monitor();
+    ObjectMonitor* const obj_mon = read_monitor(Thread::current(), obj, mark);
     if (n != obj_mon) {
       out->print_cr("ERROR: monitor=" INTPTR_FORMAT ": in-use monitor's "
                     "object does not refer to the same monitor: obj="
@@ -121,6 +121,14 @@ class ObjectSynchronizer : AllStatic {
   static void inflate_helper(oop obj);
   static const char* inflate_cause_name(const InflateCause cause);
 
+  // Returns the ObjectMonitor of an object whose mark has_monitor(). With
+  // UseObjectMonitorTable the monitor is looked up in the ObjectMonitor
+  // table, and NULL is returned when racing with inflation or deflation.
+  static ObjectMonitor* read_monitor(Thread* current, oop obj, markWord mark);
+  // Removes a deflated ObjectMonitor from the ObjectMonitor table and
+  // clears the monitor bits in the header of obj, if obj is still alive.
+  static void remove_deflated_monitor(Thread* current, ObjectMonitor* monitor, oop obj);
+
   // Returns the identity hash value for an oop
   // NOTE: It may cause monitor inflation
   static intptr_t identity_hash_value_for(Handle obj);
@@ -30,6 +30,7 @@
 #include "classfile/classLoader.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/javaThreadStatus.hpp"
+#include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
@@ -89,10 +90,11 @@
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/jniPeriodicChecker.hpp"
+#include "runtime/lockStack.inline.hpp"
 #include "runtime/monitorDeflationThread.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/nonJavaThread.hpp"
-#include "runtime/objectMonitor.hpp"
+#include "runtime/objectMonitor.inline.hpp"
 #include "runtime/orderAccess.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/prefetch.inline.hpp"
@@ -102,6 +104,7 @@
 #include "runtime/serviceThread.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stackFrameStream.inline.hpp"
+#include "runtime/stackWatermark.hpp"
 #include "runtime/stackWatermarkSet.hpp"
 #include "runtime/statSampler.hpp"
 #include "runtime/task.hpp"
@@ -148,6 +151,9 @@
 #if INCLUDE_JFR
 #include "jfr/jfr.hpp"
 #endif
+#ifdef LINUX
+#include "osContainer_linux.hpp"
+#endif
 
 // Initialization after module runtime initialization
 void universe_post_module_init();  // must happen after call_initPhase2
@@ -242,10 +248,12 @@ Thread::Thread() {
 
   // allocated data structures
   set_osthread(NULL);
+  _chunk_cache = UseThreadLocalChunkCache ? new ChunkCache() : NULL;
   set_resource_area(new (mtThread)ResourceArea());
   DEBUG_ONLY(_current_resource_mark = NULL;)
   set_handle_area(new (mtThread) HandleArea(NULL));
   set_metadata_handles(new (ResourceObj::C_HEAP, mtClass) GrowableArray<Metadata*>(30, mtClass));
+  set_symbol_lookup_cache(NULL);
   set_active_handles(NULL);
   set_free_handle_block(NULL);
   set_last_handle_mark(NULL);
@@ -266,6 +274,8 @@ Thread::Thread() {
   NOT_PRODUCT(_skip_gcalot = false;)
   _jvmti_env_iteration_count = 0;
   set_allocated_bytes(0);
+  _arena_bytes = 0;
+  _arena_peak = 0;
   _current_pending_raw_monitor = NULL;
 
   // thread-specific hashCode stream generator state - Marsaglia shift-xor form
@@ -442,6 +452,12 @@ Thread::~Thread() {
 
   delete handle_area();
   delete metadata_handles();
+  delete symbol_lookup_cache();
+
+  // Chunks freed from now on go straight to the global pools.
+  ChunkCache* chunk_cache = _chunk_cache;
+  _chunk_cache = NULL;
+  delete chunk_cache;
 
   // osthread() can be NULL, if creation of thread failed.
   if (osthread() != NULL) os::free_thread(osthread());
@@ -1069,6 +1085,9 @@ JavaThread::JavaThread() :
   _frames_to_pop_failed_realloc(0),
 
   _handshake(this),
+  _lock_stack(),
+  _om_cache(),
+  _jni_handle_cache(nullptr),
 
   _popframe_preserved_args(nullptr),
   _popframe_preserved_args_size(0),
@@ -1076,6 +1095,7 @@ JavaThread::JavaThread() :
   _jvmti_thread_state(nullptr),
   _interp_only_mode(0),
   _should_post_on_exceptions_flag(JNI_FALSE),
+  _profile_sample_seed((juint)os::random()),
   _thread_stat(new ThreadStatistics()),
 
   _parker(),
@@ -1233,6 +1253,9 @@ JavaThread::~JavaThread() {
     set_deferred_updates(NULL);
   }
 
+  // Return the cached JNI handles to their storages
+  JNIHandles::delete_thread_cache(this);
+
   // All Java related clean up happens in exit
   ThreadSafepointState::destroy(this);
   if (_thread_stat != NULL) delete _thread_stat;
@@ -1997,6 +2020,8 @@ void JavaThread::oops_do_no_frames(OopClosure* f, CodeBlobClosure* cf) {
   if (jvmti_thread_state() != NULL) {
     jvmti_thread_state()->oops_do(f, cf);
   }
+
+  _lock_stack.oops_do(f);
 }
 
 void JavaThread::oops_do_frames(OopClosure* f, CodeBlobClosure* cf) {
@@ -2764,10 +2789,12 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
 
   // Timing (must come after argument parsing)
   TraceTime timer("Create VM", TRACETIME_LOG(Info, startuptime));
+  start_startup_phases();
 
   // Initialize the os module after parsing the args
   jint os_init_2_result = os::init_2();
   if (os_init_2_result != JNI_OK) return os_init_2_result;
+  record_startup_phase("os init");
 
 #ifdef CAN_SHOW_REGISTERS_ON_ASSERT
   // Initialize assert poison page mechanism.
@@ -2801,6 +2828,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
 
   // Initialize global data structures and create system classes in heap
   vm_init_globals();
+  record_startup_phase("vm_init_globals");
 
 #if INCLUDE_JVMCI
   if (JVMCICounterSize > 0) {
@@ -2909,6 +2937,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   JvmtiExport::post_early_vm_start();
 
   initialize_java_lang_classes(main_thread, CHECK_JNI_ERR);
+  record_startup_phase("java.lang classes");
 
   quicken_jni_functions();
 
@@ -2990,6 +3019,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   // This will initialize the module system.  Only java.base classes can be
   // loaded until phase 2 completes
   call_initPhase2(CHECK_JNI_ERR);
+  record_startup_phase("initPhase2 (module system)");
 
   JFR_ONLY(Jfr::on_create_vm_2();)
 
@@ -3002,6 +3032,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
 
   // Final system initialization including security manager and system class loader
   call_initPhase3(CHECK_JNI_ERR);
+  record_startup_phase("initPhase3 (system class loader)");
 
   // cache the system and platform class loaders
   SystemDictionary::compute_java_loaders(CHECK_JNI_ERR);
@@ -3047,6 +3078,8 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
 
   StatSampler::engage();
   if (CheckJNICalls)                  JniPeriodicChecker::engage();
+  LINUX_ONLY(OSContainer::start_limit_watcher();)
+  CDS_ONLY(DynamicArchive::start_idle_dump_task();)
 
   BiasedLocking::init();
 
@@ -3076,6 +3109,7 @@ jint Threads::create_vm(JavaVMInitArgs* args, bool* canTryAgain) {
   }
 
   create_vm_timer.end();
+  record_startup_phase("create_vm finish");
 #ifdef ASSERT
   _vm_complete = true;
 #endif
@@ -3479,6 +3513,7 @@ jboolean Threads::is_supported_jni_version(jint version) {
   if (version == JNI_VERSION_1_8) return JNI_TRUE;
   if (version == JNI_VERSION_9) return JNI_TRUE;
   if (version == JNI_VERSION_10) return JNI_TRUE;
+  if (version == JNI_VERSION_17) return JNI_TRUE;
   return JNI_FALSE;
 }
 
@@ -3704,6 +3739,28 @@ JavaThread *Threads::owning_thread_from_monitor_owner(ThreadsList * t_list,
   return the_owner;
 }
 
+JavaThread* Threads::owning_thread_from_object(ThreadsList* t_list, oop obj) {
+  assert(UseLightweightLocking, "Only with lightweight locking");
+  DO_JAVA_THREADS(t_list, q) {
+    // Need to start processing before accessing oops in the thread.
+    StackWatermark* watermark = StackWatermarkSet::get(q, StackWatermarkKind::gc);
+    if (watermark != NULL) {
+      watermark->start_processing();
+    }
+    if (q->lock_stack().contains(obj)) {
+      return q;
+    }
+  }
+  return NULL;
+}
+
+JavaThread* Threads::owning_thread_from_monitor(ThreadsList* t_list, ObjectMonitor* monitor) {
+  if (UseLightweightLocking && monitor->is_owner_anonymous()) {
+    return owning_thread_from_object(t_list, monitor->object());
+  }
+  return owning_thread_from_monitor_owner(t_list, (address)monitor->owner());
+}
+
 class PrintOnClosure : public ThreadClosure {
 private:
   outputStream* _st;
@@ -36,6 +36,7 @@
 #include "runtime/globals.hpp"
 #include "runtime/handshake.hpp"
 #include "runtime/javaFrameAnchor.hpp"
+#include "runtime/lockStack.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/park.hpp"
@@ -61,6 +62,7 @@ class ThreadsList;
 class ThreadsSMRSupport;
 
 class JNIHandleBlock;
+class JNIHandleCache;
 class JvmtiRawMonitor;
 class JvmtiSampledObjectAllocEventCollector;
 class JvmtiThreadState;
@@ -82,6 +84,8 @@ class ICRefillVerifier;
 
 class Metadata;
 class ResourceArea;
+class SymbolLookupCache;
+class ChunkCache;
 
 class OopStorage;
 
@@ -289,6 +293,8 @@ class Thread: public ThreadShadow {
   ThreadLocalAllocBuffer _tlab;                 // Thread-local eden
   jlong _allocated_bytes;                       // Cumulative number of bytes allocated on
                                                 // the Java heap
+  ssize_t _arena_bytes;                         // Arena memory grown by this thread
+  ssize_t _arena_peak;                          // High-water mark of _arena_bytes
   ThreadHeapSampler _heap_sampler;              // For use when sampling the memory.
 
   ThreadStatisticalInfo _statistical_info;      // Statistics about the thread
@@ -432,6 +438,12 @@ class Thread: public ThreadShadow {
   GrowableArray<Metadata*>* metadata_handles() const          { return _metadata_handles; }
   void set_metadata_handles(GrowableArray<Metadata*>* handles){ _metadata_handles = handles; }
 
+  // Recently looked up symbols, see SymbolTable::new_symbol().
+  SymbolLookupCache* symbol_lookup_cache() const              { return _symbol_lookup_cache; }
+  void set_symbol_lookup_cache(SymbolLookupCache* cache)      { _symbol_lookup_cache = cache; }
+
+  ChunkCache* chunk_cache() const                             { return _chunk_cache; }
+
   // Thread-Local Allocation Buffer (TLAB) support
   ThreadLocalAllocBuffer& tlab()                 { return _tlab; }
   void initialize_tlab();
@@ -441,6 +453,20 @@ class Thread: public ThreadShadow {
   void incr_allocated_bytes(jlong size) { _allocated_bytes += size; }
   inline jlong cooked_allocated_bytes();
 
+  // Arena memory accounting, see Arena::set_size_in_bytes. Arena memory is
+  // charged to the thread that grows or frees the arena, which is not always
+  // the thread that created it, so the balance of a thread can be negative.
+  void update_arena_bytes(ssize_t delta) {
+    _arena_bytes += delta;
+    if (_arena_bytes > _arena_peak) {
+      _arena_peak = _arena_bytes;
+    }
+  }
+  ssize_t arena_bytes() const           { return _arena_bytes; }
+  ssize_t arena_peak() const            { return _arena_peak; }
+  // Restarts the high-water mark at the current arena memory.
+  void reset_arena_peak()               { _arena_peak = _arena_bytes; }
+
   ThreadHeapSampler& heap_sampler()     { return _heap_sampler; }
 
   ThreadStatisticalInfo& statistical_info() { return _statistical_info; }
@@ -551,6 +577,11 @@ protected:
   HandleArea* _handle_area;
   GrowableArray<Metadata*>* _metadata_handles;
 
+  SymbolLookupCache* _symbol_lookup_cache;
+
+  // Thread local cache of arena chunks, see UseThreadLocalChunkCache
+  ChunkCache* _chunk_cache;
+
   // Support for stack overflow handling, get_thread, etc.
   address          _stack_base;
   size_t           _stack_size;
@@ -1136,6 +1167,21 @@ class JavaThread: public Thread {
     return _handshake.active_handshaker() == th || this == th;
   }
 
+  // Support for lightweight locking
+ private:
+  LockStack _lock_stack;
+  OMCache _om_cache;
+ public:
+  LockStack& lock_stack() { return _lock_stack; }
+  OMCache& om_cache() { return _om_cache; }
+
+  // Support for UseJNIHandleCache
+ private:
+  JNIHandleCache* _jni_handle_cache;
+ public:
+  JNIHandleCache* jni_handle_cache() const         { return _jni_handle_cache; }
+  void set_jni_handle_cache(JNIHandleCache* cache) { _jni_handle_cache = cache; }
+
   // Suspend/resume support for JavaThread
   bool java_suspend(); // higher-level suspension logic called by the public APIs
   bool java_resume();  // higher-level resume logic called by the public APIs
@@ -1293,6 +1339,7 @@ class JavaThread: public Thread {
   static ByteSize should_post_on_exceptions_flag_offset() {
     return byte_offset_of(JavaThread, _should_post_on_exceptions_flag);
   }
+  static ByteSize profile_sample_seed_offset()   { return byte_offset_of(JavaThread, _profile_sample_seed); }
   static ByteSize doing_unsafe_access_offset() { return byte_offset_of(JavaThread, _doing_unsafe_access); }
   NOT_PRODUCT(static ByteSize requires_cross_modify_fence_offset()  { return byte_offset_of(JavaThread, _requires_cross_modify_fence); })
 
@@ -1522,6 +1569,11 @@ class JavaThread: public Thread {
   int   should_post_on_exceptions_flag()  { return _should_post_on_exceptions_flag; }
   void  set_should_post_on_exceptions_flag(int val)  { _should_post_on_exceptions_flag = val; }
 
+ private:
+  // Pseudo random seed used by C1 compiled code to sample profile
+  // updates (see Tier3ProfileSampleFreqLog)
+  juint  _profile_sample_seed;
+
  private:
   ThreadStatistics *_thread_stat;
 
@@ -1695,6 +1747,11 @@ class Threads: AllStatic {
   static JavaThread *owning_thread_from_monitor_owner(ThreadsList * t_list,
                                                       address owner);
 
+  // Get owning Java thread of a fast-locked object, with UseLightweightLocking.
+  static JavaThread* owning_thread_from_object(ThreadsList* t_list, oop obj);
+  // Get owning Java thread of the monitor.
+  static JavaThread* owning_thread_from_monitor(ThreadsList* t_list, ObjectMonitor* monitor);
+
   // Number of threads on the active threads list
   static int number_of_threads()                 { return _number_of_threads; }
   // Number of non-daemon threads on the active threads list
@@ -374,7 +374,7 @@ double ThreadHeapSampler::fast_log2(const double& d) {
 // -log_e(q)/m = x
 // log_2(q) * (-log_e(2) * 1/m) = x
 // In the code, q is actually in the range 1 to 2**26, hence the -26 below
-void ThreadHeapSampler::pick_next_geometric_sample() {
+size_t ThreadHeapSampler::next_geometric_sample() {
   _rnd = next_random(_rnd);
   // Take the top 26 bits as the random number
   // (This plus a 1<<58 sampling bound gives a max possible step of
@@ -395,8 +395,11 @@ void ThreadHeapSampler::pick_next_geometric_sample() {
   double result =
       (0.0 < log_val ? 0.0 : log_val) * (-log(2.0) * (get_sampling_interval())) + 1;
   assert(result > 0 && result < static_cast<double>(SIZE_MAX), "Result is not in an acceptable range.");
-  size_t interval = static_cast<size_t>(result);
-  _bytes_until_sample = interval;
+  return static_cast<size_t>(result);
+}
+
+void ThreadHeapSampler::pick_next_geometric_sample() {
+  _bytes_until_sample = next_geometric_sample();
 }
 
 void ThreadHeapSampler::pick_next_sample(size_t overflowed_bytes) {
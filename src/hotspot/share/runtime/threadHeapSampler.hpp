@@ -40,7 +40,7 @@ class ThreadHeapSampler {
   void pick_next_sample(size_t overflowed_bytes = 0);
 
   static double fast_log2(const double& d);
-  uint64_t next_random(uint64_t rnd);
+  static uint64_t next_random(uint64_t rnd);
 
  public:
   ThreadHeapSampler() {
@@ -60,6 +60,10 @@ class ThreadHeapSampler {
 
   static void set_sampling_interval(int sampling_interval);
   static int get_sampling_interval();
+
+  // Returns a random number of bytes until the next sample, drawn from a
+  // geometric distribution with the current sampling interval as its mean.
+  static size_t next_geometric_sample();
 };
 
 #endif // SHARE_RUNTIME_THREADHEAPSAMPLER_HPP
@@ -125,7 +125,8 @@ volatile uint         ThreadsSMRSupport::_tlh_times = 0;
 
 ThreadsList*          ThreadsSMRSupport::_to_delete_list = NULL;
 
-// # of parallel ThreadsLists on the to-delete list.
+// # of parallel ThreadsLists on the to-delete list. Also used to batch
+// the hazard ptr scans in free_list(), see ThreadSMRFreeListBatchSize.
 // Impl note: Hard to imagine > 64K ThreadsLists needing to be deleted so
 // this could be 16-bit, but there is no nice 16-bit _FORMAT support.
 uint                  ThreadsSMRSupport::_to_delete_list_cnt = 0;
@@ -863,13 +864,20 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
 
   threads->set_next_list(_to_delete_list);
   _to_delete_list = threads;
+  _to_delete_list_cnt++;
   if (EnableThreadSMRStatistics) {
-    _to_delete_list_cnt++;
     if (_to_delete_list_cnt > _to_delete_list_max) {
       _to_delete_list_max = _to_delete_list_cnt;
     }
   }
 
+  if (_to_delete_list_cnt < ThreadSMRFreeListBatchSize) {
+    // Defer the hazard ptr scan until enough ThreadsLists have been
+    // retired, so that one scan of all threads frees all of them.
+    log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is deferred.", os::current_thread_id(), p2i(threads));
+    return;
+  }
+
   // Gather a hash table of the current hazard ptrs:
   ThreadScanHashtable *scan_table = new ThreadScanHashtable();
   ScanHazardPtrGatherThreadsListClosure scan_cl(scan_table);
@@ -897,9 +905,9 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
       log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is freed.", os::current_thread_id(), p2i(current));
       if (current == threads) threads_is_freed = true;
       delete current;
+      _to_delete_list_cnt--;
       if (EnableThreadSMRStatistics) {
         _java_thread_list_free_cnt++;
-        _to_delete_list_cnt--;
       }
     } else {
       prev = current;
@@ -913,8 +921,10 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
     log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is not freed.", os::current_thread_id(), p2i(threads));
   }
 
+#ifdef ASSERT
   ValidateHazardPtrsClosure validate_cl;
   threads_do(&validate_cl);
+#endif
 
   delete scan_table;
 }
@@ -131,8 +131,8 @@ javaVFrame* vframe::java_sender() const {
 // ------------- javaVFrame --------------
 
 GrowableArray<MonitorInfo*>* javaVFrame::locked_monitors() {
-  assert(SafepointSynchronize::is_at_safepoint() || JavaThread::current() == thread(),
-         "must be at safepoint or it's a java frame of the current thread");
+  assert(SafepointSynchronize::is_at_safepoint() || thread()->is_handshake_safe_for(Thread::current()),
+         "must be at safepoint or it's a java frame of a thread in a handshake");
 
   GrowableArray<MonitorInfo*>* mons = monitors();
   GrowableArray<MonitorInfo*>* result = new GrowableArray<MonitorInfo*>(mons->length());
@@ -257,11 +257,13 @@ void javaVFrame::print_lock_info_on(outputStream* st, int frame_count) {
           markWord mark = monitor->owner()->mark();
           // The first stage of async deflation does not affect any field
           // used by this comparison so the ObjectMonitor* is usable here.
-          if (mark.has_monitor() &&
+          ObjectMonitor* mon = mark.has_monitor() ?
+            ObjectSynchronizer::read_monitor(current, monitor->owner(), mark) : NULL;
+          if (mon != NULL &&
               ( // we have marked ourself as pending on this monitor
-                mark.monitor() == thread()->current_pending_monitor() ||
+                mon == thread()->current_pending_monitor() ||
                 // we are not the owner of this monitor
-                !mark.monitor()->is_entered(thread())
+                !mon->is_entered(thread())
               )) {
             lock_state = "waiting to lock";
           }
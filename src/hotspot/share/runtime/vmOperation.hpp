@@ -61,6 +61,7 @@
   template(G1CollectFull)                         \
   template(G1Concurrent)                          \
   template(G1TryInitiateConcMark)                 \
+  template(EpsilonCollect)                        \
   template(ZMarkStart)                            \
   template(ZMarkEnd)                              \
   template(ZRelocateStart)                        \
@@ -123,17 +124,22 @@ class VM_Operation : public StackObj {
 
  private:
   Thread*         _calling_thread;
+  VM_Operation*   _next_coalesced;
 
   // The VM operation name array
   static const char* _names[];
 
  public:
-  VM_Operation() : _calling_thread(NULL) {}
+  VM_Operation() : _calling_thread(NULL), _next_coalesced(NULL) {}
 
   // VM operation support (used by VM thread)
   Thread* calling_thread() const                 { return _calling_thread; }
   void set_calling_thread(Thread* thread);
 
+  // Link for the list of operations waiting to be coalesced (used by VM thread)
+  VM_Operation* next_coalesced() const           { return _next_coalesced; }
+  void set_next_coalesced(VM_Operation* op)      { _next_coalesced = op; }
+
   // Called by VM thread - does in turn invoke doit(). Do not override this
   void evaluate();
 
@@ -152,6 +158,11 @@ class VM_Operation : public StackObj {
   virtual VMOp_Type type() const = 0;
   virtual bool allow_nested_vm_operations() const { return false; }
 
+  // You may override allow_coalescing to return true if the operation can
+  // be evaluated in the safepoint of any other operation, right after it.
+  // Only used with CoalesceVMOperations.
+  virtual bool allow_coalescing() const { return false; }
+
   // You may override skip_thread_oop_barriers to return true if the operation
   // does not access thread-private oops (including frames).
   virtual bool skip_thread_oop_barriers() const { return false; }
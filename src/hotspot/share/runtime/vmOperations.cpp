@@ -251,6 +251,13 @@ VM_ThreadDump::VM_ThreadDump(ThreadDumpResult* result,
 }
 
 bool VM_ThreadDump::doit_prologue() {
+  // Locked synchronizers are found by walking the heap, and revoking
+  // biases may need a safepoint; otherwise handshake with each thread.
+  if (UseHandshakeThreadDump && !_with_locked_synchronizers && !UseBiasedLocking) {
+    dump_in_handshakes();
+    return false;
+  }
+
   if (_with_locked_synchronizers) {
     // Acquire Heap_lock to dump concurrent locks
     Heap_lock->lock();
@@ -334,6 +341,46 @@ void VM_ThreadDump::doit() {
   }
 }
 
+// Same as doit(), but each thread is stopped in turn by a handshake
+// rather than all threads at once by the safepoint. The stack and the
+// locked monitors of a thread are consistent with each other, but not
+// with those of other threads.
+void VM_ThreadDump::dump_in_handshakes() {
+  _result->set_t_list();
+
+  if (_num_threads == 0) {
+    for (uint i = 0; i < _result->t_list()->length(); i++) {
+      JavaThread* jt = _result->t_list()->thread_at(i);
+      if (jt->is_exiting() ||
+          jt->is_hidden_from_external_view())  {
+        // skip terminating threads and hidden threads
+        continue;
+      }
+      if (!_result->add_thread_snapshot_in_handshake(jt, _max_depth, _with_locked_monitors)) {
+        // the thread exited before the handshake
+        _result->remove_last_thread_snapshot();
+      }
+    }
+  } else {
+    for (int i = 0; i < _num_threads; i++) {
+      instanceHandle th = _threads->at(i);
+      JavaThread* jt = th() == NULL ? NULL : java_lang_Thread::thread(th());
+      if (jt != NULL && !_result->t_list()->includes(jt)) {
+        jt = NULL;
+      }
+      if (jt == NULL ||
+          jt->is_exiting() ||
+          jt->is_hidden_from_external_view())  {
+        // add a NULL snapshot if skipped
+        _result->add_thread_snapshot();
+        continue;
+      }
+      // An empty snapshot is left behind if the thread exited first
+      _result->add_thread_snapshot_in_handshake(jt, _max_depth, _with_locked_monitors);
+    }
+  }
+}
+
 void VM_ThreadDump::snapshot_thread(JavaThread* java_thread, ThreadConcurrentLocks* tcl) {
   ThreadSnapshot* snapshot = _result->add_thread_snapshot(java_thread);
   snapshot->dump_stack_at_safepoint(_max_depth, _with_locked_monitors);
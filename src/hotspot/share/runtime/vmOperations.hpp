@@ -153,6 +153,7 @@ class VM_PrintThreads: public VM_Operation {
   VMOp_Type type() const {
     return VMOp_PrintThreads;
   }
+  bool allow_coalescing() const { return true; }
   void doit();
   bool doit_prologue();
   void doit_epilogue();
@@ -199,6 +200,7 @@ class VM_FindDeadlocks: public VM_Operation {
 
   DeadlockCycle* result()      { return _deadlocks; };
   VMOp_Type type() const       { return VMOp_FindDeadlocks; }
+  bool allow_coalescing() const { return true; }
   void doit();
 };
 
@@ -216,6 +218,7 @@ class VM_ThreadDump : public VM_Operation {
   bool                           _with_locked_synchronizers;
 
   void snapshot_thread(JavaThread* java_thread, ThreadConcurrentLocks* tcl);
+  void dump_in_handshakes();
 
  public:
   VM_ThreadDump(ThreadDumpResult* result,
@@ -231,6 +234,7 @@ class VM_ThreadDump : public VM_Operation {
                 bool with_locked_synchronizers);
 
   VMOp_Type type() const { return VMOp_ThreadDump; }
+  bool allow_coalescing() const { return true; }
   void doit();
   bool doit_prologue();
   void doit_epilogue();
@@ -1861,6 +1861,7 @@ typedef HashtableEntry<InstanceKlass*, mtClass>  KlassHashtableEntry;
   declare_c2_type(CopySignFNode, Node)                                    \
   declare_c2_type(SignumDNode, Node)                                      \
   declare_c2_type(SignumFNode, Node)                                      \
+  declare_c2_type(MathCallNode, Node)                                     \
   declare_c2_type(LoadVectorGatherNode, LoadVectorNode)                   \
   declare_c2_type(StoreVectorScatterNode, StoreVectorNode)                \
   declare_c2_type(VectorLoadMaskNode, VectorNode)                         \
@@ -1869,6 +1870,7 @@ typedef HashtableEntry<InstanceKlass*, mtClass>  KlassHashtableEntry;
   declare_c2_type(VectorBlendNode, VectorNode)                            \
   declare_c2_type(VectorRearrangeNode, VectorNode)                        \
   declare_c2_type(VectorMaskWrapperNode, VectorNode)                      \
+  declare_c2_type(VectorMathCallNode, VectorNode)                         \
   declare_c2_type(VectorMaskCmpNode, VectorNode)                          \
   declare_c2_type(VectorCastB2XNode, VectorNode)                          \
   declare_c2_type(VectorCastS2XNode, VectorNode)                          \
@@ -91,6 +91,7 @@ Monitor*          VMThread::_terminate_lock     = NULL;
 VMThread*         VMThread::_vm_thread          = NULL;
 VM_Operation*     VMThread::_cur_vm_operation   = NULL;
 VM_Operation*     VMThread::_next_vm_operation  = &cleanup_op; // Prevent any thread from setting an operation until VM thread is ready.
+VM_Operation*     VMThread::_coalesced_ops      = NULL;
 PerfCounter*      VMThread::_perf_accumulated_vm_operation_time = NULL;
 VMOperationTimeoutTask* VMThread::_timeout_task = NULL;
 
@@ -338,6 +339,28 @@ bool VMThread::set_next_operation(VM_Operation *op) {
   return true;
 }
 
+// Called with VMOperation_lock held.
+bool VMThread::add_coalesced_operation(VM_Operation* op) {
+  if (!CoalesceVMOperations || !op->evaluate_at_safepoint() || !op->allow_coalescing()) {
+    return false;
+  }
+  log_debug(vmthread)("Adding coalesced VM operation: %s", op->name());
+
+  op->set_next_coalesced(_coalesced_ops);
+  _coalesced_ops = op;
+  return true;
+}
+
+// Called with VMOperation_lock held.
+bool VMThread::is_coalesced_operation(VM_Operation* op) {
+  for (VM_Operation* cur = _coalesced_ops; cur != NULL; cur = cur->next_coalesced()) {
+    if (cur == op) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void VMThread::wait_until_executed(VM_Operation* op) {
   MonitorLocker ml(VMOperation_lock,
                    Thread::current()->is_Java_thread() ?
@@ -350,6 +373,10 @@ void VMThread::wait_until_executed(VM_Operation* op) {
         ml.notify_all();
         break;
       }
+      // The VM thread is busy, evaluate this operation in its next safepoint.
+      if (add_coalesced_operation(op)) {
+        break;
+      }
       // Wait to install this operation as the next operation in the VM Thread
       log_trace(vmthread)("A VM operation already set, waiting");
       ml.wait();
@@ -359,8 +386,9 @@ void VMThread::wait_until_executed(VM_Operation* op) {
     // Wait until the operation has been processed
     TraceTime timer("Waiting for VM operation to be completed", TRACETIME_LOG(Trace, vmthread));
     // _next_vm_operation is cleared holding VMOperation_lock after it has been
-    // executed. We wait until _next_vm_operation is not our op.
-    while (_next_vm_operation == op) {
+    // executed. We wait until _next_vm_operation is not our op. Coalesced
+    // operations are removed from their list once executed.
+    while (_next_vm_operation == op || is_coalesced_operation(op)) {
       // VM Thread can process it once we unlock the mutex on wait.
       ml.wait();
     }
@@ -415,6 +443,7 @@ void VMThread::inner_execute(VM_Operation* op) {
   evaluate_operation(_cur_vm_operation);
 
   if (end_safepoint) {
+    evaluate_coalesced_operations();
     if (_timeout_task != NULL) {
       _timeout_task->disarm();
     }
@@ -424,6 +453,42 @@ void VMThread::inner_execute(VM_Operation* op) {
   _cur_vm_operation = prev_vm_operation;
 }
 
+// Evaluate the operations that were coalesced while the VM thread was busy,
+// in the safepoint of the operation that was just evaluated.
+void VMThread::evaluate_coalesced_operations() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+
+  while (true) {
+    VM_Operation* op;
+    {
+      MonitorLocker ml(VMOperation_lock, Mutex::_no_safepoint_check_flag);
+      op = _coalesced_ops;
+    }
+    if (op == NULL) {
+      return;
+    }
+
+    _cur_vm_operation = op;
+    EventMarkVMOperation em("Executing coalesced VM operation: %s", op->name());
+    log_debug(vmthread)("Evaluating coalesced VM operation: %s", op->name());
+    evaluate_operation(op);
+
+    // New operations are only added at the head, unlink op wherever it is now
+    MonitorLocker ml(VMOperation_lock, Mutex::_no_safepoint_check_flag);
+    if (_coalesced_ops == op) {
+      _coalesced_ops = op->next_coalesced();
+    } else {
+      VM_Operation* prev = _coalesced_ops;
+      while (prev->next_coalesced() != op) {
+        prev = prev->next_coalesced();
+      }
+      prev->set_next_coalesced(op->next_coalesced());
+    }
+    op->set_next_coalesced(NULL);
+    ml.notify_all();
+  }
+}
+
 void VMThread::wait_for_operation() {
   assert(Thread::current()->is_VM_thread(), "Must be the VM thread");
   MonitorLocker ml_op_lock(VMOperation_lock, Mutex::_no_safepoint_check_flag);
@@ -439,6 +504,12 @@ void VMThread::wait_for_operation() {
     if (_next_vm_operation != NULL) {
       return;
     }
+    if (_coalesced_ops != NULL) {
+      // Operations were coalesced behind one that did not safepoint,
+      // give them a safepoint of their own.
+      _next_vm_operation = &cleanup_op;
+      return;
+    }
     if (handshake_alot()) {
       {
         MutexUnlocker mul(VMOperation_lock);
@@ -72,6 +72,7 @@ class VMThread: public NamedThread {
   static void setup_periodic_safepoint_if_needed();
 
   void evaluate_operation(VM_Operation* op);
+  void evaluate_coalesced_operations();
   void inner_execute(VM_Operation* op);
   void wait_for_operation();
 
@@ -134,8 +135,11 @@ class VMThread: public NamedThread {
   // VM_Operation support
   static VM_Operation*     _cur_vm_operation;   // Current VM operation
   static VM_Operation*     _next_vm_operation;  // Next VM operation
+  static VM_Operation*     _coalesced_ops;      // Operations waiting for the next safepoint
 
   bool set_next_operation(VM_Operation *op);    // Set the _next_vm_operation if possible.
+  static bool add_coalesced_operation(VM_Operation* op);
+  static bool is_coalesced_operation(VM_Operation* op);
 
   // Pointer to single-instance of VM thread
   static VMThread*     _vm_thread;
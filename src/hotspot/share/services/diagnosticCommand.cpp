@@ -24,12 +24,14 @@
 
 #include "precompiled.hpp"
 #include "jvm.h"
+#include "classfile/classLoader.hpp"
 #include "classfile/classLoaderHierarchyDCmd.hpp"
 #include "classfile/classLoaderStats.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "classfile/vmClasses.hpp"
 #include "code/codeCache.hpp"
+#include "compiler/compilationCost.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/directivesParser.hpp"
 #include "gc/shared/gcVMOperations.hpp"
@@ -42,9 +44,11 @@
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/init.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vm_version.hpp"
@@ -89,7 +93,9 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SetVMFlagDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMDynamicLibrariesDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMUptimeDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMStartupReportDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMInfoDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMMutexStatsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SystemGCDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RunFinalizationDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapInfoDCmd>(full_export, true, false));
@@ -115,6 +121,7 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassLoaderHierarchyDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompileQueueDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeListDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerStatsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeCacheDCmd>(full_export, true, false));
 #ifdef LINUX
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<PerfMapDCmd>(full_export, true, false));
@@ -392,10 +399,43 @@ void VMUptimeDCmd::execute(DCmdSource source, TRAPS) {
   output()->print_cr(" s");
 }
 
+void VMStartupReportDCmd::execute(DCmdSource source, TRAPS) {
+  output()->print_cr("Startup phases:");
+  print_startup_phases(output());
+
+  if (UsePerfData) {
+    // Class loading totals since VM start; these include classes loaded
+    // after startup completed.
+    output()->cr();
+    output()->print_cr("Class loading:");
+    output()->print_cr("%-32s " JLONG_FORMAT_W(10) " ms", "load (accumulated)",
+                       Management::ticks_to_ms(ClassLoader::perf_accumulated_time()->get_value()));
+    output()->print_cr("%-32s " JLONG_FORMAT_W(10) " ms", "shared class load",
+                       Management::ticks_to_ms(ClassLoader::perf_shared_classload_time()->get_value()));
+    output()->print_cr("%-32s " JLONG_FORMAT_W(10) " ms", "system class load",
+                       Management::ticks_to_ms(ClassLoader::perf_sys_classload_time()->get_value()));
+    output()->print_cr("%-32s " JLONG_FORMAT_W(10) " ms", "app class load",
+                       Management::ticks_to_ms(ClassLoader::perf_app_classload_time()->get_value()));
+    output()->print_cr("%-32s " JLONG_FORMAT_W(10) " ms (" JLONG_FORMAT " classes)", "link",
+                       Management::ticks_to_ms(ClassLoader::perf_class_link_time()->get_value()),
+                       ClassLoader::perf_classes_linked()->get_value());
+    output()->print_cr("%-32s " JLONG_FORMAT_W(10) " ms (" JLONG_FORMAT " classes)", "verify",
+                       Management::ticks_to_ms(ClassLoader::perf_class_verify_time()->get_value()),
+                       ClassLoader::perf_classes_verified()->get_value());
+    output()->print_cr("%-32s " JLONG_FORMAT_W(10) " ms (" JLONG_FORMAT " classes)", "initialize",
+                       Management::ticks_to_ms(ClassLoader::perf_class_init_time()->get_value()),
+                       ClassLoader::perf_classes_inited()->get_value());
+  }
+}
+
 void VMInfoDCmd::execute(DCmdSource source, TRAPS) {
   VMError::print_vm_info(_output);
 }
 
+void VMMutexStatsDCmd::execute(DCmdSource source, TRAPS) {
+  print_lock_stats_on(_output);
+}
+
 void SystemGCDCmd::execute(DCmdSource source, TRAPS) {
   Universe::heap()->collect(GCCause::_dcmd_gc_run);
 }
@@ -468,10 +508,18 @@ HeapDumpDCmd::HeapDumpDCmd(outputStream* output, bool heap) :
        "BOOLEAN", false, "false"),
   _gzip("-gz", "If specified, the heap dump is written in gzipped format "
                "using the given compression level. 1 (recommended) is the fastest, "
-               "9 the strongest compression.", "INT", false, "1") {
+               "9 the strongest compression.", "INT", false, "1"),
+  _parallel_thread_num("-parallel",
+       "Number of parallel threads to use for dumping the heap objects. "
+       "0 means let the VM determine the number of threads to use. "
+       "1 (the default) means use one thread (disable parallelism). "
+       "For any other value the VM will try to use the specified number of "
+       "threads, but might use fewer.",
+       "INT", false, "1") {
   _dcmdparser.add_dcmd_option(&_all);
   _dcmdparser.add_dcmd_argument(&_filename);
   _dcmdparser.add_dcmd_option(&_gzip);
+  _dcmdparser.add_dcmd_option(&_parallel_thread_num);
 }
 
 void HeapDumpDCmd::execute(DCmdSource source, TRAPS) {
@@ -486,11 +534,20 @@ void HeapDumpDCmd::execute(DCmdSource source, TRAPS) {
     }
   }
 
+  jlong num = _parallel_thread_num.value();
+  if (num < 0) {
+    output()->print_cr("Parallel thread number out of range (>=0): " JLONG_FORMAT, num);
+    return;
+  }
+  uint parallel_thread_num = num == 0
+      ? MAX2<uint>(1, (uint)os::initial_active_processor_count() * 3 / 8)
+      : num;
+
   // Request a full GC before heap dump if _all is false
   // This helps reduces the amount of unreachable objects in the dump
   // and makes it easier to browse.
   HeapDumper dumper(!_all.value() /* request GC if _all is false*/);
-  dumper.dump(_filename.value(), output(), (int) level);
+  dumper.dump(_filename.value(), output(), (int) level, parallel_thread_num);
 }
 
 ClassHistogramDCmd::ClassHistogramDCmd(outputStream* output, bool heap) :
@@ -820,6 +877,22 @@ void CodeListDCmd::execute(DCmdSource source, TRAPS) {
   CodeCache::print_codelist(output());
 }
 
+CompilerStatsDCmd::CompilerStatsDCmd(outputStream* output, bool heap) :
+                                     DCmdWithParser(output, heap),
+  _limit("limit", "Maximum number of methods to be printed", "INT", false, "50") {
+  _dcmdparser.add_dcmd_argument(&_limit);
+}
+
+void CompilerStatsDCmd::execute(DCmdSource source, TRAPS) {
+  jlong limit = _limit.value();
+  if (limit < 1) {
+    Exceptions::fthrow(THREAD_AND_LOCATION, vmSymbols::java_lang_IllegalArgumentException(),
+                       "Invalid limit value " JLONG_FORMAT ". Should be positive.\n", limit);
+    return;
+  }
+  CompilationCost::print_on(output(), (size_t)limit);
+}
+
 void CodeCacheDCmd::execute(DCmdSource source, TRAPS) {
   CodeCache::print_layout(output());
 }
@@ -227,6 +227,24 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class VMStartupReportDCmd : public DCmd {
+public:
+  VMStartupReportDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.startup_report"; }
+  static const char* description() {
+    return "Print the time spent in each VM startup phase.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class VMInfoDCmd : public DCmd {
 public:
   VMInfoDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -243,6 +261,23 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class VMMutexStatsDCmd : public DCmd {
+public:
+  VMMutexStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.mutex_stats"; }
+  static const char* description() {
+    return "Print acquisition, contention and hold time statistics of VM "
+           "mutexes and monitors. Requires -XX:+ProfileVMLocks.";
+  }
+  static const char* impact() { return "Low"; }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class SystemGCDCmd : public DCmd {
 public:
   SystemGCDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -314,6 +349,7 @@ protected:
   DCmdArgument<char*> _filename;
   DCmdArgument<bool>  _all;
   DCmdArgument<jlong> _gzip;
+  DCmdArgument<jlong> _parallel_thread_num;
 public:
   HeapDumpDCmd(outputStream* output, bool heap);
   static const char* name() {
@@ -620,6 +656,29 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class CompilerStatsDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _limit;
+public:
+  CompilerStatsDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.stats";
+  }
+  static const char* description() {
+    return "Print the methods that took the most time to compile, with their compilations "
+           "per tier and deoptimizations by reason. Requires -XX:+CompilationCostAccounting.";
+  }
+  static const char* impact() {
+    return "Low: Depends on the number of compiled methods.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class CodeCacheDCmd : public DCmd {
 public:
   CodeCacheDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
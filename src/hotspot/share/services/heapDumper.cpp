@@ -42,6 +42,7 @@
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
@@ -59,6 +60,10 @@
 #include "utilities/macros.hpp"
 #include "utilities/ostream.hpp"
 
+#ifndef O_BINARY       // if defined (Win32) use binary files.
+#define O_BINARY 0     // otherwise do nothing.
+#endif
+
 /*
  * HPROF binary format - description copied from:
  *   src/share/demo/jvmti/hprof/hprof_io.c
@@ -671,6 +676,11 @@ class DumperSupport : AllStatic {
   // fixes up the current dump record and writes HPROF_HEAP_DUMP_END record
   static void end_of_dump(DumpWriter* writer);
 
+  // returns the name of the segment file written by the given dumper thread
+  static void segment_path(char* buf, size_t buf_len, const char* path, uint segment_id);
+  // appends the given segment files to the dump and deletes them
+  static char const* merge_segments(DumpWriter* writer, const char* path, uint num_segments);
+
   static oop mask_dormant_archived_object(oop o) {
     if (o != NULL && o->klass()->java_mirror() == NULL) {
       // Ignore this object since the corresponding java mirror is not loaded.
@@ -1446,6 +1456,48 @@ void HeapObjectDumper::do_object(oop o) {
   }
 }
 
+// Task used for dumping the heap objects in parallel. Every worker iterates
+// over its part of the heap and writes the object records into its own
+// segment file. The segment files are merged into the dump after the
+// safepoint.
+class ParHeapObjectDumpTask : public AbstractGangTask {
+ private:
+  ParallelObjectIterator* _poi;
+  const char* _path;
+  char const* volatile _error;
+
+ public:
+  ParHeapObjectDumpTask(ParallelObjectIterator* poi, const char* path) :
+    AbstractGangTask("Iterate heap and dump objects"),
+    _poi(poi),
+    _path(path),
+    _error(NULL) { }
+
+  char const* error() const { return Atomic::load(&_error); }
+
+  void work(uint worker_id);
+};
+
+void ParHeapObjectDumpTask::work(uint worker_id) {
+  char seg_path[JVM_MAXPATHLEN];
+  DumperSupport::segment_path(seg_path, sizeof(seg_path), _path, worker_id);
+
+  // The segments are not compressed; the data is compressed when
+  // the segments are merged into the dump.
+  DumpWriter writer(new (std::nothrow) FileWriter(seg_path), NULL);
+
+  if (writer.error() == NULL) {
+    HeapObjectDumper obj_dumper(&writer);
+    _poi->object_iterate(&obj_dumper, worker_id);
+    writer.finish_dump_segment();
+    writer.deactivate();
+  }
+
+  if (writer.error() != NULL) {
+    Atomic::cmpxchg(&_error, (char const*) NULL, writer.error());
+  }
+}
+
 // The VM operation that performs the heap dump
 class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
  private:
@@ -1458,6 +1510,10 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
   GrowableArray<Klass*>* _klass_map;
   ThreadStackTrace** _stack_traces;
   int _num_threads;
+  const char* _path;
+  uint _num_dump_threads;
+  uint _num_segments;
+  char const* _segment_error;
 
   // accessors and setters
   static VM_HeapDumper* dumper()         {  assert(_global_dumper != NULL, "Error"); return _global_dumper; }
@@ -1498,8 +1554,18 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
   // HPROF_TRACE and HPROF_FRAME records
   void dump_stack_traces();
 
+  // writes the records preceding the heap object records
+  void dump_prologue();
+  // writes the GC root records
+  void dump_roots();
+
+  // dumps the heap objects into segment files using the given gang, returns
+  // false if the heap does not support parallel iteration
+  bool dump_objects_parallel(WorkGang* gang);
+
  public:
-  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome) :
+  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome,
+                const char* path, uint num_dump_threads) :
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
                     GCCause::_heap_dump /* GC Cause */,
                     0 /* total full collections, dummy, ignored */,
@@ -1510,6 +1576,10 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
     _klass_map = new (ResourceObj::C_HEAP, mtServiceability) GrowableArray<Klass*>(INITIAL_CLASS_COUNT, mtServiceability);
     _stack_traces = NULL;
     _num_threads = 0;
+    _path = path;
+    _num_dump_threads = num_dump_threads;
+    _num_segments = 0;
+    _segment_error = NULL;
     if (oome) {
       assert(!Thread::current()->is_VM_thread(), "Dump from OutOfMemoryError cannot be called by the VMThread");
       // get OutOfMemoryError zero-parameter constructor
@@ -1536,6 +1606,11 @@ class VM_HeapDumper : public VM_GC_Operation, public AbstractGangTask {
   VMOp_Type type() const { return VMOp_HeapDumper; }
   void doit();
   void work(uint worker_id);
+
+  // number of segment files left to be merged into the dump, 0 if the
+  // objects have been written to the dump directly
+  uint num_segments() const              { return _num_segments; }
+  char const* segment_error() const      { return _segment_error; }
 };
 
 
@@ -1555,6 +1630,49 @@ void DumperSupport::end_of_dump(DumpWriter* writer) {
   writer->write_u4(0);
 }
 
+void DumperSupport::segment_path(char* buf, size_t buf_len, const char* path, uint segment_id) {
+  jio_snprintf(buf, buf_len, "%s.p%u", path, segment_id);
+}
+
+// The segment files only contain HPROF_HEAP_DUMP_SEGMENT records, so they can
+// be copied to the dump as they are. Errors are reported after all segment
+// files have been deleted.
+char const* DumperSupport::merge_segments(DumpWriter* writer, const char* path, uint num_segments) {
+  const size_t buf_size = 1*M;
+  char* buf = NEW_C_HEAP_ARRAY(char, buf_size, mtServiceability);
+  char seg_path[JVM_MAXPATHLEN];
+  char const* error = NULL;
+
+  for (uint i = 0; i < num_segments; i++) {
+    segment_path(seg_path, sizeof(seg_path), path, i);
+
+    int fd = os::open(seg_path, O_RDONLY | O_BINARY, 0);
+    if (fd < 0) {
+      if (error == NULL) {
+        error = os::strerror(errno);
+      }
+      continue;
+    }
+
+    while (error == NULL) {
+      ssize_t n = (ssize_t) os::read(fd, buf, (uint) buf_size);
+      if (n < 0) {
+        error = os::strerror(errno);
+      } else if (n == 0) {
+        break;
+      } else {
+        writer->write_raw(buf, (size_t) n);
+      }
+    }
+
+    os::close(fd);
+    remove(seg_path);
+  }
+
+  FREE_C_HEAP_ARRAY(char, buf);
+  return error;
+}
+
 // writes a HPROF_LOAD_CLASS record for the class (and each of its
 // array classes)
 void VM_HeapDumper::do_load_class(Klass* k) {
@@ -1768,7 +1886,9 @@ void VM_HeapDumper::doit() {
 
   WorkGang* gang = ch->safepoint_workers();
 
-  if (gang == NULL) {
+  if (gang != NULL && _num_dump_threads > 1 && dump_objects_parallel(gang)) {
+    // The dump is completed by HeapDumper::dump() after the safepoint.
+  } else if (gang == NULL) {
     work(0);
   } else {
     gang->run_task(this, gang->active_workers(), true);
@@ -1779,12 +1899,57 @@ void VM_HeapDumper::doit() {
   clear_global_writer();
 }
 
+bool VM_HeapDumper::dump_objects_parallel(WorkGang* gang) {
+  // Can't run with more threads than provided by the WorkGang.
+  WithUpdatedActiveWorkers update_and_restore(gang, _num_dump_threads);
+
+  ParallelObjectIterator* poi = Universe::heap()->parallel_object_iterator(gang->active_workers());
+  if (poi == NULL) {
+    return false;
+  }
+
+  // The records not belonging to heap objects are written by the VM thread,
+  // without help from compression threads.
+  dump_prologue();
+  dump_roots();
+  writer()->finish_dump_segment();
+
+  ParHeapObjectDumpTask task(poi, _path);
+  gang->run_task(&task);
+  delete poi;
+
+  _num_segments = gang->active_workers();
+  _segment_error = task.error();
+  return true;
+}
+
 void VM_HeapDumper::work(uint worker_id) {
   if (!Thread::current()->is_VM_thread()) {
     writer()->writer_loop();
     return;
   }
 
+  dump_prologue();
+
+  // writes HPROF_GC_INSTANCE_DUMP records.
+  // After each sub-record is written check_segment_length will be invoked
+  // to check if the current segment exceeds a threshold. If so, a new
+  // segment is started.
+  // The HPROF_GC_CLASS_DUMP and HPROF_GC_INSTANCE_DUMP are the vast bulk
+  // of the heap dump.
+  HeapObjectDumper obj_dumper(writer());
+  Universe::heap()->object_iterate(&obj_dumper);
+
+  dump_roots();
+
+  // Writes the HPROF_HEAP_DUMP_END record.
+  DumperSupport::end_of_dump(writer());
+
+  // We are done with writing. Release the worker threads.
+  writer()->deactivate();
+}
+
+void VM_HeapDumper::dump_prologue() {
   // Write the file header - we always use 1.0.2
   const char* header = "JAVA PROFILE 1.0.2";
 
@@ -1816,16 +1981,9 @@ void VM_HeapDumper::work(uint worker_id) {
     ClassLoaderDataGraph::classes_do(&locked_dump_class);
   }
   Universe::basic_type_classes_do(&do_basic_type_array_class_dump);
+}
 
-  // writes HPROF_GC_INSTANCE_DUMP records.
-  // After each sub-record is written check_segment_length will be invoked
-  // to check if the current segment exceeds a threshold. If so, a new
-  // segment is started.
-  // The HPROF_GC_CLASS_DUMP and HPROF_GC_INSTANCE_DUMP are the vast bulk
-  // of the heap dump.
-  HeapObjectDumper obj_dumper(writer());
-  Universe::heap()->object_iterate(&obj_dumper);
-
+void VM_HeapDumper::dump_roots() {
   // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
   do_threads();
 
@@ -1841,12 +1999,6 @@ void VM_HeapDumper::work(uint worker_id) {
   // if !ClassUnloading
   StickyClassDumper class_dumper(writer());
   ClassLoaderData::the_null_class_loader_data()->classes_do(&class_dumper);
-
-  // Writes the HPROF_HEAP_DUMP_END record.
-  DumperSupport::end_of_dump(writer());
-
-  // We are done with writing. Release the worker threads.
-  writer()->deactivate();
 }
 
 void VM_HeapDumper::dump_stack_traces() {
@@ -1905,7 +2057,7 @@ void VM_HeapDumper::dump_stack_traces() {
 }
 
 // dump the heap to given path.
-int HeapDumper::dump(const char* path, outputStream* out, int compression) {
+int HeapDumper::dump(const char* path, outputStream* out, int compression, uint num_dump_threads) {
   assert(path != NULL && strlen(path) > 0, "path missing");
 
   // print message in interactive case
@@ -1940,7 +2092,7 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression) {
   }
 
   // generate the dump
-  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome);
+  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, path, num_dump_threads);
   if (Thread::current()->is_VM_thread()) {
     assert(SafepointSynchronize::is_at_safepoint(), "Expected to be called at a safepoint");
     dumper.doit();
@@ -1948,8 +2100,19 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression) {
     VMThread::execute(&dumper);
   }
 
+  // complete a parallel dump by appending the object records
+  char const* segment_error = NULL;
+  if (dumper.num_segments() > 0) {
+    segment_error = DumperSupport::merge_segments(&writer, path, dumper.num_segments());
+    if (segment_error == NULL) {
+      segment_error = dumper.segment_error();
+    }
+    DumperSupport::end_of_dump(&writer);
+    writer.deactivate();
+  }
+
   // record any error that the writer may have encountered
-  set_error(writer.error());
+  set_error(writer.error() != NULL ? writer.error() : segment_error);
 
   // emit JFR event
   if (error() == NULL) {
@@ -1967,11 +2130,11 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression) {
       out->print_cr("Heap dump file created [" JULONG_FORMAT " bytes in %3.3f secs]",
                     writer.bytes_written(), timer()->seconds());
     } else {
-      out->print_cr("Dump file is incomplete: %s", writer.error());
+      out->print_cr("Dump file is incomplete: %s", error());
     }
   }
 
-  return (writer.error() == NULL) ? 0 : -1;
+  return (error() == NULL) ? 0 : -1;
 }
 
 // stop timer (if still active), and free any error string we might be holding
@@ -22,12 +22,15 @@
  *
  */
 #include "precompiled.hpp"
+#include "runtime/os.hpp"
 
 #include "services/mallocSiteTable.hpp"
 #include "services/mallocTracker.hpp"
 #include "services/mallocTracker.inline.hpp"
 #include "services/memTracker.hpp"
 
+#include <math.h>
+
 size_t MallocMemorySummary::_snapshot[CALC_OBJ_SIZE_IN_TYPE(MallocMemorySnapshot, size_t)];
 
 #ifdef ASSERT
@@ -41,6 +44,11 @@ void MemoryCounter::update_peak_count(size_t count) {
   }
 }
 
+size_t MemoryCounter::peak_count() const {
+  return Atomic::load(&_peak_count);
+}
+#endif
+
 void MemoryCounter::update_peak_size(size_t sz) {
   size_t peak_sz = peak_size();
   while (peak_sz < sz) {
@@ -51,15 +59,6 @@ void MemoryCounter::update_peak_size(size_t sz) {
   }
 }
 
-size_t MemoryCounter::peak_count() const {
-  return Atomic::load(&_peak_count);
-}
-
-size_t MemoryCounter::peak_size() const {
-  return Atomic::load(&_peak_size);
-}
-#endif
-
 // Total malloc'd memory amount
 size_t MallocMemorySnapshot::total() const {
   size_t amount = 0;
@@ -100,14 +99,15 @@ void MallocHeader::release() const {
 
   MallocMemorySummary::record_free(size(), flags());
   MallocMemorySummary::record_free_malloc_header(sizeof(MallocHeader));
-  if (MemTracker::tracking_level() == NMT_detail) {
-    MallocSiteTable::deallocation_at(size(), _bucket_idx, _pos_idx);
+  if (MemTracker::tracking_level() == NMT_detail && _site != site_none) {
+    size_t count = _site == site_sampled ? MallocSiteSampler::estimated_count(size()) : 1;
+    MallocSiteTable::deallocation_at(size() * count, count, _bucket_idx, _pos_idx);
   }
 }
 
-bool MallocHeader::record_malloc_site(const NativeCallStack& stack, size_t size,
+bool MallocHeader::record_malloc_site(const NativeCallStack& stack, size_t size, size_t count,
   size_t* bucket_idx, size_t* pos_idx, MEMFLAGS flags) const {
-  bool ret = MallocSiteTable::allocation_at(stack, size, bucket_idx, pos_idx, flags);
+  bool ret = MallocSiteTable::allocation_at(stack, size, count, bucket_idx, pos_idx, flags);
 
   // Something went wrong, could be OOM or overflow malloc site table.
   // We want to keep tracking data under OOM circumstance, so transition to
@@ -119,7 +119,33 @@ bool MallocHeader::record_malloc_site(const NativeCallStack& stack, size_t size,
 }
 
 bool MallocHeader::get_stack(NativeCallStack& stack) const {
-  return MallocSiteTable::access_stack(stack, _bucket_idx, _pos_idx);
+  return _site != site_none && MallocSiteTable::access_stack(stack, _bucket_idx, _pos_idx);
+}
+
+THREAD_LOCAL ssize_t  MallocSiteSampler::_bytes_until_sample = 0;
+THREAD_LOCAL uint64_t MallocSiteSampler::_rnd = 0;
+
+bool MallocSiteSampler::pick_next_sample() {
+  // The first malloc of a thread only seeds its random number generator,
+  // so that threads do not all sample their first malloc.
+  bool sample = _rnd != 0;
+  if (!sample) {
+    _rnd = ((uint64_t)os::random() << 32) ^ (uint64_t)(uintptr_t)&_rnd;
+    _rnd |= 1;
+  }
+  // xorshift64
+  _rnd ^= _rnd << 13;
+  _rnd ^= _rnd >> 7;
+  _rnd ^= _rnd << 17;
+  // A uniform value in (0, 1], from the upper 53 bits.
+  double u = ((double)(_rnd >> 11) + 1.0) / (double)(CONST64(1) << 53);
+  _bytes_until_sample = (ssize_t)(-log(u) * (double)NMTMallocSiteSampleInterval) + 1;
+  return sample;
+}
+
+size_t MallocSiteSampler::estimated_count(size_t size) {
+  double p = 1.0 - exp(-(double)size / (double)NMTMallocSiteSampleInterval);
+  return MAX2((size_t)1, (size_t)(1.0 / p + 0.5));
 }
 
 bool MallocTracker::initialize(NMT_TrackingLevel level) {
@@ -156,9 +182,23 @@ void* MallocTracker::record_malloc(void* malloc_base, size_t size, MEMFLAGS flag
     return NULL;
   }
 
+  const NativeCallStack* site_stack = &stack;
+  bool sampled = false;
+  NativeCallStack sampled_stack;
+  if (level == NMT_detail && stack.is_empty() && MallocSiteSampler::is_enabled()) {
+    // CALLER_PC does not capture the stack when sampling, so capture it
+    // here, skipping this frame and os::malloc.
+    if (MallocSiteSampler::sample(size)) {
+      sampled_stack = NativeCallStack(2);
+      sampled = true;
+    } else {
+      site_stack = NULL;
+    }
+  }
+
   // Uses placement global new operator to initialize malloc header
 
-  header = ::new (malloc_base)MallocHeader(size, flags, stack, level);
+  header = ::new (malloc_base)MallocHeader(size, flags, site_stack, level, sampled);
   memblock = (void*)((char*)malloc_base + sizeof(MallocHeader));
 
   // The alignment check: 8 bytes alignment for 32 bit systems.
@@ -29,6 +29,7 @@
 
 #include "memory/allocation.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/nmtCommon.hpp"
 #include "utilities/nativeCallStack.hpp"
@@ -44,27 +45,39 @@ class MemoryCounter {
   volatile size_t   _size;
 
   DEBUG_ONLY(volatile size_t   _peak_count;)
-  DEBUG_ONLY(volatile size_t   _peak_size; )
+  // The high-water mark of _size, for the peak report of NMTDCmd.
+  volatile size_t   _peak_size;
+
+  void update_peak_size(size_t sz);
 
  public:
-  MemoryCounter() : _count(0), _size(0) {
+  MemoryCounter() : _count(0), _size(0), _peak_size(0) {
     DEBUG_ONLY(_peak_count = 0;)
-    DEBUG_ONLY(_peak_size  = 0;)
   }
 
   inline void allocate(size_t sz) {
-    size_t cnt = Atomic::add(&_count, size_t(1), memory_order_relaxed);
+    allocate(sz, 1);
+  }
+
+  inline void allocate(size_t sz, size_t n) {
+    size_t cnt = Atomic::add(&_count, n, memory_order_relaxed);
     if (sz > 0) {
       size_t sum = Atomic::add(&_size, sz, memory_order_relaxed);
-      DEBUG_ONLY(update_peak_size(sum);)
+      if (sum > peak_size()) {
+        update_peak_size(sum);
+      }
     }
     DEBUG_ONLY(update_peak_count(cnt);)
   }
 
   inline void deallocate(size_t sz) {
-    assert(count() > 0, "Nothing allocated yet");
+    deallocate(sz, 1);
+  }
+
+  inline void deallocate(size_t sz, size_t n) {
+    assert(count() >= n, "Nothing allocated yet");
     assert(size() >= sz, "deallocation > allocated");
-    Atomic::dec(&_count, memory_order_relaxed);
+    Atomic::sub(&_count, n, memory_order_relaxed);
     if (sz > 0) {
       Atomic::sub(&_size, sz, memory_order_relaxed);
     }
@@ -74,18 +87,19 @@ class MemoryCounter {
     if (sz != 0) {
       assert(sz >= 0 || size() >= size_t(-sz), "Must be");
       size_t sum = Atomic::add(&_size, size_t(sz), memory_order_relaxed);
-      DEBUG_ONLY(update_peak_size(sum);)
+      if (sz > 0 && sum > peak_size()) {
+        update_peak_size(sum);
+      }
     }
   }
 
   inline size_t count() const { return Atomic::load(&_count); }
   inline size_t size()  const { return Atomic::load(&_size);  }
+  inline size_t peak_size() const { return Atomic::load(&_peak_size); }
 
 #ifdef ASSERT
   void update_peak_count(size_t cnt);
-  void update_peak_size(size_t sz);
   size_t peak_count() const;
-  size_t peak_size()  const;
 #endif // ASSERT
 };
 
@@ -126,6 +140,8 @@ class MallocMemory {
   inline size_t malloc_count() const { return _malloc.count();}
   inline size_t arena_size()   const { return _arena.size();  }
   inline size_t arena_count()  const { return _arena.count(); }
+  inline size_t malloc_peak_size() const { return _malloc.peak_size(); }
+  inline size_t arena_peak_size()  const { return _arena.peak_size();  }
 
   DEBUG_ONLY(inline const MemoryCounter& malloc_counter() const { return _malloc; })
   DEBUG_ONLY(inline const MemoryCounter& arena_counter()  const { return _arena;  })
@@ -235,6 +251,42 @@ class MallocMemorySummary : AllStatic {
 };
 
 
+/*
+ * Sampling of malloc sites with NMTMallocSiteSampleInterval. Each thread
+ * counts down the bytes it mallocs and captures the call stack of the malloc
+ * that reaches zero, after which the distance to the next sample is drawn
+ * from an exponential distribution, like ThreadHeapSampler does for Java
+ * allocations.
+ *
+ * A malloc of size bytes is then sampled with probability 1 - e^(-size/interval),
+ * and its site is charged with the inverse of that probability as the
+ * estimated number of mallocs. The estimate only depends on the size, so
+ * the same amount is subtracted again when the memory is freed.
+ */
+class MallocSiteSampler : AllStatic {
+  static THREAD_LOCAL ssize_t  _bytes_until_sample;
+  static THREAD_LOCAL uint64_t _rnd;
+
+  static bool pick_next_sample();
+
+ public:
+  static inline bool is_enabled() {
+    return NMTMallocSiteSampleInterval > 0;
+  }
+
+  // Returns true if the call stack of a malloc of size bytes should be captured.
+  static inline bool sample(size_t size) {
+    _bytes_until_sample -= (ssize_t)size;
+    if (_bytes_until_sample > 0) {
+      return false;
+    }
+    return pick_next_sample();
+  }
+
+  // The estimated number of mallocs a sampled malloc of size bytes stands for.
+  static size_t estimated_count(size_t size);
+};
+
 /*
  * Malloc tracking header.
  * To satisfy malloc alignment requirement, NMT uses 2 machine words for tracking purpose,
@@ -246,20 +298,32 @@ class MallocHeader {
   size_t           _size      : 64;
   size_t           _flags     : 8;
   size_t           _pos_idx   : 16;
-  size_t           _bucket_idx: 40;
-#define MAX_MALLOCSITE_TABLE_SIZE right_n_bits(40)
+  size_t           _bucket_idx: 38;
+  size_t           _site      : 2;
+#define MAX_MALLOCSITE_TABLE_SIZE right_n_bits(38)
 #define MAX_BUCKET_LENGTH         right_n_bits(16)
 #else
   size_t           _size      : 32;
   size_t           _flags     : 8;
   size_t           _pos_idx   : 8;
-  size_t           _bucket_idx: 16;
-#define MAX_MALLOCSITE_TABLE_SIZE  right_n_bits(16)
+  size_t           _bucket_idx: 14;
+  size_t           _site      : 2;
+#define MAX_MALLOCSITE_TABLE_SIZE  right_n_bits(14)
 #define MAX_BUCKET_LENGTH          right_n_bits(8)
 #endif  // _LP64
 
+  // How the malloc is accounted in the malloc site table.
+  enum SiteKind {
+    site_none,            // Not recorded, e.g. not sampled
+    site_exact,           // Recorded with its size
+    site_sampled          // Recorded with the estimates of MallocSiteSampler
+  };
+
  public:
-  MallocHeader(size_t size, MEMFLAGS flags, const NativeCallStack& stack, NMT_TrackingLevel level) {
+  // With detail tracking, the malloc is recorded at the site of stack, unless
+  // stack is NULL. If sampled is true, it is recorded with estimates.
+  MallocHeader(size_t size, MEMFLAGS flags, const NativeCallStack* stack, NMT_TrackingLevel level,
+               bool sampled) {
     assert(sizeof(MallocHeader) == sizeof(void*) * 2,
       "Wrong header size");
 
@@ -269,14 +333,17 @@ class MallocHeader {
 
     _flags = NMTUtil::flag_to_index(flags);
     set_size(size);
-    if (level == NMT_detail) {
+    _site = site_none;
+    if (level == NMT_detail && stack != NULL) {
       size_t bucket_idx;
       size_t pos_idx;
-      if (record_malloc_site(stack, size, &bucket_idx, &pos_idx, flags)) {
+      size_t count = sampled ? MallocSiteSampler::estimated_count(size) : 1;
+      if (record_malloc_site(*stack, size * count, count, &bucket_idx, &pos_idx, flags)) {
         assert(bucket_idx <= MAX_MALLOCSITE_TABLE_SIZE, "Overflow bucket index");
         assert(pos_idx <= MAX_BUCKET_LENGTH, "Overflow bucket position index");
         _bucket_idx = bucket_idx;
         _pos_idx = pos_idx;
+        _site = sampled ? site_sampled : site_exact;
       }
     }
 
@@ -295,7 +362,7 @@ class MallocHeader {
   inline void set_size(size_t size) {
     _size = size;
   }
-  bool record_malloc_site(const NativeCallStack& stack, size_t size,
+  bool record_malloc_site(const NativeCallStack& stack, size_t size, size_t count,
     size_t* bucket_idx, size_t* pos_idx, MEMFLAGS flags) const;
 };
 
@@ -2198,6 +2198,45 @@ JVM_ENTRY(void, jmm_GetThreadCpuTimesWithKind(JNIEnv *env, jlongArray ids,
 JVM_END
 
 
+// Fills ids, cpuTimes and allocatedBytes with the thread ID, the CPU time
+// (in nanoseconds) and the amount of memory allocated on the Java heap
+// (in bytes) of the live threads, in a single pass over all threads.
+// CPU times and allocated memory are -1 if their measurement is disabled.
+// If user_sys_cpu_time = true, the sum of user level and system CPU time
+// is returned; otherwise, only user level CPU time is returned.
+// Returns the number of live threads. If it is larger than the length of
+// the arrays, only as many threads as fit are filled in.
+JVM_ENTRY(jint, jmm_GetThreadStatistics(JNIEnv *env, jlongArray ids,
+                                        jlongArray cpuTimes,
+                                        jlongArray allocatedBytes,
+                                        jboolean user_sys_cpu_time))
+  if (ids == NULL || cpuTimes == NULL || allocatedBytes == NULL) {
+    THROW_(vmSymbols::java_lang_NullPointerException(), 0);
+  }
+
+  ResourceMark rm(THREAD);
+  typeArrayHandle ids_ah(THREAD, typeArrayOop(JNIHandles::resolve_non_null(ids)));
+  typeArrayHandle cpu_ah(THREAD, typeArrayOop(JNIHandles::resolve_non_null(cpuTimes)));
+  typeArrayHandle alloc_ah(THREAD, typeArrayOop(JNIHandles::resolve_non_null(allocatedBytes)));
+
+  int length = ids_ah->length();
+  if (length != cpu_ah->length() || length != alloc_ah->length()) {
+    THROW_MSG_(vmSymbols::java_lang_IllegalArgumentException(),
+               "The lengths of the given long arrays do not match", 0);
+  }
+
+  jlong* tids = NEW_RESOURCE_ARRAY(jlong, length);
+  jlong* times = NEW_RESOURCE_ARRAY(jlong, length);
+  jlong* sizes = NEW_RESOURCE_ARRAY(jlong, length);
+  int count = ThreadService::get_thread_statistics(tids, times, sizes, length,
+                                                   user_sys_cpu_time != 0);
+  for (int i = 0; i < MIN2(count, length); i++) {
+    ids_ah->long_at_put(i, tids[i]);
+    cpu_ah->long_at_put(i, times[i]);
+    alloc_ah->long_at_put(i, sizes[i]);
+  }
+  return count;
+JVM_END
 
 #if INCLUDE_MANAGEMENT
 const struct jmmInterface_1_ jmm_interface = {
@@ -2233,7 +2272,7 @@ const struct jmmInterface_1_ jmm_interface = {
   jmm_DumpHeap0,
   jmm_FindDeadlockedThreads,
   jmm_SetVMGlobal,
-  NULL,
+  jmm_GetThreadStatistics,
   jmm_DumpThreads,
   jmm_SetGCNotificationEnabled,
   jmm_GetDiagnosticCommands,
@@ -241,6 +241,10 @@ void MemDetailReporter::report_detail() {
   // Start detail report
   outputStream* out = output();
   out->print_cr("Details:\n");
+  if (MallocSiteSampler::is_enabled()) {
+    out->print_cr("Malloc sites are estimated from mallocs sampled every " SIZE_FORMAT " bytes on average.\n",
+                  NMTMallocSiteSampleInterval);
+  }
 
   int num_omitted =
       report_malloc_sites() +
@@ -86,9 +86,11 @@ class MemTracker : AllStatic {
 #include "services/threadStackTracker.hpp"
 #include "services/virtualMemoryTracker.hpp"
 
-#define CURRENT_PC ((MemTracker::tracking_level() == NMT_detail) ? \
+// With NMTMallocSiteSampleInterval, the call stack is only captured for
+// the sampled mallocs, see MallocTracker::record_malloc.
+#define CURRENT_PC ((MemTracker::tracking_level() == NMT_detail && !MallocSiteSampler::is_enabled()) ? \
                     NativeCallStack(0) : NativeCallStack::empty_stack())
-#define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
+#define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail && !MallocSiteSampler::is_enabled()) ? \
                     NativeCallStack(1) : NativeCallStack::empty_stack())
 
 class MemBaseline;
@@ -24,6 +24,7 @@
 #include "precompiled.hpp"
 #include "memory/resourceArea.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/vmThread.hpp"
 #include "runtime/vmOperations.hpp"
 #include "services/nmtDCmd.hpp"
@@ -55,6 +56,9 @@ NMTDCmd::NMTDCmd(outputStream* output,
             "BOOLEAN", false, "false"),
   _statistics("statistics", "print tracker statistics for tuning purpose.", \
             "BOOLEAN", false, "false"),
+  _peak("peak", "request runtime to report the peak malloc and arena memory " \
+            "by each subsystem, and the peak arena memory of each thread.",
+            "BOOLEAN", false, "false"),
   _scale("scale", "Memory usage in which scale, KB, MB or GB",
        "STRING", false, "KB") {
   _dcmdparser.add_dcmd_option(&_summary);
@@ -64,6 +68,7 @@ NMTDCmd::NMTDCmd(outputStream* output,
   _dcmdparser.add_dcmd_option(&_detail_diff);
   _dcmdparser.add_dcmd_option(&_shutdown);
   _dcmdparser.add_dcmd_option(&_statistics);
+  _dcmdparser.add_dcmd_option(&_peak);
   _dcmdparser.add_dcmd_option(&_scale);
 }
 
@@ -99,10 +104,11 @@ void NMTDCmd::execute(DCmdSource source, TRAPS) {
   if (_detail_diff.is_set() && _detail_diff.value()) { ++nopt; }
   if (_shutdown.is_set() && _shutdown.value()) { ++nopt; }
   if (_statistics.is_set() && _statistics.value()) { ++nopt; }
+  if (_peak.is_set() && _peak.value()) { ++nopt; }
 
   if (nopt > 1) {
       output()->print_cr("At most one of the following option can be specified: " \
-        "summary, detail, metadata, baseline, summary.diff, detail.diff, shutdown");
+        "summary, detail, metadata, baseline, summary.diff, detail.diff, shutdown, statistics, peak");
       return;
   } else if (nopt == 0) {
     if (_summary.is_set()) {
@@ -154,6 +160,8 @@ void NMTDCmd::execute(DCmdSource source, TRAPS) {
     if (check_detail_tracking_level(output())) {
       MemTracker::tuning_statistics(output());
     }
+  } else if (_peak.value()) {
+    report_peak(scale_unit);
   } else {
     ShouldNotReachHere();
     output()->print_cr("Unknown command");
@@ -192,6 +200,53 @@ void NMTDCmd::report_diff(bool summaryOnly, size_t scale_unit) {
   }
 }
 
+class ThreadArenaPeakClosure : public ThreadClosure {
+  outputStream* _out;
+  size_t        _scale;
+ public:
+  ThreadArenaPeakClosure(outputStream* out, size_t scale) : _out(out), _scale(scale) {}
+
+  void do_thread(Thread* thread) {
+    size_t current = (size_t)MAX2(thread->arena_bytes(), (ssize_t)0);
+    size_t peak = (size_t)MAX2(thread->arena_peak(), (ssize_t)0);
+    const char* unit = NMTUtil::scale_name(_scale);
+    _out->print_cr("%-40s (arena=" SIZE_FORMAT "%s peak=" SIZE_FORMAT "%s)", thread->name(),
+                   NMTUtil::amount_in_scale(current, _scale), unit,
+                   NMTUtil::amount_in_scale(peak, _scale), unit);
+  }
+};
+
+void NMTDCmd::report_peak(size_t scale_unit) {
+  outputStream* out = output();
+  const char* unit = NMTUtil::scale_name(scale_unit);
+  MallocMemorySnapshot* snapshot = MallocMemorySummary::as_snapshot();
+
+  out->print_cr("Native Memory Peaks:");
+  out->cr();
+  for (int index = 0; index < mt_number_of_types; index++) {
+    MEMFLAGS flag = NMTUtil::index_to_flag(index);
+    MallocMemory* malloc_memory = snapshot->by_type(flag);
+    if (malloc_memory->malloc_peak_size() == 0 && malloc_memory->arena_peak_size() == 0) {
+      continue;
+    }
+    out->print_cr("-%26s (malloc=" SIZE_FORMAT "%s peak=" SIZE_FORMAT "%s, arena=" SIZE_FORMAT "%s peak=" SIZE_FORMAT "%s)",
+                  NMTUtil::flag_to_name(flag),
+                  NMTUtil::amount_in_scale(malloc_memory->malloc_size(), scale_unit), unit,
+                  NMTUtil::amount_in_scale(malloc_memory->malloc_peak_size(), scale_unit), unit,
+                  NMTUtil::amount_in_scale(malloc_memory->arena_size(), scale_unit), unit,
+                  NMTUtil::amount_in_scale(malloc_memory->arena_peak_size(), scale_unit), unit);
+  }
+  out->cr();
+
+  // Arena memory is charged to the thread that grows the arena.
+  out->print_cr("Thread arena peaks:");
+  out->cr();
+  ResourceMark rm;
+  ThreadArenaPeakClosure cl(out, scale_unit);
+  MutexLocker ml(Threads_lock);
+  Threads::threads_do(&cl);
+}
+
 bool NMTDCmd::check_detail_tracking_level(outputStream* out) {
   if (MemTracker::tracking_level() == NMT_detail) {
     return true;
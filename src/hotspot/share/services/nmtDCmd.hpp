@@ -44,6 +44,7 @@ class NMTDCmd: public DCmdWithParser {
   DCmdArgument<bool>  _detail_diff;
   DCmdArgument<bool>  _shutdown;
   DCmdArgument<bool>  _statistics;
+  DCmdArgument<bool>  _peak;
   DCmdArgument<char*> _scale;
 
  public:
@@ -65,6 +66,7 @@ class NMTDCmd: public DCmdWithParser {
  private:
   void report(bool summaryOnly, size_t scale);
   void report_diff(bool summaryOnly, size_t scale);
+  void report_peak(size_t scale);
 
   size_t get_scale(const char* scale) const;
 
@@ -41,6 +41,7 @@
 #include "prims/jvmtiRawMonitor.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/init.hpp"
 #include "runtime/objectMonitor.inline.hpp"
 #include "runtime/thread.inline.hpp"
@@ -109,6 +110,31 @@ void ThreadService::init() {
                                                          mtServiceability);
 }
 
+int ThreadService::get_thread_statistics(jlong* ids, jlong* cpu_times, jlong* allocated_bytes,
+                                         int max_threads, bool user_sys_cpu_time) {
+  const bool cpu_time_enabled = is_thread_cpu_time_enabled();
+  const bool allocated_memory_enabled = is_thread_allocated_memory_enabled();
+
+  int count = 0;
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* jt = jtiwh.next(); ) {
+    // The same threads as reported by ThreadsListEnumerator, including
+    // JVMTI agent threads.
+    oop tobj = jt->threadObj();
+    if (tobj == NULL || jt->is_exiting() ||
+        !java_lang_Thread::is_alive(tobj) ||
+        jt->is_hidden_from_external_view()) {
+      continue;
+    }
+    if (count < max_threads) {
+      ids[count] = java_lang_Thread::thread_id(tobj);
+      cpu_times[count] = cpu_time_enabled ? os::thread_cpu_time(jt, user_sys_cpu_time) : -1;
+      allocated_bytes[count] = allocated_memory_enabled ? jt->cooked_allocated_bytes() : -1;
+    }
+    count++;
+  }
+  return count;
+}
+
 void ThreadService::reset_peak_thread_count() {
   // Acquire the lock to update the peak thread count
   // to synchronize with thread addition and removal.
@@ -432,8 +458,8 @@ DeadlockCycle* ThreadService::find_deadlocks_at_safepoint(ThreadsList * t_list,
       } else if (waitingToLockMonitor != NULL) {
         address currentOwner = (address)waitingToLockMonitor->owner();
         if (currentOwner != NULL) {
-          currentThread = Threads::owning_thread_from_monitor_owner(t_list,
-                                                                    currentOwner);
+          currentThread = Threads::owning_thread_from_monitor(t_list,
+                                                              waitingToLockMonitor);
           if (currentThread == NULL) {
             // This function is called at a safepoint so the JavaThread
             // that owns waitingToLockMonitor should be findable, but
@@ -549,6 +575,66 @@ ThreadSnapshot* ThreadDumpResult::add_thread_snapshot(JavaThread* thread) {
   return ts;
 }
 
+// Fills in a snapshot of the target thread while it is stopped in a
+// handshake. The JavaThreads involved are protected by the ThreadsList
+// of the originating ThreadDumpResult.
+class ThreadSnapshotClosure : public HandshakeClosure {
+  ThreadSnapshot* _snapshot;
+  ThreadsList*    _t_list;
+  int             _max_depth;
+  bool            _with_locked_monitors;
+  bool            _completed;
+public:
+  ThreadSnapshotClosure(ThreadSnapshot* snapshot, ThreadsList* t_list,
+                        int max_depth, bool with_locked_monitors) :
+    HandshakeClosure("ThreadSnapshot"),
+    _snapshot(snapshot),
+    _t_list(t_list),
+    _max_depth(max_depth),
+    _with_locked_monitors(with_locked_monitors),
+    _completed(false) {}
+
+  void do_thread(Thread* thr) {
+    JavaThread* jt = thr->as_Java_thread();
+    if (jt->is_exiting()) {
+      return;
+    }
+    ResourceMark rm;
+    _snapshot->initialize(_t_list, jt);
+    _snapshot->dump_stack_at_safepoint(_max_depth, _with_locked_monitors);
+    _completed = true;
+  }
+
+  bool completed() const { return _completed; }
+};
+
+bool ThreadDumpResult::add_thread_snapshot_in_handshake(JavaThread* thread,
+                                                        int max_depth,
+                                                        bool with_locked_monitors) {
+  // Link the snapshot before the handshake so that metadata_do() sees
+  // the captured methods at any safepoint after the stack walk.
+  ThreadSnapshot* ts = add_thread_snapshot();
+  ThreadSnapshotClosure cl(ts, t_list(), max_depth, with_locked_monitors);
+  Handshake::execute(&cl, thread);
+  return cl.completed();
+}
+
+void ThreadDumpResult::remove_last_thread_snapshot() {
+  assert(_last != NULL, "no snapshot to remove");
+  ThreadSnapshot* prev = NULL;
+  for (ThreadSnapshot* ts = _snapshots; ts != _last; ts = ts->next()) {
+    prev = ts;
+  }
+  if (prev == NULL) {
+    _snapshots = NULL;
+  } else {
+    prev->set_next(NULL);
+  }
+  delete _last;
+  _last = prev;
+  _num_snapshots--;
+}
+
 void ThreadDumpResult::link_thread_snapshot(ThreadSnapshot* ts) {
   assert(_num_threads == 0 || _num_snapshots < _num_threads,
          "_num_snapshots must be less than _num_threads");
@@ -668,7 +754,8 @@ ThreadStackTrace::~ThreadStackTrace() {
 }
 
 void ThreadStackTrace::dump_stack_at_safepoint(int maxDepth) {
-  assert(SafepointSynchronize::is_at_safepoint(), "all threads are stopped");
+  assert(SafepointSynchronize::is_at_safepoint() || _thread->is_handshake_safe_for(Thread::current()),
+         "all threads are stopped or the thread is in a handshake");
 
   if (_thread->has_last_Java_frame()) {
     RegisterMap reg_map(_thread);
@@ -699,7 +786,8 @@ void ThreadStackTrace::dump_stack_at_safepoint(int maxDepth) {
 
 
 bool ThreadStackTrace::is_owned_monitor_on_stack(oop object) {
-  assert(SafepointSynchronize::is_at_safepoint(), "all threads are stopped");
+  assert(SafepointSynchronize::is_at_safepoint() || _thread->is_handshake_safe_for(Thread::current()),
+         "all threads are stopped or the thread is in a handshake");
 
   bool found = false;
   int num_frames = get_stack_depth();
@@ -1010,8 +1098,7 @@ void DeadlockCycle::print_on_with(ThreadsList * t_list, outputStream* st) const
       if (!currentThread->current_pending_monitor_is_from_java()) {
         owner_desc = "\n  in JNI, which is held by";
       }
-      currentThread = Threads::owning_thread_from_monitor_owner(t_list,
-                                                                (address)waitingToLockMonitor->owner());
+      currentThread = Threads::owning_thread_from_monitor(t_list, waitingToLockMonitor);
       if (currentThread == NULL) {
         // The deadlock was detected at a safepoint so the JavaThread
         // that owns waitingToLockMonitor should be findable, but
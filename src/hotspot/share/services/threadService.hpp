@@ -98,6 +98,14 @@ public:
   static jlong get_live_thread_count()        { return _atomic_threads_count; }
   static jlong get_daemon_thread_count()      { return _atomic_daemon_threads_count; }
 
+  // Fills in the thread ID, the CPU time and the allocated bytes of up to
+  // max_threads live Java threads in a single pass over the threads list.
+  // CPU times and allocated bytes are -1 if their measurement is disabled.
+  // Returns the number of live Java threads, which can be larger than
+  // max_threads.
+  static int    get_thread_statistics(jlong* ids, jlong* cpu_times, jlong* allocated_bytes,
+                                      int max_threads, bool user_sys_cpu_time);
+
   // Support for thread dump
   static void   add_thread_dump(ThreadDumpResult* dump);
   static void   remove_thread_dump(ThreadDumpResult* dump);
@@ -216,6 +224,7 @@ private:
   // ThreadSnapshot instances should only be created via
   // ThreadDumpResult::add_thread_snapshot.
   friend class ThreadDumpResult;
+  friend class ThreadSnapshotClosure;
   ThreadSnapshot() : _thread(NULL),
                      _stack_trace(NULL), _concurrent_locks(NULL), _next(NULL) {};
   void        initialize(ThreadsList * t_list, JavaThread* thread);
@@ -370,6 +379,12 @@ class ThreadDumpResult : public StackObj {
 
   ThreadSnapshot*      add_thread_snapshot();
   ThreadSnapshot*      add_thread_snapshot(JavaThread* thread);
+  // Snapshot the thread in a handshake with it instead of at a safepoint.
+  // Returns false if the thread has exited, leaving an empty snapshot.
+  bool                 add_thread_snapshot_in_handshake(JavaThread* thread,
+                                                        int max_depth,
+                                                        bool with_locked_monitors);
+  void                 remove_last_thread_snapshot();
 
   void                 set_next(ThreadDumpResult* next) { _next = next; }
   ThreadDumpResult*    next()                           { return _next; }
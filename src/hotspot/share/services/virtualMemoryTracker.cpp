@@ -49,16 +49,12 @@ void VirtualMemorySummary::snapshot(VirtualMemorySnapshot* s) {
   as_snapshot()->copy_to(s);
 }
 
-SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* VirtualMemoryTracker::_reserved_regions;
+ReservedMemoryRegionTree* VirtualMemoryTracker::_reserved_regions;
 
 int compare_committed_region(const CommittedMemoryRegion& r1, const CommittedMemoryRegion& r2) {
   return r1.compare(r2);
 }
 
-int compare_reserved_region_base(const ReservedMemoryRegion& r1, const ReservedMemoryRegion& r2) {
-  return r1.compare(r2);
-}
-
 static bool is_mergeable_with(CommittedMemoryRegion* rgn, address addr, size_t size, const NativeCallStack& stack) {
   return rgn->adjacent_to(addr, size) && rgn->call_stack()->equals(stack);
 }
@@ -319,6 +315,145 @@ address ReservedMemoryRegion::thread_stack_uncommitted_bottom() const {
   return bottom;
 }
 
+void ReservedMemoryRegionTree::update_height(Node* node) {
+  node->_height = MAX2(height(node->_left), height(node->_right)) + 1;
+}
+
+ReservedMemoryRegionTree::Node* ReservedMemoryRegionTree::rotate_left(Node* node) {
+  Node* right = node->_right;
+  node->_right = right->_left;
+  right->_left = node;
+  update_height(node);
+  update_height(right);
+  return right;
+}
+
+ReservedMemoryRegionTree::Node* ReservedMemoryRegionTree::rotate_right(Node* node) {
+  Node* left = node->_left;
+  node->_left = left->_right;
+  left->_right = node;
+  update_height(node);
+  update_height(left);
+  return left;
+}
+
+ReservedMemoryRegionTree::Node* ReservedMemoryRegionTree::rebalance(Node* node) {
+  update_height(node);
+  int balance = height(node->_left) - height(node->_right);
+  if (balance > 1) {
+    if (height(node->_left->_left) < height(node->_left->_right)) {
+      node->_left = rotate_left(node->_left);
+    }
+    return rotate_right(node);
+  } else if (balance < -1) {
+    if (height(node->_right->_right) < height(node->_right->_left)) {
+      node->_right = rotate_right(node->_right);
+    }
+    return rotate_left(node);
+  }
+  return node;
+}
+
+ReservedMemoryRegionTree::Node* ReservedMemoryRegionTree::insert_node(Node* node, Node* new_node) {
+  if (node == NULL) {
+    return new_node;
+  }
+  int cmp = node->_region.compare(new_node->_region);
+  assert(cmp != 0, "Reserved regions must not overlap");
+  if (cmp > 0) {
+    node->_left = insert_node(node->_left, new_node);
+  } else {
+    node->_right = insert_node(node->_right, new_node);
+  }
+  return rebalance(node);
+}
+
+ReservedMemoryRegionTree::Node* ReservedMemoryRegionTree::remove_min_node(Node* node, Node** min_node) {
+  if (node->_left == NULL) {
+    *min_node = node;
+    return node->_right;
+  }
+  node->_left = remove_min_node(node->_left, min_node);
+  return rebalance(node);
+}
+
+ReservedMemoryRegionTree::Node* ReservedMemoryRegionTree::remove_node(Node* node, const ReservedMemoryRegion& rgn,
+                                                                      Node** removed) {
+  if (node == NULL) {
+    return NULL;
+  }
+  int cmp = node->_region.compare(rgn);
+  if (cmp > 0) {
+    node->_left = remove_node(node->_left, rgn, removed);
+  } else if (cmp < 0) {
+    node->_right = remove_node(node->_right, rgn, removed);
+  } else {
+    *removed = node;
+    if (node->_left == NULL) {
+      return node->_right;
+    } else if (node->_right == NULL) {
+      return node->_left;
+    }
+    // Splice in the successor node, keeping the other regions in place
+    Node* successor = NULL;
+    Node* right = remove_min_node(node->_right, &successor);
+    successor->_left = node->_left;
+    successor->_right = right;
+    return rebalance(successor);
+  }
+  return rebalance(node);
+}
+
+bool ReservedMemoryRegionTree::walk_nodes(const Node* node, VirtualMemoryWalker* walker) {
+  if (node == NULL) {
+    return true;
+  }
+  return walk_nodes(node->_left, walker) &&
+         walker->do_allocation_site(&node->_region) &&
+         walk_nodes(node->_right, walker);
+}
+
+void ReservedMemoryRegionTree::delete_nodes(Node* node) {
+  if (node != NULL) {
+    delete_nodes(node->_left);
+    delete_nodes(node->_right);
+    delete node;
+  }
+}
+
+ReservedMemoryRegion* ReservedMemoryRegionTree::find(const ReservedMemoryRegion& rgn) const {
+  Node* node = _root;
+  while (node != NULL) {
+    int cmp = node->_region.compare(rgn);
+    if (cmp == 0) {
+      return &node->_region;
+    }
+    node = (cmp > 0) ? node->_left : node->_right;
+  }
+  return NULL;
+}
+
+ReservedMemoryRegion* ReservedMemoryRegionTree::add(const ReservedMemoryRegion& rgn) {
+  Node* node = new (std::nothrow) Node(rgn);
+  if (node == NULL) {
+    return NULL;
+  }
+  _root = insert_node(_root, node);
+  _count++;
+  return &node->_region;
+}
+
+bool ReservedMemoryRegionTree::remove(const ReservedMemoryRegion& rgn) {
+  Node* removed = NULL;
+  _root = remove_node(_root, rgn, &removed);
+  if (removed == NULL) {
+    return false;
+  }
+  delete removed;
+  _count--;
+  return true;
+}
+
 bool VirtualMemoryTracker::initialize(NMT_TrackingLevel level) {
   if (level >= NMT_summary) {
     VirtualMemorySummary::initialize();
@@ -328,8 +463,7 @@ bool VirtualMemoryTracker::initialize(NMT_TrackingLevel level) {
 
 bool VirtualMemoryTracker::late_initialize(NMT_TrackingLevel level) {
   if (level >= NMT_summary) {
-    _reserved_regions = new (std::nothrow, ResourceObj::C_HEAP, mtNMT)
-      SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>();
+    _reserved_regions = new (std::nothrow) ReservedMemoryRegionTree();
     return (_reserved_regions != NULL);
   }
   return true;
@@ -543,11 +677,11 @@ bool VirtualMemoryTracker::remove_released_region(address addr, size_t size) {
 
     // use original region for lower region
     reserved_rgn->exclude_region(addr, top - addr);
-    LinkedListNode<ReservedMemoryRegion>* new_rgn = _reserved_regions->add(high_rgn);
+    ReservedMemoryRegion* new_rgn = _reserved_regions->add(high_rgn);
     if (new_rgn == NULL) {
       return false;
     } else {
-      reserved_rgn->move_committed_regions(addr, *new_rgn->data());
+      reserved_rgn->move_committed_regions(addr, *new_rgn);
       return true;
     }
   }
@@ -665,15 +799,8 @@ bool VirtualMemoryTracker::walk_virtual_memory(VirtualMemoryWalker* walker) {
   ThreadCritical tc;
   // Check that the _reserved_regions haven't been deleted.
   if (_reserved_regions != NULL) {
-    LinkedListNode<ReservedMemoryRegion>* head = _reserved_regions->head();
-    while (head != NULL) {
-      const ReservedMemoryRegion* rgn = head->peek();
-      if (!walker->do_allocation_site(rgn)) {
-        return false;
-      }
-      head = head->next();
-    }
-   }
+    return _reserved_regions->walk(walker);
+  }
   return true;
 }
 
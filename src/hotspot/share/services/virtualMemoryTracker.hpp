@@ -356,13 +356,62 @@ class ReservedMemoryRegion : public VirtualMemoryRegion {
   }
 };
 
-int compare_reserved_region_base(const ReservedMemoryRegion& r1, const ReservedMemoryRegion& r2);
-
 class VirtualMemoryWalker : public StackObj {
  public:
    virtual bool do_allocation_site(const ReservedMemoryRegion* rgn) { return false; }
 };
 
+// AVL tree of reserved memory regions, ordered by base address.
+// Reserved regions never overlap, so VirtualMemoryRegion::compare() is a total
+// order on the tree and find() locates the region containing any part of the
+// given range in O(log n), instead of walking a sorted list. Removal relinks
+// nodes rather than moving regions between them, so a ReservedMemoryRegion*
+// stays valid until that region itself is removed.
+class ReservedMemoryRegionTree : public CHeapObj<mtNMT> {
+ private:
+  class Node : public CHeapObj<mtNMT> {
+   public:
+    ReservedMemoryRegion _region;
+    Node*                _left;
+    Node*                _right;
+    int                  _height;
+
+    Node(const ReservedMemoryRegion& rgn) :
+      _region(rgn), _left(NULL), _right(NULL), _height(1) { }
+  };
+
+  Node*  _root;
+  size_t _count;
+
+  static int   height(const Node* node) { return node != NULL ? node->_height : 0; }
+  static void  update_height(Node* node);
+  static Node* rotate_left(Node* node);
+  static Node* rotate_right(Node* node);
+  static Node* rebalance(Node* node);
+  static Node* insert_node(Node* node, Node* new_node);
+  static Node* remove_min_node(Node* node, Node** min_node);
+  static Node* remove_node(Node* node, const ReservedMemoryRegion& rgn, Node** removed);
+  static bool  walk_nodes(const Node* node, VirtualMemoryWalker* walker);
+  static void  delete_nodes(Node* node);
+
+ public:
+  ReservedMemoryRegionTree() : _root(NULL), _count(0) { }
+  ~ReservedMemoryRegionTree() { delete_nodes(_root); }
+
+  // Returns the region overlapping rgn, or NULL
+  ReservedMemoryRegion* find(const ReservedMemoryRegion& rgn) const;
+  // Adds a copy of rgn, which must not overlap any existing region.
+  // Returns the added region, or NULL on allocation failure
+  ReservedMemoryRegion* add(const ReservedMemoryRegion& rgn);
+  // Removes the region overlapping rgn
+  bool remove(const ReservedMemoryRegion& rgn);
+
+  // Visits the regions in address order
+  bool walk(VirtualMemoryWalker* walker) const { return walk_nodes(_root, walker); }
+
+  size_t count() const { return _count; }
+};
+
 // Main class called from MemTracker to track virtual memory allocations, commits and releases.
 class VirtualMemoryTracker : AllStatic {
   friend class VirtualMemoryTrackerTest;
@@ -396,7 +445,7 @@ class VirtualMemoryTracker : AllStatic {
   static void snapshot_thread_stacks();
 
  private:
-  static SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* _reserved_regions;
+  static ReservedMemoryRegionTree* _reserved_regions;
 };
 
 #endif // INCLUDE_NMT
@@ -212,6 +212,19 @@ inline BitMap::idx_t BitMap::get_next_bit_impl(idx_t l_index, idx_t r_index) con
       idx_t limit = aligned_right
         ? to_words_align_down(r_index) // Miniscule savings when aligned.
         : to_words_align_up(r_index);
+      // Sparse maps often have long runs of uninteresting words.  Skip
+      // them a block of words at a time, testing the combined block with
+      // a single branch; the compiler can merge these loads into vector
+      // loads where available.  The word loop below finds the bit.
+      const idx_t block = 4;
+      while (index + block < limit) {
+        const bm_word_t* words = map() + index + 1;
+        if (((words[0] ^ flip) | (words[1] ^ flip) |
+             (words[2] ^ flip) | (words[3] ^ flip)) != 0) {
+          break;
+        }
+        index += block;
+      }
       while (++index < limit) {
         cword = map(index) ^ flip;
         if (cword != 0) {
@@ -256,6 +256,20 @@ class ConcurrentHashTable : public CHeapObj<F> {
   };
 
 
+  // Adapts key i of a BULK_LOOKUP_FUNC to the LOOKUP_FUNC interface.
+  template <typename BULK_LOOKUP_FUNC>
+  class BulkLookupAt : public StackObj {
+    BULK_LOOKUP_FUNC& _bulk_lookup_f;
+    const size_t _index;
+   public:
+    BulkLookupAt(BULK_LOOKUP_FUNC& bulk_lookup_f, size_t index)
+      : _bulk_lookup_f(bulk_lookup_f), _index(index) {}
+    uintx get_hash() const { return _bulk_lookup_f.get_hash(_index); }
+    bool equals(VALUE* value, bool* is_dead) {
+      return _bulk_lookup_f.equals(_index, value, is_dead);
+    }
+  };
+
   // Max number of deletes in one bucket chain during bulk delete.
   static const size_t BULK_DELETE_LIMIT = 256;
 
@@ -296,13 +310,15 @@ class ConcurrentHashTable : public CHeapObj<F> {
   bool internal_shrink(Thread* thread, size_t size_limit_log2);
   void internal_reset(size_t log2_size);
 
-  // Methods for growing.
+  // Methods for growing. With is_mt several threads may grow disjoint ranges
+  // at the same time, so the invisible epoch optimization cannot be used.
   bool unzip_bucket(Thread* thread, InternalTable* old_table,
                     InternalTable* new_table, size_t even_index,
-                    size_t odd_index);
+                    size_t odd_index, bool is_mt = false);
   bool internal_grow_prolog(Thread* thread, size_t log2_size);
   void internal_grow_epilog(Thread* thread);
-  void internal_grow_range(Thread* thread, size_t start, size_t stop);
+  void internal_grow_range(Thread* thread, size_t start, size_t stop,
+                           bool is_mt = false);
   bool internal_grow(Thread* thread, size_t log2_size);
 
   // Get a value.
@@ -411,6 +427,15 @@ class ConcurrentHashTable : public CHeapObj<F> {
   bool get(Thread* thread, LOOKUP_FUNC& lookup_f, FOUND_FUNC& foundf,
            bool* grow_hint = NULL);
 
+  // Looks up count keys in one critical section. BULK_LOOKUP_FUNC provides
+  // get_hash(size_t i) and equals(size_t i, VALUE* value, bool* is_dead) for
+  // each key i. The buckets of all keys are prefetched before any chain is
+  // walked, and FOUND_FUNC is called as found_f(i, value) for each key found.
+  // Returns the number of keys found.
+  template <typename BULK_LOOKUP_FUNC, typename FOUND_FUNC>
+  size_t get_bulk(Thread* thread, BULK_LOOKUP_FUNC& bulk_lookup_f, size_t count,
+                  FOUND_FUNC& found_f, bool* grow_hint = NULL);
+
   // Returns true true if the item was inserted, duplicates are found with
   // LOOKUP_FUNC.
   template <typename LOOKUP_FUNC>
@@ -512,6 +537,18 @@ class ConcurrentHashTable : public CHeapObj<F> {
  public:
   class BulkDeleteTask;
   class GrowTask;
+
+  // Lets any thread help with an ongoing multi-threaded GrowTask by doing one
+  // range of it. Returns false if there is no such task or it has no more
+  // work. Must not be called inside a critical section.
+  bool help_grow(Thread* thread);
+
+ private:
+  // The multi-threaded GrowTask other threads may help with, if any. Helpers
+  // find the task inside a critical section and register in _grow_helpers,
+  // so the task can wait for them before it finishes.
+  GrowTask* volatile _shared_grow_task;
+  volatile size_t _grow_helpers;
 };
 
 #endif // SHARE_UTILITIES_CONCURRENTHASHTABLE_HPP
@@ -404,7 +404,7 @@ ConcurrentHashTable<CONFIG, F>::
 
 template <typename CONFIG, MEMFLAGS F>
 inline void ConcurrentHashTable<CONFIG, F>::
-  internal_grow_range(Thread* thread, size_t start, size_t stop)
+  internal_grow_range(Thread* thread, size_t start, size_t stop, bool is_mt)
 {
   assert(stop <= _table->_size, "Outside backing array");
   assert(_new_table != NULL, "Grow not proper setup before start");
@@ -425,7 +425,7 @@ inline void ConcurrentHashTable<CONFIG, F>::
 
     // When this is done we have separated the nodes into corresponding buckets
     // in new table.
-    if (!unzip_bucket(thread, _table, _new_table, even_index, odd_index)) {
+    if (!unzip_bucket(thread, _table, _new_table, even_index, odd_index, is_mt)) {
       // If bucket is empty, unzip does nothing.
       // We must make sure readers go to new table before we poison the bucket.
       DEBUG_ONLY(GlobalCounter::write_synchronize();)
@@ -639,7 +639,8 @@ ConcurrentHashTable<CONFIG, F>::
 template <typename CONFIG, MEMFLAGS F>
 inline bool ConcurrentHashTable<CONFIG, F>::
   unzip_bucket(Thread* thread, InternalTable* old_table,
-               InternalTable* new_table, size_t even_index, size_t odd_index)
+               InternalTable* new_table, size_t even_index, size_t odd_index,
+               bool is_mt)
 {
   Node* aux = old_table->get_bucket(even_index)->first();
   if (aux == NULL) {
@@ -685,7 +686,11 @@ inline bool ConcurrentHashTable<CONFIG, F>::
     // We can only move 1 pointer otherwise a reader might be moved to the wrong
     // chain. E.g. looking for even hash value but got moved to the odd bucket
     // chain.
-    write_synchonize_on_visible_epoch(thread);
+    if (is_mt) {
+      GlobalCounter::write_synchronize();
+    } else {
+      write_synchonize_on_visible_epoch(thread);
+    }
     if (delete_me != NULL) {
       Node::destroy_node(_context, delete_me);
       delete_me = NULL;
@@ -1012,7 +1017,7 @@ inline ConcurrentHashTable<CONFIG, F>::
     : _context(context), _new_table(NULL), _log2_size_limit(log2size_limit),
       _log2_start_size(log2size), _grow_hint(grow_hint),
       _size_limit_reached(false), _resize_lock_owner(NULL),
-      _invisible_epoch(0)
+      _invisible_epoch(0), _shared_grow_task(NULL), _grow_helpers(0)
 {
   _stats_rate = TableRateStatistics();
   _resize_lock =
@@ -1080,6 +1085,43 @@ inline bool ConcurrentHashTable<CONFIG, F>::
   return ret;
 }
 
+template <typename CONFIG, MEMFLAGS F>
+template <typename BULK_LOOKUP_FUNC, typename FOUND_FUNC>
+inline size_t ConcurrentHashTable<CONFIG, F>::
+  get_bulk(Thread* thread, BULK_LOOKUP_FUNC& bulk_lookup_f, size_t count,
+           FOUND_FUNC& found_f, bool* grow_hint)
+{
+  size_t found = 0;
+  bool grow = false;
+  ScopedCS cs(thread, this);
+  // Issue the loads of all buckets and then of all first nodes before
+  // walking any chain, so the cache misses of the keys overlap. This is only
+  // a hint, each chain is walked from a freshly loaded bucket below.
+  for (size_t i = 0; i < count; i++) {
+    Prefetch::read(get_bucket(bulk_lookup_f.get_hash(i)), 0);
+  }
+  for (size_t i = 0; i < count; i++) {
+    Node* first = get_bucket(bulk_lookup_f.get_hash(i))->first();
+    if (first != NULL) {
+      Prefetch::read(first, 0);
+    }
+  }
+  for (size_t i = 0; i < count; i++) {
+    BulkLookupAt<BULK_LOOKUP_FUNC> lookup_f(bulk_lookup_f, i);
+    bool key_grow_hint = false;
+    VALUE* val = internal_get(thread, lookup_f, &key_grow_hint);
+    grow |= key_grow_hint;
+    if (val != NULL) {
+      found_f(i, val);
+      found++;
+    }
+  }
+  if (grow_hint != NULL) {
+    *grow_hint = grow;
+  }
+  return found;
+}
+
 template <typename CONFIG, MEMFLAGS F>
 inline bool ConcurrentHashTable<CONFIG, F>::
   unsafe_insert(const VALUE& value) {
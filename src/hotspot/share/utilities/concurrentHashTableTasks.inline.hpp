@@ -42,6 +42,9 @@ class ConcurrentHashTable<CONFIG, F>::BucketsOperation {
 
   // Default size of _task_size_log2
   static const size_t DEFAULT_TASK_SIZE_LOG2 = 12;
+  // Size of _task_size_log2 for tasks that other threads may help with; they
+  // should not be held up for long.
+  static const size_t HELPER_TASK_SIZE_LOG2 = 8;
 
   // The table is split into ranges, every increment is one range.
   volatile size_t _next_to_claim;
@@ -77,7 +80,7 @@ class ConcurrentHashTable<CONFIG, F>::BucketsOperation {
 
   // Returns false if all ranges are claimed.
   bool have_more_work() {
-    return Atomic::load_acquire(&_next_to_claim) >= _stop_task;
+    return Atomic::load_acquire(&_next_to_claim) < _stop_task;
   }
 
   void thread_owns_resize_lock(Thread* thread) {
@@ -167,8 +170,27 @@ template <typename CONFIG, MEMFLAGS F>
 class ConcurrentHashTable<CONFIG, F>::GrowTask :
   public BucketsOperation
 {
+  // Waits until no other thread can start or is still doing a range of
+  // this task through help_grow().
+  void unpublish() {
+    ConcurrentHashTable<CONFIG, F>* cht = BucketsOperation::_cht;
+    Atomic::release_store(&cht->_shared_grow_task, (GrowTask*)NULL);
+    // Helpers register inside a critical section.
+    GlobalCounter::write_synchronize();
+    SpinYield yield;
+    while (Atomic::load_acquire(&cht->_grow_helpers) != 0) {
+      yield.wait();
+    }
+  }
+
  public:
-  GrowTask(ConcurrentHashTable<CONFIG, F>* cht) : BucketsOperation(cht) {
+  // With is_mt, other threads may call do_task() concurrently, either
+  // directly or through ConcurrentHashTable::help_grow().
+  GrowTask(ConcurrentHashTable<CONFIG, F>* cht, bool is_mt = false)
+    : BucketsOperation(cht, is_mt) {
+    if (is_mt) {
+      BucketsOperation::_task_size_log2 = BucketsOperation::HELPER_TASK_SIZE_LOG2;
+    }
   }
   // Before start prepare must be called.
   bool prepare(Thread* thread) {
@@ -177,6 +199,9 @@ class ConcurrentHashTable<CONFIG, F>::GrowTask :
       return false;
     }
     this->setup(thread);
+    if (BucketsOperation::_is_mt) {
+      Atomic::release_store(&BucketsOperation::_cht->_shared_grow_task, this);
+    }
     return true;
   }
 
@@ -188,7 +213,8 @@ class ConcurrentHashTable<CONFIG, F>::GrowTask :
     if (!this->claim(&start, &stop)) {
       return false;
     }
-    BucketsOperation::_cht->internal_grow_range(thread, start, stop);
+    BucketsOperation::_cht->internal_grow_range(thread, start, stop,
+                                                BucketsOperation::_is_mt);
     assert(BucketsOperation::_cht->_resize_lock_owner != NULL,
            "Should be locked");
     return true;
@@ -197,9 +223,30 @@ class ConcurrentHashTable<CONFIG, F>::GrowTask :
   // Must be called after do_task returns false.
   void done(Thread* thread) {
     this->thread_owns_resize_lock(thread);
+    if (BucketsOperation::_is_mt) {
+      unpublish();
+    }
     BucketsOperation::_cht->internal_grow_epilog(thread);
     this->thread_do_not_own_resize_lock(thread);
   }
 };
 
+template <typename CONFIG, MEMFLAGS F>
+inline bool ConcurrentHashTable<CONFIG, F>::help_grow(Thread* thread)
+{
+  GrowTask* task;
+  {
+    GlobalCounter::CriticalSection cs(thread);
+    task = Atomic::load_acquire(&_shared_grow_task);
+    if (task == NULL) {
+      return false;
+    }
+    Atomic::inc(&_grow_helpers);
+  }
+  // The task cannot finish while we are registered as a helper.
+  bool more = task->do_task(thread);
+  Atomic::dec(&_grow_helpers);
+  return more;
+}
+
 #endif // SHARE_UTILITIES_CONCURRENTHASHTABLETASKS_INLINE_HPP
@@ -29,9 +29,11 @@
 #include "memory/allocation.inline.hpp"
 #include "utilities/elfFuncDescTable.hpp"
 #include "utilities/elfSymbolTable.hpp"
+#include "utilities/quickSort.hpp"
 
 ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
-  _next(NULL), _fd(file), _section(file, shdr) {
+  _next(NULL), _fd(file), _section(file, shdr),
+  _func_symbols(NULL), _func_symbol_count(0), _func_symbols_built(false) {
   assert(file != NULL, "null file handle");
   _status = _section.status();
 
@@ -41,22 +43,28 @@ ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
 }
 
 ElfSymbolTable::~ElfSymbolTable() {
+  if (_func_symbols != NULL) {
+    FREE_C_HEAP_ARRAY(FuncSymbol, _func_symbols);
+  }
   if (_next != NULL) {
     delete _next;
   }
 }
 
+address ElfSymbolTable::symbol_address(const Elf_Sym* sym, ElfFuncDescTable* funcDescTable) {
+  if (funcDescTable != NULL && funcDescTable->get_index() == sym->st_shndx) {
+    // We need to go another step trough the function descriptor table (currently PPC64 only)
+    return funcDescTable->lookup(sym->st_value);
+  } else {
+    return (address)sym->st_value;
+  }
+}
+
 bool ElfSymbolTable::compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
   if (STT_FUNC == ELF_ST_TYPE(sym->st_info)) {
     Elf_Word st_size = sym->st_size;
     const Elf_Shdr* shdr = _section.section_header();
-    address sym_addr;
-    if (funcDescTable != NULL && funcDescTable->get_index() == sym->st_shndx) {
-      // We need to go another step trough the function descriptor table (currently PPC64 only)
-      sym_addr = funcDescTable->lookup(sym->st_value);
-    } else {
-      sym_addr = (address)sym->st_value;
-    }
+    address sym_addr = symbol_address(sym, funcDescTable);
     if (sym_addr <= addr && (Elf_Word)(addr - sym_addr) < st_size) {
       *offset = (int)(addr - sym_addr);
       *posIndex = sym->st_name;
@@ -67,6 +75,80 @@ bool ElfSymbolTable::compare(const Elf_Sym* sym, address addr, int* stringtableI
   return false;
 }
 
+int ElfSymbolTable::compare_func_symbols(const FuncSymbol& a, const FuncSymbol& b) {
+  if (a._addr != b._addr) {
+    return a._addr < b._addr ? -1 : 1;
+  }
+  return a._index - b._index;
+}
+
+void ElfSymbolTable::build_func_symbols(const Elf_Sym* symbols, int count, ElfFuncDescTable* funcDescTable) {
+  assert(!_func_symbols_built, "only once");
+  _func_symbols_built = true;
+
+  int func_count = 0;
+  for (int index = 0; index < count; index++) {
+    if (STT_FUNC == ELF_ST_TYPE(symbols[index].st_info) && symbols[index].st_size > 0) {
+      func_count++;
+    }
+  }
+  if (func_count == 0) {
+    return;
+  }
+  // Without the index lookups fall back to the linear walk.
+  FuncSymbol* func_symbols = NEW_C_HEAP_ARRAY_RETURN_NULL(FuncSymbol, func_count, mtInternal);
+  if (func_symbols == NULL) {
+    return;
+  }
+  int pos = 0;
+  for (int index = 0; index < count; index++) {
+    const Elf_Sym* sym = &symbols[index];
+    if (STT_FUNC == ELF_ST_TYPE(sym->st_info) && sym->st_size > 0) {
+      func_symbols[pos]._addr = symbol_address(sym, funcDescTable);
+      func_symbols[pos]._size = sym->st_size;
+      func_symbols[pos]._name = sym->st_name;
+      func_symbols[pos]._index = index;
+      pos++;
+    }
+  }
+  QuickSort::sort(func_symbols, func_count, compare_func_symbols, false);
+  _func_symbols = func_symbols;
+  _func_symbol_count = func_count;
+}
+
+bool ElfSymbolTable::lookup_func_symbols(address addr, int* stringtableIndex, int* posIndex, int* offset) {
+  // Find the first of the symbols with the highest address <= addr.
+  int low = 0;
+  int high = _func_symbol_count;
+  while (low < high) {
+    int mid = low + (high - low) / 2;
+    if (_func_symbols[mid]._addr <= addr) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low == 0) {
+    return false;
+  }
+  address sym_addr = _func_symbols[low - 1]._addr;
+  int first = low - 1;
+  while (first > 0 && _func_symbols[first - 1]._addr == sym_addr) {
+    first--;
+  }
+  // Aliases at the same address are ordered as in the symbol table.
+  for (int i = first; i < low; i++) {
+    const FuncSymbol* sym = &_func_symbols[i];
+    if ((Elf_Word)(addr - sym_addr) < sym->_size) {
+      *offset = (int)(addr - sym_addr);
+      *posIndex = sym->_name;
+      *stringtableIndex = _section.section_header()->sh_link;
+      return true;
+    }
+  }
+  return false;
+}
+
 bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
   assert(stringtableIndex, "null string table index pointer");
   assert(posIndex, "null string table offset pointer");
@@ -81,6 +163,12 @@ bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex,
   Elf_Sym* symbols = (Elf_Sym*)_section.section_data();
 
   if (symbols != NULL) {
+    if (!_func_symbols_built) {
+      build_func_symbols(symbols, count, funcDescTable);
+    }
+    if (_func_symbols != NULL) {
+      return lookup_func_symbols(addr, stringtableIndex, posIndex, offset);
+    }
     for (int index = 0; index < count; index ++) {
       if (compare(&symbols[index], addr, stringtableIndex, posIndex, offset, funcDescTable)) {
         return true;
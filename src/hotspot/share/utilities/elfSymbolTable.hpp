@@ -37,6 +37,8 @@
  * Whenever possible, it will load all symbols from the corresponding section
  * of the elf file into memory. Otherwise, it will walk the section in file
  * to look up the symbol that nearest the given address.
+ * When the symbols are in memory, the function symbols are also indexed by
+ * address on the first lookup, so that lookups are binary searches.
  */
 class ElfSymbolTable: public CHeapObj<mtInternal> {
   friend class ElfFile;
@@ -50,6 +52,18 @@ private:
   ElfSection      _section;
 
   NullDecoder::decoder_status _status;
+
+  // A function symbol in the address index
+  struct FuncSymbol {
+    address   _addr;
+    Elf_Word  _size;
+    Elf_Word  _name;
+    int       _index;   // position in the symbol table, to break ties
+  };
+
+  FuncSymbol* _func_symbols;       // sorted by address, or NULL
+  int         _func_symbol_count;
+  bool        _func_symbols_built;
 public:
   ElfSymbolTable(FILE* const file, Elf_Shdr& shdr);
   ~ElfSymbolTable();
@@ -63,6 +77,11 @@ private:
   void set_next(ElfSymbolTable* next) { _next = next; }
 
   bool compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable);
+
+  address symbol_address(const Elf_Sym* sym, ElfFuncDescTable* funcDescTable);
+  void build_func_symbols(const Elf_Sym* symbols, int count, ElfFuncDescTable* funcDescTable);
+  bool lookup_func_symbols(address addr, int* stringtableIndex, int* posIndex, int* offset);
+  static int compare_func_symbols(const FuncSymbol& a, const FuncSymbol& b);
 };
 
 #endif // !_WINDOWS and !__APPLE__
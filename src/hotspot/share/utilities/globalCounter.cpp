@@ -28,10 +28,12 @@
 #include "runtime/thread.hpp"
 #include "runtime/threadSMR.inline.hpp"
 #include "runtime/vmThread.hpp"
-#include "utilities/globalCounter.hpp"
+#include "utilities/globalCounter.inline.hpp"
 #include "utilities/spinYield.hpp"
 
 GlobalCounter::PaddedCounter GlobalCounter::_global_counter;
+GlobalCounter::PaddedReaderGroup GlobalCounter::_reader_groups[GlobalCounter::MAX_READER_GROUPS];
+volatile int GlobalCounter::_group_writer_lock = 0;
 
 class GlobalCounter::CounterThreadCheck : public ThreadClosure {
  private:
@@ -57,8 +59,62 @@ class GlobalCounter::CounterThreadCheck : public ThreadClosure {
   }
 };
 
+volatile uintx* GlobalCounter::reader_group_for(Thread* thread, uintx cnt) {
+  uintptr_t hash = (uintptr_t)thread;
+  hash ^= hash >> 16;
+  hash ^= hash >> 6;
+  uint group = (uint)(hash % GlobalCounterReaderGroups);
+  return &_reader_groups[group]._readers[(cnt / COUNTER_INCREMENT) & 1];
+}
+
+uintx GlobalCounter::reader_group_enter(Thread* thread) {
+  while (true) {
+    uintx cnt = Atomic::load(&_global_counter._counter);
+    volatile uintx* readers = reader_group_for(thread, cnt);
+    // Atomic::add provides the fence ordering the registration before the
+    // re-read of the global counter. If a writer advanced the counter in
+    // between, it may already have scanned the group of this parity, so
+    // register again with the new version.
+    Atomic::add(readers, (uintx)1);
+    if (Atomic::load(&_global_counter._counter) == cnt) {
+      return cnt | COUNTER_ACTIVE;
+    }
+    Atomic::sub(readers, (uintx)1);
+  }
+}
+
+void GlobalCounter::reader_group_exit(Thread* thread, uintx cnt) {
+  // Atomic::sub orders the reads in the critical section before it.
+  Atomic::sub(reader_group_for(thread, cnt), (uintx)1);
+}
+
+void GlobalCounter::write_synchronize_reader_groups() {
+  // Writers must not overlap; readers registered with the version a
+  // concurrent writer advanced to would otherwise not be waited for.
+  SpinYield lock_yield;
+  while (Atomic::cmpxchg(&_group_writer_lock, 0, 1) != 0) {
+    lock_yield.wait();
+  }
+  // Atomic::fetch_and_add must provide fence since we have storeload dependency.
+  uintx old_cnt = Atomic::fetch_and_add(&_global_counter._counter, COUNTER_INCREMENT);
+  uintx parity = (old_cnt / COUNTER_INCREMENT) & 1;
+
+  // Wait for all readers registered with the previous version.
+  for (uint i = 0; i < GlobalCounterReaderGroups; i++) {
+    SpinYield yield;
+    while (Atomic::load_acquire(&_reader_groups[i]._readers[parity]) != 0) {
+      yield.wait();
+    }
+  }
+  Atomic::release_store_fence(&_group_writer_lock, 0);
+}
+
 void GlobalCounter::write_synchronize() {
   assert((*Thread::current()->get_rcu_counter() & COUNTER_ACTIVE) == 0x0, "must be outside a critcal section");
+  if (use_reader_groups()) {
+    write_synchronize_reader_groups();
+    return;
+  }
   // Atomic::add must provide fence since we have storeload dependency.
   uintx gbl_cnt = Atomic::add(&_global_counter._counter, COUNTER_INCREMENT);
 
@@ -41,6 +41,13 @@ class Thread;
 // all readers and wait until they have left the generation. (a system memory
 // barrier can be used on write-side to remove fence in read-side,
 // not implemented).
+//
+// With GlobalCounterReaderGroups set, readers instead register in one of a
+// fixed number of shared counters, selected by a hash of the thread, and
+// indexed by the parity of the global counter. The write-side then only
+// has to wait for the counters of the previous parity to drain, so its
+// cost is proportional to the number of groups and not to the number of
+// threads. The read-side pays for an atomic update of a shared counter.
 class GlobalCounter : public AllStatic {
  private:
   // Since do not know what we will end up next to in BSS, we make sure the
@@ -62,6 +69,27 @@ class GlobalCounter : public AllStatic {
   // The per thread scanning closure.
   class CounterThreadCheck;
 
+  // Must match the upper bound of GlobalCounterReaderGroups.
+  static const uint MAX_READER_GROUPS = 256;
+
+  // Reader counts of a group, one for each parity of the global counter.
+  struct PaddedReaderGroup {
+    DEFINE_PAD_MINUS_SIZE(0, DEFAULT_CACHE_LINE_SIZE, 0);
+    volatile uintx _readers[2];
+    DEFINE_PAD_MINUS_SIZE(1, DEFAULT_CACHE_LINE_SIZE, 2 * sizeof(volatile uintx));
+  };
+
+  static PaddedReaderGroup _reader_groups[MAX_READER_GROUPS];
+
+  // Serializes the write-side when reader groups are used.
+  static volatile int _group_writer_lock;
+
+  static bool use_reader_groups();
+  static volatile uintx* reader_group_for(Thread* thread, uintx cnt);
+  static uintx reader_group_enter(Thread* thread);
+  static void reader_group_exit(Thread* thread, uintx cnt);
+  static void write_synchronize_reader_groups();
+
  public:
 
   // The type of the critical section context passed from
@@ -28,8 +28,13 @@
 #include "utilities/globalCounter.hpp"
 
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/thread.inline.hpp"
 
+inline bool GlobalCounter::use_reader_groups() {
+  return GlobalCounterReaderGroups > 0;
+}
+
 inline GlobalCounter::CSContext
 GlobalCounter::critical_section_begin(Thread *thread) {
   assert(thread == Thread::current(), "must be current thread");
@@ -38,7 +43,11 @@ GlobalCounter::critical_section_begin(Thread *thread) {
   // Otherwise, set the counter to the current version + active bit.
   uintx new_cnt = old_cnt;
   if ((new_cnt & COUNTER_ACTIVE) == 0) {
-    new_cnt = Atomic::load(&_global_counter._counter) | COUNTER_ACTIVE;
+    if (use_reader_groups()) {
+      new_cnt = reader_group_enter(thread);
+    } else {
+      new_cnt = Atomic::load(&_global_counter._counter) | COUNTER_ACTIVE;
+    }
   }
   Atomic::release_store_fence(thread->get_rcu_counter(), new_cnt);
   return static_cast<CSContext>(old_cnt);
@@ -48,6 +57,10 @@ inline void
 GlobalCounter::critical_section_end(Thread *thread, CSContext context) {
   assert(thread == Thread::current(), "must be current thread");
   assert((*thread->get_rcu_counter() & COUNTER_ACTIVE) == COUNTER_ACTIVE, "must be in critical section");
+  if (use_reader_groups() && (static_cast<uintx>(context) & COUNTER_ACTIVE) == 0) {
+    // Leaving the outermost critical section.
+    reader_group_exit(thread, Atomic::load(thread->get_rcu_counter()));
+  }
   // Restore the counter value from before the associated begin.
   Atomic::release_store(thread->get_rcu_counter(),
                         static_cast<uintx>(context));
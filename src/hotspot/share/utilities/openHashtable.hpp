@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_UTILITIES_OPENHASHTABLE_HPP
+#define SHARE_UTILITIES_OPENHASHTABLE_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+// An open-addressed, resizeable map with the same interface as
+// ResourceHashtable. Entries are stored inline in a single power-of-two
+// sized array and placed with Robin Hood linear probing, so lookups touch
+// a few adjacent cache lines instead of chasing a chain of nodes. Removal
+// uses backward shifting and leaves no tombstones. The table doubles when
+// its load factor would exceed 3/4.
+//
+// K and V must be default-constructible and copy-assignable. Unlike
+// ResourceHashtable, a V* returned by get() or put_if_absent() is only
+// valid until the next insertion or removal, since both may move entries.
+//
+// With ALLOC_TYPE == RESOURCE_AREA the table must not outlive the
+// enclosing ResourceMark; with C_HEAP the table is freed by the destructor.
+template<
+    typename K, typename V,
+    unsigned (*HASH)  (K const&)           = primitive_hash<K>,
+    bool     (*EQUALS)(K const&, K const&) = primitive_equals<K>,
+    ResourceObj::allocation_type ALLOC_TYPE = ResourceObj::RESOURCE_AREA,
+    MEMFLAGS MEM_TYPE = mtInternal
+    >
+class OpenHashtable : public ResourceObj {
+ private:
+  NONCOPYABLE(OpenHashtable);
+
+  class Entry {
+   public:
+    K _key;
+    V _value;
+    unsigned _hash;
+    unsigned _dist;   // 1 + distance from the home slot, 0 if the slot is empty
+
+    Entry() : _key(), _value(), _hash(0), _dist(0) {}
+
+    bool is_empty() const { return _dist == 0; }
+  };
+
+  static const unsigned MIN_CAPACITY = 16;
+  static const unsigned MAX_CAPACITY = 1u << 30;
+
+  Entry* _table;
+  unsigned _capacity;           // Always a power of two
+  unsigned _shift;              // 32 - log2(_capacity)
+  unsigned _number_of_entries;
+
+  static Entry* allocate_table(unsigned capacity) {
+    Entry* table;
+    if (ALLOC_TYPE == ResourceObj::C_HEAP) {
+      table = NEW_C_HEAP_ARRAY(Entry, capacity, MEM_TYPE);
+    } else {
+      assert(ALLOC_TYPE == ResourceObj::RESOURCE_AREA, "unsupported allocation type");
+      table = NEW_RESOURCE_ARRAY(Entry, capacity);
+    }
+    for (unsigned i = 0; i < capacity; i++) {
+      ::new ((void*)&table[i]) Entry();
+    }
+    return table;
+  }
+
+  static void free_table(Entry* table, unsigned capacity) {
+    for (unsigned i = 0; i < capacity; i++) {
+      table[i].~Entry();
+    }
+    if (ALLOC_TYPE == ResourceObj::C_HEAP) {
+      FREE_C_HEAP_ARRAY(Entry, table);
+    } else {
+      FREE_RESOURCE_ARRAY(Entry, table, capacity);
+    }
+  }
+
+  void initialize(unsigned capacity) {
+    assert(is_power_of_2(capacity) && capacity >= MIN_CAPACITY, "invalid capacity %u", capacity);
+    _table = allocate_table(capacity);
+    _capacity = capacity;
+    _shift = 32 - log2i_exact(capacity);
+    _number_of_entries = 0;
+  }
+
+  // Fibonacci hashing spreads the hash over the high bits, so keys such as
+  // aligned pointers, whose primitive_hash differs only in a few bits, do
+  // not all land in the same neighbourhood of a power-of-two table.
+  unsigned home_index(unsigned hash) const {
+    return (hash * 0x9E3779B9u) >> _shift;
+  }
+
+  unsigned next_index(unsigned index) const {
+    return (index + 1) & (_capacity - 1);
+  }
+
+  // Returns the slot holding key, or -1 if the key is not in the table.
+  // Probing stops at the first entry that is closer to its home slot than
+  // key would be, since Robin Hood insertion would have displaced it.
+  int find_index(unsigned hash, K const& key) const {
+    unsigned index = home_index(hash);
+    for (unsigned dist = 1; ; dist++) {
+      const Entry& e = _table[index];
+      if (e._dist < dist) {
+        return -1;
+      }
+      if (e._hash == hash && EQUALS(key, e._key)) {
+        return (int)index;
+      }
+      index = next_index(index);
+    }
+  }
+
+  void grow_if_needed() {
+    if ((_number_of_entries + 1) * 4 <= _capacity * 3) {
+      return;
+    }
+    guarantee(_capacity < MAX_CAPACITY, "OpenHashtable is too large");
+    Entry* old_table = _table;
+    unsigned old_capacity = _capacity;
+    initialize(old_capacity * 2);
+    for (unsigned i = 0; i < old_capacity; i++) {
+      const Entry& e = old_table[i];
+      if (!e.is_empty()) {
+        insert(e._hash, e._key, e._value);
+      }
+    }
+    free_table(old_table, old_capacity);
+  }
+
+  // Inserts a key that is known not to be in the table. Richer entries
+  // (those closer to their home slot) are displaced to make room, and the
+  // displaced entry continues probing from where it was.
+  V* insert(unsigned hash, K const& key, V const& value) {
+    Entry cur;
+    cur._key = key;
+    cur._value = value;
+    cur._hash = hash;
+    cur._dist = 1;
+
+    V* result = NULL;
+    unsigned index = home_index(hash);
+    while (true) {
+      Entry& e = _table[index];
+      if (e.is_empty()) {
+        e = cur;
+        _number_of_entries++;
+        return result != NULL ? result : &e._value;
+      }
+      if (e._dist < cur._dist) {
+        Entry tmp = e;
+        e = cur;
+        cur = tmp;
+        if (result == NULL) {
+          result = &e._value;
+        }
+      }
+      index = next_index(index);
+      cur._dist++;
+    }
+  }
+
+  V* put_new(unsigned hash, K const& key, V const& value) {
+    grow_if_needed();
+    return insert(hash, key, value);
+  }
+
+ public:
+  // The table is sized so that initial_size entries fit without resizing.
+  OpenHashtable(unsigned initial_size = 0) {
+    unsigned capacity = MAX2(MIN_CAPACITY, round_up_power_of_2(initial_size + initial_size / 3 + 1));
+    initialize(capacity);
+  }
+
+  ~OpenHashtable() {
+    if (ALLOC_TYPE == ResourceObj::C_HEAP) {
+      free_table(_table, _capacity);
+    }
+  }
+
+  unsigned number_of_entries() const { return _number_of_entries; }
+  unsigned capacity() const { return _capacity; }
+
+  bool contains(K const& key) const {
+    return get(key) != NULL;
+  }
+
+  V* get(K const& key) const {
+    int index = find_index(HASH(key), key);
+    if (index >= 0) {
+      return &_table[index]._value;
+    } else {
+      return NULL;
+    }
+  }
+
+ /**
+  * Inserts or replaces a value in the table.
+  * @return: true:  if a new item is added
+  *          false: if the item already existed and the value is updated
+  */
+  bool put(K const& key, V const& value) {
+    unsigned hv = HASH(key);
+    int index = find_index(hv, key);
+    if (index >= 0) {
+      _table[index]._value = value;
+      return false;
+    } else {
+      put_new(hv, key, value);
+      return true;
+    }
+  }
+
+  // Look up the key.
+  // If an entry for the key exists, leave map unchanged and return a pointer to its value.
+  // If no entry for the key exists, create a new entry from key and a default-created value
+  //  and return a pointer to the value.
+  // *p_created is true if entry was created, false if entry pre-existed.
+  V* put_if_absent(K const& key, bool* p_created) {
+    return put_if_absent(key, V(), p_created);
+  }
+
+  // Look up the key.
+  // If an entry for the key exists, leave map unchanged and return a pointer to its value.
+  // If no entry for the key exists, create a new entry from key and value and return a
+  //  pointer to the value.
+  // *p_created is true if entry was created, false if entry pre-existed.
+  V* put_if_absent(K const& key, V const& value, bool* p_created) {
+    unsigned hv = HASH(key);
+    int index = find_index(hv, key);
+    if (index >= 0) {
+      *p_created = false;
+      return &_table[index]._value;
+    } else {
+      *p_created = true;
+      return put_new(hv, key, value);
+    }
+  }
+
+  bool remove(K const& key) {
+    int found = find_index(HASH(key), key);
+    if (found < 0) {
+      return false;
+    }
+    // Shift the following entries of the probe sequence back by one slot
+    // until one is found that is empty or already in its home slot.
+    unsigned index = (unsigned)found;
+    unsigned next = next_index(index);
+    while (_table[next]._dist > 1) {
+      _table[index] = _table[next];
+      _table[index]._dist--;
+      index = next;
+      next = next_index(next);
+    }
+    _table[index] = Entry();
+    _number_of_entries--;
+    return true;
+  }
+
+  // ITER contains bool do_entry(K const&, V const&), which will be
+  // called for each entry in the table.  If do_entry() returns false,
+  // the iteration is cancelled. The table must not be modified during
+  // the iteration.
+  template<class ITER>
+  void iterate(ITER* iter) const {
+    for (unsigned i = 0; i < _capacity; i++) {
+      const Entry& e = _table[i];
+      if (!e.is_empty()) {
+        bool cont = iter->do_entry(e._key, e._value);
+        if (!cont) { return; }
+      }
+    }
+  }
+};
+
+#endif // SHARE_UTILITIES_OPENHASHTABLE_HPP
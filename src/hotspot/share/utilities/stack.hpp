@@ -194,6 +194,10 @@ public:
   E  next() { return *next_addr(); }
   E* next_addr();
 
+  // Returns the base of the remaining items of the current segment, stores
+  // their number in *size, and advances to the next segment.
+  E* next_segment(size_t* size);
+
   void sync(); // Sync the iterator's state to the stack's current state.
 
 private:
@@ -277,4 +277,16 @@ E* StackIterator<E, F>::next_addr()
   return _cur_seg + --_cur_seg_size;
 }
 
+template <class E, MEMFLAGS F>
+E* StackIterator<E, F>::next_segment(size_t* size)
+{
+  assert(!is_empty(), "no items left");
+  E* addr = _cur_seg;
+  *size = _cur_seg_size;
+  _cur_seg = _stack.get_link(_cur_seg);
+  _cur_seg_size = _stack.segment_size();
+  _full_seg_size -= _stack.segment_size();
+  return addr;
+}
+
 #endif // SHARE_UTILITIES_STACK_INLINE_HPP
@@ -770,6 +770,13 @@ struct JNINativeInterface_ {
 
     jobject (JNICALL *GetModule)
        (JNIEnv* env, jclass clazz);
+
+    /* Bulk Object Array Access */
+
+    void (JNICALL *GetObjectArrayRegion)
+      (JNIEnv *env, jobjectArray array, jsize start, jsize len, jobject *buf);
+    void (JNICALL *SetObjectArrayRegion)
+      (JNIEnv *env, jobjectArray array, jsize start, jsize len, const jobject *buf);
 };
 
 /*
@@ -1868,6 +1875,17 @@ struct JNIEnv_ {
         return functions->GetModule(this, clazz);
     }
 
+    /* Bulk Object Array Access */
+
+    void GetObjectArrayRegion(jobjectArray array, jsize start, jsize len,
+                              jobject *buf) {
+        functions->GetObjectArrayRegion(this,array,start,len,buf);
+    }
+    void SetObjectArrayRegion(jobjectArray array, jsize start, jsize len,
+                              const jobject *buf) {
+        functions->SetObjectArrayRegion(this,array,start,len,buf);
+    }
+
 #endif /* __cplusplus */
 };
 
@@ -1979,6 +1997,7 @@ JNI_OnUnload(JavaVM *vm, void *reserved);
 #define JNI_VERSION_1_8 0x00010008
 #define JNI_VERSION_9   0x00090000
 #define JNI_VERSION_10  0x000a0000
+#define JNI_VERSION_17  0x00110000
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -578,6 +578,11 @@ public:
     // Return the resource for the supplied path.
     void get_resource(ImageLocation& location, u1* uncompressed_data) const;
 
+    // Return the address of the resource for the supplied location index in
+    // the mapped image, or NULL if the resource is compressed or the image is
+    // not memory mapped.
+    const u1* get_resource_address(u4 index) const;
+
     // Return the ImageModuleData for this image
     ImageModuleData * get_image_module_data();
 
@@ -157,6 +157,25 @@ JIMAGE_GetResource(JImageFile* jimage, JImageLocationRef location,
 typedef jlong(*JImageGetResource_t)(JImageFile* jimage, JImageLocationRef location,
         char* buffer, jlong size);
 
+/*
+ * JImageGetResourceAddress - Given an open image file (see JImageOpen) and
+ * location information (see JImageFindResource), return the address of the
+ * resource bytes in the memory mapped image. The bytes are valid until the
+ * image is closed and must not be modified. NULL is returned if the resource
+ * is compressed or the image is not memory mapped, in which case the bytes
+ * have to be copied with JImageGetResource.
+ *
+ * Ex.
+ *  jlong size;
+ *  JImageLocationRef location = (*JImageFindResource)(image,
+ *                               "java.base", "9.0", "java/lang/String.class", &size);
+ *  const char* bytes = (*JImageGetResourceAddress)(image, location);
+ */
+extern "C" JNIEXPORT const char*
+JIMAGE_GetResourceAddress(JImageFile* jimage, JImageLocationRef location);
+
+typedef const char*(*JImageGetResourceAddress_t)(JImageFile* jimage, JImageLocationRef location);
+
 
 /*
  * JImageResourceIterator - Given an open image file (see JImageOpen), a visitor
@@ -925,6 +925,19 @@ ZIP_Open(const char *name, char **pmsg)
     return file;
 }
 
+/*
+ * Advises the OS that the whole zip file will be read soon, so it can
+ * start reading the entry data ahead of the lookups that need it.
+ * This is only a hint and does nothing where it isn't supported.
+ */
+JNIEXPORT void
+ZIP_Prefetch(jzfile *zip)
+{
+#ifdef __linux__
+    posix_fadvise(zip->zfd, 0, (off_t) zip->len, POSIX_FADV_WILLNEED);
+#endif
+}
+
 /*
  * Closes the specified zip file object.
  */
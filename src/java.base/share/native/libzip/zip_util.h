@@ -268,6 +268,9 @@ ZIP_Put_In_Cache0(const char *name, ZFILE zfd, char **pmsg, jlong lastModified,
 JNIEXPORT void
 ZIP_Close(jzfile *zip);
 
+JNIEXPORT void
+ZIP_Prefetch(jzfile *zip);
+
 jzentry *
 ZIP_GetEntry(jzfile *zip, char *name, jint ulen);
 void
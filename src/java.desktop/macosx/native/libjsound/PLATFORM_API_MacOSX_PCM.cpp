@@ -29,7 +29,6 @@
 
 #include <AudioUnit/AudioUnit.h>
 #include <AudioToolbox/AudioConverter.h>
-#include <pthread.h>
 #include <math.h>
 /*
 #if !defined(__COREAUDIO_USE_FLAT_INCLUDES__)
@@ -187,14 +186,16 @@ void DAUDIO_GetFormats(INT32 mixerIndex, INT32 deviceID, int isSource, void* cre
 
 // ====
 /* 1writer-1reader ring buffer class with flush() support */
+// The buffer is lock-free: the writer owns nWritePos, the reader owns
+// nReadPos, and Flush() publishes nFlushPos for the reader to pick up.
+// So neither the CoreAudio callback nor the Java thread is ever blocked
+// by the other side.
 class RingBuffer {
 public:
     RingBuffer() : pBuffer(NULL), nBufferSize(0) {
-        pthread_mutex_init(&lockMutex, NULL);
     }
     ~RingBuffer() {
         Deallocate();
-        pthread_mutex_destroy(&lockMutex);
     }
 
     // extraBytes: number of additionally allocated bytes to prevent data
@@ -245,22 +246,24 @@ public:
 
     // gets number of bytes available for reading
     int GetValidByteCount() {
-        lock();
-        INT64 result = nWritePos - (nFlushPos >= 0 ? nFlushPos : nReadPos);
-        unlock();
+        // nWritePos is loaded last so that the result is never negative
+        INT64 startPos = loadStartPos();
+        INT64 result = load(&nWritePos) - startPos;
         return result > (INT64)nBufferSize ? nBufferSize : (int)result;
     }
 
     int Write(void *srcBuffer, int len, bool preventOverflow) {
-        lock();
         TRACE2("RingBuffer::Write (%d bytes, preventOverflow=%d)\n", len, preventOverflow ? 1 : 0);
         TRACE2("  writePos = %lld (%d)", (long long)nWritePos, Pos2Offset(nWritePos));
         TRACE2("  readPos=%lld (%d)", (long long)nReadPos, Pos2Offset(nReadPos));
         TRACE2("  flushPos=%lld (%d)\n", (long long)nFlushPos, Pos2Offset(nFlushPos));
 
+        // only the writer updates nWritePos
         INT64 writePos = nWritePos;
         if (preventOverflow) {
-            INT64 avail_read = writePos - (nFlushPos >= 0 ? nFlushPos : nReadPos);
+            // a concurrent Read() may make the start position stale,
+            // which only underestimates the free space
+            INT64 avail_read = writePos - loadStartPos();
             if (avail_read >= (INT64)nBufferSize) {
                 // no space
                 TRACE0("  preventOverlow: OVERFLOW => len = 0;\n");
@@ -273,38 +276,37 @@ public:
                 }
             }
         }
-        unlock();
 
         if (len > 0) {
 
             write((Byte *)srcBuffer, Pos2Offset(writePos), len);
 
-            lock();
             TRACE4("--RingBuffer::Write writePos: %lld (%d) => %lld, (%d)\n",
-                (long long)nWritePos, Pos2Offset(nWritePos), (long long)nWritePos + len, Pos2Offset(nWritePos + len));
-            nWritePos += len;
-            unlock();
+                (long long)writePos, Pos2Offset(writePos), (long long)writePos + len, Pos2Offset(writePos + len));
+            // publish the data to the reader
+            store(&nWritePos, writePos + len);
         }
         return len;
     }
 
     int Read(void *dstBuffer, int len) {
-        lock();
         TRACE1("RingBuffer::Read (%d bytes)\n", len);
         TRACE2("  writePos = %lld (%d)", (long long)nWritePos, Pos2Offset(nWritePos));
         TRACE2("  readPos=%lld (%d)", (long long)nReadPos, Pos2Offset(nReadPos));
         TRACE2("  flushPos=%lld (%d)\n", (long long)nFlushPos, Pos2Offset(nFlushPos));
 
         applyFlush();
-        INT64 avail_read = nWritePos - nReadPos;
+        // only the reader updates nReadPos
+        INT64 readPos = nReadPos;
+        INT64 writePos = load(&nWritePos);
+        INT64 avail_read = writePos - readPos;
         // check for overflow
         if (avail_read > (INT64)nBufferSize) {
-            nReadPos = nWritePos - nBufferSize;
+            readPos = writePos - nBufferSize;
+            store(&nReadPos, readPos);
             avail_read = nBufferSize;
             TRACE0("  OVERFLOW\n");
         }
-        INT64 readPos = nReadPos;
-        unlock();
 
         if (len > (int)avail_read) {
             TRACE2("  RingBuffer::Read - don't have enough data, len: %d => %d\n", len, (int)avail_read);
@@ -315,17 +317,16 @@ public:
 
             read((Byte *)dstBuffer, Pos2Offset(readPos), len);
 
-            lock();
             if (applyFlush()) {
                 // just got flush(), results became obsolete
                 TRACE0("--RingBuffer::Read, got Flush, return 0\n");
                 len = 0;
             } else {
                 TRACE4("--RingBuffer::Read readPos: %lld (%d) => %lld (%d)\n",
-                    (long long)nReadPos, Pos2Offset(nReadPos), (long long)nReadPos + len, Pos2Offset(nReadPos + len));
-                nReadPos += len;
+                    (long long)readPos, Pos2Offset(readPos), (long long)readPos + len, Pos2Offset(readPos + len));
+                // release the space to the writer
+                store(&nReadPos, readPos + len);
             }
-            unlock();
         } else {
             // underrun!
         }
@@ -334,10 +335,10 @@ public:
 
     // returns number of the flushed bytes
     int Flush() {
-        lock();
-        INT64 flushedBytes = nWritePos - (nFlushPos >= 0 ? nFlushPos : nReadPos);
-        nFlushPos = nWritePos;
-        unlock();
+        INT64 startPos = loadStartPos();
+        INT64 writePos = load(&nWritePos);
+        store(&nFlushPos, writePos);
+        INT64 flushedBytes = writePos - startPos;
         return flushedBytes > (INT64)nBufferSize ? nBufferSize : (int)flushedBytes;
     }
 
@@ -347,25 +348,31 @@ private:
     int nAllocatedBytes;
     INT64 nPosMask;
 
-    pthread_mutex_t lockMutex;
-
     volatile INT64 nWritePos;
     volatile INT64 nReadPos;
     // Flush() sets nFlushPos value to nWritePos;
     // next Read() sets nReadPos to nFlushPos and resests nFlushPos to -1
     volatile INT64 nFlushPos;
 
-    inline void lock() {
-        pthread_mutex_lock(&lockMutex);
+    static inline INT64 load(volatile INT64 *pos) {
+        return __atomic_load_n(pos, __ATOMIC_ACQUIRE);
     }
-    inline void unlock() {
-        pthread_mutex_unlock(&lockMutex);
+    static inline void store(volatile INT64 *pos, INT64 value) {
+        __atomic_store_n(pos, value, __ATOMIC_RELEASE);
+    }
+
+    // position of the first byte available for reading;
+    // nFlushPos must be loaded first, see applyFlush()
+    inline INT64 loadStartPos() {
+        INT64 flushPos = load(&nFlushPos);
+        return flushPos >= 0 ? flushPos : load(&nReadPos);
     }
 
+    // called by the reader only
     inline bool applyFlush() {
-        if (nFlushPos >= 0) {
-            nReadPos = nFlushPos;
-            nFlushPos = -1;
+        INT64 flushPos = __atomic_exchange_n(&nFlushPos, (INT64)-1, __ATOMIC_ACQ_REL);
+        if (flushPos >= 0) {
+            store(&nReadPos, flushPos);
             return true;
         }
         return false;
@@ -580,6 +580,20 @@ JNIEXPORT void JNICALL Java_com_sun_media_sound_DirectAudioDevice_nClose
 #endif
 }
 
+#if X_PLATFORM == X_MACOSX
+/* DAUDIO_Write() only copies the data into a non-blocking ring buffer,
+ * so the Java array can be accessed directly instead of being copied. */
+#define GET_WRITE_DATA(env, array, isCopy) \
+    ((*env)->GetPrimitiveArrayCritical(env, array, isCopy))
+#define RELEASE_WRITE_DATA(env, array, data) \
+    ((*env)->ReleasePrimitiveArrayCritical(env, array, data, JNI_ABORT))
+#else
+#define GET_WRITE_DATA(env, array, isCopy) \
+    ((*env)->GetByteArrayElements(env, array, isCopy))
+#define RELEASE_WRITE_DATA(env, array, data) \
+    ((*env)->ReleaseByteArrayElements(env, array, (jbyte*) data, JNI_ABORT))
+#endif
+
 /*
  * Class:     com_sun_media_sound_DirectAudioDevice
  * Method:    nWrite
@@ -603,7 +617,7 @@ JNIEXPORT jint JNICALL Java_com_sun_media_sound_DirectAudioDevice_nWrite
     }
     if (len == 0) return 0;
     if (info && info->handle) {
-        data = (UINT8*) ((*env)->GetByteArrayElements(env, jData, &didCopy));
+        data = (UINT8*) GET_WRITE_DATA(env, jData, &didCopy);
         CHECK_NULL_RETURN(data, ret);
         dataOffset = data;
         dataOffset += (int) offset;
@@ -623,7 +637,7 @@ JNIEXPORT jint JNICALL Java_com_sun_media_sound_DirectAudioDevice_nWrite
                     info->conversionBuffer = (UINT8*) malloc(len);
                     if (!info->conversionBuffer) {
                         // do not commit the native array
-                        (*env)->ReleaseByteArrayElements(env, jData, (jbyte*) data, JNI_ABORT);
+                        RELEASE_WRITE_DATA(env, jData, data);
                         return -1;
                     }
                     info->conversionBufferSize = len;
@@ -647,7 +661,7 @@ JNIEXPORT jint JNICALL Java_com_sun_media_sound_DirectAudioDevice_nWrite
         ret = DAUDIO_Write(info->handle, (INT8*) convertedData, (int) len);
 
         // do not commit the native array
-        (*env)->ReleaseByteArrayElements(env, jData, (jbyte*) data, JNI_ABORT);
+        RELEASE_WRITE_DATA(env, jData, data);
     }
 #endif
     return (jint) ret;
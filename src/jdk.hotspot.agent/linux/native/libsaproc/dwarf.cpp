@@ -23,6 +23,7 @@
  *
  */
 
+#include <cstdlib>
 #include <cstring>
 
 #include "dwarf.hpp"
@@ -289,41 +290,132 @@ unsigned int DwarfParser::get_pc_range() {
   return static_cast<unsigned int>(result);
 }
 
-bool DwarfParser::process_dwarf(const uintptr_t pc) {
+static int compare_fde(const void *a, const void *b) {
+  uintptr_t pc_a = reinterpret_cast<const eh_frame_fde *>(a)->pc_begin;
+  uintptr_t pc_b = reinterpret_cast<const eh_frame_fde *>(b)->pc_begin;
+  return (pc_a < pc_b) ? -1 : ((pc_a > pc_b) ? 1 : 0);
+}
+
+// Walks .eh_frame once and records the PC range of every FDE, sorted by
+// start address, in the lib_info so that all parsers for this library
+// can look up a PC with a binary search instead of a linear scan.
+bool DwarfParser::build_fde_index() {
   // https://refspecs.linuxfoundation.org/LSB_3.0.0/LSB-PDA/LSB-PDA/ehframechpt.html
-  _buf = _lib->eh_frame.data;
   unsigned char *end = _lib->eh_frame.data + _lib->eh_frame.size;
+  int capacity = 0;
+
+  // Count entries first to size the index.
+  _buf = _lib->eh_frame.data;
   while (_buf <= end) {
     uint64_t length = get_entry_length();
     if (length == 0L) {
-      return false;
+      break;
+    }
+    if (*(reinterpret_cast<uint32_t *>(_buf)) != 0) {
+      capacity++;
+    }
+    _buf += length;
+  }
+  if (capacity == 0) {
+    return false;
+  }
+
+  eh_frame_fde *fdes = static_cast<eh_frame_fde *>(malloc(capacity * sizeof(eh_frame_fde)));
+  if (fdes == NULL) {
+    print_debug("can't allocate FDE index for %s\n", _lib->name);
+    return false;
+  }
+
+  int num_fdes = 0;
+  unsigned char *current_cie = NULL;
+  bool cie_usable = false;
+  _buf = _lib->eh_frame.data;
+  while (_buf <= end && num_fdes < capacity) {
+    unsigned char *entry = _buf;
+    uint64_t length = get_entry_length();
+    if (length == 0L) {
+      break;
     }
     unsigned char *next_entry = _buf + length;
     unsigned char *start_of_entry = _buf;
     uint32_t id = *(reinterpret_cast<uint32_t *>(_buf));
     _buf += 4;
     if (id != 0) { // FDE
-      uintptr_t pc_begin = get_decoded_value() + _lib->eh_frame.library_base_addr;
-      uintptr_t pc_end = pc_begin + get_pc_range();
+      // Pick up the pointer encoding of the CIE this FDE belongs to.
+      // FDEs usually share the CIE of their neighbours.
+      if (start_of_entry - id != current_cie) {
+        current_cie = start_of_entry - id;
+        cie_usable = process_cie(start_of_entry, id);
+      }
+      // FDEs whose CIE can't be processed can't be unwound either.
+      if (cie_usable) {
+        uintptr_t pc_begin = get_decoded_value() + _lib->eh_frame.library_base_addr;
+        uintptr_t pc_end = pc_begin + get_pc_range();
+        fdes[num_fdes].pc_begin = pc_begin;
+        fdes[num_fdes].pc_end = pc_end;
+        fdes[num_fdes].entry = entry;
+        num_fdes++;
+      }
+    }
+    _buf = next_entry;
+  }
 
-      if ((pc >= pc_begin) && (pc < pc_end)) {
-        // Process CIE
-        if (!process_cie(start_of_entry, id)) {
-          return false;
-        }
+  qsort(fdes, num_fdes, sizeof(eh_frame_fde), compare_fde);
+  _lib->eh_frame.fdes = fdes;
+  _lib->eh_frame.num_fdes = num_fdes;
+  return true;
+}
 
-        // Skip Augumenation
-        uintptr_t augmentation_length = read_leb(false);
-        _buf += augmentation_length; // skip
+const eh_frame_fde *DwarfParser::find_fde(uintptr_t pc) {
+  if (_lib->eh_frame.fdes == NULL && !build_fde_index()) {
+    return NULL;
+  }
 
-        // Process FDE
-        parse_dwarf_instructions(pc_begin, pc, next_entry);
-        return true;
-      }
+  // Find the last FDE starting at or below pc.
+  const eh_frame_fde *fdes = _lib->eh_frame.fdes;
+  int lo = 0;
+  int hi = _lib->eh_frame.num_fdes;
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (fdes[mid].pc_begin <= pc) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
+  }
+  if (lo == 0 || pc >= fdes[lo - 1].pc_end) {
+    return NULL;
+  }
+  return &fdes[lo - 1];
+}
 
-    _buf = next_entry;
+bool DwarfParser::process_dwarf(const uintptr_t pc) {
+  const eh_frame_fde *fde = find_fde(pc);
+  if (fde == NULL) {
+    return false;
   }
 
-  return false;
+  _buf = fde->entry;
+  uint64_t length = get_entry_length();
+  unsigned char *next_entry = _buf + length;
+  unsigned char *start_of_entry = _buf;
+  uint32_t id = *(reinterpret_cast<uint32_t *>(_buf));
+  _buf += 4;
+
+  // Process CIE
+  if (!process_cie(start_of_entry, id)) {
+    return false;
+  }
+
+  // Skip PC begin and range, they are known from the index
+  get_decoded_value();
+  get_pc_range();
+
+  // Skip Augumenation
+  uintptr_t augmentation_length = read_leb(false);
+  _buf += augmentation_length; // skip
+
+  // Process FDE
+  parse_dwarf_instructions(fde->pc_begin, pc, next_entry);
+  return true;
 }
@@ -34,12 +34,21 @@
 
 #define BUF_SIZE     (PATH_MAX + NAME_MAX + 1)
 
+// FDE in .eh_frame, covering [pc_begin, pc_end)
+typedef struct eh_frame_fde {
+  uintptr_t pc_begin;
+  uintptr_t pc_end;
+  unsigned char* entry;   // start of the FDE (its length field) in data
+} eh_frame_fde;
+
 // .eh_frame data
 typedef struct eh_frame_info {
   uintptr_t library_base_addr;
   uintptr_t v_addr;
   unsigned char* data;
   int size;
+  eh_frame_fde* fdes;     // FDEs sorted by pc_begin, built on first lookup
+  int num_fdes;
 } eh_frame_info;
 
 // list of shared objects
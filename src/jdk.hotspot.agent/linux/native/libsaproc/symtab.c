@@ -46,6 +46,10 @@ typedef struct symtab {
   size_t num_symbols;
   struct elf_symbol *symbols;
   struct hsearch_data *hash_table;
+  // named symbols sorted by offset, built on first address lookup
+  struct elf_symbol **sorted_symbols;
+  size_t num_sorted_symbols;
+  uintptr_t max_symbol_size;
 } symtab_t;
 
 
@@ -523,6 +527,7 @@ void destroy_symtab(struct symtab* symtab) {
   if (!symtab) return;
   if (symtab->strs) free(symtab->strs);
   if (symtab->symbols) free(symtab->symbols);
+  if (symtab->sorted_symbols) free(symtab->sorted_symbols);
   if (symtab->hash_table) {
      hdestroy_r(symtab->hash_table);
      free(symtab->hash_table);
@@ -555,17 +560,74 @@ quit:
   return (uintptr_t) NULL;
 }
 
+static int compare_symbol_offset(const void* a, const void* b) {
+  const struct elf_symbol* sym_a = *(const struct elf_symbol**)a;
+  const struct elf_symbol* sym_b = *(const struct elf_symbol**)b;
+  if (sym_a->offset != sym_b->offset) {
+    return (sym_a->offset < sym_b->offset) ? -1 : 1;
+  }
+  // keep symbol table order for symbols at the same offset
+  return (sym_a < sym_b) ? -1 : ((sym_a > sym_b) ? 1 : 0);
+}
+
+// build an index of the symbols sorted by offset so that address lookups
+// do not have to scan the whole symbol table.
+static bool build_sorted_symbols(struct symtab* symtab) {
+  size_t n, count = 0;
+  symtab->sorted_symbols = (struct elf_symbol**)calloc(symtab->num_symbols + 1,
+                                                       sizeof(struct elf_symbol*));
+  if (symtab->sorted_symbols == NULL) {
+    return false;
+  }
+  for (n = 0; n < symtab->num_symbols; n++) {
+    struct elf_symbol* sym = &(symtab->symbols[n]);
+    if (sym->name != NULL && sym->size != 0) {
+      symtab->sorted_symbols[count++] = sym;
+      if (sym->size > symtab->max_symbol_size) {
+        symtab->max_symbol_size = sym->size;
+      }
+    }
+  }
+  qsort(symtab->sorted_symbols, count, sizeof(struct elf_symbol*), compare_symbol_offset);
+  symtab->num_sorted_symbols = count;
+  return true;
+}
+
 const char* nearest_symbol(struct symtab* symtab, uintptr_t offset,
                            uintptr_t* poffset) {
-  int n = 0;
+  struct elf_symbol* found = NULL;
+  size_t lo, hi;
   if (!symtab) return NULL;
-  for (; n < symtab->num_symbols; n++) {
-     struct elf_symbol* sym = &(symtab->symbols[n]);
-     if (sym->name != NULL &&
-         offset >= sym->offset && offset < sym->offset + sym->size) {
-        if (poffset) *poffset = (offset - sym->offset);
-        return sym->name;
-     }
+  if (symtab->sorted_symbols == NULL && !build_sorted_symbols(symtab)) {
+    return NULL;
   }
-  return NULL;
+
+  // find the first symbol starting above offset
+  lo = 0;
+  hi = symtab->num_sorted_symbols;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (symtab->sorted_symbols[mid]->offset <= offset) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  // symbols below it may overlap offset, but none can start more than the
+  // largest symbol size away. return the one that comes first in the
+  // symbol table, as the linear search did.
+  while (lo > 0) {
+    struct elf_symbol* sym = symtab->sorted_symbols[--lo];
+    if (offset - sym->offset >= symtab->max_symbol_size) {
+      break;
+    }
+    if (offset < sym->offset + sym->size && (found == NULL || sym < found)) {
+      found = sym;
+    }
+  }
+
+  if (found == NULL) return NULL;
+  if (poffset) *poffset = (offset - found->offset);
+  return found->name;
 }
@@ -24,6 +24,9 @@
  */
 
 #include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iterator>
 #include "AppLauncher.h"
 #include "JvmLauncher.h"
 #include "CfgFile.h"
@@ -32,6 +35,7 @@
 #include "Toolbox.h"
 #include "SysInfo.h"
 #include "FileUtils.h"
+#include "ErrorHandling.h"
 
 
 AppLauncher::AppLauncher() {
@@ -89,6 +93,148 @@ tstring findJvmLib(const CfgFile& cfgFile, const tstring& defaultRuntimePath,
 
     return FileUtils::mkpath() << runtimePath << *jvmLibNameEntry;
 }
+
+
+std::string readFile(const tstring& path) {
+    std::ifstream in(path.c_str(), std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in),
+            std::istreambuf_iterator<char>());
+}
+
+
+std::streamoff getFileSize(const tstring& path) {
+    std::ifstream in(path.c_str(), std::ios::binary | std::ios::ate);
+    return in ? std::streamoff(in.tellg()) : std::streamoff(-1);
+}
+
+
+tstring getUserCacheDir() {
+#ifdef _WIN32
+    return SysInfo::getEnvVariable(std::nothrow, _T("LOCALAPPDATA"));
+#else
+    const tstring home = SysInfo::getEnvVariable(std::nothrow, _T("HOME"));
+#ifdef __APPLE__
+    if (home.empty()) {
+        return tstring();
+    }
+    return FileUtils::mkpath() << home << _T("Library/Caches");
+#else
+    const tstring xdgCacheHome = SysInfo::getEnvVariable(std::nothrow,
+            _T("XDG_CACHE_HOME"));
+    if (!xdgCacheHome.empty()) {
+        return xdgCacheHome;
+    }
+    if (home.empty()) {
+        return tstring();
+    }
+    return FileUtils::mkpath() << home << _T(".cache");
+#endif
+#endif
+}
+
+
+bool hasCdsOption(const CfgFile& cfgFile) {
+    const CfgFile::Properties& section = cfgFile.getProperties(
+            SectionName::JavaOptions);
+    const CfgFile::Properties::const_iterator javaOptions = section.find(
+            PropertyName::javaOptions);
+    if (javaOptions == section.end()) {
+        return false;
+    }
+    tstring_array::const_iterator it = javaOptions->second.begin();
+    const tstring_array::const_iterator end = javaOptions->second.end();
+    for (; it != end; ++it) {
+        if (tstrings::startsWith(*it, _T("-Xshare:"))
+                || tstrings::startsWith(*it, _T("-XX:SharedArchiveFile="))
+                || tstrings::startsWith(*it, _T("-XX:ArchiveClassesAtExit="))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * Returns JVM option to use or create dynamic CDS archive for the app if
+ * "app.cds" property is set to "auto" in the config file.
+ * Returns empty string if the archive should not be used.
+ *
+ * The archive is kept in the per-user cache directory. Its name is keyed on
+ * the contents of the config file and on the runtime image, so that
+ * updates of either make the launcher create a new archive on the next run.
+ */
+tstring getCdsArchiveOption(const CfgFile& cfgFile,
+        const tstring& cfgFilePath, const tstring& appName,
+        const tstring& jvmLibPath) {
+    const CfgFile::Properties& appOptions = cfgFile.getProperties(
+            SectionName::Application);
+    const CfgFile::Properties::const_iterator cdsProp = appOptions.find(
+            PropertyName::cds);
+    if (cdsProp == appOptions.end()
+            || CfgFile::asString(*cdsProp) != _T("auto")) {
+        return tstring();
+    }
+
+    if (hasCdsOption(cfgFile)) {
+        LOG_TRACE(tstrings::any() << "Property \"" << PropertyName::cds.name()
+                << "\" ignored. CDS is configured with java options");
+        return tstring();
+    }
+
+    // Dynamic archive is layered on top of the default CDS archive of the
+    // runtime. It is in "server" directory next to the JLI library,
+    // i.e. in "lib/server" or "bin/server" directory of the runtime.
+    tstring libDir = FileUtils::dirname(jvmLibPath);
+    if (FileUtils::basename(libDir) == _T("jli")) {
+        libDir = FileUtils::dirname(libDir);
+    }
+    const tstring baseArchivePath = FileUtils::mkpath() << libDir
+            << _T("server") << _T("classes.jsa");
+    if (!FileUtils::isFileExists(baseArchivePath)) {
+        LOG_TRACE(tstrings::any() << "Property \"" << PropertyName::cds.name()
+                << "\" ignored. Default CDS archive \""
+                << baseArchivePath << "\" not found");
+        return tstring();
+    }
+
+    const tstring cacheDir = getUserCacheDir();
+    if (cacheDir.empty()) {
+        LOG_TRACE(tstrings::any() << "Property \"" << PropertyName::cds.name()
+                << "\" ignored. User cache directory not found");
+        return tstring();
+    }
+
+    const tstring releaseFilePath = FileUtils::mkpath()
+            << FileUtils::dirname(libDir) << _T("release");
+    const std::string key = readFile(cfgFilePath) + "|"
+            + readFile(releaseFilePath) + "|"
+            + (tstrings::any() << jvmLibPath
+                    << _T("|") << getFileSize(jvmLibPath)
+                    << _T("|") << getFileSize(baseArchivePath)).str();
+
+    const tstring archiveDir = FileUtils::mkpath() << cacheDir << appName
+            << _T("cds");
+    const tstring archivePath = FileUtils::mkpath() << archiveDir
+            << (tstrings::any() << appName << _T("-")
+                    << std::hex << std::hash<std::string>()(key)
+                    << _T(".jsa")).tstr();
+
+    if (FileUtils::isFileExists(archivePath)) {
+        LOG_TRACE(tstrings::any() << "Using CDS archive \""
+                << archivePath << "\"");
+        return _T("-XX:SharedArchiveFile=") + archivePath;
+    }
+
+    JP_TRY;
+    FileUtils::createDirectory(archiveDir);
+    LOG_TRACE(tstrings::any() << "Creating CDS archive \""
+            << archivePath << "\" at exit");
+    return _T("-XX:ArchiveClassesAtExit=") + archivePath;
+    JP_CATCH_ALL;
+
+    return tstring();
+}
+
 } // namespace
 
 Jvm* AppLauncher::createJvmLauncher() const {
@@ -117,8 +263,11 @@ Jvm* AppLauncher::createJvmLauncher() const {
 
     std::unique_ptr<Jvm> jvm(new Jvm());
 
+    const tstring jvmLibPath = findJvmLib(cfgFile, defaultRuntimePath,
+            jvmLibNames);
+
     (*jvm)
-        .setPath(findJvmLib(cfgFile, defaultRuntimePath, jvmLibNames))
+        .setPath(jvmLibPath)
         .addArgument(launcherPath);
 
     if (initJvmFromCmdlineOnly) {
@@ -128,6 +277,12 @@ Jvm* AppLauncher::createJvmLauncher() const {
             (*jvm).addArgument(*argIt);
         }
     } else {
+        const tstring cdsArchiveOption = getCdsArchiveOption(cfgFile,
+                cfgFilePath, FileUtils::stripExeSuffix(
+                        FileUtils::basename(launcherPath)), jvmLibPath);
+        if (!cdsArchiveOption.empty()) {
+            (*jvm).addArgument(cdsArchiveOption);
+        }
         (*jvm).initFromConfigFile(cfgFile);
     }
 
@@ -274,6 +274,7 @@ namespace {
     JP_PROPERTY(runtime, "app.runtime"); \
     JP_PROPERTY(splash, "app.splash"); \
     JP_PROPERTY(memory, "app.memory"); \
+    JP_PROPERTY(cds, "app.cds"); \
     JP_PROPERTY(arguments, "arguments"); \
     JP_PROPERTY(javaOptions, "java-options"); \
 
@@ -124,6 +124,7 @@ namespace PropertyName {
     extern const CfgFile::PropertyName runtime;
     extern const CfgFile::PropertyName splash;
     extern const CfgFile::PropertyName memory;
+    extern const CfgFile::PropertyName cds;
     extern const CfgFile::PropertyName arguments;
     extern const CfgFile::PropertyName javaOptions;
 } // namespace AppPropertyName
@@ -122,6 +122,12 @@ namespace FileUtils {
     // it contains at least one file other than "." or "..".
     bool isDirectoryNotEmpty(const tstring &dirPath);
 
+    // Creates directory and subdirectories if don't exist.
+    // On Windows currently supports only "standard" path like "c:\bla-bla"
+    // If 'createdDirs' parameter is not NULL, the given array is appended with
+    // all subdirectories created by this function call.
+    void createDirectory(const tstring &path, tstring_array* createdDirs=0);
+
 } // FileUtils
 
 #endif // FILEUTILS_H
@@ -24,6 +24,7 @@
  */
 
 
+#include <errno.h>
 #include <limits.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -39,6 +40,25 @@ bool isFileExists(const tstring &filePath) {
 }
 
 
+void createDirectory(const tstring &path, tstring_array* createdDirs) {
+    const tstring dirPath = removeTrailingSlash(path) + _T("/");
+
+    tstring::size_type pos = dirPath.find_first_of(_T("/"), 1);
+    while (pos != tstring::npos) {
+        const tstring subdirPath = dirPath.substr(0, pos);
+        if (mkdir(subdirPath.c_str(), 0755) == 0) {
+            if (createdDirs) {
+                createdDirs->push_back(subdirPath);
+            }
+        } else if (errno != EEXIST) {
+            JP_THROW(tstrings::any() << "mkdir(" << subdirPath
+                    << ") failed. Error: " << lastCRTError());
+        }
+        pos = dirPath.find_first_of(_T("/"), pos + 1);
+    }
+}
+
+
 tstring toAbsolutePath(const tstring& path) {
     if (path.empty()) {
         char buffer[PATH_MAX] = { 0 };
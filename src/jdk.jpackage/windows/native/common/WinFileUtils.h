@@ -57,12 +57,6 @@ namespace FileUtils {
     // created file is unique.
     tstring createUniqueFile(const tstring &prototype);
 
-    // Creates directory and subdirectories if don't exist.
-    // Currently supports only "standard" path like "c:\bla-bla"
-    // If 'createdDirs' parameter is not NULL, the given array is appended with
-    // all subdirectories created by this function call.
-    void createDirectory(const tstring &path, tstring_array* createdDirs=0);
-
     // copies file from fromPath to toPath.
     // Creates output directory if doesn't exist.
     void copyFile(const tstring& fromPath, const tstring& toPath,
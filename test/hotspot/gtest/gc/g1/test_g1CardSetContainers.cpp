@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CardSetContainers.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "unittest.hpp"
+
+class G1CardSetInlinePtrTest : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+    // If G1 is in use the layout has already been set up by the heap and
+    // must not be changed.
+    if (G1CardSetInlinePtr::max_cards() == 0) {
+      G1CardSetInlinePtr::initialize(11 /* log_cards_per_region */, UINT_MAX);
+    }
+  }
+
+  static uint card_for(uint i) {
+    uint max_card = (1u << G1CardSetInlinePtr::bits_per_card()) - 1;
+    return (i * 37 + 1) & max_card;
+  }
+};
+
+class G1CountCardsClosure : public StackObj {
+public:
+  uint _num_found;
+  uint _sum;
+
+  G1CountCardsClosure() : _num_found(0), _sum(0) { }
+
+  void operator()(uint card_idx) {
+    _num_found++;
+    _sum += card_idx;
+  }
+};
+
+TEST_VM_F(G1CardSetInlinePtrTest, add_and_contains) {
+  uintptr_t volatile value = 0;
+  uint const max_cards = G1CardSetInlinePtr::max_cards();
+  ASSERT_GT(max_cards, 0u);
+  ASSERT_LE(max_cards, (uint)G1CardSetInlinePtr::MaxCardsLimit);
+
+  uint sum = 0;
+  for (uint i = 0; i < max_cards; i++) {
+    G1CardSetInlinePtr cards(&value);
+    ASSERT_EQ(G1CardSetInlinePtr::Added, cards.add(card_for(i)));
+    ASSERT_EQ(G1CardSetInlinePtr::Found, cards.add(card_for(i)));
+    ASSERT_TRUE(cards.contains(card_for(i)));
+    sum += card_for(i);
+  }
+  ASSERT_EQ(max_cards, G1CardSetInlinePtr::num_cards_in(value));
+
+  G1CardSetInlinePtr cards(&value);
+  for (uint i = 0; i < max_cards; i++) {
+    ASSERT_EQ(G1CardSetInlinePtr::Found, cards.add(card_for(i)));
+  }
+  ASSERT_EQ(G1CardSetInlinePtr::Overflow, cards.add(card_for(max_cards)));
+  ASSERT_FALSE(cards.contains(card_for(max_cards)));
+
+  G1CountCardsClosure cl;
+  G1CardSetInlinePtr::iterate(value, cl);
+  ASSERT_EQ(max_cards, cl._num_found);
+  ASSERT_EQ(sum, cl._sum);
+}
+
+TEST_VM_F(G1CardSetInlinePtrTest, mark_overflowed) {
+  uintptr_t volatile value = 0;
+  G1CardSetInlinePtr cards(&value);
+  ASSERT_EQ(G1CardSetInlinePtr::Added, cards.add(card_for(0)));
+  ASSERT_FALSE(G1CardSetInlinePtr::is_overflowed(value));
+
+  uintptr_t old_value = cards.mark_overflowed();
+  ASSERT_TRUE(G1CardSetInlinePtr::is_overflowed(value));
+  ASSERT_FALSE(G1CardSetInlinePtr::is_overflowed(old_value));
+  ASSERT_EQ(1u, G1CardSetInlinePtr::num_cards_in(old_value));
+  ASSERT_EQ(0u, G1CardSetInlinePtr::num_cards_in(value));
+
+  // Overflowed containers do not accept or report any cards.
+  G1CardSetInlinePtr reread(&value);
+  ASSERT_EQ(G1CardSetInlinePtr::Overflow, reread.add(card_for(0)));
+  ASSERT_EQ(G1CardSetInlinePtr::Overflow, reread.add(card_for(1)));
+  ASSERT_FALSE(reread.contains(card_for(0)));
+
+  // Marking again is idempotent.
+  ASSERT_TRUE(G1CardSetInlinePtr::is_overflowed(reread.mark_overflowed()));
+}
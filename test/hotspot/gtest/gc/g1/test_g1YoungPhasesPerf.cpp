@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "classfile/vmClasses.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1GCPhaseTimes.hpp"
+#include "gc/shared/gcCause.hpp"
+#include "gc/shared/workgroup.hpp"
+#include "memory/oopFactory.hpp"
+#include "memory/universe.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/objArrayOop.inline.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/ostream.hpp"
+#include "unittest.hpp"
+
+// This "test" doesn't really verify much.  Rather, it's a harness for
+// timing individual phases of G1 young collections on synthetic heap
+// shapes.  It builds old object arrays, stores references to new young
+// objects into them with a given stride so that the post barrier dirties
+// a controlled number of cards, runs young collections and prints the
+// average per-worker time of the remembered set merge, card scan, object
+// copy and termination phases.
+
+class G1YoungPhasesPerf : public ::testing::Test {
+public:
+  static const int _num_arrays = 64;
+  static const int _array_length = 16 * K;
+  static const int _collections = 5;
+
+  static void print_phases(const char* shape, int stride, int collection);
+  static void run_shape(JavaThread* thread, const char* shape, int stride);
+};
+
+void G1YoungPhasesPerf::print_phases(const char* shape, int stride, int collection) {
+  static const G1GCPhaseTimes::GCParPhases phases[] = {
+    G1GCPhaseTimes::MergeRS,
+    G1GCPhaseTimes::MergeLB,
+    G1GCPhaseTimes::MergeHCC,
+    G1GCPhaseTimes::ScanHR,
+    G1GCPhaseTimes::ObjCopy,
+    G1GCPhaseTimes::Termination,
+    G1GCPhaseTimes::GCWorkerTotal
+  };
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  G1GCPhaseTimes* times = g1h->phase_times();
+  tty->print("%s stride %d collection %d (%u workers):", shape, stride, collection,
+             g1h->workers()->active_workers());
+  for (size_t i = 0; i < ARRAY_SIZE(phases); i++) {
+    tty->print(" %s %.3fms", G1GCPhaseTimes::phase_name(phases[i]),
+               times->average_time_ms(phases[i]));
+  }
+  tty->cr();
+}
+
+void G1YoungPhasesPerf::run_shape(JavaThread* THREAD, const char* shape, int stride) {
+  HandleMark hm(THREAD);
+  InstanceKlass* object_klass = vmClasses::Object_klass();
+
+  objArrayOop outer = oopFactory::new_objArray(object_klass, _num_arrays, THREAD);
+  ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+  objArrayHandle arrays(THREAD, outer);
+  for (int i = 0; i < _num_arrays; i++) {
+    objArrayOop array = oopFactory::new_objArray(object_klass, _array_length, THREAD);
+    ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+    arrays->obj_at_put(i, array);
+  }
+  // Move the arrays into old regions.
+  Universe::heap()->collect(GCCause::_wb_full_gc);
+
+  for (int c = 0; c < _collections; c++) {
+    // Fresh young objects, reachable only through the old arrays.
+    for (int i = 0; i < _num_arrays; i++) {
+      for (int j = 0; j < _array_length; j += stride) {
+        instanceOop obj = object_klass->allocate_instance(THREAD);
+        ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+        objArrayOop(arrays->obj_at(i))->obj_at_put(j, obj);
+      }
+    }
+    Universe::heap()->collect(GCCause::_wb_young_gc);
+    print_phases(shape, stride, c);
+  }
+}
+
+TEST_VM_F(G1YoungPhasesPerf, old_to_young) {
+  if (!UseG1GC) {
+    return;
+  }
+  JavaThread* thread = JavaThread::current();
+  ThreadInVMfromNative invm(thread);
+  run_shape(thread, "dense", 1);
+  run_shape(thread, "one per card", (int)(G1CardTable::card_size / heapOopSize));
+  run_shape(thread, "sparse", 1024);
+}
@@ -861,6 +861,92 @@ TEST_VM_F(OopStorageTestIteration, oops_do) {
   vstate.check();
 }
 
+class OopStorageTestYoungIteration : public OopStorageTestWithAllocation {
+public:
+  class IsYoungClosure;
+  class VM_YoungOopsDo;
+
+  OopStorageTestYoungIteration();
+
+  intptr_t _young_value;
+  intptr_t _old_value;
+  oop young_oop() { return reinterpret_cast<oopDesc*>(&_young_value); }
+  oop old_oop() { return reinterpret_cast<oopDesc*>(&_old_value); }
+
+  size_t young_iteration_count();
+};
+
+OopStorageTestYoungIteration::OopStorageTestYoungIteration() :
+  _young_value(0), _old_value(0)
+{
+  for (size_t i = 0; i < _max_entries; ++i) {
+    *_entries[i] = old_oop();
+  }
+  *_entries[0] = young_oop();
+}
+
+class OopStorageTestYoungIteration::IsYoungClosure {
+public:
+  oop _young;
+
+  IsYoungClosure(oop young) : _young(young) {}
+  bool do_object_b(oop obj) const { return obj == _young; }
+};
+
+class OopStorageTestYoungIteration::VM_YoungOopsDo : public VM_GTestExecuteAtSafepoint {
+public:
+  VM_YoungOopsDo(OopStorage* storage, IsYoungClosure* is_young, CountingIterateClosure* cl) :
+    _storage(storage), _is_young(is_young), _cl(cl)
+  {}
+
+  void doit() { _storage->young_oops_do(_is_young, _cl); }
+
+private:
+  OopStorage* _storage;
+  IsYoungClosure* _is_young;
+  CountingIterateClosure* _cl;
+};
+
+size_t OopStorageTestYoungIteration::young_iteration_count() {
+  IsYoungClosure is_young(young_oop());
+  CountingIterateClosure cl;
+  VM_YoungOopsDo op(&_storage, &is_young, &cl);
+  {
+    ThreadInVMfromNative invm(JavaThread::current());
+    VMThread::execute(&op);
+  }
+  return cl._non_const_count;
+}
+
+TEST_VM_F(OopStorageTestYoungIteration, young_oops_do) {
+  // All blocks have had entries allocated, so all are visited.
+  EXPECT_EQ(_max_entries, young_iteration_count());
+
+  // Only the block with the young entry is visited again.
+  const ActiveArray& ba = TestAccess::active_array(_storage);
+  const OopBlock* young_block = NULL;
+  for (size_t i = 0; i < ba.block_count(); ++i) {
+    if (ba.at(i)->contains(_entries[0])) {
+      young_block = ba.at(i);
+    }
+  }
+  ASSERT_NE(NULL_BLOCK, young_block);
+  size_t young_block_count = TestAccess::block_allocation_count(*young_block);
+  EXPECT_EQ(young_block_count, young_iteration_count());
+
+  // Once the young entry has become old, no block is visited.
+  *_entries[0] = old_oop();
+  EXPECT_EQ(young_block_count, young_iteration_count());
+  EXPECT_EQ(0u, young_iteration_count());
+
+  // Allocating an entry makes its block visited again.
+  oop* entry = _storage.allocate();
+  ASSERT_TRUE(entry != NULL);
+  EXPECT_LT(0u, young_iteration_count());
+  EXPECT_EQ(0u, young_iteration_count());
+  release_entry(_storage, entry);
+}
+
 class OopStorageTestParIteration : public OopStorageTestIteration {
 public:
   WorkGang* workers();
@@ -97,3 +97,34 @@ TEST_VM(PreservedMarks, iterate_and_restore) {
   ASSERT_MARK_WORD_EQ(o3.mark(), FakeOop::changedMark());
   ASSERT_MARK_WORD_EQ(o4.mark(), FakeOop::changedMark());
 }
+
+TEST_VM(PreservedMarks, restore_by_segment) {
+  ScopedDisabledBiasedLocking dbl;
+
+  // Use enough oops to fill more than two stack segments.
+  const size_t num_oops = 600;
+  FakeOop oops[num_oops];
+
+  PreservedMarks pm;
+  for (size_t i = 0; i < num_oops; i += 1) {
+    oops[i].set_mark(FakeOop::changedMark());
+    pm.push(oops[i].get_oop(), oops[i].mark());
+    oops[i].set_mark(FakeOop::originalMark());
+  }
+
+  GrowableArrayCHeap<PreservedMarks::Segment, mtGC> segments;
+  pm.add_segments(&segments);
+  ASSERT_LT(1, segments.length());
+
+  size_t total_size = 0;
+  for (int i = 0; i < segments.length(); i += 1) {
+    segments.at(i).restore();
+    total_size += segments.at(i).size();
+  }
+  ASSERT_EQ(num_oops, total_size);
+  pm.clear_restored();
+
+  for (size_t i = 0; i < num_oops; i += 1) {
+    ASSERT_MARK_WORD_EQ(oops[i].mark(), FakeOop::changedMark());
+  }
+}
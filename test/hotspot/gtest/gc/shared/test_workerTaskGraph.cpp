@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/workerTaskGraph.hpp"
+#include "unittest.hpp"
+
+class RecordingSubTask : public WorkerSubTask {
+  int* _next_position;
+public:
+  int _position;
+  int _num_calls;
+
+  RecordingSubTask(int* next_position) :
+    _next_position(next_position), _position(-1), _num_calls(0) { }
+
+  void do_work(uint worker_id) override {
+    _position = (*_next_position)++;
+    _num_calls++;
+  }
+};
+
+class TestWorkerTaskGraph : public WorkerTaskGraph {
+public:
+  TestWorkerTaskGraph() : WorkerTaskGraph("Test") { }
+};
+
+TEST_VM(WorkerTaskGraph, independent_tasks) {
+  int next = 0;
+  RecordingSubTask a(&next);
+  RecordingSubTask b(&next);
+  TestWorkerTaskGraph graph;
+  graph.add_task(&a, true /* is_serial */);
+  graph.add_task(&b, false /* is_serial */);
+  ASSERT_FALSE(graph.is_complete());
+
+  graph.work(0);
+  // A second worker finds nothing left to do.
+  graph.work(1);
+
+  ASSERT_TRUE(graph.is_complete());
+  ASSERT_EQ(0, a._position);
+  ASSERT_EQ(1, b._position);
+  ASSERT_EQ(1, a._num_calls);
+  ASSERT_EQ(1, b._num_calls);
+}
+
+TEST_VM(WorkerTaskGraph, dependencies) {
+  int next = 0;
+  RecordingSubTask a(&next);
+  RecordingSubTask b(&next);
+  RecordingSubTask c(&next);
+  TestWorkerTaskGraph graph;
+  // Added in reverse order, executed in dependency order.
+  graph.add_task(&c, false /* is_serial */);
+  graph.add_task(&b, true /* is_serial */);
+  graph.add_task(&a, false /* is_serial */);
+  graph.add_dependency(&b, &c);
+  graph.add_dependency(&a, &b);
+
+  graph.work(0);
+
+  ASSERT_TRUE(graph.is_complete());
+  ASSERT_EQ(0, a._position);
+  ASSERT_EQ(1, b._position);
+  ASSERT_EQ(2, c._position);
+}
@@ -68,76 +68,35 @@ LOG_LEVEL_LIST
   }
 };
 
-TEST_VM(AsyncLogBufferTest, fifo) {
-  LinkedListDeque<int, mtLogging> fifo;
-  LinkedListImpl<int, ResourceObj::C_HEAP, mtLogging> result;
-
-  fifo.push_back(1);
-  EXPECT_EQ((size_t)1, fifo.size());
-  EXPECT_EQ(1, *(fifo.back()));
-
-  fifo.pop_all(&result);
-  EXPECT_EQ((size_t)0, fifo.size());
-  EXPECT_EQ(NULL, fifo.back());
-  EXPECT_EQ((size_t)1, result.size());
-  EXPECT_EQ(1, *(result.head()->data()));
-  result.clear();
-
-  fifo.push_back(2);
-  fifo.push_back(1);
-  fifo.pop_all(&result);
-  EXPECT_EQ((size_t)2, result.size());
-  EXPECT_EQ(2, *(result.head()->data()));
-  EXPECT_EQ(1, *(result.head()->next()->data()));
-  result.clear();
-  const int N = 1000;
-  for (int i=0; i<N; ++i) {
-    fifo.push_back(i);
+TEST_VM(AsyncLogBufferTest, reserve) {
+  const size_t msg_size = AsyncLogBuffer::Message::size_for(10);
+  const size_t N = 10;
+  AsyncLogBuffer buffer(N * msg_size);
+  bool sealed = false;
+
+  // A new buffer is sealed.
+  EXPECT_EQ(NULL, buffer.reserve(msg_size, &sealed));
+  EXPECT_TRUE(sealed);
+
+  buffer.reset();
+  for (size_t i = 0; i < N; ++i) {
+    char* p = buffer.reserve(msg_size, &sealed);
+    EXPECT_EQ((char*)buffer.at(i * msg_size), p);
+    buffer.commit(msg_size);
   }
-  fifo.pop_all(&result);
 
-  EXPECT_EQ((size_t)N, result.size());
-  LinkedListIterator<int> it(result.head());
-  for (int i=0; i<N; ++i) {
-    int* e = it.next();
-    EXPECT_EQ(i, *e);
-  }
-}
-
-TEST_VM(AsyncLogBufferTest, deque) {
-  LinkedListDeque<int, mtLogging> deque;
-  const int N = 10;
-
-  EXPECT_EQ(NULL, deque.front());
-  EXPECT_EQ(NULL, deque.back());
-  for (int i = 0; i < N; ++i) {
-    deque.push_back(i);
-  }
+  // The buffer is full.
+  EXPECT_EQ(NULL, buffer.reserve(msg_size, &sealed));
+  EXPECT_FALSE(sealed);
 
-  EXPECT_EQ(0, *(deque.front()));
-  EXPECT_EQ(N-1, *(deque.back()));
-  EXPECT_EQ((size_t)N, deque.size());
-
-  deque.pop_front();
-  EXPECT_EQ((size_t)(N - 1), deque.size());
-  EXPECT_EQ(1, *(deque.front()));
-  EXPECT_EQ(N - 1, *(deque.back()));
-
-  deque.pop_front();
-  EXPECT_EQ((size_t)(N - 2), deque.size());
-  EXPECT_EQ(2, *(deque.front()));
-  EXPECT_EQ(N - 1, *(deque.back()));
-
-
-  for (int i=2; i < N-1; ++i) {
-    deque.pop_front();
-  }
-  EXPECT_EQ((size_t)1, deque.size());
-  EXPECT_EQ(N - 1, *(deque.back()));
-  EXPECT_EQ(deque.back(), deque.front());
+  EXPECT_EQ(N * msg_size, buffer.seal());
+  EXPECT_EQ(NULL, buffer.reserve(1, &sealed));
+  EXPECT_TRUE(sealed);
 
-  deque.pop_front();
-  EXPECT_EQ((size_t)0, deque.size());
+  buffer.reset();
+  EXPECT_EQ((char*)buffer.at(0), buffer.reserve(msg_size, &sealed));
+  buffer.commit(msg_size);
+  EXPECT_EQ(msg_size, buffer.seal());
 }
 
 TEST_VM_F(AsyncLogTest, asynclog) {
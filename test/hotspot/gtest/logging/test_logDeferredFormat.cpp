@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "logging/logDeferredFormat.hpp"
+#include "unittest.hpp"
+
+static size_t capture(char* record, size_t len, const char* fmt, ...) ATTRIBUTE_PRINTF(3, 4);
+
+static size_t capture(char* record, size_t len, const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  size_t size = LogDeferredFormat::capture(record, len, "GC(1) ", 6, fmt, args);
+  va_end(args);
+  return size;
+}
+
+static void test_format(const char* expected, size_t size, const char* record) {
+  char buf[256];
+  ASSERT_NE((size_t)0, size);
+  EXPECT_EQ(strlen(expected), LogDeferredFormat::format(record, buf, sizeof(buf)));
+  EXPECT_STREQ(expected, buf);
+
+  // Truncation
+  char small[8];
+  EXPECT_EQ(strlen(expected), LogDeferredFormat::format(record, small, sizeof(small)));
+  EXPECT_EQ((size_t)7, strlen(small));
+  EXPECT_EQ(0, strncmp(expected, small, 7));
+}
+
+TEST(LogDeferredFormat, conversions) {
+  char record[256];
+  size_t size;
+
+  size = capture(record, sizeof(record), "plain");
+  test_format("GC(1) plain", size, record);
+
+  size = capture(record, sizeof(record), "%d %5u %-3x| %ld " INT64_FORMAT " " SIZE_FORMAT " %%",
+                 -3, 7u, 255, -5L, (int64_t)1 << 40, (size_t)9);
+  test_format("GC(1) -3     7 ff | -5 1099511627776 9 %", size, record);
+
+  size = capture(record, sizeof(record), "%s and %.*s and %10.3f %c", "str", 3, "abcdef", 3.14159, 'z');
+  test_format("GC(1) str and abc and      3.142 z", size, record);
+
+  size = capture(record, sizeof(record), "%*d|%-*.*s|", 5, 42, 6, 2, "xyz");
+  test_format("GC(1)    42|xy    |", size, record);
+}
+
+TEST(LogDeferredFormat, strings_are_copied) {
+  char record[256];
+  char str[16];
+  strcpy(str, "before");
+  size_t size = capture(record, sizeof(record), "%s", str);
+  strcpy(str, "after");
+  test_format("GC(1) before", size, record);
+}
+
+TEST(LogDeferredFormat, not_deferred) {
+  char record[32];
+  // Does not fit
+  EXPECT_EQ((size_t)0, capture(record, sizeof(record), "%s", "a string that is longer than the record"));
+
+  char large[256];
+  // Dangling conversion
+  EXPECT_EQ((size_t)0, capture(large, sizeof(large), "dangling %"));
+}
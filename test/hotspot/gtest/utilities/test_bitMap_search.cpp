@@ -256,3 +256,27 @@ TEST(BitMap, search) {
     }
   }
 }
+
+// Exercise the multi-word skip of the search loop with a single bit at
+// every position after runs of uninteresting words of varying length.
+TEST(BitMap, search_sparse) {
+  const idx_t size = 16 * BitsPerWord;
+  CHeapBitMap test_ones(size);
+  CHeapBitMap test_zeros(size);
+  test_ones.clear_range(0, size);
+  test_zeros.set_range(0, size);
+
+  for (idx_t bit = 0; bit < size; ++bit) {
+    test_ones.set_bit(bit);
+    test_zeros.clear_bit(bit);
+    for (idx_t start = 0; start <= bit; start += BitsPerWord / 2) {
+      EXPECT_EQ(bit, test_ones.get_next_one_offset(start, size));
+      EXPECT_EQ(bit, test_zeros.get_next_zero_offset(start, size));
+      EXPECT_EQ(bit, test_ones.get_next_one_offset(start, bit + 1));
+      EXPECT_EQ(bit, test_ones.get_next_one_offset(start, bit));
+      EXPECT_EQ(bit, test_zeros.get_next_zero_offset(start, bit));
+    }
+    test_ones.clear_bit(bit);
+    test_zeros.set_bit(bit);
+  }
+}
@@ -325,6 +325,49 @@ static void cht_scope(Thread* thr) {
   delete cht;
 }
 
+struct SimpleTestBulkLookup {
+  uintptr_t* _vals;
+  SimpleTestBulkLookup(uintptr_t* vals) : _vals(vals) {}
+  uintx get_hash(size_t i) {
+    return Pointer::get_hash(_vals[i], NULL);
+  }
+  bool equals(size_t i, const uintptr_t* value, bool* is_dead) {
+    return _vals[i] == *value;
+  }
+};
+
+struct BulkValueGet {
+  uintptr_t* _results;
+  BulkValueGet(uintptr_t* results) : _results(results) {}
+  void operator()(size_t i, uintptr_t* value) {
+    EXPECT_NE(value, (uintptr_t*)NULL) << "expected valid value";
+    _results[i] = *value;
+  }
+};
+
+static void cht_get_bulk(Thread* thr) {
+  const size_t count = 16;
+  uintptr_t vals[count];
+  uintptr_t results[count];
+  SimpleTestTable* cht = new SimpleTestTable(2, 10);
+  for (size_t i = 0; i < count; i++) {
+    vals[i] = i + 1;
+    results[i] = 0;
+    // Insert only the even values.
+    if ((i & 1) == 0) {
+      SimpleTestLookup stl(vals[i]);
+      EXPECT_TRUE(cht->insert(thr, stl, vals[i])) << "Insert unique value failed.";
+    }
+  }
+  SimpleTestBulkLookup lookup(vals);
+  BulkValueGet bvg(results);
+  EXPECT_EQ(cht->get_bulk(thr, lookup, count, bvg), count / 2) << "Wrong number of values found.";
+  for (size_t i = 0; i < count; i++) {
+    EXPECT_EQ(results[i], (i & 1) == 0 ? vals[i] : (uintptr_t)0) << "Wrong value for key " << i;
+  }
+  delete cht;
+}
+
 struct ChtScan {
   size_t _count;
   ChtScan() : _count(0) {}
@@ -480,6 +523,10 @@ TEST_VM(ConcurrentHashTable, basic_scope) {
   nomt_test_doer(cht_scope);
 }
 
+TEST_VM(ConcurrentHashTable, basic_get_bulk) {
+  nomt_test_doer(cht_get_bulk);
+}
+
 TEST_VM(ConcurrentHashTable, basic_get_insert_bulk_delete) {
   nomt_test_doer(cht_getinsert_bulkdelete);
 }
@@ -1130,3 +1177,65 @@ public:
 TEST_VM(ConcurrentHashTable, concurrent_mt_bulk_delete) {
   mt_test_doer<Driver_BD_Thread>();
 }
+
+//#############################################################################################
+
+class MT_Grow_Helper_Thread : public JavaTestThread {
+  TestTable* _cht;
+  public:
+  MT_Grow_Helper_Thread(Semaphore* post, TestTable* cht)
+    : JavaTestThread(post), _cht(cht) {}
+  virtual ~MT_Grow_Helper_Thread() {}
+  void main_run() {
+    while(_cht->help_grow(this));
+  }
+};
+
+class Driver_Grow_Thread : public JavaTestThread {
+public:
+  Driver_Grow_Thread(Semaphore* post) : JavaTestThread(post) {
+  };
+  virtual ~Driver_Grow_Thread(){}
+
+  void main_run() {
+    Semaphore done(0);
+    TestTable* cht = new TestTable(12, 13, 2);
+    for (uintptr_t v = 1; v < 99999; v++ ) {
+      TestLookup tl(v);
+      EXPECT_TRUE(cht->insert(this, tl, v)) << "Inserting an unique value should work.";
+    }
+    TestTable::GrowTask gt(cht, true /* mt */ );
+    EXPECT_TRUE(gt.prepare(this)) << "Uncontended prepare must work.";
+
+    MT_Grow_Helper_Thread* tt[4];
+    for (int i = 0; i < 4; i++) {
+      tt[i] = new MT_Grow_Helper_Thread(&done, cht);
+      tt[i]->doit();
+    }
+
+    for (uintptr_t v = 1; v < 99999; v++ ) {
+      TestLookup tl(v);
+      EXPECT_EQ(cht_get_copy(cht, this, tl), v) << "Getting an item during grow failed.";
+    }
+
+    while(gt.do_task(this));
+
+    for (int i = 0; i < 4; i++) {
+      done.wait();
+    }
+
+    gt.done(this);
+
+    EXPECT_EQ(cht->get_size_log2(this), (size_t)13) << "Table should have grown.";
+    EXPECT_FALSE(cht->help_grow(this)) << "No grow should be left to help with.";
+    for (uintptr_t v = 1; v < 99999; v++ ) {
+      TestLookup tl(v);
+      EXPECT_EQ(cht_get_copy(cht, this, tl), v) << "Getting an item after grow failed.";
+    }
+    delete cht;
+  }
+};
+
+TEST_VM(ConcurrentHashTable, concurrent_mt_grow) {
+  mt_test_doer<Driver_Grow_Thread>();
+}
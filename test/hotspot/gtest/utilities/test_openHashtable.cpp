@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "memory/allocation.hpp"
+#include "memory/resourceArea.hpp"
+#include "unittest.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/openHashtable.hpp"
+
+class OpenHashtableTest : public ::testing::Test {
+ protected:
+  typedef void* K;
+  typedef uintx V;
+
+  static unsigned identity_hash(const K& k) {
+    return (unsigned) (uintptr_t) k;
+  }
+
+  static unsigned bad_hash(const K& k) {
+    return 1;
+  }
+
+  static K as_K(uintptr_t val) {
+    return (K) val;
+  }
+
+  class EqualityTestIter {
+   public:
+    uintx _count;
+    EqualityTestIter() : _count(0) {}
+
+    bool do_entry(K const& k, V const& v) {
+      EXPECT_EQ((uintptr_t) k, (uintptr_t) v);
+      _count++;
+      return true;
+    }
+  };
+
+  template<unsigned (*HASH)(K const&), ResourceObj::allocation_type ALLOC_TYPE>
+  static void test(uintptr_t num_elements) {
+    ResourceMark rm;
+    OpenHashtable<K, V, HASH, primitive_equals<K>, ALLOC_TYPE, mtTest> oh;
+
+    // Insert keys; the table has to grow several times.
+    for (uintptr_t i = 0; i < num_elements; ++i) {
+      ASSERT_TRUE(oh.put(as_K(i), i));
+    }
+    ASSERT_EQ((uintx) num_elements, (uintx) oh.number_of_entries());
+    for (uintptr_t i = 0; i < num_elements; ++i) {
+      V* v = oh.get(as_K(i));
+      ASSERT_TRUE(v != NULL);
+      ASSERT_EQ(i, *v);
+    }
+    ASSERT_FALSE(oh.contains(as_K(num_elements)));
+
+    // Updates and put_if_absent do not add entries.
+    ASSERT_FALSE(oh.put(as_K(0), 0));
+    bool created = true;
+    V* v = oh.put_if_absent(as_K(0), 17, &created);
+    ASSERT_FALSE(created);
+    ASSERT_EQ((uintx) 0, *v);
+    v = oh.put_if_absent(as_K(num_elements), &created);
+    ASSERT_TRUE(created);
+    ASSERT_EQ((uintx) 0, *v);
+    *v = num_elements;
+
+    EqualityTestIter et;
+    oh.iterate(&et);
+    ASSERT_EQ((uintx) num_elements + 1, et._count);
+
+    // Remove the even keys; the odd ones must stay reachable across the
+    // backward shifts.
+    for (uintptr_t i = 0; i <= num_elements; i += 2) {
+      ASSERT_TRUE(oh.remove(as_K(i)));
+      ASSERT_FALSE(oh.remove(as_K(i)));
+    }
+    for (uintptr_t i = 0; i <= num_elements; ++i) {
+      ASSERT_EQ(i % 2 == 1, oh.contains(as_K(i))) << "key " << i;
+    }
+    ASSERT_EQ((uintx) (num_elements + 1) / 2, (uintx) oh.number_of_entries());
+  }
+};
+
+TEST_VM_F(OpenHashtableTest, identity_hash_resource) {
+  test<identity_hash, ResourceObj::RESOURCE_AREA>(10000);
+}
+
+TEST_VM_F(OpenHashtableTest, identity_hash_c_heap) {
+  test<identity_hash, ResourceObj::C_HEAP>(10000);
+}
+
+TEST_VM_F(OpenHashtableTest, bad_hash_c_heap) {
+  test<bad_hash, ResourceObj::C_HEAP>(500);
+}
+
+TEST_VM_F(OpenHashtableTest, presized) {
+  OpenHashtable<K, V, identity_hash, primitive_equals<K>, ResourceObj::C_HEAP, mtTest> oh(1000);
+  unsigned capacity = oh.capacity();
+  for (uintptr_t i = 0; i < 1000; ++i) {
+    oh.put(as_K(i << LogHeapWordSize), i);
+  }
+  ASSERT_EQ(capacity, oh.capacity());
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Allocation throughput of small objects and of primitive and reference
+ * arrays, run once per collector through the nested subclasses.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+public abstract class Allocation {
+
+    @Param({"16", "1024", "1048576"})
+    int arraySize;
+
+    static class Node {
+        Object ref;
+        long value;
+    }
+
+    @Benchmark
+    public Object allocateObject() {
+        return new Node();
+    }
+
+    @Benchmark
+    public byte[] allocateByteArray() {
+        return new byte[arraySize];
+    }
+
+    @Benchmark
+    public Object[] allocateObjectArray() {
+        return new Object[arraySize];
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseSerialGC", "-Xmx1g", "-Xms1g"})
+    public static class Serial extends Allocation {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseParallelGC", "-Xmx1g", "-Xms1g"})
+    public static class Parallel extends Allocation {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC", "-Xmx1g", "-Xms1g"})
+    public static class G1 extends Allocation {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseZGC", "-Xmx1g", "-Xms1g"})
+    public static class Z extends Allocation {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseShenandoahGC", "-Xmx1g", "-Xms1g"})
+    public static class Shenandoah extends Allocation {}
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Cost of the GC read and write barriers of reference field and array
+ * accesses in compiled code, run once per collector through the nested
+ * subclasses. The old objects are allocated up front, so that with a
+ * generational collector the stores are old-to-young or old-to-old.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+public abstract class Barriers {
+
+    static final int SIZE = 1024;
+
+    static class Holder {
+        Object field;
+    }
+
+    Holder[] holders;
+    Object[] array;
+    Object value;
+
+    @Setup
+    public void setup() {
+        holders = new Holder[SIZE];
+        array = new Object[SIZE];
+        for (int i = 0; i < SIZE; i++) {
+            holders[i] = new Holder();
+            holders[i].field = new Object();
+            array[i] = new Object();
+        }
+        System.gc();
+        value = new Object();
+    }
+
+    @Benchmark
+    public void storeField() {
+        Object v = value;
+        for (Holder h : holders) {
+            h.field = v;
+        }
+    }
+
+    @Benchmark
+    public void storeNullField() {
+        for (Holder h : holders) {
+            h.field = null;
+        }
+    }
+
+    @Benchmark
+    public void storeArray() {
+        Object v = value;
+        Object[] a = array;
+        for (int i = 0; i < a.length; i++) {
+            a[i] = v;
+        }
+    }
+
+    @Benchmark
+    public int loadField() {
+        int sum = 0;
+        for (Holder h : holders) {
+            sum += (h.field == value) ? 1 : 0;
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public int loadArray() {
+        int sum = 0;
+        Object[] a = array;
+        for (int i = 0; i < a.length; i++) {
+            sum += (a[i] == value) ? 1 : 0;
+        }
+        return sum;
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseSerialGC"})
+    public static class Serial extends Barriers {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseParallelGC"})
+    public static class Parallel extends Barriers {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC"})
+    public static class G1 extends Barriers {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseZGC"})
+    public static class Z extends Barriers {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseShenandoahGC"})
+    public static class Shenandoah extends Barriers {}
+}
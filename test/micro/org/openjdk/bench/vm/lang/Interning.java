@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * StringTable and SymbolTable lookups: String.intern of strings that are
+ * already interned and of new strings, and Class.forName by name.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Fork(3)
+public class Interning {
+
+    static final int COUNT = 4096;
+
+    @Param({"16", "128"})
+    int length;
+
+    String[] interned;
+    int index;
+    long fresh;
+    String prefix;
+
+    @Setup
+    public void setup() {
+        StringBuilder sb = new StringBuilder();
+        while (sb.length() < length - 16) {
+            sb.append('x');
+        }
+        prefix = sb.toString();
+        interned = new String[COUNT];
+        for (int i = 0; i < COUNT; i++) {
+            interned[i] = (prefix + i).intern();
+        }
+    }
+
+    @Benchmark
+    public String internExisting() {
+        index = (index + 1) & (COUNT - 1);
+        // A different String instance with interned contents.
+        return new String(interned[index]).intern();
+    }
+
+    @Benchmark
+    public String internNew() {
+        return (prefix + "n" + fresh++).intern();
+    }
+
+    @Benchmark
+    public Class<?> classForName() throws ClassNotFoundException {
+        return Class.forName("java.util.concurrent.ConcurrentHashMap");
+    }
+}
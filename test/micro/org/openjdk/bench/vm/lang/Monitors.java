@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Group;
+import org.openjdk.jmh.annotations.GroupThreads;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Uncontended, recursive and contended Java monitor enter and exit.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Fork(3)
+public class Monitors {
+
+    @State(Scope.Thread)
+    public static class ThreadLock {
+        final Object lock = new Object();
+        int count;
+    }
+
+    @State(Scope.Group)
+    public static class SharedLock {
+        final Object lock = new Object();
+        int count;
+    }
+
+    @Benchmark
+    public int uncontended(ThreadLock s) {
+        synchronized (s.lock) {
+            return ++s.count;
+        }
+    }
+
+    @Benchmark
+    public int recursive(ThreadLock s) {
+        synchronized (s.lock) {
+            synchronized (s.lock) {
+                return ++s.count;
+            }
+        }
+    }
+
+    @Benchmark
+    public int waitNotify(ThreadLock s) {
+        synchronized (s.lock) {
+            // Inflates the monitor without blocking.
+            s.lock.notify();
+            return ++s.count;
+        }
+    }
+
+    @Benchmark
+    @Group("contended2")
+    @GroupThreads(2)
+    public int contended2(SharedLock s) {
+        synchronized (s.lock) {
+            return ++s.count;
+        }
+    }
+
+    @Benchmark
+    @Group("contended8")
+    @GroupThreads(8)
+    public int contended8(SharedLock s) {
+        synchronized (s.lock) {
+            return ++s.count;
+        }
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.lang.invoke.MethodHandle;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+import java.lang.reflect.Method;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Invocation cost of a small method called directly, through constant
+ * and non-constant MethodHandles, and through core reflection, with and
+ * without the Method lookup.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Fork(3)
+public class ReflectiveInvocation {
+
+    static final MethodHandle STATIC_MH;
+    static final MethodHandle VIRTUAL_MH;
+    static final Method STATIC_METHOD;
+
+    static {
+        try {
+            MethodHandles.Lookup lookup = MethodHandles.lookup();
+            STATIC_MH = lookup.findStatic(ReflectiveInvocation.class, "add",
+                    MethodType.methodType(int.class, int.class, int.class));
+            VIRTUAL_MH = lookup.findVirtual(ReflectiveInvocation.class, "addTo",
+                    MethodType.methodType(int.class, int.class));
+            STATIC_METHOD = ReflectiveInvocation.class.getDeclaredMethod("add", int.class, int.class);
+        } catch (ReflectiveOperationException e) {
+            throw new ExceptionInInitializerError(e);
+        }
+    }
+
+    MethodHandle staticMH;
+    Method method;
+    int x = 1;
+    int y = 2;
+
+    public static int add(int a, int b) {
+        return a + b;
+    }
+
+    public int addTo(int a) {
+        return x + a;
+    }
+
+    @Setup
+    public void setup() {
+        staticMH = STATIC_MH;
+        method = STATIC_METHOD;
+    }
+
+    @Benchmark
+    public int direct() {
+        return add(x, y);
+    }
+
+    @Benchmark
+    public int methodHandleConstant() throws Throwable {
+        return (int) STATIC_MH.invokeExact(x, y);
+    }
+
+    @Benchmark
+    public int methodHandleVirtualConstant() throws Throwable {
+        return (int) VIRTUAL_MH.invokeExact(this, y);
+    }
+
+    @Benchmark
+    public int methodHandleNonConstant() throws Throwable {
+        return (int) staticMH.invokeExact(x, y);
+    }
+
+    @Benchmark
+    public Object reflection() throws ReflectiveOperationException {
+        return method.invoke(null, x, y);
+    }
+
+    @Benchmark
+    public Object reflectionLookupAndInvoke() throws ReflectiveOperationException {
+        Method m = ReflectiveInvocation.class.getDeclaredMethod("add", int.class, int.class);
+        return m.invoke(null, x, y);
+    }
+}
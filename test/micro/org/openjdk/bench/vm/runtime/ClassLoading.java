@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.runtime;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.io.IOException;
+import java.io.InputStream;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Class definition throughput: parse, verify and link a small class in a
+ * fresh class loader, and resolve an already loaded class by name.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+@Fork(3)
+public class ClassLoading {
+
+    public static class Loaded implements Runnable {
+        int value;
+
+        public void run() {
+            value++;
+        }
+    }
+
+    static final class DefiningLoader extends ClassLoader {
+        DefiningLoader(ClassLoader parent) {
+            super(parent);
+        }
+
+        Class<?> define(String name, byte[] bytes) {
+            return defineClass(name, bytes, 0, bytes.length);
+        }
+    }
+
+    static final String NAME = Loaded.class.getName();
+
+    byte[] bytes;
+
+    @Setup
+    public void setup() throws IOException {
+        String resource = NAME.replace('.', '/') + ".class";
+        try (InputStream in = ClassLoading.class.getClassLoader().getResourceAsStream(resource)) {
+            bytes = in.readAllBytes();
+        }
+    }
+
+    @Benchmark
+    public Class<?> defineClass() {
+        return new DefiningLoader(ClassLoading.class.getClassLoader()).define(NAME, bytes);
+    }
+
+    @Benchmark
+    public Object defineAndInitialize() throws ReflectiveOperationException {
+        Class<?> c = new DefiningLoader(ClassLoading.class.getClassLoader()).define(NAME, bytes);
+        return c.getConstructor().newInstance();
+    }
+
+    @Benchmark
+    public Class<?> loadLoaded() throws ClassNotFoundException {
+        return Class.forName(NAME, false, ClassLoading.class.getClassLoader());
+    }
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+#include <jni.h>
+
+JNIEXPORT void JNICALL Java_org_openjdk_bench_vm_runtime_JNICalls_blank
+  (JNIEnv *env, jclass cls) {
+}
+
+JNIEXPORT jint JNICALL Java_org_openjdk_bench_vm_runtime_JNICalls_identity
+  (JNIEnv *env, jclass cls, jint x) {
+    return x;
+}
+
+JNIEXPORT jobject JNICALL Java_org_openjdk_bench_vm_runtime_JNICalls_identityObject
+  (JNIEnv *env, jclass cls, jobject o) {
+    return o;
+}
+
+JNIEXPORT jint JNICALL Java_org_openjdk_bench_vm_runtime_JNICalls_arrayLength
+  (JNIEnv *env, jclass cls, jintArray array) {
+    return (*env)->GetArrayLength(env, array);
+}
+
+JNIEXPORT jint JNICALL Java_org_openjdk_bench_vm_runtime_JNICalls_instanceIdentity
+  (JNIEnv *env, jobject obj, jint x) {
+    return x;
+}